@@ -0,0 +1,236 @@
+#!/usr/bin/env python
+"""\
+Stream g-code to Smoothie over USB serial using the framed binary mode
+
+G0/G1 lines that only use X Y Z E F S are sent as pretokenized moves, anything else is sent as text
+inside the frame. See src/modules/communication/utils/BinaryGcode.h for the format.
+
+With -j the records are written to a job file instead, which the player plays from the SD card without
+parsing the moves. Give it a name ending in .gbin and upload it with smoothie-upload.py.
+
+Requires pyserial
+"""
+
+from __future__ import print_function
+import sys
+import re
+import struct
+import argparse
+
+SYNC = 0xA5
+OP_G0 = 0x00
+OP_G1 = 0x01
+OP_TEXT = 0x02
+OP_END = 0x7F
+MOVE_LETTERS = 'XYZEFS'
+
+# Define command line argument interface
+parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over USB serial using binary frames.')
+parser.add_argument('gcode_file', type=argparse.FileType('r'),
+        help='g-code filename to be streamed')
+parser.add_argument('device', nargs='?',
+        help='Smoothie serial port, eg /dev/ttyACM0')
+parser.add_argument('-o', '--output',
+        help='write the frames to this file instead of streaming them')
+parser.add_argument('-j', '--job',
+        help='write a binary job file for the player instead of streaming')
+parser.add_argument('-f', '--frame-size', type=int, default=128,
+        help='most payload bytes in one frame (max 255)')
+parser.add_argument('-q', '--quiet', action='store_true', default=False,
+        help='suppress output text')
+args = parser.parse_args()
+
+verbose = not args.quiet
+
+def crc16(data):
+    crc = 0xFFFF
+    for c in bytearray(data):
+        crc ^= c << 8
+        for i in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+word_re = re.compile(r'([A-Z])\s*([-+]?[0-9]*\.?[0-9]+)')
+
+def encode_line(line):
+    """return the record for one line of g-code, or None if there is nothing to send"""
+    line = re.split(r'[;(]', line)[0].strip().upper()
+    if not line:
+        return None
+
+    words = word_re.findall(line)
+    # only a plain G0 or G1 with values we know can go as a move, and only if nothing was left unparsed
+    if words and words[0][0] == 'G' and words[0][1] in ('0', '1', '00', '01') and \
+            len(word_re.sub('', line).strip()) == 0:
+        values = {}
+        for l, v in words[1:]:
+            if l not in MOVE_LETTERS or l in values:
+                values = None
+                break
+            values[l] = float(v)
+        if values is not None:
+            mask = 0
+            rec = b''
+            for i, l in enumerate(MOVE_LETTERS):
+                if l in values:
+                    mask |= 1 << i
+                    rec += struct.pack('<f', values[l])
+            op = OP_G0 if int(words[0][1]) == 0 else OP_G1
+            return struct.pack('<BB', op, mask) + rec
+
+    if len(line) > 255:
+        print("Line too long, skipped: " + line)
+        return None
+    return struct.pack('<BB', OP_TEXT, len(line)) + line.encode('ascii')
+
+def build_payloads(f, frame_size):
+    """pack the records of the file into frame payloads, finishing with the end record"""
+    payloads = []
+    payload = b''
+    for line in f:
+        rec = encode_line(line)
+        if rec is None:
+            continue
+        if len(payload) + len(rec) > frame_size:
+            payloads.append(payload)
+            payload = b''
+        payload += rec
+    if len(payload) + 1 > frame_size:
+        payloads.append(payload)
+        payload = b''
+    payloads.append(payload + struct.pack('<B', OP_END))
+    return payloads
+
+def frame(seq, payload):
+    body = struct.pack('<BB', seq & 0xFF, len(payload)) + payload
+    return struct.pack('<B', SYNC) + body + struct.pack('<H', crc16(body))
+
+def record_length(data, p):
+    """length of the record at p, as BinaryGcode::record_length, 0 if it is cut short or unknown"""
+    if p >= len(data):
+        return 0
+    op = bytearray(data[p:p + 1])[0]
+    if op in (OP_G0, OP_G1):
+        if len(data) - p < 2:
+            return 0
+        mask = bytearray(data[p + 1:p + 2])[0]
+        n = 2 + 4 * sum(1 for i in range(len(MOVE_LETTERS)) if mask & (1 << i))
+    elif op == OP_TEXT:
+        if len(data) - p < 2:
+            return 0
+        n = 2 + bytearray(data[p + 1:p + 2])[0]
+    elif op == OP_END:
+        n = 1
+    else:
+        return 0
+    return n if len(data) - p >= n else 0
+
+def check_job(fn, records):
+    """read the job file back the way the player does, it should give the records that were written"""
+    with open(fn, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'SGB1':
+        return False
+    p = 4
+    n = 0
+    while p < len(data):
+        l = record_length(data, p)
+        if l == 0:
+            return False
+        p += l
+        n += 1
+    return n == records
+
+if args.job:
+    # the same records, unframed, after the header
+    n = 0
+    with open(args.job, 'wb') as out:
+        out.write(b'SGB1')
+        for line in args.gcode_file:
+            rec = encode_line(line)
+            if rec is None:
+                continue
+            out.write(rec)
+            n += 1
+    if not check_job(args.job, n):
+        print("The records read back from " + args.job + " are not the ones written")
+        sys.exit(1)
+    if verbose: print("Wrote " + str(n) + " records to " + args.job)
+    sys.exit(0)
+
+frame_size = max(8, min(args.frame_size, 255))
+payloads = build_payloads(args.gcode_file, frame_size)
+
+if args.output:
+    with open(args.output, 'wb') as out:
+        for i, p in enumerate(payloads):
+            out.write(frame(i, p))
+    if verbose: print("Wrote " + str(len(payloads)) + " frames to " + args.output)
+    sys.exit(0)
+
+if args.device is None:
+    print("Need a serial port to stream to, or -o to write a file")
+    sys.exit(1)
+
+import serial
+
+s = serial.Serial(args.device, 115200, timeout=1)
+s.write(b"\nbinary\n")
+
+window = 0
+while True:
+    ln = s.readline().decode('ascii', 'replace').strip()
+    if ln.startswith("ok binary"):
+        window = int(ln.split("window:")[1])
+        break
+    if verbose and ln: print("RCV: " + ln)
+
+if verbose: print("Streaming " + args.gcode_file.name + " in " + str(len(payloads)) + " frames, window " + str(window) + " bytes")
+
+# frames are numbered from 0, seq wraps at 256 so there must never be more than 255 outstanding
+sent = []          # (index, length) of frames not yet acked, oldest first
+next_frame = 0
+acked = 0
+rewound = None     # the frame we last went back to after a nak, the frames in flight after it get nak'd too
+while acked < len(payloads):
+    # keep the pipe full, up to the receive buffer space Smoothie gave us
+    while next_frame < len(payloads) and len(sent) < 255:
+        f = frame(next_frame, payloads[next_frame])
+        if sum(l for i, l in sent) + len(f) > window and sent:
+            break
+        s.write(f)
+        sent.append((next_frame, len(f)))
+        next_frame += 1
+
+    ln = s.readline().decode('ascii', 'replace').strip()
+    if not ln:
+        continue
+    if ln.startswith("ack "):
+        seq = int(ln[4:])
+        # acks come in order, the oldest one outstanding is the one being acked
+        while sent and (sent[0][0] & 0xFF) != seq:
+            sent.pop(0)
+        if sent:
+            sent.pop(0)
+            acked += 1
+            rewound = None
+            if verbose: print("ACK " + str(acked) + "/" + str(len(payloads)))
+    elif ln.startswith("nak "):
+        seq = int(ln[4:])
+        # go back to the frame Smoothie expects, only once for each time it gets lost
+        if sent and (sent[0][0] & 0xFF) == seq and rewound != sent[0][0]:
+            if verbose: print("NAK, resending from frame " + str(sent[0][0]))
+            rewound = next_frame = sent[0][0]
+            sent = []
+    elif ln != "ok" and verbose:
+        print("RCV: " + ln)
+
+# wait for the switch back to text
+while True:
+    ln = s.readline().decode('ascii', 'replace').strip()
+    if ln == "ok text":
+        break
+    if verbose and ln and ln != "ok": print("RCV: " + ln)
+
+print("Done")
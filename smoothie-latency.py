@@ -0,0 +1,204 @@
+#!/usr/bin/env python
+"""\
+Measure how fast Smoothie answers g-code lines, over telnet or USB serial
+
+A stream of small G1 moves back and forth is sent, as many lines ahead of their oks as the window allows,
+and the time from each line being written to its ok coming back is recorded. The line rate and the p50,
+p99 and max of those times are printed, followed by what M412 timed on the board: from the line being
+received to the dispatcher getting it, and to its ok. The difference between the two sets of times is
+the link and the host. The time spent waiting for the window to open, the receive space on the board to
+take the next line, is printed too, it is where a stream that is held up by the board loses its time.
+
+With -w 1 each line waits for the ok of the one before, which is the latency with nothing queued. The
+moves are short and fast so the planner queue fills up quickly, from then on the oks come at the rate the
+machine can take moves, which is what a long job streams at. Use -f to send something slower.
+
+USB serial requires pyserial
+"""
+
+from __future__ import print_function
+import sys
+import re
+import time
+import collections
+import telnetlib
+import argparse
+
+# Define command line argument interface
+parser = argparse.ArgumentParser(description='Measure line to ok latency of Smoothie over telnet or USB serial.')
+parser.add_argument('device',
+        help='Smoothie IP address, or serial port eg /dev/ttyACM0')
+parser.add_argument('-n','--lines', type=int, default=1000,
+        help='number of lines to send')
+parser.add_argument('-w','--window', type=int, default=0,
+        help='bytes (serial) or lines (telnet) to have outstanding, the firmware receive space if not given')
+parser.add_argument('-d','--distance', type=float, default=0.01,
+        help='length of each move in mm')
+parser.add_argument('-f','--feedrate', type=float, default=6000,
+        help='feedrate of the moves in mm/min')
+args = parser.parse_args()
+
+class Link:
+    """a read that times out can return part of a line, which is kept for the next one"""
+    def readline(self, timeout):
+        self.partial += self.read(timeout)
+        if not self.partial.endswith("\n"):
+            return ""
+        l = self.partial
+        self.partial = ""
+        return l
+
+class TelnetLink(Link):
+    def __init__(self, addr):
+        self.partial = ""
+        self.tn = telnetlib.Telnet(addr)
+        # read startup prompt
+        self.tn.read_until(b"> ")
+
+    def write(self, s):
+        self.tn.write(s.encode())
+
+    def read(self, timeout):
+        # the shell prompts after each command, which ends up in front of the next reply
+        l = self.tn.read_until(b"\n", timeout).decode(errors='replace')
+        while l.startswith("> "):
+            l = l[2:]
+        return l
+
+    def close(self):
+        self.tn.write(b"exit\n")
+        self.tn.read_all()
+
+class SerialLink(Link):
+    def __init__(self, port):
+        import serial
+        self.partial = ""
+        self.ser = serial.Serial(port, 115200, timeout=0.1)
+        self.ser.flushInput()
+
+    def write(self, s):
+        self.ser.write(s.encode())
+
+    def read(self, timeout):
+        self.ser.timeout = timeout
+        return self.ser.readline().decode(errors='replace')
+
+    def close(self):
+        self.ser.close()
+
+def is_serial(device):
+    return device.startswith('/') or device.upper().startswith('COM')
+
+def command(link, cmd):
+    """send cmd and return the lines it replies with before its ok"""
+    link.write(cmd + "\n")
+    lines = []
+    while True:
+        l = link.readline(5)
+        if not l:
+            print("No reply to " + cmd)
+            return lines
+        l = l.strip()
+        if l.startswith("ok"):
+            return lines
+        lines.append(l)
+
+def percentile(sorted_times, p):
+    if not sorted_times:
+        return 0
+    return sorted_times[min(len(sorted_times) - 1, (len(sorted_times) * p + 99) // 100 - 1)]
+
+serial_link = is_serial(args.device)
+print("Measuring " + ("USB serial " if serial_link else "telnet ") + args.device)
+link = SerialLink(args.device) if serial_link else TelnetLink(args.device)
+
+# rxspace on replies with the size of the receive space, RX: is bytes and RXL: is lines
+window = 1
+count_bytes = False
+for l in command(link, "rxspace on"):
+    m = re.search(r'RX:(\d+)', l)
+    if m:
+        window = int(m.group(1))
+        count_bytes = True
+    m = re.search(r'RXL:(\d+)', l)
+    if m and not count_bytes:
+        window = int(m.group(1))
+if args.window > 0:
+    window = args.window
+print("Window " + str(window) + (" bytes" if count_bytes else " lines"))
+
+command(link, "G91")
+command(link, "M412 R")
+
+# (length, time sent) of each line not yet acked
+outstanding = collections.deque()
+in_flight = 0
+times = []
+# how long each line that did not fit in the window waited for the space to send it
+space_waits = []
+halted = False
+
+def take_reply(timeout):
+    """read one reply line, true if it acked a line"""
+    global in_flight, halted
+    l = link.readline(timeout)
+    if not l:
+        return False
+    l = l.strip()
+    if l.startswith("!!") or l.startswith("error"):
+        print("Smoothie said: " + l)
+        halted = halted or l.startswith("!!")
+        return False
+    if not l.startswith("ok") or not outstanding:
+        return False
+    n, t = outstanding.popleft()
+    in_flight -= n if count_bytes else 1
+    times.append(time.time() - t)
+    return True
+
+start = time.time()
+for i in range(args.lines):
+    line = "G1 X%g F%g\n" % (args.distance if i % 2 == 0 else -args.distance, args.feedrate)
+    n = len(line) if count_bytes else 1
+    if outstanding and in_flight + n > window:
+        waited = time.time()
+        while outstanding and in_flight + n > window and not halted:
+            take_reply(1)
+        space_waits.append(time.time() - waited)
+    if halted:
+        break
+    link.write(line)
+    outstanding.append((len(line), time.time()))
+    in_flight += n
+    while outstanding and take_reply(0):
+        pass
+
+while outstanding and not halted:
+    if not take_reply(10):
+        print("Timed out waiting for %d oks" % len(outstanding))
+        break
+
+elapsed = time.time() - start
+
+board = []
+if not halted:
+    board = command(link, "M412")
+    command(link, "G90")
+    command(link, "rxspace off")
+link.close()
+
+times.sort()
+print("Sent %d lines in %1.2fs, %1.1f lines/sec" % (len(times), elapsed, len(times) / elapsed if elapsed > 0 else 0))
+if times:
+    print("Line to ok: avg %1.2fms p50 %1.2fms p99 %1.2fms max %1.2fms" % (sum(times) * 1000 / len(times),
+        percentile(times, 50) * 1000, percentile(times, 99) * 1000, times[-1] * 1000))
+space_waits.sort()
+if space_waits:
+    total = sum(space_waits)
+    print("Waited for receive space before %d lines, %1.2fs in all, %1.0f%% of the time: p50 %1.2fms p99 %1.2fms max %1.2fms" % (
+        len(space_waits), total, total * 100 / elapsed if elapsed > 0 else 0,
+        percentile(space_waits, 50) * 1000, percentile(space_waits, 99) * 1000, space_waits[-1] * 1000))
+else:
+    print("Never waited for receive space")
+for l in board:
+    print("Board " + l)
@@ -1,55 +1,209 @@
 #!/usr/bin/env python
 """\
-Stream g-code to Smoothie telnet connection
+Stream g-code to Smoothie over telnet or USB serial
 
 Based on GRBL stream.py
+
+Lines are sent ahead of their oks, as many as fit in the firmware's receive space. The stream is put into
+rxspace mode first, which replies with how big that space is, in bytes for USB serial and in lines for
+telnet, and the sent lines not yet acked are counted against it.
+
+At the end the line rate, the time each line waited for its ok, and the planner queue underruns from M411
+are printed.
+
+USB serial requires pyserial
 """
 
 from __future__ import print_function
 import sys
+import re
+import time
+import collections
 import telnetlib
 import argparse
 
 # Define command line argument interface
-parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over telnet.')
+parser = argparse.ArgumentParser(description='Stream g-code file to Smoothie over telnet or USB serial.')
 parser.add_argument('gcode_file', type=argparse.FileType('r'),
         help='g-code filename to be streamed')
-parser.add_argument('ipaddr',
-        help='Smoothie IP address')
+parser.add_argument('device',
+        help='Smoothie IP address, or serial port eg /dev/ttyACM0')
 parser.add_argument('-q','--quiet',action='store_true', default=False,
         help='suppress output text')
+parser.add_argument('-w','--window', type=int, default=0,
+        help='bytes (serial) or lines (telnet) to have outstanding, the firmware receive space if not given')
+parser.add_argument('-s','--simple',action='store_true', default=False,
+        help='send a line and wait for its ok, no window')
 args = parser.parse_args()
 
 f = args.gcode_file
 verbose = not args.quiet
 
-# Stream g-code to Smoothie
-print("Streaming " + args.gcode_file.name + " to " + args.ipaddr)
+class Link:
+    """a read that times out can return part of a line, which is kept for the next one"""
+    def readline(self, timeout):
+        self.partial += self.read(timeout)
+        if not self.partial.endswith("\n"):
+            return ""
+        l = self.partial
+        self.partial = ""
+        return l
+
+class TelnetLink(Link):
+    def __init__(self, addr):
+        self.partial = ""
+        self.tn = telnetlib.Telnet(addr)
+        # read startup prompt
+        self.tn.read_until(b"> ")
+
+    def write(self, s):
+        self.tn.write(s.encode())
+
+    def read(self, timeout):
+        # the shell prompts after each command, which ends up in front of the next reply
+        l = self.tn.read_until(b"\n", timeout).decode(errors='replace')
+        while l.startswith("> "):
+            l = l[2:]
+        return l
+
+    def close(self):
+        self.tn.write(b"exit\n")
+        self.tn.read_all()
+
+class SerialLink(Link):
+    def __init__(self, port):
+        import serial
+        self.partial = ""
+        self.ser = serial.Serial(port, 115200, timeout=0.1)
+        self.ser.flushInput()
+
+    def write(self, s):
+        self.ser.write(s.encode())
+
+    def read(self, timeout):
+        self.ser.timeout = timeout
+        return self.ser.readline().decode(errors='replace')
+
+    def close(self):
+        self.ser.close()
 
-tn = telnetlib.Telnet(args.ipaddr)
-# read startup prompt
-tn.read_until("> ")
+def is_serial(device):
+    return device.startswith('/') or device.upper().startswith('COM')
 
-okcnt= 0
-linecnt= 0
+def command(link, cmd):
+    """send cmd and return the lines it replies with before its ok"""
+    link.write(cmd + "\n")
+    lines = []
+    while True:
+        l = link.readline(5)
+        if not l:
+            print("No reply to " + cmd)
+            return lines
+        l = l.strip()
+        if l.startswith("ok"):
+            return lines
+        lines.append(l)
+
+serial_link = is_serial(args.device)
+print("Streaming " + args.gcode_file.name + " to " + args.device)
+link = SerialLink(args.device) if serial_link else TelnetLink(args.device)
+
+window = 1
+count_bytes = False
+if not args.simple:
+    # rxspace on replies with the size of the receive space, RX: is bytes and RXL: is lines
+    for l in command(link, "rxspace on"):
+        m = re.search(r'RX:(\d+)', l)
+        if m:
+            window = int(m.group(1))
+            count_bytes = True
+        m = re.search(r'RXL:(\d+)', l)
+        if m and not count_bytes:
+            window = int(m.group(1))
+    if args.window > 0:
+        window = args.window
+    print("Window " + str(window) + (" bytes" if count_bytes else " lines"))
+
+# the counts from before this file are not wanted
+command(link, "M411 R")
+
+# (length, time sent) of each line not yet acked
+outstanding = collections.deque()
+in_flight = 0
+okcnt = 0
+linecnt = 0
+latency_total = 0.0
+latency_max = 0.0
+halted = False
+
+def take_reply(timeout):
+    """read one reply line, true if it acked a line"""
+    global in_flight, okcnt, latency_total, latency_max, halted
+    l = link.readline(timeout)
+    if not l:
+        return False
+    l = l.strip()
+    if l.startswith("!!") or l.startswith("error"):
+        print("Smoothie said: " + l)
+        if l.startswith("!!"):
+            halted = True
+        return False
+    if not l.startswith("ok"):
+        if verbose and l: print("RCV " + l)
+        return False
+    if not outstanding:
+        return False
+    n, t = outstanding.popleft()
+    in_flight -= n if count_bytes else 1
+    okcnt += 1
+    wait = time.time() - t
+    latency_total += wait
+    latency_max = max(latency_max, wait)
+    return True
+
+start = time.time()
 for line in f:
-    tn.write(line)
-    linecnt+=1
-    rep= tn.read_eager()
-    okcnt += rep.count("ok")
+    # comments and spaces are stripped to save link and buffer space
+    line = re.split(r'[;(]', line)[0].strip()
+    if not line:
+        continue
+    line += "\n"
+    n = len(line) if count_bytes else 1
+
+    # wait for room, a line longer than the window goes once everything before it is acked
+    while outstanding and in_flight + n > window and not halted:
+        take_reply(1)
+    if halted:
+        break
+
+    link.write(line)
+    outstanding.append((len(line), time.time()))
+    in_flight += n
+    linecnt += 1
     if verbose: print("SND " + str(linecnt) + ": " + line.strip() + " - " + str(okcnt))
 
+    # collect any oks that have already come in without waiting for them
+    while outstanding and take_reply(0):
+        pass
+
 print("Waiting for complete...")
 
-while okcnt < linecnt:
-    rep= tn.read_some()
-    okcnt += rep.count("ok")
-    if verbose: print(str(linecnt) + " - " + str(okcnt) )
+while okcnt < linecnt and not halted:
+    if not take_reply(10) and okcnt < linecnt and verbose:
+        print(str(linecnt) + " - " + str(okcnt))
 
-tn.write("exit\n")
-tn.read_all()
+elapsed = time.time() - start
 
-print("Done")
+if not halted:
+    for l in command(link, "M411"):
+        print(l)
+    if not args.simple:
+        command(link, "rxspace off")
 
+print("Sent %d lines in %1.2fs, %1.1f lines/sec" % (linecnt, elapsed, linecnt / elapsed if elapsed > 0 else 0))
+if okcnt > 0:
+    print("ok latency average %1.1fms, max %1.1fms" % (latency_total * 1000 / okcnt, latency_max * 1000))
 
+link.close()
 
+print("Done")
@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+"""\
+Fetch the event trace from Smoothie and show it as a timeline
+
+The firmware must be built with EVENT_TRACE=1. The trace command is sent over USB serial, or a dump already
+saved from a terminal is read with -f. The events are printed with the time since the first one and the gap
+since the one before, and -o writes them as a Chrome trace (load it in chrome://tracing or ui.perfetto.dev)
+with the blocks as spans, PendSV, the acceleration ticks and underruns as marks, and the queue depth and the
+planner recalculation length as counters.
+See src/libs/EventTrace.cpp for the format.
+
+Requires pyserial unless -f is used
+"""
+
+from __future__ import print_function
+import sys
+import struct
+import json
+import binascii
+import argparse
+
+EVENTS = ['block begin', 'block end', 'PendSV', 'accel tick', 'queue depth', 'underrun', 'recalculate']
+
+# Define command line argument interface
+parser = argparse.ArgumentParser(description='Fetch and show the Smoothie event trace.')
+parser.add_argument('device', nargs='?',
+        help='Smoothie serial port, eg /dev/ttyACM0')
+parser.add_argument('-f', '--file',
+        help='read a saved trace dump instead of fetching one')
+parser.add_argument('-o', '--output',
+        help='write a Chrome trace JSON file')
+parser.add_argument('-c', '--clear', action='store_true', default=False,
+        help='clear the trace on the board after fetching it')
+parser.add_argument('-q', '--quiet', action='store_true', default=False,
+        help='do not print the events')
+args = parser.parse_args()
+
+def fetch(port):
+    import serial
+    ser = serial.Serial(port, 115200, timeout=5)
+    ser.flushInput()
+    ser.write(b"trace\n")
+    lines = []
+    while True:
+        l = ser.readline().decode(errors='replace')
+        if not l:
+            print("Timed out reading the trace")
+            break
+        l = l.strip()
+        lines.append(l)
+        if l == "trace end" or l.startswith("event tracing") or l.startswith("no memory"):
+            break
+    if args.clear:
+        ser.write(b"trace -c\n")
+    ser.close()
+    return lines
+
+if args.file:
+    with open(args.file) as f:
+        lines = [l.strip() for l in f]
+elif args.device:
+    lines = fetch(args.device)
+else:
+    parser.error('give a serial port or a saved dump with -f')
+
+hz = 0
+records = []
+for l in lines:
+    if l.startswith("trace ") and l != "trace end":
+        hz = int(l.split()[2])
+    elif l.startswith("T "):
+        for h in l.split()[1:]:
+            cycles, info = struct.unpack('<II', binascii.unhexlify(h))
+            records.append((cycles, info & 0xFF, info >> 8))
+    elif l and l != "trace end" and not l.startswith("ok"):
+        print(l)
+
+if hz == 0 or not records:
+    print("No trace")
+    sys.exit(1)
+
+# the cycle counter wraps every few tens of seconds, records from preempted handlers can be a little out of order
+us = []
+t = 0
+last = records[0][0]
+for cycles, e, arg in records:
+    d = (cycles - last) & 0xFFFFFFFF
+    if d > 0x80000000:
+        d -= 0x100000000
+    t += d
+    last = cycles
+    us.append(t * 1e6 / hz)
+
+if not args.quiet:
+    prev = us[0]
+    for (cycles, e, arg), u in zip(records, us):
+        name = EVENTS[e] if e < len(EVENTS) else 'event %d' % e
+        print("%12.1fus %+10.1f  %-12s %d" % (u - us[0], u - prev, name, arg))
+        prev = u
+
+counts = {}
+for cycles, e, arg in records:
+    counts[e] = counts.get(e, 0) + 1
+print("%d events over %1.3fms: " % (len(records), (us[-1] - us[0]) / 1000) +
+      ", ".join("%s %d" % (EVENTS[e] if e < len(EVENTS) else e, n) for e, n in sorted(counts.items())))
+
+if args.output:
+    trace = []
+    for (cycles, e, arg), u in zip(records, us):
+        u -= us[0]
+        if e == 0:
+            trace.append({'name': 'block', 'ph': 'B', 'ts': u, 'pid': 1, 'tid': 1, 'args': {'queued': arg}})
+        elif e == 1:
+            trace.append({'name': 'block', 'ph': 'E', 'ts': u, 'pid': 1, 'tid': 1})
+        elif e == 2:
+            trace.append({'name': 'PendSV', 'ph': 'i', 'ts': u, 'pid': 1, 'tid': 2, 's': 't'})
+        elif e == 3:
+            trace.append({'name': 'accel tick', 'ph': 'i', 'ts': u, 'pid': 1, 'tid': 3, 's': 't'})
+        elif e == 4:
+            trace.append({'name': 'queue depth', 'ph': 'C', 'ts': u, 'pid': 1, 'args': {'blocks': arg}})
+        elif e == 5:
+            trace.append({'name': 'underrun', 'ph': 'i', 'ts': u, 'pid': 1, 'tid': 1, 's': 'p', 'args': {'us': arg}})
+        elif e == 6:
+            trace.append({'name': 'recalculate', 'ph': 'C', 'ts': u, 'pid': 1, 'args': {'blocks': arg}})
+    with open(args.output, 'w') as f:
+        json.dump({'traceEvents': trace, 'displayTimeUnit': 'ms'}, f)
+    print("Wrote " + args.output)
@@ -1,16 +1,31 @@
 #!/usr/bin/env python
 """\
 Upload a file to Smoothie over the network
+
+With --resume a partial file left on the card by an upload that was cut off is appended to rather than
+sent again, as long as the md5 of what is there matches the start of the file. Unless --no-verify is
+given the md5 of the uploaded file is checked against the local one at the end. The md5 comes from the
+md5sum command over telnet.
+
+With --compress the file is compressed in the heatshrink format first and uploaded with .hs on the end of
+its name, which the player decompresses as it plays. It has to match player_heatshrink_window and
+player_heatshrink_lookahead in the config, 11 and 4 unless they are changed. The heatshrink program is used
+to compress it if it is on the PATH, it is much faster on a large file than the encoder here.
 """
 
 from __future__ import print_function
 import sys
+import re
 import argparse
 import socket
+import hashlib
+import telnetlib
 import os
+import io
+import subprocess
 # Define command line argument interface
 parser = argparse.ArgumentParser(description='Upload a file to Smoothie over network.')
-parser.add_argument('file', type=argparse.FileType('r'),
+parser.add_argument('file', type=argparse.FileType('rb'),
         help='filename to be uploaded')
 parser.add_argument('ipaddr',
         help='Smoothie IP address')
@@ -20,6 +35,12 @@ parser.add_argument('-o','--output',
         help='Set output filename')
 parser.add_argument('-q','--quiet',action='store_true',
         help='suppress all output to terminal')
+parser.add_argument('-r','--resume',action='store_true',
+        help='append to a partial upload of the same file')
+parser.add_argument('-n','--no-verify',action='store_true',
+        help='do not check the md5 of the uploaded file')
+parser.add_argument('-z','--compress',action='store_true',
+        help='compress the file for the player to decompress, the name gets .hs on the end')
 
 args = parser.parse_args()
 
@@ -30,71 +51,188 @@ if output == None :
     output= args.file.name
 
 filesize= os.path.getsize(args.file.name)
+chunk= 8192
+
+def find_program(name):
+    """the path of name if it is on the PATH, None if not"""
+    for d in os.environ.get('PATH', '').split(os.pathsep):
+        p= os.path.join(d, name)
+        if os.path.isfile(p) and os.access(p, os.X_OK): return p
+    return None
+
+def heatshrink(data, window=11, lookahead=4):
+    """compress in the format of heatshrink -e -w window -l lookahead, with the reference encoder if it is installed"""
+    program= find_program('heatshrink')
+    if program is not None:
+        p= subprocess.Popen([program, '-e', '-w', str(window), '-l', str(lookahead)], stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+        out= p.communicate(bytes(data))[0]
+        if p.returncode == 0: return out
+
+    out= bytearray()
+    acc= 0
+    bits= 0
+    size= 1 << window
+    longest= 1 << lookahead
+    n= len(data)
+
+    # hash chains of the places each 3 bytes were seen: head is the latest for a hash, prev the one before each
+    # place, kept for a window's worth of places. The longest match from the first few within the window is used
+    hash_bits= 15
+    hash_mask= (1 << hash_bits) - 1
+    head= [-1] * (1 << hash_bits)
+    prev= [-1] * size
+    window_mask= size - 1
+    max_chain= 16
+
+    i= 0
+    while i < n:
+        best, best_offset= 0, 0
+        if i + 2 < n:
+            h= ((data[i] << 10) ^ (data[i + 1] << 5) ^ data[i + 2]) & hash_mask
+            p= head[h]
+            chain= max_chain
+            limit= min(longest, n - i)
+            while p >= 0 and i - p <= size and chain > 0:
+                # only a match that would be longer is looked at in full
+                if data[p + best] == data[i + best]:
+                    l= 0
+                    while l < limit and data[p + l] == data[i + l]: l += 1
+                    if l > best:
+                        best, best_offset= l, i - p
+                        if l == limit: break
+                q= prev[p & window_mask]
+                if q >= p: break # overwritten by a later place, the chain ends here
+                p= q
+                chain -= 1
+
+        if best < 3:
+            best= 1
+            acc= (acc << 9) | 0x100 | data[i]
+            bits += 9
+        else:
+            acc= (((acc << 1) << window | (best_offset - 1)) << lookahead) | (best - 1)
+            bits += 1 + window + lookahead
+        while bits >= 8:
+            bits -= 8
+            out.append((acc >> bits) & 0xFF)
+        acc&= (1 << bits) - 1
+
+        for j in range(i, min(i + best, n - 2)):
+            h= ((data[j] << 10) ^ (data[j + 1] << 5) ^ data[j + 2]) & hash_mask
+            prev[j & window_mask]= head[h]
+            head[h]= j
+        i += best
+    if bits > 0: out.append((acc << (8 - bits)) & 0xFF)
+    return bytes(out)
+
+if args.compress:
+    data= heatshrink(bytearray(f.read()))
+    if not args.quiet : print("Compressed " + str(filesize) + " bytes to " + str(len(data)))
+    f.close()
+    f= io.BytesIO(data)
+    filesize= len(data)
+    output += ".hs"
+
+def local_md5(length):
+    """md5 of the first length bytes of the file"""
+    md5= hashlib.md5()
+    f.seek(0)
+    while length > 0:
+        data= f.read(min(chunk, length))
+        if not data: break
+        md5.update(data)
+        length -= len(data)
+    return md5.hexdigest()
+
+def remote_md5(name):
+    """(md5, size) of the file on the card, None if it is not there"""
+    tn = telnetlib.Telnet(args.ipaddr)
+    # read startup prompt
+    tn.read_until(b"> ")
+    tn.write(("md5sum /sd/" + name + "\n").encode())
+    res= None
+    while True:
+        # a big file takes a while to hash at card speed
+        ln= tn.read_until(b"\n").decode(errors='replace')
+        if verbose: print("RSP: " + ln.strip())
+        m= re.search(r'([0-9a-f]{32}) (\d+) ', ln)
+        if m:
+            res= (m.group(1), int(m.group(2)))
+            break
+        if "not found" in ln or not ln:
+            break
+    tn.write(b"exit\n")
+    tn.close()
+    return res
+
+offset= 0
+if args.resume:
+    r= remote_md5(output)
+    if r != None and r[1] <= filesize and r[0] == local_md5(r[1]):
+        offset= r[1]
+        if not args.quiet : print("Resuming from " + str(offset))
+    elif r != None and not args.quiet :
+        print("Partial file does not match, sending it all")
 
 if not args.quiet : print("Uploading " + args.file.name + " to " + args.ipaddr + " as " + output + " size: " + str(filesize) )
 
-# make connection to sftp server
-s =  socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-s.settimeout(4.0)
-s.connect((args.ipaddr, 115))
-tn= s.makefile()
-
-# read startup prompt
-ln= tn.readline()
-if not ln.startswith("+") :
-    print("Failed to connect with sftp: " + ln)
-    sys.exit();
-
-if verbose: print("RSP: " + ln.strip())
-
-# Issue initial store command
-tn.write("STOR OLD /sd/" + output + "\n")
-tn.flush()
-
-ln= tn.readline()
-if not ln.startswith("+") :
-    print("Failed to create file: " + ln)
-    sys.exit();
-
-if verbose: print("RSP: " + ln.strip())
-
-# send size of file
-tn.write("SIZE " + str(filesize) + "\n")
-tn.flush()
+if offset < filesize:
+    # make connection to sftp server
+    s =  socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    s.settimeout(4.0)
+    s.connect((args.ipaddr, 115))
+    tn= s.makefile('rb')
+
+    def reply(what):
+        ln= tn.readline().decode(errors='replace')
+        if not ln.startswith("+") :
+            print(what + ": " + ln)
+            sys.exit(1)
+        if verbose: print("RSP: " + ln.strip())
+        return ln
+
+    # read startup prompt
+    reply("Failed to connect with sftp")
+
+    # Issue initial store command, appending to what is there when resuming
+    s.sendall((("STOR APP /sd/" if offset > 0 else "STOR OLD /sd/") + output + "\n").encode())
+    reply("Failed to create file")
+
+    # send size of what is left of the file
+    s.sendall(("SIZE " + str(filesize - offset) + "\n").encode())
+    reply("Failed")
+
+    cnt= offset
+    f.seek(offset)
+    # now send file, in big pieces so it goes at the speed of the network
+    while True:
+        data= f.read(chunk)
+        if not data: break
+        s.sendall(data)
+        cnt += len(data)
+        if verbose :
+            print("SND: " + str(len(data)) + " bytes")
+        elif not args.quiet :
+            print(str(cnt) + "/" + str(filesize) + "\r", end='')
+
+    # the card may still be writing the last sectors
+    s.settimeout(30.0)
+    ln= reply("Failed to save file")
+    if not args.quiet : print("\n" + ln.strip())
+
+    # exit
+    s.sendall(b"DONE\n")
+    tn.readline()
+    tn.close()
+    s.close()
+
+if not args.no_verify:
+    r= remote_md5(output)
+    if r == None or r[1] != filesize or r[0] != local_md5(filesize):
+        print("Verify failed, the uploaded file does not match")
+        sys.exit(1)
+    if not args.quiet : print("Verified md5 " + r[0])
 
-ln= tn.readline()
-if not ln.startswith("+") :
-    print("Failed: " + ln)
-    sys.exit();
-
-if verbose: print("RSP: " + ln.strip())
-
-cnt= 0
-# now send file
-for line in f:
-    tn.write(line)
-    if verbose :
-        print("SND: " + line.strip())
-    elif not args.quiet :
-        cnt += len(line)
-        print(str(cnt) + "/" + str(filesize) + "\r", end='')
-
-
-tn.flush()
-
-ln= tn.readline()
-if not ln.startswith("+") :
-    print("Failed to save file: " + ln)
-    sys.exit();
-
-if verbose: print("RSP: " + ln.strip())
-
-# exit
-tn.write("DONE\n")
-tn.flush()
-ln= tn.readline()
-tn.close()
 f.close()
 
 if not args.quiet : print("Upload complete")
-
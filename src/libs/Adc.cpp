@@ -18,21 +18,67 @@ using namespace std;
 // This is an interface to the mbed.org ADC library you can find in libs/ADC/adc.h
 // TODO : Having the same name is confusing, should change that
 
+// The ADC runs in burst mode, converting every enabled channel in turn without being asked.
+// Only the last channel of a scan interrupts, the handler then stores the whole scan in the per channel rings,
+// so there is one interrupt per scan however many channels are in use, and read() never waits for a conversion.
+
+static const PinName channel_pins[ADC_CHANNELS]= {p15, p16, p17, p18, p19, p20};
+
+Adc* Adc::instance;
+
 Adc::Adc(){
-    this->adc = new ADC(1000, 1);
+    // PCLK at CCLK/8 gives about 1000 conversions a second in total, at CCLK/1 the clock divider maxes out at ~6000
+    this->adc = new ADC(1000, 8);
+    this->enabled_channels = 0;
+    this->last_channel = -1;
+    instance = this;
+    this->adc->append(sample_isr);
 }
 
 // Enables ADC on a given pin
 void Adc::enable_pin(Pin* pin){
     PinName pin_name = this->_pin_to_pinname(pin);
+    int chan = this->_pin_to_channel(pin);
+    if( chan < 0 ) return;
+
     this->adc->burst(1);
     this->adc->setup(pin_name,1);
-    this->adc->interrupt_state(pin_name,1);
+    this->enabled_channels |= 1 << chan;
+
+    // channels are converted from lowest to highest, so the highest one ends the scan and gets the interrupt
+    if( chan > this->last_channel ){
+        if( this->last_channel >= 0 ) this->adc->interrupt_state(channel_pins[this->last_channel], 0);
+        this->last_channel = chan;
+        this->adc->interrupt_state(pin_name,1);
+    }
 }
 
-// Read the last value ( burst mode ) on a given pin
+// Read the filtered value ( burst mode ) on a given pin,
+// the mean of the last ADC_SAMPLES conversions without the highest and lowest, which drops single spikes
 unsigned int Adc::read(Pin* pin){
-    return this->adc->read(this->_pin_to_pinname(pin));
+    int chan = this->_pin_to_channel(pin);
+    if( chan < 0 ) return 0;
+    return this->samples[chan].trimmed_mean();
+}
+
+// Called from the ADC interrupt when the last channel of a scan is done
+void Adc::sample_isr(int chan, uint32_t value){
+    instance->new_samples();
+}
+
+void Adc::new_samples(){
+    for( int c = 0; c < ADC_CHANNELS; c++ ){
+        if( (this->enabled_channels & (1 << c)) == 0 ) continue;
+        this->samples[c].push(this->adc->read(channel_pins[c]));
+    }
+}
+
+int Adc::_pin_to_channel(Pin* pin){
+    PinName pin_name = this->_pin_to_pinname(pin);
+    for( int c = 0; c < ADC_CHANNELS; c++ ){
+        if( channel_pins[c] == pin_name ) return c;
+    }
+    return -1;
 }
 
 // Convert a smoothie Pin into a mBed Pin
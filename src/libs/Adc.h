@@ -14,8 +14,15 @@
 #include "PinNames.h" // mbed.h lib
 #include "libs/ADC/adc.h"
 
+#include <stdint.h>
+#include "SampleRing.h"
+
 class Pin;
 
+// every conversion of a channel is kept here, so read() can filter them
+#define ADC_CHANNELS 6
+#define ADC_SAMPLES  8
+
 class Adc : public Module{
     public:
         Adc();
@@ -24,6 +31,16 @@ class Adc : public Module{
         PinName _pin_to_pinname(Pin* pin);
 
         ADC* adc;
+
+    private:
+        int _pin_to_channel(Pin* pin);
+        static void sample_isr(int chan, uint32_t value);
+        void new_samples();
+        static Adc* instance;
+
+        SampleRing<uint16_t, ADC_SAMPLES, uint32_t> samples[ADC_CHANNELS];
+        uint8_t enabled_channels;
+        int last_channel;
 };
 
 
@@ -1,12 +1,121 @@
 #include "AppendFileStream.h"
-#include "stdio.h"
+#include "platform_memory.h"
+#include "us_ticker_api.h"
+#include "LPC17xx.h"
+
+AppendFileStream *AppendFileStream::buffered_streams= nullptr;
+
+// two sectors, so one can fill while the other waits for the main loop
+AppendFileStream::AppendFileStream(const char *filename, bool buffered, uint32_t max_age_ms)
+{
+    fn= strdup(filename);
+    fd= NULL;
+    used= 0;
+    first_us= 0;
+    max_age_us= max_age_ms * 1000;
+    dropped= 0;
+    buffer= buffered ? placed_alloc<char>(sector * 2, PLACE_AHB) : NULL;
+    this->buffered= (buffer != NULL);
+    next= nullptr;
+    if(this->buffered) {
+        next= buffered_streams;
+        buffered_streams= this;
+    }
+}
+
+AppendFileStream::~AppendFileStream()
+{
+    if(buffered) {
+        flush();
+        for (AppendFileStream **p= &buffered_streams; *p != nullptr; p= &(*p)->next) {
+            if(*p == this) {
+                *p= next;
+                break;
+            }
+        }
+        placed_free(buffer);
+    }
+    free(fn);
+}
 
 int AppendFileStream::puts(const char *str)
 {
-    FILE *fd= fopen(this->fn, "a");
-    if(fd == NULL) return 0;
+    size_t n= strlen(str);
+
+    if(!buffered) {
+        FILE *fd= fopen(this->fn, "a");
+        if(fd == NULL) return 0;
+
+        n= fwrite(str, 1, n, fd);
+        fclose(fd);
+        return n;
+    }
 
-    int n= fwrite(str, 1, strlen(str), fd);
-    fclose(fd);
+    // an interrupt can add to the buffer too, so the main loop changes it with them off
+    bool in_isr= (SCB->ICSR & 0x1FF) != 0;
+    size_t done= 0;
+    while(done < n) {
+        if(!in_isr) __disable_irq();
+        if(used == 0) first_us= us_ticker_read();
+        size_t k= sector * 2 - used;
+        if(k > n - done) k= n - done;
+        memcpy(&buffer[used], &str[done], k);
+        used += k;
+        done += k;
+        if(!in_isr) __enable_irq();
+        if(used < sector * 2) break;
+        // full, the oldest sector goes to the card now unless this is an interrupt
+        if(in_isr || !write_sectors(false)) {
+            dropped += n - done;
+            break;
+        }
+    }
+
+    if(!in_isr && used >= sector) write_sectors(false);
     return n;
 }
+
+// writes the whole sectors in the buffer, or everything if all is set, the rest moves down to the start
+bool AppendFileStream::write_sectors(bool all)
+{
+    size_t n= all ? used : used - used % sector;
+    if(n == 0) return true;
+
+    if(fd == NULL) {
+        fd= fopen(fn, "a");
+        if(fd == NULL) {
+            dropped += used;
+            used= 0;
+            return false;
+        }
+        setvbuf(fd, NULL, _IONBF, 0);
+    }
+
+    // anything added meanwhile goes after n, so only the move down has to keep interrupts out
+    bool ok= fwrite(buffer, 1, n, fd) == n;
+    __disable_irq();
+    if(!ok) dropped += n;
+    used -= n;
+    if(used > 0) memmove(buffer, &buffer[n], used);
+    __enable_irq();
+    return ok;
+}
+
+bool AppendFileStream::flush()
+{
+    if(!buffered) return true;
+    bool ok= write_sectors(true);
+    if(fd != NULL) {
+        if(fclose(fd) != 0) ok= false;
+        fd= NULL;
+    }
+    return ok;
+}
+
+void AppendFileStream::flush_stale()
+{
+    uint32_t now= us_ticker_read();
+    for (AppendFileStream *s= buffered_streams; s != nullptr; s= s->next) {
+        if(s->used > 0 && now - s->first_us >= s->max_age_us) s->flush();
+    }
+}
@@ -4,15 +4,43 @@
 #include "StreamOutput.h"
 #include "string.h"
 #include "stdlib.h"
+#include "stdio.h"
+#include "stdint.h"
 
+// Appends what is written to a file.
+// Unbuffered, each puts opens, appends and closes the file. Buffered keeps the file open and writes it a sector at a
+// time, what is left over goes out from the main loop once it is max_age_ms old, and the file is closed then so it is
+// all on the card. Buffered writes in an interrupt only go to the buffer, they are never written to the card from there.
 class AppendFileStream : public StreamOutput {
     public:
-        AppendFileStream(const char *filename) { fn= strdup(filename); }
-        virtual ~AppendFileStream(){ free(fn); }
+        AppendFileStream(const char *filename, bool buffered= false, uint32_t max_age_ms= 2000);
+        virtual ~AppendFileStream();
         int puts(const char*);
 
+        // writes everything waiting and closes the file
+        bool flush();
+        // what was thrown away because the buffer filled up in an interrupt, or the file could not be written
+        uint32_t get_dropped() const { return dropped; }
+        const char *get_filename() const { return fn; }
+
+        // flushes the buffered streams that have had something waiting too long, call it from the main loop
+        static void flush_stale();
+
     private:
+        static const size_t sector= 512;
+        bool write_sectors(bool all);
+
         char *fn;
+        FILE *fd;
+        char *buffer;
+        size_t used;
+        uint32_t first_us;
+        uint32_t max_age_us;
+        uint32_t dropped;
+        bool buffered;
+
+        AppendFileStream *next;
+        static AppendFileStream *buffered_streams;
 };
 
 #endif
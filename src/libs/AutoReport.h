@@ -0,0 +1,74 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AUTOREPORT_H
+#define AUTOREPORT_H
+
+#include "libs/Kernel.h"
+#include "libs/StreamOutputPool.h"
+
+#include <vector>
+#include <stdint.h>
+
+// The streams that asked for a report to be pushed to them every so many seconds, so hosts don't have to poll for it.
+// Only streams in THEKERNEL->streams can subscribe, as those are the ones that say when they go away,
+// a subscriber is dropped on the next second tick once its stream has been removed.
+class AutoReport
+{
+    public:
+        // 0 seconds stops the reports, false if the stream can't be reported to
+        bool set_interval(StreamOutput *stream, uint16_t seconds)
+        {
+            for (auto i = subscribers.begin(); i != subscribers.end(); ++i) {
+                if (i->stream == stream) {
+                    subscribers.erase(i);
+                    break;
+                }
+            }
+            if (seconds == 0) return true;
+            if (!THEKERNEL->streams->has_stream(stream)) return false;
+            subscribers.push_back({stream, seconds, seconds});
+            return true;
+        }
+
+        bool empty() const { return subscribers.empty(); }
+
+        // call from on_second_tick, true if at least one subscriber is due, call send() for each of those next
+        bool due()
+        {
+            bool any = false;
+            for (auto i = subscribers.begin(); i != subscribers.end(); ) {
+                if (!THEKERNEL->streams->has_stream(i->stream)) {
+                    i = subscribers.erase(i);
+                    continue;
+                }
+                if (--i->countdown == 0) any = true;
+                ++i;
+            }
+            return any;
+        }
+
+        // send the report to the subscribers that are due, formatted once for all of them
+        void send(const char *line)
+        {
+            for (auto& s : subscribers) {
+                if (s.countdown != 0) continue;
+                s.stream->puts(line);
+                s.countdown = s.interval;
+            }
+        }
+
+    private:
+        struct Subscriber {
+            StreamOutput *stream;
+            uint16_t interval;
+            uint16_t countdown;
+        };
+        std::vector<Subscriber> subscribers;
+};
+
+#endif
@@ -0,0 +1,291 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchmark.h"
+
+// before anything that brings in sLPC17xx.h, which has a cut down core_cm3 without the debug registers
+#include <stdint.h>
+#include "system_LPC17xx.h" // for SystemCoreClock
+#include "LPC17xx.h"
+#include "libs/Kernel.h"
+#include "libs/StreamOutput.h"
+#include "libs/utils.h"
+#include "libs/Median.h"
+#include "libs/RingBuffer.h"
+#include "libs/SpscRing.h"
+#include "libs/MemoryPool.h"
+#include "libs/ConfigCache.h"
+#include "libs/ConfigValue.h"
+#include "Gcode.h"
+#include "Robot.h"
+#include "Planner.h"
+#include "Conveyor.h"
+#include "arm_solutions/BaseSolution.h"
+#include "us_ticker_api.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <math.h>
+
+// the DWT is not in the CMSIS header we use
+#define DWT_CTRL            (*(volatile uint32_t *)0xE0001000)
+#define DWT_CTRL_CYCCNTENA  (1UL << 0)
+#define DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004)
+
+extern unsigned int g_maximumHeapAddress;
+extern "C" uint32_t  _sbrk(int size);
+
+// what the results are folded into so the compiler can't drop the work
+static volatile uint32_t sink;
+
+// used when the corpus can't be read, a few lines of the usual kinds
+static const char *const sample_gcode[] = {
+    "G1 X102.345 Y87.21 E1.02345 F1800", "G1 X103.1 Y88.004 E1.0412", "G0 X10 Y20 Z0.3 F9000",
+    "G1 Z0.5 F300", "M104 S210", "G1 X50.5 Y50.5 E0.5 ; infill", "G92 E0", "G1 F2400 E-1.5",
+};
+
+// the cycles one op took in the quickest of a few rounds of ops of them, so an interrupt landing in one doesn't count
+template<typename F> static uint32_t time_ops(uint32_t ops, F f)
+{
+    uint32_t best = 0xFFFFFFFF;
+    for (int round = 0; round < 5; round++) {
+        uint32_t start = DWT_CYCCNT;
+        f();
+        uint32_t t = DWT_CYCCNT - start;
+        if(t < best) best = t;
+    }
+    return ops == 0 ? 0 : best / ops;
+}
+
+static void report(StreamOutput *stream, const char *name, uint32_t cycles)
+{
+    stream->printf("%-28s %7lu cycles %8lu ns\r\n", name, cycles, (uint32_t)((uint64_t)cycles * 1000000000ULL / SystemCoreClock));
+}
+
+static std::vector<std::string> read_lines(const char *fn, size_t max_lines)
+{
+    std::vector<std::string> lines;
+    FILE *fd = fn == nullptr ? nullptr : fopen(fn, "r");
+    if(fd == nullptr) return lines;
+    char buf[132];
+    while(lines.size() < max_lines && fgets(buf, sizeof(buf), fd) != nullptr) {
+        size_t n = strcspn(buf, "\r\n");
+        if(n > 0) lines.emplace_back(buf, n);
+    }
+    fclose(fd);
+    return lines;
+}
+
+void Benchmark::run(const char *gcode_file, const char *config_file, StreamOutput *stream)
+{
+    // harmless if the profiler or the debug monitor has already done it
+    CoreDebug->DEMCR |= (1UL << CoreDebug_DEMCR_TRCENA_Pos);
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+
+    stream->printf("per op, best of 5 rounds at %lu MHz\r\n", SystemCoreClock / 1000000);
+
+    // parsing, what every line played or streamed goes through
+    std::vector<std::string> gcode = read_lines(gcode_file, 200);
+    if(gcode.empty()) {
+        if(gcode_file != nullptr) stream->printf("Could not read %s, using sample lines\r\n", gcode_file);
+        for (const char *l : sample_gcode) gcode.emplace_back(l);
+    }
+    report(stream, "Gcode parse", time_ops(gcode.size(), [&]() {
+        for (const std::string& l : gcode) {
+            Gcode g(l, &(StreamOutput::NullStream));
+            sink += g.g + g.has_letter('X');
+        }
+    }));
+    report(stream, "Gcode get_value", time_ops(gcode.size() * 4, [&]() {
+        Gcode g(gcode[0], &(StreamOutput::NullStream));
+        for (size_t i = 0; i < gcode.size(); i++) {
+            sink += g.get_value('X') + g.get_value('Y') + g.get_value('E') + g.get_value('F');
+        }
+    }));
+
+    // the config, looked up key by key as the modules load
+    std::vector<std::string> config = read_lines(config_file, 400);
+    ConfigCache cache;
+    std::vector<uint16_t> keys;
+    for (const std::string& l : config) {
+        size_t b = l.find_first_not_of(" \t");
+        if(b == std::string::npos || l[b] == '#') continue;
+        size_t e = l.find_first_of(" \t", b);
+        if(e == std::string::npos) continue;
+        size_t v = l.find_first_not_of(" \t", e);
+        if(v == std::string::npos) continue;
+        size_t ve = l.find_first_of(" \t#", v);
+        uint16_t cs[3];
+        get_checksums(cs, l.substr(b, e - b));
+        cache.replace_or_push_back(cs, l.data() + v, (ve == std::string::npos ? l.size() : ve) - v);
+        keys.insert(keys.end(), cs, cs + 3);
+    }
+    if(keys.empty()) {
+        stream->printf("Could not read %s, skipping the config lookups\r\n", config_file);
+    } else {
+        ConfigValue value;
+        report(stream, "ConfigCache lookup", time_ops(keys.size() / 3, [&]() {
+            for (size_t i = 0; i < keys.size(); i += 3) sink += cache.lookup(&keys[i], &value);
+        }));
+    }
+
+    // the small object pools
+    static uint8_t pool_memory[2048];
+    MemoryPool pool(pool_memory, sizeof(pool_memory));
+    report(stream, "MemoryPool alloc+dealloc", time_ops(64, [&]() {
+        void *p[8];
+        for (int j = 0; j < 8; j++) {
+            for (int i = 0; i < 8; i++) p[i] = pool.alloc(16 + (i & 3) * 24);
+            for (int i = 0; i < 8; i++) pool.dealloc(p[(i * 3) & 7]);
+        }
+    }));
+
+    // the queues between the main loop and the interrupts
+    static RingBuffer<uint32_t, 32> ring;
+    report(stream, "RingBuffer push+pop", time_ops(256, [&]() {
+        uint32_t v;
+        for (int i = 0; i < 256; i++) {
+            ring.push_back(i);
+            ring.pop_front(v);
+            sink += v;
+        }
+    }));
+    SpscRing<uint32_t> spsc;
+    if(spsc.resize(32)) {
+        report(stream, "SpscRing produce+consume", time_ops(256, [&]() {
+            for (int i = 0; i < 256; i++) {
+                *spsc.head_ref() = i;
+                spsc.produce_head();
+                sink += *spsc.isr_tail_ref();
+                spsc.isr_consume_tail();
+                spsc.consume_tail();
+            }
+        }));
+    }
+
+    // the thermistor readings are filtered with it
+    uint16_t samples[32], data[32];
+    for (int i = 0; i < 32; i++) samples[i] = (i * 2654435761U) >> 20;
+    report(stream, "quick_median 8", time_ops(32, [&]() {
+        for (int i = 0; i < 32; i++) {
+            memcpy(data, samples + (i & 15), 8 * sizeof(uint16_t));
+            sink += quick_median(data, 8);
+        }
+    }));
+    report(stream, "quick_median 32", time_ops(8, [&]() {
+        for (int i = 0; i < 8; i++) {
+            memcpy(data, samples, sizeof(data));
+            sink += quick_median(data, 32);
+        }
+    }));
+
+    // the configured arm solution, every segment of every move goes through it
+    BaseSolution *arm = THEKERNEL->robot->arm_solution;
+    if(arm != nullptr) {
+        report(stream, "cartesian_to_actuator", time_ops(64, [&]() {
+            float c[3], a[3];
+            for (int i = 0; i < 64; i++) {
+                c[0] = 10.0F + i * 0.37F;
+                c[1] = 20.0F - i * 0.21F;
+                c[2] = 5.0F + i * 0.05F;
+                arm->cartesian_to_actuator(c, a);
+                sink += a[0];
+            }
+        }));
+        float c[8][3], a[8][3];
+        for (int i = 0; i < 8; i++) {
+            c[i][0] = 10.0F + i;
+            c[i][1] = 20.0F - i;
+            c[i][2] = 5.0F;
+        }
+        report(stream, "cartesian_to_actuator_batch", time_ops(64, [&]() {
+            for (int i = 0; i < 8; i++) {
+                arm->cartesian_to_actuator_batch(&c[0][0], &a[0][0], 8);
+                sink += a[7][0];
+            }
+        }));
+    }
+}
+
+#ifdef BENCHMARK
+// the planner and conveyor only keep the counts and the dry run in a benchmark build
+
+// a line of one of the move sets, move i of it starting from p
+static void planner_move(int set, unsigned int i, const float p[3], char *buf, size_t size)
+{
+    switch(set) {
+        case 0: // zig-zags, short lines turning back on themselves as infill does
+            snprintf(buf, size, "G1 X%1.3f Y%1.3f F6000", p[0] + ((i & 1) ? 2.0F : 0.0F), p[1] + (i % 100) * 0.05F);
+            break;
+        case 1: // circles in two halves, which the robot cuts into segments
+            snprintf(buf, size, "G2 X%1.3f Y%1.3f I%d J0 F6000", p[0] + ((i & 1) ? 0.0F : 4.0F), p[1], (i & 1) ? -2 : 2);
+            break;
+        default: { // the short segments a delta gets long lines cut into, going round with z moving too
+            float a = i * (0.25F / 3.0F);
+            snprintf(buf, size, "G1 X%1.3f Y%1.3f Z%1.3f F6000", p[0] + 3.0F * cosf(a) - 3.0F, p[1] + 3.0F * sinf(a),
+                     p[2] - 0.5F * (1.0F - cosf(a / 8.0F)));
+            break;
+        }
+    }
+}
+
+static void send_gcode(const char *line)
+{
+    Gcode gcode(line, &(StreamOutput::NullStream));
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode);
+}
+
+void Benchmark::planner(unsigned int moves, StreamOutput *stream)
+{
+    static const char *const set_names[] = {"zig-zag", "arcs", "segments"};
+    Robot *robot = THEKERNEL->robot;
+    Conveyor *conveyor = THEKERNEL->conveyor;
+
+    CoreDebug->DEMCR |= (1UL << CoreDebug_DEMCR_TRCENA_Pos);
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+
+    // the moves are made in mm and absolute around where the machine is, which is put back after
+    float p[3];
+    robot->get_axis_position(p);
+    robot->begin_dry_run();
+    robot->inch_mode = false;
+    robot->absolute_mode = true;
+    uint32_t heap_start = (uint32_t)_sbrk(0);
+
+    stream->printf("planner, %u moves a set, %u block queue, %lu MHz\r\n", moves, conveyor->get_queue_size(), SystemCoreClock / 1000000);
+    conveyor->set_dry_run(true);
+    char buf[80];
+    for (int set = 0; set < 3 && !conveyor->is_halted(); set++) {
+        snprintf(buf, sizeof(buf), "G1 X%1.3f Y%1.3f Z%1.3f F6000", p[0], p[1], p[2]);
+        send_gcode(buf);
+        conveyor->wait_for_empty_queue();
+
+        THEKERNEL->planner->reset_plan_cycles();
+        uint32_t start = us_ticker_read();
+        for (unsigned int i = 0; i < moves && !conveyor->is_halted(); i++) {
+            planner_move(set, i, p, buf, sizeof(buf));
+            send_gcode(buf);
+        }
+        conveyor->wait_for_empty_queue();
+        uint32_t us = us_ticker_read() - start;
+
+        const Planner::PlanCycles &c = THEKERNEL->planner->get_plan_cycles();
+        uint32_t avg = c.blocks > 0 ? c.total / c.blocks : 0;
+        uint32_t recalculate_avg = c.blocks > 0 ? c.recalculate_total / c.blocks : 0;
+        stream->printf("%-9s %5u blocks %7.0f blocks/s, plan avg %6lu max %6lu cycles, recalculate avg %6lu max %6lu cycles\r\n",
+                       set_names[set], c.blocks, us > 0 ? c.blocks * 1e6F / us : 0.0F, avg, c.max, recalculate_avg, c.recalculate_max);
+    }
+    conveyor->set_dry_run(false);
+    robot->end_dry_run();
+
+    // the heap only grows, so how far its top moved is the most the run needed at once
+    uint32_t heap_end = (uint32_t)_sbrk(0);
+    stream->printf("heap top grew %lu bytes, %lu left below the stack\r\n", heap_end - heap_start, (uint32_t)g_maximumHeapAddress - heap_end);
+}
+#endif
@@ -0,0 +1,24 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+class StreamOutput;
+
+// Times the library code the motion and command paths lean on, in DWT cycles and ns per operation, so a change can
+// be compared before and after on the board itself. The gcode and config ones run over a corpus from the SD card.
+// planner() sends sets of synthetic moves through the robot, planner and queue with the blocks dropped instead of
+// stepped, and reports how fast they were planned, for the arm solution and queue size configured.
+// Only compiled in when BENCHMARK is defined in src/makefile, the bench command runs it and M415 runs planner()
+class Benchmark {
+    public:
+        static void run(const char *gcode_file, const char *config_file, StreamOutput *stream);
+        static void planner(unsigned int moves, StreamOutput *stream);
+};
+
+#endif
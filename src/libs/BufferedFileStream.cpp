@@ -0,0 +1,81 @@
+#include "BufferedFileStream.h"
+#include "string.h"
+#include "stdlib.h"
+#include "stdio.h"
+
+BufferedFileStream::BufferedFileStream(const char *filename)
+{
+    fn= strdup(filename);
+    fd= NULL;
+    buffer= NULL;
+    used= 0;
+    size= 0;
+    failed= false;
+}
+
+BufferedFileStream::~BufferedFileStream()
+{
+    close();
+    free(fn);
+}
+
+int BufferedFileStream::puts(const char *str)
+{
+    size_t n= strlen(str);
+
+    if(fd == NULL && !failed && used + n > size) {
+        // grows a sector at a time, M500 is rarely more than a few
+        size_t want= (used + n + sector - 1) / sector * sector;
+        char *p= (char *)realloc(buffer, want);
+        if(p != NULL) {
+            buffer= p;
+            size= want;
+        } else if(!open()) {
+            return 0;
+        }
+    }
+
+    if(fd != NULL) {
+        if(fwrite(str, 1, n, fd) != n) failed= true;
+        return n;
+    }
+    if(failed) return 0;
+
+    memcpy(&buffer[used], str, n);
+    used += n;
+    return n;
+}
+
+// opens and truncates the file and writes what has been buffered, from then on puts writes straight to the file
+bool BufferedFileStream::open()
+{
+    fd= fopen(fn, "w");
+    if(fd == NULL) {
+        failed= true;
+        return false;
+    }
+    // bigger than the stdio buffer, so the card gets it in whole sectors straight from the buffer
+    if(used > 0 && fwrite(buffer, 1, used, fd) != used) failed= true;
+    free(buffer);
+    buffer= NULL;
+    used= size= 0;
+    return !failed;
+}
+
+bool BufferedFileStream::close()
+{
+    if(fd == NULL && !failed && fn != NULL) open();
+    if(fd != NULL) {
+        if(fclose(fd) != 0) failed= true;
+        fd= NULL;
+    }
+    free(buffer);
+    buffer= NULL;
+    used= size= 0;
+    // only written once
+    if(fn != NULL) {
+        free(fn);
+        fn= NULL;
+    }
+    return !failed;
+}
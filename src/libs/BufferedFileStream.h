@@ -0,0 +1,33 @@
+#ifndef _BUFFEREDFILESTREAM_H_
+#define _BUFFEREDFILESTREAM_H_
+
+#include "StreamOutput.h"
+#include "stddef.h"
+
+// Collects what is written in RAM and replaces the file with it in one pass when closed, for things like M500
+// that print a few lines from each of many modules. The buffer starts on a sector boundary at the start of the
+// file so all but the last sector go straight to the card, and the file is only open for that one write.
+// If the buffer cannot grow it writes out what it has and carries on a line at a time, so nothing is lost.
+// Only for the main loop.
+class BufferedFileStream : public StreamOutput {
+    public:
+        BufferedFileStream(const char *filename);
+        virtual ~BufferedFileStream();
+        int puts(const char*);
+
+        // writes the file, false if any of it could not be written
+        bool close();
+
+    private:
+        static const size_t sector= 512;
+        bool open();
+
+        char *fn;
+        FILE *fd;
+        char *buffer;
+        size_t used;
+        size_t size;
+        bool failed;
+};
+
+#endif
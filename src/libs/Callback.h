@@ -0,0 +1,37 @@
+#ifndef CALLBACK_H
+#define CALLBACK_H
+
+// A call to a member function of an object, made through a static function generated for that member at compile time.
+// It is two words, can be copied and stored in a table or a struct without any allocation, and calling it is one
+// indirect call with no virtual dispatch or member pointer to resolve, so it is cheap enough for the interrupt handlers.
+//   Callback<uint32_t(uint32_t)> cb= Callback<uint32_t(uint32_t)>::bind<Panel, &Panel::button_tick>(panel);
+//   cb(0);
+template<typename Signature> class Callback;
+
+template<typename R, typename... Args> class Callback<R(Args...)> {
+    public:
+        Callback() : fn(nullptr), obj(nullptr) {}
+
+        template<class T, R (T::*method)(Args...)> static Callback bind(T *optr)
+        {
+            Callback c;
+            c.fn= &call_member<T, method>;
+            c.obj= optr;
+            return c;
+        }
+
+        // not checked, test it first if it may not have been bound
+        R operator()(Args... args) const { return fn(obj, args...); }
+        explicit operator bool() const { return fn != nullptr; }
+
+    private:
+        template<class T, R (T::*method)(Args...)> static R call_member(void *optr, Args... args)
+        {
+            return (static_cast<T*>(optr)->*method)(args...);
+        }
+
+        R (*fn)(void *, Args...);
+        void *obj;
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include "ff.h"
 #include "FATFileSystem.h"
+#include "platform_memory.h"
 
 namespace mbed {
 
@@ -37,6 +38,7 @@ FATFileHandle::FATFileHandle(FIL_t fh) {
 int FATFileHandle::close() {
     FFSDEBUG("close\n");
     int retval = f_close(&_fh);
+    if(_fh.cltbl != NULL) placed_free(_fh.cltbl);
     delete this;
     return retval;
 }
@@ -99,4 +101,26 @@ off_t FATFileHandle::flen() {
     return _fh.fsize;
 }
 
+bool FATFileHandle::link_clusters(UINT max_items) {
+    // a table too small to hold anything still gets the size needed put in its first item
+    DWORD probe[2] = { 2, 0 };
+    _fh.cltbl = probe;
+    f_lseek(&_fh, CREATE_LINKMAP);
+    _fh.cltbl = NULL;
+    UINT items = probe[0];
+    if(items <= 2 || items > max_items) return false;
+
+    DWORD *tbl = placed_alloc<DWORD>(items, PLACE_AHB);
+    if(tbl == NULL) return false;
+    tbl[0] = items;
+    _fh.cltbl = tbl;
+    if(f_lseek(&_fh, CREATE_LINKMAP) != FR_OK) {
+        _fh.cltbl = NULL;
+        placed_free(tbl);
+        return false;
+    }
+    FFSDEBUG("link map of %u items\n", items);
+    return true;
+}
+
 } // namespace mbed
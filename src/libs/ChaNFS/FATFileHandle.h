@@ -21,6 +21,9 @@ public:
     virtual off_t lseek(off_t position, int whence);
     virtual int fsync();
     virtual off_t flen();
+
+    // build a cluster link map of at most max_items, so seeks don't follow the FAT chain, false if it doesn't fit
+    bool link_clusters(UINT max_items);
 
 protected:
 
@@ -20,6 +20,9 @@ DWORD get_fattime (void) {
 
 namespace mbed {
 
+DWORD FATFileSystem::fast_seek_size = 0;
+UINT FATFileSystem::fast_seek_items = 0;
+
 #if FFSDEBUG_ENABLED
 static const char *FR_ERRORS[] = {
     "FR_OK = 0",
@@ -68,6 +71,7 @@ FileHandle *FATFileSystem::open(const char* name, int flags) {
     FFSDEBUG("open(%s) on filesystem [%s], drv [%d]\n", name, _name, _fsid);
     char n[64];
     sprintf(n, "%d:/%s", _fsid, name);
+    disk_check();
 
     /* POSIX flags -> FatFS open mode */
     BYTE openmode;
@@ -95,10 +99,15 @@ FileHandle *FATFileSystem::open(const char* name, int flags) {
     if(flags & O_APPEND) {
         f_lseek(&fh, fh.fsize);
     }
-    return new FATFileHandle(fh);
+    FATFileHandle *h = new FATFileHandle(fh);
+    if(openmode == FA_READ && fast_seek_size > 0 && fh.fsize >= fast_seek_size) {
+        h->link_clusters(fast_seek_items);
+    }
+    return h;
 }
 
 int FATFileSystem::remove(const char *filename) {
+    disk_check();
     FRESULT res = f_unlink(filename);
     if(res) {
         FFSDEBUG("f_unlink() failed (%d, %s)\n", res, FR_ERRORS[res]);
@@ -108,6 +117,7 @@ int FATFileSystem::remove(const char *filename) {
 }
 
 int FATFileSystem::rename(const char *filename1, const char *filename2) {
+    disk_check();
     FRESULT res = f_rename(filename1, filename2);
     if(res) {
         FFSDEBUG("f_rename() failed (%d, %s)\n", res, FR_ERRORS[res]);
@@ -130,6 +140,7 @@ DirHandle *FATFileSystem::opendir(const char *name) {
     char n[64];
     sprintf(n, "%d:/%s", _fsid, name);
     DIR_t dir;
+    disk_check();
     FRESULT res = f_opendir(&dir, n);
     if(res != 0) {
         return NULL;
@@ -137,7 +148,26 @@ DirHandle *FATFileSystem::opendir(const char *name) {
     return new FATDirHandle(dir);
 }
 
+int FATFileSystem::stat(const char *name, uint32_t *size, uint32_t *mtime) {
+    char n[64];
+    sprintf(n, "%d:/%s", _fsid, name);
+    FILINFO fno;
+#if _USE_LFN
+    fno.lfname = NULL;
+    fno.lfsize = 0;
+#endif
+    disk_check();
+    FRESULT res = f_stat(n, &fno);
+    if(res != 0) {
+        return -1;
+    }
+    *size = fno.fsize;
+    *mtime = ((uint32_t)fno.fdate << 16) | fno.ftime;
+    return 0;
+}
+
 int FATFileSystem::mkdir(const char *name, mode_t mode) {
+    disk_check();
     FRESULT res = f_mkdir(name);
     return res == 0 ? 0 : -1;
 }
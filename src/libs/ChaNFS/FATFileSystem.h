@@ -43,18 +43,44 @@ public:
     virtual int format();
     virtual DirHandle *opendir(const char *name);
     virtual int mkdir(const char *name, mode_t mode);
+    // the size and the FAT date and time (date << 16 | time) the file was last written, -1 if there is no such file
+    int stat(const char *name, uint32_t *size, uint32_t *mtime);
+
+    // files opened read only that are at least size bytes get a cluster link map of up to max_items, 0 turns it off
+    static void set_fast_seek(DWORD size, UINT max_items) { fast_seek_size = size; fast_seek_items = max_items; }
 
     FATFS _fs;                                // Work area (file system object) for logical drive
     static FATFileSystem *_ffs[_DRIVES];    // FATFileSystem objects, as parallel to FatFs drives array
     int _fsid;
 
+    // called before each open, opendir, stat and change to the directories, so a disk that others can write can
+    // forget what may have been changed under it
+    virtual void disk_check() {}
+
     virtual int disk_initialize() { return 0; }
     virtual int disk_status() { return 0; }
     virtual int disk_read(char *buffer, int sector) = 0;
+    virtual int disk_read_blocks(char *buffer, int sector, int count) {
+        for(int i = 0; i < count; i++) {
+            int res = disk_read(buffer + i * 512, sector + i);
+            if(res) return res;
+        }
+        return 0;
+    }
     virtual int disk_write(const char *buffer, int sector) = 0;
+    virtual int disk_write_blocks(const char *buffer, int sector, int count) {
+        for(int i = 0; i < count; i++) {
+            int res = disk_write(buffer + i * 512, sector + i);
+            if(res) return res;
+        }
+        return 0;
+    }
     virtual int disk_sync() { return 0; }
     virtual int disk_sectors() = 0;
 
+protected:
+    static DWORD fast_seek_size;
+    static UINT fast_seek_items;
 };
 
 }
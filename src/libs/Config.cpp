@@ -20,12 +20,16 @@ using namespace std;
 #include "libs/ConfigSources/FileConfigSource.h"
 #include "libs/ConfigSources/FirmConfigSource.h"
 #include "StreamOutputPool.h"
+#include "us_ticker_api.h"
 
 // Add various config sources. Config can be fetched from several places.
 // All values are read into a cache, that is then used by modules to read their configuration
 Config::Config()
 {
     this->config_cache = NULL;
+    this->lookup_count = 0;
+    this->lookup_us = 0;
+    this->load_us = 0;
 
     // Config source for firm config found in src/config.default
     this->config_sources.push_back( new FirmConfigSource("firm") );
@@ -53,9 +57,9 @@ void Config::on_module_loaded() {}
 void Config::on_console_line_received( void *argument ) {}
 
 // Get a list of modules, used by module "pools" that look for the "enable" keyboard to find things like "moduletype.modulename.enable" as the marker of a new instance of a module
-void Config::get_module_list(vector<uint16_t> *list, uint16_t family)
+void Config::get_module_list(vector<uint16_t> *list, uint16_t family, bool enabled_only)
 {
-    this->config_cache->collect(family, CHECKSUM("enable"), list);
+    this->config_cache->collect(family, CHECKSUM("enable"), list, enabled_only);
 }
 
 // Command to load config cache into buffer for multiple reads during init
@@ -66,13 +70,23 @@ void Config::config_cache_load(bool parse)
 
     this->config_cache= new ConfigCache;
     if(parse) {
+        uint32_t start = us_ticker_read();
         // For each ConfigSource in our stack
         for( ConfigSource *source : this->config_sources ) {
             source->transfer_values_to_cache(this->config_cache);
         }
+        this->load_us = us_ticker_read() - start;
     }
 }
 
+void Config::report_lookups(StreamOutput *stream)
+{
+    stream->printf("Config: %u values in %u bytes read in %lu us, %lu lookups took %lu us\r\n",
+                   this->config_cache == NULL ? 0 : (unsigned)this->config_cache->size(),
+                   this->config_cache == NULL ? 0 : (unsigned)this->config_cache->memory_used(),
+                   this->load_us, this->lookup_count, this->lookup_us);
+}
+
 // Command to clear the config cache after init
 void Config::config_cache_clear()
 {
@@ -90,7 +104,10 @@ ConfigValue *Config::value(uint16_t check_sum_a, uint16_t check_sum_b, uint16_t
     return this->value(check_sums);
 }
 
-static ConfigValue dummyValue;
+// lookups are filled in here, a few of them go round so that several can be used in one expression
+#define LOOKUP_VALUES 4
+static ConfigValue lookup_values[LOOKUP_VALUES];
+static int next_lookup_value;
 
 // Get a value from the configuration as a string
 // Because we don't like to waste space in Flash with lengthy config parameter names, we take a checksum instead so that the name does not have to be stored
@@ -103,15 +120,16 @@ ConfigValue *Config::value(uint16_t check_sums[])
         return NULL;
     }
 
-    ConfigValue *result = this->config_cache->lookup(check_sums);
+    ConfigValue *result = &lookup_values[next_lookup_value];
+    next_lookup_value = (next_lookup_value + 1) % LOOKUP_VALUES;
 
-    if(result == NULL) {
-        // create a dummy value for this to play with, each call requires it's own value not a shared one
-        // result= new ConfigValue(check_sums);
-        // config_cache->add(result);
-        dummyValue.clear();
-        result = &dummyValue;
+    uint32_t start = us_ticker_read();
+    if(!this->config_cache->lookup(check_sums, result)) {
+        // a value for the caller to play with, by_default() only changes it until the value is reused
+        result->clear();
     }
+    this->lookup_us += us_ticker_read() - start;
+    this->lookup_count++;
 
     return result;
 }
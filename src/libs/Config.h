@@ -12,10 +12,12 @@
 using namespace std;
 #include <vector>
 #include <string>
+#include <stdint.h>
 
 class ConfigValue;
 class ConfigSource;
 class ConfigCache;
+class StreamOutput;
 
 class Config : public Module {
     public:
@@ -30,8 +32,10 @@ class Config : public Module {
         ConfigValue* value(uint16_t check_sum_a, uint16_t check_sum_b= 0, uint16_t check_sum_c= 0 );
         ConfigValue* value(uint16_t check_sums[3] );
 
-        void get_module_list(vector<uint16_t>* list, uint16_t family);
+        // the instances of family with an enable line, only those it turns on if enabled_only
+        void get_module_list(vector<uint16_t>* list, uint16_t family, bool enabled_only= false);
         bool is_config_cache_loaded() { return config_cache != NULL; };    // Whether or not the cache is currently popluated
+        void report_lookups(StreamOutput *stream);
 
         friend class  Configurator;
 
@@ -40,6 +44,11 @@ class Config : public Module {
 
         ConfigCache* config_cache;            // A cache in which ConfigValues are kept
         vector<ConfigSource*> config_sources; // A list of all possible coniguration sources
+
+        // time spent finding values, what boot spends in here grows with the number of modules configured
+        uint32_t lookup_count;
+        uint32_t lookup_us;
+        uint32_t load_us;
 };
 
 #endif
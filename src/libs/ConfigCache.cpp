@@ -3,8 +3,14 @@
 
 #include "libs/StreamOutput.h"
 
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
 ConfigCache::ConfigCache()
 {
+    block_used = CONFIG_CACHE_BLOCK_SIZE;
+    modules_cs = 0;
 }
 
 ConfigCache::~ConfigCache()
@@ -14,62 +20,162 @@ ConfigCache::~ConfigCache()
 
 void ConfigCache::clear()
 {
-    for (auto &kv : store)  {
-        delete kv;
+    for (auto b : blocks)  {
+        free(b);
     }
-    store.clear();
-    storage_t().swap(store);   //  makes sure the vector releases its memory
+    vector<char*>().swap(blocks);   //  makes sure the vector releases its memory
+    vector<entry_t*>().swap(index);
+    vector<module_t>().swap(modules);
+    modules_cs = 0;
+    block_used = CONFIG_CACHE_BLOCK_SIZE;
 }
 
-void ConfigCache::add(ConfigValue *v)
+size_t ConfigCache::memory_used() const
 {
-    store.push_back(v);
+    return blocks.size() * CONFIG_CACHE_BLOCK_SIZE + index.capacity() * sizeof(entry_t*) + modules.capacity() * sizeof(module_t);
 }
 
-// If we find an existing value, replace it, otherwise, push it at the back of the list
-void ConfigCache::replace_or_push_back(ConfigValue *new_value)
+template<typename F> void ConfigCache::each(F fn) const
 {
-    // For each already existing element
-    for(auto &cv : store) {
-        // If this configvalue matches the checksum
-        if(memcmp(new_value->check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0) {
-            // Replace with the provided value
-            cv =  new_value;
-            printf("WARNING: duplicate config line replaced\n");
-            return;
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        size_t used = (b == blocks.size() - 1) ? block_used : CONFIG_CACHE_BLOCK_SIZE;
+        size_t off = 0;
+        while(off + sizeof(entry_t) <= used) {
+            entry_t *e = (entry_t *)(blocks[b] + off);
+            if(e->len == 0) break; // values are never empty, this is the zeroed end of the block
+            if(!e->replaced) fn(e);
+            off += entry_size(e->len);
         }
     }
+}
+
+size_t ConfigCache::lower_bound(uint64_t k) const
+{
+    size_t lo = 0, hi = index.size();
+    while(lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if(key(index[mid]->check_sums) < k) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+ConfigCache::entry_t *ConfigCache::append(const uint16_t *check_sums, const char *value, size_t len)
+{
+    float number;
+    bool boolean;
+    ConfigValue::TYPE type = ConfigValue::parse(value, len, number, boolean);
+    if(type == ConfigValue::NUMBER) {
+        value = (const char *)&number;
+        len = sizeof(number);
+    } else if(type == ConfigValue::BOOLEAN) {
+        value = (const char *)&boolean;
+        len = 1;
+    }
+
+    size_t n = entry_size(len);
+    if(n > CONFIG_CACHE_BLOCK_SIZE) {
+        printf("ERROR: config value %04X %04X %04X is too long, %u chars, it is left out\n", check_sums[0], check_sums[1], check_sums[2], (unsigned)len);
+        return NULL;
+    }
+    if(block_used + n > CONFIG_CACHE_BLOCK_SIZE) {
+        char *b = (char *)malloc(CONFIG_CACHE_BLOCK_SIZE);
+        if(b == NULL) {
+            printf("ERROR: no memory for config value %04X %04X %04X\n", check_sums[0], check_sums[1], check_sums[2]);
+            return NULL;
+        }
+        memset(b, 0, CONFIG_CACHE_BLOCK_SIZE);
+        blocks.push_back(b);
+        block_used = 0;
+    }
+    entry_t *e = (entry_t *)(blocks.back() + block_used);
+    block_used += n;
+    memcpy(e->check_sums, check_sums, sizeof(e->check_sums));
+    e->len = len;
+    e->type = type;
+    e->replaced = 0;
+    memcpy(e->value, value, len);
+    return e;
+}
+
+// If we find an existing value, replace it, otherwise, push it at the back of the list
+void ConfigCache::replace_or_push_back(const uint16_t *check_sums, const char *value, size_t len)
+{
+    if(len == 0) return;
+    modules_cs = 0;
+
+    uint64_t k = key(check_sums);
+    size_t i = lower_bound(k);
+    entry_t *e = append(check_sums, value, len);
+    if(e == NULL) return;
+
+    if(i < index.size() && key(index[i]->check_sums) == k) {
+        // Replace with the provided value, the old one stays in the block but is skipped
+        index[i]->replaced = 1;
+        index[i] = e;
+        printf("WARNING: duplicate config line replaced\n");
+        return;
+    }
 
     // Value does not already exists, add to the list
-    store.push_back(new_value);
+    index.insert(index.begin() + i, e);
 }
 
-ConfigValue *ConfigCache::lookup(const uint16_t *check_sums) const
+void ConfigCache::fill(const entry_t *e, ConfigValue *v)
 {
-    for( auto &cv : store) {
-        if(memcmp(check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0)
-            return cv;
+    v->clear();
+    memcpy(v->check_sums, e->check_sums, sizeof(v->check_sums));
+    v->type = (ConfigValue::TYPE)e->type;
+    if(v->type == ConfigValue::NUMBER) memcpy(&v->number, e->value, sizeof(v->number)); // records are only 2 byte aligned
+    else if(v->type == ConfigValue::BOOLEAN) v->boolean = e->value[0];
+    else v->value.assign(e->value, e->len);
+    v->found = true;
+}
+
+bool ConfigCache::lookup(const uint16_t *check_sums, ConfigValue *v) const
+{
+    uint64_t k = key(check_sums);
+    size_t i = lower_bound(k);
+    if(i < index.size() && key(index[i]->check_sums) == k) {
+        fill(index[i], v);
+        return true;
     }
 
-    return NULL;
+    return false;
 }
 
-void ConfigCache::collect(uint16_t family, uint16_t cs, vector<uint16_t> *list)
+void ConfigCache::index_modules(uint16_t cs)
 {
-    for( auto &kv : store ) {
-        if( kv->check_sums[2] == cs && kv->check_sums[0] == family ) {
-            // We found a module enable for this family, add it's number
-            list->push_back(kv->check_sums[1]);
+    modules.clear();
+    each([this, cs](const entry_t *e) {
+        if( e->check_sums[2] == cs ) {
+            // We found a module enable, whether it is on is as ConfigValue::as_bool() has it
+            ConfigValue v;
+            fill(e, &v);
+            modules.push_back({e->check_sums[0], e->check_sums[1], v.as_bool()});
         }
+    });
+    modules_cs = cs;
+}
+
+void ConfigCache::collect(uint16_t family, uint16_t cs, vector<uint16_t> *list, bool enabled_only)
+{
+    if(modules_cs != cs) index_modules(cs);
+    for (const module_t &m : modules) {
+        if( m.family == family && (m.enabled || !enabled_only) ) list->push_back(m.instance);
     }
 }
 
-void ConfigCache::dump(StreamOutput *stream)
+bool ConfigCache::dump(StreamOutput *stream, size_t &pos) const
 {
-    int l = 1;
-    for( auto &kv : store ) {
-        ConfigValue *v = kv;
-        stream->printf("%3d - %04X %04X %04X : '%s' - found: %d, default: %d, default-double: %f, default-int: %d\n",
-                       l++, v->check_sums[0], v->check_sums[1], v->check_sums[2], v->value.c_str(), v->found, v->default_set, v->default_double, v->default_int );
+    if(pos >= index.size()) {
+        stream->printf("%u values in %u bytes\n", (unsigned)size(), (unsigned)memory_used());
+        return false;
     }
+    const entry_t *e = index[pos++];
+    ConfigValue v;
+    fill(e, &v);
+    stream->printf("%3u - %04X %04X %04X : '%s'%s\n", (unsigned)pos, e->check_sums[0], e->check_sums[1], e->check_sums[2], v.as_string().c_str(),
+                   v.type == ConfigValue::NUMBER ? " number" : v.type == ConfigValue::BOOLEAN ? " bool" : "");
+    return true;
 }
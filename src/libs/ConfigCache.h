@@ -16,29 +16,70 @@ using namespace std;
 class ConfigValue;
 class StreamOutput;
 
+// size of the blocks the values are packed into, a value never spans two
+#define CONFIG_CACHE_BLOCK_SIZE 1024
+
+/*
+ * The values are kept as packed records rather than ConfigValues, so a config line costs its checksums and text
+ * and nothing else. A ConfigValue is only filled in when a module looks a key up, lines nobody reads never get one.
+ * Numbers and booleans are parsed when they are added and kept as a float or a byte instead of text.
+ */
 class ConfigCache {
     public:
         ConfigCache();
         ~ConfigCache();
         void clear();
 
-        void add(ConfigValue* v);
+        // lookup the entry that matches the check sums and fill in v with it, return false if not found
+        bool lookup(const uint16_t *check_sums, ConfigValue *v) const;
 
-        // lookup and return the entru that matches the check sums,return NULL if not found
-        ConfigValue *lookup(const uint16_t *check_sums) const;
-
-        // collect enabled checksums of the given family
-        void collect(uint16_t family, uint16_t cs, vector<uint16_t> *list);
+        // collect the instances of the given family that have a cs line, with only those it makes true if enabled_only
+        void collect(uint16_t family, uint16_t cs, vector<uint16_t> *list, bool enabled_only = false);
 
         // If we find an existing value, replace it, otherwise, push it at the back of the list
-        void replace_or_push_back(ConfigValue* new_value);
+        void replace_or_push_back(const uint16_t *check_sums, const char *value, size_t len);
+
+        // used for debugging, dumps the value at pos to a stream in checksum order and moves pos on, then the totals,
+        // false once those have been written
+        bool dump(StreamOutput *stream, size_t &pos) const;
 
-        // used for debugging, dumps the cache to a stream
-        void dump(StreamOutput *stream);
+        size_t size() const { return index.size(); }
+        size_t memory_used() const;
 
     private:
-        typedef vector<ConfigValue*> storage_t;
-        storage_t store;
+        struct entry_t {
+            uint16_t check_sums[3];
+            uint16_t len:12;        // of value, a block holds less than this can
+            uint16_t type:3;        // a ConfigValue::TYPE, value holds the chars, a float or a bool
+            uint16_t replaced:1;    // a later line had the same key, this one is skipped
+            char     value[];
+        };
+        static size_t entry_size(size_t len) { return (sizeof(entry_t) + len + 1) & ~1; }
+
+        // the three checksums as one key, cs0 is the most significant
+        static uint64_t key(const uint16_t *check_sums) { return ((uint64_t)check_sums[0] << 32) | ((uint32_t)check_sums[1] << 16) | check_sums[2]; }
+        // position in index of the first entry whose key is not less than k
+        size_t lower_bound(uint64_t k) const;
+        entry_t *append(const uint16_t *check_sums, const char *value, size_t len);
+        static void fill(const entry_t *e, ConfigValue *v);
+
+        // calls fn for each value in the order the lines were read, module lists depend on it
+        template<typename F> void each(F fn) const;
+
+        // the instances of every family in the order their cs lines were read, found in one pass over the values the
+        // first time a list is collected and again after a value is added, so each pool doesn't go through them all
+        struct module_t {
+            uint16_t family;
+            uint16_t instance;
+            bool     enabled;
+        };
+        void index_modules(uint16_t cs);
+        vector<module_t> modules;
+        uint16_t modules_cs;        // the checksum the index was made for, 0 when there is none
+
+        vector<char*> blocks;       // the records, one after another in each block
+        size_t block_used;          // bytes used in the last block
+        vector<entry_t*> index;     // sorted by key
 };
 
 
@@ -11,6 +11,7 @@
 using namespace std;
 #include <vector>
 #include <string>
+#include <utility>
 
 class ConfigValue;
 class ConfigCache;
@@ -24,14 +25,15 @@ class ConfigSource {
         virtual bool is_named( uint16_t check_sum ) = 0;
         virtual bool write( string setting, string value ) = 0;
         virtual string read( uint16_t check_sums[3] ) = 0;
+        // writes several settings in one go, written says which were, false unless they all were
+        virtual bool write( const vector<pair<string, string> >& settings, vector<bool>& written );
 
     protected:
-        virtual ConfigValue* process_line_from_ascii_config(const string& line, ConfigCache* cache);
+        // the key and value found are also returned, false if the line had none
+        virtual bool process_line_from_ascii_config(const string& line, ConfigCache* cache, uint16_t check_sums[3], string& value);
         virtual string process_line_from_ascii_config(const string& line, uint16_t line_checksums[3]);
+        bool process_line(const string &buffer, uint16_t check_sums[3], size_t &begin, size_t &size);
         uint16_t name_checksum;
-
-    private:
-        ConfigValue* process_line(const string &buffer);
 };
 
 
@@ -11,6 +11,7 @@
 #include "ConfigCache.h"
 #include "checksumm.h"
 #include "utils.h"
+#include "md5.h"
 #include <malloc.h>
 
 using namespace std;
@@ -19,11 +20,29 @@ using namespace std;
 
 #define include_checksum     CHECKSUM("include")
 
+/*
+ * A parsed config file is saved next to it as <config>.img, the next load reads that instead of parsing the text
+ * if the md5 of the config, and of the files it includes, still matches.
+ *
+ *   header, then the included file names (u8 length, chars), then for each line that had a value, in file order,
+ *   its three checksums (u16 each), u8 length and the value's chars
+ */
+#define IMAGE_MAGIC 0x31494353 // "SCI1"
+
+struct image_header {
+    uint32_t magic;
+    uint8_t  md5[16];
+    uint16_t files;
+    uint16_t values;
+};
+
 FileConfigSource::FileConfigSource(string config_file, const char *name)
 {
     this->name_checksum = get_checksum(name);
     this->config_file = config_file;
     this->config_file_found = false;
+    this->image_checked = false;
+    this->image_values = NULL;
 }
 
 bool FileConfigSource::readLine(string& line, int lineno, FILE *fp)
@@ -55,10 +74,35 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache )
     if( !this->has_config_file() ) {
         return;
     }
-    transfer_values_to_cache( cache, this->get_config_file().c_str());
+
+    if(load_image(cache)) {
+        this->image_checked = true;
+        return;
+    }
+
+    // record what the parse finds, if the image is to be rewritten
+    string values;
+    if(!this->image_checked) {
+        this->image_values = &values;
+        this->included_files.clear();
+    }
+
+    parse_file( cache, this->get_config_file().c_str());
+
+    if(this->image_values != NULL) {
+        save_image();
+        this->image_values = NULL;
+    }
+    vector<string>().swap(this->included_files);
+    this->image_checked = true;
 }
 
 void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char * file_name )
+{
+    parse_file(cache, file_name);
+}
+
+void FileConfigSource::parse_file( ConfigCache *cache, const char * file_name )
 {
     if( !file_exists(file_name) ) {
         return;
@@ -68,16 +112,29 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
     FILE *lp = fopen(file_name, "r");
 
     int ln= 1;
+    uint16_t check_sums[3];
+    string value;
     // For each line
     while(!feof(lp)) {
         string line;
         if(readLine(line, ln++, lp)) {
             // process the config line and store the value in cache
-            ConfigValue* cv = process_line_from_ascii_config(line, cache);
+            if(!process_line_from_ascii_config(line, cache, check_sums, value)) continue;
+
+            if(this->image_values != NULL) {
+                // the image has a byte for the length, a longer value means the text is parsed every time
+                if(value.size() > 255) {
+                    this->image_values = NULL;
+                } else {
+                    this->image_values->append((const char *)check_sums, sizeof(check_sums));
+                    this->image_values->push_back((char)value.size());
+                    this->image_values->append(value);
+                }
+            }
 
             // if this line is an include directive then attempt to read the included file
-            if(cv->check_sums[0] == include_checksum) {
-                string inc_file_name = cv->value.c_str();
+            if(check_sums[0] == include_checksum) {
+                string inc_file_name = value;
                 if(!file_exists(inc_file_name)) {
                     // if the file is not found at the location entered then look around for it a bit
                     if(inc_file_name[0] != '/') inc_file_name = "/" + inc_file_name;
@@ -98,8 +155,9 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
                     fgetpos(lp, &pos);
 
                     // open and read the included file
+                    if(this->image_values != NULL) this->included_files.push_back(inc_file_name);
                     freopen(inc_file_name.c_str(), "r", lp);
-                    this->transfer_values_to_cache(cache, inc_file_name.c_str());
+                    this->parse_file(cache, inc_file_name.c_str());
 
                     // reopen the current config file and restore position
                     freopen(file_name, "r", lp);
@@ -113,6 +171,97 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
     fclose(lp);
 }
 
+// md5 of the config file followed by every file it included, as they are now
+bool FileConfigSource::hash_files(void *digest)
+{
+    MD5 md5;
+    char buf[512];
+    for (int i = -1; i < (int)this->included_files.size(); ++i) {
+        FILE *fp = fopen(i < 0 ? this->config_file.c_str() : this->included_files[i].c_str(), "r");
+        if(fp == NULL) return false;
+        size_t n;
+        while((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+            md5.update(buf, n);
+        }
+        fclose(fp);
+    }
+    md5.finalize().bindigest(digest, 16);
+    return true;
+}
+
+bool FileConfigSource::load_image( ConfigCache *cache )
+{
+    string image_file = this->config_file + ".img";
+    FILE *fp = fopen(image_file.c_str(), "r");
+    if(fp == NULL) return false;
+
+    bool ok = false;
+    long start;
+    struct image_header h;
+    this->included_files.clear();
+    if(fread(&h, sizeof(h), 1, fp) != 1 || h.magic != IMAGE_MAGIC) goto done;
+
+    char buf[256];
+    for (int i = 0; i < h.files; ++i) {
+        int len = fgetc(fp);
+        if(len == EOF || fread(buf, 1, len, fp) != (size_t)len) goto done;
+        this->included_files.push_back(string(buf, len));
+    }
+
+    uint8_t digest[16];
+    if(!hash_files(digest) || memcmp(digest, h.md5, sizeof(digest)) != 0) goto done;
+
+    // check it is all there before adding any, a short image falls back to parsing the text
+    start = ftell(fp);
+    for (int i = 0; i < h.values; ++i) {
+        uint16_t check_sums[3];
+        if(fread(check_sums, sizeof(check_sums), 1, fp) != 1) goto done;
+        int len = fgetc(fp);
+        if(len == EOF || fread(buf, 1, len, fp) != (size_t)len) goto done;
+    }
+    fseek(fp, start, SEEK_SET);
+    for (int i = 0; i < h.values; ++i) {
+        uint16_t check_sums[3];
+        fread(check_sums, sizeof(check_sums), 1, fp);
+        int len = fgetc(fp);
+        fread(buf, 1, len, fp);
+        cache->replace_or_push_back(check_sums, buf, len);
+    }
+    ok = true;
+
+done:
+    fclose(fp);
+    vector<string>().swap(this->included_files);
+    return ok;
+}
+
+void FileConfigSource::save_image()
+{
+    struct image_header h;
+    h.magic = IMAGE_MAGIC;
+    h.files = this->included_files.size();
+    h.values = 0;
+    for(auto &f : this->included_files) {
+        if(f.size() > 255) return;
+    }
+    for (size_t i = 0; i < this->image_values->size(); i += 7 + (uint8_t)(*this->image_values)[i + 6]) {
+        h.values++;
+    }
+    if(!hash_files(h.md5)) return;
+
+    string image_file = this->config_file + ".img";
+    FILE *fp = fopen(image_file.c_str(), "w");
+    if(fp == NULL) return;
+
+    fwrite(&h, sizeof(h), 1, fp);
+    for(auto &f : this->included_files) {
+        fputc(f.size(), fp);
+        fwrite(f.data(), 1, f.size(), fp);
+    }
+    fwrite(this->image_values->data(), 1, this->image_values->size(), fp);
+    fclose(fp);
+}
+
 // Return true if the check_sums match
 bool FileConfigSource::is_named( uint16_t check_sum )
 {
@@ -122,55 +271,90 @@ bool FileConfigSource::is_named( uint16_t check_sum )
 // OverWrite or append a config setting to the file
 bool FileConfigSource::write( string setting, string value )
 {
+    vector<pair<string, string> > settings(1, make_pair(setting, value));
+    vector<bool> written;
+    return write(settings, written);
+}
+
+// all the settings are changed in one pass through the file, each line is parsed once and checked against all of
+// them, a setting found is overwritten in place and the ones that are not there are appended at the end
+bool FileConfigSource::write( const vector<pair<string, string> >& settings, vector<bool>& written )
+{
+    written.assign(settings.size(), false);
     if( !this->has_config_file() ) {
         return false;
     }
 
-    uint16_t setting_checksums[3];
-    get_checksums(setting_checksums, setting );
+    vector<uint16_t> setting_checksums(settings.size() * 3);
+    for (size_t i = 0; i < settings.size(); i++) {
+        get_checksums(&setting_checksums[i * 3], settings[i].first );
+    }
 
     // Open the config file ( find it if we haven't already found it )
     FILE *lp = fopen(this->get_config_file().c_str(), "r+");
+    if(lp == NULL) return false;
+
+    // found says which were in the file, whether or not there was room for them
+    vector<bool> found(settings.size(), false);
+    size_t left = settings.size();
 
     // search each line for a match
-    while(!feof(lp)) {
+    while(left > 0 && !feof(lp)) {
         string line;
         fpos_t bol, eol;
         fgetpos( lp, &bol ); // get start of line
-        if(readLine(line, 0, lp)) {
-            fgetpos( lp, &eol ); // get end of line
-            if(!process_line_from_ascii_config(line, setting_checksums).empty()) {
-                // found it
-                unsigned int free_space = eol - bol - 4; // length of line
-                // check we have enough space for this insertion
-                if( (setting.length() + value.length() + 3) > free_space ) {
-                    //THEKERNEL->streams->printf("ERROR: Not enough room for value\r\n");
-                    fclose(lp);
-                    return false;
-                }
-
-                // Update line, leaves whatever was at end of line there just overwrites the key and value
-                fseek(lp, bol, SEEK_SET);
-                fputs(setting.c_str(), lp);
-                fputs(" ", lp);
-                fputs(value.c_str(), lp);
-                fputs(" #", lp);
-                fclose(lp);
-                return true;
+        if(!readLine(line, 0, lp)) break;
+        fgetpos( lp, &eol ); // get end of line
+
+        uint16_t line_checksums[3];
+        size_t begin, size;
+        if(!process_line(line, line_checksums, begin, size)) continue;
+
+        for (size_t i = 0; i < settings.size(); i++) {
+            uint16_t *cs = &setting_checksums[i * 3];
+            if(found[i] || cs[0] != line_checksums[0] || cs[1] != line_checksums[1] || cs[2] != line_checksums[2]) continue;
+
+            // found it
+            found[i] = true;
+            left--;
+            unsigned int free_space = eol - bol - 4; // length of line
+            // check we have enough space for this insertion
+            if( (settings[i].first.length() + settings[i].second.length() + 3) > free_space ) {
+                //THEKERNEL->streams->printf("ERROR: Not enough room for value\r\n");
+                break;
             }
-        }else break;
+
+            // Update line, leaves whatever was at end of line there just overwrites the key and value
+            fsetpos(lp, &bol);
+            fputs(settings[i].first.c_str(), lp);
+            fputs(" ", lp);
+            fputs(settings[i].second.c_str(), lp);
+            fputs(" #", lp);
+            // back to reading where the line ended
+            fsetpos(lp, &eol);
+            written[i] = true;
+            break;
+        }
     }
 
-    // not found so append the new value
-    fclose(lp);
-    lp = fopen(this->get_config_file().c_str(), "a");
-    fputs("\n", lp);
-    fputs(setting.c_str(), lp);
-    fputs("         ", lp);
-    fputs(value.c_str(), lp);
-    fputs("         # added\n", lp);
+    // the ones not found are appended
+    if(left > 0) {
+        fseek(lp, 0, SEEK_END);
+        for (size_t i = 0; i < settings.size(); i++) {
+            if(found[i]) continue;
+            fputs("\n", lp);
+            fputs(settings[i].first.c_str(), lp);
+            fputs("         ", lp);
+            fputs(settings[i].second.c_str(), lp);
+            fputs("         # added\n", lp);
+            written[i] = true;
+        }
+    }
     fclose(lp);
 
+    for (size_t i = 0; i < settings.size(); i++) {
+        if(!written[i]) return false;
+    }
     return true;
 }
 
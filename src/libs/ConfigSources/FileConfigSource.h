@@ -14,6 +14,7 @@ class ConfigCache;
 
 using namespace std;
 #include <string>
+#include <vector>
 #include <stdio.h>
 
 class FileConfigSource : public ConfigSource
@@ -24,6 +25,7 @@ public:
     void transfer_values_to_cache( ConfigCache *cache, const char * file_name );
     bool is_named( uint16_t check_sum );
     bool write( string setting, string value );
+    bool write( const vector<pair<string, string> >& settings, vector<bool>& written );
     string read( uint16_t check_sums[3] );
     bool has_config_file();
     void try_config_file(string candidate);
@@ -31,8 +33,18 @@ public:
 
 private:
     bool readLine(string& line, int lineno, FILE *fp);
+    void parse_file( ConfigCache *cache, const char * file_name );
+    bool hash_files(void *digest);
+    bool load_image( ConfigCache *cache );
+    void save_image();
+
     string config_file;         // Path to the config file
     bool   config_file_found;   // Wether or not the config file's location is known
+    bool   image_checked;       // the image is only rewritten on the first load, which is at boot before USB can mount the card
+
+    // while parsing for an image, the values in the order they were read, and the included files
+    string *image_values;
+    vector<string> included_files;
 };
 
 
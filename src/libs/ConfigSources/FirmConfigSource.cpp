@@ -29,6 +29,8 @@ FirmConfigSource::FirmConfigSource(const char* name){
 void FirmConfigSource::transfer_values_to_cache( ConfigCache* cache ){
 
     char* p = &_binary_config_default_start;
+    uint16_t check_sums[3];
+    string value;
     // For each line
     while( p < &_binary_config_default_end ){
         // find eol
@@ -39,7 +41,7 @@ void FirmConfigSource::transfer_values_to_cache( ConfigCache* cache ){
         string line(p, eol-p);
         //printf("firm: processing %s\n", line.c_str());
         p= eol;
-        process_line_from_ascii_config(line, cache);
+        process_line_from_ascii_config(line, cache, check_sums, value);
     }
 }
 
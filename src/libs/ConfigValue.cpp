@@ -11,6 +11,8 @@
 
 #include <vector>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 ConfigValue::ConfigValue()
 {
@@ -26,6 +28,8 @@ void ConfigValue:: clear()
     this->check_sums[2] = 0x0000;
     this->default_double= 0.0F;
     this->default_int= 0;
+    this->type= NONE;
+    this->number= 0.0F;
     this->value= "";
 }
 
@@ -33,15 +37,14 @@ ConfigValue::ConfigValue(uint16_t *cs) {
     memcpy(this->check_sums, cs, sizeof(this->check_sums));
     this->found = false;
     this->default_set = false;
+    this->type= NONE;
+    this->number= 0.0F;
     this->value= "";
 }
 
 ConfigValue::ConfigValue(const ConfigValue& to_copy)
 {
-    this->found = to_copy.found;
-    this->default_set = to_copy.default_set;
-    memcpy(this->check_sums, to_copy.check_sums, sizeof(this->check_sums));
-    this->value.assign(to_copy.value);
+    *this= to_copy;
 }
 
 ConfigValue& ConfigValue::operator= (const ConfigValue& to_copy)
@@ -49,12 +52,51 @@ ConfigValue& ConfigValue::operator= (const ConfigValue& to_copy)
     if( this != &to_copy ){
         this->found = to_copy.found;
         this->default_set = to_copy.default_set;
+        this->default_double = to_copy.default_double;
+        this->default_int = to_copy.default_int;
         memcpy(this->check_sums, to_copy.check_sums, sizeof(this->check_sums));
+        this->type = to_copy.type;
+        this->number = to_copy.number;
+        if(to_copy.type == BOOLEAN) this->boolean = to_copy.boolean;
         this->value.assign(to_copy.value);
     }
     return *this;
 }
 
+ConfigValue::TYPE ConfigValue::parse(const char *text, size_t len, float &number, bool &boolean)
+{
+    if((len == 4 && strncmp(text, "true", 4) == 0) || (len == 5 && strncmp(text, "false", 5) == 0)) {
+        boolean = (len == 4);
+        return BOOLEAN;
+    }
+
+    char buf[16];
+    if(len == 0 || len >= sizeof(buf)) return STRING;
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+    char *endptr;
+    float f = strtof(buf, &endptr);
+    if(endptr != buf + len) return STRING;
+
+    // things like pins (0.10) and numbers with more digits than a float has must keep their text
+    char canonical[16];
+    snprintf(canonical, sizeof(canonical), "%g", f);
+    if(strcmp(canonical, buf) != 0) return STRING;
+    number = f;
+    return NUMBER;
+}
+
+string ConfigValue::text() const
+{
+    if(this->type == NUMBER) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%g", this->number);
+        return buf;
+    }
+    if(this->type == BOOLEAN) return this->boolean ? "true" : "false";
+    return this->value;
+}
+
 ConfigValue *ConfigValue::required()
 {
     if( !this->found ) {
@@ -67,13 +109,15 @@ float ConfigValue::as_number()
 {
     if( this->found == false && this->default_set == true ) {
         return this->default_double;
+    } else if( this->type == NUMBER ) {
+        return this->number;
     } else {
         char *endptr = NULL;
-        string str = remove_non_number(this->value);
+        string str = remove_non_number(this->text());
         const char *cp= str.c_str();
         float result = strtof(cp, &endptr);
         if( endptr <= cp ) {
-            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid number, please see http://smoothieware.org/configuring-smoothie\r\n", this->value.c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
+            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid number, please see http://smoothieware.org/configuring-smoothie\r\n", this->text().c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
         }
         return result;
     }
@@ -83,13 +127,15 @@ int ConfigValue::as_int()
 {
     if( this->found == false && this->default_set == true ) {
         return this->default_int;
+    } else if( this->type == NUMBER ) {
+        return (int)this->number; // both truncate, as strtol stops at the point
     } else {
         char *endptr = NULL;
-        string str = remove_non_number(this->value);
+        string str = remove_non_number(this->text());
         const char *cp= str.c_str();
         int result = strtol(cp, &endptr, 10);
         if( endptr <= cp ) {
-            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid int, please see http://smoothieware.org/configuring-smoothie\r\n", this->value.c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
+            printErrorandExit("config setting with value '%s' and checksums[%04X,%04X,%04X] is not a valid int, please see http://smoothieware.org/configuring-smoothie\r\n", this->text().c_str(), this->check_sums[0], this->check_sums[1], this->check_sums[2] );
         }
         return result;
     }
@@ -97,15 +143,17 @@ int ConfigValue::as_int()
 
 std::string ConfigValue::as_string()
 {
-    return this->value;
+    return this->text();
 }
 
 bool ConfigValue::as_bool()
 {
     if( this->found == false && this->default_set == true ) {
         return this->default_int;
+    } else if( this->type == BOOLEAN ) {
+        return this->boolean;
     } else {
-        return this->value.find_first_of("ty1") != string::npos;
+        return this->text().find_first_of("ty1") != string::npos;
     }
 }
 
@@ -130,13 +178,14 @@ ConfigValue *ConfigValue::by_default(string val)
         return this;
     }
     this->default_set = true;
+    this->type = STRING;
     this->value = val;
     return this;
 }
 
 bool ConfigValue::has_characters( const char *mask )
 {
-    if( this->value.find_first_of(mask) != string::npos ) {
+    if( this->text().find_first_of(mask) != string::npos ) {
         return true;
     } else {
         return false;
@@ -9,6 +9,8 @@
 #define CONFIGVALUE_H
 
 #include <string>
+#include <stdint.h>
+#include <stddef.h>
 using std::string;
 
 class ConfigValue{
@@ -37,8 +39,19 @@ class ConfigValue{
         friend class FileConfigSource;
 
     private:
+        // how a value was stored, numbers and booleans are parsed once when the config is read
+        enum TYPE { NONE, STRING, NUMBER, BOOLEAN };
+        // the type the text would be stored as, a number or boolean only if text() gives back exactly the same text
+        static TYPE parse(const char *text, size_t len, float &number, bool &boolean);
+        string text() const;
+
         bool has_characters( const char* mask );
-        string value;
+        TYPE type;
+        union {
+            float number;
+            bool boolean;
+        };
+        string value;               // only used for STRING
         int default_int;
         float default_double;
         uint16_t check_sums[3];
@@ -0,0 +1,90 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EventTrace.h"
+
+#include "libs/StreamOutput.h"
+#include "platform_memory.h"
+#include "system_LPC17xx.h" // for SystemCoreClock
+#include "LPC17xx.h"
+
+#include <string.h>
+
+// the DWT is not in the CMSIS header we use
+#define DWT_CTRL            (*(volatile uint32_t *)0xE0001000)
+#define DWT_CTRL_CYCCNTENA  (1UL << 0)
+
+volatile uint32_t * const EventTrace::dwt_cyccnt= (volatile uint32_t *)0xE0001004;
+EventTrace::Record *EventTrace::ring= nullptr;
+uint32_t EventTrace::head= 0;
+volatile uint32_t EventTrace::mask= 0;
+
+void EventTrace::init()
+{
+    // the cycle counter needs trace enabled, this is harmless if the profiler or the debug monitor has already done it
+    CoreDebug->DEMCR |= (1UL << CoreDebug_DEMCR_TRCENA_Pos);
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+
+    ring= placed_alloc<Record>(EVENT_TRACE_RECORDS, PLACE_AHB);
+    if(ring == nullptr) return;
+    clear();
+    mask= (1UL << NUM_EVENTS) - 1;
+}
+
+void EventTrace::clear()
+{
+    if(ring == nullptr) return;
+    uint32_t m= mask;
+    mask= 0;
+    memset(ring, 0, EVENT_TRACE_RECORDS * sizeof(Record));
+    head= 0;
+    mask= m;
+}
+
+/*
+ * The dump is text so it gets through any stream, a header then the records as hex, eight to a line
+ *
+ *   trace <records> <cpu hz> <events recorded>
+ *   T <cycles><info> ...
+ *
+ * each record is the 8 bytes of a Record, little endian, oldest first.
+ */
+void EventTrace::dump(StreamOutput *stream)
+{
+    if(ring == nullptr) {
+        stream->printf("no memory for the event trace\r\n");
+        return;
+    }
+
+    // recording stops while the ring is read, so it is all from before the dump
+    uint32_t m= mask;
+    mask= 0;
+    uint32_t total= head;
+    uint32_t n= total < EVENT_TRACE_RECORDS ? total : EVENT_TRACE_RECORDS;
+    stream->printf("trace %lu %lu %lu\r\n", n, SystemCoreClock, total);
+
+    char line[2 + 8 * 17 + 3];
+    static const char hex[]= "0123456789abcdef";
+    for (uint32_t i = 0; i < n; ) {
+        char *p= line;
+        *p++= 'T';
+        for (int k = 0; k < 8 && i < n; k++, i++) {
+            const uint8_t *b= reinterpret_cast<const uint8_t *>(&ring[(total - n + i) & (EVENT_TRACE_RECORDS - 1)]);
+            *p++= ' ';
+            for (unsigned j = 0; j < sizeof(Record); j++) {
+                *p++= hex[b[j] >> 4];
+                *p++= hex[b[j] & 15];
+            }
+        }
+        *p++= '\r';
+        *p++= '\n';
+        *p= '\0';
+        stream->puts(line);
+    }
+    stream->printf("trace end\r\n");
+    mask= m;
+}
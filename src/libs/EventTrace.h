@@ -0,0 +1,60 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef EVENTTRACE_H
+#define EVENTTRACE_H
+
+#include <stdint.h>
+
+class StreamOutput;
+
+#ifndef EVENT_TRACE_RECORDS
+#define EVENT_TRACE_RECORDS 1024
+#endif
+
+// The last EVENT_TRACE_RECORDS events of the motion interrupts and the block queue, each stamped with the DWT cycle
+// counter, in a ring in AHB SRAM. Any interrupt may record, the slot is claimed with an atomic add so nothing is locked.
+// The trace command dumps it for smoothie-trace.py. Only compiled in when EVENT_TRACE is defined in src/makefile
+class EventTrace {
+    public:
+        enum Event { BLOCK_BEGIN, BLOCK_END, PENDSV, ACCEL_TICK, QUEUE_DEPTH, UNDERRUN, RECALCULATE, NUM_EVENTS };
+
+        struct Record {
+            uint32_t cycles;
+            uint32_t info;              // the event in the low byte, its argument above
+        };
+
+        static void init();
+        static void clear();
+        // only the events with their bit set in mask are recorded
+        static void set_mask(uint32_t m) { mask = m; }
+        static uint32_t get_mask() { return mask; }
+        static void dump(StreamOutput *stream);
+
+        static inline void record(Event e, uint32_t arg) {
+            if((mask & (1UL << e)) == 0) return;
+            uint32_t i = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) & (EVENT_TRACE_RECORDS - 1);
+            ring[i].cycles = *dwt_cyccnt;
+            ring[i].info = (arg << 8) | e;
+        }
+
+    private:
+        static volatile uint32_t * const dwt_cyccnt;
+        static Record *ring;
+        static uint32_t head;           // the number of events recorded, the ring has the last of them
+        static volatile uint32_t mask;
+};
+
+static_assert((EVENT_TRACE_RECORDS & (EVENT_TRACE_RECORDS - 1)) == 0, "EVENT_TRACE_RECORDS must be a power of two");
+
+#ifdef EVENT_TRACE
+#define TRACE_EVENT(e, arg)  EventTrace::record(EventTrace::e, arg)
+#else
+#define TRACE_EVENT(e, arg)
+#endif
+
+#endif
@@ -3,6 +3,7 @@ extern "C"{
 }
 #include "Hook.h"
 
-// Hook is just a glorified FPointer
-
-Hook::Hook(){}
+Hook::Hook(){
+    interval = next = 0;
+    overruns = max_late = 0;
+}
@@ -1,14 +1,18 @@
 #ifndef HOOK_H
 #define HOOK_H
-#include "libs/FPointer.h"
+#include "libs/Callback.h"
 
-// Hook is just a glorified FPointer
+// A callback and when SlowTicker is to call it next, kept by value in its schedule
 
-class Hook : public FPointer {
+class Hook {
     public:
         Hook();
-        int     interval;
-        int     countdown;
+        uint32_t call() { return callback(0); }
+        Callback<uint32_t(uint32_t)> callback;
+        uint32_t interval;
+        uint32_t next;          // timer count this is next due at
+        uint32_t overruns;      // times it was called a whole interval or more late
+        uint32_t max_late;      // in timer counts
 };
 
 #endif
@@ -0,0 +1,82 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "IsrProfiler.h"
+
+#include "libs/StreamOutput.h"
+#include "system_LPC17xx.h" // for SystemCoreClock
+#include "LPC17xx.h"
+
+#include <string.h>
+
+// the DWT is not in the CMSIS header we use
+#define DWT_CTRL            (*(volatile uint32_t *)0xE0001000)
+#define DWT_CTRL_CYCCNTENA  (1UL << 0)
+
+volatile uint32_t * const IsrProfiler::dwt_cyccnt= (volatile uint32_t *)0xE0001004;
+IsrProfiler::Profile IsrProfiler::profiles[NUM_HANDLERS];
+
+static const char * const handler_names[IsrProfiler::NUM_HANDLERS]= { "TIMER0 step", "TIMER1 unstep", "RIT accel", "PendSV block", "TIMER2 slow", "block begin" };
+
+void IsrProfiler::init()
+{
+    // the cycle counter needs trace enabled, this is harmless if the debug monitor has already done it
+    CoreDebug->DEMCR |= (1UL << CoreDebug_DEMCR_TRCENA_Pos);
+    *dwt_cyccnt= 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    reset();
+}
+
+void IsrProfiler::reset()
+{
+    for (int i = 0; i < NUM_HANDLERS; ++i) {
+        __disable_irq();
+        memset(&profiles[i], 0, sizeof(Profile));
+        profiles[i].min= UINT32_MAX;
+        __enable_irq();
+    }
+}
+
+uint64_t IsrProfiler::total_cycles()
+{
+    // the block begin is timed inside PendSV
+    uint64_t t= 0;
+    __disable_irq();
+    for (int i = 0; i < NUM_HANDLERS; ++i) {
+        if(i != BLOCK_BEGIN) t += profiles[i].total;
+    }
+    __enable_irq();
+    return t;
+}
+
+void IsrProfiler::dump(StreamOutput *stream)
+{
+    float us_per_cycle= 1000000.0F / SystemCoreClock;
+    stream->printf("handler          count      min      avg      max  (cycles, %1.4fus each)\r\n", us_per_cycle);
+
+    for (int i = 0; i < NUM_HANDLERS; ++i) {
+        // take a consistent copy, the handlers keep updating these
+        Profile p;
+        __disable_irq();
+        p= profiles[i];
+        __enable_irq();
+
+        if(p.count == 0) {
+            stream->printf("%-13s %8d\r\n", handler_names[i], 0);
+            continue;
+        }
+        stream->printf("%-13s %8lu %8lu %8lu %8lu\r\n", handler_names[i], p.count, p.min, (uint32_t)(p.total / p.count), p.max);
+
+        stream->printf("    histogram:");
+        for (uint32_t b = 0; b < num_buckets; ++b) {
+            if(p.histogram[b] == 0) continue;
+            if(b == num_buckets - 1) stream->printf(" >=%lu:%lu", 1UL << (b - 1), p.histogram[b]);
+            else stream->printf(" <%lu:%lu", 1UL << b, p.histogram[b]);
+        }
+        stream->printf("\r\n");
+    }
+}
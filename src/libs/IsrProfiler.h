@@ -0,0 +1,62 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ISRPROFILER_H
+#define ISRPROFILER_H
+
+#include <stdint.h>
+
+class StreamOutput;
+
+// Cycle counts for the motion and tick interrupt handlers, measured with the DWT cycle counter. Times are inclusive of
+// any higher priority interrupt that preempted the handler. Only compiled in when ISR_PROFILE is defined in src/makefile
+class IsrProfiler {
+    public:
+        enum Handler { TIMER0, TIMER1, RIT, PENDSV, TIMER2, BLOCK_BEGIN, NUM_HANDLERS };
+
+        static void init();
+        static void dump(StreamOutput *stream);
+        static void reset();
+        // all the cycles spent in the interrupt handlers, a handler preempted by another counts that one's time too
+        static uint64_t total_cycles();
+
+        static inline uint32_t now() { return *dwt_cyccnt; }
+        static inline void record(Handler h, uint32_t start) {
+            uint32_t cycles= *dwt_cyccnt - start;
+            Profile& p= profiles[h];
+            p.count++;
+            p.total += cycles;
+            if(cycles < p.min) p.min= cycles;
+            if(cycles > p.max) p.max= cycles;
+            // bucket n holds times below 2^n cycles, the last one everything bigger
+            uint32_t b= cycles == 0 ? 0 : 32 - __builtin_clz(cycles);
+            p.histogram[b < num_buckets ? b : num_buckets - 1]++;
+        }
+
+    private:
+        static const uint32_t num_buckets= 16;
+        struct Profile {
+            uint32_t count;
+            uint32_t min;
+            uint32_t max;
+            uint64_t total;
+            uint32_t histogram[num_buckets];
+        };
+
+        static volatile uint32_t * const dwt_cyccnt;
+        static Profile profiles[NUM_HANDLERS];
+};
+
+#ifdef ISR_PROFILE
+#define ISR_PROFILE_ENTER()  uint32_t isr_profile_start= IsrProfiler::now()
+#define ISR_PROFILE_EXIT(h)  IsrProfiler::record(IsrProfiler::h, isr_profile_start)
+#else
+#define ISR_PROFILE_ENTER()
+#define ISR_PROFILE_EXIT(h)
+#endif
+
+#endif
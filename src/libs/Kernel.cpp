@@ -12,19 +12,25 @@
 #include "libs/SlowTicker.h"
 #include "libs/Adc.h"
 #include "libs/StreamOutputPool.h"
+#include "libs/MachineStatus.h"
 #include <mri.h>
 #include "checksumm.h"
 #include "ConfigValue.h"
 
 #include "libs/StepTicker.h"
 #include "libs/PublicData.h"
+#include "libs/IsrProfiler.h"
+#include "libs/LoopMonitor.h"
+#include "libs/StreamOutput.h"
 #include "modules/communication/SerialConsole.h"
 #include "modules/communication/GcodeDispatch.h"
+#include "modules/communication/RealtimeCommands.h"
 #include "modules/robot/Planner.h"
 #include "modules/robot/Robot.h"
 #include "modules/robot/Stepper.h"
 #include "modules/robot/Conveyor.h"
 #include "modules/robot/Pauser.h"
+#include "us_ticker_api.h"
 
 #include <malloc.h>
 #include <array>
@@ -35,12 +41,23 @@
 #define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
 #define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
 #define acceleration_ticks_per_second_checksum      CHECKSUM("acceleration_ticks_per_second")
+#define port_stepping_checksum                      CHECKSUM("port_stepping")
+#define hardware_step_pulse_checksum                CHECKSUM("hardware_step_pulse")
+#define main_loop_warn_ms_checksum                  CHECKSUM("main_loop_warn_ms")
+
+// housekeeping is never put off for more main loops than this in a row
+#define MAX_HOUSEKEEPING_WAITS 16
 
 Kernel* Kernel::instance;
 
 // The kernel is the central point in Smoothie : it stores modules, and handles event calls
 Kernel::Kernel(){
     instance= this; // setup the Singleton instance of the kernel
+    this->realtime= nullptr;
+
+#ifdef ISR_PROFILE
+    reset_event_stats();
+#endif
 
     // serial first at fixed baud rate (DEFAULT_SERIAL_BAUD_RATE) so config can report errors to serial
 	// Set to UART0, this will be changed to use the same UART as MRI if it's enabled
@@ -50,16 +67,23 @@ Kernel::Kernel(){
     this->config = new Config();
 
     // Pre-load the config cache, do after setting up serial so we can report errors to serial
+    uint32_t start= us_ticker_read();
     this->config->config_cache_load();
+    add_boot_time("config cache", us_ticker_read() - start);
 
     // now config is loaded we can do normal setup for serial based on config
     delete this->serial;
     this->serial= NULL;
 
     this->streams = new StreamOutputPool();
+    this->status = new MachineStatus();
 
     this->current_path   = "/";
 
+    this->housekeeping_waits = 0;
+    this->loop_monitor = new LoopMonitor();
+    this->loop_monitor->set_warn_us(this->config->value(main_loop_warn_ms_checksum)->by_default(0)->as_number() * 1000);
+
     // Configure UART depending on MRI config
     // Match up the SerialConsole to MRI UART. This makes it easy to use only one UART for both debug and actual commands.
     NVIC_SetPriorityGrouping(0);
@@ -85,11 +109,14 @@ Kernel::Kernel(){
         this->serial = new SerialConsole(USBTX, USBRX, this->config->value(uart0_checksum,baud_rate_setting_checksum)->by_default(DEFAULT_SERIAL_BAUD_RATE)->as_number());
     }
 
-    this->add_module( this->config );
-    this->add_module( this->serial );
+    this->add_module( this->config, "config" );
+    this->add_module( this->serial, "serial" );
+
+    // before anything registers for gcodes, as it keeps the routes
+    this->add_module( this->gcode_dispatch = new GcodeDispatch(), "gcode dispatch" );
 
     // HAL stuff
-    add_module( this->slow_ticker = new SlowTicker());
+    add_module( this->slow_ticker = new SlowTicker(), "slow ticker" );
 
     this->step_ticker = new StepTicker();
     this->adc = new Adc();
@@ -129,38 +156,238 @@ Kernel::Kernel(){
     this->step_ticker->set_reset_delay( microseconds_per_step_pulse );
     this->step_ticker->set_frequency( this->base_stepping_frequency );
     this->step_ticker->set_acceleration_ticks_per_second(acceleration_ticks_per_second); // must be set after set_frequency
+    this->step_ticker->set_port_stepping(this->config->value(port_stepping_checksum)->by_default(true)->as_bool()); // must be set before any motors are created
+    this->step_ticker->set_hardware_pulses(this->config->value(hardware_step_pulse_checksum)->by_default(false)->as_bool()); // so must this
 
     // Core modules
-    this->add_module( new GcodeDispatch() );
-    this->add_module( this->robot          = new Robot()         );
-    this->add_module( this->stepper        = new Stepper()       );
-    this->add_module( this->conveyor       = new Conveyor()      );
-    this->add_module( this->pauser         = new Pauser()        );
+    this->add_module( this->robot          = new Robot(),         "robot" );
+    this->add_module( this->stepper        = new Stepper(),       "stepper" );
+    this->add_module( this->conveyor       = new Conveyor(),      "conveyor" );
+    this->add_module( this->pauser         = new Pauser(),        "pauser" );
 
     this->planner = new Planner();
 
+    // the receive interrupts start handing it bytes from here
+    this->add_module( this->realtime       = new RealtimeCommands(), "realtime" );
+
 }
 
 // Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
-void Kernel::add_module(Module* module){
+void Kernel::add_module(Module* module, const char *name){
+    uint32_t start= us_ticker_read();
     module->on_module_loaded();
+    add_boot_time(name == nullptr ? "?" : name, us_ticker_read() - start);
+    boot_times.back().module= module;
+}
+
+void Kernel::add_boot_time(const char *name, uint32_t us){
+    boot_times.push_back({name, nullptr, us});
+}
+
+// the name it was added with, nullptr for a module another one loaded itself
+const char *Kernel::module_name(const Module *module) const{
+    for (auto& b : boot_times) {
+        if(b.module == module) return b.name.c_str();
+    }
+    return nullptr;
+}
+
+void Kernel::dump_boot_times(StreamOutput *stream){
+    for (auto& b : boot_times) {
+        stream->printf("%-24s %8lu us\r\n", b.name.c_str(), b.us);
+    }
+}
+
+// GCC lets us turn a bound pointer to member into the plain function the vtable would call, see "Extracting the
+// Function Pointer from a Bound Pointer to Member Function" in the GCC manual
+#pragma GCC diagnostic ignored "-Wpmf-conversions"
+static EventCallback resolve_callback(_EVENT_ENUM id_event, Module *mod){
+    EventCallback callback= (EventCallback)(mod->*kernel_callback_functions[id_event]);
+
+    // a module that registered for an event it does not implement would only call the empty Module handler
+    static Module base;
+    if(callback == (EventCallback)(base.*kernel_callback_functions[id_event])) return nullptr;
+    return callback;
 }
 
 // Adds a hook for a given module and event
-void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod){
-    this->hooks[id_event].push_back(mod);
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod, uint8_t gcode_filter){
+    EventCallback callback= resolve_callback(id_event, mod);
+    if(callback == nullptr) return;
+
+    if(id_event == ON_GCODE_RECEIVED) {
+        this->gcode_dispatch->add_subscriber(callback, mod, gcode_filter, 0, 0);
+    } else if(id_event == ON_MAIN_LOOP) {
+        register_for_main_loop(mod, MAIN_LOOP_NORMAL, nullptr);
+    } else {
+        this->hooks[id_event].push_back({callback, mod});
+    }
+}
+
+void Kernel::register_for_deferred_execute(Module *mod){
+    EventCallback callback= resolve_callback(ON_GCODE_EXECUTE, mod);
+    if(callback == nullptr) return;
+
+    this->deferred_execute_hooks.push_back({callback, mod});
+}
+
+void Kernel::call_deferred_execute(Gcode *gcode){
+    for (auto& h : deferred_execute_hooks) {
+        h.callback(h.module, gcode);
+    }
+}
+
+// Adds a route for one G or M code to the module's on_gcode_received
+void Kernel::register_for_gcode(Module *mod, char letter, uint16_t code){
+    EventCallback callback= resolve_callback(ON_GCODE_RECEIVED, mod);
+    if(callback == nullptr) return;
+
+    this->gcode_dispatch->add_subscriber(callback, mod, 0, letter, code);
+}
+
+// Adds a main loop hook after the others of the same priority
+void Kernel::register_for_main_loop(Module *mod, MainLoopPriority priority, const char *name){
+    EventCallback callback= resolve_callback(ON_MAIN_LOOP, mod);
+    if(callback == nullptr) return;
+
+    auto i= main_loop_hooks.begin();
+    while(i != main_loop_hooks.end() && i->priority <= priority) ++i;
+    MainLoopHook h;
+    h.callback= callback;
+    h.module= mod;
+    h.name= name;
+    h.priority= priority;
+#ifdef ISR_PROFILE
+    h.calls= h.max= 0;
+    h.total= 0;
+#endif
+    main_loop_hooks.insert(i, h);
 }
 
 // Call a specific event without arguments
 void Kernel::call_event(_EVENT_ENUM id_event){
-    for (auto m : hooks[id_event]) {
-        (m->*kernel_callback_functions[id_event])(this);
-    }
+    call_event(id_event, this);
 }
 
 // Call a specific event with an argument
 void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
-    for (auto m : hooks[id_event]) {
-        (m->*kernel_callback_functions[id_event])(argument);
+    if(id_event == ON_MAIN_LOOP) {
+        call_main_loop(argument);
+        return;
+    }
+
+    // the motors stop and the queue is emptied before any module hears of a halt, however long they then take over it
+    if(id_event == ON_HALT && argument == nullptr) conveyor->halt_motion();
+
+    auto& list= hooks[id_event];
+    if(list.empty() && id_event != ON_GCODE_RECEIVED) return;
+
+#ifdef ISR_PROFILE
+    uint32_t start= IsrProfiler::now();
+    uint32_t called= list.size();
+#endif
+
+    if(id_event == ON_GCODE_RECEIVED) {
+        // only the modules that asked for this gcode get it
+#ifdef ISR_PROFILE
+        called=
+#endif
+        this->gcode_dispatch->dispatch(static_cast<Gcode *>(argument));
+
+    } else if(id_event == ON_IDLE) {
+        for (auto& h : list) {
+            uint32_t t= us_ticker_read();
+            h.callback(h.module, argument);
+            loop_monitor->idle_handler(h.module, us_ticker_read() - t);
+        }
+
+    } else {
+        for (auto& h : list) {
+            h.callback(h.module, argument);
+        }
+    }
+
+#ifdef ISR_PROFILE
+    uint32_t cycles= IsrProfiler::now() - start;
+    EventStats& st= event_stats[id_event];
+    st.calls++;
+    st.handlers += called;
+    st.total += cycles;
+    if(cycles > st.max) st.max= cycles;
+#endif
+}
+
+// the feeders run first, then if the queue has only a few blocks left the housekeeping waits so the next loop
+// comes round sooner, an empty queue has nothing to starve so then everything runs
+void Kernel::call_main_loop(void *argument){
+#ifdef ISR_PROFILE
+    uint32_t start= IsrProfiler::now();
+    uint32_t called= 0;
+#endif
+
+    bool low= housekeeping_waits < MAX_HOUSEKEEPING_WAITS && conveyor->is_running_low();
+    if(low) housekeeping_waits++;
+    else housekeeping_waits= 0;
+
+    for (auto& h : main_loop_hooks) {
+        if(low && h.priority == MAIN_LOOP_HOUSEKEEPING) break;
+        uint32_t us= us_ticker_read();
+#ifdef ISR_PROFILE
+        uint32_t t= IsrProfiler::now();
+        h.callback(h.module, argument);
+        t= IsrProfiler::now() - t;
+        h.calls++;
+        h.total += t;
+        if(t > h.max) h.max= t;
+        called++;
+#else
+        h.callback(h.module, argument);
+#endif
+        loop_monitor->main_loop_handler(h.name, us_ticker_read() - us);
+    }
+
+#ifdef ISR_PROFILE
+    uint32_t cycles= IsrProfiler::now() - start;
+    EventStats& st= event_stats[ON_MAIN_LOOP];
+    st.calls++;
+    st.handlers += called;
+    st.total += cycles;
+    if(cycles > st.max) st.max= cycles;
+#endif
+}
+
+#ifdef ISR_PROFILE
+static const char * const event_names[NUMBER_OF_DEFINED_EVENTS]= {
+    "main_loop", "console_line", "gcode_received", "gcode_execute", "speed_change", "block_begin", "block_end",
+    "play", "pause", "idle", "second_tick", "get_public_data", "set_public_data", "halt"
+};
+
+void Kernel::dump_event_stats(StreamOutput *stream){
+    // copy first, printing fires ON_IDLE and friends which would change the numbers under us
+    std::array<EventStats, NUMBER_OF_DEFINED_EVENTS> st= event_stats;
+    stream->printf("event            hooks      calls   handlers   avg cyc   max cyc\r\n");
+    for (int i = 0; i < NUMBER_OF_DEFINED_EVENTS; ++i) {
+        unsigned int n= i == ON_MAIN_LOOP ? main_loop_hooks.size() : hooks[i].size();
+        stream->printf("%-15s %6u %10lu %10lu %9lu %9lu\r\n", event_names[i], n, st[i].calls, st[i].handlers,
+                       st[i].calls == 0 ? 0 : (uint32_t)(st[i].total / st[i].calls), st[i].max);
+    }
+
+    static const char * const priority_names[]= {"feed", "normal", "housekeeping"};
+    std::vector<MainLoopHook> ml= main_loop_hooks;
+    stream->printf("main loop      priority          calls   avg cyc   max cyc\r\n");
+    for (auto& h : ml) {
+        stream->printf("%-14s %-12s %10lu %9lu %9lu\r\n", h.name == nullptr ? "?" : h.name, priority_names[h.priority], h.calls,
+                       h.calls == 0 ? 0 : (uint32_t)(h.total / h.calls), h.max);
+    }
+}
+
+void Kernel::reset_event_stats(){
+    for (auto& st : event_stats) {
+        st= {0, 0, 0, 0};
+    }
+    for (auto& h : main_loop_hooks) {
+        h.calls= h.max= 0;
+        h.total= 0;
     }
 }
+#endif
@@ -31,6 +31,11 @@ class StepTicker;
 class Adc;
 class PublicData;
 class TemperatureControlPool;
+class MachineStatus;
+class RealtimeCommands;
+class StreamOutput;
+class LoopMonitor;
+class Gcode;
 
 class Kernel {
     public:
@@ -38,15 +43,32 @@ class Kernel {
         static Kernel* instance; // the Singleton instance of Kernel usable anywhere
         const char* config_override_filename(){ return "/sd/config-override"; }
 
-        void add_module(Module* module);
-        void register_for_event(_EVENT_ENUM id_event, Module *module);
+        // name is what the boottime command shows for how long the module took to load
+        void add_module(Module* module, const char *name = nullptr);
+        // the time taken by one step of starting up, for the boottime command
+        void add_boot_time(const char *name, uint32_t us);
+        const char *module_name(const Module *module) const;
+        void dump_boot_times(StreamOutput *stream);
+        void register_for_event(_EVENT_ENUM id_event, Module *module, uint8_t gcode_filter= GCODE_FILTER_ALL);
+        void register_for_gcode(Module *module, char letter, uint16_t code);
+        void register_for_main_loop(Module *module, MainLoopPriority priority, const char *name);
+        void register_for_deferred_execute(Module *module);
+        bool has_deferred_execute() const { return !deferred_execute_hooks.empty(); }
+        // ON_GCODE_EXECUTE for the modules that asked to have it in the main loop, see Conveyor::on_idle
+        void call_deferred_execute(Gcode *gcode);
         void call_event(_EVENT_ENUM id_event);
         void call_event(_EVENT_ENUM id_event, void * argument);
 
+#ifdef ISR_PROFILE
+        void dump_event_stats(StreamOutput *stream);
+        void reset_event_stats();
+#endif
+
         // These modules are available to all other modules
         SerialConsole*    serial;
         StreamOutputPool* streams;
 
+        GcodeDispatch*    gcode_dispatch;
         Robot*            robot;
         Stepper*          stepper;
         Planner*          planner;
@@ -54,6 +76,9 @@ class Kernel {
         Conveyor*         conveyor;
         Pauser*           pauser;
         TemperatureControlPool* temperature_control_pool;
+        MachineStatus*    status;
+        LoopMonitor*      loop_monitor;
+        RealtimeCommands* realtime;       // nullptr until the core modules are loaded, the receive interrupts check
 
         int debug;
         SlowTicker*       slow_ticker;
@@ -66,7 +91,49 @@ class Kernel {
 
     private:
         // When a module asks to be called for a specific event ( a hook ), this is where that request is remembered
-        std::array<std::vector<Module*>, NUMBER_OF_DEFINED_EVENTS> hooks;
+        // the handler is looked up once here rather than through the vtable on every call
+        // ON_GCODE_RECEIVED is routed by GcodeDispatch instead
+        struct EventHook {
+            EventCallback callback;
+            Module *module;
+        };
+        std::array<std::vector<EventHook>, NUMBER_OF_DEFINED_EVENTS> hooks;
+        std::vector<EventHook> deferred_execute_hooks;
+
+        // ON_MAIN_LOOP has its own list, kept in priority order
+        struct MainLoopHook {
+            EventCallback callback;
+            Module *module;
+            const char *name;
+            MainLoopPriority priority;
+#ifdef ISR_PROFILE
+            uint32_t calls;
+            uint32_t max;
+            uint64_t total;
+#endif
+        };
+        std::vector<MainLoopHook> main_loop_hooks;
+
+        // in the order they finished, a module's time includes any modules it loads itself. The name is a copy, it
+        // may have been built for the call
+        struct BootTime {
+            std::string name;
+            const Module *module;
+            uint32_t us;
+        };
+        std::vector<BootTime> boot_times;
+        void call_main_loop(void *argument);
+        uint8_t housekeeping_waits;
+
+#ifdef ISR_PROFILE
+        struct EventStats {
+            uint32_t calls;     // times the event was fired
+            uint32_t handlers;  // module handlers actually called
+            uint32_t max;       // most cycles one call took, including anything it fired itself
+            uint64_t total;
+        };
+        std::array<EventStats, NUMBER_OF_DEFINED_EVENTS> event_stats;
+#endif
 
 };
 
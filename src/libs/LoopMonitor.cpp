@@ -0,0 +1,146 @@
+#include "LoopMonitor.h"
+#include "Kernel.h"
+#include "StreamOutput.h"
+#include "StreamOutputPool.h"
+#include "IsrProfiler.h"
+#include "us_ticker_api.h"
+#include "system_LPC17xx.h" // for SystemCoreClock
+
+LoopMonitor::LoopMonitor()
+{
+    warn_us= 0;
+    watchdog_ms= 0;
+    reset();
+}
+
+void LoopMonitor::reset()
+{
+    started= false;
+    passes= 0;
+    min_us= UINT32_MAX;
+    max_us= 0;
+    total_us= 0;
+    for (int i = 0; i < buckets; ++i) histogram[i]= 0;
+    max_main_name= nullptr;
+    max_main_us= 0;
+    max_idle_module= nullptr;
+    max_idle_us= 0;
+    pass_main_name= nullptr;
+    pass_idle_module= nullptr;
+    pass_handler_us= 0;
+    last_warn= 0;
+    second_passes= second_rate= 0;
+    cpu_load= 0;
+    isr_load= -1;
+}
+
+int LoopMonitor::bucket_of(uint32_t us)
+{
+    if(us < 32) return 0;
+    int b= 27 - __builtin_clz(us); // 32-63us is 1, 64-127us is 2 ...
+    return b < buckets ? b : buckets - 1;
+}
+
+void LoopMonitor::pass()
+{
+    uint32_t now= us_ticker_read();
+    if(!started) {
+        // the first pass starts timing, there is no pass before it to measure
+        started= true;
+        last_pass= second_start= now;
+#ifdef ISR_PROFILE
+        second_isr_cycles= IsrProfiler::total_cycles();
+#endif
+        return;
+    }
+
+    uint32_t us= now - last_pass;
+    passes++;
+    total_us += us;
+    if(us < min_us) min_us= us;
+    if(us > max_us) max_us= us;
+    histogram[bucket_of(us)]++;
+    second_passes++;
+    if(now - second_start >= 1000000) end_second(now);
+
+    if(warn_us > 0 && us > warn_us && now - last_warn > 1000000) {
+        // no more than one a second, and the time it takes to print is not put on the next pass
+        last_warn= now;
+        const char *name= pass_main_name;
+        if(pass_idle_module != nullptr) name= THEKERNEL->module_name(pass_idle_module);
+        THEKERNEL->streams->printf("main loop pass took %lums, the longest handler was %s %s at %luus\r\n",
+                                   us / 1000, pass_idle_module != nullptr ? "idle" : "main loop",
+                                   name == nullptr ? "?" : name, pass_handler_us);
+        now= us_ticker_read();
+    }
+
+    pass_main_name= nullptr;
+    pass_idle_module= nullptr;
+    pass_handler_us= 0;
+    last_pass= now;
+}
+
+void LoopMonitor::end_second(uint32_t now)
+{
+    uint32_t wall= now - second_start;
+    uint64_t idle= (uint64_t)second_passes * min_us;
+    cpu_load= idle >= wall ? 0 : 100 - (idle * 100 / wall);
+#ifdef ISR_PROFILE
+    uint64_t cycles= IsrProfiler::total_cycles();
+    // prof -r starts the counts again
+    uint64_t spent= cycles >= second_isr_cycles ? cycles - second_isr_cycles : cycles;
+    uint64_t isr= spent * 100 / ((uint64_t)wall * (SystemCoreClock / 1000000));
+    isr_load= isr > 100 ? 100 : isr;
+    second_isr_cycles= cycles;
+#endif
+    second_rate= (uint64_t)second_passes * 1000000 / wall;
+    second_passes= 0;
+    second_start= now;
+}
+
+void LoopMonitor::main_loop_handler(const char *name, uint32_t us)
+{
+    if(us > max_main_us) {
+        max_main_us= us;
+        max_main_name= name;
+    }
+    if(us > pass_handler_us) {
+        pass_handler_us= us;
+        pass_main_name= name;
+        pass_idle_module= nullptr;
+    }
+}
+
+// ON_IDLE is also called by anything waiting in the main loop, so a handler's time includes any waits it did itself
+void LoopMonitor::idle_handler(const Module *module, uint32_t us)
+{
+    if(us > max_idle_us) {
+        max_idle_us= us;
+        max_idle_module= module;
+    }
+    if(us > pass_handler_us) {
+        pass_handler_us= us;
+        pass_idle_module= module;
+    }
+}
+
+void LoopMonitor::dump(StreamOutput *stream) const
+{
+    if(passes == 0) {
+        stream->printf("no main loop passes timed yet\r\n");
+        return;
+    }
+    stream->printf("main loop passes: %lu, min %luus, avg %luus, max %luus\r\n", passes, min_us, (uint32_t)(total_us / passes), max_us);
+    for (int i = 0; i < buckets; ++i) {
+        if(histogram[i] == 0) continue;
+        if(i == 0) stream->printf("  under 32us: %lu\r\n", histogram[i]);
+        else if(i == buckets - 1) stream->printf("  %luus and over: %lu\r\n", 16UL << i, histogram[i]);
+        else stream->printf("  %lu-%luus: %lu\r\n", 16UL << i, (32UL << i) - 1, histogram[i]);
+    }
+
+    const char *idle_name= max_idle_module == nullptr ? nullptr : THEKERNEL->module_name(max_idle_module);
+    stream->printf("longest main loop handler: %s %luus\r\n", max_main_name == nullptr ? "?" : max_main_name, max_main_us);
+    stream->printf("longest idle handler: %s %luus\r\n", idle_name == nullptr ? "?" : idle_name, max_idle_us);
+    if(watchdog_ms > 0) stream->printf("watchdog timeout: %lums, longest pass is %lu%% of it\r\n", watchdog_ms, max_us / 10 / watchdog_ms);
+    if(warn_us > 0) stream->printf("passes over %lums are reported\r\n", warn_us / 1000);
+}
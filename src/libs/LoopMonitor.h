@@ -0,0 +1,69 @@
+#ifndef _LOOPMONITOR_H_
+#define _LOOPMONITOR_H_
+
+#include <stdint.h>
+
+class Module;
+class StreamOutput;
+
+// How long each pass of the main loop takes, from the start of one to the start of the next, and which handler of
+// ON_MAIN_LOOP and ON_IDLE took the longest. A line that comes in waits on average half a pass before it is looked at,
+// so this is what decides how quickly serial lines get processed.
+// main() calls pass() at the top of each pass, the kernel times the handlers as it calls them
+class LoopMonitor {
+    public:
+        LoopMonitor();
+
+        void pass();
+        void main_loop_handler(const char *name, uint32_t us);
+        void idle_handler(const Module *module, uint32_t us);
+
+        // a pass longer than this is reported on the console, 0 for never
+        void set_warn_us(uint32_t us) { warn_us= us; }
+        void set_watchdog_ms(uint32_t ms) { watchdog_ms= ms; }
+        void dump(StreamOutput *stream) const;
+        void reset();
+
+        // how busy the cpu was over the last whole second, in percent. The shortest pass seen is taken to be the loop
+        // going round with nothing to do, so the rest of the time the loop took, and all the interrupts, is busy.
+        // The interrupt share needs ISR_PROFILE and is -1 without it
+        int get_cpu_load() const { return cpu_load; }
+        int get_isr_load() const { return isr_load; }
+        uint32_t get_passes_per_second() const { return second_rate; }
+        uint32_t get_idle_pass_us() const { return passes == 0 ? 0 : min_us; }
+
+        // a bucket for each doubling of the period from 32us, the last is everything longer
+        static const int buckets= 12;
+
+    private:
+        static int bucket_of(uint32_t us);
+        void end_second(uint32_t now);
+
+        uint32_t last_pass;         // us_ticker_read at the start of this pass
+        uint32_t passes;
+        uint32_t min_us, max_us;
+        uint64_t total_us;
+        uint32_t histogram[buckets];
+
+        // the slowest handler of all the passes, and the slowest of this pass for the warning
+        const char *max_main_name;
+        uint32_t max_main_us;
+        const Module *max_idle_module;
+        uint32_t max_idle_us;
+        const char *pass_main_name;
+        const Module *pass_idle_module;
+        uint32_t pass_handler_us;
+
+        uint32_t second_start;
+        uint32_t second_passes;
+        uint32_t second_rate;
+        uint64_t second_isr_cycles; // IsrProfiler::total_cycles() at second_start
+        int8_t cpu_load, isr_load;
+
+        uint32_t warn_us;
+        uint32_t last_warn;
+        uint32_t watchdog_ms;
+        bool started;
+};
+
+#endif
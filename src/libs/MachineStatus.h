@@ -0,0 +1,64 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MACHINESTATUS_H
+#define MACHINESTATUS_H
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+// A snapshot of what the panel shows, written by the module that owns each part, once a second for the values that
+// change all the time. Reading it is a plain load where a PublicData request would go to every module.
+class MachineStatus {
+    public:
+        struct Heater {
+            uint16_t id;                    // name checksum of the temperature control
+            char designator[4];
+            float current_temperature;
+            float target_temperature;       // 0 when off
+        };
+        static const uint8_t max_heaters = 8;
+
+        MachineStatus() : speed_override(100.0F), heater_count(0), playing_file(nullptr), elapsed_secs(0), percent_complete(0), remaining_secs(0), ip(nullptr), fan_on(false) {
+            position[0] = position[1] = position[2] = 0.0F;
+        }
+
+        // a heater's slot, for as long as the status exists, nullptr if there are too many heaters
+        Heater *add_heater(uint16_t id, const std::string& designator) {
+            Heater *h = find_heater(id);
+            if(h == nullptr) {
+                if(heater_count == max_heaters) return nullptr;
+                h = &heaters[heater_count++];
+                h->id = id;
+                h->current_temperature = h->target_temperature = 0.0F;
+            }
+            strncpy(h->designator, designator.c_str(), sizeof(h->designator) - 1);
+            h->designator[sizeof(h->designator) - 1] = '\0';
+            return h;
+        }
+
+        Heater *find_heater(uint16_t id) {
+            for (uint8_t i = 0; i < heater_count; ++i) {
+                if(heaters[i].id == id) return &heaters[i];
+            }
+            return nullptr;
+        }
+
+        float position[3];                  // last planned position, in the current units
+        float speed_override;               // percent
+        Heater heaters[max_heaters];
+        uint8_t heater_count;
+        const std::string *playing_file;    // nullptr unless a file is being played
+        unsigned long elapsed_secs;
+        unsigned int percent_complete;
+        unsigned long remaining_secs;      // estimated motion time left, 0 if not known yet
+        const uint8_t *ip;                  // nullptr without a network
+        bool fan_on;
+};
+
+#endif
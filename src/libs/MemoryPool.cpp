@@ -16,15 +16,25 @@ typedef struct __attribute__ ((packed))
 } _poolregion;
 
 MemoryPool* MemoryPool::first = NULL;
+uintptr_t MemoryPool::lowest = UINTPTR_MAX;
+uintptr_t MemoryPool::highest = 0;
 
 MemoryPool::MemoryPool(void* base, uint16_t size)
 {
     this->base = base;
     this->size = size;
+    this->used = 0;
+    this->peak = 0;
 
     ((_poolregion*) base)->used = 0;
     ((_poolregion*) base)->next = size;
 
+    // the range only ever grows, a pool that is destroyed leaves deletes in its range to walk the list
+    if ((uintptr_t) base < lowest)
+        lowest = (uintptr_t) base;
+    if ((uintptr_t) base + size > highest)
+        highest = (uintptr_t) base + size;
+
     // insert ourselves into head of LL
     next = first;
     first = this;
@@ -100,6 +110,10 @@ void* MemoryPool::alloc(size_t nbytes)
                 }
             }
 
+            used += p->next;
+            if (used > peak)
+                peak = used;
+
             // then return the data region for the block
             return &p->data;
         }
@@ -118,6 +132,7 @@ void MemoryPool::dealloc(void* d)
 {
     _poolregion* p = (_poolregion*) (((uint8_t*) d) - sizeof(_poolregion));
     p->used = 0;
+    used -= p->next;
 
     MDEBUG("\tdeallocating %p (%+d, %db)\n", p, offset(p), p->next);
 
@@ -193,7 +208,7 @@ void MemoryPool::debug(StreamOutput* str)
             free += p->next;
         if ((offset(p) + p->next >= size) || (p->next <= sizeof(_poolregion)))
         {
-            str->printf("End: total %lub, free: %lub\n", tot, free);
+            str->printf("End: total %lub, free: %lub, peak used: %ub\n", tot, free, peak);
             return;
         }
         p = (_poolregion*) (((uint8_t*) p) + p->next);
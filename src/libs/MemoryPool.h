@@ -28,19 +28,30 @@ public:
     void* alloc(size_t);
     void  dealloc(void* p);
 
+    // storage for n objects of T, they are not constructed
+    template<typename T> T* alloc(size_t n) { return static_cast<T*>(alloc(n * sizeof(T))); }
+
     void  debug(StreamOutput*);
 
     bool  has(void*);
 
     uint32_t free(void);
+    uint32_t get_peak(void) const { return peak; }
 
     MemoryPool* next;
 
     static MemoryPool* first;
 
+    // the lowest and highest address of any pool, anything outside came from the heap
+    // NOTE these are integers so they are set before the AHB pools are made in _start, and not by a static constructor after
+    static uintptr_t lowest;
+    static uintptr_t highest;
+
 private:
     void* base;
     uint16_t size;
+    uint16_t used;      // bytes in used chunks, including their headers
+    uint16_t peak;
 };
 
 // this overloads "placement new"
@@ -57,8 +68,15 @@ inline void  operator delete(void* p, MemoryPool& pool)
 
 // this catches all usages of delete blah. The object's destructor is called before we get here
 // it first checks if the deleted object is part of a pool, and uses free otherwise.
+// The pools are all in the AHB banks and the heap is not, so most deletes are decided by the address range alone
 inline void  operator delete(void* p)
 {
+    if ((uintptr_t) p < MemoryPool::lowest || (uintptr_t) p >= MemoryPool::highest)
+    {
+        free(p);
+        return;
+    }
+
     MemoryPool* m = MemoryPool::first;
     while (m)
     {
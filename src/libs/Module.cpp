@@ -32,8 +32,22 @@ const ModuleCallback kernel_callback_functions[NUMBER_OF_DEFINED_EVENTS] = {
 };
 
 
-void Module::register_for_event(_EVENT_ENUM event_id){
+void Module::register_for_event(_EVENT_ENUM event_id, uint8_t gcode_filter){
     // Events are the basic building blocks of Smoothie. They register for events, and then do stuff when those events are called.
     // You add things to Smoothie by making a new class that inherits the Module class. See http://smoothieware.org/moduleexample for a crude introduction
-    THEKERNEL->register_for_event(event_id, this);
+    THEKERNEL->register_for_event(event_id, this, gcode_filter);
+}
+
+void Module::register_for_main_loop(MainLoopPriority priority, const char *name){
+    THEKERNEL->register_for_main_loop(this, priority, name);
+}
+
+void Module::register_for_deferred_execute(){
+    THEKERNEL->register_for_deferred_execute(this);
+}
+
+void Module::register_for_gcodes(char letter, std::initializer_list<uint16_t> codes){
+    for (auto c : codes) {
+        THEKERNEL->register_for_gcode(this, letter, c);
+    }
 }
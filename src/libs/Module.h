@@ -8,6 +8,9 @@
 #ifndef MODULE_H
 #define MODULE_H
 
+#include <stdint.h>
+#include <initializer_list>
+
 // See : http://smoothieware.org/listofevents
 // When adding a new event the virtual method needs to be defined in class Module and the method pointer need to be defined in
 // Module.cpp:16 in the same order
@@ -29,8 +32,24 @@ enum _EVENT_ENUM {
     NUMBER_OF_DEFINED_EVENTS
 };
 
+// which gcodes a module registered for ON_GCODE_RECEIVED wants to be called with
+#define GCODE_FILTER_G      0x01
+#define GCODE_FILTER_M      0x02
+#define GCODE_FILTER_OTHER  0x04    // anything with neither a G nor an M, like T codes
+#define GCODE_FILTER_ALL    0x07
+
+// the order ON_MAIN_LOOP handlers run in, see Kernel::call_event
+// housekeeping is put off for a few loops while the block queue is running low, so the feeders get the time
+enum MainLoopPriority {
+    MAIN_LOOP_FEED,         // reads gcode and keeps the planner fed
+    MAIN_LOOP_NORMAL,
+    MAIN_LOOP_HOUSEKEEPING  // display and the like, can wait a little
+};
+
 class Module;
 typedef void (Module::*ModuleCallback)(void *argument);
+// what a ModuleCallback resolves to for one particular module, see Kernel::register_for_event
+typedef void (*EventCallback)(Module *module, void *argument);
 extern const ModuleCallback kernel_callback_functions[NUMBER_OF_DEFINED_EVENTS];
 
 // Module base class
@@ -42,7 +61,16 @@ public:
     virtual ~Module();
     virtual void on_module_loaded() {};
 
-    void register_for_event(_EVENT_ENUM event_id);
+    // gcode_filter is only used for ON_GCODE_RECEIVED
+    void register_for_event(_EVENT_ENUM event_id, uint8_t gcode_filter= GCODE_FILTER_ALL);
+    // only get on_gcode_received for these codes, use instead of registering for ON_GCODE_RECEIVED
+    void register_for_gcodes(char letter, std::initializer_list<uint16_t> codes);
+    // instead of registering for ON_MAIN_LOOP, name is what the profiling reports it as
+    void register_for_main_loop(MainLoopPriority priority, const char *name);
+    // instead of registering for ON_GCODE_EXECUTE, on_gcode_execute is called from the main loop soon after the block
+    // the gcode is attached to has started, rather than from the interrupt that starts it. For modules whose gcodes
+    // don't change how the block itself moves
+    void register_for_deferred_execute();
 
     // event callbacks, not every module will implement all of these
     // there should be one for each _EVENT_ENUM
@@ -7,6 +7,7 @@
 #include <cstdio>
 
 #include "lpc17xx_clkpwr.h"
+#include "platform_memory.h"
 
 #include <mri.h>
 
@@ -157,11 +158,22 @@ int32_t emac_SetPHYMode(uint32_t ulPHYMode)
     return (0);
 }
 
-_rxbuf_t LPC17XX_Ethernet::rxbuf __attribute__ ((section ("AHBSRAM1"))) __attribute__((aligned(8)));
-_txbuf_t LPC17XX_Ethernet::txbuf __attribute__ ((section ("AHBSRAM1"))) __attribute__((aligned(8)));
-
 LPC17XX_Ethernet* LPC17XX_Ethernet::instance;
 
+// the EMAC DMA can only reach the AHB SRAM banks
+static void *alloc_dma(size_t n)
+{
+    void *p = AHB1.alloc(n);
+    if (p == NULL) p = AHB0.alloc(n);
+    return p;
+}
+
+static void free_dma(void *p)
+{
+    if (AHB1.has(p)) AHB1.dealloc(p);
+    else if (AHB0.has(p)) AHB0.dealloc(p);
+}
+
 LPC17XX_Ethernet::LPC17XX_Ethernet()
 {
     // TODO these need to be configurable
@@ -175,20 +187,13 @@ LPC17XX_Ethernet::LPC17XX_Ethernet()
     // ip_address = IPA(192,168,3,222);
     // ip_mask = 0xFFFFFF00;
 
-    for (int i = 0; i < LPC17XX_RXBUFS; i++) {
-        rxbuf.rxdesc[i].packet = rxbuf.buf[i];
-        rxbuf.rxdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_RCTRL_INT;
-
-        rxbuf.rxstat[i].Info = 0;
-        rxbuf.rxstat[i].HashCRC = 0;
-    }
-
-    for (int i = 0; i < LPC17XX_TXBUFS; i++) {
-        txbuf.txdesc[i].packet = txbuf.buf[i];
-        txbuf.txdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_TCTRL_PAD | EMAC_TCTRL_CRC | EMAC_TCTRL_LAST | EMAC_TCTRL_INT;
-
-        txbuf.txstat[i].Info = 0;
-    }
+    rx_buffers = tx_buffers = NULL;
+    rxdesc = txdesc = NULL;
+    rxstat = NULL;
+    txstat = NULL;
+    rx_count = tx_count = 0;
+    rx_dropped = rx_ring_full = 0;
+    rx_fragments = false;
 
     interface_name = (uint8_t*) malloc(5);
     memcpy(interface_name, "eth0", 5);
@@ -198,6 +203,45 @@ LPC17XX_Ethernet::LPC17XX_Ethernet()
     up = false;
 }
 
+bool LPC17XX_Ethernet::alloc_buffers(int rx, int tx)
+{
+    // the buffers are a multiple of 4 bytes, as the pools hand out, the rx status words must be 8 byte aligned
+    size_t ctrl_size = rx * (sizeof(RX_Stat) + sizeof(packet_desc)) + tx * (sizeof(TX_Stat) + sizeof(packet_desc)) + 4;
+    uint8_t *ctrl = (uint8_t *)alloc_dma(ctrl_size);
+    rx_buffers = (uint8_t *)alloc_dma(rx * LPC17XX_MAX_PACKET);
+    tx_buffers = (uint8_t *)alloc_dma(tx * LPC17XX_MAX_PACKET);
+    if (ctrl == NULL || rx_buffers == NULL || tx_buffers == NULL) {
+        free_dma(ctrl);
+        free_dma(rx_buffers);
+        free_dma(tx_buffers);
+        rx_buffers = tx_buffers = NULL;
+        return false;
+    }
+
+    rxstat = (RX_Stat *)(((uint32_t)ctrl + 7) & ~7);
+    rxdesc = (packet_desc *)(rxstat + rx);
+    txdesc = rxdesc + rx;
+    txstat = (TX_Stat *)(txdesc + tx);
+    rx_count = rx;
+    tx_count = tx;
+
+    for (int i = 0; i < rx_count; i++) {
+        rxdesc[i].packet = rx_buffers + i * LPC17XX_MAX_PACKET;
+        rxdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_RCTRL_INT;
+
+        rxstat[i].Info = 0;
+        rxstat[i].HashCRC = 0;
+    }
+
+    for (int i = 0; i < tx_count; i++) {
+        txdesc[i].packet = tx_buffers + i * LPC17XX_MAX_PACKET;
+        txdesc[i].control = (LPC17XX_MAX_PACKET - 1) | EMAC_TCTRL_PAD | EMAC_TCTRL_CRC | EMAC_TCTRL_LAST | EMAC_TCTRL_INT;
+
+        txstat[i].Info = 0;
+    }
+    return true;
+}
+
 void LPC17XX_Ethernet::on_module_loaded()
 {
     LPC_PINCON->PINSEL2 = (1 << 0) | (1 << 2) | (1 << 8) | (1 << 16) | (1 << 18) | (1 << 20) | (1 << 28) | (1 << 30);
@@ -347,13 +391,13 @@ void LPC17XX_Ethernet::emac_init()
     setEmacAddr(mac_address);
 
     /* Initialize Tx and Rx DMA Descriptors */
-    LPC_EMAC->RxDescriptor       = (uint32_t) rxbuf.rxdesc;
-    LPC_EMAC->RxStatus           = (uint32_t) rxbuf.rxstat;
-    LPC_EMAC->RxDescriptorNumber = LPC17XX_RXBUFS-1;
+    LPC_EMAC->RxDescriptor       = (uint32_t) rxdesc;
+    LPC_EMAC->RxStatus           = (uint32_t) rxstat;
+    LPC_EMAC->RxDescriptorNumber = rx_count-1;
 
-    LPC_EMAC->TxDescriptor       = (uint32_t) txbuf.txdesc;
-    LPC_EMAC->TxStatus           = (uint32_t) txbuf.txstat;
-    LPC_EMAC->TxDescriptorNumber = LPC17XX_TXBUFS-1;
+    LPC_EMAC->TxDescriptor       = (uint32_t) txdesc;
+    LPC_EMAC->TxStatus           = (uint32_t) txstat;
+    LPC_EMAC->TxDescriptorNumber = tx_count-1;
 
     // Set Receive Filter register: enable broadcast and multicast
     LPC_EMAC->RxFilterCtrl = EMAC_RFC_BCAST_EN | EMAC_RFC_PERFECT_EN;
@@ -376,36 +420,6 @@ void LPC17XX_Ethernet::set_mac(uint8_t* newmac)
     memcpy(mac_address, newmac, 6);
 }
 
-// size must be preloaded with max size of packet buffer
-bool LPC17XX_Ethernet::_receive_frame(void *packet, int *size)
-{
-    if (can_read_packet() && can_write_packet())
-    {
-        int i = LPC_EMAC->RxConsumeIndex;
-        RX_Stat* stat = &(rxbuf.rxstat[i]);
-        int len = (stat->Info & EMAC_RINFO_SIZE) + 1; //this is the index so add one to get the size
-        if(len <= *size) { // check against recieving buffer length
-            memcpy(packet, rxbuf.buf[i], len);
-            *size= len;
-        }else{
-            // discard frame that is too big for input buffer
-            DEBUG_PRINTF("WARNING: Discarded ethernet frame that is too big: %08lX, %d - %d\n", stat->Info, len, *size);
-            *size= 0;
-        }
-
-        //DEBUG_PRINTF("Received %d byte Ethernet frame %lu/%lu\n", *size, LPC_EMAC->RxProduceIndex, LPC_EMAC->RxConsumeIndex);
-
-        uint32_t r = LPC_EMAC->RxConsumeIndex + 1;
-        if (r > LPC_EMAC->RxDescriptorNumber)
-            r = 0;
-        LPC_EMAC->RxConsumeIndex = r;
-
-        return *size > 0;
-    }
-
-    return false;
-}
-
 void LPC17XX_Ethernet::irq()
 {
     // if (EMAC_IntGetStatus(EMAC_INT_RX_DONE))
@@ -425,8 +439,33 @@ bool LPC17XX_Ethernet::can_read_packet()
 
 int LPC17XX_Ethernet::read_packet(uint8_t** buf)
 {
-    *buf = rxbuf.buf[LPC_EMAC->RxConsumeIndex];
-    return rxbuf.rxstat[LPC_EMAC->RxConsumeIndex].Info & EMAC_RINFO_SIZE;
+    if (LPC_EMAC->IntStatus & EMAC_INT_RX_FIN) {
+        // the EMAC ran out of descriptors, anything that arrived after that was lost
+        LPC_EMAC->IntClear = EMAC_INT_RX_FIN;
+        rx_ring_full++;
+    }
+
+    while (can_read_packet()) {
+        int i = LPC_EMAC->RxConsumeIndex;
+        uint32_t info = rxstat[i].Info;
+
+        if (rx_fragments || (info & EMAC_RINFO_LAST_FLAG) == 0) {
+            // a frame too big for one buffer is spread over several, none of them is any use
+            rx_fragments = (info & EMAC_RINFO_LAST_FLAG) == 0;
+            if (!rx_fragments) rx_dropped++;
+            release_read_packet(NULL);
+            continue;
+        }
+        if (info & (EMAC_RINFO_CRC_ERR | EMAC_RINFO_SYM_ERR | EMAC_RINFO_ALIGN_ERR | EMAC_RINFO_OVERRUN)) {
+            rx_dropped++;
+            release_read_packet(NULL);
+            continue;
+        }
+
+        *buf = (uint8_t *)rxdesc[i].packet;
+        return (info & EMAC_RINFO_SIZE) + 1; // this is the index so add one to get the size
+    }
+    return 0;
 }
 
 void LPC17XX_Ethernet::release_read_packet(uint8_t*)
@@ -437,6 +476,12 @@ void LPC17XX_Ethernet::release_read_packet(uint8_t*)
     LPC_EMAC->RxConsumeIndex = r;
 }
 
+void LPC17XX_Ethernet::drop_read_packet(uint8_t* buf)
+{
+    rx_dropped++;
+    release_read_packet(buf);
+}
+
 bool LPC17XX_Ethernet::can_write_packet()
 {
     uint32_t r = LPC_EMAC->TxProduceIndex + 1;
@@ -447,7 +492,7 @@ bool LPC17XX_Ethernet::can_write_packet()
 
 int LPC17XX_Ethernet::write_packet(uint8_t* buf, int size)
 {
-    txbuf.txdesc[LPC_EMAC->TxProduceIndex].control = ((size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
+    txdesc[LPC_EMAC->TxProduceIndex].control = ((size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
 
     uint32_t r = LPC_EMAC->TxProduceIndex + 1;
     if (r > LPC_EMAC->TxDescriptorNumber)
@@ -463,7 +508,7 @@ int LPC17XX_Ethernet::write_packet(uint8_t* buf, int size)
 
 void* LPC17XX_Ethernet::request_packet_buffer()
 {
-    return txbuf.txdesc[LPC_EMAC->TxProduceIndex].packet;
+    return txdesc[LPC_EMAC->TxProduceIndex].packet;
 }
 
 NET_PACKET  LPC17XX_Ethernet::get_new_packet_buffer(NetworkInterface* ni)
@@ -481,11 +526,11 @@ NET_PAYLOAD LPC17XX_Ethernet::get_payload_buffer(NET_PACKET packet)
 
 void LPC17XX_Ethernet::set_payload_length(NET_PACKET packet, int length)
 {
-    uint32_t offset = ((uint8_t*) packet) - txbuf.buf[0];
+    uint32_t offset = ((uint8_t*) packet) - tx_buffers;
     int i = (offset / LPC17XX_MAX_PACKET);
-    if ((i < LPC17XX_TXBUFS) && ((offset % LPC17XX_MAX_PACKET) == 0))
+    if ((i < tx_count) && ((offset % LPC17XX_MAX_PACKET) == 0))
     {
-        txbuf.txdesc[i].control = (txbuf.txdesc[i].control & ~EMAC_TCTRL_SIZE) | (length & EMAC_TCTRL_SIZE);
+        txdesc[i].control = (txdesc[i].control & ~EMAC_TCTRL_SIZE) | (length & EMAC_TCTRL_SIZE);
     }
 }
 
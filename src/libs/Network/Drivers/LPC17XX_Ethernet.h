@@ -12,26 +12,16 @@
 #define EMAC_PHY_REG_SCSR 0x1F
 
 #define LPC17XX_MAX_PACKET 600
-#define LPC17XX_TXBUFS     4
-#define LPC17XX_RXBUFS     4
+// the default and the range of the number of descriptors in each ring
+#define LPC17XX_DEFAULT_BUFS 4
+#define LPC17XX_MIN_BUFS     2
+#define LPC17XX_MAX_BUFS     16
 
 typedef struct {
     void* packet;
     uint32_t control;
 } packet_desc;
 
-typedef struct {
-    uint8_t buf[LPC17XX_RXBUFS][LPC17XX_MAX_PACKET];
-    RX_Stat rxstat[LPC17XX_RXBUFS];
-    packet_desc rxdesc[LPC17XX_RXBUFS];
-} _rxbuf_t;
-
-typedef struct {
-    uint8_t buf[LPC17XX_TXBUFS][LPC17XX_MAX_PACKET];
-    TX_Stat txstat[LPC17XX_TXBUFS];
-    packet_desc txdesc[LPC17XX_TXBUFS];
-} _txbuf_t;
-
 class LPC17XX_Ethernet;
 
 class LPC17XX_Ethernet : public Module, public NetworkInterface
@@ -49,11 +39,20 @@ public:
 
     void irq(void);
 
-    bool _receive_frame(void *packet, int* size);
+    // must be called before the module is loaded, false if there is not enough AHB SRAM for them
+    bool alloc_buffers(int rx, int tx);
+    int get_rx_count() const { return rx_count; }
+    int get_tx_count() const { return tx_count; }
+
+    // frames that were received but could not be used, and times the rx ring filled up so the EMAC had to drop frames
+    uint32_t get_rx_dropped() const { return rx_dropped; }
+    uint32_t get_rx_ring_full() const { return rx_ring_full; }
+    void drop_read_packet(uint8_t*);
 
     // NetworkInterface methods
 //     void provide_net(netcore* n);
     bool can_read_packet(void);
+    // the next good frame, left in place in its rx buffer until release_read_packet(), 0 if there is none
     int read_packet(uint8_t**);
     void release_read_packet(uint8_t*);
     void periodical(int);
@@ -70,13 +69,25 @@ public:
     NET_PAYLOAD get_payload_buffer(NET_PACKET);
     void        set_payload_length(NET_PACKET, int);
 
+    // reads the PHY and updates isUp(), done every second anyway
+    void check_interface();
+
     static LPC17XX_Ethernet* instance;
 
 private:
-    static _rxbuf_t rxbuf;
-    static _txbuf_t txbuf;
-
-    void check_interface();
+    // the rings, in AHB SRAM where the EMAC DMA can get at them
+    uint8_t *rx_buffers;
+    uint8_t *tx_buffers;
+    packet_desc *rxdesc;
+    packet_desc *txdesc;
+    RX_Stat *rxstat;
+    TX_Stat *txstat;
+    uint8_t rx_count;
+    uint8_t tx_count;
+
+    uint32_t rx_dropped;
+    uint32_t rx_ring_full;
+    bool rx_fragments;
 };
 
 #endif /* _LPC17XX_ETHERNET_H */
@@ -1,5 +1,6 @@
 #include "CallbackStream.h"
 #include "Kernel.h"
+#include "CommandQueue.h"
 #include <stdio.h>
 
 #include "SerialConsole.h"
@@ -12,6 +13,8 @@ CallbackStream::CallbackStream(cb_t cb, void *u)
     user= u;
     closed= false;
     use_count= 0;
+    outlen= 0;
+    pending_done= 0;
 }
 
 CallbackStream::~CallbackStream()
@@ -19,13 +22,9 @@ CallbackStream::~CallbackStream()
     DEBUG_PRINTF("Callbackstream dtor: %p\n", this);
 }
 
-int CallbackStream::puts(const char *s)
+// false if the connection could not take it and we were not to wait
+bool CallbackStream::deliver(const char *s, bool wait)
 {
-    if(closed) return 0;
-
-    if(s == NULL) return (*callback)(NULL, user);
-
-    int len = strlen(s);
     int n;
     do {
         // call this streams result callback
@@ -34,18 +33,99 @@ int CallbackStream::puts(const char *s)
         // if closed just pretend we sent it
         if(n == -1) {
             closed= true;
-            return len;
+            return true;
 
         }else if(n == 0) {
+            if(!wait) return false;
             // if output queue is full
             // call idle until we can output more
             THEKERNEL->call_event(ON_IDLE);
         }
     } while(n == 0);
 
+    return true;
+}
+
+int CallbackStream::puts(const char *s)
+{
+    if(closed) return 0;
+
+    if(s == NULL) {
+        // the command is done, while another from this connection is queued its output can wait for that one's
+        if(use_count > 1) {
+            pending_done++;
+            return 0;
+        }
+        if(outlen > 0) {
+            deliver(outbuf, true);
+            outlen= 0;
+        }
+        for (; pending_done > 0 && !closed; pending_done--) (*callback)(NULL, user);
+        return closed ? 0 : (*callback)(NULL, user);
+    }
+
+    int len = strlen(s);
+    if(use_count > 0 && len < coalesce_size) {
+        if(outlen + len >= coalesce_size) {
+            deliver(outbuf, true);
+            outlen= 0;
+        }
+        memcpy(&outbuf[outlen], s, len + 1);
+        outlen += len;
+        return len;
+    }
+
+    // not part of a queued command, or too big to hold, anything held back has to go first
+    if(outlen > 0) {
+        deliver(outbuf, true);
+        outlen= 0;
+    }
+    deliver(s, true);
     return len;
 }
 
+// a congested connection holds the line back with any command output, flush sends it on the next poll,
+// and once that is full too the line is dropped rather than waiting for the connection
+int CallbackStream::broadcast(const char *s)
+{
+    if(closed) return 0;
+
+    int len = strlen(s);
+    if(outlen > 0 && deliver(outbuf, false)) outlen= 0;
+    if(outlen == 0 && deliver(s, false)) return len;
+
+    if(outlen + len < coalesce_size) {
+        memcpy(&outbuf[outlen], s, len + 1);
+        outlen += len;
+        return len;
+    }
+    broadcast_drops++;
+    return 0;
+}
+
+void CallbackStream::flush()
+{
+    if(closed) return;
+    if(outlen > 0) {
+        if(!deliver(outbuf, false)) return;
+        outlen= 0;
+    }
+    for (; pending_done > 0 && !closed; pending_done--) (*callback)(NULL, user);
+}
+
+// TCP takes care of the bytes, what limits a telnet host is the command queue, which all connections share
+int CallbackStream::rx_free(bool lines)
+{
+    if(!lines) return -1;
+    int n= COMMAND_QUEUE_HIGH_WATER - CommandQueue::getInstance()->size();
+    return n < 0 ? 0 : n;
+}
+
+int CallbackStream::rx_capacity(bool lines)
+{
+    return lines ? COMMAND_QUEUE_HIGH_WATER : -1;
+}
+
 void CallbackStream::mark_closed()
 {
     closed= true;
@@ -62,6 +142,11 @@ extern "C" void *new_callback_stream(cb_t cb, void *u)
     return new CallbackStream(cb, u);
 }
 
+extern "C" void flush_callback_stream(void *p)
+{
+    ((CallbackStream*)p)->flush();
+}
+
 extern "C" void delete_callback_stream(void *p)
 {
     // we don't delete it in case it is still on the command queue
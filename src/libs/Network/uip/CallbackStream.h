@@ -5,6 +5,7 @@ typedef int (*cb_t)(const char *, void *);
 
 #ifdef __cplusplus
 #include "libs/StreamOutput.h"
+#include <stdint.h>
 
 
 class CallbackStream : public StreamOutput {
@@ -12,22 +13,37 @@ class CallbackStream : public StreamOutput {
         CallbackStream(cb_t cb, void *u);
         virtual ~CallbackStream();
         int puts(const char*);
+        int broadcast(const char*);
+        // send what has been held back, without waiting if the connection can't take it yet
+        void flush();
+        int rx_free(bool lines);
+        int rx_capacity(bool lines);
         void inc() { use_count++; }
         void dec();
         int get_count() { return use_count; }
         void mark_closed();
 
     private:
+        bool deliver(const char *s, bool wait);
+
         cb_t callback;
         void *user;
         bool closed;
         int use_count;
+
+        // output of a command is gathered here while more commands from the same connection are queued,
+        // so a stream of oks goes out in a few segments instead of one each
+        static const int coalesce_size= 200;
+        char outbuf[coalesce_size];
+        uint16_t outlen;
+        uint16_t pending_done;
 };
 
 #else
 
 extern void *new_callback_stream(cb_t cb, void *);
 extern void delete_callback_stream(void *);
+extern void flush_callback_stream(void *);
 
 #endif // __cplusplus
 
@@ -7,6 +7,8 @@
 #include "Kernel.h"
 #include "libs/SerialMessage.h"
 #include "CallbackStream.h"
+#include "platform_memory.h"
+#include "us_ticker_api.h"
 
 static CommandQueue *command_queue_instance;
 CommandQueue *CommandQueue::instance = NULL;
@@ -16,6 +18,9 @@ CommandQueue::CommandQueue()
 {
     command_queue_instance = this;
     null_stream= &(StreamOutput::NullStream);
+    // allocated on first use, this is made before the AHB pools are set up
+    ring= NULL;
+    ring_head= ring_tail= ring_used= ring_count= 0;
 }
 
 CommandQueue* CommandQueue::getInstance()
@@ -29,36 +34,114 @@ extern "C" {
     {
         return command_queue_instance->add(cmd, (StreamOutput*)pstream);
     }
+    int network_commands_backlogged(void)
+    {
+        return command_queue_instance->is_backlogged();
+    }
+    int network_commands_drained(void)
+    {
+        return command_queue_instance->is_drained();
+    }
+}
+
+bool CommandQueue::ring_add(const char *cmd, StreamOutput *pstream, uint32_t received_us)
+{
+    if(ring == NULL) {
+        ring= (char *)AHB0.alloc(COMMAND_QUEUE_ARENA_SIZE);
+        if(ring == NULL) ring= (char *)AHB1.alloc(COMMAND_QUEUE_ARENA_SIZE);
+        if(ring == NULL) ring= (char *)malloc(COMMAND_QUEUE_ARENA_SIZE);
+        if(ring == NULL) return false;
+    }
+
+    size_t len= strlen(cmd);
+    size_t need= (sizeof(entry_t) + len + 1 + 3) & ~3;
+    if(ring_used == 0) ring_head= ring_tail= 0;
+
+    if(ring_used > 0 && ring_head <= ring_tail) {
+        // the free space is between the end of the newest line and the oldest one
+        if(need > (size_t)(ring_tail - ring_head)) return false;
+
+    } else if(need > (size_t)(COMMAND_QUEUE_ARENA_SIZE - ring_head)) {
+        // no room before the end, so wrap to the start if the oldest line is far enough along
+        if(need > ring_tail) return false;
+        if(COMMAND_QUEUE_ARENA_SIZE - ring_head >= sizeof(entry_t))
+            ((entry_t *)&ring[ring_head])->size= 0;
+        ring_used += COMMAND_QUEUE_ARENA_SIZE - ring_head;
+        ring_head= 0;
+    }
+
+    entry_t *e= (entry_t *)&ring[ring_head];
+    e->pstream= pstream;
+    e->size= need;
+    e->received_us= received_us;
+    memcpy(e->str, cmd, len + 1);
+    ring_head += need;
+    if(ring_head == COMMAND_QUEUE_ARENA_SIZE) ring_head= 0;
+    ring_used += need;
+    ring_count++;
+    return true;
+}
+
+bool CommandQueue::ring_pop(std::string &cmd, StreamOutput *&pstream, uint32_t &received_us)
+{
+    if(ring_count == 0) return false;
+
+    // skip the unused end of the ring where a line did not fit
+    if(COMMAND_QUEUE_ARENA_SIZE - ring_tail < sizeof(entry_t) || ((entry_t *)&ring[ring_tail])->size == 0) {
+        ring_used -= COMMAND_QUEUE_ARENA_SIZE - ring_tail;
+        ring_tail= 0;
+    }
+
+    entry_t *e= (entry_t *)&ring[ring_tail];
+    cmd= e->str;
+    pstream= e->pstream;
+    received_us= e->received_us;
+    ring_tail += e->size;
+    if(ring_tail == COMMAND_QUEUE_ARENA_SIZE) ring_tail= 0;
+    ring_used -= e->size;
+    ring_count--;
+    return true;
 }
 
 int CommandQueue::add(const char *cmd, StreamOutput *pstream)
 {
-    cmd_t c= {strdup(cmd), pstream==NULL?null_stream:pstream};
-    q.push(c);
+    StreamOutput *s= pstream==NULL?null_stream:pstream;
+    // the time on the queue is the part of the latency M412 reports that telnet adds
+    uint32_t now= us_ticker_read();
+    // once a line has overflowed to the heap the rest follow it there until it empties, or they would overtake it
+    if(q.size() > 0 || !ring_add(cmd, s, now)) {
+        cmd_t c= {strdup(cmd), s, now};
+        q.push(c);
+    }
     if(pstream != NULL) {
         // count how many times this is on the queue
         CallbackStream *s= static_cast<CallbackStream *>(pstream);
         s->inc();
     }
-    return q.size();
+    return size();
 }
 
 // pops the next command off the queue and submits it.
 bool CommandQueue::pop()
 {
-    if (q.size() == 0) return false;
-
-    cmd_t c= q.pop();
-    char *cmd= c.str;
-
     struct SerialMessage message;
-    message.message = cmd;
-    message.stream = c.pstream;
+    uint32_t received_us;
+    // the ring holds everything older than the overflow
+    if(!ring_pop(message.message, message.stream, received_us)) {
+        if (q.size() == 0) return false;
+
+        cmd_t c= q.pop();
+        message.message = c.str;
+        message.stream = c.pstream;
+        received_us= c.received_us;
+        free(c.str);
+    }
 
-    free(cmd);
+    if(message.stream != null_stream) message.stream->line_received_us= received_us;
     THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
 
     if(message.stream != null_stream) {
+        message.stream->line_received_us= 0;
         message.stream->puts(NULL); // indicates command is done
         // decrement usage count
         CallbackStream *s= static_cast<CallbackStream *>(message.stream);
@@ -5,9 +5,16 @@
 
 #include "fifo.h"
 #include <string>
+#include <stdint.h>
 
 class StreamOutput;
 
+// telnet stops taking data once more than this many commands are queued, and starts again below the low mark
+#define COMMAND_QUEUE_HIGH_WATER 20
+#define COMMAND_QUEUE_LOW_WATER  5
+// bytes of AHB SRAM the queued lines are packed into, only above half of it is used once the sources are stopped
+#define COMMAND_QUEUE_ARENA_SIZE 2048
+
 class CommandQueue
 {
 public:
@@ -15,11 +22,26 @@ public:
     ~CommandQueue();
     bool pop();
     int add(const char* cmd, StreamOutput *pstream);
-    int size() {return q.size();}
+    int size() {return ring_count + q.size();}
+    // network sources should stop reading when the queue is backlogged, and restart once it has drained
+    bool is_backlogged() { return size() > COMMAND_QUEUE_HIGH_WATER || ring_used > COMMAND_QUEUE_ARENA_SIZE / 2; }
+    bool is_drained() { return size() < COMMAND_QUEUE_LOW_WATER && ring_used < COMMAND_QUEUE_ARENA_SIZE / 4; }
     static CommandQueue* getInstance();
 
 private:
-    typedef struct {char* str; StreamOutput *pstream; } cmd_t;
+    // a line packed in the ring, the size includes this header and is rounded up to 4, 0 marks a wrap to the start
+    typedef struct {StreamOutput *pstream; uint32_t size; uint32_t received_us; char str[]; } entry_t;
+    bool ring_add(const char* cmd, StreamOutput *pstream, uint32_t received_us);
+    bool ring_pop(std::string &cmd, StreamOutput *&pstream, uint32_t &received_us);
+
+    char *ring;
+    uint16_t ring_head;
+    uint16_t ring_tail;
+    uint16_t ring_used;
+    uint16_t ring_count;
+
+    // only used when the ring is full, and only until it empties, so the order is kept
+    typedef struct {char* str; StreamOutput *pstream; uint32_t received_us; } cmd_t;
     Fifo<cmd_t> q;
     static CommandQueue *instance;
     StreamOutput *null_stream;
@@ -28,6 +50,8 @@ private:
 #else
 
 extern int network_add_command(const char * cmd, void *pstream);
+extern int network_commands_backlogged(void);
+extern int network_commands_drained(void);
 #endif
 
 #endif
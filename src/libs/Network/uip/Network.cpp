@@ -10,6 +10,7 @@
 
 #include "Network.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "PlayerPublicAccess.h"
 #include "net_util.h"
 #include "uip_arp.h"
@@ -17,37 +18,59 @@
 #include "NetworkPublicAccess.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
+#include "MachineStatus.h"
 
 #include "uip.h"
 #include "telnetd.h"
 #include "webserver.h"
 #include "dhcpc.h"
 #include "sftpd.h"
+#include "gcoded.h"
+#include "us_ticker_api.h"
 
 
 #include <mri.h>
+#include <algorithm>
 
 #define BUF ((struct uip_eth_hdr *)&uip_buf[0])
 
 #define network_enable_checksum CHECKSUM("enable")
 #define network_webserver_checksum CHECKSUM("webserver")
 #define network_telnet_checksum CHECKSUM("telnet")
+#define network_gcode_checksum CHECKSUM("gcode")
+#define network_port_checksum CHECKSUM("port")
 #define network_mac_override_checksum CHECKSUM("mac_override")
 #define network_ip_address_checksum CHECKSUM("ip_address")
 #define network_hostname_checksum CHECKSUM("hostname")
 #define network_ip_gateway_checksum CHECKSUM("ip_gateway")
 #define network_ip_mask_checksum CHECKSUM("ip_mask")
+#define network_mss_checksum CHECKSUM("mss")
+#define network_rx_descriptors_checksum CHECKSUM("rx_descriptors")
+#define network_tx_descriptors_checksum CHECKSUM("tx_descriptors")
+#define network_dhcp_timeout_checksum CHECKSUM("dhcp_timeout")
+#define network_fallback_ip_address_checksum CHECKSUM("fallback_ip_address")
+#define network_fallback_ip_mask_checksum CHECKSUM("fallback_ip_mask")
+#define network_fallback_ip_gateway_checksum CHECKSUM("fallback_ip_gateway")
+
+// received frames are processed in place, so an rx buffer has to hold all uIP may write there
+#if UIP_BUFSIZE + 4 > LPC17XX_MAX_PACKET
+#error "uip_buf does not fit in an Ethernet buffer"
+#endif
 
 extern "C" void uip_log(char *m)
 {
     printf("uIP log message: %s\n", m);
 }
 
-static bool webserver_enabled, telnet_enabled, use_dhcp;
+static bool webserver_enabled, telnet_enabled, gcode_enabled, use_dhcp, servers_started;
+static uint16_t gcode_port;
+static int tcp_mss;
 static Network *theNetwork;
 static Sftpd *sftpd;
 static CommandQueue *command_q= CommandQueue::getInstance();
 
+static void network_device_send();
+
 Network* Network::instance;
 Network::Network()
 {
@@ -57,6 +80,10 @@ Network::Network()
     sftpd= NULL;
     instance= this;
     hostname = NULL;
+    state = NET_BOOT;
+    state_tick = 0;
+    dhcp_timeout = 0;
+    use_fallback = false;
 }
 
 Network::~Network()
@@ -129,6 +156,10 @@ void Network::on_module_loaded()
 
     webserver_enabled = THEKERNEL->config->value( network_checksum, network_webserver_checksum, network_enable_checksum )->by_default(false)->as_bool();
     telnet_enabled = THEKERNEL->config->value( network_checksum, network_telnet_checksum, network_enable_checksum )->by_default(false)->as_bool();
+    gcode_enabled = THEKERNEL->config->value( network_checksum, network_gcode_checksum, network_enable_checksum )->by_default(false)->as_bool();
+    gcode_port = THEKERNEL->config->value( network_checksum, network_gcode_checksum, network_port_checksum )->by_default(2323)->as_number();
+    // a multiple of 512 lets the webserver send and save whole SD card sectors, uIP limits it to what its buffer holds
+    tcp_mss = THEKERNEL->config->value( network_checksum, network_mss_checksum )->by_default(UIP_TCP_MSS)->as_number();
 
     string mac = THEKERNEL->config->value( network_checksum, network_mac_override_checksum )->by_default("")->as_string();
     if (mac.size() == 17 ) { // parse mac address
@@ -163,6 +194,33 @@ void Network::on_module_loaded()
                 printf("Invalid hostname: %s\n", s.c_str());
             }
         }
+
+        // if there is no answer from a DHCP server in this many seconds the fallback address is used until there is,
+        // auto is a link local address made from the MAC, none waits for DHCP however long it takes
+        dhcp_timeout = THEKERNEL->config->value( network_checksum, network_dhcp_timeout_checksum )->by_default(10)->as_number();
+        s = THEKERNEL->config->value( network_checksum, network_fallback_ip_address_checksum )->by_default("auto")->as_string();
+        use_fallback = (s != "none" && dhcp_timeout > 0);
+        if (s == "auto") {
+            uint8_t a[4] = {169, 254, (uint8_t)(1 + mac_address[4] % 254), mac_address[5]};
+            memcpy(fallback_ip, a, 4);
+            s = "255.255.0.0";
+        } else if (use_fallback) {
+            if (!parse_ip_str(s, fallback_ip, 4)) {
+                printf("Invalid fallback IP address: %s\n", s.c_str());
+                use_fallback = false;
+            }
+            s = "255.255.255.0";
+        }
+        s = THEKERNEL->config->value( network_checksum, network_fallback_ip_mask_checksum )->by_default(s)->as_string();
+        if (use_fallback && !parse_ip_str(s, fallback_mask, 4)) {
+            printf("Invalid fallback IP mask: %s\n", s.c_str());
+            use_fallback = false;
+        }
+        s = THEKERNEL->config->value( network_checksum, network_fallback_ip_gateway_checksum )->by_default("0.0.0.0")->as_string();
+        if (use_fallback && !parse_ip_str(s, fallback_gw, 4)) {
+            printf("Invalid fallback IP gateway: %s\n", s.c_str());
+            use_fallback = false;
+        }
     } else {
         bool bad = false;
         use_dhcp = false;
@@ -186,15 +244,27 @@ void Network::on_module_loaded()
         }
     }
 
-    THEKERNEL->add_module( ethernet );
-    THEKERNEL->slow_ticker->attach( 100, this, &Network::tick );
+    // more rx descriptors ride out bursts while the main loop is busy, each one is a frame buffer of AHB SRAM
+    int rx = THEKERNEL->config->value( network_checksum, network_rx_descriptors_checksum )->by_default(LPC17XX_DEFAULT_BUFS)->as_number();
+    int tx = THEKERNEL->config->value( network_checksum, network_tx_descriptors_checksum )->by_default(LPC17XX_DEFAULT_BUFS)->as_number();
+    rx = std::min(std::max(rx, LPC17XX_MIN_BUFS), LPC17XX_MAX_BUFS);
+    tx = std::min(std::max(tx, LPC17XX_MIN_BUFS), LPC17XX_MAX_BUFS);
+    if (!ethernet->alloc_buffers(rx, tx)) {
+        printf("Network not started, no room for %d rx and %d tx buffers\n", rx, tx);
+        return;
+    }
+
+    THEKERNEL->slow_ticker->attach<Network, &Network::tick>(100, this);
 
     // Register for events
     this->register_for_event(ON_IDLE);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    this->register_for_main_loop(MAIN_LOOP_FEED, "network");
+    PublicData::register_owner(network_checksum, this);
+    THEKERNEL->status->ip = this->ipaddr;
 
-    this->init();
+    // the EMAC, the link and the address are brought up from on_idle once the main loop is running, see bring_up()
+    if (use_dhcp) memset(this->ipaddr, 0, 4);
+    state = NET_BOOT;
 }
 
 void Network::on_get_public_data(void* argument) {
@@ -208,15 +278,19 @@ void Network::on_get_public_data(void* argument) {
 
     }else if(pdr->second_element_is(get_ipconfig_checksum)) {
         // NOTE caller must free the returned string when done
-        char buf[200];
+        char buf[320];
         int n1= snprintf(buf,             sizeof(buf),         "IP Addr: %d.%d.%d.%d\n", ipaddr[0], ipaddr[1], ipaddr[2], ipaddr[3]);
         int n2= snprintf(&buf[n1],       sizeof(buf)-n1,       "IP GW: %d.%d.%d.%d\n", ipgw[0], ipgw[1], ipgw[2], ipgw[3]);
         int n3= snprintf(&buf[n1+n2],    sizeof(buf)-n1-n2,    "IP mask: %d.%d.%d.%d\n", ipmask[0], ipmask[1], ipmask[2], ipmask[3]);
         int n4= snprintf(&buf[n1+n2+n3], sizeof(buf)-n1-n2-n3, "MAC Address: %02X:%02X:%02X:%02X:%02X:%02X\n",
             mac_address[0], mac_address[1], mac_address[2], mac_address[3], mac_address[4], mac_address[5]);
-        char *str = (char *)malloc(n1+n2+n3+n4+1);
-        memcpy(str, buf, n1+n2+n3+n4);
-        str[n1+n2+n3+n4]= '\0';
+        int n5= snprintf(&buf[n1+n2+n3+n4], sizeof(buf)-n1-n2-n3-n4, "Buffers: %d rx, %d tx, RX dropped: %lu, RX ring full: %lu\n",
+            ethernet->get_rx_count(), ethernet->get_tx_count(), ethernet->get_rx_dropped(), ethernet->get_rx_ring_full());
+        int n6= snprintf(&buf[n1+n2+n3+n4+n5], sizeof(buf)-n1-n2-n3-n4-n5, "Status: %s\n", state_name());
+        int n= n1+n2+n3+n4+n5+n6;
+        char *str = (char *)malloc(n+1);
+        memcpy(str, buf, n);
+        str[n]= '\0';
         pdr->set_data_ptr(str);
         pdr->set_taken();
     }
@@ -229,14 +303,87 @@ uint32_t Network::tick(uint32_t dummy)
     return 0;
 }
 
+const char *Network::state_name() const
+{
+    switch (state) {
+        case NET_BOOT:
+        case NET_START: return "starting";
+        case NET_LINK: return "waiting for link";
+        case NET_DHCP: return "waiting for DHCP";
+        case NET_FALLBACK: return "fallback address, DHCP timed out";
+        case NET_STATIC: return "up, static address";
+        case NET_DHCP_UP: return "up, address from DHCP";
+    }
+    return "?";
+}
+
+// a step of bringing the network up, which waits for nothing: the EMAC is started in the first on_idle after boot,
+// the PHY is checked every 100ms until there is a link, then DHCP is started, and if it has no answer by
+// dhcp_timeout the fallback address is used while it carries on trying
+void Network::bring_up()
+{
+    if (state == NET_START) {
+        // not through add_module, boot is over and this is not part of it
+        ethernet->on_module_loaded();
+        init();
+        state = NET_LINK;
+        state_tick = tickcnt;
+        return;
+    }
+
+    if (tickcnt - state_tick < 10) return;
+
+    if (state == NET_LINK) {
+        state_tick = tickcnt;
+        ethernet->check_interface();
+        if (!ethernet->isUp()) return;
+
+        if (!use_dhcp) {
+            state = NET_STATIC;
+            return;
+        }
+    #if UIP_CONF_UDP
+        // now rather than at boot, as a request sent with no link is lost and the retries back off
+        dhcpc_init(mac_address, sizeof(mac_address), hostname);
+        dhcpc_request();
+        printf("Getting IP address....\n");
+    #endif
+        state = NET_DHCP;
+
+    } else if (state == NET_DHCP && use_fallback && tickcnt - state_tick >= (uint32_t)dhcp_timeout * 100) {
+        printf("No answer from DHCP, using %d.%d.%d.%d\n", fallback_ip[0], fallback_ip[1], fallback_ip[2], fallback_ip[3]);
+        uint32_t ip, mask, gw;
+        memcpy(&ip, fallback_ip, 4);
+        memcpy(&mask, fallback_mask, 4);
+        memcpy(&gw, fallback_gw, 4);
+        set_address(ip, mask, gw);
+        state = NET_FALLBACK;
+    }
+}
+
 void Network::on_idle(void *argument)
 {
+    if (state <= NET_DHCP) {
+        if (state == NET_BOOT) return;
+        bring_up();
+        if (state <= NET_LINK) return;
+    }
+
     if (!ethernet->isUp()) return;
 
-    int len= sizeof(uip_buf); // set maximum size
-    if (ethernet->_receive_frame(uip_buf, &len)) {
+    uint8_t *frame;
+    int len= ethernet->read_packet(&frame);
+    if (len > UIP_BUFSIZE) {
+        ethernet->drop_read_packet(frame);
+
+    } else if (len > 0) {
+        // uIP works on the frame where the EMAC put it, only a reply gets copied, into a tx descriptor
+        u8_t *own_buf= uip_buf;
+        uip_buf= frame;
         uip_len = len;
         this->handlePacket();
+        uip_buf= own_buf;
+        ethernet->release_read_packet(frame);
 
     } else {
 
@@ -250,7 +397,8 @@ void Network::on_idle(void *argument)
                    uip_len is set to a value > 0. */
                 if (uip_len > 0) {
                     uip_arp_out();
-                    tapdev_send(uip_buf, uip_len);
+                    // data made on a poll, and retransmissions, get split like any other
+                    network_device_send();
                 }
             }
 
@@ -282,6 +430,20 @@ void Network::on_idle(void *argument)
             }
         }
 */
+        // replies waiting on the gcode port go out as soon as there is nothing in flight, not on the next periodic poll
+        if (gcode_enabled && Gcoded::get_sessions() > 0) {
+            for (int i = 0; i < UIP_CONNS; i++) {
+                struct uip_conn *c = &uip_conns[i];
+                if (c->lport == HTONS(gcode_port) && Gcoded::wants_poll(c->appstate)) {
+                    uip_poll_conn(c);
+                    if (uip_len > 0) {
+                        uip_arp_out();
+                        network_device_send();
+                    }
+                }
+            }
+        }
+
         /* Call the ARP timer function every 10 seconds. */
         if (timer_expired(&arp_timer)) {
             timer_reset(&arp_timer);
@@ -292,6 +454,10 @@ void Network::on_idle(void *argument)
 
 static void setup_servers()
 {
+    // a DHCP answer after the fallback address was used only changes the address
+    if (servers_started) return;
+    servers_started = true;
+
     if (webserver_enabled) {
         // Initialize the HTTP server, listen to port 80.
         httpd_init();
@@ -304,6 +470,12 @@ static void setup_servers()
         printf("Telnetd initialized\n");
     }
 
+    if (gcode_enabled) {
+        // raw gcode streaming, no shell
+        Gcoded::init(gcode_port);
+        printf("Gcode port %d initialized\n", gcode_port);
+    }
+
     // sftpd service, which is lazily created on reciept of first packet
     uip_listen(HTONS(115));
 }
@@ -328,6 +500,12 @@ extern "C" void dhcpc_configured(const struct dhcpc_state *s)
 }
 
 void Network::dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw)
+{
+    set_address(ipaddr, ipmask, ipgw);
+    state = NET_DHCP_UP;
+}
+
+void Network::set_address(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw)
 {
     memcpy(this->ipaddr, &ipaddr, 4);
     memcpy(this->ipmask, &ipmask, 4);
@@ -348,6 +526,7 @@ void Network::init(void)
 
     // Initialize the uIP TCP/IP stack.
     uip_init();
+    uip_setmss(tcp_mss);
 
     uip_setethaddr(mac_address);
 
@@ -365,18 +544,14 @@ void Network::init(void)
         uip_setnetmask(tip); /* mask */
         printf("IP mask: %d.%d.%d.%d\n", ipmask[0], ipmask[1], ipmask[2], ipmask[3]);
         setup_servers();
-
-    }else{
-    #if UIP_CONF_UDP
-        dhcpc_init(mac_address, sizeof(mac_address), hostname);
-        dhcpc_request();
-        printf("Getting IP address....\n");
-    #endif
     }
 }
 
 void Network::on_main_loop(void *argument)
 {
+    // the network is only started once everything else is
+    if (state == NET_BOOT) state = NET_START;
+
     // issue commands here if any available
     while(command_q->pop()) {
         // keep feeding them until empty
@@ -386,6 +561,11 @@ void Network::on_main_loop(void *argument)
 // select between webserver and telnetd server
 extern "C" void app_select_appcall(void)
 {
+    if (gcode_enabled && uip_conn->lport == HTONS(gcode_port)) {
+        Gcoded::appcall();
+        return;
+    }
+
     switch (uip_conn->lport) {
         case HTONS(80):
             if (webserver_enabled) httpd_appcall();
@@ -412,6 +592,11 @@ extern "C" void app_select_appcall(void)
 
 void Network::tapdev_send(void *pPacket, unsigned int size)
 {
+    // a split segment is two frames back to back, wait for the EMAC to free a descriptor rather than drop one
+    uint32_t start = us_ticker_read();
+    while (!ethernet->can_write_packet()) {
+        if (us_ticker_read() - start > 2000) return; // the link is down, TCP will retransmit
+    }
     memcpy(ethernet->request_packet_buffer(), pPacket, size);
     ethernet->write_packet((uint8_t *) pPacket, size);
 }
@@ -425,15 +610,15 @@ extern "C" void tcpip_output()
 {
     theNetwork->tapdev_send(uip_buf, uip_len);
 }
-void network_device_send()
+static void network_device_send()
 {
     uip_split_output();
     //tcpip_output();
 }
 #else
-void network_device_send()
+static void network_device_send()
 {
-    tapdev_send(uip_buf, uip_len);
+    theNetwork->tapdev_send(uip_buf, uip_len);
 }
 #endif
 
@@ -22,6 +22,9 @@ public:
 
 private:
     void init();
+    void bring_up();
+    void set_address(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw);
+    const char *state_name() const;
     uint32_t tick(uint32_t dummy);
     void handlePacket();
 
@@ -37,6 +40,15 @@ private:
     char *hostname;
     volatile uint32_t tickcnt;
 
+    // in the order they are gone through, fallback and the ones after are up
+    enum { NET_BOOT, NET_START, NET_LINK, NET_DHCP, NET_FALLBACK, NET_STATIC, NET_DHCP_UP } state;
+    uint32_t state_tick;        // tickcnt when the link was last checked, or DHCP was started
+    uint8_t fallback_ip[4];
+    uint8_t fallback_mask[4];
+    uint8_t fallback_gw[4];
+    uint16_t dhcp_timeout;      // seconds
+    bool use_fallback;
+
 };
 
 #endif
@@ -0,0 +1,192 @@
+#include "uip.h"
+#include "gcoded.h"
+#include "CommandQueue.h"
+#include "CallbackStream.h"
+#include "platform_memory.h"
+#include "Kernel.h"
+#include "Conveyor.h"
+#include "RealtimeCommands.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define ISO_nl       0x0a
+#define ISO_cr       0x0d
+
+//#define DEBUG_PRINTF(...)
+#define DEBUG_PRINTF printf
+
+int Gcoded::sessions= 0;
+
+Gcoded::Gcoded()
+{
+    line= placed_alloc<char>(MAX_LINE, PLACE_AHB);
+    out= placed_alloc<char>(OUT_SIZE, PLACE_AHB);
+    linelen= outlen= sentlen= 0;
+    overflow= false;
+    pstream= new CallbackStream(command_result, this);
+    sessions++;
+}
+
+Gcoded::~Gcoded()
+{
+    // the stream can still be on the command queue, it deletes itself once it is not
+    static_cast<CallbackStream*>(pstream)->mark_closed();
+    placed_free(line);
+    placed_free(out);
+    sessions--;
+}
+
+// replies are added to what is waiting to be sent, 0 when it is full holds the command back until some is acked
+int Gcoded::command_result(const char *str, void *p)
+{
+    Gcoded *g= (Gcoded *)p;
+    if (str == NULL) return 1; // a command is done, there is no prompt
+
+    int n= strlen(str);
+    if (n > OUT_SIZE) n= OUT_SIZE;
+    if (g->outlen + n > OUT_SIZE) return 0;
+    memcpy(&g->out[g->outlen], str, n);
+    g->outlen += n;
+    return 1;
+}
+
+int Gcoded::queued()
+{
+    // lines of the connection on the queue, and the one running
+    return static_cast<CallbackStream*>(pstream)->get_count();
+}
+
+bool Gcoded::should_stop()
+{
+    CommandQueue *q= CommandQueue::getInstance();
+    if (q->is_backlogged()) return true;
+    return THEKERNEL->conveyor->is_queue_full() && queued() > LINES_AHEAD;
+}
+
+// once stopped it waits for the planner to take some of the lines, so it is not stopped again by the next one
+bool Gcoded::can_restart()
+{
+    if (CommandQueue::getInstance()->is_backlogged()) return false;
+    return !THEKERNEL->conveyor->is_queue_full() || queued() <= LINES_AHEAD / 2;
+}
+
+bool Gcoded::wants_poll(void *appstate)
+{
+    Gcoded *g= (Gcoded *)appstate;
+    return g != NULL && g->outlen > 0 && g->sentlen == 0;
+}
+
+void Gcoded::newdata()
+{
+    const char *s= (const char *)uip_appdata;
+    int n= uip_datalen();
+
+    for (int i = 0; i < n; ++i) {
+        char c= s[i];
+        if (c == ISO_cr) continue;
+        if (c == ISO_nl) {
+            line[linelen]= 0;
+            if (linelen > 0 && !overflow) CommandQueue::getInstance()->add(line, pstream);
+            linelen= 0;
+            overflow= false;
+            continue;
+        }
+        if (THEKERNEL->realtime != nullptr && THEKERNEL->realtime->handle(c, pstream)) continue;
+        if (linelen < MAX_LINE - 1) {
+            line[linelen++]= c;
+        } else if (!overflow) {
+            overflow= true;
+            DEBUG_PRINTF("Gcoded: line too long, dropped\n");
+        }
+    }
+
+    if (should_stop()) uip_stop();
+}
+
+void Gcoded::acked()
+{
+    // what was in flight moves off the front, anything added meanwhile goes next
+    outlen -= sentlen;
+    if (outlen > 0) memmove(out, &out[sentlen], outlen);
+    sentlen= 0;
+}
+
+void Gcoded::senddata()
+{
+    // one segment is in flight at a time, a retransmission sends the same bytes again
+    if (sentlen == 0) {
+        sentlen= outlen < uip_mss() ? outlen : uip_mss();
+    }
+    if (sentlen > 0) uip_send(out, sentlen);
+}
+
+// static
+void Gcoded::appcall(void)
+{
+    Gcoded *instance= reinterpret_cast<Gcoded *>(uip_conn->appstate);
+
+    if (uip_connected()) {
+        if (sessions >= MAX_SESSIONS) {
+            DEBUG_PRINTF("Gcoded: refused, %d sessions\n", sessions);
+            uip_conn->appstate= NULL;
+            uip_abort();
+            return;
+        }
+        instance= new Gcoded;
+        if (instance->line == NULL || instance->out == NULL) {
+            DEBUG_PRINTF("Gcoded: refused, no memory for the buffers\n");
+            delete instance;
+            uip_conn->appstate= NULL;
+            uip_abort();
+            return;
+        }
+        uip_conn->appstate= instance;
+        instance->rport= uip_conn->rport;
+    }
+
+    if (uip_closed() || uip_aborted() || uip_timedout()) {
+        if (instance != NULL) {
+            delete instance;
+            uip_conn->appstate= NULL;
+        }
+        return;
+    }
+
+    if (instance == NULL || instance->rport != uip_conn->rport) {
+        DEBUG_PRINTF("Gcoded: ERROR Null instance or rport is wrong: %p - %u, %d\n", instance, HTONS(uip_conn->rport), uip_flags);
+        uip_abort();
+        return;
+    }
+
+    if (uip_acked()) {
+        instance->acked();
+    }
+
+    if (uip_newdata()) {
+        instance->newdata();
+    }
+
+    // oks held back while more of the connection's lines were queued go out at least every poll
+    if (uip_poll()) {
+        static_cast<CallbackStream*>(instance->pstream)->flush();
+    }
+
+    // every ack of the replies is a chance to open the window again, not just the poll
+    if ((uip_poll() || uip_acked()) && uip_stopped(uip_conn) && instance->can_restart()) {
+        uip_restart();
+    }
+
+    if (uip_rexmit()) {
+        instance->senddata();
+    } else if ((uip_newdata() || uip_acked() || uip_poll()) && instance->sentlen == 0) {
+        instance->senddata();
+    }
+}
+
+// static
+void Gcoded::init(uint16_t port)
+{
+    uip_listen(HTONS(port));
+}
@@ -0,0 +1,54 @@
+#ifndef __GCODED_H__
+#define __GCODED_H__
+
+#include "stdint.h"
+
+class StreamOutput;
+struct uip_conn;
+
+// A raw TCP port for streaming gcode, each line received goes straight onto the command queue and the replies come
+// back as they are, with none of the telnet option handling, prompts or shell commands.
+// The connection is stopped, which closes its TCP window, while the planner is full and the connection has a few
+// lines queued ahead of it, so the sender is held back by TCP rather than by counting oks. The oks of the lines
+// queued meanwhile are gathered and sent together.
+class Gcoded
+{
+public:
+    Gcoded();
+    ~Gcoded();
+
+    static void init(uint16_t port);
+    static void appcall(void);
+    // true if a connection has replies waiting and nothing in flight, it is polled then rather than on the timer
+    static bool wants_poll(void *appstate);
+    static int get_sessions() { return sessions; }
+
+private:
+    static const int MAX_LINE= 256;
+    static const int OUT_SIZE= 1024;
+    // lines of the connection on the queue while the planner is full before it is stopped
+    static const int LINES_AHEAD= 4;
+    // sessions beyond this are refused, so the web server and telnet always have connections left
+    static const int MAX_SESSIONS= 2;
+    static int sessions;
+
+    static int command_result(const char *str, void *p);
+    int queued();
+    bool should_stop();
+    bool can_restart();
+    void newdata();
+    void acked();
+    void senddata();
+
+    StreamOutput *pstream;
+    // the line being received, and what is waiting to be sent, in AHB SRAM when there is room
+    char *line;
+    char *out;
+    uint16_t linelen;
+    uint16_t outlen;
+    uint16_t sentlen;   // the start of out that is in flight
+    uint16_t rport;
+    bool overflow;      // the line was too long, the rest of it is dropped
+};
+
+#endif
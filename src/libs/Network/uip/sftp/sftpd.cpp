@@ -16,17 +16,12 @@ extern "C" {
 
 Sftpd::Sftpd()
 {
-    fd = NULL;
     state = STATE_NORMAL;
     outbuf = NULL;
-    filename= NULL;
 }
 
 Sftpd::~Sftpd()
 {
-    if (fd != NULL) {
-        fclose(fd);
-    }
 }
 
 int Sftpd::senddata()
@@ -72,21 +67,17 @@ int Sftpd::handle_command()
                     outbuf = "- incomplete STOR command\n";
                 } else {
                     char *fn = &buf[9];
-                    if(this->filename != NULL) free(this->filename);
-                    this->filename= strdup(fn); // REMOVE when bug fixed
                     // get { NEW|OLD|APP }
                     if (strncmp(&buf[5], "OLD", 3) == 0) {
                         DEBUG_PRINTF("sftp: Opening file: %s\n", fn);
-                        fd = fopen(fn, "w");
-                        if (fd != NULL) {
+                        if (writer.open(fn)) {
                             outbuf = "+ new file\n";
                             state = STATE_GET_LENGTH;
                         } else {
                             outbuf = "- failed\n";
                         }
                     } else if (strncmp(&buf[5], "APP", 3) == 0) {
-                        fd = fopen(fn, "a");
-                        if (fd != NULL) {
+                        if (writer.open(fn, true)) {
                             outbuf = "+ append file\n";
                             state = STATE_GET_LENGTH;
                         } else {
@@ -103,8 +94,7 @@ int Sftpd::handle_command()
 
         } else if (state == STATE_GET_LENGTH) {
             if (len < 6 || strncmp(buf, "SIZE", 4) != 0) {
-                fclose(fd);
-                fd = NULL;
+                writer.close();
                 outbuf = "- Expected size\n";
                 state = STATE_CONNECTED;
 
@@ -114,8 +104,7 @@ int Sftpd::handle_command()
                     outbuf = "+ ok, waiting for file\n";
                     state = STATE_DOWNLOAD;
                 } else {
-                    fclose(fd);
-                    fd = NULL;
+                    writer.close();
                     outbuf = "- bad filesize\n";
                     state = STATE_CONNECTED;
                 }
@@ -139,26 +128,26 @@ int Sftpd::handle_download()
 
     if (filesize > 0 && readlen > 0) {
         if (readlen > filesize) readlen = filesize;
-        if (fwrite(readptr, 1, readlen, fd) != readlen) {
+        if (!writer.write(readptr, readlen)) {
             DEBUG_PRINTF("sftp: Error writing file\n");
-            fclose(fd);
-            fd = NULL;
+            writer.close();
             outbuf = "- Error saving file\n";
             state = STATE_CONNECTED;
             return 0;
         }
         filesize -= readlen;
         DEBUG_PRINTF("sftp: saved %d bytes %d left\n", readlen, filesize);
-        // HACK ALERT... to work around the fwrite/filesystem bug where writing large amounts of data corrupts the file
-        // we workaround by closing the file, the reopening for append until we are done
-        fclose(fd);
-        fd = fopen(this->filename, "a");
     }
     if (filesize == 0) {
         DEBUG_PRINTF("sftp: download complete\n");
-        fclose(fd);
-        fd = NULL;
-        outbuf = "+ Saved file\n";
+        if (writer.close()) {
+            uint32_t ms = writer.get_elapsed_us() / 1000;
+            uint32_t rate = ms > 0 ? (uint32_t)((uint64_t)writer.get_total() * 1000 / ms) : 0;
+            snprintf(reply, sizeof(reply), "+ Saved file, %lu bytes in %lu ms, %lu bytes/s\n", writer.get_total(), ms, rate);
+            outbuf = reply;
+        } else {
+            outbuf = "- Error saving file\n";
+        }
         state = STATE_CONNECTED;
         return 0;
     }
@@ -190,9 +179,7 @@ void Sftpd::appcall(void)
 
     if (uip_closed() || uip_aborted() || uip_timedout()) {
         DEBUG_PRINTF("sftp: closed\n");
-        if (fd != NULL)
-            fclose(fd);
-        fd = NULL;
+        writer.close();
         state = STATE_NORMAL;
         return;
     }
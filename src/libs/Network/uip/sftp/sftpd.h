@@ -7,6 +7,7 @@
 
 
 #include <stdio.h>
+#include "SectorWriter.h"
 extern "C" {
 #include "psock.h"
 }
@@ -21,7 +22,8 @@ public:
     void init(void);
 
 private:
-    FILE *fd;
+    // what is received is gathered into whole sectors before it is written
+    SectorWriter writer;
     enum STATES { STATE_NORMAL, STATE_CONNECTED, STATE_GET_LENGTH, STATE_DOWNLOAD, STATE_CLOSE };
     STATES state;
     int acked();
@@ -30,10 +32,10 @@ private:
     int senddata();
 
     struct psock sin;
-    char buf[80];
+    char buf[128];
     const char *outbuf;
+    char reply[80];
     unsigned int filesize;
-    char *filename;
 };
 
 #endif /* __sftpd_H__ */
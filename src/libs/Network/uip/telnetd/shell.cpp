@@ -37,6 +37,7 @@
 #include "shell.h"
 #include "uip.h"
 #include <string.h>
+#include <ctype.h>
 #include "checksumm.h"
 #include "utils.h"
 #include "stdio.h"
@@ -234,6 +235,11 @@ int Shell::queue_size()
 /*---------------------------------------------------------------------------*/
 void Shell::input(char *cmd)
 {
+    // gcode goes straight to the queue without being looked for in the shell commands
+    if ((cmd[0] == 'G' || cmd[0] == 'M' || cmd[0] == 'N' || cmd[0] == 'T') && isdigit(cmd[1])) {
+        CommandQueue::getInstance()->add(cmd, pstream);
+        return;
+    }
     if (parse(cmd, parsetab)) {
         telnet->output_prompt(SHELL_PROMPT);
     }
@@ -35,6 +35,11 @@
 #include "uip.h"
 #include "telnetd.h"
 #include "shell.h"
+#include "CommandQueue.h"
+#include "CallbackStream.h"
+#include "platform_memory.h"
+#include "Kernel.h"
+#include "RealtimeCommands.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -197,22 +202,29 @@ void Telnetd::senddata(void)
     uip_send(uip_appdata, buflen);
 }
 
-void Telnetd::get_char(u8_t c)
+void Telnetd::end_line()
 {
-    if (c == ISO_cr) {
-        return;
-    }
+    buf[bufptr] = 0;
+    shell->input(buf);
+    bufptr = 0;
+}
 
-    buf[(int)bufptr] = c;
-    if (buf[(int)bufptr] == ISO_nl || bufptr == sizeof(buf) - 1) {
-        if (bufptr > 0) {
-            buf[(int)bufptr] = 0;
+// text between telnet commands, split into lines at each newline, a line too long for the buffer is cut where it fills
+void Telnetd::get_text(const char *s, int n)
+{
+    while (n > 0) {
+        const char *nl = (const char *)memchr(s, ISO_nl, n);
+        int run = nl == NULL ? n : nl - s;
+        for (int i = 0; i < run; ++i) {
+            if (s[i] == ISO_cr) continue;
+            if (THEKERNEL->realtime != nullptr && THEKERNEL->realtime->handle(s[i], shell->getStream())) continue;
+            buf[bufptr++] = s[i];
+            if (bufptr == TELNETD_CONF_MAXCOMMANDLENGTH - 1) end_line();
         }
-        shell->input(buf);
-        bufptr = 0;
-
-    } else {
-        ++bufptr;
+        if (nl == NULL) return;
+        end_line();
+        s += run + 1;
+        n -= run + 1;
     }
 }
 
@@ -238,14 +250,29 @@ void Telnetd::newdata(void)
     len = uip_datalen();
     dataptr = (char *)uip_appdata;
 
-    while (len > 0 && bufptr < sizeof(buf)) {
+    while (len > 0) {
+        if (state == STATE_NORMAL) {
+            // everything up to the next telnet command goes in at once
+            char *iac = (char *)memchr(dataptr, TELNET_IAC, len);
+            u16_t run = iac == NULL ? len : iac - dataptr;
+            get_text(dataptr, run);
+            dataptr += run;
+            len -= run;
+            if (len > 0) {
+                state = STATE_IAC;
+                ++dataptr;
+                --len;
+            }
+            continue;
+        }
+
         c = *dataptr;
         ++dataptr;
         --len;
         switch (state) {
             case STATE_IAC:
                 if (c == TELNET_IAC) {
-                    get_char(c);
+                    get_text((const char *)&c, 1);
                     state = STATE_NORMAL;
                 } else {
                     switch (c) {
@@ -301,18 +328,12 @@ void Telnetd::newdata(void)
                 }
                 state = STATE_NORMAL;
                 break;
-            case STATE_NORMAL:
-                if (c == TELNET_IAC) {
-                    state = STATE_IAC;
-                } else {
-                    get_char(c);
-                }
-                break;
         }
     }
 
-    // if the command queue is getting too big we stop TCP
-    if(shell->queue_size() > 20) {
+    // if the command queue is getting too big we stop TCP, but only for a session that has lines of its own
+    // waiting in it, so one streaming gcode doesn't stop another that is just asking for the temperatures
+    if(CommandQueue::getInstance()->is_backlogged() && static_cast<CallbackStream*>(shell->getStream())->get_count() > 1) {
         DEBUG_PRINTF("Telnet: stopped: %d\n", shell->queue_size());
         uip_stop();
     }
@@ -334,6 +355,9 @@ Telnetd::Telnetd()
         lines[i] = NULL;
     }
 
+    buf = placed_alloc<char>(TELNETD_CONF_MAXCOMMANDLENGTH, PLACE_AHB);
+    sessions++;
+
     first_time= true;
     bufptr = 0;
     state = STATE_NORMAL;
@@ -348,14 +372,24 @@ Telnetd::~Telnetd()
         if (lines[i] != NULL) dealloc_line(lines[i]);
     }
     delete shell;
+    placed_free(buf);
+    sessions--;
 }
 
+int Telnetd::sessions= 0;
+
 // static
 void Telnetd::appcall(void)
 {
     Telnetd *instance= reinterpret_cast<Telnetd *>(uip_conn->appstate);
 
     if (uip_connected()) {
+        if (sessions >= TELNETD_CONF_MAXSESSIONS) {
+            DEBUG_PRINTF("Telnetd: refused, %d sessions\n", sessions);
+            uip_conn->appstate= NULL;
+            uip_abort();
+            return;
+        }
         // create a new telnet class instance
         instance= new Telnetd;
         DEBUG_PRINTF("Telnetd new instance: %p\n", instance);
@@ -392,11 +426,16 @@ void Telnetd::appcall(void)
         instance->newdata();
     }
 
+    // output held back while this connection's commands were still queued goes out at least every poll
+    if (uip_poll()) {
+        static_cast<CallbackStream*>(instance->shell->getStream())->flush();
+    }
+
     if (uip_rexmit() || uip_newdata() || uip_acked() || uip_connected() || uip_poll()) {
         instance->senddata();
     }
 
-    if(uip_poll() && uip_stopped(uip_conn) && instance->shell->queue_size() < 5) {
+    if(uip_poll() && uip_stopped(uip_conn) && CommandQueue::getInstance()->is_drained()) {
         DEBUG_PRINTF("restarted %d - %p\n", instance->shell->queue_size(), instance);
         uip_restart();
     }
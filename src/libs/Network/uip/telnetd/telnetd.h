@@ -54,15 +54,19 @@ public:
     void close();
 
 private:
-    static const int TELNETD_CONF_MAXCOMMANDLENGTH= 132;
+    static const int TELNETD_CONF_MAXCOMMANDLENGTH= 256;
     static const int TELNETD_CONF_NUMLINES= 32;
+    // sessions beyond this are refused, so the web server always has connections left
+    static const int TELNETD_CONF_MAXSESSIONS= 4;
+    static int sessions;
 
     Shell *shell;
 
     // FIXME this needs to be a FIFO
     char *lines[TELNETD_CONF_NUMLINES];
-    char buf[TELNETD_CONF_MAXCOMMANDLENGTH];
-    char bufptr;
+    // the line being received, in AHB SRAM when there is room
+    char *buf;
+    uint16_t bufptr;
     uint8_t numsent;
     uint8_t state;
     uint16_t rport;
@@ -74,7 +78,8 @@ private:
     int sendline(char *line);
     void acked(void);
     void senddata(void);
-    void get_char(uint8_t c);
+    void get_text(const char *s, int n);
+    void end_line();
     void newdata(void);
     void poll(void);
 
@@ -90,7 +90,7 @@ typedef unsigned short uip_stats_t;
  *
  * \hideinitializer
  */
-#define UIP_CONF_MAX_CONNECTIONS 6
+#define UIP_CONF_MAX_CONNECTIONS 8
 
 /**
  * Maximum number of listening TCP ports.
@@ -102,9 +102,39 @@ typedef unsigned short uip_stats_t;
 /**
  * uIP buffer size.
  *
+ * Room for a 512 byte TCP segment, one SD card sector, and the 54 bytes
+ * of Ethernet and TCP/IP headers, which still fits the 600 byte buffers
+ * of the Ethernet driver.
+ *
+ * \hideinitializer
+ */
+#define UIP_CONF_BUFFER_SIZE     566
+
+/**
+ * Make uip_buf a pointer, so received frames can be processed in
+ * place in the Ethernet receive buffers.
+ *
+ * \hideinitializer
+ */
+#define UIP_CONF_BUFFER_POINTER  1
+
+/**
+ * Advertise two segments of window, so a host uploading a file has the
+ * second on the way while the first is written. Both fit in the Ethernet
+ * receive ring, which holds four frames unless configured smaller.
+ *
+ * \hideinitializer
+ */
+#define UIP_CONF_RECEIVE_WINDOW  (2 * (UIP_CONF_BUFFER_SIZE - 54))
+
+/**
+ * Smallest TCP payload uip-split cuts in two, so that the receiver
+ * acks straight away instead of waiting out its delayed ACK timer.
+ * Shorter segments are mostly replies that get their ack piggybacked.
+ *
  * \hideinitializer
  */
-#define UIP_CONF_BUFFER_SIZE     400
+#define UIP_SPLIT_CONF_SIZE      128
 
 #define UIP_CONF_BROADCAST 1
 
@@ -51,6 +51,12 @@ void tcpip_output();
 
 #define BUF ((struct uip_tcpip_hdr *)&uip_buf[UIP_LLH_LEN])
 
+#define TCP_FIN 0x01
+#define TCP_SYN 0x02
+#define TCP_RST 0x04
+
+/* The smallest payload that is split, so the MSS chosen at run time
+   is not missed. */
 #ifdef UIP_SPLIT_CONF_SIZE
 #define UIP_SPLIT_SIZE UIP_SPLIT_CONF_SIZE
 #else /* UIP_SPLIT_CONF_SIZE */
@@ -63,9 +69,13 @@ void uip_split_output(void)
     u16_t tcplen, len1, len2;
 
 
-    /* We only try to split maximum sized TCP segments. */
-    if (BUF->proto == UIP_PROTO_TCP &&
-        uip_len >= UIP_SPLIT_SIZE + UIP_TCPIP_HLEN) {
+    /* We only try to split plain data segments, without options or
+       control flags, that carry at least UIP_SPLIT_SIZE bytes. uip_len
+       includes the link level header, and is checked first as an ARP
+       request from uip_arp_out() is shorter than any TCP packet. */
+    if (uip_len >= UIP_LLH_LEN + UIP_TCPIP_HLEN + UIP_SPLIT_SIZE &&
+        BUF->proto == UIP_PROTO_TCP && BUF->tcpoffset == 5 << 4 &&
+        (BUF->flags & (TCP_FIN | TCP_SYN | TCP_RST)) == 0) {
 
         tcplen = uip_len - UIP_TCPIP_HLEN - UIP_LLH_LEN;
         /* Split the segment in two. If the original packet length was
@@ -121,7 +131,8 @@ void uip_split_output(void)
 #endif /* UIP_CONF_IPV6 */
 
         /*    uip_appdata += len1;*/
-        memcpy(uip_appdata, (u8_t *)uip_appdata + len1, len2);
+        /* The halves overlap when len2 is the larger one. */
+        memmove(uip_appdata, (u8_t *)uip_appdata + len1, len2);
 
         uip_add32(BUF->seqno, len1);
         BUF->seqno[0] = uip_acc32[0];
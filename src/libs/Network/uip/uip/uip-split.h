@@ -77,8 +77,8 @@
  *
  * This function inspects an outgoing packet in the uip_buf buffer and
  * sends it out using the uip_fw_output() function. If the packet is a
- * full-sized TCP segment it will be split into two segments and
- * transmitted separately. This function should be called instead of
+ * TCP data segment of at least UIP_SPLIT_CONF_SIZE bytes it will be
+ * split into two segments and transmitted separately. This function should be called instead of
  * the actual device driver output function, or the uip_fw_output()
  * function.
  *
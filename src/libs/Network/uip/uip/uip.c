@@ -152,8 +152,14 @@ struct uip_eth_addr uip_ethaddr = {{0, 0, 0, 0, 0, 0}};
 #endif
 
 #ifndef UIP_CONF_EXTERNAL_BUFFER
+#if UIP_CONF_BUFFER_POINTER
+static u8_t uip_own_buf[UIP_BUFSIZE + 4] __attribute__ ((section ("AHBSRAM1")));
+u8_t *uip_buf = uip_own_buf;     /* The packet buffer, unless it has
+                    been pointed at a received frame. */
+#else /* UIP_CONF_BUFFER_POINTER */
 u8_t uip_buf[UIP_BUFSIZE + 4] __attribute__ ((section ("AHBSRAM1")));   /* The packet buffer that contains
                     incoming packets. */
+#endif /* UIP_CONF_BUFFER_POINTER */
 #endif /* UIP_CONF_EXTERNAL_BUFFER */
 
 void *uip_appdata;               /* The uip_appdata pointer points to
@@ -194,11 +200,19 @@ static u16_t ipid;           /* Ths ipid variable is an increasing
                 number that is used for the IP ID
                 field. */
 
+static u16_t tcp_mss = UIP_TCP_MSS; /* The MSS we offer, at most what
+                uip_buf has room for. */
+
 void uip_setipid(u16_t id)
 {
     ipid = id;
 }
 
+void uip_setmss(u16_t mss)
+{
+    tcp_mss = (mss == 0 || mss > UIP_TCP_MSS) ? UIP_TCP_MSS : mss;
+}
+
 static u8_t iss[4];          /* The iss variable is used for the TCP
                 initial sequence number. */
 
@@ -472,7 +486,7 @@ again:
     conn->snd_nxt[2] = iss[2];
     conn->snd_nxt[3] = iss[3];
 
-    conn->initialmss = conn->mss = UIP_TCP_MSS;
+    conn->initialmss = conn->mss = tcp_mss;
 
     conn->len = 1;   /* TCP length of the SYN is one. */
     conn->nrtx = 0;
@@ -1365,7 +1379,7 @@ found_listen:
                 tmp16 = ((u16_t)uip_buf[UIP_TCPIP_HLEN + UIP_LLH_LEN + 2 + c] << 8) |
                         (u16_t)uip_buf[UIP_IPTCPH_LEN + UIP_LLH_LEN + 3 + c];
                 uip_connr->initialmss = uip_connr->mss =
-                                            tmp16 > UIP_TCP_MSS ? UIP_TCP_MSS : tmp16;
+                                            tmp16 > tcp_mss ? tcp_mss : tmp16;
 
                 /* And we are done processing options. */
                 break;
@@ -1398,8 +1412,8 @@ tcp_send_synack:
        SYNACK. */
     BUF->optdata[0] = TCP_OPT_MSS;
     BUF->optdata[1] = TCP_OPT_MSS_LEN;
-    BUF->optdata[2] = (UIP_TCP_MSS) / 256;
-    BUF->optdata[3] = (UIP_TCP_MSS) & 255;
+    BUF->optdata[2] = tcp_mss / 256;
+    BUF->optdata[3] = tcp_mss & 255;
     uip_len = UIP_IPTCPH_LEN + TCP_OPT_MSS_LEN;
     BUF->tcpoffset = ((UIP_TCPH_LEN + TCP_OPT_MSS_LEN) / 4) << 4;
     goto tcp_send;
@@ -1534,7 +1548,7 @@ found:
                             tmp16 = (uip_buf[UIP_TCPIP_HLEN + UIP_LLH_LEN + 2 + c] << 8) |
                                     uip_buf[UIP_TCPIP_HLEN + UIP_LLH_LEN + 3 + c];
                             uip_connr->initialmss =
-                                uip_connr->mss = tmp16 > UIP_TCP_MSS ? UIP_TCP_MSS : tmp16;
+                                uip_connr->mss = tmp16 > tcp_mss ? tcp_mss : tmp16;
 
                             /* And we are done processing options. */
                             break;
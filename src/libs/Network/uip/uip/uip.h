@@ -197,6 +197,14 @@ void uip_init(void);
  */
 void uip_setipid(u16_t id);
 
+/**
+ * Set the TCP maximum segment size offered to new connections.
+ *
+ * Anything above UIP_TCP_MSS, the most uip_buf can hold, is limited
+ * to UIP_TCP_MSS.
+ */
+void uip_setmss(u16_t mss);
+
 #ifdef __cplusplus
 }
 #endif
@@ -427,11 +435,22 @@ void uip_setipid(u16_t id);
  \endcode
  */
 
+#if UIP_CONF_BUFFER_POINTER
+/* uip_buf may be pointed at a received frame so that it is processed
+   where the driver put it, anything it points to must have room for
+   UIP_BUFSIZE+4 bytes. */
+#ifdef __cplusplus
+extern "C" u8_t *uip_buf;
+#else
+extern u8_t *uip_buf;
+#endif
+#else /* UIP_CONF_BUFFER_POINTER */
 #ifdef __cplusplus
 extern "C" u8_t uip_buf[UIP_BUFSIZE+4];
 #else
 extern u8_t uip_buf[UIP_BUFSIZE+4];
 #endif
+#endif /* UIP_CONF_BUFFER_POINTER */
 
 #ifdef __cplusplus
 extern "C" {
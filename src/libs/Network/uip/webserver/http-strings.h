@@ -9,16 +9,26 @@ extern const char http_11[9];
 extern const char http_content_type[15];
 extern const char http_content_length[17];
 extern const char http_cache_control[16];
+extern const char http_accept_encoding[18];
+extern const char http_gzip[5];
+extern const char http_gz[4];
+extern const char http_content_encoding_gzip[48];
 extern const char http_no_cache[9];
 extern const char http_texthtml[10];
 extern const char http_location[11];
 extern const char http_host[7];
+extern const char http_connection[13];
+extern const char http_close[6];
+extern const char http_keep_alive[11];
+extern const char http_chunk_end[6];
 extern const char http_crnl[3];
 extern const char http_index_html[12];
 extern const char http_404_html[10];
 extern const char http_referer[9];
 extern const char http_header_200[86];
 extern const char http_header_304[152];
+extern const char http_header_200_chunked[119];
+extern const char http_header_200_empty[110];
 extern const char http_header_404[61];
 extern const char http_header_503[58];
 extern const char http_content_type_plain[29];
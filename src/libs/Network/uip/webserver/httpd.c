@@ -74,6 +74,7 @@
 
 #include "CommandQueue.h"
 #include "CallbackStream.h"
+#include "SectorWriter.h"
 
 #include "c-fifo.h"
 
@@ -82,6 +83,7 @@
 #define STATE_BODY    2
 #define STATE_OUTPUT  3
 #define STATE_UPLOAD  4
+#define STATE_NEXT    5 // the response is sent and the connection is kept for another request
 
 #define GET  1
 #define POST 2
@@ -139,43 +141,32 @@ static void create_callback_stream(struct httpd_state *s)
     s->pstream = new_callback_stream(command_result, s);
 }
 
-// Used to save files to SDCARD during upload
-static FILE *fd;
-static char *output_filename = NULL;
-static int file_cnt = 0;
-static int open_file(const char *fn)
+// Used to save files to SDCARD during upload, the packets are gathered into whole sectors before being written
+static void *upload_file = NULL;
+static int close_file()
 {
-    if (output_filename != NULL) free(output_filename);
-    output_filename = malloc(strlen(fn) + 5);
-    strcpy(output_filename, "/sd/");
-    strcat(output_filename, fn);
-    fd = fopen(output_filename, "w");
-    if (fd == NULL) {
-        free(output_filename);
-        output_filename = NULL;
-        return 0;
-    }
-    return 1;
+    int ok = delete_sector_writer(upload_file);
+    upload_file = NULL;
+    return ok;
 }
 
-static int close_file()
+static int open_file(const char *fn)
 {
+    // an upload whose connection went away is still open
+    if (upload_file != NULL) close_file();
+
+    char *output_filename = malloc(strlen(fn) + 5);
+    if (output_filename == NULL) return 0;
+    strcpy(output_filename, "/sd/");
+    strcat(output_filename, fn);
+    upload_file = new_sector_writer(output_filename);
     free(output_filename);
-    output_filename = NULL;
-    fclose(fd);
-    return 1;
+    return upload_file != NULL;
 }
 
 static int save_file(uint8_t *buf, unsigned int len)
 {
-    if (fwrite(buf, 1, len, fd) == len) {
-        file_cnt += len;
-        // HACK alert work around bug causing file corruption when writing large amounts of data
-        if (file_cnt >= 400) {
-            file_cnt = 0;
-            fclose(fd);
-            fd = fopen(output_filename, "a");
-        }
+    if (sector_writer_write(upload_file, (const char *)buf, len)) {
         return 1;
 
     } else {
@@ -184,43 +175,132 @@ static int save_file(uint8_t *buf, unsigned int len)
     }
 }
 
+// the name with .gz on the end and any query left off, false if it does not fit
+static int gz_name(const char *fn, char *gz, int size)
+{
+    const char *q = strchr(fn, '?');
+    int n = q == NULL ? (int)strlen(fn) : q - fn;
+    if (n + (int)sizeof(http_gz) > size) return 0;
+    memcpy(gz, fn, n);
+    strcpy(&gz[n], http_gz);
+    return 1;
+}
+
 static int fs_open(struct httpd_state *s)
 {
+    char gz[sizeof(s->filename) + sizeof(http_gz)];
+
+    s->gzip = 0;
     if (strncmp(s->filename, "/sd/", 4) == 0) {
         DEBUG_PRINTF("Opening file %s\n", s->filename);
-        s->fd = fopen(s->filename, "r");
+        s->fd = NULL;
+        // a web UI on the card can have gzipped copies of its files next to them, as the one in flash does
+        if (s->accept_gzip && strncmp(s->filename, "/sd/webif/", 10) == 0 && gz_name(s->filename, gz, sizeof(gz))) {
+            s->fd = fopen(gz, "r");
+            s->gzip = s->fd != NULL;
+        }
+        if (s->fd == NULL) s->fd = fopen(s->filename, "r");
         if (s->fd == NULL) {
             DEBUG_PRINTF("Failed to open: %s\n", s->filename);
             return 0;
         }
+        // we read whole sectors straight into the packet buffer, a stdio buffer would just be an extra copy
+        setvbuf(s->fd, NULL, _IONBF, 0);
+        s->sd_pos = 0;
         return 1;
 
     } else {
         s->fd = NULL;
+        // makefsdata.pl stores a gzipped copy of the files it compresses well
+        if (s->accept_gzip && gz_name(s->filename, gz, sizeof(gz)) && httpd_fs_open(gz, &s->file)) {
+            s->gzip = 1;
+            return 1;
+        }
         return httpd_fs_open(s->filename, &s->file);
     }
 }
 
 /*---------------------------------------------------------------------------*/
+// packs as many of the results waiting as fit into one segment, in a chunk of its own when the reply is chunked,
+// the segment is kept in sendbuf until it is acked as a retransmission has to send it again
+static int fill_command_response(struct httpd_state *s)
+{
+    int size = uip_mss();
+    if (s->sendbuf == NULL) {
+        s->sendbuf = malloc(size);
+        if (s->sendbuf == NULL) {
+            // the results are lost, rather than the connection waiting for memory
+            while (fifo_size(s->fifo) > 0) {
+                char *str = fifo_pop(s->fifo);
+                if (str == NULL) s->command_count--;
+                else free(str);
+            }
+            return 0;
+        }
+    }
+
+    // a chunk is a 3 digit hex length, which the mss always fits in, then the data and a crlf
+    int start = s->chunked ? 5 : 0;
+    int end = size - (s->chunked ? 2 : 0);
+    int len = start;
+    while (len < end && s->command_count > 0) {
+        if (s->strbuf == NULL) {
+            if (fifo_size(s->fifo) == 0) break;
+            s->strbuf = fifo_pop(s->fifo);
+            s->stroff = 0;
+            if (s->strbuf == NULL) {
+                // a command has completed
+                s->command_count--;
+                continue;
+            }
+        }
+        // a result too big for what is left of this segment is split across the next ones
+        int n = strlen(&s->strbuf[s->stroff]);
+        if (n > end - len) n = end - len;
+        memcpy(&s->sendbuf[len], &s->strbuf[s->stroff], n);
+        len += n;
+        s->stroff += n;
+        if (s->strbuf[s->stroff] == '\0') {
+            free(s->strbuf);
+            s->strbuf = NULL;
+        }
+    }
+
+    if (len == start) return 0;
+    if (s->chunked) {
+        char hdr[6];
+        snprintf(hdr, sizeof(hdr), "%03x\r\n", len - start);
+        memcpy(s->sendbuf, hdr, 5);
+        memcpy(&s->sendbuf[len], http_crnl, 2);
+        len += 2;
+    }
+    return len;
+}
+
+static unsigned short generate_command_response(void *state)
+{
+    struct httpd_state *s = (struct httpd_state *)state;
+    memcpy(uip_appdata, s->sendbuf, s->len);
+    return s->len;
+}
+
 static PT_THREAD(send_command_response(struct httpd_state *s))
 {
     PSOCK_BEGIN(&s->sout);
 
-    do {
-        PSOCK_WAIT_UNTIL( &s->sout, fifo_size(s->fifo) > 0 );
-        s->strbuf = fifo_pop(s->fifo);
-        if (s->strbuf != NULL) {
-            // send it
-            DEBUG_PRINTF("Sending response: %s", s->strbuf);
-            // TODO send as much as we can in one packet
-            PSOCK_SEND_STR(&s->sout, s->strbuf);
-            // free the strdup
-            free(s->strbuf);
-        }else if(--s->command_count <= 0) {
-            // when all commands have completed exit
-            break;
+    // when all commands have completed exit
+    while (s->command_count > 0) {
+        PSOCK_WAIT_UNTIL( &s->sout, fifo_size(s->fifo) > 0 || s->strbuf != NULL );
+        s->len = fill_command_response(s);
+        if (s->len > 0) {
+            DEBUG_PRINTF("Sending response: %d bytes\n", s->len);
+            PSOCK_GENERATOR_SEND(&s->sout, generate_command_response, s);
         }
-    } while (1);
+    }
+    free(s->sendbuf);
+    s->sendbuf = NULL;
+
+    if (s->chunked) PSOCK_SEND_STR(&s->sout, http_chunk_end);
 
     PSOCK_END(&s->sout);
 }
@@ -244,7 +324,14 @@ static unsigned short generate_part_of_sd_file(void *state)
 {
     struct httpd_state *s = (struct httpd_state *)state;
 
-    int len = fread(uip_appdata, 1, uip_mss(), s->fd);
+    // a retransmission has to send the same segment again
+    if (uip_rexmit()) fseek(s->fd, s->sd_pos, SEEK_SET);
+
+    // when the segment is whole sectors FatFs reads the card with DMA into uip_buf, skipping its sector buffer
+    int n = uip_mss();
+    if (n >= 512) n &= ~511;
+
+    int len = fread(uip_appdata, 1, n, s->fd);
     if (len <= 0) {
         // we need to send something
         strcpy(uip_appdata, "\r\n");
@@ -277,6 +364,7 @@ static PT_THREAD(send_sd_file(struct httpd_state *s))
 
     do {
         PSOCK_GENERATOR_SEND(&s->sout, generate_part_of_sd_file, s);
+        s->sd_pos += s->len;
     } while (s->len > 0);
 
     fclose(s->fd);
@@ -294,6 +382,10 @@ static PT_THREAD(send_headers_3(struct httpd_state *s, const char *statushdr, ch
 
     PSOCK_SEND_STR(&s->sout, statushdr);
 
+    if (send_content_type && s->gzip) {
+        PSOCK_SEND_STR(&s->sout, http_content_encoding_gzip);
+    }
+
     if (send_content_type) {
         ptr = strrchr(s->filename, ISO_period);
         if (ptr == NULL) {
@@ -327,13 +419,16 @@ PT_THREAD(handle_output(struct httpd_state *s))
     if (s->method == POST) {
         if (strcmp(s->filename, "/command") == 0) {
             DEBUG_PRINTF("Executed command post\n");
-            PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
+            // a connection that is kept open needs to be told where the reply ends, which is unknown until all
+            // the commands have run, so it comes in chunks
+            s->chunked = s->keep_alive;
+            PT_WAIT_THREAD(&s->outputpt, send_headers(s, s->chunked ? http_header_200_chunked : http_header_200));
             // send response as we get it
             PT_WAIT_THREAD(&s->outputpt, send_command_response(s));
 
         } else if (strcmp(s->filename, "/command_silent") == 0) {
             DEBUG_PRINTF("Executed silent command post\n");
-            PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
+            PT_WAIT_THREAD(&s->outputpt, send_headers(s, s->keep_alive ? http_header_200_empty : http_header_200));
 
         } else if (strcmp(s->filename, "/upload") == 0) {
             DEBUG_PRINTF("upload output: %d\n", s->uploadok);
@@ -386,6 +481,13 @@ PT_THREAD(handle_output(struct httpd_state *s))
         }
     }
 
+    // only the command posts are kept open, the rest of the replies end when the connection closes
+    if (s->keep_alive && s->method == POST &&
+        (strcmp(s->filename, "/command") == 0 || strcmp(s->filename, "/command_silent") == 0)) {
+        s->state = STATE_NEXT;
+        PT_EXIT(&s->outputpt);
+    }
+
     PSOCK_CLOSE(&s->sout);
     PT_END(&s->outputpt);
 }
@@ -457,9 +559,8 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
         }
     }
 
-    close_file();
-    s->uploadok = 1;
-    DEBUG_PRINTF("finished upload\n");
+    s->uploadok = close_file();
+    DEBUG_PRINTF("finished upload: %d\n", s->uploadok);
 
     PT_END(&s->inputpt);
 }
@@ -502,6 +603,10 @@ PT_THREAD(handle_input(struct httpd_state *s))
     s->state = STATE_HEADERS;
     s->content_length = 0;
     s->cache_page = 0;
+    s->accept_gzip = 0;
+    s->gzip = 0;
+    s->keep_alive = 0;
+    s->chunked = 0;
     while (1) {
         if (s->state == STATE_HEADERS) {
             // read the headers of the request
@@ -522,7 +627,16 @@ PT_THREAD(handle_input(struct httpd_state *s))
             } else {
                 DEBUG_PRINTF("reading header: %s\n", s->inputbuf);
                 // handle headers here
-                if (strncmp(s->inputbuf, http_content_length, sizeof(http_content_length) - 1) == 0) {
+                if (strncmp(s->inputbuf, http_11, sizeof(http_11) - 1) == 0) {
+                    // the rest of the request line, HTTP/1.1 keeps the connection unless told otherwise
+                    s->keep_alive = 1;
+
+                } else if (strncmp(s->inputbuf, http_connection, sizeof(http_connection) - 1) == 0) {
+                    const char *v = &s->inputbuf[sizeof(http_connection) - 1];
+                    if (strncasecmp(v, http_close, sizeof(http_close) - 1) == 0) s->keep_alive = 0;
+                    else if (strncasecmp(v, http_keep_alive, sizeof(http_keep_alive) - 1) == 0) s->keep_alive = 1;
+
+                } else if (strncmp(s->inputbuf, http_content_length, sizeof(http_content_length) - 1) == 0) {
                     s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
                     s->content_length = atoi(&s->inputbuf[sizeof(http_content_length) - 1]);
                     DEBUG_PRINTF("Content length= %s, %d\n", &s->inputbuf[sizeof(http_content_length) - 1], s->content_length);
@@ -536,6 +650,10 @@ PT_THREAD(handle_input(struct httpd_state *s))
                     s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
                     s->cache_page = strncmp(http_no_cache, &s->inputbuf[sizeof(http_cache_control) - 1], sizeof(http_no_cache) - 1) != 0;
                     DEBUG_PRINTF("cache page= %d\n", s->cache_page);
+
+                } else if (strncmp(s->inputbuf, http_accept_encoding, sizeof(http_accept_encoding) - 1) == 0) {
+                    s->accept_gzip = strstr(&s->inputbuf[sizeof(http_accept_encoding) - 1], http_gzip) != NULL;
+                    DEBUG_PRINTF("accept gzip= %d\n", s->accept_gzip);
                 }
             }
 
@@ -589,6 +707,23 @@ PT_THREAD(handle_input(struct httpd_state *s))
     PSOCK_END(&s->sin);
 }
 /*---------------------------------------------------------------------------*/
+// after a reply on a connection that is kept open, it goes back to waiting for the next request
+static void
+next_request(struct httpd_state *s)
+{
+    if (s->pstream != NULL) {
+        delete_fifo(s->fifo);
+        delete_callback_stream(s->pstream); // this will mark it as closed and will get deleted when no longer needed
+        s->pstream = NULL;
+        s->fifo = NULL;
+    }
+    PSOCK_INIT(&s->sin, s->inputbuf, sizeof(s->inputbuf) - 1);
+    PSOCK_INIT(&s->sout, s->inputbuf, sizeof(s->inputbuf) - 1);
+    PT_INIT(&s->outputpt);
+    PT_INIT(&s->inputpt);
+    s->state = STATE_WAITING;
+}
+
 static void
 handle_connection(struct httpd_state *s)
 {
@@ -597,6 +732,7 @@ handle_connection(struct httpd_state *s)
     }
     if (s->state == STATE_OUTPUT) {
         handle_output(s);
+        if (s->state == STATE_NEXT) next_request(s);
     }
 }
 /*---------------------------------------------------------------------------*/
@@ -627,6 +763,7 @@ httpd_appcall(void)
         s->timer = 0;
         s->fd = NULL;
         s->strbuf = NULL;
+        s->sendbuf = NULL;
         s->fifo = NULL;
         s->pstream = NULL;
     }
@@ -639,6 +776,8 @@ httpd_appcall(void)
 
     // check for timeout on connection here so we can cleanup if we abort
     if (uip_poll()) {
+        // results held back while more of the posted commands were queued
+        if (s->pstream != NULL) flush_callback_stream(s->pstream);
         ++s->timer;
         if (s->timer >= 20 * 2) { // we have a 0.5 second poll and we want 20 second timeout
             DEBUG_PRINTF("Timer expired, aborting\n");
@@ -650,8 +789,9 @@ httpd_appcall(void)
 
     if (uip_closed() || uip_aborted() || uip_timedout()) {
         DEBUG_PRINTF("Closing connection: %d\n", HTONS(uip_conn->rport));
-        if (s->fd != NULL) fclose(fd); // clean up
+        if (s->fd != NULL) fclose(s->fd); // clean up
         if (s->strbuf != NULL) free(s->strbuf);
+        if (s->sendbuf != NULL) free(s->sendbuf);
         if (s->pstream != NULL) {
             // free these if they were allocated
             delete_fifo(s->fifo);
@@ -662,6 +802,15 @@ httpd_appcall(void)
 
     } else {
         handle_connection(s);
+
+        // commands posted faster than they run stop the sender until the queue has drained
+        if (s->state == STATE_BODY && !uip_stopped(uip_conn) && network_commands_backlogged()) {
+            DEBUG_PRINTF("Command queue backlogged, stopped: %d\n", HTONS(uip_conn->rport));
+            uip_stop();
+
+        } else if (uip_poll() && uip_stopped(uip_conn) && network_commands_drained()) {
+            uip_restart();
+        }
     }
 }
 
@@ -50,13 +50,20 @@ struct httpd_state {
   char state;
   struct httpd_fs_file file;
   FILE *fd;
+  long sd_pos;
   uint16_t len;
-  char *strbuf;
+  char *strbuf;         // a command result being sent, from stroff
+  uint16_t stroff;
+  char *sendbuf;        // the segment of command results being sent
   int content_length;
   uint16_t count;
   uint8_t uploadok;
   uint8_t upload_state;
   uint8_t cache_page;
+  uint8_t accept_gzip;  // the request said it takes gzip
+  uint8_t gzip;         // what is being sent is gzipped
+  uint8_t keep_alive;   // the client wants the connection kept for another request
+  uint8_t chunked;      // the reply is in chunks, as its length is not known when it starts
   void *pstream;
   void *fifo;
   uint16_t command_count;
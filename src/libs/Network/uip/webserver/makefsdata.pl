@@ -1,5 +1,7 @@
 #!/usr/bin/perl
 
+use IO::Compress::Gzip qw(gzip $GzipError);
+
 open(OUTPUT, "> httpd-fsdata2.h");
 
 chdir("httpd-fs");
@@ -21,42 +23,57 @@ foreach $file (@files) {
     }
 }
 
-foreach $file (@files) {
+# a file that gzip makes at least a fifth smaller is also stored compressed as <file>.gz, which the httpd sends to
+# clients that accept gzip, the .gz has to come after the file as the list is searched from the end
+sub add_file {
+    my ($file, $data) = @_;
+
+    $fvar = $file;
+    $fvar =~ s-/-_-g;
+    $fvar =~ s-\.-_-g;
+    # for AVR, add PROGMEM here
+    print(OUTPUT "static const unsigned char data".$fvar."[] = {\n");
+    print(OUTPUT "\t/* $file */\n\t");
+    for($j = 0; $j < length($file); $j++) {
+        printf(OUTPUT "%#02x, ", unpack("C", substr($file, $j, 1)));
+    }
+    printf(OUTPUT "0,\n");
+
+    for($j = 0; $j < length($data); $j++) {
+        if($j % 10 == 0) {
+            print(OUTPUT "\t");
+        }
+        printf(OUTPUT "%#02x, ", unpack("C", substr($data, $j, 1)));
+        if($j % 10 == 9) {
+            print(OUTPUT "\n");
+        }
+    }
+    print(OUTPUT "0};\n\n");
+    push(@fvars, $fvar);
+    push(@pfiles, $file);
+}
+
+# sorted so the output is the same however the directory is read
+foreach $file (sort @files) {
     if(-f $file) {
 
 	print "Adding file $file\n";
 
 	open(FILE, $file) || die "Could not open file $file\n";
+	binmode(FILE);
+	local $/;
+	$data = <FILE>;
+	close(FILE);
 
 	$file =~ s-^-/-;
-	$fvar = $file;
-	$fvar =~ s-/-_-g;
-	$fvar =~ s-\.-_-g;
-	# for AVR, add PROGMEM here
-	print(OUTPUT "static const unsigned char data".$fvar."[] = {\n");
-	print(OUTPUT "\t/* $file */\n\t");
-	for($j = 0; $j < length($file); $j++) {
-	    printf(OUTPUT "%#02x, ", unpack("C", substr($file, $j, 1)));
-	}
-	printf(OUTPUT "0,\n");
-
-
-	$i = 0;
-	while(read(FILE, $data, 1)) {
-	    if($i == 0) {
-		print(OUTPUT "\t");
-	    }
-	    printf(OUTPUT "%#02x, ", unpack("C", $data));
-	    $i++;
-	    if($i == 10) {
-		print(OUTPUT "\n");
-		$i = 0;
-	    }
+	add_file($file, $data);
+
+	# minimal leaves out the name and time, so the output only changes when the file does
+	gzip(\$data => \$gz, -Level => 9, -Minimal => 1) || die "Could not compress $file: $GzipError\n";
+	if(length($gz) * 5 <= length($data) * 4) {
+	    print "Adding file $file.gz, ".length($gz)." bytes from ".length($data)."\n";
+	    add_file("$file.gz", $gz);
 	}
-	print(OUTPUT "0};\n\n");
-	close(FILE);
-	push(@fvars, $fvar);
-	push(@pfiles, $file);
     }
 }
 
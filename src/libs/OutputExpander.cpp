@@ -0,0 +1,209 @@
+#include "OutputExpander.h"
+
+#include "libs/Kernel.h"
+#include "libs/StreamOutputPool.h"
+#include "SlowTicker.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "platform_memory.h"
+#include "utils.h"
+#include "mbed.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <vector>
+
+#define output_expander_enable_checksum       CHECKSUM("output_expander_enable")
+#define output_expander_spi_channel_checksum  CHECKSUM("output_expander_spi_channel")
+#define output_expander_latch_pin_checksum    CHECKSUM("output_expander_latch_pin")
+#define output_expander_bytes_checksum        CHECKSUM("output_expander_bytes")
+#define output_expander_frequency_checksum    CHECKSUM("output_expander_frequency")
+#define output_expander_update_hz_checksum    CHECKSUM("output_expander_update_hz")
+
+#define panel_checksum                        CHECKSUM("panel")
+#define temperature_control_checksum          CHECKSUM("temperature_control")
+#define enable_checksum                       CHECKSUM("enable")
+#define spi_channel_checksum                  CHECKSUM("spi_channel")
+#define sensor_checksum                       CHECKSUM("sensor")
+
+// the SD card has channels 0 and 1, this is the lowest priority one
+#define EXPANDER_DMA_CHANNEL  LPC_GPDMACH7
+#define EXPANDER_DMA_BIT      (1 << 7)
+
+#define SSP_SR_RNE  (1 << 2)
+#define SSP_SR_BSY  (1 << 4)
+
+OutputExpander *OutputExpander::instance_ = nullptr;
+bool OutputExpander::loaded = false;
+
+OutputExpander::OutputExpander()
+{
+    spi = nullptr;
+    ssp = nullptr;
+    frame = nullptr;
+    bytes = 0;
+    tx_request = 0;
+    dirty = false;
+    in_flight = false;
+    memset(state, 0, sizeof(state));
+}
+
+OutputExpander *OutputExpander::instance()
+{
+    if(!loaded) {
+        loaded = true;
+        if(THEKERNEL->config->value(output_expander_enable_checksum)->by_default(false)->as_bool()) {
+            OutputExpander *e = new OutputExpander();
+            if(e->setup()) instance_ = e;
+            else delete e;
+        }
+    }
+    return instance_;
+}
+
+bool OutputExpander::setup()
+{
+    latch_pin.from_string(THEKERNEL->config->value(output_expander_latch_pin_checksum)->by_default("nc")->as_string())->as_output();
+    if(!latch_pin.connected()) {
+        THEKERNEL->streams->printf("output_expander_latch_pin is not set, the expander is off\r\n");
+        return false;
+    }
+    latch_pin.set(false);
+
+    int n = THEKERNEL->config->value(output_expander_bytes_checksum)->by_default(1)->as_number();
+    if(n < 1 || n > max_bytes) {
+        THEKERNEL->streams->printf("output_expander_bytes has to be 1 to %d, the expander is off\r\n", max_bytes);
+        return false;
+    }
+    frame = (uint8_t *)AHB0.alloc(n);
+    if(frame == nullptr) {
+        THEKERNEL->streams->printf("No AHB SRAM for the output expander, it is off\r\n");
+        return false;
+    }
+    bytes = n;
+
+    // the channel has to be its own, the transfers go on in the background. SSP1 is the SD card's
+    if(THEKERNEL->config->value(output_expander_spi_channel_checksum)->by_default(0)->as_number() != 0) {
+        THEKERNEL->streams->printf("output_expander_spi_channel has to be 0, 1 is the SD card, the expander is off\r\n");
+        return false;
+    }
+    const char *user = channel_user();
+    if(user != nullptr) {
+        THEKERNEL->streams->printf("SPI channel 0 is used by the %s, the expander is off\r\n", user);
+        return false;
+    }
+    spi = new mbed::SPI(P0_18, P0_17, P0_15);
+    ssp = LPC_SSP0;
+    tx_request = 0;
+    spi->format(8);
+    spi->frequency(THEKERNEL->config->value(output_expander_frequency_checksum)->by_default(4000000)->as_number());
+
+    // power up the GPDMA, the transmit fifo asks it for more whenever it is half empty
+    LPC_SC->PCONP |= (1UL << 29);
+    LPC_GPDMA->DMACConfig = 1;
+    ssp->DMACR = 2; // TXDMAE
+
+    // all off to begin with
+    dirty = true;
+    int hz = THEKERNEL->config->value(output_expander_update_hz_checksum)->by_default(1000)->as_number();
+    THEKERNEL->slow_ticker->attach<OutputExpander, &OutputExpander::tick>(hz < 1 ? 1 : hz, this);
+    return true;
+}
+
+// what else is configured on SPI channel 0, nullptr if nothing. Everything that can be is looked at rather than what has
+// been loaded so far, the expander is set up by the first switch that has one of its outputs
+const char *OutputExpander::channel_user()
+{
+    if(THEKERNEL->config->value(panel_checksum, enable_checksum)->by_default(false)->as_bool() &&
+       THEKERNEL->config->value(panel_checksum, spi_channel_checksum)->by_default(0)->as_number() == 0) {
+        return "panel";
+    }
+
+    std::vector<uint16_t> modules;
+    THEKERNEL->config->get_module_list(&modules, temperature_control_checksum, true);
+    for (auto m : modules) {
+        if(THEKERNEL->config->value(temperature_control_checksum, m, sensor_checksum)->by_default("")->as_string() == "max31855" &&
+           THEKERNEL->config->value(temperature_control_checksum, m, spi_channel_checksum)->by_default(0)->as_number() == 0) {
+            return "max31855 of a temperature control";
+        }
+    }
+    return nullptr;
+}
+
+void OutputExpander::set(uint16_t output, bool value)
+{
+    if(output >= outputs()) return;
+    uint8_t bit = 1 << (output & 7);
+    if(value) state[output >> 3] |= bit;
+    else state[output >> 3] &= ~bit;
+    dirty = true;
+}
+
+void OutputExpander::apply(const uint8_t *set_bits, const uint8_t *clr_bits)
+{
+    __disable_irq();
+    for (int i = 0; i < bytes; ++i) state[i] = (state[i] | set_bits[i]) & ~clr_bits[i];
+    dirty = true;
+    __enable_irq();
+}
+
+// in the tick, the latch goes low for the registers to take the next rising edge
+void OutputExpander::start_transfer()
+{
+    dirty = false;
+    latch_pin.set(false);
+
+    // the register at the end of the chain goes first, each MSB first so bit 7 ends up on Q7
+    for (int i = 0; i < bytes; ++i) frame[i] = state[bytes - 1 - i];
+
+    LPC_GPDMA->DMACIntTCClear = EXPANDER_DMA_BIT;
+    LPC_GPDMA->DMACIntErrClr = EXPANDER_DMA_BIT;
+
+    // the frame to the SSP data register, bytes in bursts of 4, source increments
+    EXPANDER_DMA_CHANNEL->DMACCSrcAddr = (uint32_t) frame;
+    EXPANDER_DMA_CHANNEL->DMACCDestAddr = (uint32_t) &ssp->DR;
+    EXPANDER_DMA_CHANNEL->DMACCLLI = 0;
+    EXPANDER_DMA_CHANNEL->DMACCControl = bytes | (1 << 12) | (1 << 15) | (1UL << 26);
+    EXPANDER_DMA_CHANNEL->DMACCConfig = 1 | (tx_request << 6) | (1 << 11);
+    in_flight = true;
+}
+
+// Called from the SlowTicker interrupt, latches what was sent on the tick before and sends any changes since
+uint32_t OutputExpander::tick(uint32_t)
+{
+    if(in_flight) {
+        // the channel turns itself off after the last byte, which is sent once the SSP is no longer busy
+        if((EXPANDER_DMA_CHANNEL->DMACCConfig & 1) || (ssp->SR & SSP_SR_BSY)) return 0;
+        latch_pin.set(true);
+        in_flight = false;
+
+        // nothing is read, empty the receive fifo and clear the overrun
+        while(ssp->SR & SSP_SR_RNE) (void) ssp->DR;
+        ssp->ICR = 1;
+    }
+    if(dirty) start_transfer();
+    return 0;
+}
+
+ExpanderPin *ExpanderPin::from_string(const std::string &value)
+{
+    valid = false;
+    inverting = false;
+    OutputExpander *expander = OutputExpander::instance();
+    if(!is_expander(value) || expander == nullptr) return this;
+
+    const char *cs = value.c_str() + 1;
+    char *cn = NULL;
+    long n = strtol(cs, &cn, 10);
+    if(cn == cs || n < 0 || n >= expander->outputs()) return this;
+
+    // ! = invert, as for a Pin
+    for (; *cn; cn++) {
+        if(*cn == '!') inverting = true;
+        else if(!is_whitespace(*cn)) break;
+    }
+    output = n;
+    valid = true;
+    return this;
+}
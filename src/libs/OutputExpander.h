@@ -0,0 +1,74 @@
+#ifndef _OUTPUTEXPANDER_H
+#define _OUTPUTEXPANDER_H
+
+#include "libs/Pin.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace mbed {
+    class SPI;
+}
+
+/*
+ * Outputs on a chain of 74HC595 shift registers, or anything else that is shifted in and latched, on an SPI channel
+ * of its own. Output x0 is Q0 of the register nearest the board, x8 Q0 of the next one along the chain.
+ * Changes are collected and the whole chain is sent from the SlowTicker at output_expander_update_hz, one GPDMA
+ * transfer from AHB SRAM, and latched on the tick after, once the SSP has shifted it all out. A tick with nothing
+ * to send or latch costs a couple of tests, however many outputs there are.
+ */
+class OutputExpander
+{
+public:
+    // nullptr unless output_expander_enable is set and it could be set up, the config is read the first time
+    static OutputExpander *instance();
+
+    static const int max_bytes = 16;
+
+    int outputs() const { return bytes * 8; }
+
+    // from the main loop, the change goes out on the next tick
+    void set(uint16_t output, bool value);
+    // sets and clears several at once, so they all go out in the same transfer
+    void apply(const uint8_t *set_bits, const uint8_t *clr_bits);
+
+private:
+    OutputExpander();
+    bool setup();
+    static const char *channel_user();
+    void start_transfer();
+    uint32_t tick(uint32_t);
+
+    mbed::SPI *spi;
+    LPC_SSP_TypeDef *ssp;
+    Pin latch_pin;
+    uint8_t *frame;             // what is being sent, in AHB SRAM where the GPDMA can read it
+    uint8_t state[max_bytes];
+    uint8_t bytes;
+    uint8_t tx_request;
+    volatile bool dirty;
+    volatile bool in_flight;    // sent but not latched yet
+
+    static OutputExpander *instance_;
+    static bool loaded;
+};
+
+// An output of the expander, x and its number in a pin string, with ! to invert it as for a Pin
+class ExpanderPin
+{
+public:
+    ExpanderPin() : output(0), inverting(false), valid(false) {}
+
+    static bool is_expander(const std::string &value) { return !value.empty() && (value[0] == 'x' || value[0] == 'X'); }
+
+    // not connected if the expander is not enabled or does not have the output
+    ExpanderPin *from_string(const std::string &value);
+    bool connected() const { return valid; }
+    void set(bool value) { if(valid) OutputExpander::instance()->set(output, inverting ^ value); }
+
+    uint16_t output;
+    bool inverting;
+    bool valid;
+};
+
+#endif
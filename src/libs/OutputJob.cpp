@@ -0,0 +1,59 @@
+#include "OutputJob.h"
+#include "StreamOutput.h"
+
+OutputJob *OutputJob::pending= nullptr;
+
+void OutputJob::start(OutputJob *job, StreamOutput *stream)
+{
+    if(!stream->is_persistent() || stream->tx_room() < 0) {
+        while(job->write_next(stream)) ;
+        delete job;
+        return;
+    }
+
+    job->stream= stream;
+    job->next= nullptr;
+    OutputJob **p= &pending;
+    while(*p != nullptr) p= &(*p)->next;
+    *p= job;
+}
+
+bool OutputJob::is_pending(StreamOutput *stream)
+{
+    for (OutputJob *j= pending; j != nullptr; j= j->next) {
+        if(j->stream == stream) return true;
+    }
+    return false;
+}
+
+void OutputJob::run_pending()
+{
+    OutputJob **p= &pending;
+    while(*p != nullptr) {
+        OutputJob *job= *p;
+
+        // only the first job for each stream, the others wait their turn
+        bool first= true;
+        for (OutputJob *j= pending; j != job; j= j->next) {
+            if(j->stream == job->stream) {
+                first= false;
+                break;
+            }
+        }
+
+        bool more= true;
+        if(first) {
+            // a few pieces a pass at most, a fast link still leaves time for the rest of the loop
+            for (int i= 0; i < 4 && more && job->stream->tx_room() >= chunk; i++) {
+                more= job->write_next(job->stream);
+            }
+        }
+
+        if(more) {
+            p= &job->next;
+        } else {
+            *p= job->next;
+            delete job;
+        }
+    }
+}
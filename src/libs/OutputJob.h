@@ -0,0 +1,34 @@
+#ifndef _OUTPUTJOB_H_
+#define _OUTPUTJOB_H_
+
+#include <stdint.h>
+
+class StreamOutput;
+
+// A long report written a piece at a time, so a slow link doesn't hold up the main loop while it takes it all in.
+// Each pass of the main loop writes pieces for as long as the stream has room for them in its transmit buffer, a
+// stream that can't say how much room it has, or may not be there later, gets it all at once as before.
+// The jobs for a stream go out one after another, each is deleted when it is done.
+class OutputJob {
+    public:
+        OutputJob() : stream(nullptr), next(nullptr) {}
+        virtual ~OutputJob() {}
+
+        // writes the next piece, no more than about chunk bytes, false when there is nothing left to write
+        virtual bool write_next(StreamOutput *stream) = 0;
+
+        // takes the job over, it is written to stream from the main loop or, if it can't wait, right away
+        static void start(OutputJob *job, StreamOutput *stream);
+        // call it from the main loop
+        static void run_pending();
+        static bool is_pending(StreamOutput *stream);
+
+        static const int chunk= 128;
+
+    private:
+        StreamOutput *stream;
+        OutputJob *next;
+        static OutputJob *pending;
+};
+
+#endif
@@ -156,9 +156,41 @@ Pin* Pin::pull_down(){
     return this;
 }
 
+// PWM1 channels handed out so far, bit n for PWM1.n
+uint8_t Pin::pwm1_claimed= 0;
+
+// The PWM1 channel this pin can be driven from, 0 if it has none
+int Pin::pwm1_channel() const
+{
+    if (port_number == 1)
+    {
+        if (pin == 18) { return 1; }
+        if (pin == 20) { return 2; }
+        if (pin == 21) { return 3; }
+        if (pin == 23) { return 4; }
+        if (pin == 24) { return 5; }
+        if (pin == 26) { return 6; }
+    }
+    else if (port_number == 2)
+    {
+        if (pin <= 5) { return pin + 1; }
+    }
+    else if (port_number == 3)
+    {
+        if (pin == 25) { return 2; }
+        if (pin == 26) { return 3; }
+    }
+    return 0;
+}
+
 // If available on this pin, return mbed hardware pwm class for this pin
+// A channel is on more than one pin, P1.18 and P2.0 are both PWM1.1, so once handed out it is not again
 mbed::PwmOut* Pin::hardware_pwm()
 {
+    int channel = pwm1_channel();
+    if (channel == 0 || (pwm1_claimed & (1 << channel))) { return nullptr; }
+    pwm1_claimed |= 1 << channel;
+
     if (port_number == 1)
     {
         if (pin == 18) { return new mbed::PwmOut(P1_18); }
@@ -62,7 +62,9 @@ class Pin {
                 this->port->FIOCLR = 1 << this->pin;
         }
 
+        // nullptr if the pin has no PWM1 channel or its channel has already been taken
         mbed::PwmOut *hardware_pwm();
+        int pwm1_channel() const;
 
         // these should be private, and use getters
         LPC_GPIO_TypeDef* port;
@@ -73,6 +75,9 @@ class Pin {
             bool inverting:1;
             bool valid:1;
         };
+
+    private:
+        static uint8_t pwm1_claimed;
 };
 
 
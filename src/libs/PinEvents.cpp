@@ -0,0 +1,115 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PinEvents.h"
+
+#include "libs/Kernel.h"
+#include "libs/Pin.h"
+#include "SlowTicker.h"
+#include "InterruptIn.h"
+#include "port_api.h"
+
+PinEvents *PinEvents::instance_ = nullptr;
+
+PinEvents::PinEvents()
+{
+    ticking = false;
+}
+
+PinEvents *PinEvents::instance()
+{
+    if(instance_ == nullptr) instance_ = new PinEvents();
+    return instance_;
+}
+
+bool PinEvents::can_interrupt(const Pin *pin)
+{
+    return pin->valid && (pin->port_number == 0 || pin->port_number == 2);
+}
+
+PinEvents::Input *PinEvents::add(Pin *pin, uint16_t debounce_ms)
+{
+    if(!pin->connected() || (debounce_ms == 0 && !can_interrupt(pin))) return nullptr;
+
+    Input *in = new Input();
+    in->pin = pin;
+    in->irq = nullptr;
+    in->debounce_ticks = 0;
+    if(debounce_ms > 0) {
+        // at least one tick, rounded up so it is never less than asked for
+        int ticks = (debounce_ms * tick_frequency + 999) / 1000;
+        in->debounce_ticks = ticks > 255 ? 255 : ticks;
+    }
+    in->stable = 0;
+    in->state = pin->get();
+    in->changing = false;
+    return in;
+}
+
+// the callback has to be set before the pin can interrupt or be polled
+void PinEvents::start(Input *in)
+{
+    Pin *pin = in->pin;
+    if(can_interrupt(pin)) {
+        // InterruptIn puts a pull down on the pin, keep the pull up or down it was given
+        volatile uint32_t *mode = &LPC_PINCON->PINMODE0 + pin->port_number * 2 + (pin->pin >> 4);
+        uint32_t saved = *mode;
+        in->irq = new mbed::InterruptIn(port_pin((PortName)pin->port_number, pin->pin));
+        in->irq->rise(in, &Input::on_edge);
+        in->irq->fall(in, &Input::on_edge);
+        *mode = saved;
+
+        // same priority as the step timer, as Endstops and ZProbe need for theirs
+        NVIC_SetPriority(EINT3_IRQn, 2);
+    }
+
+    __disable_irq();
+    inputs.push_back(in);
+    __enable_irq();
+
+    if(in->debounce_ticks > 0 && !ticking) {
+        ticking = true;
+        THEKERNEL->slow_ticker->attach<PinEvents, &PinEvents::tick>(tick_frequency, this);
+    }
+}
+
+// Called from the GPIO interrupt, a pin being debounced starts again on every bounce
+void PinEvents::Input::on_edge()
+{
+    if(debounce_ticks == 0) {
+        state = pin->get();
+        callback.call(state);
+        return;
+    }
+    stable = 0;
+    changing = true;
+}
+
+// Called from the SlowTicker interrupt, an interrupt pin is only read while it is changing
+uint32_t PinEvents::tick(uint32_t)
+{
+    for (Input *in : inputs) {
+        if(in->debounce_ticks == 0 || (in->irq != nullptr && !in->changing)) continue;
+
+        bool s = in->pin->get();
+        if(s == in->state) {
+            // it went back before it had settled
+            in->changing = false;
+            continue;
+        }
+        if(!in->changing) {
+            in->changing = true;
+            in->stable = 0;
+        }
+        if(++in->stable < in->debounce_ticks) continue;
+
+        in->changing = false;
+        in->state = s;
+        in->callback.call(s);
+    }
+    return 0;
+}
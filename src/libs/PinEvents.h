@@ -0,0 +1,74 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _PINEVENTS_H
+#define _PINEVENTS_H
+
+#include "libs/FPointer.h"
+
+#include <vector>
+#include <stdint.h>
+
+class Pin;
+namespace mbed {
+    class InterruptIn;
+}
+
+/*
+ * Calls back when an input pin changes, with what Pin::get() now reads as the argument.
+ * Pins on P0 and P2 are watched by the GPIO interrupt and cost nothing until they change, the others are read on the
+ * SlowTicker at tick_frequency. A change is passed on from the SlowTicker interrupt once the pin has read the same for
+ * the debounce time. With no debounce every edge is passed on straight from the GPIO interrupt, which only pins on
+ * P0 and P2 can have, attach fails for the others so the caller can poll them instead.
+ * The Pin has to stay where it is for as long as the firmware runs.
+ */
+class PinEvents
+{
+public:
+    static PinEvents *instance();
+
+    template<typename T> bool attach(Pin *pin, uint16_t debounce_ms, T *optr, uint32_t ( T::*fptr )( uint32_t ))
+    {
+        Input *in = add(pin, debounce_ms);
+        if(in == nullptr) return false;
+        in->callback.attach(optr, fptr);
+        start(in);
+        return true;
+    }
+
+    static bool can_interrupt(const Pin *pin);
+
+    static const uint16_t tick_frequency = 100;
+    static const uint16_t default_debounce_ms = 20;
+
+private:
+    PinEvents();
+
+    class Input {
+        public:
+            void on_edge();
+
+            Pin *pin;
+            FPointer callback;
+            mbed::InterruptIn *irq;    // nullptr for a polled pin
+            uint8_t debounce_ticks;    // 0 to call back on every edge from the interrupt
+            volatile uint8_t stable;   // ticks the pin has read the new state for
+            volatile bool state;       // the last one passed on
+            volatile bool changing;
+    };
+
+    Input *add(Pin *pin, uint16_t debounce_ms);
+    void start(Input *in);
+    uint32_t tick(uint32_t);
+
+    std::vector<Input*> inputs;
+    bool ticking;
+
+    static PinEvents *instance_;
+};
+
+#endif
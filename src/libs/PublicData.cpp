@@ -2,9 +2,29 @@
 #include "PublicData.h"
 #include "PublicDataRequest.h"
 
+#include <algorithm>
+
+std::vector<PublicData::Owner> PublicData::owners;
+
+void PublicData::register_owner(uint16_t csa, Module *module) {
+    auto i= std::upper_bound(owners.begin(), owners.end(), csa, [](uint16_t cs, const Owner& o) { return cs < o.first; });
+    owners.insert(i, Owner(csa, module));
+}
+
+bool PublicData::route(uint16_t csa, void (Module::*handler)(void *), void *pdr) {
+    auto i= std::lower_bound(owners.begin(), owners.end(), csa, [](const Owner& o, uint16_t cs) { return o.first < cs; });
+    if(i == owners.end() || i->first != csa) return false;
+    // every owner sees it, as they all did with the broadcast, several switches or heaters share a checksum
+    for(; i != owners.end() && i->first == csa; ++i) {
+        (i->second->*handler)(pdr);
+    }
+    return true;
+}
+
 bool PublicData::get_value(uint16_t csa, uint16_t csb, uint16_t csc, void **data) {
     PublicDataRequest pdr(csa, csb, csc);
-    THEKERNEL->call_event(ON_GET_PUBLIC_DATA, &pdr );
+    if(!route(csa, &Module::on_get_public_data, &pdr))
+        THEKERNEL->call_event(ON_GET_PUBLIC_DATA, &pdr );
     *data= pdr.get_data_ptr();
     return pdr.is_taken();
 }
@@ -12,6 +32,7 @@ bool PublicData::get_value(uint16_t csa, uint16_t csb, uint16_t csc, void **data
 bool PublicData::set_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data) {
     PublicDataRequest pdr(csa, csb, csc);
     pdr.set_data_ptr(data);
-    THEKERNEL->call_event(ON_SET_PUBLIC_DATA, &pdr );
+    if(!route(csa, &Module::on_set_public_data, &pdr))
+        THEKERNEL->call_event(ON_SET_PUBLIC_DATA, &pdr );
     return pdr.is_taken();
 }
@@ -8,8 +8,18 @@
 #ifndef PUBLICDATA_H
 #define PUBLICDATA_H
 
+#include <stdint.h>
+#include <vector>
+#include <utility>
+
+class Module;
+
 class PublicData {
     public:
+        // have requests that start with csa go straight to the module rather than to every module registered for
+        // ON_GET_PUBLIC_DATA and ON_SET_PUBLIC_DATA, the module then registers for neither
+        static void register_owner(uint16_t csa, Module *module);
+
         static bool get_value(uint16_t csa, void **data) { return get_value(csa, 0, 0, data); }
         static bool get_value(uint16_t csa, uint16_t csb, void **data) { return get_value(csa, csb, 0, data); }
         static bool get_value(uint16_t cs[3], void **data) { return get_value(cs[0], cs[1], cs[2], data); };
@@ -19,6 +29,13 @@ class PublicData {
         static bool set_value(uint16_t csa, uint16_t csb, void *data) { return set_value(csa, csb, 0, data); }
         static bool set_value(uint16_t cs[3], void *data) { return set_value(cs[0], cs[1], cs[2], data); }
         static bool set_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data);
+
+    private:
+        typedef std::pair<uint16_t, Module*> Owner;
+        // sorted by checksum, the owners of one checksum in the order they registered
+        static std::vector<Owner> owners;
+        // calls each owner of the request's first checksum, false if it has none
+        static bool route(uint16_t csa, void (Module::*handler)(void *), void *pdr);
 };
 
 #endif
@@ -1,22 +1,63 @@
 #include "Pwm.h"
 
 #include "nuts_bolts.h"
+#include "libs/Kernel.h"
+#include "libs/Config.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "PwmOut.h"
 
 #define PID_PWM_MAX 256
 
+#define laser_module_enable_checksum CHECKSUM("laser_module_enable")
+#define spindle_enable_checksum      CHECKSUM("spindle_enable")
+
 // What ?
 
+// the period every PWM1 channel we drive uses, set by the first one
+int Pwm::hardware_period_us= 0;
+
 Pwm::Pwm()
 {
+    _hw = nullptr;
     _max = PID_PWM_MAX - 1;
     _pwm = -1;
     _sd_direction= false;
     _sd_accumulator= 0;
 }
 
+// PWM1 has one period for all its channels, the laser and the spindle set their own which would not suit a heater
+bool Pwm::pwm1_period_taken()
+{
+    return THEKERNEL->config->value(laser_module_enable_checksum)->by_default(false)->as_bool() ||
+           THEKERNEL->config->value(spindle_enable_checksum)->by_default(false)->as_bool();
+}
+
+// Drive the pin from the PWM1 peripheral if it has a channel, then on_tick does nothing and need not be attached
+bool Pwm::hardware(int period_us)
+{
+    if (_hw != nullptr) return true;
+    if (pwm1_period_taken()) return false;
+
+    _hw = Pin::hardware_pwm();
+    if (_hw == nullptr) return false;
+
+    // a new channel resets the period, put back the one the others were set up with
+    if (hardware_period_us == 0) hardware_period_us = period_us;
+    _hw->period_us(hardware_period_us);
+
+    if (_pwm < 0) set(Pin::get());
+    else          pwm(_pwm);
+    return true;
+}
+
 void Pwm::pwm(int new_pwm)
 {
     _pwm = confine(new_pwm, 0, _max);
+    if (_hw != nullptr) {
+        float d = (float)_pwm / (PID_PWM_MAX - 1);
+        _hw->write(Pin::inverting ? 1.0F - d : d);
+    }
 }
 
 Pwm* Pwm::max_pwm(int new_max)
@@ -34,12 +75,16 @@ int Pwm::max_pwm()
 void Pwm::set(bool value)
 {
     _pwm = -1;
+    if (_hw != nullptr) {
+        _hw->write((Pin::inverting ^ value) ? 1.0F : 0.0F);
+        return;
+    }
     Pin::set(value);
 }
 
 uint32_t Pwm::on_tick(uint32_t dummy)
 {
-    if ((_pwm < 0) || _pwm >= PID_PWM_MAX) {
+    if (_hw != nullptr || (_pwm < 0) || _pwm >= PID_PWM_MAX) {
         return dummy;
     }
     else if (_pwm == 0) {
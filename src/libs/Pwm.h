@@ -19,7 +19,14 @@ public:
     void     pwm(int);
     void     set(bool);
 
+    bool     hardware(int period_us);
+    bool     is_hardware() const { return _hw != nullptr; }
+
 private:
+    static bool pwm1_period_taken();
+    static int  hardware_period_us;
+
+    mbed::PwmOut *_hw;
     int  _max;
     int  _pwm;
     int  _sd_accumulator;
@@ -12,6 +12,8 @@
 
 
 template<class kind, int length> class RingBuffer {
+    static_assert(length > 1 && (length & (length - 1)) == 0, "RingBuffer length must be a power of two");
+
     public:
         RingBuffer();
         int          size();
@@ -20,6 +22,8 @@ template<class kind, int length> class RingBuffer {
         int          prev_block_index(int index);
         void         push_back(kind object);
         void         pop_front(kind &object);
+        int          push_n(const kind *objects, int n);
+        int          pop_n(kind *objects, int n);
         kind*        get_head_ref();
         kind*        get_tail_ref();
         void         get( int index, kind &object);
@@ -31,8 +35,6 @@ template<class kind, int length> class RingBuffer {
         volatile int          head;
 };
 
-#include "sLPC17xx.h"
-
 template<class kind, int length> RingBuffer<kind, length>::RingBuffer(){
     this->tail = this->head = 0;
 }
@@ -41,24 +43,20 @@ template<class kind, int length>  int RingBuffer<kind, length>::capacity(){
     return length-1;
 }
 
+// head is only written by the producer and tail only by the consumer, and each is read once, so the
+// result is a size the buffer really had at some point without having to stop interrupts
 template<class kind, int length>  int RingBuffer<kind, length>::size(){
-	//return((this->tail>this->head)?length:0)+this->head-tail;
-	__disable_irq();
-	int i = head - tail + ((tail > head)?length:0);
-	__enable_irq();
-	return i;
+    int h = head;
+    int t = tail;
+    return (h - t) & (length - 1);
 }
 
 template<class kind, int length> int RingBuffer<kind, length>::next_block_index(int index){
-    index++;
-    if (index == length) { index = 0; }
-    return(index);
+    return (index + 1) & (length - 1);
 }
 
 template<class kind, int length> int RingBuffer<kind, length>::prev_block_index(int index){
-    if (index == 0) { index = length; }
-    index--;
-    return(index);
+    return (index - 1) & (length - 1);
 }
 
 template<class kind, int length> void RingBuffer<kind, length>::push_back(kind object){
@@ -66,6 +64,19 @@ template<class kind, int length> void RingBuffer<kind, length>::push_back(kind o
     this->head = (head+1)&(length-1);
 }
 
+// copies as many of the n objects as there is room for and returns how many, head moves once at the end
+template<class kind, int length> int RingBuffer<kind, length>::push_n(const kind *objects, int n){
+    int h = head;
+    int room = capacity() - ((h - tail) & (length - 1));
+    if (n > room) n = room;
+    for (int i = 0; i < n; i++) {
+        this->buffer[h] = objects[i];
+        h = (h + 1) & (length - 1);
+    }
+    this->head = h;
+    return n;
+}
+
 template<class kind, int length> kind* RingBuffer<kind, length>::get_head_ref(){
     return &(buffer[head]);
 }
@@ -75,34 +86,20 @@ template<class kind, int length> kind* RingBuffer<kind, length>::get_tail_ref(){
 }
 
 template<class kind, int length> void RingBuffer<kind, length>::get(int index, kind &object){
-    int j= 0;
-    int k= this->tail;
-    while (k != this->head){
-        if (j == index) break;
-        j++;
-        k= (k + 1) & (length - 1);
-    }
-    // TODO : this checks wether we are asked a value out of range
-    //if (k == this->head){
-    //    return NULL;
-    //}
-    object = this->buffer[k];
+    // past the end gives the head slot, as walking from the tail used to
+    int t = tail;
+    int n = (head - t) & (length - 1);
+    if (index > n) index = n;
+    object = this->buffer[(t + index) & (length - 1)];
 }
 
 
 template<class kind, int length> kind* RingBuffer<kind, length>::get_ref(int index){
-    int j= 0;
-    int k= this->tail;
-    while (k != this->head){
-        if (j == index) break;
-        j++;
-        k= (k + 1) & (length - 1);
-    }
-    // TODO : this checks wether we are asked a value out of range
-    if (k == this->head){
+    int t = tail;
+    if (index < 0 || index >= ((head - t) & (length - 1))) {
         return 0;
     }
-    return &(this->buffer[k]);
+    return &(this->buffer[(t + index) & (length - 1)]);
 }
 
 template<class kind, int length> void RingBuffer<kind, length>::pop_front(kind &object){
@@ -110,6 +107,19 @@ template<class kind, int length> void RingBuffer<kind, length>::pop_front(kind &
     this->tail = (this->tail+1)&(length-1);
 }
 
+// takes up to n objects from the tail and returns how many, tail moves once at the end
+template<class kind, int length> int RingBuffer<kind, length>::pop_n(kind *objects, int n){
+    int t = tail;
+    int available = (head - t) & (length - 1);
+    if (n > available) n = available;
+    for (int i = 0; i < n; i++) {
+        objects[i] = this->buffer[t];
+        t = (t + 1) & (length - 1);
+    }
+    this->tail = t;
+    return n;
+}
+
 template<class kind, int length> void RingBuffer<kind, length>::delete_tail(){
     //kind dummy;
     //this->pop_front(dummy);
@@ -1,13 +1,34 @@
 #include "SDFAT.h"
 
+#include "platform_memory.h"
+
+#include <string.h>
+
+#define NO_SECTOR 0xFFFFFFFF
+
 SDFAT::SDFAT(const char *n, MSD_Disk *disk) : mbed::FATFileSystem(n)
 {
     d = disk;
+    cache = NULL;
+    cache_data = NULL;
+    cache_size = 0;
+    cache_tick = 0;
+    seen_writes = 0;
+    fs_writes = 0;
+    hits = misses = 0;
+}
+
+SDFAT::~SDFAT()
+{
+    set_cache_sectors(0);
 }
 
 int SDFAT::disk_initialize()
 {
-    return d->disk_initialize();
+    cache_clear();
+    int r = d->disk_initialize();
+    fs_writes = d->disk_writes();
+    return r;
 }
 
 int SDFAT::disk_status()
@@ -15,14 +36,55 @@ int SDFAT::disk_status()
     return d->disk_status();
 }
 
+// only reads into the window are cached, file data goes straight through and would only push the FAT out
 int SDFAT::disk_read(char *buffer, int sector)
 {
-    return d->disk_read(buffer, sector);
+    if(cache_size == 0 || buffer != (char *)_fs.win)
+        return d->disk_read(buffer, sector);
+
+    cache_check();
+    int i = cache_find(sector);
+    if(i >= 0) {
+        hits++;
+        memcpy(buffer, &cache_data[i * 512], 512);
+        return 0;
+    }
+
+    misses++;
+    int r = d->disk_read(buffer, sector);
+    if(r == 0) cache_put(buffer, sector);
+    return r;
+}
+
+int SDFAT::disk_read_blocks(char *buffer, int sector, int count)
+{
+    if(count == 1)
+        return disk_read(buffer, sector);
+    return d->disk_read_blocks(buffer, sector, count);
 }
 
 int SDFAT::disk_write(const char *buffer, int sector)
 {
-    return d->disk_write(buffer, sector);
+    return disk_write_blocks(buffer, sector, 1);
+}
+
+// the cache is written through, so what it has is always what is on the card
+int SDFAT::disk_write_blocks(const char *buffer, int sector, int count)
+{
+    // our own writes do not make the window stale, unless someone else wrote before them
+    bool fs_current = d->disk_writes() == fs_writes;
+    if(cache_size > 0) cache_check();
+    int r = count == 1 ? d->disk_write(buffer, sector) : d->disk_write_blocks(buffer, sector, count);
+    if(fs_current) fs_writes = d->disk_writes();
+    if(cache_size == 0) return r;
+
+    if(r == 0) {
+        cache_update(buffer, sector, count);
+        seen_writes = d->disk_writes();
+    } else {
+        cache_clear();
+    }
+    return r;
 }
 
 int SDFAT::disk_sync()
@@ -34,9 +96,89 @@ int SDFAT::disk_sectors()
 {
     return d->disk_sectors();
 }
+
+// USB mass storage sharing the card may have written the FAT or a directory that is in the window, it is read again
+// unless it has changes of ours still to be written, and free clusters are looked for from the start
+void SDFAT::disk_check()
+{
+    if(d->disk_writes() == fs_writes) return;
+    cache_check();
+    if(!_fs.wflag) _fs.winsect = 0;
+    _fs.last_clust = 0;
+    _fs.free_clust = 0xFFFFFFFF;
+    fs_writes = d->disk_writes();
+}
 int SDFAT::remount() {
+    cache_clear();
     f_mount(_fsid, NULL);
     f_mount(_fsid, &_fs);
     
 	return 0;
-}
\ No newline at end of file
+}
+
+bool SDFAT::set_cache_sectors(int n)
+{
+    if(cache != NULL) placed_free(cache);
+    if(cache_data != NULL) placed_free(cache_data);
+    cache = NULL;
+    cache_data = NULL;
+    cache_size = 0;
+    if(n <= 0) return true;
+
+    cache = placed_alloc<CachedSector>(n, PLACE_AHB);
+    cache_data = placed_alloc<char>(n * 512, PLACE_AHB);
+    if(cache == NULL || cache_data == NULL) {
+        set_cache_sectors(0);
+        return false;
+    }
+    cache_size = n;
+    cache_clear();
+    return true;
+}
+
+int SDFAT::cache_find(uint32_t sector)
+{
+    for (int i = 0; i < cache_size; i++) {
+        if(cache[i].sector == sector) {
+            cache[i].used = ++cache_tick;
+            return i;
+        }
+    }
+    return -1;
+}
+
+void SDFAT::cache_put(const char *buffer, uint32_t sector)
+{
+    int lru = 0;
+    for (int i = 1; i < cache_size; i++) {
+        if(cache[i].used < cache[lru].used) lru = i;
+    }
+    memcpy(&cache_data[lru * 512], buffer, 512);
+    cache[lru].sector = sector;
+    cache[lru].used = ++cache_tick;
+}
+
+void SDFAT::cache_update(const char *buffer, uint32_t sector, int count)
+{
+    for (int i = 0; i < cache_size; i++) {
+        uint32_t n = cache[i].sector - sector;
+        if(cache[i].sector != NO_SECTOR && n < (uint32_t)count)
+            memcpy(&cache_data[i * 512], &buffer[n * 512], 512);
+    }
+}
+
+// anything written to the card by someone else, USB mass storage, makes the cache stale
+void SDFAT::cache_check()
+{
+    if(d->disk_writes() != seen_writes)
+        cache_clear();
+}
+
+void SDFAT::cache_clear()
+{
+    for (int i = 0; i < cache_size; i++) {
+        cache[i].sector = NO_SECTOR;
+        cache[i].used = 0;
+    }
+    if(d != NULL) seen_writes = d->disk_writes();
+}
@@ -7,18 +7,47 @@
 class SDFAT : public mbed::FATFileSystem {
 public:
     SDFAT(const char *n, MSD_Disk *disk);
+    virtual ~SDFAT();
 
     virtual int disk_initialize();
     virtual int disk_status();
     virtual int disk_read(char *buffer, int sector);
+    virtual int disk_read_blocks(char *buffer, int sector, int count);
     virtual int disk_write(const char *buffer, int sector);
+    virtual int disk_write_blocks(const char *buffer, int sector, int count);
     virtual int disk_sync();
     virtual int disk_sectors();
+    virtual void disk_check();
 
     int remount();
 
+    // keep the last sectors read into the FAT window, the FAT and directories, false if there is no room for them
+    bool set_cache_sectors(int n);
+    int cache_sectors() const { return cache_size; }
+    uint32_t cache_hits() const { return hits; }
+    uint32_t cache_misses() const { return misses; }
+
 protected:
+    struct CachedSector {
+        uint32_t sector;
+        uint32_t used;          // when it was last wanted, the least recent goes first
+    };
+
+    int cache_find(uint32_t sector);
+    void cache_put(const char *buffer, uint32_t sector);
+    void cache_update(const char *buffer, uint32_t sector, int count);
+    void cache_check();
+    void cache_clear();
+
     MSD_Disk *d;
+
+    CachedSector *cache;
+    char *cache_data;
+    int cache_size;
+    uint32_t cache_tick;
+    uint32_t seen_writes;
+    uint32_t fs_writes;         // the disk's write count when the FAT window and free cluster hint were last known good
+    uint32_t hits, misses;
 };
 
 #endif /* _SDFAT_H */
@@ -0,0 +1,73 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SAMPLERING_H
+#define SAMPLERING_H
+
+#include <string.h>
+
+// The last N samples of a sensor, pushed from the interrupt that collects them and filtered when the value is wanted.
+// The reader copies the ring first, so an interrupt pushing meanwhile only makes the result one sample newer.
+// S is what the samples are summed in.
+template <typename T, unsigned int N, typename S = T>
+class SampleRing
+{
+    public:
+        SampleRing() : head(0), count(0) {}
+
+        void push(T v)
+        {
+            samples[head] = v;
+            head = (head + 1) % N;
+            if (count < N) count++;
+        }
+
+        unsigned int size() const { return count; }
+        void clear() { head = count = 0; }
+
+        S mean() const
+        {
+            T s[N];
+            unsigned int n = copy(s);
+            if (n == 0) return 0;
+            S sum = 0;
+            for (unsigned int i = 0; i < n; i++) sum += s[i];
+            return sum / n;
+        }
+
+        // the mean without the highest and lowest sample, which drops single spikes
+        S trimmed_mean() const
+        {
+            T s[N];
+            unsigned int n = copy(s);
+            if (n == 0) return 0;
+            S sum = 0;
+            T lo = s[0], hi = s[0];
+            for (unsigned int i = 0; i < n; i++) {
+                sum += s[i];
+                if (s[i] < lo) lo = s[i];
+                if (s[i] > hi) hi = s[i];
+            }
+            if (n < 3) return sum / n;
+            return (sum - lo - hi) / (n - 2);
+        }
+
+    private:
+        // the ring fills from the start, so the first count entries are the samples
+        unsigned int copy(T *s) const
+        {
+            unsigned int n = count;
+            memcpy(s, (const T *)samples, sizeof(samples));
+            return n;
+        }
+
+        volatile T samples[N];
+        volatile unsigned int head;
+        volatile unsigned int count;
+};
+
+#endif
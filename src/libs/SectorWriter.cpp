@@ -0,0 +1,122 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SectorWriter.h"
+
+#include "libs/StreamOutput.h"
+#include "platform_memory.h"
+#include "us_ticker_api.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+SectorWriter::SectorWriter()
+{
+    fd = NULL;
+    buffer = NULL;
+    used = 0;
+    total = 0;
+    start_us = elapsed_us = 0;
+}
+
+bool SectorWriter::open(const char *filename, bool append)
+{
+    close();
+
+    fd = fopen(filename, append ? "a" : "w");
+    if(fd == NULL) return false;
+    // everything we write is whole sectors, so stdio buffering would only split it back up
+    setvbuf(fd, NULL, _IONBF, 0);
+
+    // only needed for the length of an upload
+    buffer = (char *)AHB0.alloc(chunk_size);
+    if(buffer == NULL) buffer = (char *)AHB1.alloc(chunk_size);
+    if(buffer == NULL) buffer = (char *)malloc(chunk_size);
+    if(buffer == NULL) {
+        fclose(fd);
+        fd = NULL;
+        return false;
+    }
+
+    used = 0;
+    total = 0;
+    start_us = us_ticker_read();
+    elapsed_us = 0;
+    return true;
+}
+
+bool SectorWriter::flush()
+{
+    if(used == 0) return true;
+    bool ok = fwrite(buffer, 1, used, fd) == used;
+    used = 0;
+    return ok;
+}
+
+bool SectorWriter::write(const char *data, size_t n)
+{
+    if(fd == NULL) return false;
+
+    total += n;
+    while(n > 0) {
+        size_t k = chunk_size - used;
+        if(k > n) k = n;
+        memcpy(buffer + used, data, k);
+        used += k;
+        data += k;
+        n -= k;
+        if(used == chunk_size && !flush()) return false;
+    }
+    return true;
+}
+
+bool SectorWriter::close()
+{
+    if(fd == NULL) return true;
+
+    bool ok = flush();
+    if(fclose(fd) != 0) ok = false;
+    fd = NULL;
+    elapsed_us = us_ticker_read() - start_us;
+
+    if(AHB0.has(buffer)) AHB0.dealloc(buffer);
+    else if(AHB1.has(buffer)) AHB1.dealloc(buffer);
+    else free(buffer);
+    buffer = NULL;
+    return ok;
+}
+
+void SectorWriter::print_stats(StreamOutput *stream)
+{
+    uint32_t ms = elapsed_us / 1000;
+    stream->printf("%lu bytes in %lu.%03lu s", total, ms / 1000, ms % 1000);
+    if(ms > 0) stream->printf(", %lu bytes/s", (uint32_t)((uint64_t)total * 1000 / ms));
+    stream->printf("\r\n");
+}
+
+extern "C" void *new_sector_writer(const char *filename)
+{
+    SectorWriter *w = new SectorWriter();
+    if(!w->open(filename)) {
+        delete w;
+        return NULL;
+    }
+    return w;
+}
+
+extern "C" int sector_writer_write(void *writer, const char *data, size_t n)
+{
+    return ((SectorWriter *)writer)->write(data, n);
+}
+
+extern "C" int delete_sector_writer(void *writer)
+{
+    SectorWriter *w = (SectorWriter *)writer;
+    bool ok = w->close();
+    delete w;
+    return ok;
+}
@@ -0,0 +1,58 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SECTORWRITER_H
+#define SECTORWRITER_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+class StreamOutput;
+
+// Writes a file in chunks of whole sectors, gathered in a buffer in AHB SRAM. FatFs writes a chunk that starts on a
+// sector boundary straight from our buffer, so the card gets one multiple block write instead of a write per sector.
+class SectorWriter {
+    public:
+        SectorWriter();
+        ~SectorWriter() { close(); }
+
+        // append adds to the end of an existing file rather than starting a new one
+        bool open(const char *filename, bool append= false);
+        bool write(const char *data, size_t n);
+        bool close();
+        bool is_open() const { return fd != NULL; }
+
+        // the size and rate of the last file written
+        void print_stats(StreamOutput *stream);
+        uint32_t get_total() const { return total; }
+        uint32_t get_elapsed_us() const { return elapsed_us; }
+
+    private:
+        bool flush();
+
+        static const size_t chunk_size = 2048;
+
+        FILE *fd;
+        char *buffer;
+        size_t used;
+        uint32_t total;
+        uint32_t start_us;
+        uint32_t elapsed_us;
+};
+
+#else
+
+// for the C network code, a NULL writer means the file could not be opened
+extern void *new_sector_writer(const char *filename);
+extern int sector_writer_write(void *writer, const char *data, size_t n);
+// closes the file, returns 0 if any of it failed to write
+extern int delete_sector_writer(void *writer);
+
+#endif // __cplusplus
+
+#endif
@@ -0,0 +1,117 @@
+#include "SlabPool.h"
+
+#include "platform_memory.h"
+#include "StreamOutput.h"
+
+SlabPool* SlabPool::first = NULL;
+
+SlabPool::SlabPool(const char *name, uint16_t object_size, uint16_t count)
+{
+    // every object must be able to hold the free list link, and stay 4 byte aligned
+    if (object_size < sizeof(free_t))
+        object_size = sizeof(free_t);
+    if (object_size & 3)
+        object_size += 4 - (object_size & 3);
+
+    this->name = name;
+    this->object_size = object_size;
+    this->count = count;
+    this->base = this->end = NULL;
+    this->free_list = NULL;
+    this->used = this->peak = 0;
+    this->failed = 0;
+
+    next = first;
+    first = this;
+}
+
+bool SlabPool::grab()
+{
+    size_t n = (size_t)object_size * count;
+    uint8_t *p = (uint8_t *)AHB0.alloc(n);
+    if (p == NULL) p = (uint8_t *)AHB1.alloc(n);
+    if (p == NULL) return false;
+
+    base = p;
+    end = p + n;
+    for (uint16_t i = count; i > 0; i--) {
+        free_t *f = (free_t *)(p + (i - 1) * object_size);
+        f->next = free_list;
+        free_list = f;
+    }
+    return true;
+}
+
+void* SlabPool::alloc()
+{
+    if (base == NULL && !grab()) {
+        failed++;
+        return NULL;
+    }
+
+    free_t *f = free_list;
+    if (f == NULL) {
+        failed++;
+        return NULL;
+    }
+    free_list = f->next;
+    if (++used > peak) peak = used;
+    return f;
+}
+
+void SlabPool::dealloc(void* p)
+{
+    free_t *f = (free_t *)p;
+    f->next = free_list;
+    free_list = f;
+    used--;
+}
+
+void SlabPool::debug(StreamOutput* str) const
+{
+    str->printf("\t%-12s %4u x %3ub at %p: used %u, peak %u, full %lu times\n", name, count, object_size, base, used, peak, failed);
+}
+
+void SlabPool::debug_all(StreamOutput* str, bool verbose)
+{
+    uint32_t total = 0, in_use = 0;
+    for (SlabPool *s = first; s != NULL; s = s->next) {
+        if (s->base != NULL) total += s->object_size * s->count;
+        in_use += s->object_size * s->used;
+    }
+    str->printf("Slabs: %lu bytes, %lu in use\n", total, in_use);
+    if (verbose) {
+        for (SlabPool *s = first; s != NULL; s = s->next)
+            s->debug(str);
+    }
+}
+
+// sized for command strings and lines, most gcodes fit the 32 and 64 byte ones
+static SlabPool slabs[] = {
+    {"small 16", 16, 32},
+    {"small 32", 32, 32},
+    {"small 64", 64, 32},
+    {"small 128", 128, 8},
+};
+
+void* slab_alloc(size_t nbytes)
+{
+    for (auto &s : slabs) {
+        if (nbytes <= s.size()) {
+            void *p = s.alloc();
+            if (p != NULL) return p;
+        }
+    }
+    return NULL;
+}
+
+bool slab_free(void* p)
+{
+    for (auto &s : slabs) {
+        if (s.has(p)) {
+            s.dealloc(p);
+            return true;
+        }
+    }
+    return false;
+}
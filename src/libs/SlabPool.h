@@ -0,0 +1,56 @@
+#ifndef _SLABPOOL_H
+#define _SLABPOOL_H
+
+#include <cstdint>
+#include <cstdlib>
+
+class StreamOutput;
+
+/*
+ * A pool of same sized objects, for small allocations that come and go all the time.
+ * The memory is taken from AHB0 or AHB1 in one piece the first time an object is needed, then objects come from a
+ * free list, so alloc and dealloc are constant time and never fragment anything. Whether a pointer belongs to a slab
+ * is a check of its address range.
+ * When the slab is full alloc returns NULL, the caller should fall back to the heap.
+ */
+class SlabPool
+{
+public:
+    SlabPool(const char *name, uint16_t object_size, uint16_t count);
+
+    void* alloc();
+    void  dealloc(void* p);
+
+    bool  has(void* p) const { return (p >= base) && (p < end); }
+    uint16_t size() const { return object_size; }
+
+    void  debug(StreamOutput*) const;
+    static void debug_all(StreamOutput*, bool verbose);
+
+    SlabPool* next;
+    static SlabPool* first;
+
+private:
+    struct free_t {
+        free_t *next;
+    };
+
+    bool  grab();
+
+    const char *name;
+    uint8_t  *base;
+    uint8_t  *end;
+    free_t   *free_list;
+    uint16_t object_size;
+    uint16_t count;
+    uint16_t used;
+    uint16_t peak;
+    uint32_t failed;            // allocs that found the slab full, or no memory for it
+};
+
+// small allocations sorted into slabs by size, NULL if there is no slab for the size or it is full
+void* slab_alloc(size_t nbytes);
+// false if p did not come from slab_alloc
+bool  slab_free(void* p);
+
+#endif /* _SLABPOOL_H */
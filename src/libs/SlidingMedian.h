@@ -0,0 +1,50 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SLIDINGMEDIAN_H
+#define SLIDINGMEDIAN_H
+
+// Median of the last N values pushed.
+// The window is also kept sorted, so each push removes the oldest value and inserts the new one with
+// one pass over the sorted array, rather than copying the window and selecting the median every time.
+template <typename T, unsigned int N>
+class SlidingMedian
+{
+    public:
+        SlidingMedian() : head(0), count(0) {}
+
+        // add a value, dropping the oldest once the window is full, and return the new median
+        T push(T v)
+        {
+            unsigned int i;
+            if (count == N) {
+                // the oldest value is the one about to be overwritten, find it and slide the new one in from there
+                T old = ring[head];
+                for (i = 0; sorted[i] != old; i++);
+                while (i > 0 && v < sorted[i - 1]) { sorted[i] = sorted[i - 1]; i--; }
+                while (i < N - 1 && sorted[i + 1] < v) { sorted[i] = sorted[i + 1]; i++; }
+            } else {
+                for (i = count++; i > 0 && v < sorted[i - 1]; i--) sorted[i] = sorted[i - 1];
+            }
+            sorted[i] = v;
+            ring[head] = v;
+            head = (head + 1) % N;
+            return median();
+        }
+
+        T median() const { return count == 0 ? T() : sorted[count / 2]; }
+        unsigned int size() const { return count; }
+        void clear() { head = count = 0; }
+
+    private:
+        T ring[N];      // in arrival order, head is the oldest once full
+        T sorted[N];
+        unsigned int head;
+        unsigned int count;
+};
+
+#endif
@@ -16,16 +16,19 @@ using namespace std;
 #include "modules/robot/Conveyor.h"
 #include "Pauser.h"
 #include "Gcode.h"
+#include "IsrProfiler.h"
+#include "StreamOutput.h"
 
 #include <mri.h>
 
 // This module uses a Timer to periodically call hooks
 // Modules register with a function ( callback ) and a frequency, and we then call that function at the given frequency.
+// The timer runs freely and MR0 is always set to when the next hook is due, so the interrupt only happens when there is
+// something to call, however fast any other hook is.
 
 SlowTicker* global_slow_ticker;
 
 SlowTicker::SlowTicker(){
-    max_frequency = 0;
     global_slow_ticker = this;
 
 
@@ -34,67 +37,79 @@ SlowTicker::SlowTicker(){
 
     // TODO: What is this ??
     flag_1s_flag = 0;
-    flag_1s_count = SystemCoreClock>>2;
 
+    g4_start = 0;
     g4_ticks = 0;
     g4_pause = false;
 
     // Configure the actual timer after setup to avoid race conditions
     LPC_SC->PCONP |= (1 << 22);     // Power Ticker ON
     LPC_TIM2->MR0 = 10000;          // Initial dummy value for Match Register
-    LPC_TIM2->MCR = 3;              // Match on MR0, reset on MR0
+    LPC_TIM2->MCR = 1;              // Interrupt on MR0, the counter keeps running
     LPC_TIM2->TCR = 1;              // Enable interrupt
+
+    // room for what a usual config attaches, so the vector is not regrown while modules load
+    hooks.reserve(16);
+
+    // the one second flag for the idle event, this also means there is always a hook to schedule
+    attach<SlowTicker, &SlowTicker::second_tick>(1, this);
     NVIC_EnableIRQ(TIMER2_IRQn);    // Enable interrupt handler
 }
 
 void SlowTicker::on_module_loaded(){
     register_for_event(ON_IDLE);
-    register_for_event(ON_GCODE_RECEIVED);
+    register_for_gcodes('G', {4});
     register_for_event(ON_GCODE_EXECUTE);
 }
 
-// Set the base frequency we use for all sub-frequencies
-void SlowTicker::set_frequency( int frequency ){
-    this->interval = (SystemCoreClock >> 2) / frequency;   // SystemCoreClock/4 = Timer increments in a second
-    LPC_TIM2->MR0 = this->interval;
-    LPC_TIM2->TCR = 3;  // Reset
-    LPC_TIM2->TCR = 1;  // Reset
-    flag_1s_count= SystemCoreClock>>2;
+// Move hooks[i] towards the front until the hooks before it are due no later than it,
+// deadlines are compared as differences so the timer wrapping doesn't matter
+void SlowTicker::reschedule(unsigned int i){
+    Hook hook = this->hooks[i];
+    while (i > 0 && (int32_t)(hook.next - this->hooks[i - 1].next) < 0) {
+        this->hooks[i] = this->hooks[i - 1];
+        i--;
+    }
+    this->hooks[i] = hook;
+    if (i == 0) this->set_match();
+}
+
+// Set the timer to interrupt when the first hook is due, if that has already gone it would be a whole wrap late
+void SlowTicker::set_match(){
+    uint32_t next = this->hooks.front().next;
+    LPC_TIM2->MR0 = next;
+    if ((int32_t)(LPC_TIM2->TC - next) >= 0)
+        NVIC_SetPendingIRQ(TIMER2_IRQn);
 }
 
 // The actual interrupt being called by the timer, this is where work is done
 void SlowTicker::tick(){
 
-    // Call all hooks that need to be called ( bresenham )
-    for (Hook* hook : this->hooks){
-        hook->countdown -= this->interval;
-        if (hook->countdown < 0)
-        {
-            hook->countdown += hook->interval;
-            hook->call();
-        }
-    }
+    // Call the hooks that are due, in order
+    for (;;) {
+        Hook hook = this->hooks.front();
+        uint32_t late = LPC_TIM2->TC - hook.next;
+        if ((int32_t)late < 0) break;
 
-    // deduct tick time from secound counter
-    flag_1s_count -= this->interval;
-    // if a whole second has elapsed,
-    if (flag_1s_count < 0)
-    {
-        // add a second to our counter
-        flag_1s_count += SystemCoreClock >> 2;
-        // and set a flag for idle event to pick up
-        flag_1s_flag++;
-    }
+        hook.call();
 
-    // if we're counting down a pause
-    if (g4_ticks > 0)
-    {
-        // deduct tick time from timeout
-        if (g4_ticks > interval)
-            g4_ticks -= interval;
-        else
-            g4_ticks = 0;
+        if (late > hook.max_late) hook.max_late = late;
+        if (late >= hook.interval) {
+            // missed at least one call, skip the ones it missed rather than calling it back to back to catch up
+            hook.overruns++;
+            hook.next += late - (late % hook.interval);
+        }
+        hook.next += hook.interval;
+
+        // it goes back behind every hook due before its new deadline
+        unsigned int i = 0;
+        while (i + 1 < this->hooks.size() && (int32_t)(this->hooks[i + 1].next - hook.next) <= 0) {
+            this->hooks[i] = this->hooks[i + 1];
+            i++;
+        }
+        this->hooks[i] = hook;
     }
+    this->set_match();
 
     // Enter MRI mode if the ISP button is pressed
     // TODO: This should have it's own module
@@ -103,6 +118,28 @@ void SlowTicker::tick(){
 
 }
 
+// set a flag for idle event to pick up
+uint32_t SlowTicker::second_tick(uint32_t){
+    flag_1s_flag++;
+    return 0;
+}
+
+// print the rate of every hook and how late it has been called
+void SlowTicker::dump(StreamOutput *stream, bool reset){
+    uint32_t ticks_per_us = (SystemCoreClock >> 2) / 1000000;
+    stream->printf("Slow ticker hooks:\r\n");
+    __disable_irq();
+    vector<Hook> copy = this->hooks;
+    if (reset) {
+        for (Hook& hook : this->hooks) hook.max_late = hook.overruns = 0;
+    }
+    __enable_irq();
+    for (const Hook& hook : copy) {
+        stream->printf("  %5lu Hz  max late %6lu us  overruns %lu\r\n",
+            (SystemCoreClock >> 2) / hook.interval, hook.max_late / ticks_per_us, hook.overruns);
+    }
+}
+
 bool SlowTicker::flag_1s(){
     // atomic flag check routine
     // first disable interrupts
@@ -138,9 +175,10 @@ void SlowTicker::on_idle(void*)
         THEKERNEL->call_event(ON_SECOND_TICK);
 
     // if G4 has finished, release our pause
-    if (g4_pause && (g4_ticks == 0))
+    if (g4_pause && (LPC_TIM2->TC - g4_start) >= g4_ticks)
     {
         g4_pause = false;
+        g4_ticks = 0;
         THEKERNEL->pauser->release();
     }
 }
@@ -153,6 +191,7 @@ void SlowTicker::on_gcode_received(void* argument){
         THEKERNEL->conveyor->append_gcode(gcode);
         // ensure that no subsequent gcodes get executed along with our G4
         THEKERNEL->conveyor->queue_head_block();
+        gcode->mark_as_consumed();
     }
 }
 
@@ -177,6 +216,7 @@ void SlowTicker::on_gcode_execute(void* argument){
                 // at 120MHz core clock, the longest possible delay is (2^32 / (120MHz / 4)) = 143 seconds
                 if (!g4_pause){
                     g4_pause = true;
+                    g4_start = LPC_TIM2->TC;
                     THEKERNEL->pauser->take();
                 }
             }
@@ -185,9 +225,11 @@ void SlowTicker::on_gcode_execute(void* argument){
 }
 
 extern "C" void TIMER2_IRQHandler (void){
+    ISR_PROFILE_ENTER();
     if((LPC_TIM2->IR >> 0) & 1){  // If interrupt register set for MR0
         LPC_TIM2->IR |= 1 << 0;   // Reset it
     }
     global_slow_ticker->tick();
+    ISR_PROFILE_EXIT(TIMER2);
 }
 
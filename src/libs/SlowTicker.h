@@ -21,6 +21,8 @@ using namespace std;
 #include "system_LPC17xx.h" // for SystemCoreClock
 #include <math.h>
 
+class StreamOutput;
+
 class SlowTicker : public Module{
     public:
         SlowTicker();
@@ -30,40 +32,36 @@ class SlowTicker : public Module{
         void on_gcode_received(void*);
         void on_gcode_execute(void*);
 
-        void set_frequency( int frequency );
         void tick();
-        // For some reason this can't go in the .cpp, see :  http://mbed.org/forum/mbed/topic/2774/?page=1#comment-14221
-        // TODO replace this with std::function()
-        template<typename T> Hook* attach( uint32_t frequency, T *optr, uint32_t ( T::*fptr )( uint32_t ) ){
-            Hook* hook = new Hook();
-            hook->interval = floorf((SystemCoreClock/4)/frequency);
-            hook->attach(optr, fptr);
-            hook->countdown = hook->interval;
+        void dump(StreamOutput *stream, bool reset);
+        // call optr->fptr frequency times a second from the timer interrupt
+        template<typename T, uint32_t (T::*fptr)(uint32_t)> void attach(uint32_t frequency, T *optr) {
+            Hook hook;
+            hook.interval = floorf((SystemCoreClock/4)/frequency);
+            hook.callback = Callback<uint32_t(uint32_t)>::bind<T, fptr>(optr);
 
             // to avoid race conditions we must stop the interupts before updating this non thread safe vector
             __disable_irq();
-            if( frequency > this->max_frequency ){
-                this->max_frequency = frequency;
-                this->set_frequency(frequency);
-            }
+            hook.next = LPC_TIM2->TC + hook.interval;
             this->hooks.push_back(hook);
+            this->reschedule(this->hooks.size() - 1);
             __enable_irq();
-            return hook;
         }
 
     private:
         bool flag_1s();
+        uint32_t second_tick(uint32_t);
+        void reschedule(unsigned int i);
+        void set_match();
 
-        vector<Hook*> hooks;
-        uint32_t max_frequency;
-        uint32_t interval;
+        vector<Hook> hooks;     // sorted by when they are next due
 
+        uint32_t g4_start;
         uint32_t g4_ticks;
         bool     g4_pause;
 
         Pin ispbtn;
 protected:
-    int flag_1s_count;
     volatile int flag_1s_flag;
 };
 
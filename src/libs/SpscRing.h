@@ -0,0 +1,107 @@
+#ifndef _SPSCRING_H
+#define _SPSCRING_H
+
+#include <atomic>
+#include <new>
+
+#include "platform_memory.h"
+
+/*
+ * A ring of items handed from a producer to a consumer and back again for cleanup, without disabling interrupts
+ *
+ * There are three indexes, each written by exactly one side:
+ *
+ *   head      written by the producer (main loop), items from isr_tail up to head are ready for the consumer
+ *   isr_tail  written by the consumer (ISR), items from tail up to isr_tail are finished with and need cleaning
+ *   tail      written by the cleanup (main loop), items from head round to tail are clean and free to prepare
+ *
+ * Each index is published with a release store after the item it covers has been written, and read with an acquire
+ * load before the item is looked at, so an item is never seen half prepared or half finished. On the Cortex-M3 these
+ * become plain loads and stores with a DMB, which is all that is needed on a single core.
+ *
+ * The storage can only be resized while the ring is empty and nothing is consuming from it.
+ */
+template<class kind> class SpscRing {
+public:
+    SpscRing() : ring(nullptr), length(0), head_i(0), isr_tail_i(0), tail_i(0) {}
+    ~SpscRing() { destroy(); }
+
+    // where selects the memory the items are put in, see platform_memory.h
+    bool resize(unsigned int n, MemoryPlacement where = PLACE_HEAP)
+    {
+        if (!is_empty()) return false;
+
+        kind *newring = placed_alloc<kind>(n, where);
+        if (newring == nullptr) return false;
+        for (unsigned int i = 0; i < n; i++) new (&newring[i]) kind();
+
+        destroy();
+        ring = newring;
+        length = n;
+        head_i.store(0, std::memory_order_relaxed);
+        isr_tail_i.store(0, std::memory_order_relaxed);
+        tail_i.store(0, std::memory_order_release);
+        return true;
+    }
+
+    unsigned int size() const { return length; }
+
+    unsigned int next(unsigned int i) const { return (length == 0 || ++i >= length) ? 0 : i; }
+    unsigned int prev(unsigned int i) const { return (length == 0) ? 0 : (i == 0) ? length - 1 : i - 1; }
+    kind *item_ref(unsigned int i) { return &ring[i]; }
+
+    // index snapshots, only the side that writes an index gets an exact value for it
+    unsigned int get_head_i() const { return head_i.load(std::memory_order_acquire); }
+    unsigned int get_isr_tail_i() const { return isr_tail_i.load(std::memory_order_acquire); }
+    unsigned int get_tail_i() const { return tail_i.load(std::memory_order_acquire); }
+
+    // nothing queued and nothing waiting to be cleaned
+    bool is_empty() const { return head_i.load(std::memory_order_acquire) == tail_i.load(std::memory_order_acquire); }
+
+    /*
+     * producer side, prepare the item at head_ref() then publish it with produce_head()
+     */
+    bool is_full() const { return next(head_i.load(std::memory_order_relaxed)) == tail_i.load(std::memory_order_acquire); }
+    kind *head_ref() { return &ring[head_i.load(std::memory_order_relaxed)]; }
+    void produce_head() { head_i.store(next(head_i.load(std::memory_order_relaxed)), std::memory_order_release); }
+    // takes back the items from i up to head, which the consumer must not have reached, they then need cleaning again
+    void truncate_head(unsigned int i) { head_i.store(i, std::memory_order_release); }
+
+    /*
+     * consumer side, use the item at isr_tail_ref() then hand it back for cleaning with isr_consume_tail()
+     */
+    bool isr_is_empty() const { return isr_tail_i.load(std::memory_order_relaxed) == head_i.load(std::memory_order_acquire); }
+    kind *isr_tail_ref() { return &ring[isr_tail_i.load(std::memory_order_relaxed)]; }
+    void isr_consume_tail() { isr_tail_i.store(next(isr_tail_i.load(std::memory_order_relaxed)), std::memory_order_release); }
+    // true if there is another item queued after the one at isr_tail_ref()
+    bool isr_has_next() const { unsigned int t= isr_tail_i.load(std::memory_order_relaxed); return t != head_i.load(std::memory_order_acquire) && next(t) != head_i.load(std::memory_order_acquire); }
+    // items queued and not yet used, including the one at isr_tail_ref()
+    unsigned int isr_queued() const { unsigned int h= head_i.load(std::memory_order_acquire), t= isr_tail_i.load(std::memory_order_acquire); return h >= t ? h - t : h + length - t; }
+    // hand back everything that has been queued, without using it
+    void isr_consume_all() { isr_tail_i.store(head_i.load(std::memory_order_acquire), std::memory_order_release); }
+
+    /*
+     * cleanup side, clean the item at tail_ref() then return it to the producer with consume_tail()
+     */
+    bool gc_is_empty() const { return tail_i.load(std::memory_order_relaxed) == isr_tail_i.load(std::memory_order_acquire); }
+    kind *tail_ref() { return &ring[tail_i.load(std::memory_order_relaxed)]; }
+    void consume_tail() { tail_i.store(next(tail_i.load(std::memory_order_relaxed)), std::memory_order_release); }
+
+private:
+    void destroy()
+    {
+        if (ring == nullptr) return;
+        for (unsigned int i = 0; i < length; i++) ring[i].~kind();
+        placed_free(ring);
+        ring = nullptr;
+    }
+
+    kind *ring;
+    unsigned int length;
+
+    std::atomic_uint head_i;
+    std::atomic_uint isr_tail_i;
+    std::atomic_uint tail_i;
+};
+
+#endif /* _SPSCRING_H */
@@ -13,6 +13,8 @@
 #include "libs/Kernel.h"
 #include "StepperMotor.h"
 #include "StreamOutputPool.h"
+#include "IsrProfiler.h"
+#include "EventTrace.h"
 #include "system_LPC17xx.h" // mbed.h lib
 #include <math.h>
 #include <mri.h>
@@ -55,6 +57,11 @@ StepTicker::StepTicker(){
 
     // Default start values
     this->a_move_finished = false;
+    this->acceleration_tick_pending = false;
+    this->acceleration_tick_enabled = 0;
+    this->num_acceleration_tick_handlers = 0;
+    this->step_acceleration_handler = AccelerationHandler();
+    this->step_acceleration_pending = false;
     this->do_move_finished = 0;
     this->unstep.reset();
     this->set_frequency(100000);
@@ -63,6 +70,10 @@ StepTicker::StepTicker(){
     this->num_motors= 0;
     this->active_motor.reset();
     this->tick_cnt= 0;
+    this->port_stepping= false;
+    this->hardware_pulses= false;
+    this->used_port_mask= 0;
+    for (int i = 0; i < num_ports*2; ++i) this->unstep_port_mask[i]= 0;
 }
 
 StepTicker::~StepTicker() {
@@ -90,6 +101,7 @@ void StepTicker::set_frequency( float frequency ){
 void StepTicker::set_reset_delay( float microseconds ){
     uint32_t delay = floorf((SystemCoreClock/4.0F)*(microseconds/1000000.0F));  // SystemCoreClock/4 = Timer increments in a second
     LPC_TIM1->MR0 = delay;
+    this->pulse_ticks= delay;
 }
 
 // this is the number of acceleration ticks per second
@@ -104,9 +116,11 @@ void StepTicker::set_acceleration_ticks_per_second(uint32_t acceleration_ticks_p
 void StepTicker::synchronize_acceleration(bool fire_now) {
     LPC_RIT->RICOUNTER = 0;
     if(fire_now){
+        this->acceleration_tick_pending= true;
         NVIC_SetPendingIRQ(RIT_IRQn);
     }else{
-        if(NVIC_GetPendingIRQ(RIT_IRQn)) {
+        this->acceleration_tick_pending= false;
+        if(NVIC_GetPendingIRQ(RIT_IRQn) && !this->step_acceleration_pending) {
             // clear pending interrupt so it does not interrupt immediately
             LPC_RIT->RICTRL |= 1L; // also clear the interrupt in case it fired
             NVIC_ClearPendingIRQ(RIT_IRQn);
@@ -114,6 +128,12 @@ void StepTicker::synchronize_acceleration(bool fire_now) {
     }
 }
 
+// called from the step interrupt, runs the step acceleration handler at the acceleration interrupt priority
+void StepTicker::signal_step_acceleration() {
+    this->step_acceleration_pending= true;
+    NVIC_SetPendingIRQ(RIT_IRQn);
+}
+
 
 // Call signal_move_finished() on each active motor that asked to be signaled. We do this instead of inside of tick() so that
 // all tick()s are called before we do the move finishing
@@ -132,8 +152,27 @@ void StepTicker::signal_a_move_finished(){
     }
 }
 
+// GPIO ports are laid out at fixed 0x20 intervals from LPC_GPIO0
+static inline LPC_GPIO_TypeDef *gpio_port(int n) { return (LPC_GPIO_TypeDef *)(LPC_GPIO0_BASE + (n * 0x20)); }
+
 // Reset step pins on any motor that was stepped
 inline void StepTicker::unstep_tick(){
+    if(this->port_stepping) {
+        // deassert is the opposite register to the one that asserted the step
+        for (int i = 0; i < num_ports*2; i+=2) {
+            if(this->unstep_port_mask[i]) {
+                gpio_port(i/2)->FIOCLR= this->unstep_port_mask[i];
+                this->unstep_port_mask[i]= 0;
+            }
+            if(this->unstep_port_mask[i+1]) {
+                gpio_port(i/2)->FIOSET= this->unstep_port_mask[i+1];
+                this->unstep_port_mask[i+1]= 0;
+            }
+        }
+        this->unstep.reset();
+        return;
+    }
+
     for (int i = 0; i < num_motors; i++) {
         if(this->unstep[i]){
             this->motor[i]->unstep();
@@ -143,22 +182,31 @@ inline void StepTicker::unstep_tick(){
 }
 
 extern "C" void TIMER1_IRQHandler (void){
+    ISR_PROFILE_ENTER();
     LPC_TIM1->IR |= 1 << 0;
     StepTicker::global_step_ticker->unstep_tick();
+    ISR_PROFILE_EXIT(TIMER1);
 }
 
 // The actual interrupt handler where we do all the work
 extern "C" void TIMER0_IRQHandler (void){
+    ISR_PROFILE_ENTER();
     StepTicker::global_step_ticker->TIMER0_IRQHandler();
+    ISR_PROFILE_EXIT(TIMER0);
 }
 
 extern "C" void RIT_IRQHandler (void){
-    LPC_RIT->RICTRL |= 1L;
-    StepTicker::global_step_ticker->acceleration_tick();
+    ISR_PROFILE_ENTER();
+    TRACE_EVENT(ACCEL_TICK, 0);
+    StepTicker::global_step_ticker->RIT_IRQHandler();
+    ISR_PROFILE_EXIT(RIT);
 }
 
 extern "C" void PendSV_Handler(void) {
+    ISR_PROFILE_ENTER();
+    TRACE_EVENT(PENDSV, 0);
     StepTicker::global_step_ticker->PendSV_IRQHandler();
+    ISR_PROFILE_EXIT(PENDSV);
 }
 
 // slightly lower priority than TIMER0, the whole end of block/start of block is done here allowing the timer to continue ticking
@@ -178,11 +226,47 @@ void StepTicker::PendSV_IRQHandler (void) {
     }
 }
 
+// the RIT compare flag tells the periodic tick apart from the interrupt being pended by a stepper
+void StepTicker::RIT_IRQHandler (void) {
+    bool timed= (LPC_RIT->RICTRL & 1L) || this->acceleration_tick_pending;
+    LPC_RIT->RICTRL |= 1L;
+    this->acceleration_tick_pending= false;
+
+    if(this->step_acceleration_pending) {
+        this->step_acceleration_pending= false;
+        if(this->step_acceleration_handler) this->step_acceleration_handler();
+    }
+
+    if(timed) acceleration_tick();
+}
+
+int StepTicker::add_acceleration_tick_handler(AccelerationHandler handler, bool enabled) {
+    if(this->num_acceleration_tick_handlers >= max_acceleration_tick_handlers) {
+        THEKERNEL->streams->printf("ERROR: too many acceleration tick handlers\n");
+        return -1;
+    }
+
+    int id= this->num_acceleration_tick_handlers++;
+    this->acceleration_tick_handlers[id]= handler;
+    enable_acceleration_tick_handler(id, enabled);
+    return id;
+}
+
+// may be called from any context, the mask is updated atomically
+void StepTicker::enable_acceleration_tick_handler(int id, bool enable) {
+    if(id < 0) return;
+    if(enable) this->acceleration_tick_enabled.fetch_or(1U << id);
+    else this->acceleration_tick_enabled.fetch_and(~(1U << id));
+}
+
 // run in RIT lower priority than PendSV
 void  StepTicker::acceleration_tick() {
-    // call registered acceleration handlers
-    for (size_t i = 0; i < acceleration_tick_handlers.size(); ++i) {
-        acceleration_tick_handlers[i]();
+    // call the enabled acceleration handlers, in the order they registered
+    uint32_t enabled= this->acceleration_tick_enabled.load();
+    while(enabled != 0) {
+        int i= __builtin_ctz(enabled);
+        enabled &= enabled - 1;
+        this->acceleration_tick_handlers[i]();
     }
 }
 
@@ -191,16 +275,42 @@ void StepTicker::TIMER0_IRQHandler (void){
     LPC_TIM0->IR |= 1 << 0;
     tick_cnt++; // count number of ticks
 
-    // Step pins NOTE takes 1.2us when nothing to step, 1.8-2us for one motor stepped and 2.6us when two motors stepped, 3.167us when three motors stepped
-    for (uint32_t motor = 0; motor < num_motors; motor++){
-        // send tick to all active motors
-        if(this->active_motor[motor] && this->motor[motor]->tick()){
-            // we stepped so schedule an unstep
-            this->unstep[motor]= 1;
+    if(this->port_stepping) {
+        // gather the step pins of every motor that steps this tick, then write each port once
+        uint32_t port_mask[num_ports*2]= {0};
+        bool stepped= false;
+        for (uint32_t motor = 0; motor < num_motors; motor++){
+            if(this->active_motor[motor] && this->motor[motor]->tick()){
+                port_mask[this->motor[motor]->step_port_index] |= this->motor[motor]->step_port_mask;
+                // a slaved motor on another port
+                if(this->motor[motor]->slave_port_mask) port_mask[this->motor[motor]->slave_port_index] |= this->motor[motor]->slave_port_mask;
+                stepped= true;
+                if(this->motor[motor]->soft_unstep) this->unstep[motor]= 1;
+            }
+        }
+
+        if(stepped) {
+            for (int i = 0; i < num_ports*2; i+=2) {
+                if((this->used_port_mask & (3 << i)) == 0) continue; // no motor on this port
+                if(port_mask[i])   gpio_port(i/2)->FIOSET= port_mask[i];
+                if(port_mask[i+1]) gpio_port(i/2)->FIOCLR= port_mask[i+1];
+                this->unstep_port_mask[i]   |= port_mask[i];
+                this->unstep_port_mask[i+1] |= port_mask[i+1];
+            }
+        }
+
+    }else{
+        // Step pins NOTE takes 1.2us when nothing to step, 1.8-2us for one motor stepped and 2.6us when two motors stepped, 3.167us when three motors stepped
+        for (uint32_t motor = 0; motor < num_motors; motor++){
+            // send tick to all active motors
+            if(this->active_motor[motor] && this->motor[motor]->tick() && this->motor[motor]->soft_unstep){
+                // we stepped so schedule an unstep, unless the timer ends the pulse
+                this->unstep[motor]= 1;
+            }
         }
     }
 
-    // We may have set a pin on in this tick, now we reset the timer to set it off
+    // We may have set a pin on in this tick, now we reset the timer to set it off, step pins on match outputs don't need it
     // Note there could be a race here if we run another tick before the unsteps have happened,
     // right now it takes about 3-4us but if the unstep were near 10uS or greater it would be an issue
     // also it takes at least 2us to get here so even when set to 1us pulse width it will still be about 3us
@@ -231,6 +341,7 @@ int StepTicker::register_motor(StepperMotor* motor)
 {
     this->motor.push_back(motor);
     this->num_motors= this->motor.size();
+    if(motor->step_port_mask != 0) this->used_port_mask |= (1 << motor->step_port_index);
     return this->num_motors-1;
 }
 
@@ -244,6 +355,17 @@ void StepTicker::add_motor_to_active_list(StepperMotor* motor)
     }
 }
 
+// called with interrupts disabled so a tick or a move finished can't come in part way, any that is pending is dropped
+void StepTicker::halt()
+{
+    LPC_TIM0->TCR = 0;
+    active_motor.reset();
+    a_move_finished= false;
+    do_move_finished= 0;
+    SCB->ICSR = 0x08000000; // SCB_ICSR_PENDSVCLR_Msk;
+    tick_cnt= 0;
+}
+
 // Remove a stepper from the list of active motors
 void StepTicker::remove_motor_from_active_list(StepperMotor* motor)
 {
@@ -13,9 +13,10 @@
 #include <stdint.h>
 #include <vector>
 #include <bitset>
-#include <functional>
 #include <atomic>
 
+#include "libs/Callback.h"
+
 class StepperMotor;
 
 class StepTicker{
@@ -28,9 +29,17 @@ class StepTicker{
         void signal_a_move_finished();
         void set_reset_delay( float seconds );
         int register_motor(StepperMotor* motor);
+        void add_port_mask(uint8_t port_index) { used_port_mask |= (1 << port_index); }
         void add_motor_to_active_list(StepperMotor* motor);
         void remove_motor_from_active_list(StepperMotor* motor);
+        // stops stepping at once, with interrupts disabled, nothing steps again until a motor is next given a move
+        void halt();
         void set_acceleration_ticks_per_second(uint32_t acceleration_ticks_per_second);
+        void set_port_stepping(bool flg) { port_stepping= flg; }
+        bool is_port_stepping() const { return port_stepping; }
+        // step pins that are timer match outputs end their own pulses, must be set before any motors are created
+        void set_hardware_pulses(bool flg) { hardware_pulses= flg; }
+        bool is_hardware_pulses() const { return hardware_pulses; }
         float get_frequency() const { return frequency; }
         void unstep_tick();
         uint32_t get_tick_cnt() const { return tick_cnt; }
@@ -38,12 +47,23 @@ class StepTicker{
 
         void TIMER0_IRQHandler (void);
         void PendSV_IRQHandler (void);
-        void register_acceleration_tick_handler(std::function<void(void)> cb){
-            acceleration_tick_handlers.push_back(cb);
+
+        // acceleration tick handlers are kept in a fixed table, and only the enabled ones get called each tick
+        // returns the id to pass to enable_acceleration_tick_handler(), or -1 if the table is full
+        template<class T, void (T::*fptr)(void)> int register_acceleration_tick_handler(T *optr, bool enabled= true){
+            return add_acceleration_tick_handler(AccelerationHandler::bind<T, fptr>(optr), enabled);
         }
+        void enable_acceleration_tick_handler(int id, bool enable);
         void acceleration_tick();
         void synchronize_acceleration(bool fire_now);
 
+        // called from the acceleration interrupt when the main stepper asks for it instead of on the timer, for step synchronous acceleration
+        template<class T, void (T::*fptr)(void)> void register_step_acceleration_handler(T *optr){
+            step_acceleration_handler= AccelerationHandler::bind<T, fptr>(optr);
+        }
+        void signal_step_acceleration();
+        void RIT_IRQHandler (void);
+
         void start();
 
         friend class StepperMotor;
@@ -52,13 +72,31 @@ class StepTicker{
         float frequency;
         uint32_t period;
         volatile uint32_t tick_cnt;
-        std::vector<std::function<void(void)>> acceleration_tick_handlers;
+        typedef Callback<void()> AccelerationHandler;
+        int add_acceleration_tick_handler(AccelerationHandler handler, bool enabled);
+
+        static const int max_acceleration_tick_handlers= 16;
+        AccelerationHandler acceleration_tick_handlers[max_acceleration_tick_handlers];
+        std::atomic_uint acceleration_tick_enabled; // bit set for each handler to call
+        uint8_t num_acceleration_tick_handlers;
+        AccelerationHandler step_acceleration_handler;
         std::vector<StepperMotor*> motor;
         std::bitset<32> active_motor; // limit to 32 motors
         std::bitset<32> unstep;       // limit to 32 motors
         std::atomic_uchar do_move_finished;
         uint8_t num_motors;
         volatile bool a_move_finished;
+        volatile bool acceleration_tick_pending;  // the acceleration tick was fired by synchronize_acceleration()
+        volatile bool step_acceleration_pending;  // the acceleration interrupt was pended by a stepper
+        bool port_stepping;
+        bool hardware_pulses;
+        uint32_t pulse_ticks;     // the step pulse width in timer counts
+
+        // when port stepping, the step pins of all motors that step in a tick are gathered per GPIO port
+        // and written with one FIOSET/FIOCLR each, index is port*2 for FIOSET and port*2+1 for FIOCLR
+        static const int num_ports= 5;
+        uint32_t unstep_port_mask[num_ports*2]; // the step bits that were asserted and need to be deasserted by unstep_tick
+        uint16_t used_port_mask; // bit set for each entry in the table used by any registered motor
 };
 
 
@@ -9,6 +9,7 @@
 #include "Kernel.h"
 #include "MRI_Hooks.h"
 #include "StepTicker.h"
+#include "LPC17xx.h"
 
 #include <math.h>
 
@@ -35,6 +36,29 @@ StepperMotor::~StepperMotor()
 
 void StepperMotor::init()
 {
+    this->pulse_timer= nullptr;
+    this->pulse_match= nullptr;
+    this->pulse_emr_mask= 0;
+    this->pulse_emr_start= 0;
+    if(THEKERNEL->step_ticker->is_hardware_pulses() && this->step_pin.connected()) setup_hardware_pulse();
+    this->soft_unstep= this->pulse_timer == nullptr;
+
+    // precompute where the step pin is so StepTicker can assert it with a single port write along with the other motors
+    // even entries in the table are the bits to FIOSET, odd entries the bits to FIOCLR (for inverted step pins)
+    if(this->step_pin.connected() && this->pulse_timer == nullptr) {
+        this->step_port_index= (this->step_pin.port_number * 2) + (this->step_pin.inverting ? 1 : 0);
+        this->step_port_mask= 1 << this->step_pin.pin;
+    }else{
+        this->step_port_index= 0;
+        this->step_port_mask= 0;
+    }
+
+    this->slave_port_index= 0;
+    this->slave_port_mask= 0;
+    this->has_slave= false;
+    this->step_primary= true;
+    this->step_slave= false;
+
     // register this motor with the step ticker, and get its index in that array and bit position
     this->index= THEKERNEL->step_ticker->register_motor(this);
     this->moving = false;
@@ -50,24 +74,78 @@ void StepperMotor::init()
     steps_per_mm         = 1.0F;
     max_rate             = 50.0F;
     minimum_step_rate    = default_minimum_actuator_rate;
+    minimum_fixed_rate   = to_fixed_rate(minimum_step_rate);
 
     last_milestone_steps = 0;
     last_milestone_mm    = 0.0F;
     current_position_steps= 0;
     signal_step= 0;
+    accel_step_interval= 0;
+    next_accel_step= 0;
+    mark_step= 0;
+    mark_fn= nullptr;
 }
 
 
+// The step pins that are a match output of TIMER2, which runs freely at SystemCoreClock/4 like TIMER1 does. TIMER0
+// and TIMER1 are reset by StepTicker, MR0 of TIMER2 is the SlowTicker's, and TIMER3 is the us_ticker that Timer,
+// Timeout and us_ticker_read count on, so its MAT3.0 and MAT3.1 pins, P0.10 and P0.11, are not used
+static const struct { uint8_t port, pin, channel, function; } match_pins[]= {
+    {0, 7, 1, 3}, {0, 8, 2, 3}, {0, 9, 3, 3}, {4, 29, 1, 2},
+};
+
+// Hands the step pin over to a match output, false if it isn't one or another motor has its channel already
+bool StepperMotor::setup_hardware_pulse()
+{
+    static uint8_t claimed= 0;
+    for (auto& m : match_pins) {
+        if(m.port != this->step_pin.port_number || m.pin != this->step_pin.pin) continue;
+
+        uint8_t bit= 1 << m.channel;
+        if(claimed & bit) return false;
+        claimed |= bit;
+
+        LPC_TIM_TypeDef *timer= LPC_TIM2;
+        LPC_SC->PCONP |= 1 << 22;
+        timer->TCR= 1;
+
+        // idle at the inactive level, a step drives it active and the match puts it back
+        uint32_t active= this->step_pin.inverting ? 0 : 1;
+        uint32_t action= this->step_pin.inverting ? 2 : 1; // set or clear on match
+        this->pulse_emr_mask= ~((1 << m.channel) | (3 << (4 + m.channel * 2)));
+        this->pulse_emr_start= (active << m.channel) | (action << (4 + m.channel * 2));
+        timer->EMR= (timer->EMR & this->pulse_emr_mask) | ((active ^ 1) << m.channel);
+
+        volatile uint32_t *pinsel= &LPC_PINCON->PINSEL0 + (m.port * 2) + (m.pin / 16);
+        *pinsel= (*pinsel & ~(3 << ((m.pin % 16) * 2))) | (m.function << ((m.pin % 16) * 2));
+
+        this->pulse_match= &timer->MR0 + m.channel;
+        this->pulse_timer= timer;
+        return true;
+    }
+    return false;
+}
+
 // This is called ( see the .h file, we had to put a part of things there for obscure inline reasons ) when a step has to be generated
 // we also here check if the move is finished etc ..
 // This is in highest priority interrupt so cannot be pre-empted
-void StepperMotor::step()
+// returns true if a step was generated, when port stepping is enabled the caller is responsible for setting the pin
+bool StepperMotor::step()
 {
     // ignore if we are still processing the end of a block
-    if(this->is_move_finished) return;
+    if(this->is_move_finished) return false;
 
-    // output to pins 37t
-    this->step_pin.set( 1 );
+    // a match output pulse ends itself exactly pulse_ticks from now, whichever way the other pins are stepped
+    if(this->pulse_timer != nullptr && this->step_primary) {
+        *this->pulse_match= this->pulse_timer->TC + THEKERNEL->step_ticker->pulse_ticks;
+        this->pulse_timer->EMR= (this->pulse_timer->EMR & this->pulse_emr_mask) | this->pulse_emr_start;
+    }
+
+    // output to pins 37t, unless StepTicker writes all the step pins to the ports in one go
+    if(!THEKERNEL->step_ticker->is_port_stepping()) {
+        if(this->step_primary && this->pulse_timer == nullptr) this->step_pin.set( 1 );
+        if(this->step_slave) this->slave_step_pin.set( 1 );
+    }
 
     // move counter back 11t
     this->fx_counter -= this->fx_ticks_per_step;
@@ -84,6 +162,17 @@ void StepperMotor::step()
         this->signal_step= 0;
     }
 
+    // or for step synchronous acceleration every so many steps
+    if(this->accel_step_interval != 0 && this->stepped >= this->next_accel_step) {
+        this->next_accel_step= this->stepped + this->accel_step_interval;
+        THEKERNEL->step_ticker->signal_step_acceleration();
+    }
+
+    // or for something that has to happen at a given position along the move
+    if(this->mark_step != 0 && this->stepped >= this->mark_step) {
+        this->mark_step= this->mark_fn(this->stepped);
+    }
+
     // Is this move finished ?
     if( this->stepped == this->steps_to_move ) {
         // Mark it as finished, then StepTicker will call signal_mode_finished()
@@ -92,6 +181,8 @@ void StepperMotor::step()
         THEKERNEL->step_ticker->a_move_finished= true;
         this->last_step_tick= THEKERNEL->step_ticker->get_tick_cnt(); // remember when last step was
     }
+
+    return true;
 }
 
 
@@ -102,10 +193,11 @@ void StepperMotor::signal_move_finished()
     this->moving = false;
     this->steps_to_move = 0;
     this->minimum_step_rate = default_minimum_actuator_rate;
+    this->minimum_fixed_rate = to_fixed_rate(this->minimum_step_rate);
 
     // signal it to whatever cares
     // in this call a new block may start, new moves set and new speeds
-    this->end_hook->call();
+    this->end_hook(0);
 
     // We only need to do this if we were not instructed to move
     if( !this->moving ) {
@@ -131,13 +223,17 @@ void StepperMotor::update_exit_tick()
 StepperMotor* StepperMotor::move( bool direction, unsigned int steps, float initial_speed)
 {
     this->dir_pin.set(direction);
+    if(this->has_slave) this->slave_dir_pin.set(direction);
     this->direction = direction;
+    if(!this->step_primary || this->step_slave != this->has_slave) set_step_outputs(true, true);
 
     // How many steps we have to move until the move is done
     this->steps_to_move = steps;
 
     // Zero our tool counters
     this->stepped = 0;
+    this->accel_step_interval = 0;
+    this->mark_step = 0;
     this->fx_ticks_per_step = 0xFFFFF000UL; // some big number so we don't start stepping before it is set again
     if(this->last_step_tick_valid) {
         // we set this based on when the last step was, thus compensating for missed ticks
@@ -170,24 +266,99 @@ StepperMotor* StepperMotor::move( bool direction, unsigned int steps, float init
 // fx_ticks_per_step is what actually sets the step rate, it is fixed point 18.14
 StepperMotor* StepperMotor::set_speed( float speed )
 {
-    if(speed < minimum_step_rate) {
-        speed= minimum_step_rate;
-    }
-
     // if(speed <= 0.0F) { // we can't actually do 0 but we can get close, need to avoid divide by zero later on
     //     this->fx_ticks_per_step= 0xFFFFFFFFUL; // 0.381 steps/sec
     //     this->steps_per_second = THEKERNEL->step_ticker->get_frequency() / (this->fx_ticks_per_step >> fx_shift);
     //     return;
     // }
 
+    uint32_t fx_ticks= get_fx_ticks_per_step(speed);
+
     // How many steps we must output per second
     this->steps_per_second = speed;
 
     // set the new speed, NOTE this can be pre-empted by stepticker so the following write needs to be atomic
-    this->fx_ticks_per_step= floor(fx_increment * THEKERNEL->step_ticker->get_frequency() / speed);
+    this->fx_ticks_per_step= fx_ticks;
     return this;
 }
 
+// Calculate the fixed point ticks per step for the given step rate without changing the motor, speed is clamped to the minimum rate
+// used by the segment generator to do the division in the main loop rather than in the acceleration interrupt
+uint32_t StepperMotor::get_fx_ticks_per_step( float& speed ) const
+{
+    if(speed < minimum_step_rate) {
+        speed= minimum_step_rate;
+    }
+    return floor(fx_increment * THEKERNEL->step_ticker->get_frequency() / speed);
+}
+
+// The slave's pins are set up like the motor's own, the motor's dir, enable and steps are then copied to it
+void StepperMotor::add_slave(Pin& step, Pin& dir, Pin& en)
+{
+    this->slave_step_pin= step;
+    this->slave_dir_pin= dir;
+    this->slave_en_pin= en;
+    this->has_slave= true;
+    this->soft_unstep= true;
+    this->slave_en_pin.set(this->en_pin.get());
+    this->slave_dir_pin.set(this->direction);
+    THEKERNEL->step_ticker->add_port_mask((step.port_number * 2) + (step.inverting ? 1 : 0));
+    set_step_outputs(true, true);
+}
+
+// Called with the motor stopped or from the step loop's own thread of control, as the step interrupt reads the masks
+void StepperMotor::set_step_outputs(bool primary, bool slave)
+{
+    uint8_t own_index= (this->step_pin.port_number * 2) + (this->step_pin.inverting ? 1 : 0);
+    uint8_t index= (this->slave_step_pin.port_number * 2) + (this->slave_step_pin.inverting ? 1 : 0);
+    uint32_t own_mask= (primary && this->step_pin.connected() && this->pulse_timer == nullptr) ? 1 << this->step_pin.pin : 0;
+    uint32_t mask= (slave && this->has_slave) ? 1 << this->slave_step_pin.pin : 0;
+
+    __disable_irq();
+    this->step_primary= primary;
+    this->step_slave= slave && this->has_slave;
+    if(own_mask == 0 || index == own_index) {
+        // on the same port, or the only pin left stepping, both go in the one entry
+        this->step_port_index= (own_mask != 0) ? own_index : index;
+        this->step_port_mask= own_mask | mask;
+        this->slave_port_mask= 0;
+    } else {
+        this->step_port_index= own_index;
+        this->step_port_mask= own_mask;
+        this->slave_port_index= index;
+        this->slave_port_mask= mask;
+    }
+    __enable_irq();
+}
+
+// fx_increment ticks of the step ticker per second, fits 32 bits up to a 262kHz base_stepping_frequency
+uint32_t StepperMotor::fixed_tick_scale()
+{
+    return fx_increment * THEKERNEL->step_ticker->get_frequency();
+}
+
+// The same as set_speed for a fixed point rate, with no float divides
+void StepperMotor::set_fixed_speed( uint32_t rate, uint32_t tick_scale )
+{
+    uint32_t fx_ticks= get_fx_ticks_per_fixed_step(rate, tick_scale);
+    this->steps_per_second = rate * (1.0F / (1 << fixed_rate_bits));
+    this->fx_ticks_per_step= fx_ticks;
+}
+
+// (tick_scale << fixed_rate_bits) / rate, which is wider than 32 bits, as two 32 bit divides the M3 does in hardware.
+// The remainder is less than rate so it shifts without overflowing for any rate below 2^26, a million steps/s
+uint32_t StepperMotor::get_fx_ticks_per_fixed_step( uint32_t& rate, uint32_t tick_scale ) const
+{
+    if(rate < minimum_fixed_rate) {
+        rate= minimum_fixed_rate;
+    }
+    if(rate == 0) rate= 1;
+    uint32_t q= tick_scale / rate;
+    if(q >= (1UL << (32 - fixed_rate_bits))) return 0xFFFFF000UL; // slower than a step every few seconds
+    uint32_t r= tick_scale - q * rate;
+    return (q << fixed_rate_bits) + (r << fixed_rate_bits) / rate;
+}
+
 // Pause this stepper motor
 void StepperMotor::pause()
 {
@@ -8,31 +8,52 @@
 #ifndef STEPPERMOTOR_H
 #define STEPPERMOTOR_H
 
-#include "libs/Hook.h"
+#include "libs/Callback.h"
 #include "Pin.h"
 #include <atomic>
 #include <functional>
 
 class StepTicker;
-class Hook;
 
 class StepperMotor {
     public:
+        // called from the step interrupt once stepped reaches the step asked for, returns the next step to be called at, 0 for no more
+        typedef uint32_t (*StepMark)(uint32_t stepped);
+
         StepperMotor();
         StepperMotor(Pin& step, Pin& dir, Pin& en);
         ~StepperMotor();
 
-        void step();
-        inline void unstep() { step_pin.set(0); };
+        bool step();
+        inline void unstep() { if(pulse_timer == nullptr) step_pin.set(0); if(has_slave) slave_step_pin.set(0); };
+
+        inline void enable(bool state) { en_pin.set(!state); if(has_slave) slave_en_pin.set(!state); };
 
-        inline void enable(bool state) { en_pin.set(!state); };
+        // a second motor on its own driver that makes every step this one does, ie the other side of a gantry.
+        // Homing can stop either one on its own switch with set_step_outputs, the next move() steps both again
+        void add_slave(Pin& step, Pin& dir, Pin& en);
+        bool get_has_slave() const { return has_slave; }
+        void set_step_outputs(bool primary, bool slave);
 
         bool is_moving() { return moving; }
         void move_finished();
         StepperMotor* move( bool direction, unsigned int steps, float initial_speed= -1.0F);
         void signal_move_finished();
         StepperMotor* set_speed( float speed );
+
+        // rates as steps/s with fixed_rate_bits of fraction, for a build with FIXED_POINT_STEPPING, so the acceleration
+        // interrupt only uses integer math. tick_scale is fixed_tick_scale(), worked out once per block
+        static const uint32_t fixed_rate_bits= 6;
+        static uint32_t to_fixed_rate(float rate) { return rate * (1 << fixed_rate_bits); }
+        static uint32_t fixed_tick_scale();
+        void set_fixed_speed( uint32_t rate, uint32_t tick_scale );
+        uint32_t get_fx_ticks_per_fixed_step( uint32_t& rate, uint32_t tick_scale ) const;
+        uint32_t get_fx_ticks_per_step( float& speed ) const;
+        void set_fx_ticks_per_step( uint32_t fx_ticks, float speed ) { steps_per_second= speed; fx_ticks_per_step= fx_ticks; }
         void set_moved_last_block(bool flg) { last_step_tick_valid= flg; }
+        void set_acceleration_step_interval(uint32_t n) { next_accel_step= n; accel_step_interval= n; }
+        // only for the current move, cleared by move()
+        void set_step_mark(uint32_t step, StepMark fn) { mark_fn= fn; mark_step= step; }
         void update_exit_tick();
         void pause();
         void unpause();
@@ -43,19 +64,19 @@ class StepperMotor {
         void change_last_milestone(float);
         float get_last_milestone(void) const { return last_milestone_mm; }
         float get_current_position(void) const { return (float)current_position_steps/steps_per_mm; }
+        int32_t get_current_step(void) const { return current_position_steps; }
         float get_max_rate(void) const { return max_rate; }
         void set_max_rate(float mr) { max_rate= mr; }
         float get_min_rate(void) const { return minimum_step_rate; }
-        void set_min_rate(float mr) { minimum_step_rate= mr; }
+        void set_min_rate(float mr) { minimum_step_rate= mr; minimum_fixed_rate= to_fixed_rate(mr); }
 
         int  steps_to_target(float);
         uint32_t get_steps_to_move() const { return steps_to_move; }
         uint32_t get_stepped() const { return stepped; }
 
-        template<typename T> void attach( T *optr, uint32_t ( T::*fptr )( uint32_t ) ){
-            Hook* hook = new Hook();
-            hook->attach(optr, fptr);
-            this->end_hook = hook;
+        // called from the step interrupt when a move is done
+        template<typename T, uint32_t (T::*fptr)(uint32_t)> void attach(T *optr) {
+            this->end_hook = Callback<uint32_t(uint32_t)>::bind<T, fptr>(optr);
         }
 
         friend class StepTicker;
@@ -65,9 +86,27 @@ class StepperMotor {
 
     private:
         void init();
+        bool setup_hardware_pulse();
 
         int index;
-        Hook* end_hook;
+        Callback<uint32_t(uint32_t)> end_hook;
+
+        // precomputed for StepTicker port stepping, index into its port mask table and the bit to write
+        uint8_t step_port_index;
+        uint32_t step_port_mask;
+        // the slave's step pin when it is on another port, 0 if it shares this one's, which costs nothing more to step
+        uint8_t slave_port_index;
+        uint32_t slave_port_mask;
+
+        // a step pin that is a timer match output has its pulse ended by the timer, with no unstep interrupt
+        LPC_TIM_TypeDef *pulse_timer;
+        volatile uint32_t *pulse_match;
+        uint32_t pulse_emr_mask;        // clears the channel's output and action bits in EMR
+        uint32_t pulse_emr_start;       // drives the output active and has the match put it back
+
+        Pin slave_step_pin;
+        Pin slave_dir_pin;
+        Pin slave_en_pin;
 
         Pin step_pin;
         Pin dir_pin;
@@ -77,6 +116,7 @@ class StepperMotor {
         float steps_per_mm;
         float max_rate; // this is not really rate it is in mm/sec, misnamed used in Robot and Extruder
         float minimum_step_rate; // this is the minimum step_rate in steps/sec for this motor for this block
+        uint32_t minimum_fixed_rate;
         static float default_minimum_actuator_rate;
 
         volatile int32_t current_position_steps;
@@ -87,6 +127,10 @@ class StepperMotor {
         uint32_t stepped;
         uint32_t last_step_tick;
         uint32_t signal_step;
+        uint32_t accel_step_interval; // if set ask for an acceleration update every this many steps
+        volatile uint32_t next_accel_step;
+        volatile uint32_t mark_step;
+        StepMark mark_fn;
 
         // set to 32 bit fixed point, 18:14 bits fractional
         static const uint32_t fx_shift= 14;
@@ -100,6 +144,10 @@ class StepperMotor {
             bool paused:1;
             volatile bool moving:1;
             bool last_step_tick_valid:1; // set if the last step tick time is valid (ie the motor moved last block)
+            bool has_slave:1;
+            bool step_primary:1;         // which of the step pins step, both unless homing has stopped one
+            bool step_slave:1;
+            bool soft_unstep:1;          // a step pin needs unstep() from StepTicker's unstep interrupt
         };
 
         // Called a great many times per second, to step if we have to now
@@ -109,8 +157,7 @@ class StepperMotor {
 
             // if we are to step now
             if (fx_counter >= fx_ticks_per_step){
-                step();
-                return true;
+                return step();
             }
             return false;
         };
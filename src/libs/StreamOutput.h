@@ -11,6 +11,7 @@
 #include <cstdarg>
 #include <cstring>
 #include <stdio.h>
+#include <stdint.h>
 
 // This is a base class for all StreamOutput objects.
 // StreamOutputs are basically "things you can sent strings to". They are passed along with gcodes for example so modules can answer to those gcodes.
@@ -20,7 +21,7 @@ class NullStreamOutput;
 
 class StreamOutput {
     public:
-        StreamOutput(){}
+        StreamOutput() : report_rx_space(false), broadcast_drops(0), line_received_us(0) {}
         virtual ~StreamOutput(){}
 
         virtual int printf(const char *format, ...) __attribute__ ((format(printf, 2, 3)));
@@ -29,6 +30,36 @@ class StreamOutput {
         virtual int puts(const char* str) = 0;
         virtual bool ready() { return true; };
 
+        // a line sent to every console, a stream that would have to wait for room to take it drops it instead and
+        // counts it, so one stalled host doesn't hold up the others. Replies to a command still go through puts
+        virtual int broadcast(const char* str) { return puts(str); }
+
+        // the plain ok that answers most lines, it is always the same so a transport can queue it as it is
+        virtual int send_ok() { return puts("ok\r\n"); }
+
+        // receive space of the command source behind this stream, in bytes or in whole lines, -1 if it has no such limit
+        // hosts that count what they have sent use it to keep the buffer full rather than waiting for each ok
+        virtual int rx_free(bool lines) { return -1; }
+        virtual int rx_capacity(bool lines) { return -1; }
+
+        // true for a stream that is there for as long as the firmware runs, like a console, rather than one made for
+        // a single line, so a gcode can still use it after the line has been handled
+        virtual bool is_persistent() const { return false; }
+
+        // bytes that can be written now without waiting, -1 if the stream can't tell, OutputJob writes a piece at a
+        // time when there is room rather than all at once
+        virtual int tx_room() { return -1; }
+
+        // set by the rxspace command, every ok sent to this stream then says how much receive space is left
+        bool report_rx_space;
+
+        // broadcasts dropped because there was no room for them
+        uint32_t broadcast_drops;
+
+        // us_ticker_read when the command source took in the line being handled, 0 once it has been answered or if
+        // it is not timed, M412 reports the time from this to the dispatch and to the ok
+        uint32_t line_received_us;
+
         static NullStreamOutput NullStream;
 };
 
@@ -9,43 +9,65 @@
 #define STREAMOUTPUTPOOL_H
 
 using namespace std;
-#include <set>
 #include <string>
 #include <cstdio>
 #include <cstdarg>
 
 #include "libs/StreamOutput.h"
 
+// the consoles, kept in a flat array as it is walked for every broadcast and only changes when a host comes or goes
 class StreamOutputPool : public StreamOutput {
 
 public:
-    StreamOutputPool(){
+    StreamOutputPool() : count(0) {
     }
 
     int puts(const char* s)
     {
         int r = 0;
-        for(set<StreamOutput*>::iterator i = this->streams.begin(); i != this->streams.end(); i++)
+        for(int i = 0; i < this->count; i++)
         {
-            int k = (*i)->puts(s);
+            int k = this->streams[i]->broadcast(s);
             if (k > r)
                 r = k;
         }
         return r;
     }
 
-    void append_stream(StreamOutput* stream)
+    // false if the pool is full
+    bool append_stream(StreamOutput* stream)
     {
-        this->streams.insert(stream);
+        if(has_stream(stream)) return true;
+        if(this->count == max_streams) return false;
+        this->streams[this->count++] = stream;
+        return true;
     }
 
     void remove_stream(StreamOutput* stream)
     {
-        this->streams.erase(stream);
+        for(int i = 0; i < this->count; i++) {
+            if(this->streams[i] == stream) {
+                for(this->count--; i < this->count; i++) this->streams[i] = this->streams[i + 1];
+                return;
+            }
+        }
+    }
+
+    bool has_stream(StreamOutput* stream) const
+    {
+        for(int i = 0; i < this->count; i++) {
+            if(this->streams[i] == stream) return true;
+        }
+        return false;
     }
 
+    int size() const { return this->count; }
+    StreamOutput *get(int i) const { return this->streams[i]; }
+
 private:
-    set<StreamOutput*> streams;
+    static const int max_streams = 8;
+    StreamOutput* streams[max_streams];
+    int count;
 };
 
 #endif
@@ -52,6 +52,8 @@ public:
     EP_STATUS endpointReadResult(uint8_t bEP, uint8_t *data, uint32_t *bytesRead);
     EP_STATUS endpointWrite(uint8_t bEP, uint8_t *data, uint32_t size);
     EP_STATUS endpointWriteResult(uint8_t bEP);
+    // true when both buffers of an IN endpoint are free, nothing is waiting to go to the host
+    bool endpointWriteIdle(uint8_t bEP);
     uint8_t endpointStatus(uint8_t bEP);
     void stallEndpoint(uint8_t bEP);
     void unstallEndpoint(uint8_t bEP);
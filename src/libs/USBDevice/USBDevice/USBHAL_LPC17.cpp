@@ -664,6 +664,11 @@ EP_STATUS USBHAL::endpointWriteResult(uint8_t bEP)
     return EP_PENDING;
 }
 
+bool USBHAL::endpointWriteIdle(uint8_t bEP)
+{
+    return can_transfer[EP2IDX(bEP)] == 2;
+}
+
 uint8_t USBHAL::endpointStatus(uint8_t bEP)
 {
     uint8_t bEPStat = SIEselectEndpoint(EP2IDX(bEP));
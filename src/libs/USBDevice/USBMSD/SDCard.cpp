@@ -115,16 +115,48 @@
  * +------+---------+---------+- -  - -+---------+-----------+----------+
  * | 0xFE | data[0] | data[1] |        | data[n] | crc[15:8] | crc[7:0] |
  * +------+---------+---------+- -  - -+---------+-----------+----------+
+ *
+ * Multiple Block Read
+ * -------------------
+ *
+ * After CMD18 the card sends blocks like the one above back to back until
+ * it gets CMD12, which is answered with a stuff byte, R1 and then busy.
+ * Blocks going to AHB SRAM are received with the GPDMA, which can't reach
+ * the main SRAM the FAT sector buffers are in.
+ *
+ * Multiple Block Write
+ * --------------------
+ *
+ * After CMD25 each block is sent with a 0xFC start token and gets its own
+ * response token, a 0xFD stop token ends the write and the card is busy
+ * until it has programmed the last block.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "SDCard.h"
+#include "us_ticker_api.h"
 
 static const uint8_t OXFF = 0xFF;
 
+// clocked out for every byte the DMA receives, it has to be somewhere the GPDMA can read
+static uint8_t dma_ff __attribute__ ((section ("AHBSRAM0")));
+
+#define IS_AHB_SRAM(p)      (((uint32_t)(p) >= 0x2007C000) && ((uint32_t)(p) < 0x20084000))
+#define SD_DMA_RX_CHANNEL   LPC_GPDMACH0
+#define SD_DMA_TX_CHANNEL   LPC_GPDMACH1
+
+int SDCardSPI::actual_hz() {
+    return SystemCoreClock / (_spi.spi->CPSR * (((_spi.spi->CR0 >> 8) & 0xFF) + 1));
+}
+
 #define SD_COMMAND_TIMEOUT 5000
+// a card has up to 100ms to start sending a block
+#define SD_DATA_TIMEOUT_US 250000
+// the clock used for data before the card said how fast it can go
+#define SD_SAFE_HZ 2500000
 
 SDCard::SDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) :
   _spi(mosi, miso, sclk), _cs(cs) {
@@ -132,6 +164,9 @@ SDCard::SDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) :
     _cs = 1;
     busyflag = false;
     _sectors = 0;
+    _writes = 0;
+    _max_hz = 25000000;
+    _hz = 0;
 }
 
 #define R1_IDLE_STATE           (1 << 0)
@@ -277,7 +312,13 @@ int SDCard::disk_initialize()
         return 1;
     }
 
-    _spi.frequency(2500000); // Set to 2.5MHz for data transfer
+    // as fast for data transfer as the card and the wiring allow
+    _ramp_clock();
+
+    // power up the GPDMA for block reads
+    LPC_SC->PCONP |= (1UL << 29);
+    LPC_GPDMA->DMACConfig = 1;
+    dma_ff = 0xFF;
 
     busyflag = false;
 
@@ -290,6 +331,7 @@ int SDCard::disk_write(const char *buffer, uint32_t block_number)
         return 0;
 
     busyflag = true;
+    _writes++;
 
     if (cardtype == SDCARD_FAIL)
         return -1;
@@ -306,6 +348,45 @@ int SDCard::disk_write(const char *buffer, uint32_t block_number)
     return 0;
 }
 
+int SDCard::disk_write_blocks(const char *buffer, uint32_t block_number, int count)
+{
+    if (count == 1)
+        return disk_write(buffer, block_number);
+
+    if (busyflag)
+        return 0;
+
+    busyflag = true;
+    _writes++;
+
+    if (cardtype == SDCARD_FAIL)
+        return -1;
+    // set write address for the first block, the card takes blocks until the stop token (CMD25)
+    if(_cmdx(SDCMD_WRITE_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        _cs = 1;
+        _spi.write(0xFF);
+        busyflag = false;
+        return 1;
+    }
+
+    // send the data blocks, each with the multiple block write start token
+    int r = 0;
+    for (int i = 0; i < count && r == 0; i++)
+        r = _write_data(0xFC, buffer + (i << 9), 512);
+
+    // stop token, after which the card is busy until it has programmed the last block
+    _spi.write(0xFD);
+    _spi.write(0xFF);
+    while(_spi.write(0xFF) == 0);
+
+    _cs = 1;
+    _spi.write(0xFF);
+
+    busyflag = false;
+
+    return r;
+}
+
 int SDCard::disk_read(char *buffer, uint32_t block_number)
 {
     if (busyflag)
@@ -321,11 +402,43 @@ int SDCard::disk_read(char *buffer, uint32_t block_number)
     }
 
     // receive the data
-    _read(buffer, 512);
+    int r = _read(buffer, 512);
 
     busyflag = false;
 
-    return 0;
+    return r;
+}
+
+int SDCard::disk_read_blocks(char *buffer, uint32_t block_number, int count)
+{
+    if (count == 1)
+        return disk_read(buffer, block_number);
+
+    if (busyflag)
+        return 0;
+
+    busyflag = true;
+
+    if (cardtype == SDCARD_FAIL)
+        return -1;
+    // set read address for the first block, the card keeps sending until stopped (CMD18)
+    if(_cmdx(SDCMD_READ_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        _cs = 1;
+        _spi.write(0xFF);
+        busyflag = false;
+        return 1;
+    }
+
+    // receive the data, chip select stays low for all of it
+    int r = 0;
+    for (int i = 0; i < count && r == 0; i++)
+        r = _read_data(buffer + (i << 9), 512);
+
+    _stop_transmission();
+
+    busyflag = false;
+
+    return r;
 }
 
 int SDCard::disk_status() { return (_sectors > 0)?0:1; }
@@ -336,7 +449,7 @@ int SDCard::disk_sync() {
 uint32_t SDCard::disk_sectors() { return _sectors; }
 uint64_t SDCard::disk_size() { return ((uint64_t) _sectors) << 9; }
 uint32_t SDCard::disk_blocksize() { return (1<<9); }
-bool SDCard::disk_canDMA() { return false; }
+bool SDCard::disk_canDMA() { return true; }
 
 SDCard::CARD_TYPE SDCard::card_type()
 {
@@ -456,8 +569,21 @@ int SDCard::_cmd8() {
 int SDCard::_read(char *buffer, int length) {
     _cs = 0;
 
-    // read until start byte (0xFF)
-    while(_spi.write(0xFF) != 0xFE);
+    int r = _read_data(buffer, length);
+
+    _cs = 1;
+    _spi.write(0xFF);
+    return r;
+}
+
+// receive one data block, chip select must already be low
+int SDCard::_read_data(char *buffer, int length) {
+    // read until start byte (0xFE), a card that never sends one fails the read rather than hanging
+    uint32_t start = us_ticker_read();
+    while(_spi.write(0xFF) != 0xFE) {
+        if (us_ticker_read() - start > SD_DATA_TIMEOUT_US)
+            return 1;
+    }
 //     uint8_t r;
 //     while((r = _spi.write(0xFF)) != 0xFE)
 //     {
@@ -468,27 +594,121 @@ int SDCard::_read(char *buffer, int length) {
 //     iprintf("Got start byte, reading data\n");
 
     // read data
-    for(int i=0; i<length; i++) {
-        buffer[i] = _spi.write(0xFF);
+    if (IS_AHB_SRAM(buffer)) {
+        _dma_read(buffer, length);
+    } else {
+        _fifo_transfer(NULL, buffer, length);
     }
     _spi.write(0xFF); // checksum
     _spi.write(0xFF);
+    return 0;
+}
+
+// one channel clocks out 0xFF while the other stores what comes back, the SSP paces both
+void SDCard::_dma_read(char *buffer, int length) {
+    LPC_SSP_TypeDef *ssp = _spi.ssp();
+    // the DMA request lines are 0 (tx) and 1 (rx) for SSP0, 2 and 3 for SSP1
+    uint32_t tx_request = (ssp == LPC_SSP0) ? 0 : 2;
+    uint32_t rx_request = tx_request + 1;
+
+    // the polled transfers always empty the receive fifo, but make sure
+    while (ssp->SR & (1 << 2))
+        (void) ssp->DR;
+
+    LPC_GPDMA->DMACIntTCClear = 3;
+    LPC_GPDMA->DMACIntErrClr = 3;
+
+    // SSP data register to the buffer, bytes in bursts of 4, destination increments
+    SD_DMA_RX_CHANNEL->DMACCSrcAddr = (uint32_t) &ssp->DR;
+    SD_DMA_RX_CHANNEL->DMACCDestAddr = (uint32_t) buffer;
+    SD_DMA_RX_CHANNEL->DMACCLLI = 0;
+    SD_DMA_RX_CHANNEL->DMACCControl = length | (1 << 12) | (1 << 15) | (1UL << 27);
+    SD_DMA_RX_CHANNEL->DMACCConfig = 1 | (rx_request << 1) | (2 << 11);
+
+    // the same 0xFF to the SSP data register for every byte
+    SD_DMA_TX_CHANNEL->DMACCSrcAddr = (uint32_t) &dma_ff;
+    SD_DMA_TX_CHANNEL->DMACCDestAddr = (uint32_t) &ssp->DR;
+    SD_DMA_TX_CHANNEL->DMACCLLI = 0;
+    SD_DMA_TX_CHANNEL->DMACCControl = length | (1 << 12) | (1 << 15);
+    SD_DMA_TX_CHANNEL->DMACCConfig = 1 | (tx_request << 6) | (1 << 11);
+
+    ssp->DMACR = 3; // RXDMAE | TXDMAE
+
+    // done once the last byte is in, the receive channel has the higher priority so it finishes last
+    while (!(LPC_GPDMA->DMACRawIntTCStat & 1) && !(LPC_GPDMA->DMACRawIntErrStat & 1));
+
+    ssp->DMACR = 0;
+    SD_DMA_TX_CHANNEL->DMACCConfig = 0;
+    SD_DMA_RX_CHANNEL->DMACCConfig = 0;
+    LPC_GPDMA->DMACIntTCClear = 3;
+    LPC_GPDMA->DMACIntErrClr = 3;
+}
+
+// clocks length bytes through the SSP, keeping its transmit fifo topped up rather than waiting on every byte
+// out NULL sends 0xFF, in NULL throws away what comes back
+void SDCard::_fifo_transfer(const char *out, char *in, int length) {
+    LPC_SSP_TypeDef *ssp = _spi.ssp();
+
+    while (ssp->SR & (1 << 2))
+        (void) ssp->DR;
+
+    int sent = 0, received = 0;
+    while (received < length) {
+        // no more than the 8 frame fifo depth in flight, or the receive fifo overruns
+        while (sent < length && (sent - received) < 8 && (ssp->SR & (1 << 1))) {
+            ssp->DR = out ? out[sent] : 0xFF;
+            sent++;
+        }
+        while (ssp->SR & (1 << 2)) {
+            char c = ssp->DR;
+            if (in) in[received] = c;
+            received++;
+        }
+    }
+}
+
+// CMD12 ends a multiple block read, chip select is still low from the blocks
+int SDCard::_stop_transmission() {
+    _spi.write(0x40 | SDCMD_STOP_TRANSMISSION);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x95);
+    _spi.write(0xFF); // stuff byte
+
+    int response = -1;
+    for(int i=0; i<SD_COMMAND_TIMEOUT; i++) {
+        response = _spi.write(0xFF);
+        if(!(response & 0x80))
+            break;
+    }
+
+    // R1b, the card holds the data line low while busy
+    while(_spi.write(0xFF) == 0);
 
     _cs = 1;
     _spi.write(0xFF);
-    return 0;
+    return response;
 }
 
 int SDCard::_write(const char *buffer, int length) {
     _cs = 0;
 
+    int r = _write_data(0xFE, buffer, length);
+
+    _cs = 1;
+    _spi.write(0xFF);
+    return r;
+}
+
+// send one data block after the given start token, chip select must already be low
+int SDCard::_write_data(uint8_t token, const char *buffer, int length) {
     // indicate start of block
-    _spi.write(0xFE);
+    _spi.write(token);
 
     // write the data
-    for(int i=0; i<length; i++) {
-        _spi.write(buffer[i]);
-    }
+    _fifo_transfer(buffer, NULL, length);
 
     // write the checksum
     _spi.write(0xFF);
@@ -496,16 +716,12 @@ int SDCard::_write(const char *buffer, int length) {
 
     // check the repsonse token
     if((_spi.write(0xFF) & 0x1F) != 0x05) {
-        _cs = 1;
-        _spi.write(0xFF);
         return 1;
     }
 
     // wait for write to finish
     while(_spi.write(0xFF) == 0);
 
-    _cs = 1;
-    _spi.write(0xFF);
     return 0;
 }
 
@@ -530,7 +746,7 @@ uint32_t SDCard::_sd_sectors() {
         return 0;
     }
 
-    char csd[16];
+    char *csd = _csd;
     if(_read(csd, 16) != 0) {
         fprintf(stderr, "Couldn't read csd response from disk\n");
         return 0;
@@ -579,6 +795,35 @@ uint32_t SDCard::_sd_sectors() {
     return 0;
 }
 
+// TRAN_SPEED, csd[103:96], is a rate unit of 100kbit/s times a power of ten, and a multiplier in tenths
+static int tran_speed_hz(int tran_speed) {
+    static const uint8_t mult[16] = { 0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80 };
+    int hz = 10000;
+    for (int unit = tran_speed & 7; unit > 0 && unit < 4; unit--)
+        hz *= 10;
+    return hz * mult[(tran_speed >> 3) & 15];
+}
+
+// raise the clock to what the CSD allows, capped at _max_hz, halving it until the CSD reads back the same
+void SDCard::_ramp_clock() {
+    int hz = tran_speed_hz(ext_bits(_csd, 103, 96));
+    if (hz > _max_hz)
+        hz = _max_hz;
+
+    for (; hz > SD_SAFE_HZ; hz /= 2) {
+        _spi.frequency(hz);
+        char check[16];
+        if (_cmdx(SDCMD_SEND_CSD, 0) == 0 && _read(check, 16) == 0 && memcmp(check, _csd, 16) == 0) {
+            _hz = _spi.actual_hz();
+            return;
+        }
+    }
+
+    // the fixed rate that was always used before, unless the cap is lower still
+    _spi.frequency((_max_hz > 0 && _max_hz < SD_SAFE_HZ) ? _max_hz : SD_SAFE_HZ);
+    _hz = _spi.actual_hz();
+}
+
 bool SDCard::busy()
 {
     return busyflag;
@@ -32,7 +32,15 @@
 #include "disk.h"
 #include "mbed.h"
 
-// #include "DMA.h"
+// mbed::SPI keeps the SSP it is using to itself, the DMA and the fifo transfers need it
+class SDCardSPI : public mbed::SPI {
+public:
+    SDCardSPI(PinName mosi, PinName miso, PinName sclk) : mbed::SPI(mosi, miso, sclk) {}
+    // set up for us first, in case another SPI was used since
+    LPC_SSP_TypeDef *ssp() { aquire(); return _spi.spi; }
+    // the clock the divider actually gives, spi_frequency runs the SSP from the core clock
+    int actual_hz();
+};
 
 /** Access the filesystem on an SD Card using SPI
  *
@@ -71,18 +79,26 @@ public:
 
     virtual int disk_initialize();
     virtual int disk_write(const char *buffer, uint32_t block_number);
+    virtual int disk_write_blocks(const char *buffer, uint32_t block_number, int count);
     virtual int disk_read(char *buffer, uint32_t block_number);
+    virtual int disk_read_blocks(char *buffer, uint32_t block_number, int count);
     virtual int disk_status();
     virtual int disk_sync();
     virtual uint32_t disk_sectors();
     virtual uint64_t disk_size();
     virtual uint32_t disk_blocksize();
     virtual bool disk_canDMA(void);
+    virtual uint32_t disk_writes() { return _writes; }
 
     CARD_TYPE card_type(void);
 
     bool busy();
 
+    // the fastest the clock is raised to after initialisation, the card's own limit from its CSD still applies
+    void set_max_frequency(int hz) { _max_hz = hz; }
+    // the data transfer clock in use
+    int frequency() const { return _hz; }
+
 protected:
 
     int _cmd(int cmd, uint32_t arg);
@@ -94,15 +110,26 @@ protected:
     CARD_TYPE initialise_card_v2();
 
     int _read(char *buffer, int length);
+    int _read_data(char *buffer, int length);
+    void _dma_read(char *buffer, int length);
+    void _fifo_transfer(const char *out, char *in, int length);
+    void _ramp_clock();
+    int _stop_transmission();
     int _write(const char *buffer, int length);
+    int _write_data(uint8_t token, const char *buffer, int length);
 
     uint32_t _sd_sectors();
     uint32_t _sectors;
+    char _csd[16];
+    int _max_hz;
+    int _hz;
 
-    mbed::SPI _spi;
+    SDCardSPI _spi;
     GPIO _cs;
 
     volatile bool busyflag;
+    // bumped by every write, USB mass storage writes from its interrupt
+    volatile uint32_t _writes;
 
     CARD_TYPE cardtype;
 };
@@ -28,6 +28,12 @@
 #include "Kernel.h"
 
 #include "platform_memory.h"
+#include "checksumm.h"
+#include "Config.h"
+#include "ConfigValue.h"
+
+#define msd_buffer_sectors_checksum CHECKSUM("msd_buffer_sectors")
+#define msd_share_card_checksum     CHECKSUM("msd_share_card")
 
 #define DISK_OK         0x00
 #define NO_INIT         0x01
@@ -83,6 +89,8 @@ enum Status {
 USBMSD::USBMSD(USB *u, MSD_Disk *d) {
     this->usb = u;
     this->disk = d;
+    this->pending = PENDING_NONE;
+    this->share_card = false;
 
     usbdesc_interface i = {
         DL_INTERFACE,           // bLength
@@ -191,9 +199,20 @@ bool USBMSD::connect()
     BlockSize = disk->disk_blocksize();
 
     if ((BlockCount > 0) && (BlockSize != 0)) {
-        page = (uint8_t*) AHB0.alloc(BlockSize);
+        // as many sectors as were asked for, or as many as fit in what is left of AHB0
+        int n = THEKERNEL->config->value(msd_buffer_sectors_checksum)->by_default(8)->as_number();
+        if (n < 1) n = 1;
+        if (n > 64) n = 64;
+        page = (uint8_t*) AHB0.alloc(BlockSize * n);
+        while (page == NULL && n > 1) {
+            n /= 2;
+            page = (uint8_t*) AHB0.alloc(BlockSize * n);
+        }
         if (page == NULL)
             return false;
+        page_blocks = n;
+        page_count = 0;
+        share_card = THEKERNEL->config->value(msd_share_card_checksum)->by_default(false)->as_bool();
     } else {
         return false;
     }
@@ -204,6 +223,7 @@ bool USBMSD::connect()
 
 void USBMSD::reset() {
     stage = READ_CBW;
+    pending = PENDING_NONE;
     usb->endpointSetInterrupt(MSC_BulkOut.bEndpointAddress, true);
     usb->endpointSetInterrupt(MSC_BulkIn.bEndpointAddress, false);
 }
@@ -243,6 +263,10 @@ bool USBMSD::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus) {
             break;
     }
 
+    // the host is held off with NAKs until on_idle has written the page
+    if (pending == PENDING_WRITE)
+        return false;
+
     //reactivate readings on the OUT bulk endpoint
     usb->readStart(MSC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
     return true;
@@ -270,7 +294,8 @@ bool USBMSD::USBEvent_EPIn(uint8_t bEP, uint8_t bEPStatus) {
                 case READ10:
                 case READ12:
                     memoryRead();
-                    gotMoreData = true;
+                    // no more interrupts until on_idle has read the page
+                    gotMoreData = (pending != PENDING_READ);
                     break;
             }
             break;
@@ -301,6 +326,25 @@ bool USBMSD::USBEvent_EPIn(uint8_t bEP, uint8_t bEPStatus) {
     return gotMoreData;
 }
 
+// writes the sectors gathered in page with one multi-block write
+void USBMSD::flushPage() {
+    if (page_count == 0)
+        return;
+    if (!(disk->disk_status() & WRITE_PROTECT)) {
+        disk->disk_write_blocks((const char *)page, page_lba, page_count);
+    }
+    page_count = 0;
+}
+
+// the page is written, and if that was the end of the transfer the host gets its status
+void USBMSD::writeDone() {
+    flushPage();
+    if ((!length) || (stage != PROCESS_CBW)) {
+        csw.Status = (stage == ERROR) ? CSW_FAILED : CSW_PASSED;
+        sendCSW();
+    }
+}
+
 void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
 
     if (lba > BlockCount) {
@@ -309,16 +353,10 @@ void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
         usb->stallEndpoint(MSC_BulkOut.bEndpointAddress);
     }
 
-    // we fill an array in RAM of 1 block before writing it in memory
-    for (int i = 0; i < size; i++)
-        page[addr_in_block + i] = buf[i];
-
-    // if the array is filled, write it in memory
-    if ((addr_in_block + size) >= BlockSize) {
-        if (!(disk->disk_status() & WRITE_PROTECT)) {
-            disk->disk_write((const char *)page, lba);
-        }
-    }
+    // we fill an array in RAM of up to page_blocks blocks before writing it in memory
+    if (page_count == 0)
+        page_lba = lba;
+    memcpy(&page[page_count * BlockSize + addr_in_block], buf, size);
 
     addr_in_block += size;
     length -= size;
@@ -327,11 +365,15 @@ void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
     {
         addr_in_block = 0;
         lba++;
+        page_count++;
     }
 
-    if ((!length) || (stage != PROCESS_CBW)) {
-        csw.Status = (stage == ERROR) ? CSW_FAILED : CSW_PASSED;
-        sendCSW();
+    // if the array is filled, or it is the last block, write it in memory
+    if (page_count >= page_blocks || (!length) || (stage != PROCESS_CBW)) {
+        if (share_card)
+            pending = PENDING_WRITE;
+        else
+            writeDone();
     }
 }
 
@@ -345,8 +387,11 @@ void USBMSD::memoryVerify (uint8_t * buf, uint16_t size) {
     }
 
     // beginning of a new block -> load a whole block in RAM
-    if (addr_in_block == 0)
+    if (addr_in_block == 0) {
         disk->disk_read((char *)page, lba);
+        page_lba = lba;
+        page_count = 0;
+    }
 
     // info are in RAM -> no need to re-read memory
     for (n = 0; n < size; n++) {
@@ -636,6 +681,18 @@ void USBMSD::testUnitReady (void) {
     sendCSW();
 }
 
+// we read as many of the blocks left as fit in the page, the card streams them with one command
+void USBMSD::readPage() {
+    uint32_t count = length / BlockSize;
+    if (count > page_blocks) count = page_blocks;
+    if (count > BlockCount - lba) count = BlockCount - lba;
+    if (count < 1) count = 1;
+    iprintf("MSD:LBA %lu+%lu:", lba, count);
+    disk->disk_read_blocks((char *)page, lba, count);
+    page_lba = lba;
+    page_count = count;
+}
+
 void USBMSD::memoryRead (void) {
     uint32_t n;
 
@@ -647,17 +704,19 @@ void USBMSD::memoryRead (void) {
         stage = ERROR;
     }
 
-    // we read an entire block
-    if (addr_in_block == 0)
+    if (addr_in_block == 0 && (page_count == 0 || lba < page_lba || lba >= page_lba + page_count))
     {
-        iprintf("MSD:LBA %lu:", lba);
-        disk->disk_read((char *)page, lba);
+        if (share_card) {
+            pending = PENDING_READ;
+            return;
+        }
+        readPage();
     }
 
     iprintf(" %u", addr_in_block / MAX_PACKET_SIZE_EPBULK);
 
     // write data which are in RAM
-    usb->writeNB(MSC_BulkIn.bEndpointAddress, &page[addr_in_block], n, MAX_PACKET_SIZE_EPBULK);
+    usb->writeNB(MSC_BulkIn.bEndpointAddress, &page[(lba - page_lba) * BlockSize + addr_in_block], n, MAX_PACKET_SIZE_EPBULK);
 
     addr_in_block += n;
 
@@ -727,6 +786,9 @@ bool USBMSD::infoTransfer (void) {
 
     addr_in_block = 0;
 
+    // the card may have been written since, by the host or by us, so nothing read before is kept
+    page_count = 0;
+
 //     iprintf("MSD:transferring %lu blocks from LBA %lu.\n", blocks, lba);
 
     return true;
@@ -734,7 +796,22 @@ bool USBMSD::infoTransfer (void) {
 
 void USBMSD::on_module_loaded()
 {
-    connect();
+    if (connect() && share_card)
+        register_for_event(ON_IDLE);
+}
+
+// one page for the host each time, in the main loop between the player's reads so the two never meet on the card
+void USBMSD::on_idle(void *argument)
+{
+    if (pending == PENDING_READ) {
+        readPage();
+        pending = PENDING_NONE;
+        memoryRead();
+    } else if (pending == PENDING_WRITE) {
+        writeDone();
+        pending = PENDING_NONE;
+        usb->readStart(MSC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
+    }
 }
 
 bool USBMSD::USBEvent_busReset(void)
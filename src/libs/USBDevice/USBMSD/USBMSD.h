@@ -90,6 +90,7 @@ public:
     bool USBEvent_suspendStateChanged(bool suspended);
 
     virtual void on_module_loaded(void);
+    void on_idle(void *argument);
 
     // USB descriptors
     usbdesc_interface MSC_Interface;
@@ -159,7 +160,23 @@ private:
     bool memOK;
 
     // cache in RAM before writing in memory. Useful also to read a block.
+    // holds page_blocks sectors so a transfer goes to the card as one multi-block read or write
     uint8_t * page;
+    uint16_t page_blocks;
+
+    // the sectors in page, from page_lba, read ahead or waiting to be written
+    uint32_t page_lba;
+    uint16_t page_count;
+
+    // with the card shared, what the host wants done to it waits here for on_idle, so it is never read or written
+    // in the middle of a read by the player
+    enum Pending {
+        PENDING_NONE,
+        PENDING_READ,         // the page memoryRead needs next
+        PENDING_WRITE,        // page is full, or the transfer ended
+    };
+    volatile uint8_t pending;
+    bool share_card;
 
     // USB packet buffer
     uint8_t buffer[MAX_PACKET_SIZE_EPBULK];
@@ -181,6 +198,9 @@ private:
     bool requestSense (void);
     void memoryVerify (uint8_t * buf, uint16_t size);
     void memoryWrite (uint8_t * buf, uint16_t size);
+    void readPage();
+    void flushPage();
+    void writeDone();
     void reset();
     void fail();
 };
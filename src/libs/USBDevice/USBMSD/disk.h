@@ -14,6 +14,22 @@ public:
      */
     virtual int disk_read(char * data, uint32_t block) { return 0; };
 
+    /*
+     * read consecutive blocks, disks that can stream them faster than one at a time override this
+     *
+     * @param data pointer where will be stored read data, count blocks long
+     * @param block first block number
+     * @param count number of blocks
+     * @returns 0 if successful
+     */
+    virtual int disk_read_blocks(char * data, uint32_t block, int count) {
+        for (int i = 0; i < count; i++) {
+            int r = disk_read(data + i * 512, block + i);
+            if (r) return r;
+        }
+        return 0;
+    };
+
     /*
      * write a block on a storage chip
      *
@@ -23,6 +39,22 @@ public:
      */
     virtual int disk_write(const char * data, uint32_t block) { return 0; };
 
+    /*
+     * write consecutive blocks, like disk_read_blocks
+     *
+     * @param data data to write, count blocks long
+     * @param block first block number
+     * @param count number of blocks
+     * @returns 0 if successful
+     */
+    virtual int disk_write_blocks(const char * data, uint32_t block, int count) {
+        for (int i = 0; i < count; i++) {
+            int r = disk_write(data + i * 512, block + i);
+            if (r) return r;
+        }
+        return 0;
+    };
+
     /*
      * Disk initilization
      */
@@ -58,6 +90,11 @@ public:
 
     virtual int disk_sync() { return 0; };
 
+    /*
+     * count of the writes made so far, by anyone, so a cache above the disk can tell when it was written under it
+     */
+    virtual uint32_t disk_writes() { return 0; };
+
     virtual bool busy() = 0;
 };
 
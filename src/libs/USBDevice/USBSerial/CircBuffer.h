@@ -20,6 +20,7 @@
 #define CIRCBUFFER_H
 
 #include <stdlib.h>
+#include <string.h>
 #include "sLPC17xx.h"
 #include "platform_memory.h"
 
@@ -33,6 +34,17 @@ public:
         buf = (uint8_t*) AHB0.alloc(size * sizeof(T));
     };
 
+    // only while nothing is using the buffer, the old one is kept if there is no room for the new one
+    bool resize(int length) {
+        T *n = (T*) AHB0.alloc(length * sizeof(T));
+        if (n == NULL) return false;
+        AHB0.dealloc(buf);
+        buf = n;
+        size = length;
+        read = write = 0;
+        return true;
+    }
+
 	bool isFull() {
 		__disable_irq();
 		bool b= ((write + 1) % size == read);
@@ -64,6 +76,9 @@ public:
     uint16_t free() {
         return size - available() - 1;
     };
+    uint16_t capacity() {
+        return size - 1;
+    };
 
     void dump() {
         iprintf("[RingBuffer Sz:%2d Rd:%2d Wr:%2d Av:%2d Fr:%2d]\n", size, read, write, available(), free());
@@ -78,6 +93,35 @@ public:
         return(!empty);
     };
 
+    // the block ops are for one producer and one consumer, each copies with at most two memcpy and only takes
+    // what fits, unlike queue() which drops the oldest
+
+    uint16_t queue_block(const T *src, uint16_t n) {
+        uint16_t f = free();
+        if (n > f) n = f;
+        uint16_t w = write;
+        uint16_t first = size - w;
+        if (first > n) first = n;
+        memcpy(&buf[w], src, first * sizeof(T));
+        memcpy(&buf[0], src + first, (n - first) * sizeof(T));
+        __DMB(); // the data is in place before the consumer can see it
+        write = (w + n) % size;
+        return n;
+    }
+
+    uint16_t dequeue_block(T *dst, uint16_t n) {
+        uint16_t a = available();
+        if (n > a) n = a;
+        uint16_t r = read;
+        uint16_t first = size - r;
+        if (first > n) first = n;
+        memcpy(dst, &buf[r], first * sizeof(T));
+        memcpy(dst + first, &buf[0], (n - first) * sizeof(T));
+        __DMB(); // done with the slots before the producer can reuse them
+        read = (r + n) % size;
+        return n;
+    }
+
     void peek(T * c, int offset) {
         int h = (read + offset) % size;
         *c = buf[h];
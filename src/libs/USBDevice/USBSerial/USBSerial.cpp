@@ -24,6 +24,17 @@
 #include "libs/Kernel.h"
 #include "libs/SerialMessage.h"
 #include "StreamOutputPool.h"
+#include "modules/communication/utils/BinaryGcode.h"
+#include "modules/communication/RealtimeCommands.h"
+#include "checksumm.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "us_ticker_api.h"
+#include "LPC17xx.h"
+
+#define usb_serial_rx_buffer_checksum CHECKSUM("usb_serial_rx_buffer_size")
+#define usb_serial_tx_buffer_checksum CHECKSUM("usb_serial_tx_buffer_size")
+#define usb_serial_flush_lines_checksum CHECKSUM("usb_serial_flush_lines")
 
 // extern void setled(int, bool);
 #define setled(a, b) do {} while (0)
@@ -36,6 +47,9 @@ USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256 + 8), txbuf(128 + 8)
     nl_in_rx = 0;
     attach = attached = false;
     flush_to_nl = false;
+    binary_mode = false;
+    binary = nullptr;
+    flush_lines = true;
 }
 
 void USBSerial::ensure_tx_space(int space)
@@ -47,6 +61,25 @@ void USBSerial::ensure_tx_space(int space)
     }
 }
 
+// A line that has been queued goes into the endpoint now if nothing is already waiting there for the host, so a short
+// reply like ok is in the next packet the host asks for. While the endpoint is busy it waits and goes with what follows.
+void USBSerial::flush_line()
+{
+    if (!flush_lines)
+        return;
+    NVIC_DisableIRQ(USB_IRQn);
+    if (txbuf.available() > 0 && usb->endpointWriteIdle(CDC_BulkIn.bEndpointAddress))
+    {
+        uint8_t b[MAX_PACKET_SIZE_EPBULK];
+        int l = txbuf.available();
+        if (l > MAX_PACKET_SIZE_EPBULK)
+            l = MAX_PACKET_SIZE_EPBULK;
+        l = txbuf.dequeue_block(b, l);
+        send(b, l);
+    }
+    NVIC_EnableIRQ(USB_IRQn);
+}
+
 int USBSerial::_putc(int c)
 {
     if (!attached)
@@ -55,6 +88,8 @@ int USBSerial::_putc(int c)
     txbuf.queue(c);
 
     usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+    if (c == '\n')
+        flush_line();
     return 1;
 }
 
@@ -88,20 +123,50 @@ int USBSerial::_getc()
 
 int USBSerial::puts(const char *str)
 {
+    int n = strlen(str);
     if (!attached)
-        return strlen(str);
+        return n;
     int i = 0;
-    while (*str)
+    while (i < n)
     {
         ensure_tx_space(1);
-        txbuf.queue(*str);
-        if ((txbuf.available() % 64) == 0)
-            usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-        i++;
-        str++;
+        i += txbuf.queue_block((const uint8_t *)str + i, n - i);
+        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+    }
+    if (n > 0 && str[n - 1] == '\n')
+        flush_line();
+    return n;
+}
+
+// all or nothing, a host that isn't reading doesn't hold up the main loop, and doesn't get half a line either
+int USBSerial::broadcast(const char *str)
+{
+    int n = strlen(str);
+    if (!attached)
+        return n;
+    if (txbuf.free() < n)
+    {
+        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+        broadcast_drops++;
+        return 0;
     }
+    txbuf.queue_block((const uint8_t *)str, n);
+    usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
+    if (n > 0 && str[n - 1] == '\n')
+        flush_line();
+    return n;
+}
+
+// goes out as one packet, unless it lands behind something already queued
+int USBSerial::send_ok()
+{
+    if (!attached)
+        return 4;
+    ensure_tx_space(4);
+    txbuf.queue_block((const uint8_t *)"ok\r\n", 4);
     usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-    return i;
+    flush_line();
+    return 4;
 }
 
 uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
@@ -114,10 +179,7 @@ uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
     }
     if (size > 0)
     {
-        for (uint8_t i = 0; i < size; i++)
-        {
-            txbuf.queue(buf[i]);
-        }
+        txbuf.queue_block(buf, size);
         usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
     }
     return size;
@@ -144,18 +206,11 @@ bool USBSerial::USBEvent_EPIn(uint8_t bEP, uint8_t bEPStatus)
     iprintf("%d bytes queued\n", l);
     if (l > 0)
     {
+        // always a whole packet when there is that much queued
         if (l > MAX_PACKET_SIZE_EPBULK)
             l = MAX_PACKET_SIZE_EPBULK;
         iprintf("Sending %d bytes:\n\t", l);
-        int i;
-        for (i = 0; i < l; i++) {
-            txbuf.dequeue(&b[i]);
-            if (b[i] >= 32 && b[i] < 128)
-                iprintf("%c", b[i]);
-            else {
-                iprintf("\\x%02X", b[i]);
-            }
-        }
+        l = txbuf.dequeue_block(b, l);
         iprintf("\nSending...\n");
         send(b, l);
         iprintf("Sent\n");
@@ -194,8 +249,20 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     //we read the packet received and put it on the circular buffer
     readEP(c, &size);
     iprintf("Read %ld bytes:\n\t", size);
+
+    if (binary_mode)
+    {
+        // frames have no lines, so none of the long line handling applies, the host keeps within the window we gave it
+        rxbuf.queue_block(c, size);
+        usb->readStart(CDC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
+        return rxbuf.free() >= MAX_PACKET_SIZE_EPBULK;
+    }
     for (uint8_t i = 0; i < size; i++) {
 
+        // done as it comes in, it doesn't wait behind the lines before it, though it can't get here while rxbuf is full
+        if (THEKERNEL->realtime != nullptr && THEKERNEL->realtime->handle(c[i], this))
+            continue;
+
         if (flush_to_nl == false)
             rxbuf.queue(c[i]);
 
@@ -246,7 +313,7 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     return r;
 }
 
-uint8_t USBSerial::available()
+uint16_t USBSerial::available()
 {
     return rxbuf.available();
 }
@@ -258,7 +325,16 @@ bool USBSerial::ready()
 
 void USBSerial::on_module_loaded()
 {
-    this->register_for_event(ON_MAIN_LOOP);
+    // a bigger transmit buffer means long replies like M503 don't hold up the main loop waiting for the host
+    int rx = THEKERNEL->config->value(usb_serial_rx_buffer_checksum)->by_default(256 + 8)->as_number();
+    int tx = THEKERNEL->config->value(usb_serial_tx_buffer_checksum)->by_default(512)->as_number();
+    // room for two packets and the terminator
+    if (rx >= 2 * MAX_PACKET_SIZE_EPBULK + 1 && rx < 65536 && rx != rxbuf.capacity() + 1) rxbuf.resize(rx);
+    if (tx >= MAX_PACKET_SIZE_EPBULK + 1 && tx < 65536 && tx != txbuf.capacity() + 1) txbuf.resize(tx);
+    // false leaves everything to go when the host next asks, which batches better for hosts that read in bulk
+    flush_lines = THEKERNEL->config->value(usb_serial_flush_lines_checksum)->by_default(true)->as_bool();
+
+    this->register_for_main_loop(MAIN_LOOP_FEED, "usb serial");
 }
 
 void USBSerial::on_main_loop(void *argument)
@@ -282,8 +358,15 @@ void USBSerial::on_main_loop(void *argument)
             txbuf.flush();
             rxbuf.flush();
             nl_in_rx = 0;
+            binary_mode = false;
+            report_rx_space = false;
         }
     }
+    if (binary_mode)
+    {
+        on_main_loop_binary();
+        return;
+    }
     if (nl_in_rx)
     {
         string received;
@@ -292,11 +375,27 @@ void USBSerial::on_main_loop(void *argument)
             char c = _getc();
             if( c == '\n' || c == '\r')
             {
+                if (received == "binary")
+                {
+                    // the host must wait for this reply before sending frames, anything after the line is already counted as text
+                    if (binary == nullptr)
+                        binary = new BinaryGcode();
+                    binary->reset();
+                    rxbuf.flush();
+                    nl_in_rx = 0;
+                    flush_to_nl = false;
+                    binary_mode = true;
+                    printf("ok binary window:%d\r\n", rxbuf.capacity());
+                    return;
+                }
+
                 struct SerialMessage message;
                 message.message = received;
                 message.stream = this;
                 iprintf("USBSerial Received: %s\n", message.message.c_str());
+                line_received_us = us_ticker_read();
                 THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+                line_received_us = 0;
                 return;
             }
             else
@@ -307,6 +406,44 @@ void USBSerial::on_main_loop(void *argument)
     }
 }
 
+// decode frames as they arrive, executing at most one per call so the rest of the main loop keeps running
+void USBSerial::on_main_loop_binary()
+{
+    uint8_t c;
+    while (rxbuf.dequeue(&c))
+    {
+        BinaryGcode::Result r = binary->feed(c);
+        if (r == BinaryGcode::NOTHING)
+            continue;
+
+        if (r == BinaryGcode::FRAME)
+        {
+            uint8_t seq = binary->get_seq();
+            bool more = binary->execute(this);
+            printf("ack %d\r\n", seq);
+            if (!more)
+            {
+                binary_mode = false;
+                printf("ok text\r\n");
+            }
+            break;
+        }
+        if (r == BinaryGcode::BAD_FRAME)
+        {
+            printf("nak %d\r\n", binary->get_expected_seq());
+            continue;
+        }
+        // cancelled
+        binary_mode = false;
+        printf("ok text\r\n");
+        break;
+    }
+
+    // the endpoint stops when the buffer can't take another packet, restart it once there is room
+    if (rxbuf.free() >= MAX_PACKET_SIZE_EPBULK)
+        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+}
+
 void USBSerial::on_attach()
 {
     attach = true;
@@ -26,6 +26,8 @@
 #include "Module.h"
 #include "StreamOutput.h"
 
+class BinaryGcode;
+
 class USBSerial_Receiver {
 protected:
     virtual bool SerialEvent_RX(void) = 0;
@@ -38,9 +40,16 @@ public:
     int _putc(int c);
     int _getc();
     int puts(const char *);
+    int broadcast(const char *);
+    int send_ok();
 
-    uint8_t available();
+    uint16_t available();
     bool ready();
+    int rx_free(bool lines) { return lines ? -1 : rxbuf.free(); }
+    int rx_capacity(bool lines) { return lines ? -1 : rxbuf.capacity(); }
+    bool is_persistent() const { return true; }
+    // with no host what is written is thrown away, so there is always room
+    int tx_room() { return attached ? txbuf.free() : 0x7FFF; }
 
     uint16_t writeBlock(const uint8_t * buf, uint16_t size);
 
@@ -61,6 +70,8 @@ protected:
     virtual void on_detach(void);
 
     void ensure_tx_space(int);
+    void flush_line();
+    void on_main_loop_binary();
 
     volatile bool attach;
     bool attached;
@@ -75,6 +86,13 @@ protected:
     // flushing until we find a newline.
     // this flag asserts when we are doing this
     bool flush_to_nl;
+
+    // Setting : usb_serial_flush_lines, a queued line is written to the endpoint straight away when it is idle
+    bool flush_lines;
+
+    // sending the line "binary" switches to framed binary gcode until the host ends it, see BinaryGcode.h
+    volatile bool binary_mode;
+    BinaryGcode *binary;
 private:
     USB *usb;
 //     mbed::FunctionPointer rx;
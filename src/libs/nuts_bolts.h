@@ -29,6 +29,15 @@ along with Grbl. If not, see <http://www.gnu.org/licenses/>.
 #define BETA_STEPPER 1
 #define GAMMA_STEPPER 2
 
+// actuators after the first three are moved one to one by the A, B and C axes, build with -DMAX_ROBOT_ACTUATORS=4 to 6
+// to have them, each costs a little memory in every block whether it is configured or not
+#ifndef MAX_ROBOT_ACTUATORS
+#define MAX_ROBOT_ACTUATORS 3
+#endif
+#if MAX_ROBOT_ACTUATORS < 3 || MAX_ROBOT_ACTUATORS > 6
+#error "MAX_ROBOT_ACTUATORS must be from 3 to 6"
+#endif
+
 #define clear_vector(a) memset(a, 0, sizeof(a))
 #define clear_vector_float(a) memset(a, 0, sizeof(a))
 
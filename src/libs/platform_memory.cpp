@@ -1,4 +1,38 @@
 #include "platform_memory.h"
 
+#include <string.h>
+
 MemoryPool* _AHB0;
 MemoryPool* _AHB1;
+
+MemoryPlacement placement_from_string(const char* s, MemoryPlacement def)
+{
+    if (strcmp(s, "heap") == 0) return PLACE_HEAP;
+    if (strcmp(s, "ahb0") == 0) return PLACE_AHB0;
+    if (strcmp(s, "ahb1") == 0) return PLACE_AHB1;
+    if (strcmp(s, "ahb") == 0)  return PLACE_AHB;
+    return def;
+}
+
+void* placed_alloc(size_t nbytes, MemoryPlacement where)
+{
+    void* p = NULL;
+    if (where == PLACE_AHB0 || where == PLACE_AHB)
+        p = AHB0.alloc(nbytes);
+    if (p == NULL && (where == PLACE_AHB1 || where == PLACE_AHB))
+        p = AHB1.alloc(nbytes);
+    if (p == NULL)
+        p = malloc(nbytes);
+    return p;
+}
+
+void placed_free(void* p)
+{
+    if (p == NULL) return;
+    if (AHB0.has(p))
+        AHB0.dealloc(p);
+    else if (AHB1.has(p))
+        AHB1.dealloc(p);
+    else
+        free(p);
+}
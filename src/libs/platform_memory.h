@@ -9,4 +9,22 @@
 extern MemoryPool* _AHB0;
 extern MemoryPool* _AHB1;
 
+// where a buffer should be put, the heap is the fallback for all of them when the banks are full
+enum MemoryPlacement {
+    PLACE_HEAP,
+    PLACE_AHB0,
+    PLACE_AHB1,
+    PLACE_AHB,      // AHB0 then AHB1
+};
+
+// the placement named by a config value, heap, ahb0, ahb1 or ahb, def if it is none of them
+MemoryPlacement placement_from_string(const char* s, MemoryPlacement def);
+
+void* placed_alloc(size_t nbytes, MemoryPlacement where);
+// frees memory from placed_alloc, wherever it ended up
+void  placed_free(void* p);
+
+// storage for n objects of T, they are not constructed
+template<typename T> T* placed_alloc(size_t n, MemoryPlacement where) { return static_cast<T*>(placed_alloc(n * sizeof(T), where)); }
+
 #endif /* _PLATFORM_MEMORY_H */
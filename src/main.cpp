@@ -16,8 +16,10 @@
 #include "modules/tools/scaracal/SCARAcal.h"
 #include "modules/tools/switch/SwitchPool.h"
 #include "modules/tools/temperatureswitch/TemperatureSwitch.h"
+#include "modules/tools/encoderfeedback/EncoderFeedback.h"
 
 #include "modules/robot/Conveyor.h"
+#include "modules/robot/BoardSync.h"
 #include "modules/utils/simpleshell/SimpleShell.h"
 #include "modules/utils/configurator/Configurator.h"
 #include "modules/utils/currentcontrol/CurrentControl.h"
@@ -30,6 +32,9 @@
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "StepTicker.h"
+#include "IsrProfiler.h"
+#include "EventTrace.h"
+#include "LoopMonitor.h"
 
 // #include "libs/ChaNFSSD/SDFileSystem.h"
 #include "libs/nuts_bolts.h"
@@ -53,11 +58,27 @@
 #include "system_LPC17xx.h"
 
 #include "mbed.h"
+#include "us_ticker_api.h"
 
 #define second_usb_serial_enable_checksum  CHECKSUM("second_usb_serial_enable")
 #define disable_msd_checksum  CHECKSUM("msd_disable")
 #define disable_leds_checksum  CHECKSUM("leds_disable")
 #define dfu_enable_checksum  CHECKSUM("dfu_enable")
+#define sd_max_frequency_checksum  CHECKSUM("sd_max_frequency")
+#define sd_cache_sectors_checksum  CHECKSUM("sd_cache_sectors")
+
+// the enables of the optional modules
+#define laser_module_enable_checksum  CHECKSUM("laser_module_enable")
+#define spindle_enable_checksum  CHECKSUM("spindle_enable")
+#define board_sync_enable_checksum  CHECKSUM("board_sync_enable")
+#define touchprobe_enable_checksum  CHECKSUM("touchprobe_enable")
+#define panel_checksum  CHECKSUM("panel")
+#define zprobe_checksum  CHECKSUM("zprobe")
+#define scaracal_checksum  CHECKSUM("scaracal")
+#define network_checksum  CHECKSUM("network")
+#define enable_checksum  CHECKSUM("enable")
+#define encoder_feedback_checksum  CHECKSUM("encoder_feedback")
+#define watchdog_timeout_checksum  CHECKSUM("watchdog_timeout")
 
 // Watchdog wd(5000000, WDT_MRI);
 
@@ -102,7 +123,17 @@ void init() {
     stepticker_debug_pin= 0;
 #endif
 
+#ifdef ISR_PROFILE
+    IsrProfiler::init();
+#endif
+
+#ifdef EVENT_TRACE
+    EventTrace::init();
+#endif
+
+    uint32_t boot_start = us_ticker_read();
     Kernel* kernel = new Kernel();
+    kernel->add_boot_time("kernel", us_ticker_read() - boot_start);
 
     kernel->streams->printf("Smoothie Running @%ldMHz\r\n", SystemCoreClock / 1000000);
     Version version;
@@ -111,9 +142,17 @@ void init() {
     //some boards don't have leds.. TOO BAD!
     kernel->use_leds= !kernel->config->value( disable_leds_checksum )->by_default(false)->as_bool();
 
+    // the card was first set up to read the config, this sets it up again with the configured clock limit
+    sd.set_max_frequency(kernel->config->value( sd_max_frequency_checksum )->by_default(25000000)->as_int());
+    uint32_t start = us_ticker_read();
     bool sdok= (sd.disk_initialize() == 0);
+    kernel->add_boot_time("sd card", us_ticker_read() - start);
     if(!sdok) kernel->streams->printf("SDCard is disabled\r\n");
 
+    // FAT and directory sectors, so a file being played doesn't push out the ones ls or the panel needs
+    if(!mounter.set_cache_sectors(kernel->config->value( sd_cache_sectors_checksum )->by_default(4)->as_int()))
+        kernel->streams->printf("No room for the SD sector cache\r\n");
+
 #ifdef DISABLEMSD
     // attempt to be able to disable msd in config
     if(sdok && !kernel->config->value( disable_msd_checksum )->by_default(false)->as_bool()){
@@ -130,20 +169,21 @@ void init() {
 
 
     // Create and add main modules
-    kernel->add_module( new SimpleShell() );
-    kernel->add_module( new Configurator() );
-    kernel->add_module( new CurrentControl() );
-    kernel->add_module( new PauseButton() );
-    kernel->add_module( new PlayLed() );
-    kernel->add_module( new Endstops() );
-    kernel->add_module( new Player() );
-
-
-    // these modules can be completely disabled in the Makefile by adding to EXCLUDE_MODULES
+    kernel->add_module( new SimpleShell(), "simple shell" );
+    kernel->add_module( new Configurator(), "configurator" );
+    kernel->add_module( new CurrentControl(), "current control" );
+    kernel->add_module( new PauseButton(), "pause button" );
+    kernel->add_module( new PlayLed(), "play led" );
+    kernel->add_module( new Endstops(), "endstops" );
+    kernel->add_module( new Player(), "player" );
+
+
+    // these modules can be completely disabled in the Makefile by adding to EXCLUDE_MODULES.
+    // Those that are off in the config are not made at all, rather than made only to delete themselves, which leaves holes
+    // in the heap. Each still checks its enable as well
     #ifndef NO_TOOLS_SWITCH
     SwitchPool *sp= new SwitchPool();
-    sp->load_tools();
-    delete sp;
+    if(!sp->load_tools()) delete sp;
     #endif
     #ifndef NO_TOOLS_EXTRUDER
     // NOTE this must be done first before Temperature control so ToolManager can handle Tn before temperaturecontrol module does
@@ -160,53 +200,69 @@ void init() {
     kernel->temperature_control_pool= new TemperatureControlPool(); // so we can get just an empty temperature control array
     #endif
     #ifndef NO_TOOLS_LASER
-    kernel->add_module( new Laser() );
+    if(kernel->config->value( laser_module_enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new Laser(), "laser" );
     #endif
     #ifndef NO_TOOLS_SPINDLE
-    kernel->add_module( new Spindle() );
+    if(kernel->config->value( spindle_enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new Spindle(), "spindle" );
     #endif
     #ifndef NO_UTILS_PANEL
-    kernel->add_module( new Panel() );
+    if(kernel->config->value( panel_checksum, enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new Panel(), "panel" );
     #endif
     #ifndef NO_TOOLS_TOUCHPROBE
-    kernel->add_module( new Touchprobe() );
+    if(kernel->config->value( touchprobe_enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new Touchprobe(), "touchprobe" );
     #endif
     #ifndef NO_TOOLS_ZPROBE
-    kernel->add_module( new ZProbe() );
+    if(kernel->config->value( zprobe_checksum, enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new ZProbe(), "zprobe" );
     #endif
     #ifndef NO_TOOLS_SCARACAL
-    kernel->add_module( new SCARAcal() );
+    if(kernel->config->value( scaracal_checksum, enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new SCARAcal(), "scaracal" );
     #endif
     #ifndef NONETWORK
-    kernel->add_module( new Network() );
+    if(kernel->config->value( network_checksum, enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new Network(), "network" );
     #endif
     #ifndef NO_TOOLS_TEMPERATURESWITCH
     // Must be loaded after TemperatureControlPool
-    kernel->add_module( new TemperatureSwitch() );
+    kernel->add_module( new TemperatureSwitch(), "temperature switch" );
+    #endif
+    #ifndef NO_TOOLS_ENCODERFEEDBACK
+    // after Endstops, so it hears of a G28 once the homing is done
+    if(kernel->config->value( encoder_feedback_checksum, enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new EncoderFeedback(), "encoder feedback" );
     #endif
+    // after the robot and stepper, it hooks into the conveyor and the feed hold
+    if(kernel->config->value( board_sync_enable_checksum )->by_default(false)->as_bool()) kernel->add_module( new BoardSync(), "board sync" );
 
     // Create and initialize USB stuff
+    start = us_ticker_read();
     u.init();
+    kernel->add_boot_time("usb init", us_ticker_read() - start);
 
 #ifdef DISABLEMSD
     if(sdok && msc != NULL){
-        kernel->add_module( msc );
+        kernel->add_module( msc, "usb msd" );
     }
 #else
-    kernel->add_module( &msc );
+    kernel->add_module( &msc, "usb msd" );
 #endif
 
-    kernel->add_module( &usbserial );
+    kernel->add_module( &usbserial, "usb serial" );
     if( kernel->config->value( second_usb_serial_enable_checksum )->by_default(false)->as_bool() ){
-        kernel->add_module( new(AHB0) USBSerial(&u) );
+        kernel->add_module( new(AHB0) USBSerial(&u), "second usb serial" );
     }
 
     if( kernel->config->value( dfu_enable_checksum )->by_default(false)->as_bool() ){
-        kernel->add_module( new(AHB0) DFU(&u));
+        kernel->add_module( new(AHB0) DFU(&u), "dfu" );
+    }
+    kernel->add_module( &u, "usb" );
+
+    // the board resets if the main loop stops going round for this many seconds, looptime shows how close it gets
+    float wdt= kernel->config->value( watchdog_timeout_checksum )->by_default(0)->as_number();
+    if(wdt > 0) {
+        kernel->add_module( new Watchdog(wdt * 1000000, WDT_RESET), "watchdog" );
+        kernel->loop_monitor->set_watchdog_ms(wdt * 1000);
     }
-    kernel->add_module( &u );
 
     // clear up the config cache to save some memory
+    kernel->config->report_lookups(kernel->streams);
     kernel->config->config_cache_clear();
 
     if(kernel->use_leds) {
@@ -233,6 +289,7 @@ void init() {
         }
     }
 
+    kernel->add_boot_time("total", us_ticker_read() - boot_start);
     THEKERNEL->step_ticker->start();
 }
 
@@ -243,6 +300,7 @@ int main()
     uint16_t cnt= 0;
     // Main loop
     while(1){
+        THEKERNEL->loop_monitor->pass();
         if(THEKERNEL->use_leds) {
             // flash led 2 to show we are alive
             leds[1]= (cnt++ & 0x1000) ? 1 : 0;
@@ -6,6 +6,8 @@
 */
 
 #include <string>
+#include <string.h>
+#include <stdlib.h>
 using std::string;
 #include "libs/Module.h"
 #include "libs/Kernel.h"
@@ -14,15 +16,20 @@ using std::string;
 #include "libs/nuts_bolts.h"
 #include "GcodeDispatch.h"
 #include "modules/robot/Conveyor.h"
+#include "modules/robot/Robot.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "libs/StreamOutputPool.h"
-#include "libs/AppendFileStream.h"
+#include "libs/BufferedFileStream.h"
 #include "Config.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
+#include "us_ticker_api.h"
+
+#include <algorithm>
 
 #define return_error_on_unhandled_gcode_checksum    CHECKSUM("return_error_on_unhandled_gcode")
+#define gcode_lookahead_checksum                    CHECKSUM("gcode_lookahead")
 
 // goes in Flash, list of Mxxx codes that are allowed when in Halted state
 static const int allowed_mcodes[]= {105,114}; // get temp, get pos
@@ -33,12 +40,68 @@ static bool is_allowed_mcode(int m) {
     return false;
 }
 
+// times in us, kept as a log histogram with 4 buckets to each power of two so the percentiles are within a fifth
+namespace {
+struct LatencyStats {
+    static const int nbuckets= 72;
+    uint32_t count, total, max;
+    uint32_t buckets[nbuckets];
+
+    void clear() { memset(this, 0, sizeof(*this)); }
+
+    static int bucket(uint32_t us) {
+        if(us < 4) return us;
+        int octave= 31 - __builtin_clz(us);
+        int b= (octave - 1) * 4 + ((us >> (octave - 2)) & 3);
+        return b < nbuckets ? b : nbuckets - 1;
+    }
+
+    // the last time that falls in bucket b
+    static uint32_t upper(int b) {
+        if(b < 4) return b;
+        int octave= b / 4 + 1;
+        return ((5 + (b & 3)) << (octave - 2)) - 1;
+    }
+
+    void add(uint32_t us) {
+        count++;
+        total+= us;
+        if(us > max) max= us;
+        buckets[bucket(us)]++;
+    }
+
+    uint32_t percentile(int p) const {
+        uint32_t want= ((uint64_t)count * p + 99) / 100, n= 0;
+        for (int b = 0; b < nbuckets; ++b) {
+            n+= buckets[b];
+            if(n >= want && n > 0) return std::min(upper(b), max);
+        }
+        return max;
+    }
+
+    void print(StreamOutput *stream, const char *name) const {
+        if(count == 0) {
+            stream->printf("%s: none\r\n", name);
+            return;
+        }
+        stream->printf("%s: avg %luus p50 %luus p99 %luus max %luus\r\n", name, total / count, percentile(50), percentile(99), max);
+    }
+};
+
+// from the line being received to the dispatcher getting it, and to its ok
+LatencyStats dispatch_latency, ok_latency;
+}
+
 GcodeDispatch::GcodeDispatch()
 {
     halted= false;
+    routes_dirty= false;
     uploading = false;
     currentline = -1;
     last_g= 255;
+    dispatching= 0;
+    lookahead_head= 0;
+    lookahead_count= 0;
 }
 
 // Called when the module has just been loaded
@@ -47,19 +110,242 @@ void GcodeDispatch::on_module_loaded()
     return_error_on_unhandled_gcode = THEKERNEL->config->value( return_error_on_unhandled_gcode_checksum )->by_default(false)->as_bool();
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
     this->register_for_event(ON_HALT);
+
+    // how many moves can be answered ahead of the block queue having room for them, 0 waits for the queue as each one comes
+    unsigned int n = THEKERNEL->config->value( gcode_lookahead_checksum )->by_default(0)->as_number();
+    if(n > 0) {
+        lookahead_queue.resize(n, nullptr);
+        this->register_for_main_loop(MAIN_LOOP_FEED, "gcode lookahead");
+    }
 }
 
 void GcodeDispatch::on_halt(void *arg)
 {
     // set halt stream and ignore everything until M999
     this->halted= (arg == nullptr);
+    if(this->halted) flush_lookahead(false);
+}
+
+// the robot takes the moves that were waiting as the block queue makes room for them
+void GcodeDispatch::on_main_loop(void *)
+{
+    while(lookahead_count > 0 && !THEKERNEL->conveyor->is_queue_full()) {
+        execute_lookahead();
+    }
+}
+
+// Keeps a move back to let the line handling carry on instead of waiting for the block queue. Only for a console's
+// own stream, as the gcode is used after the line that made it has gone, and only while the block queue is full or
+// there are others waiting, so they stay in order. False if it has to be dispatched now
+bool GcodeDispatch::lookahead(Gcode *gcode)
+{
+    if(lookahead_queue.empty() || lookahead_count >= lookahead_queue.size()) return false;
+    if(!gcode->has_g || gcode->has_m || gcode->g > 3 || !gcode->stream->is_persistent()) return false;
+    if(lookahead_count == 0 && !THEKERNEL->conveyor->is_queue_full()) return false;
+
+    lookahead_queue[(lookahead_head + lookahead_count) % lookahead_queue.size()] = gcode;
+    lookahead_count++;
+    return true;
+}
+
+// the oldest one waiting, which has already been answered
+void GcodeDispatch::execute_lookahead()
+{
+    Gcode *gcode = lookahead_queue[lookahead_head];
+    lookahead_queue[lookahead_head] = nullptr;
+    lookahead_head = (lookahead_head + 1) % lookahead_queue.size();
+    lookahead_count--;
+
+    THEKERNEL->robot->flush_merged_line(gcode);
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode);
+    delete gcode;
+}
+
+// gives the robot all of them, waiting for the block queue as it has to, or throws them away
+void GcodeDispatch::flush_lookahead(bool execute)
+{
+    while(lookahead_count > 0) {
+        if(execute) {
+            execute_lookahead();
+        } else {
+            delete lookahead_queue[lookahead_head];
+            lookahead_queue[lookahead_head] = nullptr;
+            lookahead_head = (lookahead_head + 1) % lookahead_queue.size();
+            lookahead_count--;
+        }
+    }
+}
+
+void GcodeDispatch::add_subscriber(EventCallback callback, Module *module, uint8_t gcode_filter, char letter, uint16_t code)
+{
+    subscribers.push_back({callback, module, code, letter, gcode_filter});
+    routes_dirty= true;
+}
+
+// Each route lists the modules that asked for its code merged with the ones that take everything of that letter, in
+// the order they registered so the result is the same as calling every module in turn
+void GcodeDispatch::build_routes()
+{
+    std::vector<uint32_t> keys;
+    for (auto& s : subscribers) {
+        if(s.letter != 0) keys.push_back(route_key(s.letter, s.code));
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    routes.clear();
+    route_targets.clear();
+    for (auto key : keys) {
+        uint8_t kind= (key >> 16) == 'G' ? GCODE_FILTER_G : GCODE_FILTER_M;
+        uint16_t first= route_targets.size();
+        for (size_t i = 0; i < subscribers.size(); ++i) {
+            const GcodeSubscriber& s= subscribers[i];
+            if(s.letter != 0 ? route_key(s.letter, s.code) != key : (s.gcode_filter & kind) == 0) continue;
+
+            // a module may have asked for the code and for the whole letter, it still only gets called once
+            bool dup= false;
+            for (size_t j = first; j < route_targets.size(); ++j) {
+                if(subscribers[route_targets[j]].module == s.module) dup= true;
+            }
+            if(!dup) route_targets.push_back(i);
+        }
+        routes.push_back({key, first, (uint16_t)(route_targets.size() - first)});
+    }
+
+    static const uint8_t kinds[3]= {GCODE_FILTER_G, GCODE_FILTER_M, GCODE_FILTER_OTHER};
+    for (int k = 0; k < 3; ++k) {
+        unrouted[k].clear();
+        for (size_t i = 0; i < subscribers.size(); ++i) {
+            if(subscribers[i].letter == 0 && (subscribers[i].gcode_filter & kinds[k])) unrouted[k].push_back(i);
+        }
+        unrouted[k].shrink_to_fit();
+    }
+    routes.shrink_to_fit();
+    route_targets.shrink_to_fit();
+    routes_dirty= false;
+}
+
+// Call the modules that want this gcode, stopping if one consumes it, returns how many were called
+// NOTE modules register at boot, the routes must not be rebuilt while a dispatch is in progress
+int GcodeDispatch::dispatch(Gcode *gcode)
+{
+    if(routes_dirty) build_routes();
+
+    const std::vector<uint16_t> *list= &unrouted[2];
+    uint16_t first= 0, count= list->size();
+    uint32_t key= 0;
+    if(gcode->has_g || gcode->has_m) {
+        key= gcode->has_g ? route_key('G', gcode->g) : route_key('M', gcode->m);
+        auto r= std::lower_bound(routes.begin(), routes.end(), key, [](const GcodeRoute& a, uint32_t k) { return a.key < k; });
+        if(r != routes.end() && r->key == key) {
+            list= &route_targets;
+            first= r->first;
+            count= r->count;
+        } else {
+            list= &unrouted[gcode->has_g ? 0 : 1];
+            count= list->size();
+        }
+    }
+
+    // so what the handlers do, like waiting for the queue to empty, can be put down to this gcode, handlers can dispatch too
+    uint32_t outer= dispatching;
+    dispatching= key;
+    int called= count;
+    for (uint16_t i = 0; i < count; ++i) {
+        const GcodeSubscriber& s= subscribers[(*list)[first + i]];
+        s.callback(s.module, gcode);
+        if(gcode->consumed) {
+            called= i + 1;
+            break;
+        }
+    }
+    dispatching= outer;
+    return called;
+}
+
+void GcodeDispatch::dump_routes(StreamOutput *stream)
+{
+    if(routes_dirty) build_routes();
+
+    for (auto& r : routes) {
+        stream->printf("%c%u:", (char)(r.key >> 16), (unsigned)(r.key & 0xFFFF));
+        for (uint16_t i = 0; i < r.count; ++i) {
+            stream->printf(" %p", subscribers[route_targets[r.first + i]].module);
+        }
+        stream->printf("\r\n");
+    }
+    static const char * const names[3]= {"other G", "other M", "other"};
+    for (int k = 0; k < 3; ++k) {
+        stream->printf("%s:", names[k]);
+        for (auto i : unrouted[k]) {
+            stream->printf(" %p", subscribers[i].module);
+        }
+        stream->printf("\r\n");
+    }
+}
+
+// with rxspace on the host is told how much room is left behind the stream, RX: in bytes and RXL: in lines
+void GcodeDispatch::send_ok(StreamOutput *stream, const char *txt)
+{
+    // only the first ok for a line is its latency
+    if(stream->line_received_us != 0) {
+        ok_latency.add(us_ticker_read() - stream->line_received_us);
+        stream->line_received_us= 0;
+    }
+
+    if(txt == nullptr && !stream->report_rx_space) {
+        stream->send_ok();
+        return;
+    }
+
+    char space[32];
+    int sn= 0;
+    space[0]= '\0';
+    if(stream->report_rx_space) {
+        int bytes= stream->rx_free(false);
+        int lines= stream->rx_free(true);
+        if(bytes >= 0) sn= snprintf(space, sizeof(space), " RX:%d", bytes);
+        if(lines >= 0) sn+= snprintf(space + sn, sizeof(space) - sn, " RXL:%d", lines);
+    }
+
+    // put the line together rather than format it, unless txt is too long for the buffer
+    int tn= txt == nullptr ? 0 : strlen(txt);
+    char buf[128];
+    if(tn + sn + 6 > (int)sizeof(buf)) {
+        stream->printf("ok %s%s\r\n", txt, space);
+        return;
+    }
+    int n= 2;
+    memcpy(buf, "ok", 2);
+    if(txt != nullptr) {
+        buf[n++]= ' ';
+        memcpy(&buf[n], txt, tn);
+        n+= tn;
+    }
+    memcpy(&buf[n], space, sn);
+    n+= sn;
+    memcpy(&buf[n], "\r\n", 3);
+    stream->puts(buf);
+}
+
+void GcodeDispatch::send_ok(Gcode *gcode)
+{
+    if( return_error_on_unhandled_gcode == true && gcode->accepted_by_module == false)
+        send_ok(gcode->stream, "(command unclaimed)");
+    else if(!gcode->txt_after_ok.empty()) {
+        send_ok(gcode->stream, gcode->txt_after_ok.c_str());
+        gcode->txt_after_ok.clear();
+    } else
+        send_ok(gcode->stream);
 }
 
 // When a command is received, if it is a Gcode, dispatch it as an object via an event
 void GcodeDispatch::on_console_line_received(void *line)
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(line);
+    SerialMessage& new_message = *static_cast<SerialMessage *>(line);
     string possible_command = new_message.message;
+    if(new_message.stream->line_received_us != 0)
+        dispatch_latency.add(us_ticker_read() - new_message.stream->line_received_us);
 
     int ln = 0;
     int cs = 0;
@@ -72,32 +358,35 @@ try_again:
 
         //Get linenumber
         if ( first_char == 'N' ) {
-            Gcode full_line = Gcode(possible_command, new_message.stream, false);
-            ln = (int) full_line.get_value('N');
-            int chksum = (int) full_line.get_value('*');
+            // the checksum, line number and M110 are all found in one pass over the line, which is then cut down in place
+            const char *buf = possible_command.c_str();
+            size_t len = possible_command.size();
+            ln = strtol(buf + 1, nullptr, 10);
+
+            //Calculate checksum, everything before the *
+            const char *star = (const char *)memchr(buf, '*', len);
+            if ( star != nullptr ) {
+                for (const char *c = buf; c < star; c++)
+                    cs = cs ^ *c;
+                cs &= 0xff;  // Defensive programming...
+                cs -= strtol(star + 1, nullptr, 10);
+                len = star - buf;
+            }
+
+            //Skip the line number
+            size_t lnsize = 0;
+            while ( lnsize < len && strchr("N0123456789.,- ", buf[lnsize]) != nullptr )
+                lnsize++;
 
             //Catch message if it is M110: Set Current Line Number
-            if ( full_line.has_m ) {
-                if ( full_line.m == 110 ) {
-                    currentline = ln;
-                    new_message.stream->printf("ok\r\n");
-                    return;
-                }
+            if ( lnsize < len && buf[lnsize] == 'M' && strtol(buf + lnsize + 1, nullptr, 10) == 110 ) {
+                currentline = ln;
+                send_ok(new_message.stream);
+                return;
             }
 
-            //Strip checksum value from possible_command
-            size_t chkpos = possible_command.find_first_of("*");
-            possible_command = possible_command.substr(0, chkpos);
-            //Calculate checksum
-            if ( chkpos != string::npos ) {
-                for (auto c = possible_command.cbegin(); *c != '*' && c != possible_command.cend(); c++)
-                    cs = cs ^ *c;
-                cs &= 0xff;  // Defensive programming...
-                cs -= chksum;
-            }
-            //Strip line number value from possible_command
-            size_t lnsize = possible_command.find_first_not_of("N0123456789.,- ");
-            possible_command = possible_command.substr(lnsize);
+            possible_command.resize(len);
+            possible_command.erase(0, lnsize);
 
         } else {
             //Assume checks succeeded
@@ -108,7 +397,7 @@ try_again:
         //Remove comments
         size_t comment = possible_command.find_first_of(";(");
         if( comment != string::npos ) {
-            possible_command = possible_command.substr(0, comment);
+            possible_command.resize(comment);
         }
 
         //If checksum passes then process message, else request resend
@@ -160,14 +449,12 @@ try_again:
 
                                 this->upload_filename = "/sd/" + single_command.substr(4); // rest of line is filename
                                 // open file
-                                upload_fd = fopen(this->upload_filename.c_str(), "w");
-                                if(upload_fd != NULL) {
+                                if(upload_file.open(this->upload_filename.c_str())) {
                                     this->uploading = true;
                                     new_message.stream->printf("Writing to file: %s\r\n", this->upload_filename.c_str());
                                 } else {
                                     new_message.stream->printf("open failed, File: %s.\r\n", this->upload_filename.c_str());
                                 }
-                                //printf("Start Uploading file: %s, %p\n", upload_filename.c_str(), upload_fd);
                                 continue;
 
                             case 112: // emergency stop, do the best we can with this
@@ -179,19 +466,43 @@ try_again:
                                 return;
 
                             case 500: // M500 save volatile settings to config-override
-                                // replace stream with one that writes to config-override file
-                                gcode->stream = new AppendFileStream(THEKERNEL->config_override_filename());
-                                // dispatch the M500 here so we can free up the stream when done
-                                THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
-                                delete gcode->stream;
-                                delete gcode;
-                                new_message.stream->printf("Settings Stored to %s\r\nok\r\n", THEKERNEL->config_override_filename());
+                                {
+                                    // replace stream with one that collects everything in RAM and rewrites config-override with it in one go
+                                    BufferedFileStream *fs = new BufferedFileStream(THEKERNEL->config_override_filename());
+                                    gcode->stream = fs;
+                                    // dispatch the M500 here so we can free up the stream when done
+                                    THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
+                                    bool ok = fs->close();
+                                    delete fs;
+                                    delete gcode;
+                                    if(ok) {
+                                        new_message.stream->printf("Settings Stored to %s\r\n", THEKERNEL->config_override_filename());
+                                    } else {
+                                        new_message.stream->printf("error writing %s\r\n", THEKERNEL->config_override_filename());
+                                    }
+                                }
+                                send_ok(new_message.stream);
                                 continue;
 
                             case 502: // M502 deletes config-override so everything defaults to what is in config
                                 remove(THEKERNEL->config_override_filename());
-                                new_message.stream->printf("config override file deleted %s, reboot needed\r\nok\r\n", THEKERNEL->config_override_filename());
+                                new_message.stream->printf("config override file deleted %s, reboot needed\r\n", THEKERNEL->config_override_filename());
+                                send_ok(new_message.stream);
+                                delete gcode;
+                                continue;
+
+                            case 412: // M412 line latency since the last M412 R, which clears it afterwards
+                                new_message.stream->printf("Lines timed: %lu\r\n", ok_latency.count);
+                                dispatch_latency.print(new_message.stream, "Received to dispatch");
+                                ok_latency.print(new_message.stream, "Received to ok");
+                                if(gcode->has_letter('R')) {
+                                    dispatch_latency.clear();
+                                    ok_latency.clear();
+                                }
+                                // the report is not one of the lines it is about
+                                new_message.stream->line_received_us= 0;
                                 delete gcode;
+                                send_ok(new_message.stream);
                                 continue;
 
                             case 503: { // M503 display live settings and indicates if there is an override file
@@ -209,19 +520,22 @@ try_again:
                         }
                     }
 
+                    if(lookahead(gcode)) {
+                        send_ok(new_message.stream);
+                        continue;
+                    }
+                    // anything else comes after the moves waiting ahead of it
+                    flush_lookahead(true);
+
                     //printf("dispatch %p: '%s' G%d M%d...", gcode, gcode->command.c_str(), gcode->g, gcode->m);
                     //Dispatch message!
+                    // anything but a move that could be merged with it comes after the line the robot is holding back
+                    THEKERNEL->robot->flush_merged_line(gcode);
                     THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
                     if(gcode->add_nl)
                         new_message.stream->printf("\r\n");
 
-                    if( return_error_on_unhandled_gcode == true && gcode->accepted_by_module == false)
-                        new_message.stream->printf("ok (command unclaimed)\r\n");
-                    else if(!gcode->txt_after_ok.empty()) {
-                        new_message.stream->printf("ok %s\r\n", gcode->txt_after_ok.c_str());
-                        gcode->txt_after_ok.clear();
-                    } else
-                        new_message.stream->printf("ok\r\n");
+                    send_ok(gcode);
 
                     delete gcode;
 
@@ -229,39 +543,33 @@ try_again:
                     // we are uploading a file so save it
                     if(single_command.substr(0, 3) == "M29") {
                         // done uploading, close file
-                        fclose(upload_fd);
-                        upload_fd = NULL;
+                        bool ok = upload_file.close();
                         uploading = false;
                         upload_filename.clear();
-                        new_message.stream->printf("Done saving file.\r\n");
+                        if(ok) {
+                            new_message.stream->printf("Done saving file.\r\n");
+                            upload_file.print_stats(new_message.stream);
+                        } else {
+                            new_message.stream->printf("Error:error writing to file.\r\n");
+                        }
                         continue;
                     }
 
-                    if(upload_fd == NULL) {
+                    if(!upload_file.is_open()) {
                         // error detected writing to file so discard everything until it stops
-                        new_message.stream->printf("ok\r\n");
+                        send_ok(new_message.stream);
                         continue;
                     }
 
                     single_command.append("\n");
-                    static int cnt = 0;
-                    if(fwrite(single_command.c_str(), 1, single_command.size(), upload_fd) != single_command.size()) {
+                    if(!upload_file.write(single_command.c_str(), single_command.size())) {
                         // error writing to file
                         new_message.stream->printf("Error:error writing to file.\r\n");
-                        fclose(upload_fd);
-                        upload_fd = NULL;
+                        upload_file.close();
                         continue;
 
                     } else {
-                        cnt += single_command.size();
-                        if (cnt > 400) {
-                            // HACK ALERT to get around fwrite corruption close and re open for append
-                            fclose(upload_fd);
-                            upload_fd = fopen(upload_filename.c_str(), "a");
-                            cnt = 0;
-                        }
-                        new_message.stream->printf("ok\r\n");
-                        //printf("uploading file write ok\n");
+                        send_ok(new_message.stream);
                     }
                 }
             }
@@ -285,7 +593,7 @@ try_again:
 
         // Ignore comments and blank lines
     } else if ( first_char == ';' || first_char == '(' || first_char == ' ' || first_char == '\n' || first_char == '\r' ) {
-        new_message.stream->printf("ok\r\n");
+        send_ok(new_message.stream);
     }
 }
 
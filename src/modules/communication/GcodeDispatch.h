@@ -11,6 +11,13 @@
 #include <string>
 using std::string;
 #include "libs/Module.h"
+#include "SectorWriter.h"
+
+#include <vector>
+#include <array>
+
+class Gcode;
+class StreamOutput;
 
 class GcodeDispatch : public Module
 {
@@ -19,17 +26,64 @@ public:
 
     virtual void on_module_loaded();
     virtual void on_console_line_received(void *line);
+    void on_main_loop(void *);
     void on_halt(void *arg);
+    bool is_halted() const { return halted; }
+
+    // a module with letter 0 gets every gcode that passes gcode_filter, otherwise just that one code
+    void add_subscriber(EventCallback callback, Module *module, uint8_t gcode_filter, char letter, uint16_t code);
+    int dispatch(Gcode *gcode);
+    // the letter << 16 | code of the gcode being dispatched, 0 outside dispatch or for one with neither G nor M
+    uint32_t get_dispatching() const { return dispatching; }
+    void dump_routes(StreamOutput *stream);
+    static void send_ok(StreamOutput *stream, const char *txt= nullptr);
+    // the ok for a dispatched gcode, with whatever the modules left in txt_after_ok
+    void send_ok(Gcode *gcode);
 
 private:
+    void build_routes();
+    bool lookahead(Gcode *gcode);
+    void execute_lookahead();
+    void flush_lookahead(bool execute);
+    static uint32_t route_key(char letter, uint16_t code) { return (letter << 16) | code; }
+
+    struct GcodeSubscriber {
+        EventCallback callback;
+        Module *module;
+        uint16_t code;
+        char letter;
+        uint8_t gcode_filter;
+    };
+    // in registration order, which is the order modules get called in
+    std::vector<GcodeSubscriber> subscribers;
+
+    // compiled from the subscribers before the first dispatch, sorted by key, one for each code any module asked for
+    struct GcodeRoute {
+        uint32_t key;
+        uint16_t first;     // into route_targets
+        uint16_t count;
+    };
+    std::vector<GcodeRoute> routes;
+    std::vector<uint16_t> route_targets;                // index into subscribers
+    std::array<std::vector<uint16_t>, 3> unrouted;      // codes nobody asked for, for G, M and anything else
+    uint32_t dispatching;
+
+    // moves from a console that have been answered but not yet given to the robot, because the block queue was full.
+    // A ring of gcode_lookahead entries, the rest of the line handling carries on while these wait
+    std::vector<Gcode*> lookahead_queue;
+    unsigned int lookahead_head;
+    unsigned int lookahead_count;
+
+
     int currentline;
     string upload_filename;
-    FILE *upload_fd;
+    SectorWriter upload_file;
     uint8_t last_g;
     struct {
         bool uploading: 1;
         bool halted: 1;
         bool return_error_on_unhandled_gcode:1;
+        bool routes_dirty:1;
     };
 };
 
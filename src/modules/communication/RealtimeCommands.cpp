@@ -0,0 +1,133 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RealtimeCommands.h"
+
+#include "libs/Kernel.h"
+#include "libs/StreamOutput.h"
+#include "StreamOutputPool.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "Robot.h"
+#include "Stepper.h"
+#include "Planner.h"
+#include "Conveyor.h"
+#include "Block.h"
+#include "StepperMotor.h"
+#include "arm_solutions/BaseSolution.h"
+
+#include <string.h>
+
+#define realtime_commands_enable_checksum CHECKSUM("realtime_commands_enable")
+
+#define CTRL_X 0x18
+
+RealtimeCommands::RealtimeCommands()
+{
+    this->enable = false;
+    this->do_halt = false;
+}
+
+void RealtimeCommands::on_module_loaded()
+{
+    // a ! or ~ in a comment would be taken as a command too, M28 uploads with them in should turn this off
+    this->enable = THEKERNEL->config->value(realtime_commands_enable_checksum)->by_default(true)->as_bool();
+    this->register_for_event(ON_IDLE);
+}
+
+void RealtimeCommands::on_idle(void *argument)
+{
+    if(this->do_halt) {
+        this->do_halt = false;
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        THEKERNEL->streams->printf("Halted by Ctrl-X - reset or M999 to continue\r\n");
+    }
+}
+
+bool RealtimeCommands::handle(char c, StreamOutput *stream)
+{
+    if(!this->enable) return false;
+
+    switch(c) {
+        case '?': send_status(stream); return true;
+        case '!': THEKERNEL->stepper->feed_hold(); return true;
+        case '~': THEKERNEL->stepper->resume(); return true;
+        case CTRL_X: this->do_halt = true; return true;
+    }
+    return false;
+}
+
+// printf with a float in an interrupt can get into malloc along with the main loop, so the numbers are put together here
+static char *put_number(char *p, float v, int decimals)
+{
+    if(v < 0.0F) {
+        *p++ = '-';
+        v = -v;
+    }
+    unsigned long scale = 1;
+    for (int i = 0; i < decimals; ++i) scale *= 10;
+    unsigned long n = (unsigned long)(v * scale + 0.5F);
+
+    char digits[12];
+    int len = 0;
+    do {
+        digits[len++] = '0' + n % 10;
+        n /= 10;
+        if(len == decimals) digits[len++] = '.';
+    } while(n > 0 || len <= decimals + (decimals > 0 ? 1 : 0));
+    while(len > 0) *p++ = digits[--len];
+    return p;
+}
+
+static char *put_text(char *p, const char *s)
+{
+    size_t n = strlen(s);
+    memcpy(p, s, n);
+    return p + n;
+}
+
+// a grbl style status line, <state|MPos:x,y,z|F:feed|Ov:override>, from where the motors are as it is asked for
+void RealtimeCommands::send_status(StreamOutput *stream)
+{
+    Robot *robot = THEKERNEL->robot;
+    Stepper *stepper = THEKERNEL->stepper;
+
+    const char *state;
+    const Block *block = stepper->get_current_block();
+    if(THEKERNEL->conveyor->is_halted()) state = "Alarm";
+    else if(stepper->get_hold_state() == Stepper::HOLD_SLOWING) state = "Hold:1";
+    else if(stepper->get_hold_state() == Stepper::HOLD_STOPPED) state = "Hold:0";
+    else if(block != nullptr || !THEKERNEL->conveyor->is_queue_empty()) state = "Run";
+    else state = "Idle";
+
+    float actuator_pos[3], pos[3];
+    for (int i = 0; i < 3; ++i) actuator_pos[i] = robot->actuators[i]->get_current_position();
+    robot->arm_solution->actuator_to_cartesian(actuator_pos, pos);
+
+    float feed = 0.0F;
+    if(block != nullptr && block->steps_event_count > 0 && stepper->get_hold_state() != Stepper::HOLD_STOPPED)
+        feed = stepper->get_trapezoid_adjusted_rate() * block->millimeters / block->steps_event_count * 60.0F;
+
+    char buf[96];
+    char *p = buf;
+    *p++ = '<';
+    p = put_text(p, state);
+    p = put_text(p, "|MPos:");
+    for (int i = 0; i < 3; ++i) {
+        if(i > 0) *p++ = ',';
+        p = put_number(p, pos[i], 3);
+    }
+    p = put_text(p, "|F:");
+    p = put_number(p, feed, 0);
+    p = put_text(p, "|Ov:");
+    p = put_number(p, THEKERNEL->planner->get_speed_factor() * 100.0F, 0);
+    p = put_text(p, ">\r\n");
+    *p = '\0';
+
+    stream->broadcast(buf);
+}
@@ -0,0 +1,44 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef REALTIMECOMMANDS_H
+#define REALTIMECOMMANDS_H
+
+#include "libs/Module.h"
+
+class StreamOutput;
+
+/*
+ * The single byte commands grbl senders use, taken out of the stream as it is received instead of waiting their turn
+ * behind the queued lines, which can be seconds of motion:
+ *
+ *   ?       status, answered straight away from where the motors are now
+ *   !       feed hold, slows down at the acceleration and stops
+ *   ~       resume from a feed hold
+ *   Ctrl-X  halt, as M112, M999 to carry on
+ */
+class RealtimeCommands : public Module {
+    public:
+        RealtimeCommands();
+
+        void on_module_loaded();
+        void on_idle(void *argument);
+
+        // the receive paths call this, in their interrupt if they have one, with each byte that comes in, true if it
+        // was a realtime command and should not go into the line
+        bool handle(char c, StreamOutput *stream);
+
+    private:
+        void send_status(StreamOutput *stream);
+
+        struct {
+            bool enable:1;
+            volatile bool do_halt:1;
+        };
+};
+
+#endif
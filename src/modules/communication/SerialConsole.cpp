@@ -6,32 +6,78 @@
 */
 
 #include <string>
+#include <string.h>
 #include <stdarg.h>
 using std::string;
 #include "libs/Module.h"
 #include "libs/Kernel.h"
 #include "libs/nuts_bolts.h"
 #include "SerialConsole.h"
-#include "libs/RingBuffer.h"
+#include "RealtimeCommands.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "libs/StreamOutputPool.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "platform_memory.h"
+#include "LPC17xx.h"
+#include "us_ticker_api.h"
+
+#define uart0_checksum             CHECKSUM("uart0")
+#define rx_buffer_size_checksum    CHECKSUM("rx_buffer_size")
+#define rx_buffer_memory_checksum  CHECKSUM("rx_buffer_memory")
+#define tx_buffer_size_checksum    CHECKSUM("tx_buffer_size")
+#define xon_xoff_checksum          CHECKSUM("xon_xoff")
+
+#define XON  0x11
+#define XOFF 0x13
 
 // Serial reading module
 // Treats every received line as a command and passes it ( via event call ) to the command dispatcher.
 // The command dispatcher will then ask other modules if they can do something with it
 SerialConsole::SerialConsole( PinName rx_pin, PinName tx_pin, int baud_rate ){
-    this->serial = new mbed::Serial( rx_pin, tx_pin );
+    this->serial = new UartSerial( rx_pin, tx_pin );
     this->serial->baud(baud_rate);
+    this->rx_buffer = NULL;
+    this->rx_size = 0;
+    this->rx_head = this->rx_tail = 0;
+    this->tx_buffer = NULL;
+    this->tx_size = 0;
+    this->tx_head = this->tx_tail = 0;
+    this->tx_flow = 0;
+    this->tx_idle = true;
+    this->newlines= 0;
+    this->overflow_count = this->overrun_count = this->framing_error_count = 0;
+    this->xon_xoff = false;
+    this->xoff_sent = false;
 }
 
 // Called when the module has just been loaded
 void SerialConsole::on_module_loaded() {
+    // the receive buffer, it is worth making this bigger if the host does not wait for ok before sending more
+    this->rx_size = THEKERNEL->config->value(uart0_checksum, rx_buffer_size_checksum)->by_default(256)->as_number();
+    if(this->rx_size < 16) this->rx_size = 16;
+    MemoryPlacement where = placement_from_string(THEKERNEL->config->value(uart0_checksum, rx_buffer_memory_checksum)->by_default("ahb0")->as_string().c_str(), PLACE_AHB0);
+    this->rx_buffer = placed_alloc<char>(this->rx_size, where);
+
+    // what is printed waits here for the uart rather than the main loop waiting on every character
+    int tx_size = THEKERNEL->config->value(uart0_checksum, tx_buffer_size_checksum)->by_default(256)->as_number();
+    if(tx_size >= 16) {
+        this->tx_buffer = placed_alloc<char>(tx_size, where);
+        this->tx_size = tx_size;
+    }
+
+    this->xon_xoff = THEKERNEL->config->value(uart0_checksum, xon_xoff_checksum)->by_default(false)->as_bool();
+    this->rx_high_watermark = (this->rx_size * 3) / 4;
+    this->rx_low_watermark = this->rx_size / 4;
+
     // We want to be called every time a new char is received
     this->serial->attach(this, &SerialConsole::on_serial_char_received, mbed::Serial::RxIrq);
+    if(this->tx_buffer != NULL) this->serial->attach(this, &SerialConsole::on_serial_tx_empty, mbed::Serial::TxIrq);
 
     // We only call the command dispatcher in the main loop, nowhere else
-    this->register_for_event(ON_MAIN_LOOP);
+    this->register_for_main_loop(MAIN_LOOP_FEED, "serial");
 
     // Add to the pack of streams kernel can call to, for example for broadcasting
     THEKERNEL->streams->append_stream(this);
@@ -39,44 +85,174 @@ void SerialConsole::on_module_loaded() {
 
 // Called on Serial::RxIrq interrupt, meaning we have received a char
 void SerialConsole::on_serial_char_received(){
-    while(this->serial->readable()){
-        char received = this->serial->getc();
+    uint32_t lsr;
+    // reading LSR clears the error bits, so we check them here rather than use readable()
+    while((lsr = this->serial->line_status()) & 0x01){
+        if(lsr & 0x02) this->overrun_count++;
+        if(lsr & 0x08) this->framing_error_count++;
+
+        char received = this->serial->getc_unchecked();
+        // a realtime command is done now, not in its turn after the lines before it
+        if(THEKERNEL->realtime != nullptr && THEKERNEL->realtime->handle(received, this)) continue;
         // convert CR to NL (for host OSs that don't send NL)
         if( received == '\r' ){ received = '\n'; }
-        this->buffer.push_back(received);
+
+        int next = this->rx_head + 1;
+        if(next == this->rx_size) next = 0;
+        if(next == this->rx_tail) {
+            // buffer is full, drop it rather than overwrite what we have
+            this->overflow_count++;
+            continue;
+        }
+        this->rx_buffer[this->rx_head] = received;
+        this->rx_head = next;
+        if( received == '\n' ){ this->newlines++; }
+    }
+
+    if(this->xon_xoff && !this->xoff_sent && rx_used() >= this->rx_high_watermark) {
+        this->xoff_sent = true;
+        if(this->tx_buffer != NULL) {
+            this->tx_flow = XOFF;
+            kick_tx();
+        } else {
+            this->serial->putc(XOFF);
+        }
+    }
+}
+
+// Called on Serial::TxIrq interrupt, the uart fifo is empty
+void SerialConsole::on_serial_tx_empty()
+{
+    fill_tx();
+}
+
+// the fifo holds 16 once the uart says it is empty, interrupts must be off or this is the interrupt
+void SerialConsole::fill_tx()
+{
+    int n = 0;
+    if(this->tx_flow != 0) {
+        this->serial->putc_unchecked(this->tx_flow);
+        this->tx_flow = 0;
+        n++;
+    }
+    int tail = this->tx_tail;
+    for (; n < 16 && tail != this->tx_head; n++) {
+        this->serial->putc_unchecked(this->tx_buffer[tail]);
+        if(++tail == this->tx_size) tail = 0;
+    }
+    this->tx_tail = tail;
+    this->tx_idle = (n == 0);
+}
+
+// start the uart on the buffer if it has run dry, otherwise the interrupt carries on by itself
+void SerialConsole::kick_tx()
+{
+    __disable_irq();
+    if(this->tx_idle) fill_tx();
+    __enable_irq();
+}
+
+// wait is for replies, a broadcast that doesn't fit is dropped whole, as is anything that would have to wait in an interrupt
+int SerialConsole::queue_tx(const char *s, int n, bool wait)
+{
+    bool can_wait = wait && (SCB->ICSR & 0x1FF) == 0 && __get_PRIMASK() == 0;
+    if(!can_wait && tx_free() < n) {
+        this->broadcast_drops++;
+        return 0;
     }
+
+    int done = 0;
+    while(done < n) {
+        int k = tx_free();
+        if(k == 0) {
+            // the interrupt is draining it
+            kick_tx();
+            continue;
+        }
+        if(k > n - done) k = n - done;
+        int head = this->tx_head;
+        int first = this->tx_size - head;
+        if(first > k) first = k;
+        memcpy(&this->tx_buffer[head], s + done, first);
+        memcpy(this->tx_buffer, s + done + first, k - first);
+        head += k;
+        if(head >= this->tx_size) head -= this->tx_size;
+        this->tx_head = head;
+        done += k;
+        kick_tx();
+    }
+    return n;
 }
 
 // Actual event calling must happen in the main loop because if it happens in the interrupt we will loose data
+// The line is copied straight out of the ring in at most two pieces, the interrupt counts lines so we don't have to look for one
 void SerialConsole::on_main_loop(void * argument){
-    if( this->has_char('\n') ){
-        string received;
-        received.reserve(20);
-        while(1){
-           char c;
-           this->buffer.pop_front(c);
-           if( c == '\n' ){
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
-                return;
-            }else{
-                received += c;
+    if( this->newlines == 0 ) return;
+
+    struct SerialMessage message;
+    message.stream = this;
+
+    const int length = this->rx_size;
+    int index = this->rx_tail;
+    int head = this->rx_head;
+    while( index != head ){
+        // the part of the ring that is contiguous from index
+        int end = (head > index) ? head : length;
+        const char *start = &this->rx_buffer[index];
+        const char *nl = (const char *)memchr(start, '\n', end - index);
+        if( nl != NULL ){
+            message.message.append(start, nl - start);
+            // free up the space before dispatching as that can take a while
+            index += (nl - start) + 1;
+            this->rx_tail = (index == length) ? 0 : index;
+            this->newlines--;
+            if(this->xoff_sent && rx_used() <= this->rx_low_watermark) {
+                this->xoff_sent = false;
+                if(this->tx_buffer != NULL) {
+                    this->tx_flow = XON;
+                    kick_tx();
+                } else {
+                    this->serial->putc(XON);
+                }
             }
+            this->line_received_us = us_ticker_read();
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+            this->line_received_us = 0;
+            return;
         }
+        message.message.append(start, end - index);
+        index = (end == length) ? 0 : end;
     }
+
+    // the count got out of step with the buffer, which should not happen as we drop chars instead of overwriting
+    this->newlines = 0;
 }
 
 
 int SerialConsole::puts(const char* s)
 {
-    return fwrite(s, strlen(s), 1, (FILE*)(*this->serial));
+    if(this->tx_buffer == NULL) return fwrite(s, strlen(s), 1, (FILE*)(*this->serial));
+    return queue_tx(s, strlen(s), true);
+}
+
+int SerialConsole::broadcast(const char* s)
+{
+    if(this->tx_buffer == NULL) return puts(s);
+    return queue_tx(s, strlen(s), false);
+}
+
+int SerialConsole::send_ok()
+{
+    if(this->tx_buffer == NULL) return puts("ok\r\n");
+    return queue_tx("ok\r\n", 4, true);
 }
 
 int SerialConsole::_putc(int c)
 {
-    return this->serial->putc(c);
+    if(this->tx_buffer == NULL) return this->serial->putc(c);
+    char ch = c;
+    queue_tx(&ch, 1, true);
+    return c;
 }
 
 int SerialConsole::_getc()
@@ -86,12 +262,21 @@ int SerialConsole::_getc()
 
 // Does the queue have a given char ?
 bool SerialConsole::has_char(char letter){
-    int index = this->buffer.tail;
-    while( index != this->buffer.head ){
-        if( this->buffer.buffer[index] == letter ){
+    int index = this->rx_tail;
+    while( index != this->rx_head ){
+        if( this->rx_buffer[index] == letter ){
             return true;
         }
-        index = this->buffer.next_block_index(index);
+        if( ++index == this->rx_size ) index = 0;
     }
     return false;
 }
+
+void SerialConsole::print_stats(StreamOutput *stream)
+{
+    stream->printf("rx buffer: %d/%d used, overflows: %lu, uart overruns: %lu, framing errors: %lu, xon/xoff: %s\r\n",
+        rx_used(), this->rx_size - 1, this->overflow_count, this->overrun_count, this->framing_error_count,
+        this->xon_xoff ? (this->xoff_sent ? "xoff" : "xon") : "off");
+    if(this->tx_buffer != NULL)
+        stream->printf("tx buffer: %d bytes, broadcasts dropped: %lu\r\n", this->tx_size - 1, this->broadcast_drops);
+}
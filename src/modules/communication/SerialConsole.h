@@ -13,30 +13,82 @@
 #include "libs/Kernel.h"
 #include <vector>
 #include <string>
+#include <atomic>
 using std::string;
-#include "libs/RingBuffer.h"
 #include "libs/StreamOutput.h"
 
 
 #define baud_rate_setting_checksum CHECKSUM("baud_rate")
 
+// mbed::Serial does not give us the line status, which we need to count receive errors
+class UartSerial : public mbed::Serial {
+    public:
+        UartSerial( PinName tx, PinName rx ) : mbed::Serial(tx, rx) {}
+        uint32_t line_status() { return _serial.uart->LSR; }
+        int getc_unchecked() { return _serial.uart->RBR; }
+        void putc_unchecked(int c) { _serial.uart->THR = c; }
+};
+
 class SerialConsole : public Module, public StreamOutput {
     public:
         SerialConsole( PinName rx_pin, PinName tx_pin, int baud_rate );
 
         void on_module_loaded();
         void on_serial_char_received();
+        void on_serial_tx_empty();
         void on_main_loop(void * argument);
         bool has_char(char letter);
+        void print_stats(StreamOutput *stream);
 
         int _putc(int c);
         int _getc(void);
         int puts(const char*);
+        int broadcast(const char*);
+        int send_ok();
+        int rx_free(bool lines) { return lines ? -1 : rx_size - 1 - rx_used(); }
+        int rx_capacity(bool lines) { return lines ? -1 : rx_size - 1; }
+        bool is_persistent() const { return true; }
+        int tx_room() { return tx_buffer != NULL ? tx_free() : -1; }
+
+        UartSerial* serial;
+
+    private:
+        int rx_used() const { int n = rx_head - rx_tail; return n < 0 ? n + rx_size : n; }
+        int tx_free() const { int n = tx_tail - tx_head - 1; return n < 0 ? n + tx_size : n; }
+        int queue_tx(const char *s, int n, bool wait);
+        void fill_tx();
+        void kick_tx();
+
+        // Receive buffer, size set in config and allocated in AHB SRAM if possible
+        // the interrupt is the only writer of rx_head and the main loop the only writer of rx_tail
+        char *rx_buffer;
+        int rx_size;
+        volatile int rx_head;
+        volatile int rx_tail;
+        std::atomic_int newlines;                // number of complete lines in buffer, counted as they are received
+
+        // Transmit buffer, drained into the uart fifo by its transmit interrupt
+        // the main loop is the only writer of tx_head and the interrupt the only writer of tx_tail
+        char *tx_buffer;
+        int tx_size;
+        volatile int tx_head;
+        volatile int tx_tail;
+        volatile char tx_flow;                   // XON or XOFF to go out ahead of the buffer, 0 if none
+
+        // XON/XOFF flow control, XOFF is sent above the high watermark and XON again once we drain below the low one
+        int rx_high_watermark;
+        int rx_low_watermark;
+
+        // receive error counters
+        volatile uint32_t overflow_count;        // chars dropped because the buffer was full
+        volatile uint32_t overrun_count;         // chars lost by the UART hardware fifo
+        volatile uint32_t framing_error_count;
 
-        //string receive_buffer;                 // Received chars are stored here until a newline character is received
-        //vector<std::string> received_lines;    // Received lines are stored here until they are requested
-        RingBuffer<char,256> buffer;             // Receive buffer
-        mbed::Serial* serial;
+        // not bitfields, these two are written by the interrupt and the main loop, a read-modify-write of a shared word
+        // from one could undo what the other wrote
+        bool xon_xoff;
+        volatile bool xoff_sent;
+        volatile bool tx_idle;                   // the uart has sent everything, nothing will interrupt until we give it more
 };
 
 #endif
@@ -0,0 +1,175 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BinaryGcode.h"
+
+#include "libs/Kernel.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "Gcode.h"
+#include "modules/communication/GcodeDispatch.h"
+
+#include <string.h>
+
+#define FRAME_SYNC  0xA5
+#define FRAME_CAN   0x18
+
+#define OP_G0       0x00
+#define OP_G1       0x01
+#define OP_TEXT     0x02
+#define OP_END      0x7F
+
+// the order of the values after a move's mask
+static const char move_letters[]= {'X', 'Y', 'Z', 'E', 'F', 'S'};
+
+const char BinaryGcode::job_magic[4]= {'S', 'G', 'B', '1'};
+
+BinaryGcode::BinaryGcode()
+{
+    reset();
+}
+
+void BinaryGcode::reset()
+{
+    state= SYNC;
+    expected_seq= 0;
+    seq= 0;
+}
+
+uint16_t BinaryGcode::crc_update(uint16_t crc, uint8_t c)
+{
+    crc ^= (uint16_t)c << 8;
+    for (int i = 0; i < 8; ++i) {
+        crc= (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+BinaryGcode::Result BinaryGcode::feed(uint8_t c)
+{
+    switch(state) {
+        case SYNC:
+            // anything else between frames is noise, and is dropped
+            if(c == FRAME_CAN) return CANCEL;
+            if(c == FRAME_SYNC) {
+                crc= 0xFFFF;
+                state= SEQ;
+            }
+            return NOTHING;
+
+        case SEQ:
+            seq= c;
+            crc= crc_update(crc, c);
+            state= LENGTH;
+            return NOTHING;
+
+        case LENGTH:
+            length= c;
+            count= 0;
+            crc= crc_update(crc, c);
+            state= (length == 0) ? CRC_LO : PAYLOAD;
+            return NOTHING;
+
+        case PAYLOAD:
+            payload[count++]= c;
+            crc= crc_update(crc, c);
+            if(count == length) state= CRC_LO;
+            return NOTHING;
+
+        case CRC_LO:
+            rx_crc= c;
+            state= CRC_HI;
+            return NOTHING;
+
+        case CRC_HI:
+            rx_crc |= (uint16_t)c << 8;
+            state= SYNC;
+            // a frame that was already executed may be resent when the host goes back after a nak, that is bad too
+            if(rx_crc != crc || seq != expected_seq) return BAD_FRAME;
+            expected_seq++;
+            return FRAME;
+    }
+    return NOTHING;
+}
+
+bool BinaryGcode::execute(StreamOutput *stream)
+{
+    const uint8_t *p= payload;
+    const uint8_t *end= payload + length;
+
+    while(p < end) {
+        // a record cut short or unknown means the host made a bad frame, the rest of it can't be trusted
+        int n= record_length(p, end);
+        if(n == 0) break;
+        if(!run_record(p, stream)) return false;
+        p += n;
+    }
+    return true;
+}
+
+int BinaryGcode::record_length(const uint8_t *p, const uint8_t *end)
+{
+    if(p >= end) return 0;
+    int n;
+    switch(*p) {
+        case OP_G0:
+        case OP_G1:
+            if(end - p < 2) return 0;
+            n= 2;
+            for (size_t i = 0; i < sizeof(move_letters); ++i) {
+                if(p[1] & (1 << i)) n += 4;
+            }
+            break;
+        case OP_TEXT:
+            if(end - p < 2) return 0;
+            n= 2 + p[1];
+            break;
+        case OP_END:
+            n= 1;
+            break;
+        default:
+            return 0;
+    }
+    return (end - p < n) ? 0 : n;
+}
+
+bool BinaryGcode::run_record(const uint8_t *p, StreamOutput *stream)
+{
+    uint8_t op= *p++;
+
+    if(op == OP_G0 || op == OP_G1) {
+        uint8_t mask= *p++;
+        char letters[sizeof(move_letters)];
+        float values[sizeof(move_letters)];
+        int n= 0;
+        for (size_t i = 0; i < sizeof(move_letters); ++i) {
+            if((mask & (1 << i)) == 0) continue;
+            memcpy(&values[n], p, 4); // the Cortex-M3 is little endian too
+            letters[n++]= move_letters[i];
+            p += 4;
+        }
+
+        if(THEKERNEL->gcode_dispatch->is_halted()) {
+            stream->printf("!!\r\n");
+            return true;
+        }
+
+        // already tokenized, so it goes straight to the modules routed for G0 or G1
+        Gcode gcode(op == OP_G0 ? 0 : 1, letters, values, n, stream);
+        THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode);
+
+    } else if(op == OP_TEXT) {
+        struct SerialMessage message;
+        message.message.assign((const char *)p + 1, *p);
+        message.stream= stream;
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+
+    } else if(op == OP_END) {
+        return false;
+    }
+    return true;
+}
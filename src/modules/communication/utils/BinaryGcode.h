@@ -0,0 +1,72 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BINARYGCODE_H
+#define BINARYGCODE_H
+
+#include <stdint.h>
+
+class StreamOutput;
+
+/*
+ * Framed binary gcode, for streaming short moves faster than lines of text can be sent and parsed.
+ * smoothie-binstream.py converts and streams gcode files in this format.
+ *
+ *   frame:   0xA5 seq len payload[len] crc_lo crc_hi
+ *            seq counts up from 0 and wraps, crc is CRC-16/CCITT (start 0xFFFF) over seq, len and the payload
+ *
+ *   payload: any number of records
+ *            0x00 mask f32...    G0, with a little endian float for each bit set in mask, in the order X Y Z E F S
+ *            0x01 mask f32...    G1, likewise
+ *            0x02 n char[n]      any other line, handled as if it had been sent as text
+ *            0x7F                back to text mode
+ *
+ * Every good frame is answered with "ack <seq>" once it has been executed, a bad or out of order one with
+ * "nak <seq>" giving the frame that is expected next, the host should then resend from that one.
+ * A 0x18 (CAN) between frames also goes back to text mode.
+ *
+ * A job file for the player (.gbin) is "SGB1" followed by the records, unframed, and ends with the file or a 0x7F.
+ * smoothie-binstream.py -j writes one.
+ */
+class BinaryGcode {
+    public:
+        enum Result { NOTHING, FRAME, BAD_FRAME, CANCEL };
+
+        BinaryGcode();
+
+        void reset();
+        Result feed(uint8_t c);
+        // run the records of the frame feed() just returned, false if it asked to go back to text mode
+        bool execute(StreamOutput *stream);
+
+        // bytes the record at p takes up, 0 if it is cut short by end or is not one
+        static int record_length(const uint8_t *p, const uint8_t *end);
+        // runs a whole record, false if it was the one that ends binary mode
+        static bool run_record(const uint8_t *p, StreamOutput *stream);
+        static const int max_record = 257;
+        static const char job_magic[4];
+
+        uint8_t get_seq() const { return seq; }
+        uint8_t get_expected_seq() const { return expected_seq; }
+
+        // CRC-16/CCITT, also used by the board_sync link
+        static uint16_t crc_update(uint16_t crc, uint8_t c);
+
+    private:
+        enum State { SYNC, SEQ, LENGTH, PAYLOAD, CRC_LO, CRC_HI };
+
+        uint8_t payload[255];
+        uint16_t crc;
+        uint16_t rx_crc;
+        uint8_t length;
+        uint8_t count;
+        uint8_t seq;
+        uint8_t expected_seq;
+        State state;
+};
+
+#endif
@@ -9,59 +9,142 @@
 #include "Gcode.h"
 #include "libs/StreamOutput.h"
 #include "utils.h"
+#include "SlabPool.h"
 #include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
 #include <algorithm>
 
+// The command strings are immutable and reference counted so copies of a Gcode (like those attached to blocks) share one string.
+// They come from the small object slabs so the churn of short lived commands does not fragment the main heap, if the slabs are
+// full we fall back to the heap
+struct CommandStorage {
+    uint16_t refs;
+    bool     pooled;
+    char     text[];
+};
+
+static inline CommandStorage *storage_of(char *command)
+{
+    return (CommandStorage *)(command - offsetof(CommandStorage, text));
+}
+
+static char *new_command(const char *str, size_t len)
+{
+    size_t n = sizeof(CommandStorage) + len + 1;
+    CommandStorage *cs = (CommandStorage *)slab_alloc(n);
+    if(cs != nullptr) {
+        cs->pooled = true;
+    } else {
+        cs = (CommandStorage *)malloc(n);
+        cs->pooled = false;
+    }
+    cs->refs = 1;
+    memcpy(cs->text, str, len);
+    cs->text[len] = '\0';
+    return cs->text;
+}
+
+// NOTE the count is not atomic, Gcodes must only be copied and destroyed in the main loop
+static char *ref_command(char *command)
+{
+    storage_of(command)->refs++;
+    return command;
+}
+
+static void release_command(char *command)
+{
+    if(command == nullptr) return;
+    CommandStorage *cs = storage_of(command);
+    if(--cs->refs == 0) {
+        if(cs->pooled) slab_free(cs);
+        else free(cs);
+    }
+}
+
 // This is a gcode object. It reprensents a GCode string/command, an caches some important values about that command for the sake of performance.
 // It gets passed around in events, and attached to the queue ( that'll change )
 Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
 {
-    this->command= strdup(command.c_str());
+    this->command= new_command(command.data(), command.size());
     this->m= 0;
     this->g= 0;
+    this->subcode= 0;
     this->add_nl= false;
     this->stream= stream;
     this->millimeters_of_travel = 0.0F;
     this->accepted_by_module = false;
+    this->consumed = false;
     prepare_cached_values(strip);
 }
 
-Gcode::~Gcode()
+Gcode::Gcode(unsigned int g, const char *letters, const float *values, int n, StreamOutput *stream)
 {
-    if(command != nullptr) {
-        // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
-        free(command);
+    this->command= new_command("", 0);
+    this->m= 0;
+    this->g= g;
+    this->subcode= 0;
+    this->has_g= true;
+    this->has_m= false;
+    this->add_nl= false;
+    this->stream= stream;
+    this->millimeters_of_travel = 0.0F;
+    this->accepted_by_module = false;
+    this->consumed = false;
+
+    this->letters= 0;
+    this->num_words= 0;
+    this->words_full= false;
+    for (int i = 0; i < n && i < max_words; ++i) {
+        this->letters |= 1 << (letters[i] - 'A');
+        this->word_letter[i]= letters[i];
+        this->word_value[i]= values[i];
+        this->num_words++;
     }
 }
 
+Gcode::~Gcode()
+{
+    release_command(command);
+}
+
 Gcode::Gcode(const Gcode &to_copy)
 {
-    this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    this->command               = ref_command(to_copy.command);
     this->millimeters_of_travel = to_copy.millimeters_of_travel;
     this->has_m                 = to_copy.has_m;
     this->has_g                 = to_copy.has_g;
     this->m                     = to_copy.m;
     this->g                     = to_copy.g;
+    this->subcode               = to_copy.subcode;
     this->add_nl                = to_copy.add_nl;
     this->stream                = to_copy.stream;
     this->accepted_by_module    = false;
+    this->consumed              = false;
     this->txt_after_ok.assign( to_copy.txt_after_ok );
+    this->copy_words(to_copy);
 }
 
 Gcode &Gcode::operator= (const Gcode &to_copy)
 {
     if( this != &to_copy ) {
-        this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+        char *old                   = this->command;
+        this->command               = ref_command(to_copy.command);
+        release_command(old);
         this->millimeters_of_travel = to_copy.millimeters_of_travel;
         this->has_m                 = to_copy.has_m;
         this->has_g                 = to_copy.has_g;
         this->m                     = to_copy.m;
         this->g                     = to_copy.g;
+        this->subcode               = to_copy.subcode;
         this->add_nl                = to_copy.add_nl;
         this->stream                = to_copy.stream;
         this->txt_after_ok.assign( to_copy.txt_after_ok );
+        this->copy_words(to_copy);
     }
     this->accepted_by_module = false;
+    this->consumed = false;
     return *this;
 }
 
@@ -69,16 +152,64 @@ Gcode &Gcode::operator= (const Gcode &to_copy)
 // Whether or not a Gcode has a letter
 bool Gcode::has_letter( char letter ) const
 {
-    for (size_t i = 0; i < strlen(this->command); ++i) {
-        if( command[i] == letter ) {
+    if( letter >= 'A' && letter <= 'Z' ) {
+        return (this->letters & (1 << (letter - 'A'))) != 0;
+    }
+
+    for (const char *cs = command; *cs; ++cs) {
+        if( *cs == letter ) {
             return true;
         }
     }
     return false;
 }
 
+// index in the word table for the letter, or -1 if it does not have a value there
+int Gcode::find_word( char letter ) const
+{
+    for (int i = 0; i < num_words; ++i) {
+        if( word_letter[i] == letter ) return i;
+    }
+    return -1;
+}
+
 // Retrieve the value for a given letter
+// ptr returns where the value ended in the command, asking for that means we have to scan the string
 float Gcode::get_value( char letter, char **ptr ) const
+{
+    if( ptr == nullptr && letter >= 'A' && letter <= 'Z' ) {
+        if( !has_letter(letter) ) return 0;
+        int i = find_word(letter);
+        if( i >= 0 ) return word_value[i];
+        if( !words_full ) return 0;
+    }
+    return scan_value(letter, ptr);
+}
+
+int Gcode::get_int( char letter, char **ptr ) const
+{
+    if( ptr == nullptr && letter >= 'A' && letter <= 'Z' ) {
+        if( !has_letter(letter) ) return 0;
+        int i = find_word(letter);
+        // only use the float if it is exact, otherwise parse it as strtol would
+        if( i >= 0 && fabsf(word_value[i]) < 16777216.0F ) return (int)word_value[i];
+        if( i < 0 && !words_full ) return 0;
+    }
+    return scan_int(letter, ptr);
+}
+
+uint32_t Gcode::get_uint( char letter, char **ptr ) const
+{
+    if( ptr == nullptr && letter >= 'A' && letter <= 'Z' ) {
+        if( !has_letter(letter) ) return 0;
+        int i = find_word(letter);
+        if( i >= 0 && word_value[i] >= 0.0F && word_value[i] < 16777216.0F ) return (uint32_t)word_value[i];
+        if( i < 0 && !words_full ) return 0;
+    }
+    return scan_uint(letter, ptr);
+}
+
+float Gcode::scan_value( char letter, char **ptr ) const
 {
     const char *cs = command;
     char *cn = NULL;
@@ -95,7 +226,7 @@ float Gcode::get_value( char letter, char **ptr ) const
     return 0;
 }
 
-int Gcode::get_int( char letter, char **ptr ) const
+int Gcode::scan_int( char letter, char **ptr ) const
 {
     const char *cs = command;
     char *cn = NULL;
@@ -112,7 +243,7 @@ int Gcode::get_int( char letter, char **ptr ) const
     return 0;
 }
 
-uint32_t Gcode::get_uint( char letter, char **ptr ) const
+uint32_t Gcode::scan_uint( char letter, char **ptr ) const
 {
     const char *cs = command;
     char *cn = NULL;
@@ -129,6 +260,46 @@ uint32_t Gcode::get_uint( char letter, char **ptr ) const
     return 0;
 }
 
+// Parse the command once, recording which letters are in it and the value following the first occurrence of each that has one.
+// This follows exactly what scanning the string in get_value() would find, letters inside values (like 1E5) included
+void Gcode::tokenize()
+{
+    this->letters = 0;
+    this->num_words = 0;
+    this->words_full = false;
+
+    for (const char *cs = command; *cs; cs++) {
+        char c = *cs;
+        if( c < 'A' || c > 'Z' ) continue;
+
+        uint32_t bit = 1 << (c - 'A');
+        bool seen = (this->letters & bit) != 0;
+        this->letters |= bit;
+        if( seen && find_word(c) >= 0 ) continue; // only the first value counts
+
+        char *cn;
+        float v = strtof(cs + 1, &cn);
+        if( cn > cs + 1 ) {
+            if( this->num_words < max_words ) {
+                this->word_letter[this->num_words] = c;
+                this->word_value[this->num_words] = v;
+                this->num_words++;
+            } else {
+                this->words_full = true;
+            }
+        }
+    }
+}
+
+void Gcode::copy_words(const Gcode &to_copy)
+{
+    this->letters   = to_copy.letters;
+    this->num_words = to_copy.num_words;
+    this->words_full= to_copy.words_full;
+    memcpy(this->word_letter, to_copy.word_letter, sizeof(this->word_letter));
+    memcpy(this->word_value, to_copy.word_value, sizeof(this->word_value));
+}
+
 int Gcode::get_num_args() const
 {
     int count = 0;
@@ -144,15 +315,20 @@ int Gcode::get_num_args() const
 void Gcode::prepare_cached_values(bool strip)
 {
     char *p= nullptr;
+    tokenize();
     if( this->has_letter('G') ) {
         this->has_g = true;
-        this->g = this->get_int('G', &p);
+        this->g = this->scan_int('G', &p);
+        if(p != nullptr && *p == '.' && p[1] >= '0' && p[1] <= '9') {
+            this->subcode = p[1] - '0';
+            p += 2;
+        }
     } else {
         this->has_g = false;
     }
     if( this->has_letter('M') ) {
         this->has_m = true;
-        this->m = this->get_int('M', &p);
+        this->m = this->scan_int('M', &p);
     } else {
         this->has_m = false;
     }
@@ -161,9 +337,10 @@ void Gcode::prepare_cached_values(bool strip)
 
     // remove the Gxxx or Mxxx from string
     if (p != nullptr) {
-        char *n= strdup(p); // create new string starting at end of the numeric value
-        free(command);
+        char *n= new_command(p, strlen(p)); // create new string starting at end of the numeric value
+        release_command(command);
         command= n;
+        tokenize();
     }
 }
 
@@ -198,9 +375,10 @@ void Gcode::strip_parameters()
         // strip whitespace to save even more, this causes problems so don't do it
         //newcmd.erase(std::remove_if(newcmd.begin(), newcmd.end(), ::isspace), newcmd.end());
 
-        // release the old one
-        free(command);
+        // release the old one, other copies may still be using it
+        release_command(command);
         // copy the new shortened one
-        command= strdup(newcmd.c_str());
+        command= new_command(newcmd.data(), newcmd.size());
+        tokenize();
     }
 }
@@ -9,6 +9,7 @@
 #ifndef GCODE_H
 #define GCODE_H
 #include <string>
+#include <stdint.h>
 using std::string;
 
 class StreamOutput;
@@ -17,22 +18,29 @@ class StreamOutput;
 class Gcode {
     public:
         Gcode(const string&, StreamOutput*, bool strip=true);
+        // a Gn that is already tokenized into letters and values, with no command text
+        Gcode(unsigned int g, const char *letters, const float *values, int n, StreamOutput*);
         Gcode(const Gcode& to_copy);
         Gcode& operator= (const Gcode& to_copy);
         ~Gcode();
 
         const char* get_command() const { return command; }
         bool has_letter ( char letter ) const;
+        // bit n is set if the letter 'A' + n is in the command
+        uint32_t get_letters() const { return letters; }
         float get_value ( char letter, char **ptr= nullptr ) const;
         int get_int ( char letter, char **ptr= nullptr ) const;
         uint32_t get_uint ( char letter, char **ptr= nullptr ) const;
         int get_num_args() const;
         void mark_as_taken();
+        // taken, and no other module needs to see it so ON_GCODE_RECEIVED dispatch stops here
+        void mark_as_consumed() { accepted_by_module= true; consumed= true; }
         void strip_parameters();
 
         // FIXME these should be private
         unsigned int m;
         unsigned int g;
+        uint8_t subcode;               // the 1 of G5.1, 0 if there is none
         float millimeters_of_travel;
 
         struct {
@@ -40,6 +48,7 @@ class Gcode {
             bool has_m:1;
             bool has_g:1;
             bool accepted_by_module:1;
+            bool consumed:1;
         };
 
         StreamOutput* stream;
@@ -47,6 +56,20 @@ class Gcode {
 
     private:
         void prepare_cached_values(bool strip=true);
+        void tokenize();
+        void copy_words(const Gcode &to_copy);
+        int find_word(char letter) const;
+        float scan_value(char letter, char **ptr) const;
+        int scan_int(char letter, char **ptr) const;
+        uint32_t scan_uint(char letter, char **ptr) const;
         char *command;
+
+        // the command is parsed once into this table of letters and their values so lookups don't rescan the string
+        static const int max_words= 8;
+        uint32_t letters;              // bit set for each of A-Z that appears anywhere in the command
+        char word_letter[max_words];
+        float word_value[max_words];
+        uint8_t num_words;
+        bool words_full;               // there were more values than fit in the table, so we may need to rescan
 };
 #endif
@@ -18,46 +18,131 @@
 #include "Stepper.h"
 
 #include "mri.h"
+#include "SlabPool.h"
 
 using std::string;
-#include <vector>
+#include <new>
 
 // A block represents a movement, it's length for each stepper motor, and the corresponding acceleration curves.
 // It's stacked on a queue, and that queue is then executed in order, to move the motors.
 // Most of the accel math is also done in this class
 // And GCode objects for use in on_gcode_execute are also help in here
 
+struct BlockGcode {
+    // the gcode is constructed in place when the node is used, and destroyed when it is returned to the free list
+    Gcode& gcode() { return *reinterpret_cast<Gcode *>(storage); }
+    BlockGcode *next;
+    BlockAction action; // set if this node is an action rather than a gcode
+    union {
+        uint32_t storage[(sizeof(Gcode) + 3) / 4];
+        struct {
+            void *arg;
+            float value;
+        } call;
+    };
+};
+
+// the nodes reserved for the queue, and the ones that had to be added when it ran out and are not attached to any block
+static SlabPool *gcode_slab = nullptr;
+static BlockGcode *free_gcodes = nullptr;
+
+static BlockGcode *new_gcode_node()
+{
+    void *v = gcode_slab != nullptr ? gcode_slab->alloc() : nullptr;
+    if (v != nullptr) return static_cast<BlockGcode *>(v);
+
+    BlockGcode *n = free_gcodes;
+    if (n != nullptr) {
+        free_gcodes = n->next;
+        return n;
+    }
+
+    // grow the spares, these never get freed, they just go back on the free list
+    return static_cast<BlockGcode *>(malloc(sizeof(BlockGcode)));
+}
+
+static void release_gcode_node(BlockGcode *n)
+{
+    if (gcode_slab != nullptr && gcode_slab->has(n)) {
+        gcode_slab->dealloc(n);
+    } else {
+        n->next = free_gcodes;
+        free_gcodes = n;
+    }
+}
+
+// Make sure there are at least n gcode nodes, called when the queue is allocated
+void Block::reserve_gcodes(unsigned int n)
+{
+    if (gcode_slab == nullptr) gcode_slab = new SlabPool("block gcodes", sizeof(BlockGcode), n);
+}
+
 Block::Block()
+{
+    gcodes = last_gcode = nullptr;
+    clear();
+}
+
+Block::~Block()
 {
     clear();
 }
 
 void Block::clear()
 {
-    //commands.clear();
-    //travel_distances.clear();
-    gcodes.clear();
-    std::vector<Gcode>().swap(gcodes); // this resizes the vector releasing its memory
+    // return the attached gcodes to the free list, this must not be called from an ISR as the Gcodes free their command
+    while (gcodes != nullptr) {
+        BlockGcode *n = gcodes;
+        gcodes = n->next;
+        if (n->action == nullptr) n->gcode().~Gcode();
+        release_gcode_node(n);
+    }
+    last_gcode = nullptr;
+    begun = false;
+    locked = false;
+    deferred_done = false;
 
     clear_vector(this->steps);
+    clear_vector(this->backlash_steps);
 
     steps_event_count   = 0;
+    main_actuator       = 0;
+#ifdef FIXED_POINT_STEPPING
+    clear_vector(this->rate_ratio);
+#else
+    clear_vector_float(this->step_ratio);
+#endif
     nominal_rate        = 0;
     nominal_speed       = 0.0F;
+    programmed_speed    = 0.0F;
+    max_speed           = 0.0F;
+    junction_speed      = 0.0F;
     millimeters         = 0.0F;
     entry_speed         = 0.0F;
     exit_speed          = 0.0F;
     rate_delta          = 0.0F;
+#ifdef FIXED_POINT_STEPPING
+    fixed_rate_delta    = 0;
+#endif
     acceleration        = 100.0F; // we don't want to get devide by zeroes if this is not set
     initial_rate        = -1;
     final_rate          = -1;
     accelerate_until    = 0;
     decelerate_after    = 0;
+    peak_rate           = 0.0F;
+    accelerate_ticks    = 0;
+    decelerate_ticks    = 0;
+    seconds             = 0.0F;
+    source_tag          = 0;
+    lookahead_us        = 0;
     direction_bits      = 0;
     recalculate_flag    = false;
     nominal_length_flag = false;
     max_entry_speed     = 0.0F;
+    spindle_pitch       = 0.0F;
     is_ready            = false;
+    s_curve             = false;
+    travel              = false;
     times_taken         = 0;
 }
 
@@ -98,8 +183,8 @@ void Block::debug()
 */
 void Block::calculate_trapezoid( float entryspeed, float exitspeed )
 {
-    // if block is currently executing, don't touch anything!
-    if (times_taken)
+    // if block is currently executing, or a board_sync slave has it already, don't touch anything!
+    if (times_taken || locked)
         return;
 
     // The planner passes us factors, we need to transform them in rates
@@ -126,6 +211,21 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     this->accelerate_until = accelerate_steps;
     this->decelerate_after = accelerate_steps + plateau_steps;
 
+    this->peak_rate = plateau_steps > 0 ? this->nominal_rate : min((float)this->nominal_rate, sqrtf((float)this->initial_rate * this->initial_rate + 2.0F * acceleration_per_second * accelerate_steps));
+
+    if (this->s_curve) {
+        // the S-curve covers each ramp in the same time as the linear one would, so work out how long that is
+        this->accelerate_ticks = this->peak_rate > this->initial_rate ? ceilf((this->peak_rate - this->initial_rate) / this->rate_delta) : 0;
+        this->decelerate_ticks = this->peak_rate > this->final_rate ? ceilf((this->peak_rate - this->final_rate) / this->rate_delta) : 0;
+    }
+
+    // each ramp runs at the average of its end rates
+    this->seconds = 0.0F;
+    if (accelerate_steps > 0) this->seconds += accelerate_steps * 2.0F / (this->initial_rate + this->peak_rate);
+    if (plateau_steps > 0) this->seconds += (float)plateau_steps / this->nominal_rate;
+    unsigned int decel = this->steps_event_count - this->decelerate_after;
+    if (decel > 0 && this->peak_rate + this->final_rate > 0) this->seconds += decel * 2.0F / (this->peak_rate + this->final_rate);
+
     this->exit_speed = exitspeed;
 }
 
@@ -222,7 +322,7 @@ float Block::max_exit_speed()
 {
     // if block is currently executing, return cached exit speed from calculate_trapezoid
     // this ensures that a block following a currently executing block will have correct entry speed
-    if (times_taken)
+    if (times_taken || locked)
         return exit_speed;
 
     // if nominal_length_flag is asserted
@@ -237,12 +337,51 @@ float Block::max_exit_speed()
     return min(max, nominal_speed);
 }
 
+// worked out when the block is planned so a block starting in the interrupt only has to load them
+void Block::calculate_step_ratios(unsigned int n_actuators)
+{
+    steps_event_count = 0;
+    for (unsigned int i = 0; i < n_actuators; i++) {
+        if (steps[i] > steps_event_count) {
+            steps_event_count = steps[i];
+            main_actuator = i;
+        }
+    }
+    for (unsigned int i = 0; i < n_actuators && steps_event_count > 0; i++) {
+#ifdef FIXED_POINT_STEPPING
+        rate_ratio[i] = ((uint64_t)steps[i] << Stepper::rate_ratio_bits) / steps_event_count;
+#else
+        step_ratio[i] = (float)steps[i] / steps_event_count;
+#endif
+    }
+}
+
 // Gcodes are attached to their respective blocks so that on_gcode_execute can be called with it
 void Block::append_gcode(Gcode* gcode)
 {
-    Gcode new_gcode = *gcode;
-    new_gcode.strip_parameters(); // optimization to save memory we strip off the XYZIJK parameters from the saved command
-    gcodes.push_back(new_gcode);
+    BlockGcode *n = new_gcode_node();
+    new (n->storage) Gcode(*gcode);
+    n->gcode().strip_parameters(); // optimization to save memory we strip off the XYZIJK parameters from the saved command
+    n->action = nullptr;
+    n->next = nullptr;
+
+    if (last_gcode != nullptr) last_gcode->next = n;
+    else gcodes = n;
+    last_gcode = n;
+}
+
+// Actions run in order with the gcodes, so one attached after a gcode sees what the gcode did
+void Block::append_action(BlockAction action, void *arg, float value)
+{
+    BlockGcode *n = new_gcode_node();
+    n->action = action;
+    n->call.arg = arg;
+    n->call.value = value;
+    n->next = nullptr;
+
+    if (last_gcode != nullptr) last_gcode->next = n;
+    else gcodes = n;
+    last_gcode = n;
 }
 
 void Block::begin()
@@ -253,10 +392,13 @@ void Block::begin()
         __debugbreak();
 
     times_taken = -1;
+    begun = true;
 
-    // execute all the gcodes related to this block
-    for(unsigned int index = 0; index < gcodes.size(); index++)
-        THEKERNEL->call_event(ON_GCODE_EXECUTE, &(gcodes[index]));
+    // execute all the gcodes related to this block, the modules that deferred theirs get them later from the main loop
+    for(BlockGcode *n = gcodes; n != nullptr; n = n->next) {
+        if (n->action != nullptr) n->action(n->call.arg, n->call.value);
+        else THEKERNEL->call_event(ON_GCODE_EXECUTE, &n->gcode());
+    }
 
 
     THEKERNEL->call_event(ON_BLOCK_BEGIN, this);
@@ -265,6 +407,14 @@ void Block::begin()
         release();
 }
 
+void Block::execute_deferred()
+{
+    deferred_done = true;
+    for(BlockGcode *n = gcodes; n != nullptr; n = n->next) {
+        if (n->action == nullptr) THEKERNEL->call_deferred_execute(&n->gcode());
+    }
+}
+
 // Signal the conveyor that this block is ready to be injected into the system
 void Block::ready()
 {
@@ -8,14 +8,24 @@
 #ifndef BLOCK_H
 #define BLOCK_H
 
-#include <vector>
 #include <bitset>
+#include <stdint.h>
+
+#include "libs/nuts_bolts.h"
 
 class Gcode;
 
+// A gcode attached to a block, these are kept on a free list and recycled so attaching gcodes to blocks makes no heap calls
+struct BlockGcode;
+
+// A call attached to a block instead of a gcode, for a setting or output that must change when the block starts,
+// it is run from the same context as on_gcode_execute so it must be quick
+typedef void (*BlockAction)(void *arg, float value);
+
 class Block {
     public:
         Block();
+        ~Block();
         void calculate_trapezoid( float entry_speed, float exit_speed );
         float estimate_acceleration_distance( float initial_rate, float target_rate, float acceleration );
         float intersection_distance(float initial_rate, float final_rate, float acceleration, float distance);
@@ -25,45 +35,92 @@ class Block {
         float forward_pass(float next_entry_speed);
 
         float max_exit_speed();
+        // steps_event_count, main_actuator and each actuator's share of the rate, from steps
+        void calculate_step_ratios(unsigned int n_actuators);
+
+        // rate after tick of ticks acceleration ticks along an S-curve from one rate to another. The cubic smoothstep has
+        // the same average as a linear ramp of the same duration so the trapezoid distances still hold, its peak
+        // acceleration is 1.5 times the average and the jerk is bounded
+        static float s_curve_rate(float from, float to, unsigned int tick, unsigned int ticks) {
+            if (tick >= ticks) return to;
+            float t = (float)tick / ticks;
+            return from + (to - from) * t * t * (3.0F - 2.0F * t);
+        }
 
         void debug();
 
         void append_gcode(Gcode* gcode);
+        void append_action(BlockAction action, void *arg, float value);
 
         void take();
         void release();
+        // ends the block however many modules have it taken, for a halt
+        void release_all() { times_taken = 1; release(); }
 
         void ready();
 
         void clear();
 
         void begin();
+        // from the main loop once the block has begun, the gcodes for the modules that registered for deferred execute
+        void execute_deferred();
+
+        bool has_gcodes() const { return gcodes != nullptr; }
+        static void reserve_gcodes(unsigned int n);
 
-        std::vector<Gcode> gcodes;
+        BlockGcode    *gcodes;             // intrusive list of gcodes and actions to execute when this block starts
+        BlockGcode    *last_gcode;         // so appending keeps the order without walking the list
 
-        unsigned int   steps[3];           // Number of steps for each axis for this block
+        unsigned int   steps[MAX_ROBOT_ACTUATORS]; // Number of steps for each actuator for this block
+        uint16_t       backlash_steps[MAX_ROBOT_ACTUATORS]; // Of those, the ones that take up backlash and don't move the axis
         unsigned int   steps_event_count;  // Steps for the longest axis
+        // worked out by the planner so a block starting in the interrupt only has to load them
+        uint8_t        main_actuator;      // the first actuator with steps_event_count steps, the one the Stepper follows
+#ifdef FIXED_POINT_STEPPING
+        uint32_t       rate_ratio[MAX_ROBOT_ACTUATORS]; // steps / steps_event_count, with Stepper::rate_ratio_bits of fraction
+#else
+        float          step_ratio[MAX_ROBOT_ACTUATORS]; // steps / steps_event_count, each actuator's share of the rate
+#endif
         unsigned int   nominal_rate;       // Nominal rate in steps per second
         float          nominal_speed;      // Nominal speed in mm per second
+        float          programmed_speed;   // Speed the gcode asked for, nominal_speed is this scaled by the speed override
+        float          max_speed;          // Fastest the axis and actuator limits allow for this move, 0 if there is no limit
+        float          junction_speed;     // Entry speed limit from the junction with the previous block alone, without the nominal speeds
         float          millimeters;        // Distance for this move
         float          entry_speed;
         float          exit_speed;
         float          rate_delta;         // Nomber of steps to add to the speed for each acceleration tick
+#ifdef FIXED_POINT_STEPPING
+        uint32_t       fixed_rate_delta;   // rate_delta as a StepperMotor fixed point rate
+#endif
         float          acceleration;       // the acceleratoin for this block
         unsigned int   initial_rate;       // Initial speed in steps per second
         unsigned int   final_rate;         // Final speed in steps per second
         unsigned int   accelerate_until;   // Stop accelerating after this number of steps
         unsigned int   decelerate_after;   // Start decelerating after this number of steps
+        float          peak_rate;          // Rate reached at accelerate_until, nominal_rate unless the block is too short
+        unsigned int   accelerate_ticks;   // Acceleration ticks the S-curve takes to reach peak_rate
+        unsigned int   decelerate_ticks;   // Acceleration ticks the S-curve takes from peak_rate down to final_rate
+        float          seconds;            // How long the trapezoid takes to run, the S-curve takes the same time
+        uint32_t       source_tag;         // What the producer set with Conveyor::set_source_tag when the block was queued
+        uint32_t       lookahead_us;       // What the block added to the conveyor's queued time, taken off again when it is cleaned
 
         float max_entry_speed;
+        float spindle_pitch;  // mm per spindle revolution for a spindle synchronized move (G33), 0 for any other
+
+        volatile bool  begun;              // set by begin(), which runs in an interrupt, so not one of the flags below
+        volatile bool  locked;             // sent to a board_sync slave, from then on it is planned as if it had begun
+        bool           deferred_done;      // execute_deferred() has run, only touched by the main loop
 
         short times_taken;    // A block can be "taken" by any number of modules, and the next block is not moved to until all the modules have "released" it. This value serves as a tracker.
 
-        std::bitset<3> direction_bits;     // Direction for each axis in bit form, relative to the direction port's mask
+        std::bitset<MAX_ROBOT_ACTUATORS> direction_bits; // Direction for each actuator in bit form, relative to the direction port's mask
         struct {
             bool recalculate_flag:1;             // Planner flag to recalculate trapezoids on entry junction
             bool nominal_length_flag:1;          // Planner flag for nominal speed always reached
             bool is_ready:1;
+            bool s_curve:1;                      // accelerate along an S-curve instead of a linear ramp
+            bool travel:1;                       // from a G0, planned with the travel acceleration and junction deviation
         };
 };
 
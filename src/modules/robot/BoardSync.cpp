@@ -0,0 +1,495 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ahead of the headers that bring in sLPC17xx.h, which has no __get_PRIMASK for gcc
+#include "LPC17xx.h"
+
+#include "BoardSync.h"
+
+#include "libs/Kernel.h"
+#include "libs/PinEvents.h"
+#include "libs/StreamOutputPool.h"
+#include "libs/StreamOutput.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "Gcode.h"
+#include "Block.h"
+#include "Conveyor.h"
+#include "Robot.h"
+#include "Stepper.h"
+#include "StepperMotor.h"
+#include "modules/communication/SerialConsole.h"
+#include "modules/communication/utils/BinaryGcode.h"
+#include "port_api.h"
+#include "us_ticker_api.h"
+
+#include <string.h>
+#include <string>
+using std::string;
+
+#define board_sync_role_checksum       CHECKSUM("board_sync_role")
+#define board_sync_tx_pin_checksum     CHECKSUM("board_sync_tx_pin")
+#define board_sync_rx_pin_checksum     CHECKSUM("board_sync_rx_pin")
+#define board_sync_baud_rate_checksum  CHECKSUM("board_sync_baud_rate")
+#define board_sync_pin_checksum        CHECKSUM("board_sync_pin")
+
+#define FRAME_SYNC  0xA5
+
+#define LSR_RDR     0x01
+#define LSR_ERRORS  0x8E    // overrun, parity, framing and fifo errors
+#define LSR_THRE    0x20
+#define LSR_TEMT    0x40
+
+BoardSync::BoardSync()
+{
+    serial = nullptr;
+    tx_head = tx_tail = 0;
+    sending = nullptr;
+    sending_seq = tx_seq = 0;
+    rx_state = SYNC;
+    rx_seq = 0;
+    rx_blocks_head = rx_blocks_tail = 0;
+    blocks = late_sends = uart_waits = max_wait_us = late_starts = bad_frames = dropped = 0;
+    slave = false;
+    enabled = false;
+    tx_idle = true;
+    sync_state = false;
+    do_halt = do_clear = lost = false;
+    halt_from_link = false;
+}
+
+void BoardSync::on_module_loaded()
+{
+    slave = THEKERNEL->config->value(board_sync_role_checksum)->by_default("master")->as_string() == "slave";
+
+    sync_pin.from_string(THEKERNEL->config->value(board_sync_pin_checksum)->by_default("nc")->as_string());
+    if (!sync_pin.connected()) {
+        THEKERNEL->streams->printf("board_sync_pin is not set, board sync is off\r\n");
+        return;
+    }
+
+    // no default, any pair of UART pins is already something else on one board or another
+    Pin tx, rx;
+    tx.from_string(THEKERNEL->config->value(board_sync_tx_pin_checksum)->by_default("nc")->as_string());
+    rx.from_string(THEKERNEL->config->value(board_sync_rx_pin_checksum)->by_default("nc")->as_string());
+    if (!tx.connected() || !rx.connected()) {
+        THEKERNEL->streams->printf("board_sync_tx_pin and board_sync_rx_pin have to be set, board sync is off\r\n");
+        return;
+    }
+    serial = new UartSerial(port_pin((PortName)tx.port_number, tx.pin), port_pin((PortName)rx.port_number, rx.pin));
+    serial->baud(THEKERNEL->config->value(board_sync_baud_rate_checksum)->by_default(1000000)->as_number());
+
+    if (slave) {
+        // every edge begins a block, straight from the GPIO interrupt
+        sync_pin.as_input();
+        if (!PinEvents::instance()->attach(&sync_pin, 0, this, &BoardSync::on_sync_edge)) {
+            THEKERNEL->streams->printf("board_sync_pin has to be on port 0 or 2 on a slave, board sync is off\r\n");
+            return;
+        }
+        THEKERNEL->conveyor->set_external_start(true);
+    } else {
+        sync_pin.as_output();
+        sync_pin.set(false);
+        THEKERNEL->conveyor->attach_begin_hook<BoardSync, &BoardSync::on_block_begin_hook>(this);
+        THEKERNEL->stepper->attach_hold_hook<BoardSync, &BoardSync::on_hold>(this);
+    }
+
+    serial->attach(this, &BoardSync::on_serial_char_received, mbed::Serial::RxIrq);
+    serial->attach(this, &BoardSync::on_serial_tx_empty, mbed::Serial::TxIrq);
+    enabled = true;
+
+    register_for_event(ON_IDLE);
+    register_for_event(ON_HALT);
+    register_for_gcodes('M', {417});
+}
+
+// the master sends the block after the running one while it runs, the slave queues what it has been sent
+void BoardSync::on_idle(void *argument)
+{
+    if (!enabled) return;
+
+    if (do_halt) {
+        do_halt = false;
+        halt_from_link = true;
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        THEKERNEL->streams->printf("Halted by the other board sync board - reset or M999 to continue\r\n");
+    }
+    if (do_clear) {
+        do_clear = false;
+        halt_from_link = true;
+        THEKERNEL->call_event(ON_HALT, (void *)1);
+    }
+    if (lost) {
+        lost = false;
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        THEKERNEL->streams->printf("Board sync lost a block, both boards are halted - reset or M999 to continue\r\n");
+    }
+
+    if (!slave) {
+        send_next_block();
+        return;
+    }
+
+    Conveyor *conveyor = THEKERNEL->conveyor;
+    while (rx_blocks_tail != rx_blocks_head && !conveyor->queue.is_full()) {
+        queue_block(rx_blocks[rx_blocks_tail]);
+        rx_blocks_tail = (rx_blocks_tail + 1) % rx_blocks_size;
+    }
+    // an edge came before the block it begins was queued
+    if (conveyor->is_start_pending()) conveyor->start_next_block();
+}
+
+// a halt empties the queues of both boards, they count the blocks from 0 again
+void BoardSync::on_halt(void *argument)
+{
+    if (!enabled) return;
+    if (!halt_from_link) send_control(argument == nullptr ? 'H' : 'C');
+    halt_from_link = false;
+
+    __disable_irq();
+    tx_seq = 0;
+    rx_seq = 0;
+    sending = nullptr;
+    rx_blocks_tail = rx_blocks_head;
+    __enable_irq();
+}
+
+// M417 reports how the link is doing, M417 R clears the counts afterwards
+void BoardSync::on_gcode_received(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    if (!gcode->has_m || gcode->m != 417) return;
+
+    if (!enabled) {
+        gcode->stream->printf("board sync is off\r\n");
+        return;
+    }
+    if (slave) {
+        gcode->stream->printf("Board sync slave: %lu blocks received, %lu late starts, %lu bad frames\r\n",
+                              blocks, late_starts, bad_frames);
+    } else {
+        gcode->stream->printf("Board sync master: %lu blocks sent, %lu sent as they began, %lu waited for the uart, longest %luus, %lu bad frames, %lu frames dropped\r\n",
+                              blocks, late_sends, uart_waits, max_wait_us, bad_frames, dropped);
+    }
+    if (gcode->has_letter('R')) {
+        blocks = late_sends = uart_waits = max_wait_us = late_starts = bad_frames = dropped = 0;
+    }
+}
+
+// Runs in the interrupt the block begins in, before it does. The slave has to have all of the block by the edge
+void BoardSync::on_block_begin_hook(Block *block)
+{
+    if (!block->locked || sending == block) {
+        // the main loop had not got to it yet, or was part way through, so it goes now with the number it was to have
+        uint8_t seq = sending == block ? sending_seq : tx_seq++;
+        sending = nullptr;
+        block->locked = true;
+        SyncBlock s;
+        encode(block, seq, s);
+        if (!put_frame(isr_stage, build_frame(isr_stage, 'B', &s, sizeof(s)))) dropped++;
+        late_sends++;
+        blocks++;
+    }
+
+    if (tx_head != tx_tail || !(serial->line_status() & LSR_TEMT)) {
+        uint32_t start = us_ticker_read();
+        drain_tx();
+        uint32_t waited = us_ticker_read() - start;
+        uart_waits++;
+        if (waited > max_wait_us) max_wait_us = waited;
+    }
+
+    sync_state = !sync_state;
+    sync_pin.set(sync_state);
+}
+
+// The block after the running one is sent while the running one runs, and from then on is planned as if it had begun.
+// It is built with interrupts on, if it begins meanwhile the interrupt sends it and this copy is dropped
+void BoardSync::send_next_block()
+{
+    Conveyor::Queue_t &queue = THEKERNEL->conveyor->queue;
+
+    __disable_irq();
+    const unsigned int head_i = queue.get_head_i();
+    unsigned int i = queue.get_isr_tail_i();
+    Block *next = nullptr;
+    if (i != head_i && queue.item_ref(i)->begun) {
+        i = queue.next(i);
+        if (i != head_i && !queue.item_ref(i)->locked) next = queue.item_ref(i);
+    }
+    if (next != nullptr) {
+        next->locked = true;
+        sending = next;
+        sending_seq = tx_seq++;
+    }
+    __enable_irq();
+    if (next == nullptr) return;
+
+    SyncBlock s;
+    encode(next, sending_seq, s);
+    int n = build_frame(stage, 'B', &s, sizeof(s));
+
+    __disable_irq();
+    bool mine = sending == next;
+    sending = nullptr;
+    __enable_irq();
+    if (!mine) return;
+
+    if (put_frame(stage, n)) blocks++;
+    else dropped++;
+}
+
+void BoardSync::encode(const Block *block, uint8_t seq, SyncBlock &s)
+{
+    for (int i = 0; i < MAX_ROBOT_ACTUATORS; i++) {
+        s.steps[i] = block->steps[i];
+        s.backlash_steps[i] = block->backlash_steps[i];
+    }
+    s.nominal_rate = block->nominal_rate;
+    s.initial_rate = block->initial_rate;
+    s.final_rate = block->final_rate;
+    s.accelerate_until = block->accelerate_until;
+    s.decelerate_after = block->decelerate_after;
+    s.accelerate_ticks = block->accelerate_ticks;
+    s.decelerate_ticks = block->decelerate_ticks;
+    s.rate_delta = block->rate_delta;
+    s.peak_rate = block->peak_rate;
+    s.seconds = block->seconds;
+    s.millimeters = block->millimeters;
+    s.nominal_speed = block->nominal_speed;
+    s.entry_speed = block->entry_speed;
+    s.exit_speed = block->exit_speed;
+    s.acceleration = block->acceleration;
+    s.direction_bits = block->direction_bits.to_ulong();
+    s.s_curve = block->s_curve;
+    s.seq = seq;
+}
+
+// the slave's own blocks only ever come from here, so it is the only producer of its queue
+void BoardSync::queue_block(const SyncBlock &s)
+{
+    Conveyor *conveyor = THEKERNEL->conveyor;
+    if (conveyor->is_halted()) return;
+
+    Block *block = conveyor->queue.head_ref();
+    for (int i = 0; i < MAX_ROBOT_ACTUATORS; i++) {
+        block->steps[i] = s.steps[i];
+        block->backlash_steps[i] = s.backlash_steps[i];
+    }
+    block->calculate_step_ratios(THEKERNEL->robot->actuators.size());
+    block->nominal_rate = s.nominal_rate;
+    block->initial_rate = s.initial_rate;
+    block->final_rate = s.final_rate;
+    block->accelerate_until = s.accelerate_until;
+    block->decelerate_after = s.decelerate_after;
+    block->accelerate_ticks = s.accelerate_ticks;
+    block->decelerate_ticks = s.decelerate_ticks;
+    block->rate_delta = s.rate_delta;
+#ifdef FIXED_POINT_STEPPING
+    block->fixed_rate_delta = StepperMotor::to_fixed_rate(s.rate_delta);
+#endif
+    block->peak_rate = s.peak_rate;
+    block->seconds = s.seconds;
+    block->millimeters = s.millimeters;
+    block->nominal_speed = block->programmed_speed = s.nominal_speed;
+    block->entry_speed = block->max_entry_speed = s.entry_speed;
+    block->exit_speed = s.exit_speed;
+    block->acceleration = s.acceleration;
+    block->direction_bits = s.direction_bits;
+    block->s_curve = s.s_curve;
+    // it is run as it was planned on the master
+    block->locked = true;
+    block->ready();
+    conveyor->queue.produce_head();
+}
+
+// Runs in the GPIO interrupt, each edge begins the next block
+uint32_t BoardSync::on_sync_edge(uint32_t state)
+{
+    if (!THEKERNEL->conveyor->start_next_block()) late_starts++;
+    return 0;
+}
+
+void BoardSync::on_hold(bool hold)
+{
+    send_control(hold ? 'F' : 'R');
+}
+
+int BoardSync::build_frame(uint8_t *frame, uint8_t type, const void *payload, uint8_t len)
+{
+    frame[0] = FRAME_SYNC;
+    frame[1] = type;
+    frame[2] = len;
+    memcpy(&frame[3], payload, len);
+    uint16_t crc = 0xFFFF;
+    for (int i = 1; i < len + 3; i++) crc = BinaryGcode::crc_update(crc, frame[i]);
+    frame[len + 3] = crc & 0xFF;
+    frame[len + 4] = crc >> 8;
+    return len + 5;
+}
+
+// from the main loop or an interrupt, a frame that does not fit is not sent
+bool BoardSync::put_frame(const uint8_t *frame, int n)
+{
+    // the caller may have interrupts off already, they are left as they were
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    int room = tx_tail - tx_head - 1;
+    if (room < 0) room += tx_size;
+    bool fits = room >= n;
+    if (fits) {
+        int head = tx_head;
+        for (int i = 0; i < n; i++) {
+            tx_buffer[head] = frame[i];
+            if (++head == tx_size) head = 0;
+        }
+        tx_head = head;
+        if (tx_idle) fill_tx();
+    }
+    __set_PRIMASK(primask);
+    return fits;
+}
+
+void BoardSync::send_control(uint8_t type)
+{
+    if (!enabled) return;
+    uint8_t frame[5];
+    if (!put_frame(frame, build_frame(frame, type, nullptr, 0))) dropped++;
+}
+
+void BoardSync::on_serial_tx_empty()
+{
+    fill_tx();
+}
+
+// the fifo holds 16 once the uart says it is empty, interrupts must be off or this is the interrupt
+void BoardSync::fill_tx()
+{
+    int n = 0;
+    int tail = tx_tail;
+    for (; n < 16 && tail != tx_head; n++) {
+        serial->putc_unchecked(tx_buffer[tail]);
+        if (++tail == tx_size) tail = 0;
+    }
+    tx_tail = tail;
+    tx_idle = (n == 0);
+}
+
+// the uart interrupt may not get in while a block begins, so the fifo is kept topped up from here until the last
+// character has gone
+void BoardSync::drain_tx()
+{
+    while (true) {
+        __disable_irq();
+        uint32_t lsr = serial->line_status();
+        if (lsr & LSR_THRE) fill_tx();
+        bool done = tx_head == tx_tail && (lsr & LSR_TEMT);
+        __enable_irq();
+        if (done) return;
+    }
+}
+
+void BoardSync::on_serial_char_received()
+{
+    uint32_t lsr;
+    while ((lsr = serial->line_status()) & LSR_RDR) {
+        if (lsr & LSR_ERRORS) {
+            serial->getc_unchecked();
+            rx_state = SYNC;
+            bad_frames++;
+            continue;
+        }
+        receive(serial->getc_unchecked());
+    }
+}
+
+void BoardSync::receive(uint8_t c)
+{
+    switch (rx_state) {
+        case SYNC:
+            if (c == FRAME_SYNC) {
+                rx_crc = 0xFFFF;
+                rx_state = TYPE;
+            }
+            return;
+
+        case TYPE:
+            rx_type = c;
+            rx_crc = BinaryGcode::crc_update(rx_crc, c);
+            rx_state = LENGTH;
+            return;
+
+        case LENGTH:
+            if (c > sizeof(rx_frame)) {
+                rx_state = SYNC;
+                bad_frames++;
+                return;
+            }
+            rx_length = c;
+            rx_count = 0;
+            rx_crc = BinaryGcode::crc_update(rx_crc, c);
+            rx_state = c == 0 ? CRC_LO : PAYLOAD;
+            return;
+
+        case PAYLOAD:
+            rx_frame[rx_count++] = c;
+            rx_crc = BinaryGcode::crc_update(rx_crc, c);
+            if (rx_count == rx_length) rx_state = CRC_LO;
+            return;
+
+        case CRC_LO:
+            if (c != (rx_crc & 0xFF)) {
+                rx_state = SYNC;
+                bad_frames++;
+                // a block may have been in it
+                if (slave) lost = true;
+                return;
+            }
+            rx_state = CRC_HI;
+            return;
+
+        case CRC_HI:
+            rx_state = SYNC;
+            if (c != (rx_crc >> 8)) {
+                bad_frames++;
+                if (slave) lost = true;
+                return;
+            }
+            handle_frame();
+            return;
+    }
+}
+
+// in the receive interrupt, a feed hold acts at once, the rest waits for the main loop
+void BoardSync::handle_frame()
+{
+    switch (rx_type) {
+        case 'B': {
+            if (!slave || rx_length != sizeof(SyncBlock)) {
+                bad_frames++;
+                return;
+            }
+            uint8_t next = (rx_blocks_head + 1) % rx_blocks_size;
+            SyncBlock &s = rx_blocks[rx_blocks_head];
+            memcpy(&s, rx_frame, sizeof(s));
+            if (s.seq != rx_seq || next == rx_blocks_tail) {
+                lost = true;
+                return;
+            }
+            rx_seq++;
+            blocks++;
+            rx_blocks_head = next;
+            return;
+        }
+        case 'F': if (slave) THEKERNEL->stepper->feed_hold(); return;
+        case 'R': if (slave) THEKERNEL->stepper->resume(); return;
+        case 'H': do_halt = true; return;
+        case 'C': do_clear = true; return;
+        default: bad_frames++; return;
+    }
+}
@@ -0,0 +1,145 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BOARDSYNC_H
+#define BOARDSYNC_H
+
+#include "libs/Module.h"
+#include "libs/Pin.h"
+#include "libs/nuts_bolts.h"
+
+#include <stdint.h>
+
+class Block;
+class UartSerial;
+
+/*
+ * Runs the moves of one machine on two boards, for more motors than one board has.
+ *
+ * The master plans every move with all the actuators, the ones the slave drives set as <name>_remote with no pins,
+ * and sends each block over a uart to the slave with its steps and trapezoid worked out. The slave is set up with
+ * the same actuators, pins for its own and none for the master's, and queues the blocks as they come without planning
+ * them. The master toggles board_sync_pin as each block begins and the slave begins its next block on each edge, so
+ * both begin every block together and step through it the same way, as long as both are built with the same
+ * MAX_ROBOT_ACTUATORS and have the same acceleration tick, S-curve and input shaper settings.
+ *
+ * A block is sent while the one before it runs, and from then on the master plans it as if it had begun. One that
+ * has not been sent by the time it begins, as the queue had run dry, is sent then, and no block begins before the
+ * slave has all of it.
+ *
+ *   frame:   0xA5 type len payload[len] crc_lo crc_hi, crc as BinaryGcode's over type, len and the payload
+ *   types:   'B' a block, 'F' feed hold, 'R' resume, 'H' halt, 'C' halt cleared
+ *
+ * Halts go both ways, the rest only from the master. A feed hold or resume acts on the slave as it arrives, a frame
+ * later than on the master.
+ */
+class BoardSync : public Module {
+    public:
+        BoardSync();
+
+        void on_module_loaded();
+        void on_idle(void *argument);
+        void on_halt(void *argument);
+        void on_gcode_received(void *argument);
+
+    private:
+        // what the slave needs of a block to step it as the master does
+        struct SyncBlock {
+            uint32_t steps[MAX_ROBOT_ACTUATORS];
+            uint16_t backlash_steps[MAX_ROBOT_ACTUATORS];
+            uint32_t nominal_rate;
+            uint32_t initial_rate;
+            uint32_t final_rate;
+            uint32_t accelerate_until;
+            uint32_t decelerate_after;
+            uint32_t accelerate_ticks;
+            uint32_t decelerate_ticks;
+            float rate_delta;
+            float peak_rate;
+            float seconds;
+            float millimeters;
+            float nominal_speed;
+            float entry_speed;
+            float exit_speed;
+            float acceleration;
+            uint8_t direction_bits;
+            uint8_t s_curve;
+            uint8_t seq;                // counts the blocks sent since the last halt, so a lost one is noticed
+        };
+        static const int max_frame = sizeof(SyncBlock) + 5;
+        static const int tx_size = 512;
+        static const int rx_blocks_size = 4;
+
+        void on_block_begin_hook(Block *block);
+        void on_hold(bool hold);
+        uint32_t on_sync_edge(uint32_t state);
+        void on_serial_char_received();
+        void on_serial_tx_empty();
+
+        void send_next_block();
+        static void encode(const Block *block, uint8_t seq, SyncBlock &s);
+        void queue_block(const SyncBlock &s);
+        static int build_frame(uint8_t *frame, uint8_t type, const void *payload, uint8_t len);
+        bool put_frame(const uint8_t *frame, int n);
+        void send_control(uint8_t type);
+        void fill_tx();
+        void drain_tx();
+        void receive(uint8_t c);
+        void handle_frame();
+
+        UartSerial *serial;
+        Pin sync_pin;
+
+        // transmit ring, drained into the uart fifo by its interrupt, or by the block beginning when that has to wait
+        uint8_t tx_buffer[tx_size];
+        volatile uint16_t tx_head;
+        volatile uint16_t tx_tail;
+
+        // the master: the block the main loop is sending ahead, a block beginning before it is sent sends it itself
+        Block * volatile sending;
+        uint8_t sending_seq;
+        uint8_t tx_seq;
+        uint8_t stage[max_frame];
+        uint8_t isr_stage[max_frame];
+
+        // the frame being received
+        enum RxState { SYNC, TYPE, LENGTH, PAYLOAD, CRC_LO, CRC_HI };
+        uint8_t rx_frame[sizeof(SyncBlock)];
+        uint8_t rx_type;
+        uint8_t rx_length;
+        uint8_t rx_count;
+        uint16_t rx_crc;
+        uint8_t rx_state;
+        uint8_t rx_seq;
+
+        // the slave: blocks received, queued by the main loop, the interrupt is the only writer of rx_blocks_head
+        SyncBlock rx_blocks[rx_blocks_size];
+        volatile uint8_t rx_blocks_head;
+        volatile uint8_t rx_blocks_tail;
+
+        // counts for M417
+        volatile uint32_t blocks;       // sent or received
+        volatile uint32_t late_sends;   // sent as they began
+        volatile uint32_t uart_waits;   // blocks that began with their frame still going out
+        volatile uint32_t max_wait_us;
+        volatile uint32_t late_starts;  // edges with the block they start not queued yet
+        volatile uint32_t bad_frames;
+        volatile uint32_t dropped;      // frames with no room to go out
+
+        struct {
+            bool slave:1;
+            bool enabled:1;
+            volatile bool tx_idle:1;
+            volatile bool sync_state:1;
+            volatile bool do_halt:1;    // the other board halted
+            volatile bool do_clear:1;   // and cleared the halt
+            volatile bool lost:1;       // a block went missing, halt both
+            bool halt_from_link:1;
+        };
+};
+
+#endif
@@ -0,0 +1,29 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPENSATIONSTRATEGY_H
+#define COMPENSATIONSTRATEGY_H
+
+#include <stddef.h>
+
+// A bed compensation, set in Robot by a leveling strategy to adjust the target of each move
+class CompensationStrategy {
+    public:
+        virtual ~CompensationStrategy() {};
+        virtual void compensate( float target[3] ) = 0;
+        // adjust n xyz triples at once, strategies can override this to share setup across the points
+        virtual void compensate_batch( float targets[], size_t n ) {
+            for (size_t i = 0; i < n; ++i) {
+                compensate(&targets[i*3]);
+            }
+        }
+        // a strategy that is linear in x y z can give itself as the rows of an affine transform instead, Robot then
+        // folds it in with the skew correction and applies them both with one multiply, false if it is not linear. m comes filled with the identity
+        virtual bool get_affine( float m[3][4] ) { return false; }
+};
+
+#endif
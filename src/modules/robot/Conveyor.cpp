@@ -7,9 +7,12 @@
 
 using namespace std;
 #include <vector>
+#include <string.h>
+#include <algorithm>
 #include "libs/nuts_bolts.h"
 #include "libs/RingBuffer.h"
 #include "../communication/utils/Gcode.h"
+#include "../communication/GcodeDispatch.h"
 #include "libs/Module.h"
 #include "libs/Kernel.h"
 #include "Timer.h" // mbed.h lib
@@ -17,13 +20,26 @@ using namespace std;
 #include "Block.h"
 #include "Conveyor.h"
 #include "Planner.h"
+#include "Robot.h"
+#include "Stepper.h"
 #include "mri.h"
 #include "checksumm.h"
 #include "Config.h"
 #include "libs/StreamOutputPool.h"
 #include "ConfigValue.h"
+#include "libs/StreamOutput.h"
+#include "us_ticker_api.h"
+#include "IsrProfiler.h"
+#include "EventTrace.h"
 
 #define planner_queue_size_checksum CHECKSUM("planner_queue_size")
+#define planner_queue_memory_checksum CHECKSUM("planner_queue_memory")
+#define planner_queue_gc_per_idle_checksum CHECKSUM("planner_queue_gc_per_idle")
+#define planner_queue_low_watermark_checksum CHECKSUM("planner_queue_low_watermark")
+#define planner_queue_lookahead_ms_checksum CHECKSUM("planner_queue_lookahead_ms")
+
+// a queue restarted within this long of running dry was still being fed, so it counts as an underrun, a longer gap is the job ending
+#define UNDERRUN_GAP_US 1000000
 
 /*
  * The conveyor holds the queue of blocks, takes care of creating them, and starting the executing chain of blocks
@@ -32,45 +48,53 @@ using namespace std;
  *
  * Since delete() is not thread-safe, we must marshall deletable items out of ISR context
  *
- * To do this, we have implmented a *double* ringbuffer- two ringbuffers sharing the same ring, and one index pointer
+ * To do this, the ring has three indexes (see SpscRing.h), each of which is only ever written by one side
  *
  * as in regular ringbuffers, HEAD always points to a clean, free block. We are free to prepare it as we see fit, at our leisure.
- * When the block is fully prepared, we increment the head pointer, and from that point we must not touch it anymore.
- *
- * also, as in regular ringbuffers, we can 'use' the TAIL block, and increment tail pointer when we're finished with it
- *
- * Both of these are implemented here- see queue_head_block() (where head is pushed) and on_idle() (where tail is consumed)
+ * When the block is fully prepared, we publish it by incrementing the head index, and from that point we must not touch it anymore.
  *
- * The double ring is implemented by adding a third index pointer that lives in between head and tail. We call it gc_pending which describes its function rather than its operation
+ * in ISR context, the blocks between the ISR tail and HEAD are ready to execute. When we're finished with a block we increment
+ * the ISR tail to signal that it is finished, and ready to be cleaned
  *
- * in ISR context, we use HEAD as the head pointer, and gc_pending as the tail pointer.
- * As HEAD increments, ISR context can consume the new blocks which appear, and when we're finished with a block, we increment gc_pending to signal that they're finishd, and ready to be cleaned
+ * in IDLE context, the blocks between TAIL and the ISR tail are finished. We clean up the tail block (performing ISR-unsafe delete
+ * operations) and consume it (increment tail), returning it to the pool of clean, unused blocks which HEAD is allowed to prepare for queueing
  *
- * in IDLE context, we use gc_pending as the head pointer, and TAIL as the tail pointer.
- * When gc_pending != tail, we clean up the tail block (performing ISR-unsafe delete operations) and consume it (increment tail pointer), returning it to the pool of clean, unused blocks which HEAD is allowed to prepare for queueing
- *
- * Thus, our two ringbuffers exist sharing the one ring of blocks, and we safely marshall used blocks from ISR context to IDLE context for safe cleanup.
+ * Every index is published with release semantics and read with acquire semantics, so no interrupts need to be disabled for this handoff.
  */
 
 Conveyor::Conveyor(){
-    gc_pending = queue.tail_i;
     running = false;
     flush = false;
     halted= false;
+    gc_max_per_idle= 0;
+    low_watermark= 4;
+    queue_memory= PLACE_HEAP;
+    lookahead_us= 0;
+    queued_us= 0;
+    executed_seconds= 0.0F;
+    source_tag= executed_tag= 0;
+    dry= false;
+    halts= 0;
+    halt_stop_us= halt_reset_us= 0;
+    dry_run= false;
+    external_start= false;
+    start_pending= false;
+    reset_stall_stats();
 }
 
 void Conveyor::on_module_loaded(){
     register_for_event(ON_IDLE);
-    register_for_event(ON_MAIN_LOOP);
+    register_for_main_loop(MAIN_LOOP_FEED, "conveyor");
     register_for_event(ON_HALT);
+    register_for_gcodes('M', {411, 413});
 
     on_config_reload(this);
 }
 
+// the queue was emptied by halt_motion() before this
 void Conveyor::on_halt(void* argument){
     if(argument == nullptr) {
         halted= true;
-        flush_queue();
     }else{
         halted= false;
     }
@@ -78,18 +102,40 @@ void Conveyor::on_halt(void* argument){
 
 // Delete blocks here, because they can't be deleted in interrupt context ( see Block.cpp:release )
 // note that blocks get cleaned as they come off the tail, so head ALWAYS points to a cleaned block.
+// all the blocks that have finished since the last call are cleaned in one go, unless limited by planner_queue_gc_per_idle
 void Conveyor::on_idle(void* argument){
-    if (queue.tail_i != gc_pending)
+    // before the blocks that have finished are cleaned, their gcodes must have been through the deferred execute
+    execute_deferred();
+
+    unsigned int cleaned = 0;
+    while (!queue.gc_is_empty())
     {
-        if (queue.is_empty()) {
-            __debugbreak();
-        }else{
-            // Cleanly delete block
-            Block* block = queue.tail_ref();
-//             block->debug();
-            block->clear();
-            queue.consume_tail();
-        }
+        // Cleanly delete block
+        Block* block = queue.tail_ref();
+//         block->debug();
+        // one the stepper began and finished after execute_deferred looked, its gcodes still have to go first
+        if (block->begun && !block->deferred_done && THEKERNEL->has_deferred_execute()) block->execute_deferred();
+        queued_us -= block->lookahead_us;
+        block->clear();
+        queue.consume_tail();
+
+        if (++cleaned == gc_max_per_idle)
+            break;
+    }
+}
+
+// Hands the gcodes of the blocks that have begun to the modules that wanted them in the main loop, in queue order.
+// The blocks from the gc tail to the isr tail have all been used, or thrown away by a flush without beginning,
+// and the one at the isr tail may have begun. None of them can be cleaned until this returns
+void Conveyor::execute_deferred()
+{
+    if (!THEKERNEL->has_deferred_execute()) return;
+
+    unsigned int end = queue.get_isr_tail_i();
+    for (unsigned int i = queue.get_tail_i(); ; i = queue.next(i)) {
+        Block *block = queue.item_ref(i);
+        if (block->begun && !block->deferred_done) block->execute_deferred();
+        if (i == end) break;
     }
 }
 
@@ -118,7 +164,7 @@ void Conveyor::on_main_loop(void*)
 
     if (queue.is_empty())
     {
-        if (queue.head_ref()->gcodes.size())
+        if (queue.head_ref()->has_gcodes())
         {
             queue_head_block();
             ensure_running();
@@ -131,7 +177,24 @@ void Conveyor::on_main_loop(void*)
 
 void Conveyor::on_config_reload(void* argument)
 {
-    queue.resize(THEKERNEL->config->value(planner_queue_size_checksum)->by_default(32)->as_number());
+    unsigned int size = THEKERNEL->config->value(planner_queue_size_checksum)->by_default(32)->as_number();
+    // a deep queue can go in the AHB banks to leave main RAM for the stack
+    queue_memory = placement_from_string(THEKERNEL->config->value(planner_queue_memory_checksum)->by_default("heap")->as_string().c_str(), PLACE_HEAP);
+    resize_queue(size);
+    gc_max_per_idle = THEKERNEL->config->value(planner_queue_gc_per_idle_checksum)->by_default(0)->as_number();
+    low_watermark = THEKERNEL->config->value(planner_queue_low_watermark_checksum)->by_default(4)->as_number();
+    lookahead_us = THEKERNEL->config->value(planner_queue_lookahead_ms_checksum)->by_default(0)->as_number() * 1000;
+
+    // enough gcode nodes for one per block, more get added from the heap if needed and are kept for reuse
+    Block::reserve_gcodes(size);
+}
+
+// only while nothing is queued, the old storage is kept if there is no room for the new
+bool Conveyor::resize_queue(unsigned int size)
+{
+    if (size < 2 || !queue.resize(size, queue_memory)) return false;
+    queued_us = 0;
+    return true;
 }
 
 void Conveyor::append_gcode(Gcode* gcode)
@@ -140,41 +203,168 @@ void Conveyor::append_gcode(Gcode* gcode)
     queue.head_ref()->append_gcode(gcode);
 }
 
+// a block with nothing but actions is queued by on_main_loop once the queue is idle, like one with only gcodes
+void Conveyor::append_action(BlockAction action, void *arg, float value)
+{
+    queue.head_ref()->append_action(action, arg, value);
+}
+
 // Process a new block in the queue
 void Conveyor::on_block_end(void* block)
 {
-    if (queue.is_empty())
+    if (queue.isr_is_empty())
         __debugbreak();
 
-    gc_pending = queue.next(gc_pending);
+    TRACE_EVENT(BLOCK_END, queue.isr_queued());
+    if (!flush) {
+        executed_seconds += queue.isr_tail_ref()->seconds;
+        executed_tag = queue.isr_tail_ref()->source_tag;
+    }
+    queue.isr_consume_tail();
 
     // mark entire queue for GC if flush flag is asserted
     if (flush){
-        while (gc_pending != queue.head_i) {
-            gc_pending = queue.next(gc_pending);
-        }
+        queue.isr_consume_all();
     }
 
     // Return if queue is empty
-    if (gc_pending == queue.head_i)
+    if (queue.isr_is_empty())
     {
+        dry_since = us_ticker_read();
+        dry = !flush;
         running = false;
         return;
     }
 
+    unsigned int queued = queue.isr_queued();
+    if (queued < min_queued) min_queued = queued;
+    if (queued >= low_watermark) {
+        below_low = false;
+    } else if (!below_low) {
+        below_low = true;
+        low_marks++;
+    }
+
+    // a board_sync slave waits for the master to begin the next block, unless it already has
+    if (external_start) {
+        __disable_irq();
+        bool now = start_pending;
+        start_pending = false;
+        if (!now) running = false;
+        __enable_irq();
+        if (!now) return;
+    }
+
     // Get a new block
-    Block* next = this->queue.item_ref(gc_pending);
+    Block* next = this->queue.isr_tail_ref();
+    if (begin_hook) begin_hook(next);
 
+    // the time from the end of one block to the start of the next, most of the gap between them
+    ISR_PROFILE_ENTER();
+    TRACE_EVENT(BLOCK_BEGIN, queued);
     next->begin();
+    ISR_PROFILE_EXIT(BLOCK_BEGIN);
 }
 
 // Wait for the queue to be empty
+// This ends the lookahead and the machine stops, so it is only for what needs the moves before it done, like M400,
+// homing, probing, a tool change or saving the position. A setting that only changes how later blocks run should
+// attach a gcode or an action to the queue instead.
 void Conveyor::wait_for_empty_queue()
 {
+    // the moves before this include a line the robot may be holding back to merge
+    THEKERNEL->robot->flush_merged_line();
+
+    if (!queue.is_empty()) {
+        uint32_t gcode = THEKERNEL->gcode_dispatch->get_dispatching();
+        auto d = drains.begin();
+        while (d != drains.end() && d->gcode != gcode) ++d;
+        if (d == drains.end()) drains.push_back({gcode, 1});
+        else d->count++;
+    }
+
     while (!queue.is_empty()) {
         ensure_running();
         THEKERNEL->call_event(ON_IDLE, this);
     }
+    // stopping was asked for, so it is not an underrun
+    dry = false;
+}
+
+void Conveyor::print_drains(StreamOutput *stream) const
+{
+    stream->printf("Queue drains:");
+    for (auto& d : drains) {
+        if (d.gcode == 0) stream->printf(" other:%u", d.count);
+        else stream->printf(" %c%u:%u", (char)(d.gcode >> 16), (unsigned)(d.gcode & 0xFFFF), d.count);
+    }
+    stream->printf("\r\n");
+}
+
+// a block ending while this adds up may be counted twice, near enough for an estimate
+float Conveyor::get_queued_seconds()
+{
+    float s = 0.0F;
+    for (unsigned int i = queue.get_isr_tail_i(); i != queue.get_head_i(); i = queue.next(i))
+        s += queue.item_ref(i)->seconds;
+    return s;
+}
+
+void Conveyor::print_underruns(StreamOutput *stream) const
+{
+    unsigned int lowest = min_queued == ~0U ? 0 : min_queued;
+    stream->printf("Queue underruns: %u, stopped for %1.3fs, fell below %u blocks: %u times, fewest blocks queued: %u\r\n",
+                   underruns, dry_us / 1000000.0F, low_watermark, low_marks, lowest);
+}
+
+void Conveyor::reset_stall_stats()
+{
+    full_stalls = full_stall_idles = 0;
+    drains.clear();
+    underruns = 0;
+    dry_us = 0;
+    low_marks = 0;
+    min_queued = ~0U;
+    below_low = false;
+}
+
+// M411 reports how well the queue is being fed, M411 R clears the counts afterwards
+void Conveyor::on_gcode_received(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    if (gcode->has_m && gcode->m == 411) {
+        print_underruns(gcode->stream);
+        gcode->stream->printf("Queue full stalls: %u, idle calls while stalled: %u\r\n", full_stalls, full_stall_idles);
+        gcode->stream->printf("Blocks slowed down for a low queue: %u\r\n", THEKERNEL->planner->get_slowdown_count());
+        if (halts > 0) {
+            gcode->stream->printf("Halts: %u, the last stopped the motors in %luus and emptied the queue in %luus\r\n", halts,
+                                  (unsigned long)halt_stop_us, (unsigned long)halt_reset_us);
+        }
+        if (gcode->has_letter('R')) {
+            reset_stall_stats();
+            THEKERNEL->planner->reset_slowdown_count();
+        }
+
+    } else if (gcode->has_m && gcode->m == 413) {
+        // M413 S<blocks> resizes the queue once what is in it has run, L<ms> sets the lookahead time, 0 for none
+        if (gcode->has_letter('L')) {
+            lookahead_us = gcode->get_value('L') * 1000;
+        }
+        if (gcode->has_letter('S')) {
+            unsigned int size = gcode->get_value('S');
+            wait_for_empty_queue();
+            // the head block can still hold gcodes waiting for a next block, they would be lost with it
+            while (queue.head_ref()->has_gcodes() || !queue.is_empty()) {
+                on_main_loop(nullptr);
+                THEKERNEL->call_event(ON_IDLE, this);
+            }
+            if (halted || !resize_queue(size)) {
+                gcode->stream->printf("could not resize the planner queue to %u blocks\r\n", size);
+            }
+        }
+        gcode->stream->printf("Planner queue: %u blocks, lookahead %lums, %1.3fs queued\r\n", queue.size(),
+                              (unsigned long)(lookahead_us / 1000), queued_us / 1000000.0F);
+    }
 }
 
 /*
@@ -183,9 +373,13 @@ void Conveyor::wait_for_empty_queue()
 void Conveyor::queue_head_block()
 {
     // upstream caller will block on this until there is room in the queue
-    while (queue.is_full()) {
-        ensure_running();
-        THEKERNEL->call_event(ON_IDLE, this);
+    if (is_queue_full()) {
+        full_stalls++;
+        while (is_queue_full()) {
+            ensure_running();
+            THEKERNEL->call_event(ON_IDLE, this);
+            full_stall_idles++;
+        }
     }
 
     if(halted) {
@@ -194,23 +388,99 @@ void Conveyor::queue_head_block()
         queue.head_ref()->clear();
 
     }else{
-        queue.head_ref()->ready();
+        Block *block = queue.head_ref();
+        block->source_tag = source_tag;
+        // the nominal time, which overrides and replanning do not change after this
+        block->lookahead_us = block->nominal_speed > 0.0F ? block->millimeters * 1e6F / block->nominal_speed : 0;
+        queued_us += block->lookahead_us;
+        block->ready();
         queue.produce_head();
+        TRACE_EVENT(QUEUE_DEPTH, queue.isr_queued());
     }
 }
 
 void Conveyor::ensure_running()
 {
-    if (!running)
+    if (dry_run) {
+        if (!queue.isr_is_empty()) {
+            count_dry_block(queue.isr_tail_ref());
+            queue.isr_consume_tail();
+        }
+        return;
+    }
+    if (!running && !external_start)
     {
-        if (gc_pending == queue.head_i)
+        if (queue.isr_is_empty())
             return;
 
+        if (dry) {
+            dry = false;
+            uint32_t gap = us_ticker_read() - dry_since;
+            if (gap < UNDERRUN_GAP_US) {
+                underruns++;
+                dry_us += gap;
+                TRACE_EVENT(UNDERRUN, gap);
+            }
+        }
         running = true;
-        queue.item_ref(gc_pending)->begin();
+        if (begin_hook) begin_hook(queue.isr_tail_ref());
+        TRACE_EVENT(BLOCK_BEGIN, queue.isr_queued());
+        queue.isr_tail_ref()->begin();
     }
 }
 
+bool Conveyor::start_next_block()
+{
+    __disable_irq();
+    bool now = !running && !queue.isr_is_empty();
+    if (now) running = true;
+    start_pending = !now;
+    __enable_irq();
+    if (!now) return false;
+
+    TRACE_EVENT(BLOCK_BEGIN, queue.isr_queued());
+    queue.isr_tail_ref()->begin();
+    return true;
+}
+
+// only while nothing is running, the stats start again each time it is turned on
+void Conveyor::set_dry_run(bool on)
+{
+    if (on && !dry_run) {
+        memset(&dry_stats, 0, sizeof(dry_stats));
+        // until the first block is dropped the machine would have everything queued in hand
+        dry_stats.level = 1e9F;
+        dry_stats.start_us = us_ticker_read();
+        dry_starving = false;
+    }
+    dry_run = on;
+}
+
+// A block the dry run has dropped as though it had run. The machine gains the block's time and loses the time a block
+// has taken to plan on average so far, and can't have more in hand than the queue holds, if it runs out the block
+// would have been waited for
+void Conveyor::count_dry_block(const Block *block)
+{
+    executed_seconds += block->seconds;
+    DryRunStats &s = dry_stats;
+    s.blocks++;
+    s.seconds += block->seconds;
+    float plan_seconds = (us_ticker_read() - s.start_us) / (1e6F * s.blocks);
+    float level = std::min(s.level + block->seconds - plan_seconds, queued_us / 1e6F);
+    if (level >= 0.0F) {
+        dry_starving = false;
+    } else {
+        level = 0.0F;
+        s.starved++;
+        if (!dry_starving) {
+            if (s.sections < sizeof(s.section_tags) / sizeof(s.section_tags[0])) s.section_tags[s.sections] = block->source_tag;
+            s.sections++;
+            dry_starving = true;
+        }
+    }
+    s.level = level;
+}
+
 /*
 
     In most cases this will not totally flush the queue, as when streaming
@@ -228,19 +498,97 @@ void Conveyor::flush_queue()
     flush = false;
 }
 
+// Stops the motors where they are, without decelerating, and throws away everything queued, all in a time that does not
+// depend on what the queue holds. The blocks are left for on_idle to clean as after a flush. The kernel calls this as a
+// halt begins, before any module gets ON_HALT, and the time it took is reported by M411
+void Conveyor::halt_motion()
+{
+    uint32_t start = us_ticker_read();
+    __disable_irq();
+    THEKERNEL->stepper->stop_motors();
+    uint32_t stopped = us_ticker_read();
+
+    // the modules that have the running block taken let go of it as it ends, then the rest of the queue goes in one step
+    flush = true;
+    if (!queue.isr_is_empty() && queue.isr_tail_ref()->begun) queue.isr_tail_ref()->release_all();
+    queue.isr_consume_all();
+    running = false;
+    dry = false;
+    flush = false;
+    start_pending = false;
+    __enable_irq();
+
+    halt_stop_us = stopped - start;
+    halt_reset_us = us_ticker_read() - start;
+    halts++;
+    THEKERNEL->call_event(ON_SPEED_CHANGE, 0); // tell others we stopped
+}
+
+// The blocks that have not begun are kept up to the first one that the speed can be brought down to a stop by the end of,
+// and on to the end of the line that one came from, so the machine stops between two lines of the source. The rest are
+// dropped and what is kept is planned again to end there. False if there was nothing to drop
+bool Conveyor::truncate_queue(uint32_t &tag)
+{
+    float stop_speed = THEKERNEL->planner->get_minimum_planner_speed();
+    const unsigned int head_i = queue.get_head_i();
+    unsigned int i;
+
+    // the blocks are looked through with interrupts on, so the stepper may begin another meanwhile, in which case it
+    // is done again from there
+    for (;;) {
+        __disable_irq();
+        i = queue.get_isr_tail_i();
+        const Block *last = nullptr;
+        float min_exit = 0.0F;
+        // the running block, and the one after it if a board_sync slave has been sent it, have to be run as they are
+        while (i != head_i && (queue.item_ref(i)->begun || queue.item_ref(i)->locked)) {
+            last = queue.item_ref(i);
+            min_exit = last->exit_speed;
+            i = queue.next(i);
+        }
+        __enable_irq();
+
+        for (; i != head_i; i = queue.next(i)) {
+            const Block *block = queue.item_ref(i);
+            if (last == nullptr || (min_exit <= stop_speed && block->source_tag != last->source_tag)) break;
+            // the slowest the block can leave at, braking all the way from the slowest it can enter at
+            float a2d = 2.0F * block->acceleration * block->millimeters;
+            min_exit = (block->millimeters > 0.0F && min_exit * min_exit > a2d) ? sqrtf(min_exit * min_exit - a2d) : 0.0F;
+            last = block;
+        }
+        if (i == head_i) return false;
+
+        // the stepper takes the blocks in order, so none after this one has begun if it has not
+        __disable_irq();
+        if (!queue.item_ref(i)->begun && !queue.item_ref(i)->locked) break;
+        __enable_irq();
+    }
+    tag = queue.item_ref(i)->source_tag;
+    queue.truncate_head(i);
+    __enable_irq();
+
+    // nothing else can see the dropped blocks now, and the head has to be clean for the next one. The slot that was the
+    // head may have had gcodes and actions added to it for the block that would have come next, they go with the rest
+    queue.item_ref(head_i)->clear();
+    bool reverted[3] = {false, false, false};
+    for (unsigned int j = i; j != head_i; j = queue.next(j)) {
+        queued_us -= queue.item_ref(j)->lookahead_us;
+        THEKERNEL->planner->revert_backlash(queue.item_ref(j), reverted);
+        queue.item_ref(j)->clear();
+    }
+    THEKERNEL->planner->replan_queue();
+    return true;
+}
+
 // Debug function
 void Conveyor::dump_queue()
 {
-    for (unsigned int index = queue.tail_i, i = 0; true; index = queue.next(index), i++ )
+    for (unsigned int index = queue.get_tail_i(), i = 0; true; index = queue.next(index), i++ )
     {
         THEKERNEL->streams->printf("block %03d > ", i);
         queue.item_ref(index)->debug();
 
-        if (index == queue.head_i)
+        if (index == queue.get_head_i())
             break;
     }
 }
-
-// feels hacky, but apparently the way to do it
-#include "HeapRing.cpp"
-template class HeapRing<Block>;
@@ -9,14 +9,16 @@
 #define CONVEYOR_H
 
 #include "libs/Module.h"
-#include "HeapRing.h"
+#include "SpscRing.h"
+#include "Block.h"
+#include "libs/Callback.h"
 
 using namespace std;
 #include <string>
 #include <vector>
 
 class Gcode;
-class Block;
+class StreamOutput;
 
 class Conveyor : public Module
 {
@@ -29,34 +31,138 @@ public:
     void on_block_end(void *);
     void on_halt(void *);
     void on_config_reload(void *);
+    void on_gcode_received(void *);
 
     void notify_block_finished(Block *);
 
     void wait_for_empty_queue();
     bool is_queue_empty() { return queue.is_empty(); };
-    bool is_queue_full() { return queue.is_full(); };
+    // with a planner_queue_lookahead_ms the queue is also full once it holds that much motion, as long as it has
+    // at least low_watermark blocks, so long moves do not queue a long way ahead of what is happening
+    bool is_queue_full() { return queue.is_full() || (lookahead_us > 0 && queued_us >= lookahead_us && queue.isr_queued() >= low_watermark); };
+    // from ON_BLOCK_END, true if another block will begin straight after this one
+    bool has_next_block() const { return !flush && queue.isr_has_next(); }
+    // blocks waiting to be executed, including the one running now
+    unsigned int queued_blocks() const { return queue.isr_queued(); }
+    unsigned int get_low_watermark() const { return low_watermark; }
+    // some blocks are left but fewer than planner_queue_low_watermark, the main loop holds back what can wait
+    bool is_running_low() const { unsigned int queued = queue.isr_queued(); return queued > 0 && queued < low_watermark; }
 
     void ensure_running(void);
+    // for a board_sync slave, each block waits for start_next_block() instead of beginning as the one before it ends
+    void set_external_start(bool on) { external_start= on; }
+    // from an interrupt, begins the next block, or has it begin as soon as the running one ends or it is queued,
+    // true if it began now
+    bool start_next_block();
+    bool is_start_pending() const { return start_pending; }
+    // called just before each block begins, from where it begins, for a board_sync master to send it first
+    template<typename T, void (T::*fptr)(Block *)> void attach_begin_hook(T *optr) { begin_hook= Callback<void(Block *)>::bind<T, fptr>(optr); }
 
     void append_gcode(Gcode *);
+    // runs the action when the next block queued starts, without waiting for the queue to empty
+    void append_action(BlockAction action, void *arg, float value);
     void queue_head_block(void);
 
     void dump_queue(void);
     void flush_queue(void);
+    // stops the motors and empties the queue at once, for a halt
+    void halt_motion(void);
+    // stops at the end of the first line the machine can still stop at, tag is the source tag of what was dropped after it
+    bool truncate_queue(uint32_t &tag);
     bool is_flushing() const { return flush; }
+    bool is_halted() const { return halted; }
+
+    // number of times a producer had to wait for room in the queue, and the total idle calls spent waiting
+    unsigned int get_full_stalls() const { return full_stalls; }
+    unsigned int get_full_stall_idles() const { return full_stall_idles; }
+    void reset_stall_stats();
+    // how many times each gcode had to wait for the queue to empty since the stats were reset
+    bool has_drains() const { return !drains.empty(); }
+    void print_drains(StreamOutput *stream) const;
+    // seconds of motion, from the block trapezoids, the blocks finished so far and the ones waiting to run
+    float get_executed_seconds() const { return executed_seconds; }
+    float get_queued_seconds();
+
+    // blocks queued from now on carry the tag, the player sets it to the file offset of the line it is sending
+    void set_source_tag(uint32_t tag) { source_tag= tag; }
+    uint32_t get_source_tag() const { return source_tag; }
+    // the tag of the last block to finish
+    uint32_t get_executed_tag() const { return executed_tag; }
+
+    // times the queue ran dry and was restarted soon after, so the machine stopped for want of gcode
+    bool has_underruns() const { return underruns > 0; }
+    void print_underruns(StreamOutput *stream) const;
+    unsigned int get_queue_size() const { return queue.size(); }
+
+    // in a dry run blocks are dropped as if they had run instead of being stepped, the oldest when there is no room for
+    // another so the planner has a full queue to work through as it would on a long job
+    void set_dry_run(bool on);
+    struct DryRunStats {
+        unsigned int blocks;
+        float seconds;              // of their trapezoids
+        unsigned int starved;       // blocks the machine would have run out of moves before, with planning going at the average rate
+        unsigned int sections;      // runs of starved blocks
+        uint32_t section_tags[8];   // source tags of the first block of the first few runs
+        float level;                // seconds of motion the machine would have had in hand
+        uint32_t start_us;
+    };
+    const DryRunStats& get_dry_run_stats() const { return dry_stats; }
 
     friend class Planner; // for queue
+    friend class BoardSync; // for queue, a slave queues the blocks it is sent without planning them
 
 private:
-    typedef HeapRing<Block> Queue_t;
+    typedef SpscRing<Block> Queue_t;
+    void execute_deferred();
+    bool resize_queue(unsigned int size);
+    void count_dry_block(const Block *block);
 
     Queue_t queue;  // Queue of Blocks
-    volatile unsigned int gc_pending;
+    unsigned int gc_max_per_idle; // maximum blocks to clean per on_idle, 0 for all of them
+    unsigned int full_stalls;
+    unsigned int full_stall_idles;
 
+    struct Drain {
+        uint32_t gcode; // as GcodeDispatch::get_dispatching()
+        unsigned int count;
+    };
+    std::vector<Drain> drains;
+
+    volatile float executed_seconds;
+    uint32_t source_tag;
+    volatile uint32_t executed_tag;
+
+    unsigned int underruns;
+    uint64_t dry_us;            // total time stopped in underruns
+    uint32_t dry_since;         // us_ticker_read when the queue ran dry
+    unsigned int low_marks;     // times the queue fell below low_watermark with blocks still left
+    unsigned int min_queued;    // fewest blocks left while the queue was running
+    unsigned int low_watermark;
+
+    unsigned int halts;
+    uint32_t halt_stop_us;      // from the last halt beginning to no more steps going out
+    uint32_t halt_reset_us;     // and to the queue being empty
+
+    MemoryPlacement queue_memory;
+    uint32_t lookahead_us;      // 0 to fill the queue by block count only
+    uint32_t queued_us;         // nominal time of the blocks queued and not yet cleaned, only touched by the main loop
+    DryRunStats dry_stats;
+    Callback<void(Block *)> begin_hook;
+
+    // written by the step interrupt as well as the main loop, so each is a byte of its own rather than a bit that
+    // shares a word, whose read-modify-write could put back a flag the other one had just changed
+    volatile bool running;
+    volatile bool flush;
+    volatile bool halted;
+    volatile bool dry;              // ran dry, dry_since is valid
+    volatile bool below_low;
+    volatile bool start_pending;    // start_next_block() was called with a block running or none queued
+
+    // only the main loop touches these
     struct {
-        volatile bool running:1;
-        volatile bool flush:1;
-        volatile bool halted:1;
+        bool dry_run:1;
+        bool dry_starving:1;        // the last block of the dry run was starved
+        bool external_start:1;
     };
 
 };
@@ -0,0 +1,116 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "InputShaper.h"
+
+#include <math.h>
+#include <string.h>
+#include <strings.h>
+
+InputShaper::InputShaper()
+{
+    this->head= 0;
+    this->impulses= 1;
+    this->amplitude[0]= 1.0F;
+    this->delay[0]= 0;
+    this->type= NONE;
+    this->frequency= 0.0F;
+    this->damping= 0.0F;
+    reset(0.0F);
+}
+
+bool InputShaper::configure(TYPE type, float frequency, float damping, float ticks_per_second)
+{
+    this->type= NONE;
+    this->impulses= 1;
+    this->amplitude[0]= 1.0F;
+    this->delay[0]= 0;
+    if(type == NONE) return true;
+    if(frequency <= 0.0F || damping < 0.0F || damping >= 1.0F) return false;
+
+    // the period of the damped resonance, and how much each half cycle of it dies down by
+    float df= sqrtf(1.0F - damping * damping);
+    float td= 1.0F / (frequency * df);
+    float a[3], t[3];
+    int n;
+    switch(type) {
+        case ZV: {
+            float k= expf(-damping * (float)M_PI / df);
+            a[0]= 1.0F; a[1]= k;
+            t[0]= 0.0F; t[1]= 0.5F * td;
+            n= 2;
+            break;
+        }
+        case MZV: {
+            float k= expf(-0.75F * damping * (float)M_PI / df);
+            float a1= 1.0F - 1.0F / sqrtf(2.0F);
+            a[0]= a1; a[1]= (sqrtf(2.0F) - 1.0F) * k; a[2]= a1 * k * k;
+            t[0]= 0.0F; t[1]= 0.375F * td; t[2]= 0.75F * td;
+            n= 3;
+            break;
+        }
+        case EI: {
+            // tolerates the resonance being 5% off
+            const float vtol= 0.05F;
+            float k= expf(-damping * (float)M_PI / df);
+            a[0]= 0.25F * (1.0F + vtol); a[1]= 0.5F * (1.0F - vtol) * k; a[2]= a[0] * k * k;
+            t[0]= 0.0F; t[1]= 0.5F * td; t[2]= td;
+            n= 3;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    if(lroundf(t[n - 1] * ticks_per_second) >= (long)history_size) return false;
+
+    float sum= 0.0F;
+    for (int i = 0; i < n; ++i) sum += a[i];
+    for (int i = 0; i < n; ++i) {
+        this->amplitude[i]= a[i] / sum;
+        this->delay[i]= lroundf(t[i] * ticks_per_second);
+    }
+    this->impulses= n;
+    this->type= type;
+    this->frequency= frequency;
+    this->damping= damping;
+    return true;
+}
+
+void InputShaper::reset(float speed)
+{
+    for (unsigned int i = 0; i < history_size; ++i) this->history[i]= speed;
+}
+
+float InputShaper::shape(float speed)
+{
+    this->head= (this->head + 1) % history_size;
+    this->history[this->head]= speed;
+
+    float shaped= 0.0F;
+    for (int i = 0; i < this->impulses; ++i)
+        shaped += this->amplitude[i] * this->history[(this->head + history_size - this->delay[i]) % history_size];
+    return shaped;
+}
+
+const char *InputShaper::type_name(TYPE type)
+{
+    switch(type) {
+        case ZV: return "zv";
+        case MZV: return "mzv";
+        case EI: return "ei";
+        default: return "none";
+    }
+}
+
+InputShaper::TYPE InputShaper::type_from_name(const char *name)
+{
+    if(strcasecmp(name, "zv") == 0) return ZV;
+    if(strcasecmp(name, "mzv") == 0) return MZV;
+    if(strcasecmp(name, "ei") == 0) return EI;
+    return NONE;
+}
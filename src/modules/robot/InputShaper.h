@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef INPUTSHAPER_H
+#define INPUTSHAPER_H
+
+#include <stdint.h>
+
+/*
+ * Convolves a speed, sampled once per acceleration tick, with two or three impulses that cancel the ringing of a
+ * resonance at the given frequency and damping ratio. The impulses add up to one so the distance moved is kept,
+ * the motion just ends up spread over the time of the last impulse.
+ */
+class InputShaper {
+    public:
+        enum TYPE { NONE, ZV, MZV, EI };
+        static const unsigned int history_size= 128;
+
+        InputShaper();
+
+        // false if the impulses would be further apart than the history kept at this tick rate, the shaper is left off
+        bool configure(TYPE type, float frequency, float damping, float ticks_per_second);
+        bool is_enabled() const { return impulses > 1; }
+        TYPE get_type() const { return type; }
+        float get_frequency() const { return frequency; }
+        float get_damping() const { return damping; }
+
+        // forget what has gone before, as if it had been running at speed forever
+        void reset(float speed);
+        // adds this tick's speed and returns the shaped one
+        float shape(float speed);
+
+        static const char *type_name(TYPE type);
+        // NONE for anything it doesn't know
+        static TYPE type_from_name(const char *name);
+
+    private:
+        float history[history_size];
+        unsigned int head;
+        float amplitude[3];
+        uint16_t delay[3];              // in acceleration ticks
+        uint8_t impulses;
+        TYPE type;
+        float frequency;
+        float damping;
+};
+
+#endif
@@ -23,15 +23,37 @@ using namespace std;
 #include "Robot.h"
 #include "Stepper.h"
 #include "ConfigValue.h"
+#include "EventTrace.h"
 
 #include <math.h>
+#include "LPC17xx.h"
+
+#ifdef BENCHMARK
+// the DWT is not in the CMSIS header we use, Benchmark turns the counter on
+#define DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004)
+#endif
 
 #define acceleration_checksum          CHECKSUM("acceleration")
 #define z_acceleration_checksum        CHECKSUM("z_acceleration")
 #define max_jerk_checksum              CHECKSUM("max_jerk")
 #define junction_deviation_checksum    CHECKSUM("junction_deviation")
 #define z_junction_deviation_checksum  CHECKSUM("z_junction_deviation")
+#define travel_acceleration_checksum   CHECKSUM("travel_acceleration")
+#define travel_junction_deviation_checksum CHECKSUM("travel_junction_deviation")
 #define minimum_planner_speed_checksum CHECKSUM("minimum_planner_speed")
+#define s_curve_acceleration_checksum  CHECKSUM("s_curve_acceleration")
+#define alpha_acceleration_checksum    CHECKSUM("alpha_acceleration")
+#define beta_acceleration_checksum     CHECKSUM("beta_acceleration")
+#define gamma_acceleration_checksum    CHECKSUM("gamma_acceleration")
+#define alpha_max_jerk_checksum        CHECKSUM("alpha_max_jerk")
+#define beta_max_jerk_checksum         CHECKSUM("beta_max_jerk")
+#define gamma_max_jerk_checksum        CHECKSUM("gamma_max_jerk")
+#define slowdown_blocks_checksum       CHECKSUM("planner_slowdown_blocks")
+#define minimum_segment_time_checksum  CHECKSUM("minimum_segment_time")
+#define alpha_backlash_checksum        CHECKSUM("alpha_backlash")
+#define beta_backlash_checksum         CHECKSUM("beta_backlash")
+#define gamma_backlash_checksum        CHECKSUM("gamma_backlash")
+#define backlash_distance_checksum     CHECKSUM("backlash_distance")
 
 // The Planner does the acceleration math for the queue of Blocks ( movements ).
 // It makes sure the speed stays within the configured constraints ( acceleration, junction_deviation, etc )
@@ -39,6 +61,20 @@ using namespace std;
 
 Planner::Planner(){
     clear_vector_float(this->previous_unit_vec);
+    clear_vector_float(this->previous_actuator_unit_vec);
+    this->speed_factor= 1.0F;
+    this->next_entry_limit= -1.0F;
+    this->planned_i= 0;
+    this->deferred_i= 0;
+    this->batch_depth= 0;
+    this->deferred= false;
+    this->last_recalculate_count= 0;
+    this->max_recalculate_count= 0;
+    this->slowdown_count= 0;
+#ifdef BENCHMARK
+    reset_plan_cycles();
+#endif
+    clear_vector(this->backlash_direction);
     config_load();
 }
 
@@ -49,21 +85,85 @@ void Planner::config_load(){
 
     this->junction_deviation = THEKERNEL->config->value(junction_deviation_checksum)->by_default(0.05F)->as_number();
     this->z_junction_deviation = THEKERNEL->config->value(z_junction_deviation_checksum)->by_default(-1)->as_number(); // disabled by default
+    // for G0, 0 and -1 (the defaults) use the ones above
+    this->travel_acceleration = THEKERNEL->config->value(travel_acceleration_checksum)->by_default(0.0F )->as_number();
+    this->travel_junction_deviation = THEKERNEL->config->value(travel_junction_deviation_checksum)->by_default(-1)->as_number();
     this->minimum_planner_speed = THEKERNEL->config->value(minimum_planner_speed_checksum)->by_default(0.0f)->as_number();
+    this->s_curve_acceleration = THEKERNEL->config->value(s_curve_acceleration_checksum)->by_default(false)->as_bool();
+
+    // per actuator limits in actuator mm, zero (the default) leaves that actuator limited only by the move settings above
+    this->actuator_acceleration[ALPHA_STEPPER] = THEKERNEL->config->value(alpha_acceleration_checksum)->by_default(0.0F)->as_number();
+    this->actuator_acceleration[BETA_STEPPER ] = THEKERNEL->config->value(beta_acceleration_checksum )->by_default(0.0F)->as_number();
+    this->actuator_acceleration[GAMMA_STEPPER] = THEKERNEL->config->value(gamma_acceleration_checksum)->by_default(0.0F)->as_number();
+    this->actuator_max_jerk[ALPHA_STEPPER] = THEKERNEL->config->value(alpha_max_jerk_checksum)->by_default(0.0F)->as_number();
+    this->actuator_max_jerk[BETA_STEPPER ] = THEKERNEL->config->value(beta_max_jerk_checksum )->by_default(0.0F)->as_number();
+    this->actuator_max_jerk[GAMMA_STEPPER] = THEKERNEL->config->value(gamma_max_jerk_checksum)->by_default(0.0F)->as_number();
+
+    // short blocks are slowed down while fewer than this many are queued, 0 (the default) is off
+    this->slowdown_blocks = THEKERNEL->config->value(slowdown_blocks_checksum)->by_default(0)->as_number();
+    this->minimum_segment_time = THEKERNEL->config->value(minimum_segment_time_checksum)->by_default(20.0F)->as_number() / 1000.0F; // ms in the config
+
+    // backlash in actuator mm, taken up over the first backlash_distance mm of a move that turns the actuator round
+    this->backlash[ALPHA_STEPPER] = THEKERNEL->config->value(alpha_backlash_checksum)->by_default(0.0F)->as_number();
+    this->backlash[BETA_STEPPER ] = THEKERNEL->config->value(beta_backlash_checksum )->by_default(0.0F)->as_number();
+    this->backlash[GAMMA_STEPPER] = THEKERNEL->config->value(gamma_backlash_checksum)->by_default(0.0F)->as_number();
+    this->backlash_distance = THEKERNEL->config->value(backlash_distance_checksum)->by_default(1.0F)->as_number();
+}
+
+// true if the move to actuator_pos turns an actuator with backlash round
+bool Planner::reverses_backlash(const float actuator_pos[]) const
+{
+    for (int i = 0; i < 3; i++) {
+        if (this->backlash[i] <= 0.0F || this->backlash_direction[i] == 0) continue;
+        int steps = THEKERNEL->robot->actuators[i]->steps_to_target(actuator_pos[i]);
+        if (steps != 0 && (steps < 0 ? -1 : 1) != this->backlash_direction[i]) return true;
+    }
+    return false;
+}
+
+// the steps a block took up backlash with show whether it turned the actuator round
+void Planner::revert_backlash(const Block *block, bool reverted[3])
+{
+    for (int i = 0; i < 3; i++) {
+        if (reverted[i] || this->backlash[i] <= 0.0F || block->steps[i] == 0) continue;
+        int8_t direction = block->direction_bits[i] ? -1 : 1;
+        this->backlash_direction[i] = block->backlash_steps[i] > 0 ? -direction : direction;
+        reverted[i] = true;
+    }
 }
 
 
 // Append a block to the queue, compute it's speed factors
-void Planner::append_block( float actuator_pos[], float rate_mm_s, float distance, float unit_vec[] )
+void Planner::append_block( float actuator_pos[], float rate_mm_s, float max_rate_mm_s, float distance, float unit_vec[], float spindle_pitch, bool travel )
 {
     float acceleration, junction_deviation;
+    float actuator_unit_vec[MAX_ROBOT_ACTUATORS]; // actuator mm moved per mm of travel
+    const unsigned int n_actuators = THEKERNEL->robot->actuators.size();
+
+    // A move that turns an actuator with backlash round has the first backlash_distance of it as a block of its own,
+    // which has the extra steps, so the backlash is taken up at the start rather than over the whole move. It goes
+    // the same way as the rest, so the junction between them doesn't slow it down
+    if (distance > this->backlash_distance && this->backlash_distance > 0.0F && reverses_backlash(actuator_pos)) {
+        float f = this->backlash_distance / distance;
+        float first[MAX_ROBOT_ACTUATORS];
+        for (unsigned int i = 0; i < n_actuators; i++) {
+            float from = THEKERNEL->robot->actuators[i]->last_milestone_mm;
+            first[i] = from + (actuator_pos[i] - from) * f;
+        }
+        append_block(first, rate_mm_s, max_rate_mm_s, this->backlash_distance, unit_vec, spindle_pitch, travel);
+        distance -= this->backlash_distance;
+    }
+
+#ifdef BENCHMARK
+    uint32_t start_cycles = DWT_CYCCNT;
+#endif
 
     // Create ( recycle ) a new block
     Block* block = THEKERNEL->conveyor->queue.head_ref();
 
 
     // Direction bits
-    for (int i = 0; i < 3; i++)
+    for (unsigned int i = 0; i < n_actuators; i++)
     {
         int steps = THEKERNEL->robot->actuators[i]->steps_to_target(actuator_pos[i]);
 
@@ -74,30 +174,80 @@ void Planner::append_block( float actuator_pos[], float rate_mm_s, float distanc
         THEKERNEL->robot->actuators[i]->last_milestone_mm = actuator_pos[i];
 
         block->steps[i] = labs(steps);
+
+        // the actuator has turned round, the steps it needs to take up the backlash are added to the ones it moves
+        if (i < 3 && steps != 0 && this->backlash[i] > 0.0F) {
+            int8_t direction = steps < 0 ? -1 : 1;
+            if (this->backlash_direction[i] != 0 && direction != this->backlash_direction[i]) {
+                block->backlash_steps[i] = lroundf(this->backlash[i] * THEKERNEL->robot->actuators[i]->get_steps_per_mm());
+                block->steps[i] += block->backlash_steps[i];
+            }
+            this->backlash_direction[i] = direction;
+        }
+
+        actuator_unit_vec[i] = distance > 0.0F ? steps / (THEKERNEL->robot->actuators[i]->get_steps_per_mm() * distance) : 0.0F;
     }
 
     acceleration= this->acceleration;
     junction_deviation= this->junction_deviation;
 
+    // a G0 can go harder than the moves that cut or extrude
+    if(travel) {
+        if(this->travel_acceleration > 0.0F) acceleration= this->travel_acceleration;
+        if(this->travel_junction_deviation >= 0.0F) junction_deviation= this->travel_junction_deviation;
+    }
+
     // use either regular acceleration or a z only move accleration
-    if(block->steps[ALPHA_STEPPER] == 0 && block->steps[BETA_STEPPER] == 0) {
+    if(block->steps[ALPHA_STEPPER] == 0 && block->steps[BETA_STEPPER] == 0 && block->steps[GAMMA_STEPPER] > 0) {
         // z only move
         if(this->z_acceleration > 0.0F) acceleration= this->z_acceleration;
         if(this->z_junction_deviation >= 0.0F) junction_deviation= this->z_junction_deviation;
     }
 
+    // the move acceleration is limited so that no actuator exceeds its own acceleration,
+    // any actuator barely involved in the move does not hold back the others
+    for (int i = 0; i < 3; i++) {
+        float a = fabsf(actuator_unit_vec[i]);
+        if (this->actuator_acceleration[i] > 0.0F && a * acceleration > this->actuator_acceleration[i])
+            acceleration = this->actuator_acceleration[i] / a;
+    }
+
+    // the S-curve peaks at 1.5 times its average acceleration, so plan with the average that keeps the peak at the setting
+    if(this->s_curve_acceleration) {
+        acceleration *= (2.0F / 3.0F);
+        block->s_curve= true;
+    }
+
     block->acceleration= acceleration; // save in block
+    block->spindle_pitch= spindle_pitch;
+    block->travel= travel;
+    block->programmed_speed= rate_mm_s;
+    block->max_speed= max_rate_mm_s;
+
+    // as Marlin does, when the queue is running low a short block is made to last longer, the more so the fewer are left,
+    // so the gcode has time to catch up and the machine keeps moving slower instead of stopping for it. This goes in as a
+    // limit on the block's speed, so an override change that replans it keeps it slowed down
+    unsigned int queued = THEKERNEL->conveyor->queued_blocks();
+    if(distance > 0.0F && spindle_pitch == 0.0F && queued > 1 && queued < this->slowdown_blocks) {
+        float seconds = distance / override_speed(block);
+        if(seconds < this->minimum_segment_time) {
+            seconds += 2.0F * (this->minimum_segment_time - seconds) / queued;
+            block->max_speed = distance / seconds;
+            this->slowdown_count++;
+        }
+    }
 
-    // Max number of steps, for all axes
-    block->steps_event_count = max( block->steps[ALPHA_STEPPER], max( block->steps[BETA_STEPPER], block->steps[GAMMA_STEPPER] ) );
+    // Max number of steps, for all axes, and each actuator's share of the step rate, so the Stepper does not divide
+    // for it when the block begins
+    block->calculate_step_ratios(n_actuators);
 
     block->millimeters = distance;
 
     // Calculate speed in mm/sec for each axis. No divide by zero due to previous checks.
     // NOTE: Minimum stepper speed is limited by MINIMUM_STEPS_PER_MINUTE in stepper.c
     if( distance > 0.0F ){
-        block->nominal_speed = rate_mm_s;           // (mm/s) Always > 0
-        block->nominal_rate = ceilf(block->steps_event_count * rate_mm_s / distance); // (step/s) Always > 0
+        block->nominal_speed = override_speed(block); // (mm/s) Always > 0
+        block->nominal_rate = ceilf(block->steps_event_count * block->nominal_speed / distance); // (step/s) Always > 0
     }else{
         block->nominal_speed = 0.0F;
         block->nominal_rate  = 0;
@@ -111,6 +261,9 @@ void Planner::append_block( float actuator_pos[], float rate_mm_s, float distanc
     // specifically for each line to compensate for this phenomenon:
     // Convert universal acceleration for direction-dependent stepper rate change parameter
     block->rate_delta = (block->steps_event_count * acceleration) / (distance * THEKERNEL->acceleration_ticks_per_second); // (step/min/acceleration_tick)
+#ifdef FIXED_POINT_STEPPING
+    block->fixed_rate_delta = StepperMotor::to_fixed_rate(block->rate_delta);
+#endif
 
     // Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
     // Let a circle be tangent to both previous and current path line segments, where the junction
@@ -124,13 +277,18 @@ void Planner::append_block( float actuator_pos[], float rate_mm_s, float distanc
 
     // NOTE however it does not take into account independent axis, in most cartesian X and Y and Z are totally independent
     // and this allows one to stop with little to no decleration in many cases. This is particualrly bad on leadscrew based systems that will skip steps.
+    // So when per actuator max_jerk is set the junction speed is further limited so the velocity change of each actuator across
+    // the junction stays within its own jerk, see below.
     float vmax_junction = minimum_planner_speed; // Set default max junction speed
+    float junction_speed = minimum_planner_speed; // the same limit before the nominal speeds are taken into account
 
     if (!THEKERNEL->conveyor->is_queue_empty())
     {
-        float previous_nominal_speed = THEKERNEL->conveyor->queue.item_ref(THEKERNEL->conveyor->queue.prev(THEKERNEL->conveyor->queue.head_i))->nominal_speed;
+        const Block *previous = THEKERNEL->conveyor->queue.item_ref(THEKERNEL->conveyor->queue.prev(THEKERNEL->conveyor->queue.get_head_i()));
+        float previous_nominal_speed = previous->nominal_speed;
 
-        if (previous_nominal_speed > 0.0F && junction_deviation > 0.0F) {
+        // the speed of a spindle synchronized move is set by the spindle, not planned, so it starts and ends at the minimum
+        if (previous_nominal_speed > 0.0F && junction_deviation > 0.0F && spindle_pitch == 0.0F && previous->spindle_pitch == 0.0F) {
             // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
             // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
             float cos_theta = - this->previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
@@ -139,17 +297,32 @@ void Planner::append_block( float actuator_pos[], float rate_mm_s, float distanc
 
             // Skip and use default max junction speed for 0 degree acute junction.
             if (cos_theta < 0.95F) {
-                vmax_junction = min(previous_nominal_speed, block->nominal_speed);
+                junction_speed = 1e30F;
                 // Skip and avoid divide by zero for straight junctions at 180 degrees. Limit to min() of nominal speeds.
                 if (cos_theta > -0.95F) {
                     // Compute maximum junction velocity based on maximum acceleration and junction deviation
                     float sin_theta_d2 = sqrtf(0.5F * (1.0F - cos_theta)); // Trig half angle identity. Always positive.
-                    vmax_junction = min(vmax_junction, sqrtf(acceleration * junction_deviation * sin_theta_d2 / (1.0F - sin_theta_d2)));
+                    junction_speed = sqrtf(acceleration * junction_deviation * sin_theta_d2 / (1.0F - sin_theta_d2));
+                }
+
+                // an actuator changes velocity by v * (current - previous) across the junction
+                for (int i = 0; i < 3; i++) {
+                    if (this->actuator_max_jerk[i] <= 0.0F) continue;
+                    float dv = fabsf(actuator_unit_vec[i] - this->previous_actuator_unit_vec[i]);
+                    if (dv * junction_speed > this->actuator_max_jerk[i])
+                        junction_speed = this->actuator_max_jerk[i] / dv;
                 }
+                vmax_junction = max(min(junction_speed, min(previous_nominal_speed, block->nominal_speed)), minimum_planner_speed);
             }
         }
     }
+    if (next_entry_limit >= 0.0F) {
+        junction_speed = min(junction_speed, next_entry_limit);
+        vmax_junction = max(min(vmax_junction, next_entry_limit), minimum_planner_speed);
+        next_entry_limit = -1.0F;
+    }
     block->max_entry_speed = vmax_junction;
+    block->junction_speed = junction_speed;
 
     // Initialize block entry speed. Compute based on deceleration to user-defined minimum_planner_speed.
     float v_allowable = max_allowable_speed(-acceleration, minimum_planner_speed, block->millimeters);
@@ -171,9 +344,35 @@ void Planner::append_block( float actuator_pos[], float rate_mm_s, float distanc
 
     // Update previous path unit_vector and nominal speed
     memcpy(this->previous_unit_vec, unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
+    memcpy(this->previous_actuator_unit_vec, actuator_unit_vec, sizeof(previous_actuator_unit_vec));
 
-    // Math-heavy re-computing of the whole queue to take the new
-    this->recalculate();
+    // Math-heavy re-computing of the whole queue to take the new block into account, left for end_batch to do once
+    // for all the blocks of a batch when it can be
+    Conveyor::Queue_t &queue = THEKERNEL->conveyor->queue;
+#ifdef BENCHMARK
+    uint32_t recalculate_cycles = DWT_CYCCNT;
+#endif
+    if (defer_recalculate()) {
+        // until then it stops at its end like the newest block, so it can run as it is if it has to
+        block->calculate_trapezoid(minimum_planner_speed, minimum_planner_speed);
+        if (!this->deferred) {
+            this->deferred_i = queue.get_head_i();
+            this->deferred = true;
+        }
+    } else {
+        this->recalculate(queue.get_head_i());
+        this->deferred = false;
+    }
+#ifdef BENCHMARK
+    uint32_t end_cycles = DWT_CYCCNT;
+    recalculate_cycles = end_cycles - recalculate_cycles;
+    start_cycles = end_cycles - start_cycles;
+    plan_cycles.blocks++;
+    plan_cycles.total += start_cycles;
+    if (start_cycles > plan_cycles.max) plan_cycles.max = start_cycles;
+    plan_cycles.recalculate_total += recalculate_cycles;
+    if (recalculate_cycles > plan_cycles.recalculate_max) plan_cycles.recalculate_max = recalculate_cycles;
+#endif
 
     // The block can now be used
     block->ready();
@@ -181,7 +380,41 @@ void Planner::append_block( float actuator_pos[], float rate_mm_s, float distanc
     THEKERNEL->conveyor->queue_head_block();
 }
 
-void Planner::recalculate() {
+// a block of a batch is left unplanned while the stepper has at least low_watermark blocks to run before it gets to
+// the first of them, and while queueing it will not have to wait for room, as the stepper would run them meanwhile
+bool Planner::defer_recalculate() const
+{
+    if (batch_depth == 0 || THEKERNEL->conveyor->is_queue_full()) return false;
+
+    const Conveyor::Queue_t &queue = THEKERNEL->conveyor->queue;
+    unsigned int first_i = deferred ? deferred_i : queue.get_head_i();
+    unsigned int ahead = (first_i + queue.size() - queue.get_isr_tail_i()) % queue.size();
+    // more than are queued if the stepper has already got past it
+    return ahead >= max(THEKERNEL->conveyor->get_low_watermark(), 2U) && ahead <= queue.isr_queued();
+}
+
+void Planner::end_batch()
+{
+    if (batch_depth == 0 || --batch_depth > 0 || !deferred) return;
+    deferred = false;
+
+    // the newest block is queued already, there is nothing to plan if the stepper has run them all
+    Conveyor::Queue_t &queue = THEKERNEL->conveyor->queue;
+    if (queue.isr_is_empty()) return;
+#ifdef BENCHMARK
+    uint32_t cycles = DWT_CYCCNT;
+#endif
+    recalculate(queue.prev(queue.get_head_i()));
+#ifdef BENCHMARK
+    cycles = DWT_CYCCNT - cycles;
+    plan_cycles.total += cycles;
+    plan_cycles.recalculate_total += cycles;
+    if (cycles > plan_cycles.recalculate_max) plan_cycles.recalculate_max = cycles;
+#endif
+}
+
+// plans the queue up to the block at newest_i, which is the one being appended unless a batch was deferred
+void Planner::recalculate(unsigned int newest_i) {
     Conveyor::Queue_t &queue = THEKERNEL->conveyor->queue;
 
     unsigned int block_index;
@@ -221,18 +454,31 @@ void Planner::recalculate() {
      */
 
     float entry_speed = minimum_planner_speed;
+    unsigned int touched = 1; // the new block always gets its trapezoid calculated
 
-    block_index = queue.head_i;
+    // only the main loop moves head and tail, so they cannot change under us
+    const unsigned int head_i = newest_i;
+    const unsigned int tail_i = queue.get_tail_i();
+    const unsigned int length = queue.size();
+
+    block_index = head_i;
     current     = queue.item_ref(block_index);
 
+    // the planned block may have been consumed, or the queue resized, since we last looked at it
+    // it is only valid if it lies between tail and the new head block
+    if (planned_i >= length ||
+        ((planned_i + length - tail_i) % length) >= ((head_i + length - tail_i) % length))
+        planned_i = tail_i;
+
     if (!queue.is_empty())
     {
-        while ((block_index != queue.tail_i) && current->recalculate_flag)
+        while ((block_index != tail_i) && (block_index != planned_i) && current->recalculate_flag)
         {
             entry_speed = current->reverse_pass(entry_speed);
 
             block_index = queue.prev(block_index);
             current     = queue.item_ref(block_index);
+            touched++;
         }
 
         /*
@@ -246,7 +492,7 @@ void Planner::recalculate() {
 
         float exit_speed = current->max_exit_speed();
 
-        while (block_index != queue.head_i)
+        while (block_index != head_i)
         {
             previous    = current;
             block_index = queue.next(block_index);
@@ -257,9 +503,18 @@ void Planner::recalculate() {
             exit_speed = current->forward_pass(exit_speed);
 
             previous->calculate_trapezoid(previous->entry_speed, current->entry_speed);
+
+            // if this block is accel limited or already enters at its maximum then nothing after it can speed it up,
+            // so it and everything before it is optimally planned (as grbl does with block_buffer_planned)
+            if (block_index != head_i && (!current->recalculate_flag || current->entry_speed == current->max_entry_speed))
+                planned_i = block_index;
         }
     }
 
+    last_recalculate_count = touched;
+    TRACE_EVENT(RECALCULATE, touched);
+    if (touched > max_recalculate_count) max_recalculate_count = touched;
+
     /*
      * Step 3:
      * work out trapezoid for final (and newest) block
@@ -271,6 +526,124 @@ void Planner::recalculate() {
 }
 
 
+// the nominal speed of a block under the speed override, a spindle synchronized move follows the spindle whatever the override
+float Planner::override_speed(const Block *block) const
+{
+    float v = block->spindle_pitch > 0.0F ? block->programmed_speed : block->programmed_speed * this->speed_factor;
+    if (block->max_speed > 0.0F && v > block->max_speed) v = block->max_speed;
+    return v;
+}
+
+// An override change has to be felt straight away, not once the blocks already queued have run, so as grbl does for its
+// realtime overrides the queued blocks get new nominal speeds and are planned again, and the Stepper replans what is left
+// of the running one. The running block keeps its exit speed, so the first queued block still starts where it was planned
+// to, and when the override is lowered the speed comes down from there at the acceleration, over as many blocks as it takes
+void Planner::set_speed_factor(float factor)
+{
+    this->speed_factor = factor;
+    replan_queue();
+}
+
+void Planner::replan_queue()
+{
+    // if the running block finishes while we work it out, do it again from the next one
+    for (int tries = 0; tries < 4 && !replan(); ++tries) ;
+}
+
+bool Planner::replan()
+{
+    Conveyor::Queue_t &queue = THEKERNEL->conveyor->queue;
+    const unsigned int head_i = queue.get_head_i();
+
+    __disable_irq();
+    unsigned int first_i = queue.get_isr_tail_i();
+    Block *running = nullptr;
+    if (first_i != head_i && queue.item_ref(first_i)->times_taken != 0) {
+        running = queue.item_ref(first_i);
+        first_i = queue.next(first_i);
+    }
+    // a board_sync slave runs the blocks it has been sent as they were sent, so they are kept as if they were running
+    while (first_i != head_i && queue.item_ref(first_i)->locked) {
+        running = queue.item_ref(first_i);
+        first_i = queue.next(first_i);
+    }
+    __enable_irq();
+
+    if (running != nullptr && !running->locked && running->millimeters > 0.0F) {
+        float v = override_speed(running);
+        if (THEKERNEL->stepper->retarget_current_block(running, ceilf(running->steps_event_count * v / running->millimeters)))
+            running->nominal_speed = max(v, running->exit_speed);
+    }
+    if (first_i == head_i) return true;
+
+    // new nominal speeds and the entry limits that follow from them, none of which the stepper reads
+    const Block *previous = running;
+    for (unsigned int i = first_i; i != head_i; i = queue.next(i)) {
+        Block *block = queue.item_ref(i);
+        if (block->millimeters <= 0.0F) {
+            previous = nullptr;
+            continue;
+        }
+        block->nominal_speed = override_speed(block);
+        if (previous != nullptr)
+            block->max_entry_speed = max(min(block->junction_speed, min(previous->nominal_speed, block->nominal_speed)), minimum_planner_speed);
+        block->nominal_length_flag = block->nominal_speed <= max_allowable_speed(-block->acceleration, minimum_planner_speed, block->millimeters);
+        block->recalculate_flag = true;
+        block->entry_speed = -1.0F; // so the reverse pass works it out again
+        previous = block;
+    }
+
+    // the fastest each block can enter and still stop by the end of the queue
+    float entry_speed = minimum_planner_speed;
+    for (unsigned int i = queue.prev(head_i); ; i = queue.prev(i)) {
+        Block *block = queue.item_ref(i);
+        if (block->millimeters > 0.0F) entry_speed = block->reverse_pass(entry_speed);
+        else entry_speed = 0.0F;
+        if (i == first_i) break;
+    }
+
+    // then forwards from the speed the running block leaves at, a block may not enter faster than the one before can get
+    // to, nor slower than it can slow down to, in which case it keeps that entry speed as its nominal speed
+    float max_exit = running != nullptr ? running->exit_speed : queue.item_ref(first_i)->entry_speed;
+    float min_entry = running != nullptr ? running->exit_speed : 0.0F;
+    for (unsigned int i = first_i; i != head_i; i = queue.next(i)) {
+        Block *block = queue.item_ref(i);
+        if (block->millimeters <= 0.0F) {
+            max_exit = min_entry = 0.0F;
+            continue;
+        }
+        float e = max(min(block->entry_speed, max_exit), min_entry);
+        if (block->nominal_speed < e) block->nominal_speed = e;
+        block->entry_speed = e;
+        float a2d = 2.0F * block->acceleration * block->millimeters;
+        min_entry = e * e > a2d ? sqrtf(e * e - a2d) : 0.0F;
+        max_exit = min(block->nominal_speed, sqrtf(e * e + a2d));
+    }
+
+    // the trapezoids are what the stepper does use, each is changed with interrupts off so a block never begins half changed,
+    // and not at all once it has begun
+    for (unsigned int i = first_i; i != head_i; i = queue.next(i)) {
+        Block *block = queue.item_ref(i);
+        if (block->millimeters <= 0.0F) continue;
+        unsigned int n = queue.next(i);
+        float exit_speed = n == head_i ? max(minimum_planner_speed, min_entry) : queue.item_ref(n)->entry_speed;
+        unsigned int rate = ceilf(block->steps_event_count * block->nominal_speed / block->millimeters);
+
+        __disable_irq();
+        if (!block->is_ready || block->times_taken != 0 || block->locked) {
+            __enable_irq();
+            // the first block began with its old plan, which still follows on from the block before it
+            return i != first_i;
+        }
+        block->nominal_rate = rate;
+        block->calculate_trapezoid(block->entry_speed, exit_speed);
+        __enable_irq();
+    }
+
+    this->planned_i = first_i;
+    return true;
+}
+
 // Calculates the maximum allowable speed at this point when you must be able to reach target_velocity using the
 // acceleration within the allotted distance.
 float Planner::max_allowable_speed(float acceleration, float target_velocity, float distance) {
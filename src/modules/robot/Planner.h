@@ -8,30 +8,98 @@
 #ifndef PLANNER_H
 #define PLANNER_H
 
+#include <stdint.h>
+
 class Block;
 
 class Planner
 {
 public:
     Planner();
-    void append_block( float target[], float rate_mm_s, float distance, float unit_vec[] );
+    void append_block( float target[], float rate_mm_s, float max_rate_mm_s, float distance, float unit_vec[], float spindle_pitch = 0.0F, bool travel = false );
     float max_allowable_speed( float acceleration, float target_velocity, float distance);
-    void recalculate();
+    void recalculate(unsigned int newest_i);
     Block *get_current_block();
     void cleanup_queue();
     float get_acceleration() const { return acceleration; }
     float get_z_acceleration() const { return z_acceleration > 0.0F ? z_acceleration : acceleration; }
+    float get_minimum_planner_speed() const { return minimum_planner_speed; }
+
+    // the speed override as a factor, M220 S100 is 1, it applies to the blocks already queued as well as to new ones
+    float get_speed_factor() const { return speed_factor; }
+    void set_speed_factor(float factor);
+    // plans the queued blocks again, to follow on from the exit speed the Stepper has given the running block
+    void replan_queue();
+    // a planned block is being dropped, each actuator with backlash is put back to the way it was going before the first
+    // of them to move it, reverted keeps track of the ones already done
+    void revert_backlash(const Block *block, bool reverted[3]);
+    // the next block appended enters at no more than this, for a module that moves something the planner does not know about
+    // with it, like the extruder retracting during a z lift
+    void limit_next_entry_speed(float speed) { next_entry_limit= speed; }
+    // the blocks appended between these, the segments of one line or arc, are planned together once the last is queued,
+    // as long as the stepper has enough queued before them not to get to one first
+    void begin_batch() { batch_depth++; }
+    void end_batch();
+
+    // statistics for the number of blocks touched by recalculate()
+    unsigned int get_last_recalculate_count() const { return last_recalculate_count; }
+    unsigned int get_max_recalculate_count() const { return max_recalculate_count; }
+    void reset_recalculate_stats() { max_recalculate_count= 0; }
+    // blocks slowed down because the queue was running low
+    unsigned int get_slowdown_count() const { return slowdown_count; }
+    void reset_slowdown_count() { slowdown_count= 0; }
+#ifdef BENCHMARK
+    // DWT cycles taken to plan the blocks, from append_block being given one to it being ready to queue, for M415
+    struct PlanCycles {
+        unsigned int blocks;
+        uint64_t total;
+        uint32_t max;
+        uint64_t recalculate_total;
+        uint32_t recalculate_max;
+    };
+    const PlanCycles& get_plan_cycles() const { return plan_cycles; }
+    void reset_plan_cycles() { plan_cycles= PlanCycles(); }
+#endif
 
-    friend class Robot; // for acceleration, junction deviation, minimum_planner_speed
+    friend class Robot; // for acceleration, junction deviation, minimum_planner_speed, and the backlash state in a dry run
 
 private:
     void config_load();
+    float override_speed(const Block *block) const;
+    bool replan();
+    bool reverses_backlash(const float actuator_pos[]) const;
+    bool defer_recalculate() const;
     float previous_unit_vec[3];
     float acceleration;          // Setting
     float z_acceleration;        // Setting
     float junction_deviation;    // Setting
     float z_junction_deviation;  // Setting
+    float travel_acceleration;   // Setting, for G0, 0 uses acceleration
+    float travel_junction_deviation; // Setting, for G0, -1 uses junction_deviation
     float minimum_planner_speed; // Setting
+    bool s_curve_acceleration;   // Setting
+    float actuator_acceleration[3]; // Setting, per actuator, 0 is unlimited
+    float actuator_max_jerk[3];     // Setting, per actuator max velocity change at a junction, 0 is unlimited
+    unsigned int slowdown_blocks;   // Setting
+    float minimum_segment_time;     // Setting, in seconds
+    float previous_actuator_unit_vec[3];
+    float backlash[3];              // Setting, per actuator in actuator mm, 0 is none
+    float backlash_distance;        // Setting, mm of a move that the backlash is taken up over
+    int8_t backlash_direction[3];   // the way each actuator last moved, 1 or -1, 0 before it has moved
+
+    float speed_factor;
+    float next_entry_limit;     // negative for none
+
+    unsigned int planned_i; // queue index of the newest block that can no longer be improved, reverse pass stops here
+    unsigned int deferred_i; // queue index of the oldest block of a batch not planned with the blocks before it yet
+    uint8_t batch_depth;
+    bool deferred;
+    unsigned int last_recalculate_count;
+    unsigned int max_recalculate_count;
+    unsigned int slowdown_count;
+#ifdef BENCHMARK
+    PlanCycles plan_cycles;
+#endif
 };
 
 
@@ -20,7 +20,9 @@ using std::string;
 #include "StepperMotor.h"
 #include "Gcode.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "RobotPublicAccess.h"
+#include "CompensationStrategy.h"
 #include "arm_solutions/BaseSolution.h"
 #include "arm_solutions/CartesianSolution.h"
 #include "arm_solutions/RotatableCartesianSolution.h"
@@ -33,6 +35,8 @@ using std::string;
 #include "ConfigValue.h"
 #include "libs/StreamOutput.h"
 #include "StreamOutputPool.h"
+#include "MachineStatus.h"
+#include "us_ticker_api.h"
 
 #define  default_seek_rate_checksum          CHECKSUM("default_seek_rate")
 #define  default_feed_rate_checksum          CHECKSUM("default_feed_rate")
@@ -40,6 +44,15 @@ using std::string;
 #define  delta_segments_per_second_checksum  CHECKSUM("delta_segments_per_second")
 #define  mm_per_arc_segment_checksum         CHECKSUM("mm_per_arc_segment")
 #define  arc_correction_checksum             CHECKSUM("arc_correction")
+#define  segment_tolerance_checksum          CHECKSUM("segment_tolerance")
+#define  arc_tolerance_checksum              CHECKSUM("arc_tolerance")
+#define  merge_tolerance_checksum            CHECKSUM("merge_tolerance")
+#define  merge_max_angle_checksum            CHECKSUM("merge_max_angle")
+#define  path_blend_tolerance_checksum       CHECKSUM("path_blend_tolerance")
+#define  jog_timeout_checksum                CHECKSUM("jog_timeout_ms")
+#define  skew_xy_checksum                    CHECKSUM("skew_xy")
+#define  skew_xz_checksum                    CHECKSUM("skew_xz")
+#define  skew_yz_checksum                    CHECKSUM("skew_yz")
 #define  x_axis_max_speed_checksum           CHECKSUM("x_axis_max_speed")
 #define  y_axis_max_speed_checksum           CHECKSUM("y_axis_max_speed")
 #define  z_axis_max_speed_checksum           CHECKSUM("z_axis_max_speed")
@@ -100,6 +113,7 @@ using std::string;
 #define MOTION_MODE_CW_ARC 2 // G2
 #define MOTION_MODE_CCW_ARC 3 // G3
 #define MOTION_MODE_CANCEL 4 // G80
+#define MOTION_MODE_SPLINE 5 // G5, G5.1
 
 #define PATH_CONTROL_MODE_EXACT_PATH 0
 #define PATH_CONTROL_MODE_EXACT_STOP 1
@@ -112,6 +126,22 @@ using std::string;
 #define SPINDLE_DIRECTION_CW 0
 #define SPINDLE_DIRECTION_CCW 1
 
+// ARM_SOLUTION in the makefile builds for one arm solution, the arm_solution setting is then ignored and the moves call
+// the solution through its own final type, so its kinematics inline instead of being a virtual call for every point
+#if defined(ARM_SOLUTION_CARTESIAN)
+typedef CartesianSolution FixedSolution;
+#define ARM_SOLUTION_FIXED
+#elif defined(ARM_SOLUTION_COREXY)
+typedef HBotSolution FixedSolution;
+#define ARM_SOLUTION_FIXED
+#endif
+
+#ifdef ARM_SOLUTION_FIXED
+static inline FixedSolution *kinematics(BaseSolution *solution) { return static_cast<FixedSolution *>(solution); }
+#else
+static inline BaseSolution *kinematics(BaseSolution *solution) { return solution; }
+#endif
+
 // The Robot converts GCodes into actual movements, and then adds them to the Planner, which passes them to the Conveyor so they can be added to the queue
 // It takes care of cutting arcs into segments, same thing for line that are too long
 
@@ -120,23 +150,43 @@ Robot::Robot()
     this->inch_mode = false;
     this->absolute_mode = true;
     this->motion_mode =  MOTION_MODE_SEEK;
+    this->spindle_pitch = 0.0F;
+    this->travel_move = false;
     this->select_plane(X_AXIS, Y_AXIS, Z_AXIS);
     clear_vector(this->last_milestone);
     clear_vector(this->transformed_last_milestone);
     this->arm_solution = NULL;
+    this->dry_run_state = nullptr;
     seconds_per_minute = 60.0F;
     this->clearToolOffset();
-    this->compensationTransform= nullptr;
+    this->compensation= nullptr;
+    clear_vector(this->skew);
+    this->update_affine();
     this->halted= false;
+    this->arc_count= 0;
+    this->arc_blocks= 0;
+    this->last_arc_blocks= 0;
+    this->spline_count= 0;
+    this->spline_blocks= 0;
+    this->spline_continues= false;
+    this->merge_count= 0;
+    this->merge_travel= false;
+    this->merge_tag= 0;
+    this->jogging= false;
+    this->jog_tag= 0;
+    this->jog_direction[0]= this->jog_direction[1]= this->jog_direction[2]= 0.0F;
+    this->blend_count= 0;
 }
 
 //Called when the module has just been loaded
 void Robot::on_module_loaded()
 {
-    this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    this->register_for_gcodes('G', {0, 1, 2, 3, 5, 17, 18, 19, 20, 21, 33, 61, 64, 90, 91, 92});
+    this->register_for_gcodes('M', {92, 114, 154, 203, 204, 205, 220, 235, 400, 414, 425, 500, 503, 665, 852});
+    PublicData::register_owner(robot_checksum, this);
     this->register_for_event(ON_HALT);
+    this->register_for_event(ON_SECOND_TICK);
+    this->register_for_event(ON_IDLE);
 
     // Configuration
     this->on_config_reload(this);
@@ -150,6 +200,9 @@ void Robot::on_config_reload(void *argument)
     // To make adding those solution easier, they have their own, separate object.
     // Here we read the config to find out which arm solution to use
     if (this->arm_solution) delete this->arm_solution;
+#ifdef ARM_SOLUTION_FIXED
+    this->arm_solution = new FixedSolution(THEKERNEL->config);
+#else
     int solution_checksum = get_checksum(THEKERNEL->config->value(arm_solution_checksum)->by_default("cartesian")->as_string());
     // Note checksums are not const expressions when in debug mode, so don't use switch
     if(solution_checksum == hbot_checksum || solution_checksum == corexy_checksum) {
@@ -170,6 +223,7 @@ void Robot::on_config_reload(void *argument)
     } else {
         this->arm_solution = new CartesianSolution(THEKERNEL->config);
     }
+#endif
 
 
     this->feed_rate           = THEKERNEL->config->value(default_feed_rate_checksum   )->by_default(  100.0F)->as_number();
@@ -178,6 +232,18 @@ void Robot::on_config_reload(void *argument)
     this->delta_segments_per_second = THEKERNEL->config->value(delta_segments_per_second_checksum )->by_default(0.0f   )->as_number();
     this->mm_per_arc_segment  = THEKERNEL->config->value(mm_per_arc_segment_checksum  )->by_default(    0.5f)->as_number();
     this->arc_correction      = THEKERNEL->config->value(arc_correction_checksum      )->by_default(    5   )->as_number();
+    this->segment_tolerance   = THEKERNEL->config->value(segment_tolerance_checksum   )->by_default(    0.0F)->as_number();
+    this->arc_tolerance       = THEKERNEL->config->value(arc_tolerance_checksum       )->by_default(    0.0F)->as_number();
+    this->merge_tolerance     = THEKERNEL->config->value(merge_tolerance_checksum     )->by_default(    0.0F)->as_number();
+    this->merge_cos           = cosf(THEKERNEL->config->value(merge_max_angle_checksum)->by_default(   10.0F)->as_number() * (float)M_PI / 180.0F);
+    // given, the machine starts in G64 with it, and it is what G64 without P uses
+    this->default_blend_tolerance = THEKERNEL->config->value(path_blend_tolerance_checksum)->by_default(0.0F)->as_number();
+    this->blend_tolerance     = this->default_blend_tolerance;
+    this->jog_timeout_us      = THEKERNEL->config->value(jog_timeout_checksum         )->by_default(       0)->as_number() * 1000;
+    this->skew[0]             = THEKERNEL->config->value(skew_xy_checksum             )->by_default(    0.0F)->as_number();
+    this->skew[1]             = THEKERNEL->config->value(skew_xz_checksum             )->by_default(    0.0F)->as_number();
+    this->skew[2]             = THEKERNEL->config->value(skew_yz_checksum             )->by_default(    0.0F)->as_number();
+    this->update_affine();
 
     this->max_speeds[X_AXIS]  = THEKERNEL->config->value(x_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
     this->max_speeds[Y_AXIS]  = THEKERNEL->config->value(y_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
@@ -229,11 +295,42 @@ void Robot::on_config_reload(void *argument)
     actuators.push_back(beta_stepper_motor);
     actuators.push_back(gamma_stepper_motor);
 
+    // a gantry with a motor on each side has the second one set up as a slave of the first, eg beta_slave_step_pin
+    static const char *actuator_names[] = {"alpha", "beta", "gamma"};
+    for (int i = 0; i < 3; i++) {
+        string name = actuator_names[i];
+        Pin step_pin, dir_pin, en_pin;
+        step_pin.from_string( THEKERNEL->config->value(get_checksum(name + "_slave_step_pin"))->by_default("nc" )->as_string())->as_output();
+        if(!step_pin.connected()) continue;
+        dir_pin.from_string(  THEKERNEL->config->value(get_checksum(name + "_slave_dir_pin" ))->by_default("nc" )->as_string())->as_output();
+        en_pin.from_string(   THEKERNEL->config->value(get_checksum(name + "_slave_en_pin"  ))->by_default("nc" )->as_string())->as_output();
+        actuators[i]->add_slave(step_pin, dir_pin, en_pin);
+    }
+
+    // any actuators after the first three are the A B C axes, delta_ epsilon_ and zeta_ in the config. They are moved
+    // straight from their axis, with no arm solution, in whatever units their steps_per_mm are for
+    static const char *extra_actuator_names[] = {"delta", "epsilon", "zeta"};
+    for (int i = 3; i < MAX_ROBOT_ACTUATORS; i++) {
+        string name = extra_actuator_names[i - 3];
+        Pin step_pin, dir_pin, en_pin;
+        step_pin.from_string( THEKERNEL->config->value(get_checksum(name + "_step_pin"))->by_default("nc" )->as_string())->as_output();
+        // on a board_sync master an actuator the other board drives is planned here with no pins
+        bool remote = THEKERNEL->config->value(get_checksum(name + "_remote"))->by_default(false)->as_bool();
+        if(!step_pin.connected() && !remote) break;
+        dir_pin.from_string(  THEKERNEL->config->value(get_checksum(name + "_dir_pin" ))->by_default("nc" )->as_string())->as_output();
+        en_pin.from_string(   THEKERNEL->config->value(get_checksum(name + "_en_pin"  ))->by_default("nc" )->as_string())->as_output();
+
+        StepperMotor *motor = new StepperMotor(step_pin, dir_pin, en_pin);
+        motor->change_steps_per_mm(THEKERNEL->config->value(get_checksum(name + "_steps_per_mm"))->by_default(100.0F)->as_number());
+        motor->set_max_rate(THEKERNEL->config->value(get_checksum(name + "_max_rate"))->by_default(30000.0F)->as_number() / 60.0F);
+        motor->change_last_milestone(0.0F);
+        actuators.push_back(motor);
+    }
 
     // initialise actuator positions to current cartesian position (X0 Y0 Z0)
     // so the first move can be correct if homing is not performed
     float actuator_pos[3];
-    arm_solution->cartesian_to_actuator(last_milestone, actuator_pos);
+    kinematics(arm_solution)->cartesian_to_actuator(last_milestone, actuator_pos);
     for (int i = 0; i < 3; i++)
         actuators[i]->change_last_milestone(actuator_pos[i]);
 
@@ -266,6 +363,53 @@ void Robot::check_max_actuator_speeds()
 void Robot::on_halt(void *arg)
 {
     halted= (arg == nullptr);
+    if(halted) {
+        merge_count= 0;
+        jogging= false;
+    }
+}
+
+// a held line is only worth holding while there are blocks running ahead of it, otherwise it would be waiting for
+// lines that may not be coming
+void Robot::on_idle(void *)
+{
+    if(merge_count > 0 && THEKERNEL->conveyor->queued_blocks() < 2) flush_merged_line();
+    if(jogging) feed_jog();
+}
+
+float Robot::get_seconds_per_minute() const
+{
+    return seconds_per_minute / THEKERNEL->planner->get_speed_factor();
+}
+
+void Robot::on_second_tick(void *)
+{
+    MachineStatus *status = THEKERNEL->status;
+    for (int i = 0; i < 3; i++) status->position[i] = from_millimeters(this->last_milestone[i]);
+    status->speed_override = 100.0F * 60.0F / get_seconds_per_minute();
+
+    if(!this->position_report.due()) return;
+
+    char buf[128];
+    int n = format_position(buf, sizeof(buf) - 2);
+    strcpy(&buf[n], "\r\n");
+    this->position_report.send(buf);
+}
+
+// the M114 position, what has been planned so far and where the actuators are now
+int Robot::format_position(char *buf, size_t size)
+{
+    int n = snprintf(buf, size, "C: X:%1.3f Y:%1.3f Z:%1.3f A:%1.3f B:%1.3f C:%1.3f ",
+                     from_millimeters(this->last_milestone[0]),
+                     from_millimeters(this->last_milestone[1]),
+                     from_millimeters(this->last_milestone[2]),
+                     actuators[X_AXIS]->get_current_position(),
+                     actuators[Y_AXIS]->get_current_position(),
+                     actuators[Z_AXIS]->get_current_position() );
+    // the A B C axes go in lower case, A: B: C: above are the first three actuators
+    for (size_t i = 3; i < actuators.size() && n < (int)size; i++)
+        n += snprintf(&buf[n], size - n, "%c:%1.3f ", (char)('a' + i - 3), actuators[i]->last_milestone_mm);
+    return (n < (int)size) ? n : size - 1;
 }
 
 void Robot::on_get_public_data(void *argument)
@@ -276,7 +420,7 @@ void Robot::on_get_public_data(void *argument)
 
     if(pdr->second_element_is(speed_override_percent_checksum)) {
         static float return_data;
-        return_data = 100.0F * 60.0F / seconds_per_minute;
+        return_data = 100.0F * 60.0F / get_seconds_per_minute();
         pdr->set_data_ptr(&return_data);
         pdr->set_taken();
 
@@ -298,12 +442,11 @@ void Robot::on_set_public_data(void *argument)
     if(!pdr->starts_with(robot_checksum)) return;
 
     if(pdr->second_element_is(speed_override_percent_checksum)) {
-        // NOTE do not use this while printing!
         float t = *static_cast<float *>(pdr->get_data_ptr());
         // enforce minimum 10% speed
         if (t < 10.0F) t = 10.0F;
 
-        this->seconds_per_minute = t / 0.6F; // t * 60 / 100
+        THEKERNEL->planner->set_speed_factor(t / 100.0F);
         pdr->set_taken();
     } else if(pdr->second_element_is(current_position_checksum)) {
         float *t = static_cast<float *>(pdr->get_data_ptr());
@@ -312,7 +455,7 @@ void Robot::on_set_public_data(void *argument)
         }
 
         float actuator_pos[3];
-        arm_solution->cartesian_to_actuator(last_milestone, actuator_pos);
+        kinematics(arm_solution)->cartesian_to_actuator(last_milestone, actuator_pos);
         for (int i = 0; i < 3; i++)
             actuators[i]->change_last_milestone(actuator_pos[i]);
 
@@ -335,11 +478,27 @@ void Robot::on_gcode_received(void *argument)
             case 1:  this->motion_mode = MOTION_MODE_LINEAR; gcode->mark_as_taken();  break;
             case 2:  this->motion_mode = MOTION_MODE_CW_ARC; gcode->mark_as_taken();  break;
             case 3:  this->motion_mode = MOTION_MODE_CCW_ARC; gcode->mark_as_taken();  break;
-            case 17: this->select_plane(X_AXIS, Y_AXIS, Z_AXIS); gcode->mark_as_taken();  break;
-            case 18: this->select_plane(X_AXIS, Z_AXIS, Y_AXIS); gcode->mark_as_taken();  break;
-            case 19: this->select_plane(Y_AXIS, Z_AXIS, X_AXIS); gcode->mark_as_taken();  break;
-            case 20: this->inch_mode = true; gcode->mark_as_taken();  break;
-            case 21: this->inch_mode = false; gcode->mark_as_taken();  break;
+            case 5:  this->motion_mode = MOTION_MODE_SPLINE; gcode->mark_as_taken();  break;
+            case 33: // spindle synchronized line, K is the distance per revolution
+                if(gcode->has_letter('K') && gcode->get_value('K') > 0.0F) {
+                    this->motion_mode = MOTION_MODE_LINEAR;
+                    this->spindle_pitch = this->to_millimeters(gcode->get_value('K'));
+                } else {
+                    gcode->stream->printf("Error: G33 needs K, the distance per spindle revolution\r\n");
+                }
+                gcode->mark_as_taken();
+                break;
+            case 17: this->select_plane(X_AXIS, Y_AXIS, Z_AXIS); gcode->mark_as_consumed();  break;
+            case 18: this->select_plane(X_AXIS, Z_AXIS, Y_AXIS); gcode->mark_as_consumed();  break;
+            case 19: this->select_plane(Y_AXIS, Z_AXIS, X_AXIS); gcode->mark_as_consumed();  break;
+            case 20: this->inch_mode = true; gcode->mark_as_consumed();  break;
+            case 21: this->inch_mode = false; gcode->mark_as_consumed();  break;
+            case 61: this->blend_tolerance = 0.0F; gcode->mark_as_consumed();  break; // exact path
+            case 64: // blend the corners between lines, staying within P of them
+                if (gcode->has_letter('P')) this->blend_tolerance = max(0.0F, this->to_millimeters(gcode->get_value('P')));
+                else this->blend_tolerance = this->default_blend_tolerance > 0.0F ? this->default_blend_tolerance : 0.01F;
+                gcode->mark_as_consumed();
+                break;
             case 90: this->absolute_mode = true; gcode->mark_as_taken();  break;
             case 91: this->absolute_mode = false; gcode->mark_as_taken();  break;
             case 92: {
@@ -355,6 +514,11 @@ void Robot::on_gcode_received(void *argument)
                         }
                     }
                 }
+                for (size_t i = 3; i < actuators.size(); i++) {
+                    char letter = 'A' + i - 3;
+                    if (gcode->get_num_args() == 0 || gcode->has_letter(letter))
+                        actuators[i]->change_last_milestone(gcode->has_letter(letter) ? gcode->get_value(letter) : 0.0F);
+                }
 
                 gcode->mark_as_taken();
                 return;
@@ -378,19 +542,19 @@ void Robot::on_gcode_received(void *argument)
                 check_max_actuator_speeds();
                 return;
             case 114: {
-                char buf[64];
-                int n = snprintf(buf, sizeof(buf), "C: X:%1.3f Y:%1.3f Z:%1.3f A:%1.3f B:%1.3f C:%1.3f ",
-                                 from_millimeters(this->last_milestone[0]),
-                                 from_millimeters(this->last_milestone[1]),
-                                 from_millimeters(this->last_milestone[2]),
-                                 actuators[X_AXIS]->get_current_position(),
-                                 actuators[Y_AXIS]->get_current_position(),
-                                 actuators[Z_AXIS]->get_current_position() );
+                char buf[128];
+                int n = format_position(buf, sizeof(buf));
                 gcode->txt_after_ok.append(buf, n);
                 gcode->mark_as_taken();
             }
             return;
 
+            case 154: // M154 S<seconds> pushes the M114 position to this stream every so often, S0 stops it
+                if(!this->position_report.set_interval(gcode->stream, gcode->has_letter('S') ? gcode->get_value('S') : 0))
+                    gcode->stream->printf("Error: can't report to this stream\r\n");
+                gcode->mark_as_taken();
+                return;
+
             case 203: // M203 Set maximum feedrates in mm/sec
                 if (gcode->has_letter('X'))
                     this->max_speeds[X_AXIS] = gcode->get_value('X');
@@ -414,7 +578,7 @@ void Robot::on_gcode_received(void *argument)
                 gcode->mark_as_taken();
                 break;
 
-            case 204: // M204 Snnn - set acceleration to nnn, Znnn sets z acceleration
+            case 204: // M204 Snnn - set acceleration to nnn, Znnn sets z acceleration, Vnnn G0 acceleration (not T, which is a tool change)
                 gcode->mark_as_taken();
 
                 if (gcode->has_letter('S')) {
@@ -431,9 +595,16 @@ void Robot::on_gcode_received(void *argument)
                         acc = 0.0F;
                     THEKERNEL->planner->z_acceleration = acc;
                 }
+                if (gcode->has_letter('V')) {
+                    float acc = gcode->get_value('V'); // mm/s^2
+                    // enforce positive, 0 uses S
+                    if (acc < 0.0F)
+                        acc = 0.0F;
+                    THEKERNEL->planner->travel_acceleration = acc;
+                }
                 break;
 
-            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, Snnn - Set minimum planner speed, Ynnn - set minimum step rate
+            case 205: // M205 Xnnn - set junction deviation, Z - set Z junction deviation, V - G0 junction deviation, Snnn - Set minimum planner speed, Ynnn - set minimum step rate
                 gcode->mark_as_taken();
                 if (gcode->has_letter('X')) {
                     float jd = gcode->get_value('X');
@@ -449,6 +620,13 @@ void Robot::on_gcode_received(void *argument)
                         jd = -1.0F;
                     THEKERNEL->planner->z_junction_deviation = jd;
                 }
+                if (gcode->has_letter('V')) {
+                    float jd = gcode->get_value('V');
+                    // enforce minimum, -1 uses regular junction deviation
+                    if (jd < -1.0F)
+                        jd = -1.0F;
+                    THEKERNEL->planner->travel_junction_deviation = jd;
+                }
                 if (gcode->has_letter('S')) {
                     float mps = gcode->get_value('S');
                     // enforce minimum
@@ -472,20 +650,85 @@ void Robot::on_gcode_received(void *argument)
                     if (factor > 1000.0F)
                         factor = 1000.0F;
 
-                    seconds_per_minute = 6000.0F / factor;
+                    // applies to what is already queued too, not just to the moves that follow
+                    THEKERNEL->planner->set_speed_factor(factor / 100.0F);
                 }
                 break;
 
-            case 400: // wait until all moves are done up to this point
+            case 235: // M235 - report arc segmentation, Snnn sets arc tolerance (0 uses mm_per_arc_segment), R resets the counts
+                gcode->mark_as_taken();
+                if (gcode->has_letter('S')) {
+                    float tol = gcode->get_value('S');
+                    if (tol < 0.0F)
+                        tol = 0.0F;
+                    this->arc_tolerance = tol;
+                }
+                gcode->stream->printf("arc tolerance: %1.4f arcs: %lu blocks: %lu avg: %1.1f last: %lu blend tolerance: %1.4f blends: %lu splines: %lu blocks: %lu\n",
+                                      this->arc_tolerance, this->arc_count, this->arc_blocks,
+                                      this->arc_count == 0 ? 0.0F : (float)this->arc_blocks / this->arc_count, this->last_arc_blocks,
+                                      this->blend_tolerance, this->blend_count, this->spline_count, this->spline_blocks);
+                if (gcode->has_letter('R')) {
+                    this->arc_count = 0;
+                    this->arc_blocks = 0;
+                    this->blend_count = 0;
+                    this->spline_count = 0;
+                    this->spline_blocks = 0;
+                }
+                break;
+
+            case 414: // M414 X Y Z jogs that way until M414 on its own, or for D mm more than has been queued
+                gcode->mark_as_taken();
+                if(gcode->has_letter('X') || gcode->has_letter('Y') || gcode->has_letter('Z')) {
+                    float direction[3];
+                    for(char letter = 'X'; letter <= 'Z'; letter++)
+                        direction[letter - 'X'] = gcode->has_letter(letter) ? gcode->get_value(letter) : 0.0F;
+                    float rate = (gcode->has_letter('F') ? this->to_millimeters(gcode->get_value('F')) : this->seek_rate) / seconds_per_minute;
+                    float distance = gcode->has_letter('D') ? this->to_millimeters(gcode->get_value('D')) : -1.0F;
+                    if(!start_jog(direction, rate, distance))
+                        gcode->stream->printf("Error: can only start jogging with nothing else queued\r\n");
+                } else {
+                    stop_jog();
+                }
+                break;
+
+            case 425: // M425 X Y Z sets the backlash of each actuator in mm, D the distance of a move it is taken up over
+                gcode->mark_as_taken();
+                for (int i = 0; i < 3; i++) {
+                    if (gcode->has_letter('X' + i)) THEKERNEL->planner->backlash[i] = max(0.0F, gcode->get_value('X' + i));
+                }
+                if (gcode->has_letter('D')) THEKERNEL->planner->backlash_distance = max(0.0F, gcode->get_value('D'));
+                if (gcode->get_num_args() == 0) {
+                    gcode->stream->printf("backlash X%1.4f Y%1.4f Z%1.4f over D%1.3f\n", THEKERNEL->planner->backlash[0],
+                                          THEKERNEL->planner->backlash[1], THEKERNEL->planner->backlash[2], THEKERNEL->planner->backlash_distance);
+                }
+                break;
+
+            case 852: // M852 I J K sets the XY XZ YZ skew factors, the tangent of how far each pair of axes is off square
                 gcode->mark_as_taken();
+                if(gcode->has_letter('I')) skew[0]= gcode->get_value('I');
+                if(gcode->has_letter('J')) skew[1]= gcode->get_value('J');
+                if(gcode->has_letter('K')) skew[2]= gcode->get_value('K');
+                if(gcode->get_num_args() == 0) {
+                    gcode->stream->printf("skew XY%1.6f XZ%1.6f YZ%1.6f\n", skew[0], skew[1], skew[2]);
+                } else {
+                    // like turning on a compensation, the next move takes up the change
+                    update_affine();
+                }
+                break;
+
+            case 400: // wait until all moves are done up to this point
+                gcode->mark_as_consumed();
                 THEKERNEL->conveyor->wait_for_empty_queue();
                 break;
 
             case 500: // M500 saves some volatile settings to config override file
             case 503: { // M503 just prints the settings
                 gcode->stream->printf(";Steps per unit:\nM92 X%1.5f Y%1.5f Z%1.5f\n", actuators[0]->steps_per_mm, actuators[1]->steps_per_mm, actuators[2]->steps_per_mm);
-                gcode->stream->printf(";Acceleration mm/sec^2:\nM204 S%1.5f Z%1.5f\n", THEKERNEL->planner->acceleration, THEKERNEL->planner->z_acceleration);
-                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec:\nM205 X%1.5f Z%1.5f S%1.5f\n", THEKERNEL->planner->junction_deviation, THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed);
+                gcode->stream->printf(";Acceleration mm/sec^2, V - for G0:\nM204 S%1.5f Z%1.5f V%1.5f\n", THEKERNEL->planner->acceleration, THEKERNEL->planner->z_acceleration, THEKERNEL->planner->travel_acceleration);
+                gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, V- G0 junction deviation, S - Minimum Planner speed mm/sec:\nM205 X%1.5f Z%1.5f V%1.5f S%1.5f\n", THEKERNEL->planner->junction_deviation, THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->travel_junction_deviation, THEKERNEL->planner->minimum_planner_speed);
+                gcode->stream->printf(";Backlash of each actuator in mm, D - distance it is taken up over:\nM425 X%1.5f Y%1.5f Z%1.5f D%1.5f\n",
+                                      THEKERNEL->planner->backlash[0], THEKERNEL->planner->backlash[1], THEKERNEL->planner->backlash[2], THEKERNEL->planner->backlash_distance);
+                gcode->stream->printf(";XY XZ YZ skew factors:\nM852 I%1.6f J%1.6f K%1.6f\n", skew[0], skew[1], skew[2]);
                 gcode->stream->printf(";Max feedrates in mm/sec, XYZ cartesian, ABC actuator:\nM203 X%1.5f Y%1.5f Z%1.5f A%1.5f B%1.5f C%1.5f\n",
                                       this->max_speeds[X_AXIS], this->max_speeds[Y_AXIS], this->max_speeds[Z_AXIS],
                                       alpha_stepper_motor->get_max_rate(), beta_stepper_motor->get_max_rate(), gamma_stepper_motor->get_max_rate());
@@ -558,6 +801,15 @@ void Robot::on_gcode_received(void *argument)
         }
     }
 
+    // the A B C axes are in their own units, so inches don't apply, nor tool offsets
+    float extra_target[MAX_ROBOT_ACTUATORS];
+    for (size_t i = 3; i < actuators.size(); i++) {
+        char letter = 'A' + i - 3;
+        extra_target[i] = actuators[i]->last_milestone_mm;
+        if( gcode->has_letter(letter) )
+            extra_target[i] = gcode->get_value(letter) + (this->absolute_mode ? 0.0F : extra_target[i]);
+    }
+
     if( gcode->has_letter('F') ) {
         if( this->motion_mode == MOTION_MODE_SEEK )
             this->seek_rate = this->to_millimeters( gcode->get_value('F') );
@@ -565,14 +817,21 @@ void Robot::on_gcode_received(void *argument)
             this->feed_rate = this->to_millimeters( gcode->get_value('F') );
     }
 
-    //Perform any physical actions
+    //Perform any physical actions, the blocks a move is cut into are planned together
+    this->travel_move = this->motion_mode == MOTION_MODE_SEEK;
+    THEKERNEL->planner->begin_batch();
     switch(this->motion_mode) {
         case MOTION_MODE_CANCEL: break;
-        case MOTION_MODE_SEEK  : this->append_line(gcode, target, this->seek_rate / seconds_per_minute ); break;
-        case MOTION_MODE_LINEAR: this->append_line(gcode, target, this->feed_rate / seconds_per_minute ); break;
+        case MOTION_MODE_SEEK  : this->append_line(gcode, target, this->seek_rate / seconds_per_minute, extra_target ); break;
+        case MOTION_MODE_LINEAR: this->append_line(gcode, target, this->feed_rate / seconds_per_minute, extra_target ); break;
         case MOTION_MODE_CW_ARC:
         case MOTION_MODE_CCW_ARC: this->compute_arc(gcode, offset, target ); break;
+        case MOTION_MODE_SPLINE: this->compute_spline(gcode, offset, target ); break;
     }
+    THEKERNEL->planner->end_batch();
+    this->travel_move = false;
+    if (this->motion_mode != MOTION_MODE_SPLINE) this->spline_continues = false;
+    this->spindle_pitch = 0.0F;
 
     // last_milestone was set to target in append_milestone, no need to do it again
 
@@ -598,7 +857,7 @@ void Robot::reset_axis_position(float x, float y, float z)
     this->transformed_last_milestone[Z_AXIS] = z;
 
     float actuator_pos[3];
-    arm_solution->cartesian_to_actuator(this->last_milestone, actuator_pos);
+    kinematics(arm_solution)->cartesian_to_actuator(this->last_milestone, actuator_pos);
     for (int i = 0; i < 3; i++)
         actuators[i]->change_last_milestone(actuator_pos[i]);
 }
@@ -610,7 +869,7 @@ void Robot::reset_axis_position(float position, int axis)
     this->transformed_last_milestone[axis] = position;
 
     float actuator_pos[3];
-    arm_solution->cartesian_to_actuator(this->last_milestone, actuator_pos);
+    kinematics(arm_solution)->cartesian_to_actuator(this->last_milestone, actuator_pos);
 
     for (int i = 0; i < 3; i++)
         actuators[i]->change_last_milestone(actuator_pos[i]);
@@ -624,28 +883,157 @@ void Robot::reset_position_from_current_actuator_position()
     memcpy(this->transformed_last_milestone, this->last_milestone, sizeof(this->transformed_last_milestone));
 
     // now reset actuator correctly, NOTE this may lose a little precision
-    arm_solution->cartesian_to_actuator(this->last_milestone, actuator_pos);
+    kinematics(arm_solution)->cartesian_to_actuator(this->last_milestone, actuator_pos);
     for (int i = 0; i < 3; i++)
         actuators[i]->change_last_milestone(actuator_pos[i]);
 }
 
+struct Robot::DryRunState {
+    float last_milestone[3];
+    float transformed_last_milestone[3];
+    float actuator_milestone[MAX_ROBOT_ACTUATORS];
+    int8_t backlash_direction[3];
+    int8_t motion_mode;
+    uint8_t plane_axis[3];
+    float seek_rate, feed_rate, blend_tolerance;
+    float spline_tangent[2];
+    bool inch_mode, absolute_mode, spline_continues;
+};
+
+void Robot::begin_dry_run()
+{
+    if(dry_run_state != nullptr) return;
+    DryRunState *s = new DryRunState;
+    memcpy(s->last_milestone, last_milestone, sizeof(s->last_milestone));
+    memcpy(s->transformed_last_milestone, transformed_last_milestone, sizeof(s->transformed_last_milestone));
+    for (size_t i = 0; i < actuators.size(); i++)
+        s->actuator_milestone[i] = actuators[i]->get_last_milestone();
+    memcpy(s->backlash_direction, THEKERNEL->planner->backlash_direction, sizeof(s->backlash_direction));
+    s->motion_mode = motion_mode;
+    s->plane_axis[0] = plane_axis_0;
+    s->plane_axis[1] = plane_axis_1;
+    s->plane_axis[2] = plane_axis_2;
+    s->seek_rate = seek_rate;
+    s->feed_rate = feed_rate;
+    s->blend_tolerance = blend_tolerance;
+    memcpy(s->spline_tangent, spline_tangent, sizeof(s->spline_tangent));
+    s->inch_mode = inch_mode;
+    s->absolute_mode = absolute_mode;
+    s->spline_continues = spline_continues;
+    dry_run_state = s;
+}
+
+void Robot::end_dry_run()
+{
+    DryRunState *s = dry_run_state;
+    if(s == nullptr) return;
+    memcpy(last_milestone, s->last_milestone, sizeof(last_milestone));
+    memcpy(transformed_last_milestone, s->transformed_last_milestone, sizeof(transformed_last_milestone));
+    // this also puts back the step counts, which a G92 in the dry run would have moved
+    for (size_t i = 0; i < actuators.size(); i++)
+        actuators[i]->change_last_milestone(s->actuator_milestone[i]);
+    memcpy(THEKERNEL->planner->backlash_direction, s->backlash_direction, sizeof(s->backlash_direction));
+    motion_mode = s->motion_mode;
+    select_plane(s->plane_axis[0], s->plane_axis[1], s->plane_axis[2]);
+    seek_rate = s->seek_rate;
+    feed_rate = s->feed_rate;
+    blend_tolerance = s->blend_tolerance;
+    memcpy(spline_tangent, s->spline_tangent, sizeof(spline_tangent));
+    inch_mode = s->inch_mode;
+    absolute_mode = s->absolute_mode;
+    spline_continues = s->spline_continues;
+    delete s;
+    dry_run_state = nullptr;
+}
+
+void Robot::set_compensation(CompensationStrategy *c)
+{
+    this->compensation= c;
+    update_affine();
+}
+
+// fold the skew correction and a compensation that is linear, like a tilted bed plane, into one transform
+void Robot::update_affine()
+{
+    float t[3][4]= {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}};
+    this->compensation_linear= compensation != nullptr && compensation->get_affine(t);
+
+    // the skew is corrected after the tilt, the same as Marlin's M852: x -= y*xy + z*(xz - xy*yz), y -= z*yz
+    const float s[3][3]= {{1, -skew[0], -(skew[1] - skew[0] * skew[2])}, {0, 1, -skew[2]}, {0, 0, 1}};
+    bool identity= true;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 4; c++) {
+            affine[r][c]= s[r][0] * t[0][c] + s[r][1] * t[1][c] + s[r][2] * t[2][c];
+            if(affine[r][c] != (r == c ? 1.0F : 0.0F)) identity= false;
+        }
+    }
+    this->affine_identity= identity;
+}
+
+// Apply any skew correction and bed compensation to the target
+void Robot::transform_target( const float target[], float transformed_target[] )
+{
+    transform_targets(target, transformed_target, 1);
+}
+
+// the same for n xyz triples, with one call to the compensation for all of them
+void Robot::transform_targets( const float targets[], float transformed_targets[], size_t n )
+{
+    if(affine_identity) {
+        memcpy(transformed_targets, targets, n * 3 * sizeof(float));
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            const float *p = &targets[i * 3];
+            float *t = &transformed_targets[i * 3];
+            for (int r = 0; r < 3; r++)
+                t[r]= affine[r][0] * p[0] + affine[r][1] * p[1] + affine[r][2] * p[2] + affine[r][3];
+        }
+    }
+
+    // a compensation that is not linear, like a grid, goes on top
+    if(compensation != nullptr && !compensation_linear) {
+        compensation->compensate_batch(transformed_targets, n);
+    }
+}
+
+void Robot::append_z_move(float distance, float rate_mm_s)
+{
+    flush_merged_line();
+    float target[3];
+    memcpy(target, this->last_milestone, sizeof(target));
+    target[Z_AXIS] += distance;
+    append_milestone(target, rate_mm_s);
+}
+
 // Convert target from millimeters to steps, and append this to the planner
-void Robot::append_milestone( float target[], float rate_mm_s )
+void Robot::append_milestone( float target[], float rate_mm_s, const float extra_target[] )
 {
-    float deltas[3];
-    float unit_vec[3];
     float actuator_pos[3];
     float transformed_target[3]; // adjust target for bed compensation
-    float millimeters_of_travel;
 
-    // unity transform by default
-    memcpy(transformed_target, target, sizeof(transformed_target));
+    transform_target(target, transformed_target);
+
+    // find actuator position given cartesian position, use actual adjusted target
+    kinematics(arm_solution)->cartesian_to_actuator( transformed_target, actuator_pos );
+
+    append_milestone(target, transformed_target, actuator_pos, rate_mm_s, extra_target);
+}
 
-    // check function pointer and call if set to transform the target to compensate for bed
-    if(compensationTransform) {
-        // some compensation strategies can transform XYZ, some just change Z
-        compensationTransform(transformed_target);
+// Append a milestone whose compensated target and actuator positions have already been worked out
+void Robot::append_milestone( float target[], float transformed_target[], float actuator_pos[], float rate_mm_s, const float extra_target[] )
+{
+    float deltas[3];
+    float pos[MAX_ROBOT_ACTUATORS];
+    float extra_mm2 = 0.0F;
+
+    // the A B C axes stay where they are unless given
+    memcpy(pos, actuator_pos, 3 * sizeof(float));
+    for (size_t i = 3; i < actuators.size(); i++) {
+        pos[i] = (extra_target != nullptr) ? extra_target[i] : actuators[i]->last_milestone_mm;
+        extra_mm2 += powf(pos[i] - actuators[i]->last_milestone_mm, 2);
     }
+    float unit_vec[3];
+    float millimeters_of_travel;
 
     // find distance moved by each axis, use transformed target from last_transformed_target
     for (int axis = X_AXIS; axis <= Z_AXIS; axis++){
@@ -657,33 +1045,37 @@ void Robot::append_milestone( float target[], float rate_mm_s )
     // Compute how long this move moves, so we can attach it to the block for later use
     millimeters_of_travel = sqrtf( powf( deltas[X_AXIS], 2 ) +  powf( deltas[Y_AXIS], 2 ) +  powf( deltas[Z_AXIS], 2 ) );
 
-    // find distance unit vector
-    for (int i = 0; i < 3; i++)
-        unit_vec[i] = deltas[i] / millimeters_of_travel;
+    // find distance unit vector, a move of only the A B C axes runs at the feed rate along them
+    if (millimeters_of_travel > 0.0F) {
+        for (int i = 0; i < 3; i++)
+            unit_vec[i] = deltas[i] / millimeters_of_travel;
+    } else {
+        clear_vector(unit_vec);
+        millimeters_of_travel = sqrtf(extra_mm2);
+    }
 
-    // Do not move faster than the configured cartesian limits
+    // Do not move faster than the configured cartesian limits, the planner applies these after the speed override
+    float max_rate_mm_s = 0.0F;
     for (int axis = X_AXIS; axis <= Z_AXIS; axis++) {
-        if ( max_speeds[axis] > 0 ) {
-            float axis_speed = fabs(unit_vec[axis] * rate_mm_s);
-
-            if (axis_speed > max_speeds[axis])
-                rate_mm_s *= ( max_speeds[axis] / axis_speed );
+        if ( max_speeds[axis] > 0 && unit_vec[axis] != 0.0F ) {
+            float limit = max_speeds[axis] / fabs(unit_vec[axis]);
+            if (max_rate_mm_s == 0.0F || limit < max_rate_mm_s)
+                max_rate_mm_s = limit;
         }
     }
 
-    // find actuator position given cartesian position, use actual adjusted target
-    arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
-
     // check per-actuator speed limits
-    for (int actuator = 0; actuator <= 2; actuator++) {
-        float actuator_rate  = fabs(actuator_pos[actuator] - actuators[actuator]->last_milestone_mm) * rate_mm_s / millimeters_of_travel;
-
-        if (actuator_rate > actuators[actuator]->get_max_rate())
-            rate_mm_s *= (actuators[actuator]->get_max_rate() / actuator_rate);
+    for (size_t actuator = 0; actuator < actuators.size(); actuator++) {
+        float actuator_mm = fabs(pos[actuator] - actuators[actuator]->last_milestone_mm);
+        if (actuator_mm > 0.0F) {
+            float limit = actuators[actuator]->get_max_rate() * millimeters_of_travel / actuator_mm;
+            if (max_rate_mm_s == 0.0F || limit < max_rate_mm_s)
+                max_rate_mm_s = limit;
+        }
     }
 
     // Append the block to the planner
-    THEKERNEL->planner->append_block( actuator_pos, rate_mm_s, millimeters_of_travel, unit_vec );
+    THEKERNEL->planner->append_block( pos, rate_mm_s, max_rate_mm_s, millimeters_of_travel, unit_vec, this->spindle_pitch, this->travel_move );
 
     // Update the last_milestone to the current target for the next time we use last_milestone, use the requested target not the adjusted one
     memcpy(this->last_milestone, target, sizeof(this->last_milestone)); // this->last_milestone[] = target[];
@@ -691,12 +1083,25 @@ void Robot::append_milestone( float target[], float rate_mm_s )
 }
 
 // Append a move to the queue ( cutting it into segments if needed )
-void Robot::append_line(Gcode *gcode, float target[], float rate_mm_s )
+void Robot::append_line(Gcode *gcode, float target[], float rate_mm_s, const float extra_target[] )
 {
 
     // Find out the distance for this gcode
     gcode->millimeters_of_travel = powf( target[X_AXIS] - this->last_milestone[X_AXIS], 2 ) +  powf( target[Y_AXIS] - this->last_milestone[Y_AXIS], 2 ) +  powf( target[Z_AXIS] - this->last_milestone[Z_AXIS], 2 );
 
+    // the A B C axes only count when nothing else moves, as append_milestone does
+    float extra_start[MAX_ROBOT_ACTUATORS];
+    float extra_mm2 = 0.0F;
+    if (extra_target != nullptr) {
+        for (size_t i = 3; i < actuators.size(); i++) {
+            extra_start[i] = actuators[i]->last_milestone_mm;
+            extra_mm2 += powf(extra_target[i] - extra_start[i], 2);
+        }
+    }
+    if( gcode->millimeters_of_travel < 1e-8F ) {
+        gcode->millimeters_of_travel = extra_mm2;
+    }
+
     // We ignore non-moves ( for example, extruder moves are not XYZ moves )
     if( gcode->millimeters_of_travel < 1e-8F ) {
         return;
@@ -729,6 +1134,18 @@ void Robot::append_line(Gcode *gcode, float target[], float rate_mm_s )
         }
     }
 
+    // the settings above give the most segments we will use, only split as far as the kinematics actually need
+    if (segments > 1 && this->segment_tolerance > 0.0F) {
+        segments = adaptive_segments(target, segments);
+    }
+
+    // a line the kinematics don't need split may be merged with the lines either side of it
+    if (segments == 1 && can_merge(gcode)) {
+        merge_line(target, rate_mm_s);
+        return;
+    }
+    flush_merged_line();
+
     if (segments > 1) {
         // A vector to keep track of the endpoint of each segment
         float segment_delta[3];
@@ -737,27 +1154,318 @@ void Robot::append_line(Gcode *gcode, float target[], float rate_mm_s )
         // How far do we move each segment?
         for (int i = X_AXIS; i <= Z_AXIS; i++)
             segment_delta[i] = (target[i] - last_milestone[i]) / segments;
+        memcpy(segment_end, last_milestone, sizeof(segment_end));
+
+        // the segment ends are transformed to actuator positions a batch at a time so the arm solution can share its setup
+        const int batch_size = 8;
+        float batch_target[batch_size][3], batch_transformed[batch_size][3], batch_actuator[batch_size][3];
+        float extra_segment[MAX_ROBOT_ACTUATORS];
 
         // segment 0 is already done - it's the end point of the previous move so we start at segment 1
         // We always add another point after this loop so we stop at segments-1, ie i < segments
-        for (int i = 1; i < segments; i++) {
-            if(halted) return; // don;t queue any more segments
-            for(int axis = X_AXIS; axis <= Z_AXIS; axis++ )
-                segment_end[axis] = last_milestone[axis] + segment_delta[axis];
-
-            // Append the end of this segment to the queue
-            this->append_milestone(segment_end, rate_mm_s);
+        for (int i = 1; i < segments; ) {
+            int n = min(batch_size, segments - i);
+            for (int j = 0; j < n; j++) {
+                for(int axis = X_AXIS; axis <= Z_AXIS; axis++ )
+                    segment_end[axis] += segment_delta[axis];
+                memcpy(batch_target[j], segment_end, sizeof(segment_end));
+            }
+            transform_targets(&batch_target[0][0], &batch_transformed[0][0], n);
+            kinematics(arm_solution)->cartesian_to_actuator_batch(&batch_transformed[0][0], &batch_actuator[0][0], n);
+
+            for (int j = 0; j < n; j++) {
+                if(halted) return; // don;t queue any more segments
+                if (extra_target != nullptr) {
+                    for (size_t a = 3; a < actuators.size(); a++)
+                        extra_segment[a] = extra_start[a] + (extra_target[a] - extra_start[a]) * (i + j) / segments;
+                }
+                // Append the end of this segment to the queue
+                this->append_milestone(batch_target[j], batch_transformed[j], batch_actuator[j], rate_mm_s, (extra_target != nullptr) ? extra_segment : nullptr);
+            }
+            i += n;
         }
     }
 
     // Append the end of this full move to the queue
-    this->append_milestone(target, rate_mm_s);
+    this->append_milestone(target, rate_mm_s, extra_target);
 
     // if adding these blocks didn't start executing, do that now
     THEKERNEL->conveyor->ensure_running();
 }
 
 
+// Only plain X Y Z F moves are merged, anything else a module might attach to the block, like an E, belongs to its own
+// line, and only where merging the ends does not move the path, so not with kinematics that bend lines or compensation
+// that is not linear
+bool Robot::can_merge( const Gcode *gcode ) const
+{
+    const uint32_t plain = 1 << ('G' - 'A') | 1 << ('X' - 'A') | 1 << ('Y' - 'A') | 1 << ('Z' - 'A') | 1 << ('F' - 'A');
+    return (merge_tolerance > 0.0F || blend_tolerance > 0.0F) && gcode != nullptr && gcode->has_g && (gcode->g == 0 || gcode->g == 1) && !gcode->has_m &&
+           (gcode->get_letters() & ~plain) == 0 && spindle_pitch == 0.0F && (compensation == nullptr || compensation_linear) && kinematics(arm_solution)->is_linear();
+}
+
+// the change of direction from the last merged line is under merge_max_angle, and every end merged so far stays within
+// merge_tolerance of the one line from where the held line starts to target
+bool Robot::fits_merged_line( const float target[] ) const
+{
+    const float *start = merge_points[0], *end = merge_points[merge_count], *prev = merge_points[merge_count - 1];
+    float last[3], next[3], chord[3];
+    for (int axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        last[axis] = end[axis] - prev[axis];
+        next[axis] = target[axis] - end[axis];
+        chord[axis] = target[axis] - start[axis];
+    }
+    float last_len = sqrtf(last[0] * last[0] + last[1] * last[1] + last[2] * last[2]);
+    float next_len = sqrtf(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+    if (last[0] * next[0] + last[1] * next[1] + last[2] * next[2] < merge_cos * last_len * next_len) return false;
+
+    float chord_len2 = chord[0] * chord[0] + chord[1] * chord[1] + chord[2] * chord[2];
+    for (int i = 1; i <= merge_count; i++) {
+        float p[3];
+        for (int axis = X_AXIS; axis <= Z_AXIS; axis++) p[axis] = merge_points[i][axis] - start[axis];
+        float t = (p[0] * chord[0] + p[1] * chord[1] + p[2] * chord[2]) / chord_len2;
+        if (t <= 0.0F || t >= 1.0F) return false;
+        float d2 = 0.0F;
+        for (int axis = X_AXIS; axis <= Z_AXIS; axis++) d2 += powf(p[axis] - t * chord[axis], 2);
+        if (d2 > merge_tolerance * merge_tolerance) return false;
+    }
+    return true;
+}
+
+// the line is added to the held one if it fits, otherwise the held one is queued and this one is held in its place,
+// in G64 with the corner between them rounded off
+void Robot::merge_line( const float target[], float rate_mm_s )
+{
+    float start[3];
+    memcpy(start, last_milestone, sizeof(start));
+    if (merge_count > 0 && travel_move != merge_travel) {
+        flush_merged_line();
+    } else if (merge_count > 0 && (merge_tolerance == 0.0F || rate_mm_s != merge_rate || merge_count == merge_max_lines || !fits_merged_line(target))) {
+        if (blend_tolerance == 0.0F || !blend_corner(target, rate_mm_s, start))
+            flush_merged_line();
+    }
+    if (merge_count == 0) {
+        memcpy(merge_points[0], start, sizeof(merge_points[0]));
+        merge_rate = rate_mm_s;
+        merge_tag = THEKERNEL->conveyor->get_source_tag();
+        merge_travel = travel_move;
+    }
+    memcpy(merge_points[++merge_count], target, sizeof(merge_points[0]));
+
+    // the gcode sees the line as done, so relative moves and M114 carry on from its end
+    memcpy(last_milestone, target, sizeof(last_milestone));
+}
+
+// Queues the held line up to where an arc tangent to it and to the line on to target starts, then the arc, which stays
+// within blend_tolerance of the corner. The arc ends on the new line no more than half way along it, so the corner at
+// its far end has room too, and start is set to there. False if the corner is too slight or too sharp to round off.
+bool Robot::blend_corner( const float target[], float rate_mm_s, float start[] )
+{
+    const float *from = merge_points[0], *corner = merge_points[merge_count];
+    float u1[3], u2[3], l1 = 0.0F, l2 = 0.0F;
+    for (int axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        u1[axis] = corner[axis] - from[axis];
+        u2[axis] = target[axis] - corner[axis];
+        l1 += u1[axis] * u1[axis];
+        l2 += u2[axis] * u2[axis];
+    }
+    l1 = sqrtf(l1);
+    l2 = sqrtf(l2);
+    if (l1 < 1e-5F || l2 < 1e-5F) return false;
+    float c = 0.0F;
+    for (int axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        u1[axis] /= l1;
+        u2[axis] /= l2;
+        c += u1[axis] * u2[axis];
+    }
+    if (c > 0.99999F || c < -0.99F) return false;
+
+    // an arc of radius r turning through the corner's angle is r / cos(turn / 2) - r from the corner at its middle,
+    // and touches the lines r * tan(turn / 2) from it
+    float turn = acosf(c);
+    float half_cos = cosf(turn * 0.5F), half_tan = tanf(turn * 0.5F);
+    float d = min(blend_tolerance * half_cos / (1.0F - half_cos) * half_tan, min(l1, 0.5F * l2));
+    float radius = d / half_tan;
+    if (radius < 1e-4F) return false;
+
+    float q1[3], q2[3], center[3], bisector[3], b = 0.0F;
+    for (int axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        q1[axis] = corner[axis] - d * u1[axis];
+        q2[axis] = corner[axis] + d * u2[axis];
+        bisector[axis] = u2[axis] - u1[axis];
+        b += bisector[axis] * bisector[axis];
+    }
+    b = radius / half_cos / sqrtf(b);
+    for (int axis = X_AXIS; axis <= Z_AXIS; axis++) center[axis] = corner[axis] + bisector[axis] * b;
+
+    // as many segments as append_arc would cut an arc of this radius into
+    uint32_t segments;
+    if (this->arc_tolerance > 0.0F && radius > this->arc_tolerance) {
+        segments = ceilf(turn / (2.0F * acosf(1.0F - this->arc_tolerance / radius)));
+    } else {
+        segments = ceilf(radius * turn / this->mm_per_arc_segment);
+    }
+    if (segments < 1) segments = 1;
+    if (segments > 16) segments = 16;
+
+    merge_count = 0;
+    blend_count++;
+    float rate = min(merge_rate, rate_mm_s);
+    if (l1 - d > 1e-5F) {
+        // the rest of the held line is from the line it started with, the arc is from the one being added
+        uint32_t tag = THEKERNEL->conveyor->get_source_tag();
+        THEKERNEL->conveyor->set_source_tag(merge_tag);
+        this->append_milestone(q1, merge_rate);
+        THEKERNEL->conveyor->set_source_tag(tag);
+    }
+
+    // each point is a mix of the radius vectors to the ends, which only needs the one sine per point
+    float sin_turn = sinf(turn);
+    for (uint32_t i = 1; i < segments; i++) {
+        if (halted) return true;
+        float f = (float)i / segments;
+        float a0 = sinf((1.0F - f) * turn) / sin_turn, a1 = sinf(f * turn) / sin_turn;
+        float p[3];
+        for (int axis = X_AXIS; axis <= Z_AXIS; axis++)
+            p[axis] = center[axis] + a0 * (q1[axis] - center[axis]) + a1 * (q2[axis] - center[axis]);
+        this->append_milestone(p, rate);
+    }
+    this->append_milestone(q2, rate);
+    THEKERNEL->conveyor->ensure_running();
+
+    memcpy(start, q2, sizeof(q2));
+    return true;
+}
+
+void Robot::flush_merged_line(const Gcode *next)
+{
+    if (merge_count == 0 || can_merge(next)) return;
+    int n = merge_count;
+    merge_count = 0;
+    uint32_t tag = THEKERNEL->conveyor->get_source_tag();
+    bool travel = travel_move;
+    THEKERNEL->conveyor->set_source_tag(merge_tag);
+    travel_move = merge_travel;
+    this->append_milestone(merge_points[n], merge_rate);
+    travel_move = travel;
+    THEKERNEL->conveyor->set_source_tag(tag);
+    THEKERNEL->conveyor->ensure_running();
+}
+
+// The jog is queued a block at a time, keeping two ahead of the one running so it never has to slow down for the end
+// of the queue. Going on the same way just changes the rate and distance, another way stops first. A distance of less
+// than 0 is for no end, and the jog also stops if it is not started again within jog_timeout_ms when that is set
+bool Robot::start_jog(const float direction[3], float rate_mm_s, float distance)
+{
+    float l = sqrtf(direction[X_AXIS] * direction[X_AXIS] + direction[Y_AXIS] * direction[Y_AXIS] + direction[Z_AXIS] * direction[Z_AXIS]);
+    if(l < 1e-6F || rate_mm_s <= 0.0F || halted) return false;
+    float unit[3], c = 0.0F;
+    for (int axis = X_AXIS; axis <= Z_AXIS; axis++) {
+        unit[axis] = direction[axis] / l;
+        c += unit[axis] * jog_direction[axis];
+    }
+
+    if(jogging && c < 0.9999F) stop_jog();
+    if(!jogging) {
+        flush_merged_line();
+        if(!THEKERNEL->conveyor->is_queue_empty()) return false;
+        memcpy(jog_direction, unit, sizeof(unit));
+        jogging = true;
+    }
+    jog_rate = rate_mm_s;
+    jog_remaining = distance;
+    jog_since = us_ticker_read();
+    feed_jog();
+    return true;
+}
+
+void Robot::feed_jog()
+{
+    if(jog_timeout_us > 0 && us_ticker_read() - jog_since > jog_timeout_us) {
+        stop_jog();
+        return;
+    }
+
+    // each block is at least the distance it takes to brake from the rate, so stopping never has to keep more than one
+    float acceleration = THEKERNEL->planner->get_acceleration();
+    if(jog_direction[Z_AXIS] != 0.0F) acceleration = min(acceleration, THEKERNEL->planner->get_z_acceleration());
+    float length = max(jog_rate * 0.05F, jog_rate * jog_rate / (2.0F * acceleration));
+
+    uint32_t tag = THEKERNEL->conveyor->get_source_tag();
+    while(!halted && jog_remaining != 0.0F && THEKERNEL->conveyor->queued_blocks() < 3) {
+        float l = jog_remaining > 0.0F ? min(length, jog_remaining) : length;
+        float target[3];
+        for (int axis = X_AXIS; axis <= Z_AXIS; axis++) target[axis] = this->last_milestone[axis] + jog_direction[axis] * l;
+        // a tag of its own, so truncate_queue can stop it between any two blocks
+        THEKERNEL->conveyor->set_source_tag(++jog_tag);
+        this->append_milestone(target, jog_rate);
+        if(jog_remaining > 0.0F) jog_remaining -= l;
+    }
+    THEKERNEL->conveyor->set_source_tag(tag);
+    THEKERNEL->conveyor->ensure_running();
+    if(jog_remaining == 0.0F) jogging = false;
+}
+
+// the blocks the jog can brake to a stop by the end of are kept, the rest dropped, and the position is where it stopped
+void Robot::stop_jog()
+{
+    if(!jogging) return;
+    jogging = false;
+    uint32_t tag;
+    if(THEKERNEL->conveyor->truncate_queue(tag)) {
+        THEKERNEL->conveyor->wait_for_empty_queue();
+        reset_position_from_current_actuator_position();
+    }
+}
+
+// forgets the held line, as if it had never been given, tag is the source tag of the first line in it
+bool Robot::drop_merged_line(uint32_t &tag)
+{
+    if (merge_count == 0) return false;
+    merge_count = 0;
+    tag = merge_tag;
+    return true;
+}
+
+// Estimate how many segments a line from last_milestone to target needs so that the actuator-space
+// path of each straight segment stays within segment_tolerance of the true path, capped at max_segments.
+// The chordal error of a segment is proportional to its length squared, so it is sampled at the midpoint of
+// the whole line and of each half, and the worst of those scaled to the full length gives the segment count.
+uint16_t Robot::adaptive_segments( const float target[], uint16_t max_segments )
+{
+    float samples[5][3], transformed[5][3], actuator[5][3];
+    for (int j = 0; j < 5; j++) {
+        for (int axis = X_AXIS; axis <= Z_AXIS; axis++)
+            samples[j][axis] = this->last_milestone[axis] + (target[axis] - this->last_milestone[axis]) * j * 0.25F;
+    }
+    transform_targets(&samples[0][0], &transformed[0][0], 5);
+    kinematics(arm_solution)->cartesian_to_actuator_batch(&transformed[0][0], &actuator[0][0], 5);
+
+    float full_error = 0.0F, half_error = 0.0F;
+    for (int axis = ALPHA_STEPPER; axis <= GAMMA_STEPPER; axis++) {
+        full_error = max(full_error, fabsf(actuator[2][axis] - (actuator[0][axis] + actuator[4][axis]) * 0.5F));
+        half_error = max(half_error, fabsf(actuator[1][axis] - (actuator[0][axis] + actuator[2][axis]) * 0.5F));
+        half_error = max(half_error, fabsf(actuator[3][axis] - (actuator[2][axis] + actuator[4][axis]) * 0.5F));
+    }
+
+    // an error measured over half the line is a quarter of what the same curvature gives over all of it
+    float error = max(full_error, 4.0F * half_error);
+    float segments = ceilf(sqrtf(error / this->segment_tolerance));
+    if (segments < 1.0F) return 1;
+    if (segments > max_segments) return max_segments;
+    return segments;
+}
+
+// fixed point scales used by append_arc
+#define ARC_MATRIX_ONE (1 << 30)
+#define ARC_RADIUS_ONE (1 << 16)
+
+// a * b + c * d with a, c in 16.16 and b, d in 2.30, result in 16.16
+static inline int32_t arc_rotate(int32_t a, int32_t b, int32_t c, int32_t d)
+{
+    return ((int64_t)a * b + (int64_t)c * d + (1 << 29)) >> 30;
+}
+
 // Append an arc to the queue ( cutting it into segments as needed )
 void Robot::append_arc(Gcode *gcode, float target[], float offset[], float radius, bool is_clockwise )
 {
@@ -792,7 +1500,26 @@ void Robot::append_arc(Gcode *gcode, float target[], float offset[], float radiu
     this->distance_in_gcode_is_known( gcode );
 
     // Figure out how many segments for this gcode
-    uint16_t segments = floorf(gcode->millimeters_of_travel / this->mm_per_arc_segment);
+    uint32_t segments;
+    if (this->arc_tolerance > 0.0F && radius > this->arc_tolerance) {
+        // chordal mode, the longest chord whose sagitta r(1-cos(theta/2)) stays within arc_tolerance
+        float theta_max = 2.0F * acosf(1.0F - this->arc_tolerance / radius);
+        segments = ceilf(fabsf(angular_travel) / theta_max);
+
+        // non linear arm solutions still need the line segmentation, as the segments are not split again
+        if (this->delta_segments_per_second > 1.0F) {
+            segments = max(segments, (uint32_t)ceilf(this->delta_segments_per_second * gcode->millimeters_of_travel * seconds_per_minute / this->feed_rate));
+        } else if (this->mm_per_line_segment > 0.0F) {
+            segments = max(segments, (uint32_t)ceilf(gcode->millimeters_of_travel / this->mm_per_line_segment));
+        }
+    } else {
+        segments = floorf(gcode->millimeters_of_travel / this->mm_per_arc_segment);
+    }
+    if (segments < 1) segments = 1;
+
+    this->arc_count++;
+    this->arc_blocks += segments;
+    this->last_arc_blocks = segments;
 
     float theta_per_segment = angular_travel / segments;
     float linear_per_segment = linear_travel / segments;
@@ -809,58 +1536,64 @@ void Robot::append_arc(Gcode *gcode, float target[], float offset[], float radiu
     round off issues for CNC applications.) Single precision error can accumulate to be greater than
     tool precision in some cases. Therefore, arc path correction is implemented.
 
-    Small angle approximation may be used to reduce computation overhead further. This approximation
-    holds for everything, but very small circles and large mm_per_arc_segment values. In other words,
-    theta_per_segment would need to be greater than 0.1 rad and N_ARC_CORRECTION would need to be large
-    to cause an appreciable drift error. N_ARC_CORRECTION~=25 is more than small enough to correct for
-    numerical drift error. N_ARC_CORRECTION may be on the order a hundred(s) before error becomes an
-    issue for CNC machines with the single precision Arduino calculations.
-    This approximation also allows mc_arc to immediately insert a line segment into the planner
-    without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
-    a correction, the planner should have caught up to the lag caused by the initial mc_arc overhead.
-    This is important when there are successive arc motions.
+    The rotation matrix is computed with exact trig once per arc rather than the small angle
+    approximation, since it is applied in fixed point the per segment cost is the same either way.
     */
-    // Vector rotation matrix values
-    float cos_T = 1 - 0.5F * theta_per_segment * theta_per_segment; // Small angle approximation
-    float sin_T = theta_per_segment;
+    // Vector rotation matrix values, the matrix is computed exactly once per arc and applied in fixed point,
+    // 2.30 for the matrix and 16.16 mm for the radius vector, which avoids soft float multiplies per segment
+    const int32_t cos_T = lrintf(cosf(theta_per_segment) * ARC_MATRIX_ONE);
+    const int32_t sin_T = lrintf(sinf(theta_per_segment) * ARC_MATRIX_ONE);
+    int32_t r_fx0 = lrintf(r_axis0 * ARC_RADIUS_ONE);
+    int32_t r_fx1 = lrintf(r_axis1 * ARC_RADIUS_ONE);
+    int32_t r_fxi;
 
     float arc_target[3];
     float sin_Ti;
     float cos_Ti;
-    float r_axisi;
-    uint16_t i;
+    uint32_t i;
     int8_t count = 0;
 
     // Initialize the linear axis
     arc_target[this->plane_axis_2] = this->last_milestone[this->plane_axis_2];
 
-    for (i = 1; i < segments; i++) { // Increment (segments-1)
-        if(halted) return; // don't queue any more segments
-
-        if (count < this->arc_correction ) {
-            // Apply vector rotation matrix
-            r_axisi = r_axis0 * sin_T + r_axis1 * cos_T;
-            r_axis0 = r_axis0 * cos_T - r_axis1 * sin_T;
-            r_axis1 = r_axisi;
-            count++;
-        } else {
-            // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-            // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-            cos_Ti = cosf(i * theta_per_segment);
-            sin_Ti = sinf(i * theta_per_segment);
-            r_axis0 = -offset[this->plane_axis_0] * cos_Ti + offset[this->plane_axis_1] * sin_Ti;
-            r_axis1 = -offset[this->plane_axis_0] * sin_Ti - offset[this->plane_axis_1] * cos_Ti;
-            count = 0;
-        }
+    // as in append_line the segment ends are transformed a batch at a time
+    const int batch_size = 8;
+    float batch_target[batch_size][3], batch_transformed[batch_size][3], batch_actuator[batch_size][3];
+
+    for (i = 1; i < segments; ) { // Increment (segments-1)
+        int n = min((uint32_t)batch_size, segments - i);
+        for (int j = 0; j < n; j++, i++) {
+            if (count < this->arc_correction ) {
+                // Apply vector rotation matrix
+                r_fxi = arc_rotate(r_fx0, sin_T, r_fx1, cos_T);
+                r_fx0 = arc_rotate(r_fx0, cos_T, -r_fx1, sin_T);
+                r_fx1 = r_fxi;
+                count++;
+            } else {
+                // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+                // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
+                cos_Ti = cosf(i * theta_per_segment);
+                sin_Ti = sinf(i * theta_per_segment);
+                r_fx0 = lrintf((-offset[this->plane_axis_0] * cos_Ti + offset[this->plane_axis_1] * sin_Ti) * ARC_RADIUS_ONE);
+                r_fx1 = lrintf((-offset[this->plane_axis_0] * sin_Ti - offset[this->plane_axis_1] * cos_Ti) * ARC_RADIUS_ONE);
+                count = 0;
+            }
 
-        // Update arc_target location
-        arc_target[this->plane_axis_0] = center_axis0 + r_axis0;
-        arc_target[this->plane_axis_1] = center_axis1 + r_axis1;
-        arc_target[this->plane_axis_2] += linear_per_segment;
+            // Update arc_target location
+            arc_target[this->plane_axis_0] = center_axis0 + r_fx0 * (1.0F / ARC_RADIUS_ONE);
+            arc_target[this->plane_axis_1] = center_axis1 + r_fx1 * (1.0F / ARC_RADIUS_ONE);
+            arc_target[this->plane_axis_2] += linear_per_segment;
 
-        // Append this segment to the queue
-        this->append_milestone(arc_target, this->feed_rate / seconds_per_minute);
+            memcpy(batch_target[j], arc_target, sizeof(arc_target));
+        }
+        transform_targets(&batch_target[0][0], &batch_transformed[0][0], n);
+        kinematics(arm_solution)->cartesian_to_actuator_batch(&batch_transformed[0][0], &batch_actuator[0][0], n);
 
+        for (int j = 0; j < n; j++) {
+            if(halted) return; // don't queue any more segments
+            // Append this segment to the queue
+            this->append_milestone(batch_target[j], batch_transformed[j], batch_actuator[j], this->feed_rate / seconds_per_minute);
+        }
     }
 
     // Ensure last segment arrives at target location.
@@ -885,6 +1618,163 @@ void Robot::compute_arc(Gcode *gcode, float offset[], float target[])
 
 }
 
+// the forward differences d[0..2] of a cubic for a step of h are turned into those for a step of h * scale, going back
+// through the local coefficients it is A s^3 + B s^2 + C s in
+static void rescale_differences(float d[3][2], float scale)
+{
+    for (int axis = 0; axis < 2; axis++) {
+        float a = d[2][axis] / 6.0F;
+        float b = (d[1][axis] - d[2][axis]) * 0.5F;
+        float c = d[0][axis] - a - b;
+        a *= scale * scale * scale;
+        b *= scale * scale;
+        c *= scale;
+        d[0][axis] = a + b + c;
+        d[1][axis] = 6.0F * a + 2.0F * b;
+        d[2][axis] = 6.0F * a;
+    }
+}
+
+// the chord of the next step is at most an eighth of the largest second difference over it from the curve, and
+// that is at one end or the other
+static float step_error(const float d[3][2])
+{
+    return max(hypotf(d[1][0] - d[2][0], d[1][1] - d[2][1]), hypotf(d[1][0], d[1][1])) * 0.125F;
+}
+
+// Append a cubic Bezier from last_milestone through the control points c1 and c2 to target, in the XY plane with Z
+// moving along with the curve parameter. It is flattened by adaptive forward differencing: each point is the last
+// plus the first difference, so three adds per axis and no polynomial to evaluate, and the step is halved where the
+// next chord would stray further than the tolerance from the curve and doubled where it would be well within it.
+// The steps are powers of two of the whole curve, so they always land on its end.
+void Robot::append_spline(Gcode *gcode, float target[], const float c1[], const float c2[])
+{
+    const float *p0 = this->last_milestone;
+
+    // the length is between the chord and the control polygon, which is near enough for the planner
+    float chord = hypotf(target[X_AXIS] - p0[X_AXIS], target[Y_AXIS] - p0[Y_AXIS]);
+    float polygon = hypotf(c1[0] - p0[X_AXIS], c1[1] - p0[Y_AXIS]) + hypotf(c2[0] - c1[0], c2[1] - c1[1]) +
+                    hypotf(target[X_AXIS] - c2[0], target[Y_AXIS] - c2[1]);
+    float linear_travel = target[Z_AXIS] - p0[Z_AXIS];
+    gcode->millimeters_of_travel = hypotf((chord + polygon) * 0.5F, linear_travel);
+
+    // We don't care about non-XYZ moves ( for example the extruder produces some of those )
+    if( gcode->millimeters_of_travel < 0.0001F ) {
+        return;
+    }
+
+    // Mark the gcode as having a known distance
+    this->distance_in_gcode_is_known( gcode );
+
+    float rate_mm_s = this->feed_rate / seconds_per_minute;
+    float tolerance = this->arc_tolerance > 0.0F ? this->arc_tolerance : 0.01F;
+
+    // non linear arm solutions still need the line segmentation, as the segments are not split again
+    float max_chord = 0.0F;
+    if (this->delta_segments_per_second > 1.0F) {
+        max_chord = rate_mm_s / this->delta_segments_per_second;
+    } else if (this->mm_per_line_segment > 0.0F) {
+        max_chord = this->mm_per_line_segment;
+    }
+
+    // the differences for a step of the whole curve, from its coefficients in t
+    float d[3][2], point[3];
+    for (int axis = X_AXIS; axis <= Y_AXIS; axis++) {
+        float c = 3.0F * (c1[axis] - p0[axis]);
+        float b = 3.0F * (p0[axis] - 2.0F * c1[axis] + c2[axis]);
+        float a = target[axis] - p0[axis] + 3.0F * (c1[axis] - c2[axis]);
+        d[0][axis] = a + b + c;
+        d[1][axis] = 6.0F * a + 2.0F * b;
+        d[2][axis] = 6.0F * a;
+        point[axis] = p0[axis];
+    }
+    point[Z_AXIS] = p0[Z_AXIS];
+    float start_z = p0[Z_AXIS];
+
+    const int max_level = 10;
+    const uint32_t total = 1 << max_level;
+    int level = 0;
+    uint32_t pos = 0, segments = 0;
+    while (pos < total) {
+        bool halved = false;
+        while (level < max_level && (step_error(d) > tolerance || (max_chord > 0.0F && hypotf(d[0][0], d[0][1]) > max_chord))) {
+            rescale_differences(d, 0.5F);
+            level++;
+            halved = true;
+        }
+        // a step twice as long has about four times the error, it has to start where one that long would
+        while (!halved && level > 0 && (pos & ((total >> (level - 1)) - 1)) == 0 && step_error(d) * 8.0F < tolerance &&
+               (max_chord == 0.0F || hypotf(d[0][0], d[0][1]) * 2.0F < max_chord)) {
+            rescale_differences(d, 2.0F);
+            level--;
+        }
+
+        pos += total >> level;
+        segments++;
+        if (pos >= total) break;
+        for (int axis = X_AXIS; axis <= Y_AXIS; axis++) {
+            point[axis] += d[0][axis];
+            d[0][axis] += d[1][axis];
+            d[1][axis] += d[2][axis];
+        }
+        point[Z_AXIS] = start_z + linear_travel * pos / total;
+
+        if(halted) return; // don't queue any more segments
+        this->append_milestone(point, rate_mm_s);
+    }
+
+    this->spline_count++;
+    this->spline_blocks += segments;
+
+    // Ensure last segment arrives at target location.
+    this->append_milestone(target, rate_mm_s);
+}
+
+// G5 X Y I J P Q is a cubic with its first control point I J from the start and its second P Q from the end. I J may be
+// left out after another G5, which continues the curve on smoothly. G5.1 X Y I J is a quadratic with its control point
+// I J from the start, which is the cubic with control points two thirds of the way from the ends to it
+void Robot::compute_spline(Gcode *gcode, float offset[], float target[])
+{
+    if (this->plane_axis_2 != Z_AXIS) {
+        gcode->stream->printf("Error: G5 is only in the XY plane, G17\r\n");
+        return;
+    }
+
+    float c1[2], c2[2];
+    if (gcode->subcode == 1) {
+        for (int axis = X_AXIS; axis <= Y_AXIS; axis++) {
+            float control = this->last_milestone[axis] + offset[axis];
+            c1[axis] = this->last_milestone[axis] + (control - this->last_milestone[axis]) * (2.0F / 3.0F);
+            c2[axis] = target[axis] + (control - target[axis]) * (2.0F / 3.0F);
+        }
+        this->spline_continues = false;
+
+    } else {
+        if (!gcode->has_letter('P') || !gcode->has_letter('Q')) {
+            gcode->stream->printf("Error: G5 needs P and Q\r\n");
+            return;
+        }
+        if (gcode->has_letter('I') || gcode->has_letter('J')) {
+            c1[0] = this->last_milestone[X_AXIS] + offset[X_AXIS];
+            c1[1] = this->last_milestone[Y_AXIS] + offset[Y_AXIS];
+        } else if (this->spline_continues) {
+            // the last curve's second control point reflected through its end
+            c1[0] = this->last_milestone[X_AXIS] + this->spline_tangent[0];
+            c1[1] = this->last_milestone[Y_AXIS] + this->spline_tangent[1];
+        } else {
+            gcode->stream->printf("Error: G5 needs I and J to start a curve\r\n");
+            return;
+        }
+        float p = this->to_millimeters(gcode->get_value('P')), q = this->to_millimeters(gcode->get_value('Q'));
+        c2[0] = target[X_AXIS] + p;
+        c2[1] = target[Y_AXIS] + q;
+        this->spline_tangent[0] = -p;
+        this->spline_tangent[1] = -q;
+        this->spline_continues = true;
+    }
+
+    this->append_spline(gcode, target, c1, c2);
+}
 
 float Robot::theta(float x, float y)
 {
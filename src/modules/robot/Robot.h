@@ -11,12 +11,13 @@
 #include <string>
 using std::string;
 #include <string.h>
-#include <functional>
 
 #include "libs/Module.h"
+#include "libs/AutoReport.h"
 
 class Gcode;
 class BaseSolution;
+class CompensationStrategy;
 class StepperMotor;
 
 class Robot : public Module {
@@ -28,14 +29,31 @@ class Robot : public Module {
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
         void on_halt(void *arg);
+        void on_second_tick(void *arg);
+        void on_idle(void *arg);
+
+        // queues the line held back to have the next ones merged into it, unless next is a move that might be
+        void flush_merged_line(const Gcode *next = nullptr);
+        bool drop_merged_line(uint32_t &tag);
+        // M414, a jog along direction at rate_mm_s for distance mm past what is queued, or with no end if distance < 0
+        bool start_jog(const float direction[3], float rate_mm_s, float distance);
+        void stop_jog();
+        // a Z move relative to the last one, queued straight to the planner without being merged or segmented, so a module
+        // can attach an action to the head block just before and have it run when this move starts
+        void append_z_move(float distance, float rate_mm_s);
 
         void reset_axis_position(float position, int axis);
         void reset_axis_position(float x, float y, float z);
         void reset_position_from_current_actuator_position();
+        // around moves planned with the conveyor in dry run, nothing is stepped so the position, the modes and the
+        // backlash state are put back as they were before at the end, which is after the queue has been emptied
+        void begin_dry_run();
+        void end_dry_run();
         void get_axis_position(float position[]);
         float to_millimeters(float value);
         float from_millimeters(float value);
-        float get_seconds_per_minute() const { return seconds_per_minute; }
+        // with the speed override, which the planner applies to the moves, for anything that works its own feed rate out
+        float get_seconds_per_minute() const;
         float get_z_maxfeedrate() const { return this->max_speeds[2]; }
         void setToolOffset(const float offset[3]);
         float get_feed_rate() const { return feed_rate; }
@@ -45,8 +63,9 @@ class Robot : public Module {
         // gets accessed by Panel, Endstops, ZProbe
         std::vector<StepperMotor*> actuators;
 
-        // set by a leveling strategy to transform the target of a move according to the current plan
-        std::function<void(float[3])> compensationTransform;
+        // set by a leveling strategy to transform the target of a move according to the current plan, it stays owned by the strategy
+        CompensationStrategy* compensation;
+        void set_compensation(CompensationStrategy *c);
 
         struct {
             bool inch_mode:1;                                 // true for inch mode, false for millimeter mode ( default )
@@ -55,18 +74,31 @@ class Robot : public Module {
 
     private:
         void distance_in_gcode_is_known(Gcode* gcode);
-        void append_milestone( float target[], float rate_mm_s);
-        void append_line( Gcode* gcode, float target[], float rate_mm_s);
+        // extra_target is where the actuators after the first three go, by actuator index, nullptr leaves them
+        void append_milestone( float target[], float rate_mm_s, const float extra_target[] = nullptr );
+        void append_milestone( float target[], float transformed_target[], float actuator_pos[], float rate_mm_s, const float extra_target[] = nullptr );
+        void transform_target( const float target[], float transformed_target[] );
+        void transform_targets( const float targets[], float transformed_targets[], size_t n );
+        void update_affine();
+        void append_line( Gcode* gcode, float target[], float rate_mm_s, const float extra_target[] = nullptr );
+        uint16_t adaptive_segments( const float target[], uint16_t max_segments );
+        bool can_merge( const Gcode *gcode ) const;
+        bool fits_merged_line( const float target[] ) const;
+        void merge_line( const float target[], float rate_mm_s );
+        bool blend_corner( const float target[], float rate_mm_s, float start[] );
         //void append_arc(float theta_start, float angular_travel, float radius, float depth, float rate);
         void append_arc( Gcode* gcode, float target[], float offset[], float radius, bool is_clockwise );
 
 
         void compute_arc(Gcode* gcode, float offset[], float target[]);
+        void append_spline( Gcode* gcode, float target[], const float c1[], const float c2[] );
+        void compute_spline(Gcode* gcode, float offset[], float target[]);
 
         float theta(float x, float y);
         void select_plane(uint8_t axis_0, uint8_t axis_1, uint8_t axis_2);
         void clearToolOffset();
         void check_max_actuator_speeds();
+        int format_position(char *buf, size_t size);
 
         float last_milestone[3];                             // Last position, in millimeters
         float transformed_last_milestone[3];                 // Last transformed position
@@ -74,10 +106,13 @@ class Robot : public Module {
         uint8_t plane_axis_0, plane_axis_1, plane_axis_2;    // Current plane ( XY, XZ, YZ )
         float seek_rate;                                     // Current rate for seeking moves ( mm/s )
         float feed_rate;                                     // Current rate for feeding moves ( mm/s )
+        float spindle_pitch;                                 // mm per spindle revolution of the G33 being planned, 0 otherwise
+        bool travel_move;                                    // the move being planned is a G0, for the travel acceleration
         float mm_per_line_segment;                           // Setting : Used to split lines into segments
         float mm_per_arc_segment;                            // Setting : Used to split arcs into segmentrs
         float delta_segments_per_second;                     // Setting : Used to split lines into segments for delta based on speed
-        float seconds_per_minute;                            // for realtime speed change
+        float segment_tolerance;                             // Setting : Max actuator path error allowed when splitting lines, 0 splits uniformly
+        float seconds_per_minute;                            // F is in units per this many seconds, the override is in the planner
 
         // Number of arc generation iterations by small angle approximation before exact arc trajectory
         // correction. This parameter maybe decreased if there are issues with the accuracy of the arc
@@ -85,10 +120,53 @@ class Robot : public Module {
         // of grbl, and should be on the order or greater than the size of the buffer to help with the
         // computational efficiency of generating arcs.
         int arc_correction;                                   // Setting : how often to rectify arc computation
+        float arc_tolerance;                                 // Setting : max chordal error for arcs in mm, 0 uses mm_per_arc_segment
+
+        // consecutive lines that are nearly in line are held back and queued as one block
+        static const int merge_max_lines = 8;
+        float merge_points[merge_max_lines + 1][3];          // where the held line starts, then the end of each line merged into it
+        int merge_count;                                     // lines merged into the held line, 0 if there is none
+        float merge_rate;
+        uint32_t merge_tag;                                  // the conveyor source tag when the held line was started
+        bool merge_travel;                                   // and whether it was a G0, G0 and G1 lines are not merged
+        float merge_tolerance;                               // Setting : max distance of a merged line's ends from the held line in mm, 0 is off
+        float merge_cos;                                     // Setting : cosine of the largest change of direction that is merged
+        float blend_tolerance;                               // G64 P, how far the path may cut a corner between lines in mm, 0 in G61
+        float default_blend_tolerance;                       // Setting : what G64 without P uses, and is on at startup if not 0
+        uint32_t blend_count;
+
+        // a continuous jog, its blocks are queued in on_idle as it goes
+        void feed_jog();
+        float jog_direction[3];                              // a unit vector
+        float jog_rate;
+        float jog_remaining;                                 // mm still to queue, less than 0 for no end
+        uint32_t jog_tag;
+        uint32_t jog_since;                                  // us_ticker_read when it was last started
+        uint32_t jog_timeout_us;                             // Setting : stops the jog if M414 is not sent again within this, 0 for never
+
+        // arc segmentation counters, reported by M235
+        uint32_t arc_count;
+        uint32_t arc_blocks;
+        uint32_t last_arc_blocks;
+        uint32_t spline_count;
+        uint32_t spline_blocks;
+
+        // the next G5's first control point offset when it has no I J, the last one's P Q reversed
+        float spline_tangent[2];
         float max_speeds[3];                                 // Setting : max allowable speed in mm/m for each axis
 
         float toolOffset[3];
 
+        // the skew correction and a linear compensation together, worked out again when either changes
+        float affine[3][4];
+        float skew[3];                                       // Setting : XY XZ YZ skew factors, as M852 I J K
+
+        // streams that asked with M154 for the position every so often
+        AutoReport position_report;
+
+        struct DryRunState;
+        DryRunState *dry_run_state;                          // what end_dry_run() puts back, only during a dry run
+
         // Used by Stepper, Planner
         friend class Planner;
         friend class Stepper;
@@ -99,6 +177,10 @@ class Robot : public Module {
 
         struct {
             bool halted:1;
+            bool spline_continues:1;                          // the last move was a G5, so the next may leave out I J
+            bool jogging:1;
+            bool affine_identity:1;                           // affine does nothing, so is not applied
+            bool compensation_linear:1;                       // compensation is in affine, so is not called
         };
 };
 
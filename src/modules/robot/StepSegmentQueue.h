@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STEPSEGMENTQUEUE_H
+#define STEPSEGMENTQUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+#include "libs/nuts_bolts.h"
+
+// One acceleration tick worth of constant rate stepping, precomputed in the main loop
+struct StepSegment {
+    uint32_t     block_seq;             // sequence number of the block this segment was computed for
+    uint32_t     tick;                  // acceleration tick within the block this segment applies to
+    float        rate;                  // step rate of the main stepper
+    float        steps_per_second[MAX_ROBOT_ACTUATORS + 1];  // per actuator step rate, then the follower's
+    uint32_t     fx_ticks_per_step[MAX_ROBOT_ACTUATORS + 1]; // per actuator 18.14 fixed point ticks per step, ready for StepperMotor
+};
+
+// Single producer (main loop) single consumer (acceleration tick interrupt) ring of segments
+// the producer only writes head, the consumer only writes tail, so no locking is needed
+class StepSegmentQueue {
+    public:
+        static const unsigned int size= 16;
+
+        StepSegmentQueue() : head(0), tail(0) {}
+
+        bool empty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed); }
+        bool full() const { return next(head.load(std::memory_order_relaxed)) == tail.load(std::memory_order_acquire); }
+
+        // producer side, fill in the segment returned by head_ref() then publish it with produce()
+        StepSegment& head_ref() { return ring[head.load(std::memory_order_relaxed)]; }
+        void produce() { head.store(next(head.load(std::memory_order_relaxed)), std::memory_order_release); }
+
+        // consumer side, returns nullptr if there is nothing queued
+        const StepSegment *peek() const { return empty() ? nullptr : &ring[tail.load(std::memory_order_relaxed)]; }
+        void consume() { tail.store(next(tail.load(std::memory_order_relaxed)), std::memory_order_release); }
+
+    private:
+        static unsigned int next(unsigned int i) { return (i + 1) % size; }
+
+        StepSegment ring[size];
+        std::atomic_uint head;
+        std::atomic_uint tail;
+};
+
+#endif
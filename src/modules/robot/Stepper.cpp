@@ -20,24 +20,48 @@
 #include "Gcode.h"
 #include "Block.h"
 #include "StepTicker.h"
+#include "LPC17xx.h"
+#include "StreamOutput.h"
+#include "StreamOutputPool.h"
 
 #include <vector>
 using namespace std;
 
 #include "libs/nuts_bolts.h"
-#include "libs/Hook.h"
 
 #include <mri.h>
 
+#define step_segments_checksum CHECKSUM("step_segments")
+#define acceleration_step_interval_checksum CHECKSUM("acceleration_step_interval")
+#define input_shaper_type_checksum CHECKSUM("input_shaper_type")
+#define input_shaper_frequency_checksum CHECKSUM("input_shaper_frequency")
+#define input_shaper_damping_checksum CHECKSUM("input_shaper_damping")
+
 // The stepper reacts to blocks that have XYZ movement to transform them into actual stepper motor moves
 // TODO: This does accel, accel should be in StepperMotor
 
 Stepper::Stepper()
 {
     this->current_block = NULL;
+    this->follower= nullptr;
     this->paused = false;
     this->force_speed_update = false;
     this->halted= false;
+    this->segment_mode= false;
+    this->spindle_sync= false;
+    this->block_seq= 0;
+    this->block_tick= 0;
+    this->gen_seq= 0;
+    this->gen_done= true;
+    this->gen_shaped_rate= 0;
+    this->gen_shaped_steps= 0;
+    this->accel_step_interval= 0;
+    this->accel_tick= 0;
+    this->decel_tick= 0;
+    this->decel_start_rate= 0;
+    this->hold_state= HOLD_NONE;
+    this->resume_requested= false;
+    this->hold_speed= 0;
 }
 
 //Called when the module has just been loaded
@@ -46,21 +70,22 @@ void Stepper::on_module_loaded()
     this->register_for_event(ON_BLOCK_BEGIN);
     this->register_for_event(ON_BLOCK_END);
     this->register_for_event(ON_GCODE_EXECUTE);
-    this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_gcodes('M', {17, 18, 84, 593});
     this->register_for_event(ON_PLAY);
     this->register_for_event(ON_PAUSE);
     this->register_for_event(ON_HALT);
+    this->register_for_event(ON_IDLE);
 
     // Get onfiguration
     this->on_config_reload(this);
 
     // Acceleration ticker
-    THEKERNEL->step_ticker->register_acceleration_tick_handler([this](){trapezoid_generator_tick(); });
+    THEKERNEL->step_ticker->register_acceleration_tick_handler<Stepper, &Stepper::trapezoid_generator_tick>(this);
+    THEKERNEL->step_ticker->register_step_acceleration_handler<Stepper, &Stepper::step_acceleration_tick>(this);
 
     // Attach to the end_of_move stepper event
-    THEKERNEL->robot->alpha_stepper_motor->attach(this, &Stepper::stepper_motor_finished_move );
-    THEKERNEL->robot->beta_stepper_motor->attach( this, &Stepper::stepper_motor_finished_move );
-    THEKERNEL->robot->gamma_stepper_motor->attach(this, &Stepper::stepper_motor_finished_move );
+    for (StepperMotor *m : THEKERNEL->robot->actuators)
+        m->attach<Stepper, &Stepper::stepper_motor_finished_move>(this);
 }
 
 // Get configuration from the config file
@@ -68,15 +93,36 @@ void Stepper::on_config_reload(void *argument)
 {
     // Steppers start off by default
     this->turn_enable_pins_off();
+
+    // precompute the step rates in the main loop instead of in the acceleration tick
+    this->segment_mode= THEKERNEL->config->value(step_segments_checksum)->by_default(false)->as_bool();
+
+    // or update the rate as a function of the steps done, every so many steps of the main stepper
+    this->accel_step_interval= THEKERNEL->config->value(acceleration_step_interval_checksum)->by_default(0)->as_number();
+
+    // shape the segments to cancel a resonance of the machine, zv, mzv or ei, only used with step_segments
+    InputShaper::TYPE type= InputShaper::type_from_name(THEKERNEL->config->value(input_shaper_type_checksum)->by_default("none")->as_string().c_str());
+    float frequency= THEKERNEL->config->value(input_shaper_frequency_checksum)->by_default(40.0F)->as_number();
+    float damping= THEKERNEL->config->value(input_shaper_damping_checksum)->by_default(0.1F)->as_number();
+    configure_shaper(type, frequency, damping, THEKERNEL->streams);
+}
+
+void Stepper::configure_shaper(InputShaper::TYPE type, float frequency, float damping, StreamOutput *stream)
+{
+    if(!this->shaper.configure(type, frequency, damping, THEKERNEL->acceleration_ticks_per_second)) {
+        stream->printf("WARNING: input shaper %s at %1.2fHz damping %1.3f can't be used at %d acceleration ticks per second, input shaping is off\n",
+                       InputShaper::type_name(type), frequency, damping, (int)THEKERNEL->acceleration_ticks_per_second);
+    } else if(type != InputShaper::NONE && !this->segment_mode) {
+        stream->printf("WARNING: input shaping needs step_segments to be enabled\n");
+    }
 }
 
 // When the play/pause button is set to pause, or a module calls the ON_PAUSE event
 void Stepper::on_pause(void *argument)
 {
     this->paused = true;
-    THEKERNEL->robot->alpha_stepper_motor->pause();
-    THEKERNEL->robot->beta_stepper_motor->pause();
-    THEKERNEL->robot->gamma_stepper_motor->pause();
+    for (StepperMotor *m : THEKERNEL->robot->actuators)
+        m->pause();
 }
 
 // When the play/pause button is set to play, or a module calls the ON_PLAY event
@@ -84,9 +130,8 @@ void Stepper::on_play(void *argument)
 {
     // TODO: Re-compute the whole queue for a cold-start
     this->paused = false;
-    THEKERNEL->robot->alpha_stepper_motor->unpause();
-    THEKERNEL->robot->beta_stepper_motor->unpause();
-    THEKERNEL->robot->gamma_stepper_motor->unpause();
+    for (StepperMotor *m : THEKERNEL->robot->actuators)
+        m->unpause();
 }
 
 void Stepper::on_halt(void *argument)
@@ -94,17 +139,51 @@ void Stepper::on_halt(void *argument)
     if(argument == nullptr) {
         this->turn_enable_pins_off();
         this->halted= true;
+        // the motors were stopped and the queue emptied as the halt began, a hold is over with them
+        if(this->hold_state == HOLD_STOPPED) {
+            this->paused= false;
+            for (StepperMotor *m : THEKERNEL->robot->actuators) m->unpause();
+            if(this->follower != nullptr) this->follower->unpause();
+        }
+        this->hold_state= HOLD_NONE;
+        this->resume_requested= false;
     }else{
         this->halted= false;
     }
 }
 
+// The step timer is stopped first so no step goes out after this, then the motors are told their moves are over. The
+// block they were running is ended by the conveyor, which calls this
+void Stepper::stop_motors()
+{
+    THEKERNEL->step_ticker->halt();
+    for (StepperMotor *m : THEKERNEL->robot->actuators) m->move(m->direction, 0);
+    if(this->follower != nullptr) this->follower->move(this->follower->direction, 0);
+}
+
 void Stepper::on_gcode_received(void *argument)
 {
     Gcode *gcode = static_cast<Gcode *>(argument);
     // Attach gcodes to the last block for on_gcode_execute
     if( gcode->has_m && (gcode->m == 84 || gcode->m == 17 || gcode->m == 18 )) {
         THEKERNEL->conveyor->append_gcode(gcode);
+
+    } else if(gcode->has_m && gcode->m == 593) {
+        // M593 P<0 none, 1 zv, 2 mzv, 3 ei> F<frequency> D<damping ratio>, takes effect from the next segment
+        if(gcode->has_letter('P') || gcode->has_letter('F') || gcode->has_letter('D')) {
+            int p= gcode->has_letter('P') ? gcode->get_int('P') : this->shaper.get_type();
+            if(!gcode->has_letter('P') && p == InputShaper::NONE) p= InputShaper::MZV;
+            InputShaper::TYPE type= (p >= InputShaper::NONE && p <= InputShaper::EI) ? (InputShaper::TYPE)p : InputShaper::NONE;
+            float frequency= gcode->has_letter('F') ? gcode->get_value('F') : this->shaper.get_frequency();
+            if(frequency <= 0.0F) frequency= 40.0F;
+            float damping= gcode->has_letter('D') ? gcode->get_value('D') : (this->shaper.get_type() != InputShaper::NONE ? this->shaper.get_damping() : 0.1F);
+            configure_shaper(type, frequency, damping, gcode->stream);
+        }
+        if(this->shaper.is_enabled()) {
+            gcode->stream->printf("input shaper: %s %1.2fHz damping %1.3f\n", InputShaper::type_name(this->shaper.get_type()), this->shaper.get_frequency(), this->shaper.get_damping());
+        } else {
+            gcode->stream->printf("input shaper: none\n");
+        }
     }
 }
 
@@ -145,7 +224,7 @@ void Stepper::on_block_begin(void *argument)
     Block *block  = static_cast<Block *>(argument);
 
     // Mark the new block as of interrest to us, handle blocks that have no axis moves properly (like Extrude blocks etc)
-    if(block->millimeters > 0.0F && (block->steps[ALPHA_STEPPER] > 0 || block->steps[BETA_STEPPER] > 0 || block->steps[GAMMA_STEPPER] > 0) ) {
+    if(block->millimeters > 0.0F && block->steps_event_count > 0) {
         block->take();
 
     } else {
@@ -162,36 +241,51 @@ void Stepper::on_block_begin(void *argument)
     }
 
     // Setup : instruct stepper motors to move
-    // Find the stepper with the more steps, it's the one the speed calculations will want to follow
-    this->main_stepper= nullptr;
-    if( block->steps[ALPHA_STEPPER] > 0 ) {
-        THEKERNEL->robot->alpha_stepper_motor->move( block->direction_bits[ALPHA_STEPPER], block->steps[ALPHA_STEPPER])->set_moved_last_block(true);
-        this->main_stepper = THEKERNEL->robot->alpha_stepper_motor;
-    }else{
-        THEKERNEL->robot->alpha_stepper_motor->set_moved_last_block(false);
+    // the stepper with the most steps, which the speed calculations follow, and the others' share of its rate are in the block
+    this->main_stepper= THEKERNEL->robot->actuators[block->main_actuator];
+    this->follower= nullptr;
+    for (size_t i = 0; i < THEKERNEL->robot->actuators.size(); i++) {
+        StepperMotor *m= THEKERNEL->robot->actuators[i];
+        if( block->steps[i] > 0 ) {
+            m->move( block->direction_bits[i], block->steps[i])->set_moved_last_block(true);
+            // the steps taking up backlash don't move the axis, so they are taken off the position they will add to
+            if(block->backlash_steps[i] > 0)
+                m->current_position_steps += block->direction_bits[i] ? block->backlash_steps[i] : -(int32_t)block->backlash_steps[i];
+        }else{
+            m->set_moved_last_block(false);
+        }
     }
 
-    if( block->steps[BETA_STEPPER ] > 0 ) {
-        THEKERNEL->robot->beta_stepper_motor->move(  block->direction_bits[BETA_STEPPER], block->steps[BETA_STEPPER ])->set_moved_last_block(true);
-        if(this->main_stepper == nullptr || THEKERNEL->robot->beta_stepper_motor->get_steps_to_move() > this->main_stepper->get_steps_to_move())
-            this->main_stepper = THEKERNEL->robot->beta_stepper_motor;
-    }else{
-        THEKERNEL->robot->beta_stepper_motor->set_moved_last_block(false);
-    }
-
-    if( block->steps[GAMMA_STEPPER] > 0 ) {
-        THEKERNEL->robot->gamma_stepper_motor->move( block->direction_bits[GAMMA_STEPPER], block->steps[GAMMA_STEPPER])->set_moved_last_block(true);
-        if(this->main_stepper == nullptr || THEKERNEL->robot->gamma_stepper_motor->get_steps_to_move() > this->main_stepper->get_steps_to_move())
-            this->main_stepper = THEKERNEL->robot->gamma_stepper_motor;
-    }else{
-        THEKERNEL->robot->gamma_stepper_motor->set_moved_last_block(false);
-    }
+#ifdef FIXED_POINT_STEPPING
+    this->fixed_tick_scale= StepperMotor::fixed_tick_scale();
+#endif
 
     this->current_block = block;
+    this->block_seq++;
+    this->block_tick= 0;
+    this->spindle_sync= false;
 
     // Setup acceleration for this block
     this->trapezoid_generator_reset();
 
+    if(this->accel_step_interval > 0) {
+        // start at the rate for the middle of the first interval and let the main stepper ask for the rest
+        this->trapezoid_adjusted_rate= rate_at_step(block, this->accel_step_interval * 0.5F);
+        this->main_stepper->set_acceleration_step_interval(this->accel_step_interval);
+    }
+
+    // in a hold, or coming out of one, a block can't start any faster than the one before it left off
+    if(this->hold_state == HOLD_RESUMING || this->hold_state == HOLD_SLOWING) {
+        float carry= this->hold_speed * block->steps_event_count / block->millimeters;
+        if(carry < block->rate_delta * 1.5F) carry= block->rate_delta * 1.5F;
+        if(carry + block->rate_delta < this->trapezoid_adjusted_rate) {
+            this->trapezoid_adjusted_rate= carry;
+            if(this->hold_state == HOLD_RESUMING) resume_block(block, carry, 0);
+        } else if(this->hold_state == HOLD_RESUMING) {
+            this->hold_state= HOLD_NONE;
+        }
+    }
+
     // Set the initial speed for this move
     this->trapezoid_generator_tick();
 
@@ -199,7 +293,7 @@ void Stepper::on_block_begin(void *argument)
     THEKERNEL->step_ticker->synchronize_acceleration(false);
 
     // set a flag to synchronize the acceleration timer with the deceleration step, and fire it immediately we get to that step
-    if( block->decelerate_after > 0 && block->decelerate_after+1 < this->main_stepper->steps_to_move ) {
+    if( this->accel_step_interval == 0 && block->decelerate_after > 0 && block->decelerate_after+1 < this->main_stepper->steps_to_move ) {
         this->main_stepper->signal_step= block->decelerate_after+1; // we make it +1 as deceleration does not start until steps > decelerate_after
     }
 }
@@ -207,15 +301,170 @@ void Stepper::on_block_begin(void *argument)
 // Current block is discarded
 void Stepper::on_block_end(void *argument)
 {
+    const Block *block= static_cast<const Block *>(argument);
+    if(block == this->current_block && block->steps_event_count > 0)
+        this->hold_speed= this->trapezoid_adjusted_rate * block->millimeters / block->steps_event_count;
+
     this->current_block = NULL; //stfu !
+    this->follower= nullptr;
+    this->spindle_sync= false;
+}
+
+// Sets the rate of a spindle synchronized block (G33), which the spindle module calls as it measures the spindle's position.
+// From the first call the trapezoid is only used to stop the block when the queue is flushed, until then, or without a
+// spindle module, the block runs at its planned feed rate like any other
+void Stepper::set_synchronized_rate(float rate)
+{
+    const Block *block= this->current_block;
+    if(block == nullptr || block->spindle_pitch <= 0.0F || this->paused || this->hold_state != HOLD_NONE || THEKERNEL->conveyor->is_flushing()) return;
+    this->spindle_sync= true;
+    this->trapezoid_adjusted_rate= rate;
+    this->set_step_events_per_second(rate);
+}
+
+// Replans what is left of the running block for a new nominal rate, starting from the rate it is at now, so a speed
+// override is felt straight away even on a long move. The final rate is kept, as the next block is planned to start from
+// it. Only the trapezoid made in the acceleration tick can be replanned, with precomputed segments, step synchronous
+// acceleration or an S-curve the block finishes as it was planned, false if so
+bool Stepper::retarget_current_block(Block *block, unsigned int nominal_rate)
+{
+    if(block != this->current_block || this->segment_mode || this->accel_step_interval > 0 || block->s_curve ||
+       this->spindle_sync || this->paused || this->hold_state != HOLD_NONE || this->force_speed_update ||
+       THEKERNEL->conveyor->is_flushing()) return false;
+
+    if(nominal_rate < block->final_rate) nominal_rate= block->final_rate;
+
+    __disable_irq();
+    unsigned int stepped= this->main_stepper->stepped;
+    // once it has begun slowing down for its end there is nothing to gain
+    if(block != this->current_block || stepped == 0 || stepped > block->decelerate_after) {
+        __enable_irq();
+        return false;
+    }
+    block->nominal_rate= nominal_rate;
+    reshape_block(block, this->trapezoid_adjusted_rate, stepped);
+    __enable_irq();
+    return true;
+}
+
+// Plans what is left of the running block, from rate at stepped up or down to its nominal rate and then down to its final
+// rate, for the linear ramp in the acceleration tick. Called with interrupts off
+void Stepper::reshape_block(Block *block, float r, unsigned int stepped)
+{
+    float n= block->nominal_rate;
+    float f= block->final_rate;
+    float acceleration= block->rate_delta * THEKERNEL->acceleration_ticks_per_second; // steps/s^2
+    float left= block->steps_event_count - stepped;
+    unsigned int before= stepped > 0 ? stepped - 1 : 0;
+    float change= (n * n - r * r) / (2.0F * acceleration); // negative when slowing down to the new rate
+    float decel= (n * n - f * f) / (2.0F * acceleration);
+
+    if(fabsf(change) + decel <= left) {
+        // gets to the new rate and cruises, the cruise in the acceleration tick comes down to a lower rate at the acceleration
+        block->accelerate_until= change > 0.0F ? stepped + (unsigned int)ceilf(change) : before;
+        block->decelerate_after= block->steps_event_count - (unsigned int)floorf(decel);
+        block->peak_rate= n;
+    } else if(change > 0.0F) {
+        // too short to get there, speed up as far as it can and still slow down in time
+        float up= block->intersection_distance(r, f, acceleration, left);
+        up= min(max(up, 0.0F), left);
+        block->accelerate_until= block->decelerate_after= stepped + (unsigned int)ceilf(up);
+        block->peak_rate= sqrtf(r * r + 2.0F * acceleration * up);
+    } else {
+        // slow down from here to the end
+        block->accelerate_until= before;
+        block->decelerate_after= stepped;
+        block->peak_rate= r;
+    }
+
+    if(block->decelerate_after + 1 < this->main_stepper->steps_to_move)
+        this->main_stepper->signal_step= block->decelerate_after + 1;
+}
+
+// Slows down at the acceleration, into the blocks after this one if need be, and the acceleration tick stops the motors
+// where they are once it gets there
+void Stepper::feed_hold()
+{
+    __disable_irq();
+    bool holding= !this->halted && (this->hold_state == HOLD_NONE || this->hold_state == HOLD_RESUMING);
+    if(holding) {
+        // a block that begins while nothing is moving starts from standstill
+        if(this->current_block == nullptr) this->hold_speed= 0.0F;
+        this->hold_state= HOLD_SLOWING;
+    }
+    this->resume_requested= false;
+    __enable_irq();
+    if(holding && this->hold_hook) this->hold_hook(true);
+}
+
+// Plans the block to get going again from rate at stepped, back up to its nominal rate with the linear ramp whichever
+// way it was planned, and ending as fast as it can get to by its end if that is below the final rate it was planned with
+void Stepper::resume_block(Block *block, float r, unsigned int stepped)
+{
+    float acceleration= block->rate_delta * THEKERNEL->acceleration_ticks_per_second; // steps/s^2
+    float reach= sqrtf(r * r + 2.0F * acceleration * (block->steps_event_count - stepped));
+    if(reach < block->final_rate) {
+        block->final_rate= reach;
+        block->exit_speed= reach * block->millimeters / block->steps_event_count;
+    }
+    if(block->nominal_rate < block->final_rate) block->nominal_rate= block->final_rate;
+    reshape_block(block, r, stepped);
+    this->hold_state= HOLD_RESUMING;
+}
+
+// The rest of the running block is planned again from where the hold left it, then the queued blocks from its new exit
+// speed, before the motors start again so the block can't end with the queue still planned for the old one
+void Stepper::resume_from_hold()
+{
+    this->resume_requested= false;
+
+    __disable_irq();
+    Block *block= this->current_block;
+    bool stopped= this->hold_state == HOLD_STOPPED;
+    if(block == nullptr || this->hold_state == HOLD_NONE) {
+        this->hold_state= HOLD_NONE;
+        __enable_irq();
+        return;
+    }
+    resume_block(block, this->trapezoid_adjusted_rate, this->main_stepper->stepped);
+    __enable_irq();
+
+    THEKERNEL->planner->replan_queue();
+
+    if(stopped) {
+        __disable_irq();
+        this->paused= false;
+        for (StepperMotor *m : THEKERNEL->robot->actuators) m->unpause();
+        if(this->follower != nullptr) this->follower->unpause();
+        __enable_irq();
+    }
+}
+
+// Called from ON_BLOCK_BEGIN once the motor has been given its move for the block, the motor's rate is then set along with
+// the actuators' every time theirs is, from the same precomputed segments, so it stays in step with them for the whole block.
+// false if we are not stepping this block
+bool Stepper::follow(const Block *block, StepperMotor *motor)
+{
+    if(block != this->current_block || motor->get_steps_to_move() == 0) return false;
+
+    this->follower_steps= motor->get_steps_to_move();
+#ifdef FIXED_POINT_STEPPING
+    this->follower_rate_ratio= ((uint64_t)this->follower_steps << rate_ratio_bits) / block->steps_event_count;
+    motor->set_speed(this->trapezoid_adjusted_rate * this->follower_steps / block->steps_event_count);
+#else
+    this->follower_ratio= (float)this->follower_steps / block->steps_event_count;
+    motor->set_speed(this->trapezoid_adjusted_rate * this->follower_ratio);
+#endif
+    this->follower= motor;
+    return true;
 }
 
 // When a stepper motor has finished it's assigned movement
 uint32_t Stepper::stepper_motor_finished_move(uint32_t dummy)
 {
     // We care only if none is still moving
-    if( THEKERNEL->robot->alpha_stepper_motor->moving || THEKERNEL->robot->beta_stepper_motor->moving || THEKERNEL->robot->gamma_stepper_motor->moving ) {
-        return 0;
+    for (StepperMotor *m : THEKERNEL->robot->actuators) {
+        if( m->moving ) return 0;
     }
 
     // This block is finished, release it
@@ -236,6 +485,30 @@ void Stepper::trapezoid_generator_tick(void)
     // Do not do the accel math for nothing
     if(this->current_block && !this->paused && this->main_stepper->moving ) {
 
+        // with step synchronous acceleration the timer only sets the initial rate and decelerates when flushing
+        // and in a hold, or coming out of one, it is the linear ramp here whichever way the block was planned
+        bool own_ramp= this->hold_state == HOLD_NONE;
+        if(this->accel_step_interval > 0 && own_ramp && !this->force_speed_update && !THEKERNEL->conveyor->is_flushing()) return;
+        if(this->spindle_sync && own_ramp && !this->force_speed_update && !THEKERNEL->conveyor->is_flushing()) return;
+        bool s_curve= this->current_block->s_curve && own_ramp;
+
+        // S-curve ramps are a function of time into the ramp, so count ticks here whichever way the rate ends up being set
+        if(this->current_block->s_curve && !this->force_speed_update) {
+            uint32_t stepped= this->main_stepper->stepped;
+            if(stepped <= this->current_block->accelerate_until) {
+                this->accel_tick++;
+            } else if(stepped > this->current_block->decelerate_after && this->decel_tick++ == 0) {
+                // the ramp down starts from wherever acceleration got to, which is the peak unless the block was cut short
+                this->decel_start_rate= this->trapezoid_adjusted_rate;
+            }
+        }
+
+        // use the rate precomputed by the main loop if there is one for this tick, otherwise fall back to doing it here
+        if(this->segment_mode && !this->force_speed_update) {
+            this->block_tick++;
+            if(!THEKERNEL->conveyor->is_flushing() && own_ramp && apply_next_segment()) return;
+        }
+
         // Store this here because we use it a lot down there
         uint32_t current_steps_completed = this->main_stepper->stepped;
         float last_rate= trapezoid_adjusted_rate;
@@ -260,10 +533,34 @@ void Stepper::trapezoid_generator_tick(void)
                 trapezoid_adjusted_rate = current_block->rate_delta * 0.5F;
             }
 
+        } else if(this->hold_state == HOLD_SLOWING || this->hold_state == HOLD_STOPPED) {
+            // feed hold, slow down to the slowest the block runs at then stop the motors where they are
+            if (trapezoid_adjusted_rate > current_block->rate_delta * 2.5F) {
+                trapezoid_adjusted_rate -= current_block->rate_delta;
+
+            } else {
+                trapezoid_adjusted_rate = current_block->rate_delta * 1.5F;
+                this->paused = true;
+                for (StepperMotor *m : THEKERNEL->robot->actuators) m->pause();
+                if (this->follower != nullptr) this->follower->pause();
+                this->hold_state = HOLD_STOPPED;
+                THEKERNEL->call_event(ON_SPEED_CHANGE, 0); // tell others we stopped
+                return;
+            }
+
+#ifdef FIXED_POINT_STEPPING
+        } else if(!s_curve) {
+            this->fixed_ramp_tick(current_steps_completed);
+            return;
+#endif
         } else if(current_steps_completed <= this->current_block->accelerate_until) {
             // If we are accelerating
             // Increase speed
-            this->trapezoid_adjusted_rate += this->current_block->rate_delta;
+            if(s_curve) {
+                this->trapezoid_adjusted_rate = Block::s_curve_rate(this->current_block->initial_rate, this->current_block->peak_rate, this->accel_tick, this->current_block->accelerate_ticks);
+            } else {
+                this->trapezoid_adjusted_rate += this->current_block->rate_delta;
+            }
             if (this->trapezoid_adjusted_rate > this->current_block->nominal_rate ) {
                 this->trapezoid_adjusted_rate = this->current_block->nominal_rate;
             }
@@ -273,7 +570,10 @@ void Stepper::trapezoid_generator_tick(void)
             // Reduce speed
             // NOTE: We will only reduce speed if the result will be > 0. This catches small
             // rounding errors that might leave steps hanging after the last trapezoid tick.
-            if(this->trapezoid_adjusted_rate > this->current_block->rate_delta * 1.5F) {
+            if(s_curve) {
+                this->trapezoid_adjusted_rate = max(Block::s_curve_rate(this->decel_start_rate, this->current_block->final_rate, this->decel_tick, this->current_block->decelerate_ticks),
+                                                    this->current_block->rate_delta * 1.5F);
+            } else if(this->trapezoid_adjusted_rate > this->current_block->rate_delta * 1.5F) {
                 this->trapezoid_adjusted_rate -= this->current_block->rate_delta;
             } else {
                 this->trapezoid_adjusted_rate = this->current_block->rate_delta * 1.5F;
@@ -284,8 +584,12 @@ void Stepper::trapezoid_generator_tick(void)
 
         } else if (trapezoid_adjusted_rate != current_block->nominal_rate) {
             // If we are cruising
-            // Make sure we cruise at exactly nominal rate
-            this->trapezoid_adjusted_rate = this->current_block->nominal_rate;
+            // Make sure we cruise at exactly nominal rate, coming down to it at the acceleration if an override lowered it
+            if(this->trapezoid_adjusted_rate > this->current_block->nominal_rate + this->current_block->rate_delta) {
+                this->trapezoid_adjusted_rate -= this->current_block->rate_delta;
+            } else {
+                this->trapezoid_adjusted_rate = this->current_block->nominal_rate;
+            }
         }
 
         if(last_rate != trapezoid_adjusted_rate) {
@@ -295,32 +599,257 @@ void Stepper::trapezoid_generator_tick(void)
     }
 }
 
+// Called from the acceleration interrupt every accel_step_interval steps of the main stepper, sets the rate for the
+// middle of the next interval from the steps done so far, so short blocks are not limited by the acceleration tick
+void Stepper::step_acceleration_tick(void)
+{
+    const Block *block= this->current_block;
+    if(block == nullptr || this->paused || this->spindle_sync || this->hold_state != HOLD_NONE || !this->main_stepper->moving ||
+       THEKERNEL->conveyor->is_flushing()) return;
+
+    uint32_t stepped= this->main_stepper->stepped;
+    if(stepped > block->accelerate_until && stepped <= block->decelerate_after) {
+        // nothing to do while cruising, skip ahead to where deceleration starts
+        this->main_stepper->next_accel_step= block->decelerate_after + 1;
+    }
+
+    float rate= rate_at_step(block, stepped + this->accel_step_interval * 0.5F);
+    if(rate != this->trapezoid_adjusted_rate) {
+        this->trapezoid_adjusted_rate= rate;
+        this->set_step_events_per_second(rate);
+    }
+}
+
+// The rate the trapezoid has at a given step of the main stepper, from v^2 = v0^2 + 2as
+float Stepper::rate_at_step(const Block *block, float step) const
+{
+    float acceleration= block->rate_delta * THEKERNEL->acceleration_ticks_per_second; // steps/s^2
+    float rate;
+    if(step <= block->accelerate_until) {
+        rate= sqrtf((float)block->initial_rate * block->initial_rate + 2.0F * acceleration * step);
+
+    } else if(step > block->decelerate_after) {
+        float r2= block->peak_rate * block->peak_rate - 2.0F * acceleration * (step - block->decelerate_after);
+        rate= r2 > 0.0F ? sqrtf(r2) : 0.0F;
+        if(rate < block->final_rate) rate= block->final_rate;
+        // never stop short of the end of the block
+        if(rate < block->rate_delta * 1.5F) rate= block->rate_delta * 1.5F;
+
+    } else {
+        return block->nominal_rate;
+    }
+
+    return min(rate, (float)block->nominal_rate);
+}
+
+// Pop the segment for the current tick and set the motors to its precomputed rates, returns false if there was none
+// any segments left over from a previous block or for ticks that have already passed are discarded
+bool Stepper::apply_next_segment()
+{
+    const StepSegment *s;
+    while((s= this->segments.peek()) != nullptr && (s->block_seq != this->block_seq || s->tick < this->block_tick)) {
+        this->segments.consume();
+    }
+    if(s == nullptr || s->tick != this->block_tick) return false;
+
+    this->trapezoid_adjusted_rate= s->rate;
+    const std::vector<StepperMotor*>& actuators= THEKERNEL->robot->actuators;
+    for (size_t i = 0; i < actuators.size(); ++i) {
+        if(actuators[i]->moving && s->fx_ticks_per_step[i] != 0) actuators[i]->set_fx_ticks_per_step(s->fx_ticks_per_step[i], s->steps_per_second[i]);
+    }
+    // segments made before the follower joined the block don't have its rate
+    StepperMotor *f= this->follower;
+    if(f != nullptr && f->moving && s->fx_ticks_per_step[MAX_ROBOT_ACTUATORS] != 0)
+        f->set_fx_ticks_per_step(s->fx_ticks_per_step[MAX_ROBOT_ACTUATORS], s->steps_per_second[MAX_ROBOT_ACTUATORS]);
+    this->segments.consume();
+
+    // Other modules might want to know the speed changed
+    THEKERNEL->call_event(ON_SPEED_CHANGE, this);
+    return true;
+}
+
+// Runs the same trapezoid as trapezoid_generator_tick() ahead of time, one segment per acceleration tick, using a predicted
+// step count for the main stepper. If we fall behind the acceleration tick we resynchronize to where the motors actually are
+void Stepper::fill_segment_queue()
+{
+    const Block *block= this->current_block; // can be changed by the end of block interrupt at any time
+    if(block == nullptr || this->paused || this->halted || this->spindle_sync || this->hold_state != HOLD_NONE ||
+       THEKERNEL->conveyor->is_flushing()) return;
+
+    uint32_t seq= this->block_seq;
+    uint32_t now= this->block_tick;
+    if(block != this->current_block || seq != this->block_seq) return; // a new block started while we were reading
+
+    if(seq != this->gen_seq || this->gen_tick < now) {
+        this->gen_seq= seq;
+        this->gen_tick= now;
+        this->gen_rate= this->trapezoid_adjusted_rate;
+        this->gen_steps= (now == 0) ? 0 : this->main_stepper->stepped;
+        this->gen_accel_tick= this->accel_tick;
+        this->gen_decel_tick= this->decel_tick;
+        this->gen_decel_start_rate= this->decel_start_rate;
+        this->gen_shaped_rate= this->gen_rate;
+        this->gen_shaped_steps= this->gen_steps;
+        this->gen_done= false;
+        // nothing carries over from a stop
+        if(now == 0 && block->entry_speed < 0.001F) this->shaper.reset(0.0F);
+    }
+
+    // the actuators, with nothing for any that aren't configured, then the follower
+    StepperMotor *motors[MAX_ROBOT_ACTUATORS + 1];
+    unsigned int steps[MAX_ROBOT_ACTUATORS + 1];
+    for (int i = 0; i < MAX_ROBOT_ACTUATORS; ++i) {
+        motors[i]= i < (int)THEKERNEL->robot->actuators.size() ? THEKERNEL->robot->actuators[i] : nullptr;
+        steps[i]= motors[i] != nullptr ? block->steps[i] : 0;
+    }
+    motors[MAX_ROBOT_ACTUATORS]= this->follower;
+    steps[MAX_ROBOT_ACTUATORS]= motors[MAX_ROBOT_ACTUATORS] != nullptr ? this->follower_steps : 0;
+    float dt= 1.0F / THEKERNEL->acceleration_ticks_per_second;
+    // the shaper works on the path speed so it carries on smoothly from one block to the next
+    bool shaping= this->shaper.is_enabled();
+    float mm_per_step= block->millimeters / block->steps_event_count;
+    while(!this->gen_done && !this->segments.full()) {
+        this->gen_steps += this->gen_rate * dt;
+        if(shaping) this->gen_shaped_steps += this->gen_shaped_rate * dt;
+        if((shaping ? this->gen_shaped_steps : this->gen_steps) >= block->steps_event_count) {
+            // the block will be over before the next tick
+            this->gen_done= true;
+            break;
+        }
+
+        if(this->gen_steps >= block->steps_event_count) {
+            // the shaped motion lags the trapezoid, which waits at its final rate for it to catch up
+            this->gen_rate= block->final_rate;
+
+        } else if(this->gen_steps <= block->accelerate_until) {
+            if(block->s_curve) {
+                this->gen_rate= Block::s_curve_rate(block->initial_rate, block->peak_rate, ++this->gen_accel_tick, block->accelerate_ticks);
+            } else {
+                this->gen_rate += block->rate_delta;
+            }
+            if(this->gen_rate > block->nominal_rate) this->gen_rate= block->nominal_rate;
+
+        } else if(this->gen_steps > block->decelerate_after) {
+            if(block->s_curve) {
+                if(this->gen_decel_tick++ == 0) this->gen_decel_start_rate= this->gen_rate;
+                this->gen_rate= max(Block::s_curve_rate(this->gen_decel_start_rate, block->final_rate, this->gen_decel_tick, block->decelerate_ticks), block->rate_delta * 1.5F);
+            } else if(this->gen_rate > block->rate_delta * 1.5F) {
+                this->gen_rate -= block->rate_delta;
+            } else {
+                this->gen_rate = block->rate_delta * 1.5F;
+            }
+            if(this->gen_rate < block->final_rate) this->gen_rate= block->final_rate;
+
+        } else {
+            this->gen_rate= block->nominal_rate;
+        }
+
+        float rate= this->gen_rate;
+        if(shaping) {
+            rate= this->shaper.shape(this->gen_rate * mm_per_step) / mm_per_step;
+            if(rate > block->nominal_rate) rate= block->nominal_rate;
+            if(rate < block->rate_delta * 1.5F) rate= block->rate_delta * 1.5F;
+            this->gen_shaped_rate= rate;
+        }
+
+        StepSegment& seg= this->segments.head_ref();
+        seg.block_seq= seq;
+        seg.tick= ++this->gen_tick;
+        seg.rate= rate;
+        float isps= rate / block->steps_event_count;
+        for (int i = 0; i <= MAX_ROBOT_ACTUATORS; ++i) {
+            seg.steps_per_second[i]= isps * steps[i];
+            seg.fx_ticks_per_step[i]= steps[i] > 0 ? motors[i]->get_fx_ticks_per_step(seg.steps_per_second[i]) : 0;
+        }
+        this->segments.produce();
+    }
+}
+
+void Stepper::on_idle(void *argument)
+{
+    if(this->resume_requested) this->resume_from_hold();
+    if(this->segment_mode && this->accel_step_interval == 0) this->fill_segment_queue();
+}
+
 // Initializes the trapezoid generator from the current block. Called whenever a new
 // block begins.
 inline void Stepper::trapezoid_generator_reset()
 {
     this->trapezoid_adjusted_rate = this->current_block->initial_rate;
     this->force_speed_update = true;
+    this->accel_tick= 0;
+    this->decel_tick= 0;
 }
 
 // Update the speed for all steppers
 void Stepper::set_step_events_per_second( float steps_per_second )
 {
-    float isps= steps_per_second / this->current_block->steps_event_count;
-
+#ifdef FIXED_POINT_STEPPING
+    this->set_fixed_step_rate(StepperMotor::to_fixed_rate(steps_per_second));
+#else
     // Instruct the stepper motors
-    if( THEKERNEL->robot->alpha_stepper_motor->moving ) {
-        THEKERNEL->robot->alpha_stepper_motor->set_speed(isps * this->current_block->steps[ALPHA_STEPPER]);
+    const Block *block= this->current_block;
+    const std::vector<StepperMotor*>& actuators= THEKERNEL->robot->actuators;
+    for (size_t i = 0; i < actuators.size(); i++) {
+        if( actuators[i]->moving ) actuators[i]->set_speed(steps_per_second * block->step_ratio[i]);
+    }
+    StepperMotor *f= this->follower;
+    if( f != nullptr && f->moving ) {
+        f->set_speed(steps_per_second * this->follower_ratio);
     }
-    if( THEKERNEL->robot->beta_stepper_motor->moving  ) {
-        THEKERNEL->robot->beta_stepper_motor->set_speed(isps * this->current_block->steps[BETA_STEPPER]);
+
+    // Other modules might want to know the speed changed
+    THEKERNEL->call_event(ON_SPEED_CHANGE, this);
+#endif
+}
+
+#ifdef FIXED_POINT_STEPPING
+// The linear ramp of the acceleration tick in fixed point, the block's rates other than rate_delta are whole steps/s already.
+// The rate is taken from and put back in trapezoid_adjusted_rate so everything else sees it as it always has
+void Stepper::fixed_ramp_tick(uint32_t stepped)
+{
+    const Block *block= this->current_block;
+    uint32_t rate= StepperMotor::to_fixed_rate(this->trapezoid_adjusted_rate);
+    uint32_t last_rate= rate;
+    uint32_t delta= block->fixed_rate_delta;
+    uint32_t nominal= block->nominal_rate << StepperMotor::fixed_rate_bits;
+
+    if(stepped <= block->accelerate_until) {
+        rate+= delta;
+        if(rate > nominal) rate= nominal;
+
+    } else if(stepped > block->decelerate_after) {
+        // as with floats we don't slow down below one and a half rate_delta, to not leave steps hanging
+        uint32_t slowest= delta + (delta >> 1);
+        rate= (rate > slowest) ? rate - delta : slowest;
+        uint32_t final= block->final_rate << StepperMotor::fixed_rate_bits;
+        if(rate < final) rate= final;
+
+    } else if(rate != nominal) {
+        rate= (rate > nominal + delta) ? rate - delta : nominal;
+    }
+
+    if(rate != last_rate) {
+        this->trapezoid_adjusted_rate= rate * (1.0F / (1 << StepperMotor::fixed_rate_bits));
+        this->set_fixed_step_rate(rate);
+    }
+}
+
+// set_step_events_per_second for a fixed point rate, each actuator's rate is one 32x32 multiply from its ratio
+void Stepper::set_fixed_step_rate(uint32_t rate)
+{
+    const std::vector<StepperMotor*>& actuators= THEKERNEL->robot->actuators;
+    for (size_t i = 0; i < actuators.size(); i++) {
+        if( actuators[i]->moving ) actuators[i]->set_fixed_speed(((uint64_t)rate * this->current_block->rate_ratio[i]) >> rate_ratio_bits, this->fixed_tick_scale);
     }
-    if( THEKERNEL->robot->gamma_stepper_motor->moving ) {
-        THEKERNEL->robot->gamma_stepper_motor->set_speed(isps * this->current_block->steps[GAMMA_STEPPER]);
+    StepperMotor *f= this->follower;
+    if( f != nullptr && f->moving ) {
+        f->set_fixed_speed(((uint64_t)rate * this->follower_rate_ratio) >> rate_ratio_bits, this->fixed_tick_scale);
     }
 
     // Other modules might want to know the speed changed
     THEKERNEL->call_event(ON_SPEED_CHANGE, this);
 }
+#endif
 
 
@@ -9,8 +9,13 @@
 #define STEPPER_H
 
 #include "libs/Module.h"
+#include "StepSegmentQueue.h"
+#include "InputShaper.h"
+#include "libs/Callback.h"
 #include <stdint.h>
 
+class StreamOutput;
+
 class Block;
 class StepperMotor;
 
@@ -27,28 +32,105 @@ public:
     void on_play(void *argument);
     void on_pause(void *argument);
     void on_halt(void *argument);
+    void on_idle(void *argument);
     uint32_t main_interrupt(uint32_t dummy);
     void trapezoid_generator_reset();
     void set_step_events_per_second(float);
     void trapezoid_generator_tick(void);
+    void step_acceleration_tick(void);
+    void fill_segment_queue();
     uint32_t stepper_motor_finished_move(uint32_t dummy);
     int config_step_timer( int cycles );
     void turn_enable_pins_on();
     void turn_enable_pins_off();
+    // stops every motor where it is without decelerating, for a halt, with interrupts disabled
+    void stop_motors();
+
+    bool follow(const Block *block, StepperMotor *motor);
+    void set_synchronized_rate(float rate);
+    bool retarget_current_block(Block *block, unsigned int nominal_rate);
+
+    // feed hold and resume, the realtime ! and ~, both can be called from an interrupt
+    enum HOLD_STATE { HOLD_NONE, HOLD_SLOWING, HOLD_STOPPED, HOLD_RESUMING };
+    void feed_hold();
+    void resume() {
+        if(this->hold_state == HOLD_NONE) return;
+        this->resume_requested= true;
+        if(this->hold_hook) this->hold_hook(false);
+    }
+    // told of each feed hold, with true, and resume, for board_sync to pass them on
+    template<typename T, void (T::*fptr)(bool)> void attach_hold_hook(T *optr) { this->hold_hook= Callback<void(bool)>::bind<T, fptr>(optr); }
+    uint8_t get_hold_state() const { return this->hold_state; }
 
     float get_trapezoid_adjusted_rate() const { return trapezoid_adjusted_rate; }
     const Block *get_current_block() const { return current_block; }
+    // the actuator with the most steps in the current block, the others step in proportion to it
+    StepperMotor *get_main_stepper() const { return main_stepper; }
+#ifdef FIXED_POINT_STEPPING
+    // the fraction bits of Block::rate_ratio
+    static const uint32_t rate_ratio_bits= 24;
+#endif
 
 private:
+    bool apply_next_segment();
+    void configure_shaper(InputShaper::TYPE type, float frequency, float damping, StreamOutput *stream);
+    float rate_at_step(const Block *block, float step) const;
+    void reshape_block(Block *block, float rate, unsigned int stepped);
+    void resume_block(Block *block, float rate, unsigned int stepped);
+    void resume_from_hold();
+#ifdef FIXED_POINT_STEPPING
+    void fixed_ramp_tick(uint32_t stepped);
+    void set_fixed_step_rate(uint32_t rate);
+#endif
+
     Block *current_block;
     float trapezoid_adjusted_rate;
     StepperMotor *main_stepper;
 
+    // a motor that is not one of the actuators but is stepped in proportion with them for this block, ie an extruder
+    StepperMotor * volatile follower;
+    unsigned int follower_steps;
+#ifdef FIXED_POINT_STEPPING
+    uint32_t follower_rate_ratio;   // its share of the rate, as the actuators' Block::rate_ratio
+    uint32_t fixed_tick_scale;
+#else
+    float follower_ratio;           // its share of the rate, as the actuators' Block::step_ratio
+#endif
+
+    // precomputed step rates, filled in the main loop and consumed by the acceleration tick
+    StepSegmentQueue segments;
+    volatile uint32_t block_seq;  // incremented for each block we start, as Block pointers get reused by the queue
+    volatile uint32_t block_tick; // acceleration ticks since the current block started
+    uint32_t gen_seq;             // block the generator is working on
+    uint32_t gen_tick;
+    float gen_rate;
+    float gen_steps;              // predicted steps completed by the main stepper
+    uint32_t accel_step_interval; // update the rate every this many main stepper steps instead of every acceleration tick, 0 is off
+    uint32_t gen_accel_tick;
+    uint32_t gen_decel_tick;
+    float gen_decel_start_rate;
+    float gen_shaped_rate;        // when shaping, what the main stepper is actually given, gen_rate is the trapezoid
+    float gen_shaped_steps;
+    InputShaper shaper;           // shapes the path speed of the segments
+
+    // acceleration ticks into the current ramp, for S-curve blocks
+    uint32_t accel_tick;
+    uint32_t decel_tick;
+    float decel_start_rate;
+
+    volatile uint8_t hold_state;
+    volatile bool resume_requested;
+    float hold_speed;             // mm/s the last block ended at, the block after it carries on from there in a hold
+    Callback<void(bool)> hold_hook;
+
     struct {
         bool enable_pins_status:1;
         bool force_speed_update:1;
         bool paused:1;
         bool halted:1;
+        bool segment_mode:1;
+        bool gen_done:1;
+        bool spindle_sync:1;      // the current block's rate is set by set_synchronized_rate() instead of the trapezoid
     };
 
 };
@@ -3,6 +3,8 @@
 #define BASESOLUTION_H
 
 #include <map>
+#include <string.h>
+#include <stddef.h>
 class Config;
 
 class BaseSolution {
@@ -12,6 +14,16 @@ class BaseSolution {
         virtual ~BaseSolution() {};
         virtual void cartesian_to_actuator( float[], float[] ) = 0;
         virtual void actuator_to_cartesian( float[], float[] ) = 0;
+        // transform n points at once, both arrays hold n xyz triples, solutions can override this to share setup across the points
+        virtual void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n ) {
+            for (size_t i = 0; i < n; ++i) {
+                float c[3];
+                memcpy(c, &cartesian_mm[i*3], sizeof(c));
+                cartesian_to_actuator(c, &actuator_mm[i*3]);
+            }
+        }
+        // true if a straight line in cartesian space is a straight line for the actuators too, so lines need no segmenting
+        virtual bool is_linear() const { return false; }
         typedef std::map<char, float> arm_options_t;
         virtual bool set_optional(const arm_options_t& options) { return false; };
         virtual bool get_optional(arm_options_t& options) { return false; };
@@ -7,12 +7,21 @@
 
 #include "libs/Config.h"
 
-class CartesianSolution : public BaseSolution {
+// final and inline so a build with ARM_SOLUTION=cartesian gets the kinematics inlined into Robot
+class CartesianSolution final : public BaseSolution {
     public:
         CartesianSolution(){};
         CartesianSolution(Config*){};
-        void cartesian_to_actuator( float millimeters[], float steps[] );
+        void cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] ) {
+            actuator_mm[ALPHA_STEPPER] = cartesian_mm[X_AXIS];
+            actuator_mm[BETA_STEPPER ] = cartesian_mm[Y_AXIS];
+            actuator_mm[GAMMA_STEPPER] = cartesian_mm[Z_AXIS];
+        }
+        void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n ) {
+            memcpy(actuator_mm, cartesian_mm, n * 3 * sizeof(float));
+        }
         void actuator_to_cartesian( float steps[], float millimeters[] );
+        bool is_linear() const { return true; }
 };
 
 
@@ -0,0 +1,46 @@
+#include "DeltaForwardKinematics.h"
+
+#include <fastmath.h>
+
+void DeltaForwardKinematics::init(const float tower_x[3], const float tower_y[3], float arm_length_squared)
+{
+    x1 = tower_x[0];
+    y1 = tower_y[0];
+    float x2 = tower_x[1] - x1, y2 = tower_y[1] - y1;
+    float x3 = tower_x[2] - x1, y3 = tower_y[2] - y1;
+
+    float det = x2 * y3 - x3 * y2;
+    inv11 =  y3 / det;
+    inv12 = -y2 / det;
+    inv21 = -x3 / det;
+    inv22 =  x2 / det;
+
+    h2 = 0.5F * (x2 * x2 + y2 * y2);
+    h3 = 0.5F * (x3 * x3 + y3 * y3);
+    this->arm_length_squared = arm_length_squared;
+}
+
+void DeltaForwardKinematics::solve(const float actuator_mm[3], float cartesian_mm[3]) const
+{
+    // the carriage heights above the first, the planes are xi * x + yi * y = hi + zi^2 / 2 - zi * z
+    float z2 = actuator_mm[1] - actuator_mm[0];
+    float z3 = actuator_mm[2] - actuator_mm[0];
+    float r2 = h2 + 0.5F * z2 * z2;
+    float r3 = h3 + 0.5F * z3 * z3;
+
+    // x = ex + fx * pz and y = ey + fy * pz
+    float ex = inv11 * r2 + inv12 * r3;
+    float fx = -(inv11 * z2 + inv12 * z3);
+    float ey = inv21 * r2 + inv22 * r3;
+    float fy = -(inv21 * z2 + inv22 * z3);
+
+    // on the first sphere, the lower of the two points is the one below the carriages
+    float a = fx * fx + fy * fy + 1.0F;
+    float b = 2.0F * (ex * fx + ey * fy);
+    float c = ex * ex + ey * ey - arm_length_squared;
+    float pz = (-b - sqrtf(b * b - 4.0F * a * c)) / (2.0F * a);
+
+    cartesian_mm[0] = x1 + ex + fx * pz;
+    cartesian_mm[1] = y1 + ey + fy * pz;
+    cartesian_mm[2] = actuator_mm[0] + pz;
+}
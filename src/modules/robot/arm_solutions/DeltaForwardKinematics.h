@@ -0,0 +1,22 @@
+#ifndef DELTAFORWARDKINEMATICS_H
+#define DELTAFORWARDKINEMATICS_H
+
+// Forward kinematics for a delta with vertical towers and arms all the same length, shared by the delta solutions.
+// The effector is where the three spheres of arm length round the carriages meet. Taking the first carriage as the
+// origin, the other two spheres less the first give two planes, which fix X and Y as straight lines in Z. Their slopes
+// are from an inverse of the tower XY positions worked out once in init(), so solve() is a handful of multiplies, one
+// sqrt and one divide, with no vectors
+class DeltaForwardKinematics {
+    public:
+        void init(const float tower_x[3], const float tower_y[3], float arm_length_squared);
+        // NaN if the arms can't reach each other
+        void solve(const float actuator_mm[3], float cartesian_mm[3]) const;
+
+    private:
+        float x1, y1;               // the first tower
+        float inv11, inv12, inv21, inv22; // the inverse of the second and third towers' XY from the first
+        float h2, h3;               // half the squared XY distance of the second and third towers from the first
+        float arm_length_squared;
+};
+
+#endif // DELTAFORWARDKINEMATICS_H
@@ -16,7 +16,7 @@
 
 #define PIOVER180       0.01745329251994329576923690768489F
 
-// NOTE this currently does not work, needs FK and settings
+// NOTE the settings can't be changed at runtime yet
 ExperimentalDeltaSolution::ExperimentalDeltaSolution(Config* config)
 {
     float alpha_angle  = PIOVER180 * config->value(alpha_angle_checksum)->by_default(30.0f)->as_number();
@@ -35,29 +35,53 @@ ExperimentalDeltaSolution::ExperimentalDeltaSolution(Config* config)
     arm_radius         = config->value(arm_radius_checksum)->by_default(124.0f)->as_number();
 
     arm_length_squared = powf(arm_length, 2);
+
+    // each carriage is arm_radius along X once the point has been turned by its tower's angle, so the tower is there
+    // turned back by the sum of the angles up to it
+    float angle[3] = { alpha_angle, alpha_angle + beta_angle, alpha_angle + gamma_angle };
+    float tower_x[3], tower_y[3];
+    for (int i = 0; i < 3; i++) {
+        tower_x[i] =  arm_radius * cosf(angle[i]);
+        tower_y[i] = -arm_radius * sinf(angle[i]);
+    }
+    forward.init(tower_x, tower_y, arm_length_squared);
 }
 
-void ExperimentalDeltaSolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] ){
-    float alpha_rotated[3], rotated[3];
+void ExperimentalDeltaSolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] )
+{
+    cartesian_to_actuator_batch(cartesian_mm, actuator_mm, 1);
+}
 
-    if( sin_alpha == 0 && cos_alpha == 1){
-        alpha_rotated[X_AXIS] = cartesian_mm[X_AXIS];
-        alpha_rotated[Y_AXIS] = cartesian_mm[Y_AXIS];
-        alpha_rotated[Z_AXIS] = cartesian_mm[Z_AXIS];
-    }else{
-        rotate( cartesian_mm, alpha_rotated, sin_alpha, cos_alpha );
-    }
-    actuator_mm[ALPHA_STEPPER] = solve_arm( alpha_rotated );
+// same as cartesian_to_actuator for n points, with the rotations inlined and the squares done without powf
+void ExperimentalDeltaSolution::cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n ){
+    const bool rotate_alpha= !(sin_alpha == 0 && cos_alpha == 1);
 
-    rotate( alpha_rotated, rotated, sin_beta, cos_beta );
-    actuator_mm[BETA_STEPPER ] = solve_arm( rotated );
+    for (size_t i = 0; i < n; i++) {
+        const float *c= &cartesian_mm[i * 3];
+        float *a= &actuator_mm[i * 3];
 
-    rotate( alpha_rotated, rotated, sin_gamma, cos_gamma );
-    actuator_mm[GAMMA_STEPPER] = solve_arm( rotated );
+        float x= c[X_AXIS], y= c[Y_AXIS];
+        if(rotate_alpha) {
+            x= cos_alpha * c[X_AXIS] - sin_alpha * c[Y_AXIS];
+            y= sin_alpha * c[X_AXIS] + cos_alpha * c[Y_AXIS];
+        }
+        const float z= c[Z_AXIS];
+
+        float dx= x - arm_radius;
+        a[ALPHA_STEPPER]= sqrtf(arm_length_squared - dx * dx - y * y) + z;
+
+        dx= cos_beta * x - sin_beta * y - arm_radius;
+        float dy= sin_beta * x + cos_beta * y;
+        a[BETA_STEPPER ]= sqrtf(arm_length_squared - dx * dx - dy * dy) + z;
+
+        dx= cos_gamma * x - sin_gamma * y - arm_radius;
+        dy= sin_gamma * x + cos_gamma * y;
+        a[GAMMA_STEPPER]= sqrtf(arm_length_squared - dx * dx - dy * dy) + z;
+    }
 }
 
 void ExperimentalDeltaSolution::actuator_to_cartesian( float actuator_mm[], float cartesian_mm[] ){
-    // unimplemented
+    forward.solve(actuator_mm, cartesian_mm);
 }
 
 float ExperimentalDeltaSolution::solve_arm( float cartesian_mm[]) {
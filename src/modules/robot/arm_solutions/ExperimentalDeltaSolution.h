@@ -2,6 +2,7 @@
 #define EXPERIMENTALDELTASOLUTION_H
 
 #include "BaseSolution.h"
+#include "DeltaForwardKinematics.h"
 
 class Config;
 
@@ -9,6 +10,7 @@ class ExperimentalDeltaSolution : public BaseSolution {
     public:
         ExperimentalDeltaSolution(Config*);
         void cartesian_to_actuator( float[], float[] );
+        void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n );
         void actuator_to_cartesian( float[], float[] );
 
         float solve_arm( float millimeters[] );
@@ -25,6 +27,8 @@ class ExperimentalDeltaSolution : public BaseSolution {
         float cos_beta;
         float sin_gamma;
         float cos_gamma;
+
+        DeltaForwardKinematics forward;
 };
 
 
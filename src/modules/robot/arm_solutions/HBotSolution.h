@@ -7,12 +7,25 @@
 
 #include "libs/Config.h"
 
-class HBotSolution : public BaseSolution {
+// final and inline so a build with ARM_SOLUTION=corexy gets the kinematics inlined into Robot
+class HBotSolution final : public BaseSolution {
     public:
         HBotSolution();
         HBotSolution(Config*){};
-        void cartesian_to_actuator( float[], float[] );
+        void cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] ) {
+            actuator_mm[ALPHA_STEPPER] = cartesian_mm[X_AXIS] + cartesian_mm[Y_AXIS];
+            actuator_mm[BETA_STEPPER ] = cartesian_mm[X_AXIS] - cartesian_mm[Y_AXIS];
+            actuator_mm[GAMMA_STEPPER] = cartesian_mm[Z_AXIS];
+        }
+        void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n ) {
+            for (size_t i = 0; i < n * 3; i += 3) {
+                actuator_mm[i + ALPHA_STEPPER] = cartesian_mm[i + X_AXIS] + cartesian_mm[i + Y_AXIS];
+                actuator_mm[i + BETA_STEPPER ] = cartesian_mm[i + X_AXIS] - cartesian_mm[i + Y_AXIS];
+                actuator_mm[i + GAMMA_STEPPER] = cartesian_mm[i + Z_AXIS];
+            }
+        }
         void actuator_to_cartesian( float[], float[] );
+        bool is_linear() const { return true; }
 };
 
 
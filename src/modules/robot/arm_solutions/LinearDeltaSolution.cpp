@@ -7,10 +7,10 @@
 #include "libs/nuts_bolts.h"
 
 #include "libs/Config.h"
-#include "Vector3.h"
 
 #define arm_length_checksum         CHECKSUM("arm_length")
 #define arm_radius_checksum         CHECKSUM("arm_radius")
+#define arm_fast_sqrt_tolerance_checksum CHECKSUM("arm_fast_sqrt_tolerance")
 
 
 #define SQ(x) powf(x, 2)
@@ -22,6 +22,8 @@ LinearDeltaSolution::LinearDeltaSolution(Config* config)
     arm_length         = config->value(arm_length_checksum)->by_default(250.0f)->as_number();
     // arm_radius is the horizontal distance from hinge to hinge when the effector is centered
     arm_radius         = config->value(arm_radius_checksum)->by_default(124.0f)->as_number();
+    // maximum error in mm allowed from the fast arm sqrt, 0 uses sqrtf
+    fast_sqrt_tolerance= config->value(arm_fast_sqrt_tolerance_checksum)->by_default(0.0f)->as_number();
 
     init();
 }
@@ -43,57 +45,62 @@ void LinearDeltaSolution::init() {
 
     DELTA_TOWER3_X = 0.0F; // back middle tower
     DELTA_TOWER3_Y = DELTA_RADIUS;
+
+    tower_x[0] = DELTA_TOWER1_X; tower_y[0] = DELTA_TOWER1_Y;
+    tower_x[1] = DELTA_TOWER2_X; tower_y[1] = DELTA_TOWER2_Y;
+    tower_x[2] = DELTA_TOWER3_X; tower_y[2] = DELTA_TOWER3_Y;
+    forward.init(tower_x, tower_y, arm_length_squared);
+
+    // The magic number estimate is within 3.5% and each newton step squares the relative error (times 1.5),
+    // the result is never more than the arm length so work out how many steps we need to stay within the tolerance
+    fast_sqrt_iterations = 0;
+    if(fast_sqrt_tolerance > 0.0F) {
+        float rel_error = 0.035F;
+        do {
+            rel_error = 1.5F * rel_error * rel_error;
+            fast_sqrt_iterations++;
+        } while(rel_error * arm_length > fast_sqrt_tolerance && fast_sqrt_iterations < 3);
+    }
 }
 
-void LinearDeltaSolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] )
+// sqrt of the arm triangle, either sqrtf or x * 1/sqrt(x) from the bit trick estimate and fast_sqrt_iterations newton steps
+float LinearDeltaSolution::arm_sqrt( float x ) const
 {
-    actuator_mm[ALPHA_STEPPER] = sqrtf(this->arm_length_squared
-                                - SQ(DELTA_TOWER1_X - cartesian_mm[X_AXIS])
-                                - SQ(DELTA_TOWER1_Y - cartesian_mm[Y_AXIS])
-                                ) + cartesian_mm[Z_AXIS];
-    actuator_mm[BETA_STEPPER ] = sqrtf(this->arm_length_squared
-                                - SQ(DELTA_TOWER2_X - cartesian_mm[X_AXIS])
-                                - SQ(DELTA_TOWER2_Y - cartesian_mm[Y_AXIS])
-                                ) + cartesian_mm[Z_AXIS];
-    actuator_mm[GAMMA_STEPPER] = sqrtf(this->arm_length_squared
-                                - SQ(DELTA_TOWER3_X - cartesian_mm[X_AXIS])
-                                - SQ(DELTA_TOWER3_Y - cartesian_mm[Y_AXIS])
-                                ) + cartesian_mm[Z_AXIS];
+    if(fast_sqrt_iterations == 0 || x <= 0.0F) return sqrtf(x);
+
+    union { float f; uint32_t i; } u;
+    u.f = x;
+    u.i = 0x5f3759df - (u.i >> 1);
+    float y = u.f;
+    float half_x = 0.5F * x;
+    for (int i = 0; i < fast_sqrt_iterations; ++i) {
+        y = y * (1.5F - half_x * y * y);
+    }
+    return x * y;
 }
 
-void LinearDeltaSolution::actuator_to_cartesian( float actuator_mm[], float cartesian_mm[] )
+void LinearDeltaSolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] )
 {
-    // from http://en.wikipedia.org/wiki/Circumscribed_circle#Barycentric_coordinates_from_cross-_and_dot-products
-    // based on https://github.com/ambrop72/aprinter/blob/2de69a/aprinter/printer/DeltaTransform.h#L81
-    Vector3 tower1( DELTA_TOWER1_X, DELTA_TOWER1_Y, actuator_mm[0] );
-    Vector3 tower2( DELTA_TOWER2_X, DELTA_TOWER2_Y, actuator_mm[1] );
-    Vector3 tower3( DELTA_TOWER3_X, DELTA_TOWER3_Y, actuator_mm[2] );
-
-    Vector3 s12 = tower1.sub(tower2);
-    Vector3 s23 = tower2.sub(tower3);
-    Vector3 s13 = tower1.sub(tower3);
-
-    Vector3 normal = s12.cross(s23);
-
-    float magsq_s12 = s12.magsq();
-    float magsq_s23 = s23.magsq();
-    float magsq_s13 = s13.magsq();
-
-    float inv_nmag_sq = 1.0F / normal.magsq();
-    float q = 0.5F * inv_nmag_sq;
-
-    float a = q * magsq_s23 * s12.dot(s13);
-    float b = q * magsq_s13 * s12.dot(s23) * -1.0F; // negate because we use s12 instead of s21
-    float c = q * magsq_s12 * s13.dot(s23);
-
-    Vector3 circumcenter( DELTA_TOWER1_X * a + DELTA_TOWER2_X * b + DELTA_TOWER3_X * c,
-                          DELTA_TOWER1_Y * a + DELTA_TOWER2_Y * b + DELTA_TOWER3_Y * c,
-                          actuator_mm[0] * a + actuator_mm[1] * b + actuator_mm[2] * c );
+    cartesian_to_actuator_batch(cartesian_mm, actuator_mm, 1);
+}
 
-    float r_sq = 0.5F * q * magsq_s12 * magsq_s23 * magsq_s13;
-    float dist = sqrtf(inv_nmag_sq * (arm_length_squared - r_sq));
+void LinearDeltaSolution::cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n )
+{
+    for (size_t p = 0; p < n; ++p) {
+        const float *c = &cartesian_mm[p*3];
+        float *a = &actuator_mm[p*3];
+        for (int t = ALPHA_STEPPER; t <= GAMMA_STEPPER; t++) {
+            float dx = tower_x[t] - c[X_AXIS];
+            float dy = tower_y[t] - c[Y_AXIS];
+            a[t] = arm_sqrt(this->arm_length_squared - dx*dx - dy*dy) + c[Z_AXIS];
+        }
+    }
+}
 
-    Vector3 cartesian = circumcenter.sub(normal.mul(dist));
+void LinearDeltaSolution::actuator_to_cartesian( float actuator_mm[], float cartesian_mm[] )
+{
+    float cartesian[3];
+    forward.solve(actuator_mm, cartesian);
 
     cartesian_mm[0] = ROUND(cartesian[0], 4);
     cartesian_mm[1] = ROUND(cartesian[1], 4);
@@ -2,6 +2,7 @@
 #define LINEARDELTASOLUTION_H
 #include "libs/Module.h"
 #include "BaseSolution.h"
+#include "DeltaForwardKinematics.h"
 
 class Config;
 
@@ -10,12 +11,14 @@ class LinearDeltaSolution : public BaseSolution {
         LinearDeltaSolution(Config*);
         void cartesian_to_actuator( float[], float[] );
         void actuator_to_cartesian( float[], float[] );
+        void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n );
 
         bool set_optional(const arm_options_t& options);
         bool get_optional(arm_options_t& options);
 
     private:
         void init();
+        float arm_sqrt( float x ) const;
 
         float arm_length;
         float arm_radius;
@@ -27,5 +30,14 @@ class LinearDeltaSolution : public BaseSolution {
         float DELTA_TOWER2_Y;
         float DELTA_TOWER3_X;
         float DELTA_TOWER3_Y;
+
+        // tower positions again as arrays, so the transform can loop over the towers
+        float tower_x[3];
+        float tower_y[3];
+        DeltaForwardKinematics forward;
+
+        // when set the arm sqrt uses an inverse sqrt estimate refined this many times instead of sqrtf
+        float fast_sqrt_tolerance;
+        int fast_sqrt_iterations;
 };
 #endif // LINEARDELTASOLUTION_H
@@ -40,7 +40,8 @@ MorganSCARASolution::MorganSCARASolution(Config* config)
 }
 
 void MorganSCARASolution::init() {
-
+    c2_offset          = SQ(arm1_length) + SQ(arm2_length);
+    c2_inv_denominator = 1.0f / (2.0f * SQ(arm1_length));
 }
 
 float MorganSCARASolution::to_degrees(float radians) {
@@ -49,46 +50,36 @@ float MorganSCARASolution::to_degrees(float radians) {
 
 void MorganSCARASolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] )
 {
+    cartesian_to_actuator_batch(cartesian_mm, actuator_mm, 1);
+}
 
-    float SCARA_pos[2],
-          SCARA_C2,
-          SCARA_S2,
-          SCARA_K1,
-          SCARA_K2,
-          SCARA_theta,
-          SCARA_psi;
-  
-    SCARA_pos[X_AXIS] = cartesian_mm[X_AXIS] - this->morgan_offset_x;  //Translate cartesian to tower centric SCARA X Y
-    SCARA_pos[Y_AXIS] = cartesian_mm[Y_AXIS] - this->morgan_offset_y;  // morgan_offset not to be confused with home offset. Makes the SCARA math work.
- 
-    if (this->arm1_length == this->arm2_length)
-        SCARA_C2 = (SQ(SCARA_pos[X_AXIS])+SQ(SCARA_pos[Y_AXIS])-2.0f*SQ(this->arm1_length)) / (2.0f * SQ(this->arm1_length));
-    else
-        SCARA_C2 = (SQ(SCARA_pos[X_AXIS])+SQ(SCARA_pos[Y_AXIS])-SQ(this->arm1_length)-SQ(this->arm2_length)) / (2.0f * SQ(this->arm1_length));
-
-    // SCARA position is undefined if abs(SCARA_C2) >=1
-    // In reality abs(SCARA_C2) >0.95 is problematic.
-
-    if (SCARA_C2 > 0.95f)
-        SCARA_C2 = 0.95f;
-    else if (SCARA_C2 < -0.95f)
-        SCARA_C2 = -0.95f;
-
-     
-    SCARA_S2 = sqrtf(1.0f-SQ(SCARA_C2));
-
-    SCARA_K1 = this->arm1_length+this->arm2_length*SCARA_C2;
-    SCARA_K2 = this->arm2_length*SCARA_S2;
-  
-    SCARA_theta = (atan2f(SCARA_pos[X_AXIS],SCARA_pos[Y_AXIS])-atan2f(SCARA_K1, SCARA_K2))*-1.0f;    // Morgan Thomas turns Theta in oposite direction
-    SCARA_psi   = atan2f(SCARA_S2,SCARA_C2);
-  
-  
-    actuator_mm[ALPHA_STEPPER] = to_degrees(SCARA_theta);             // Multiply by 180/Pi  -  theta is support arm angle
-    actuator_mm[BETA_STEPPER ] = to_degrees(SCARA_theta + SCARA_psi); // Morgan kinematics (dual arm)
-    //actuator_mm[BETA_STEPPER ] = to_degrees(SCARA_psi);             // real scara
-    actuator_mm[GAMMA_STEPPER] = cartesian_mm[Z_AXIS];                // No inverse kinematics on Z - Position to add bed offset?
+// same as cartesian_to_actuator for n points, using the arm constants precomputed in init()
+void MorganSCARASolution::cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n )
+{
+    for (size_t i = 0; i < n; i++) {
+        const float *c= &cartesian_mm[i * 3];
+        float *a= &actuator_mm[i * 3];
+
+        float x= c[X_AXIS] - this->morgan_offset_x;
+        float y= c[Y_AXIS] - this->morgan_offset_y;
+
+        float SCARA_C2= (x * x + y * y - this->c2_offset) * this->c2_inv_denominator;
+        if (SCARA_C2 > 0.95f)
+            SCARA_C2 = 0.95f;
+        else if (SCARA_C2 < -0.95f)
+            SCARA_C2 = -0.95f;
 
+        float SCARA_S2= sqrtf(1.0f - SCARA_C2 * SCARA_C2);
+        float SCARA_K1= this->arm1_length + this->arm2_length * SCARA_C2;
+        float SCARA_K2= this->arm2_length * SCARA_S2;
+
+        float SCARA_theta= (atan2f(x, y) - atan2f(SCARA_K1, SCARA_K2)) * -1.0f;
+        float SCARA_psi  = atan2f(SCARA_S2, SCARA_C2);
+
+        a[ALPHA_STEPPER]= to_degrees(SCARA_theta);
+        a[BETA_STEPPER ]= to_degrees(SCARA_theta + SCARA_psi);
+        a[GAMMA_STEPPER]= c[Z_AXIS];
+    }
 }
 
 void MorganSCARASolution::actuator_to_cartesian( float actuator_mm[], float cartesian_mm[] ) {
@@ -9,6 +9,7 @@ class MorganSCARASolution : public BaseSolution {
     public:
         MorganSCARASolution(Config*);
         void cartesian_to_actuator( float[], float[] );
+        void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n );
         void actuator_to_cartesian( float[], float[] );
 
         bool set_optional(const arm_options_t& options);
@@ -23,6 +24,10 @@ class MorganSCARASolution : public BaseSolution {
         float morgan_offset_x;
         float morgan_offset_y;
         float slow_rate;
+
+        // derived from the arm lengths in init()
+        float c2_offset;            // arm1^2 + arm2^2
+        float c2_inv_denominator;   // 1 / (2 * arm1^2)
 };
 
 #endif // MORGANSCARASOLUTION_H
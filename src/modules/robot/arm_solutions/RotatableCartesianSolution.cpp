@@ -12,8 +12,19 @@ RotatableCartesianSolution::RotatableCartesianSolution(Config* config) {
     cos_alpha          = cosf(alpha_angle);
 }
 
-void RotatableCartesianSolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] ){
-    rotate( cartesian_mm, actuator_mm, sin_alpha, cos_alpha );
+void RotatableCartesianSolution::cartesian_to_actuator( float cartesian_mm[], float actuator_mm[] )
+{
+    cartesian_to_actuator_batch(cartesian_mm, actuator_mm, 1);
+}
+
+void RotatableCartesianSolution::cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n ){
+    for (size_t i = 0; i < n; i++) {
+        const float *c= &cartesian_mm[i * 3];
+        float *a= &actuator_mm[i * 3];
+        a[ALPHA_STEPPER] = cos_alpha * c[X_AXIS] - sin_alpha * c[Y_AXIS];
+        a[BETA_STEPPER ] = sin_alpha * c[X_AXIS] + cos_alpha * c[Y_AXIS];
+        a[GAMMA_STEPPER] =             c[Z_AXIS];
+    }
 }
 
 void RotatableCartesianSolution::actuator_to_cartesian( float actuator_mm[], float cartesian_mm[] ){
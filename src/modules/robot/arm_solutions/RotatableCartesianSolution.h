@@ -13,7 +13,9 @@ class RotatableCartesianSolution : public BaseSolution {
     public:
         RotatableCartesianSolution(Config*);
         void cartesian_to_actuator( float[], float[] );
+        void cartesian_to_actuator_batch( const float cartesian_mm[], float actuator_mm[], size_t n );
         void actuator_to_cartesian( float[], float[] );
+        bool is_linear() const { return true; }
 
         void rotate( float in[], float out[], float sin, float cos );
 
@@ -0,0 +1,194 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EncoderFeedback.h"
+
+#include "libs/Kernel.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "Gcode.h"
+#include "StreamOutputPool.h"
+#include "SlowTicker.h"
+#include "Conveyor.h"
+#include "Robot.h"
+#include "StepperMotor.h"
+#include "system_LPC17xx.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define encoder_feedback_checksum       CHECKSUM("encoder_feedback")
+#define actuator_checksum               CHECKSUM("actuator")
+#define counts_per_mm_checksum          CHECKSUM("counts_per_mm")
+#define invert_checksum                 CHECKSUM("invert")
+#define check_frequency_checksum        CHECKSUM("check_frequency")
+#define halt_error_mm_checksum          CHECKSUM("halt_error_mm")
+#define correct_error_mm_checksum       CHECKSUM("correct_error_mm")
+#define correct_rate_checksum           CHECKSUM("correct_rate")
+#define spindle_feedback_qei_checksum   CHECKSUM("spindle_feedback_qei")
+
+EncoderFeedback::EncoderFeedback()
+{
+    motor = nullptr;
+    halt_due = moving = sync_due = corrected = halted = false;
+    corrections = 0;
+    max_error = lost = 0;
+}
+
+void EncoderFeedback::on_module_loaded()
+{
+    // there is only the one QEI
+    if(THEKERNEL->config->value(spindle_feedback_qei_checksum)->by_default(false)->as_bool()) {
+        THEKERNEL->streams->printf("Error: encoder feedback can't use the QEI, the spindle feedback has it\n");
+        delete this;
+        return;
+    }
+
+    actuator = THEKERNEL->config->value(encoder_feedback_checksum, actuator_checksum)->by_default(0)->as_int();
+    float counts_per_mm = THEKERNEL->config->value(encoder_feedback_checksum, counts_per_mm_checksum)->by_default(0)->as_number();
+    if(actuator >= THEKERNEL->robot->actuators.size() || counts_per_mm <= 0) {
+        THEKERNEL->streams->printf("Error: encoder feedback needs an actuator and its counts_per_mm\n");
+        delete this;
+        return;
+    }
+    motor = THEKERNEL->robot->actuators[actuator];
+
+    // encoder counts are turned into steps, what it is compared with
+    float steps_per_mm = motor->get_steps_per_mm();
+    steps_per_count = steps_per_mm / counts_per_mm;
+    halt_steps = lroundf(THEKERNEL->config->value(encoder_feedback_checksum, halt_error_mm_checksum)->by_default(0.5F)->as_number() * steps_per_mm);
+    correct_steps = lroundf(THEKERNEL->config->value(encoder_feedback_checksum, correct_error_mm_checksum)->by_default(0.0F)->as_number() * steps_per_mm);
+    correct_rate = THEKERNEL->config->value(encoder_feedback_checksum, correct_rate_checksum)->by_default(5.0F)->as_number() * steps_per_mm;
+    // the counts are only whole ones and steps smaller than a count can't be seen, so at least a count either way
+    int32_t resolution = ceilf(steps_per_count);
+    if(halt_steps <= resolution) halt_steps = resolution + 1;
+    if(correct_steps >= halt_steps) correct_steps = halt_steps - 1;
+
+    setup_qei(THEKERNEL->config->value(encoder_feedback_checksum, invert_checksum)->by_default(false)->as_bool());
+    sync();
+
+    int freq = THEKERNEL->config->value(encoder_feedback_checksum, check_frequency_checksum)->by_default(100)->as_int();
+    THEKERNEL->slow_ticker->attach<EncoderFeedback, &EncoderFeedback::check_tick>(freq > 0 ? freq : 100, this);
+    register_for_gcodes('G', {28, 92});
+    register_for_gcodes('M', {416});
+    register_for_event(ON_IDLE);
+    register_for_event(ON_HALT);
+}
+
+void EncoderFeedback::setup_qei(bool invert)
+{
+    LPC_SC->PCONP |= (1 << 18);                 // power the QEI
+    LPC_PINCON->PINSEL3 = (LPC_PINCON->PINSEL3 & ~(3 << 8)) | (1 << 8);   // P1.20 is MCI0
+    LPC_PINCON->PINSEL3 = (LPC_PINCON->PINSEL3 & ~(3 << 14)) | (1 << 14); // P1.23 is MCI1
+    LPC_QEI->QEICONF = (1 << 2) | (invert ? 1 : 0); // count every edge of both phases
+    LPC_QEI->QEIMAXPOS = 0xFFFFFFFF;            // let the position wrap, only differences are used
+    LPC_QEI->FILTER = 0;
+    LPC_QEI->QEICON = 1;                        // reset the position
+}
+
+int32_t EncoderFeedback::encoder_steps() const
+{
+    return lroundf((int32_t)LPC_QEI->QEIPOS * steps_per_count);
+}
+
+// positive when the actuator is short of where it was stepped to
+int32_t EncoderFeedback::error_steps() const
+{
+    return motor->get_current_step() - offset - encoder_steps();
+}
+
+void EncoderFeedback::sync()
+{
+    offset = motor->get_current_step() - encoder_steps();
+    sync_due = false;
+    corrected = false;
+}
+
+// in the slow ticker interrupt, only a halt is decided here, the rest waits for the main loop
+uint32_t EncoderFeedback::check_tick(uint32_t dummy)
+{
+    bool running = !THEKERNEL->conveyor->is_queue_empty() || motor->is_moving();
+    moving = running;
+    if(!running || sync_due || halted || halt_due) return 0;
+
+    int32_t e = error_steps();
+    if(abs(e) > abs(max_error)) max_error = e;
+    if(abs(e) > halt_steps) {
+        lost = e;
+        halt_due = true;
+    }
+    return 0;
+}
+
+void EncoderFeedback::on_idle(void *argument)
+{
+    if(halt_due) {
+        halt_due = false;
+        if(halted) return;
+        THEKERNEL->streams->printf("Error: actuator %d has lost %1.3fmm (%ld steps) - reset or M999 required\n", actuator, lost / motor->get_steps_per_mm(), lost);
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        return;
+    }
+
+    if(moving || motor->is_moving() || !THEKERNEL->conveyor->is_queue_empty()) {
+        corrected = false;
+        return;
+    }
+    if(sync_due) {
+        sync();
+        return;
+    }
+    if(halted || corrected || correct_steps == 0) return;
+
+    // stopped, step out a small difference, just the once as the motor may be turned off
+    corrected = true;
+    int32_t e = error_steps();
+    if(abs(e) <= ceilf(steps_per_count) || abs(e) > correct_steps) return;
+
+    // the stepper could begin a block between the checks above and the move, so they are made again with interrupts
+    // off, and the move is all set up before it can look at the motor
+    __disable_irq();
+    if(!THEKERNEL->conveyor->is_queue_empty() || motor->is_moving()) {
+        __enable_irq();
+        corrected = false;
+        return;
+    }
+    corrections++;
+    // these steps make up for ones that were lost so they don't count, where it was stepped to stays the same
+    offset += e;
+    motor->move(e < 0, abs(e), correct_rate);
+    __enable_irq();
+}
+
+void EncoderFeedback::on_halt(void *argument)
+{
+    halted = (argument == nullptr);
+    // after M999 the position is what it is, it will be homed or set
+    if(!halted) sync_due = true;
+}
+
+// M416 reports how far off the actuator is, M416 R also clears the biggest difference seen and the corrections
+void EncoderFeedback::on_gcode_received(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    if(gcode->has_g) {
+        // homing and G92 set where the actuator is, agree with the encoder once the queue is done
+        sync_due = true;
+        return;
+    }
+    if(gcode->m == 416) {
+        float spm = motor->get_steps_per_mm();
+        int32_t e = error_steps();
+        gcode->stream->printf("Encoder: actuator %d off by %1.4fmm (%ld steps), most while moving %1.4fmm, %lu corrections\r\n",
+                              actuator, e / spm, e, max_error / spm, corrections);
+        if(gcode->has_letter('R')) {
+            max_error = 0;
+            corrections = 0;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ENCODERFEEDBACK_MODULE_H
+#define ENCODERFEEDBACK_MODULE_H
+
+#include "libs/Module.h"
+#include <stdint.h>
+
+class StepperMotor;
+
+// Checks one actuator against a quadrature encoder on the QEI, MCI0 on P1.20 and MCI1 on P1.23. While it moves the
+// machine is halted if the encoder and the steps disagree by more than halt_error_mm; once it stops a smaller
+// difference is stepped out. Homing and G92 take the encoder as agreeing with wherever the actuator is then.
+class EncoderFeedback : public Module {
+    public:
+        EncoderFeedback();
+        void on_module_loaded();
+        void on_gcode_received(void *argument);
+        void on_idle(void *argument);
+        void on_halt(void *argument);
+
+    private:
+        void setup_qei(bool invert);
+        int32_t encoder_steps() const;
+        int32_t error_steps() const;
+        void sync();
+        uint32_t check_tick(uint32_t dummy);
+
+        StepperMotor *motor;
+        float steps_per_count;
+        int32_t offset;                 // steps less the encoder, in steps, when they last agreed
+        int32_t halt_steps;
+        int32_t correct_steps;
+        float correct_rate;             // steps/s
+        uint32_t corrections;
+        volatile int32_t max_error;     // the biggest difference seen while moving, in steps
+        volatile int32_t lost;          // what it was off by when it halted
+        uint8_t actuator;
+        struct {
+            volatile bool halt_due:1;
+            volatile bool moving:1;     // a block was running at the last check
+            bool sync_due:1;            // wait for the queue to empty, then agree with the encoder
+            bool corrected:1;           // already tried since the last move, a motor that is off can't be corrected
+            bool halted:1;
+        };
+};
+
+#endif
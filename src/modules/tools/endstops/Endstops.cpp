@@ -24,10 +24,13 @@
 #include "ConfigValue.h"
 #include "libs/StreamOutput.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "EndstopsPublicAccess.h"
 #include "StreamOutputPool.h"
 #include "Pauser.h"
 #include "StepTicker.h"
+#include "PinEvents.h"
+#include "us_ticker_api.h"
 
 #include <ctype.h>
 
@@ -51,6 +54,11 @@
 #define beta_max_endstop_checksum        CHECKSUM("beta_max_endstop")
 #define gamma_max_endstop_checksum       CHECKSUM("gamma_max_endstop")
 
+// the switch of a slaved motor, at the end the axis homes to
+#define alpha_slave_endstop_checksum     CHECKSUM("alpha_slave_endstop")
+#define beta_slave_endstop_checksum      CHECKSUM("beta_slave_endstop")
+#define gamma_slave_endstop_checksum     CHECKSUM("gamma_slave_endstop")
+
 #define alpha_trim_checksum              CHECKSUM("alpha_trim")
 #define beta_trim_checksum               CHECKSUM("beta_trim")
 #define gamma_trim_checksum              CHECKSUM("gamma_trim")
@@ -82,6 +90,8 @@
 #define gamma_homing_retract_mm_checksum    CHECKSUM("gamma_homing_retract_mm")
 
 #define endstop_debounce_count_checksum  CHECKSUM("endstop_debounce_count")
+#define endstop_interrupts_checksum      CHECKSUM("endstop_interrupts")
+#define endstop_debounce_ms_checksum     CHECKSUM("endstop_debounce_ms")
 
 #define alpha_homing_direction_checksum  CHECKSUM("alpha_homing_direction")
 #define beta_homing_direction_checksum   CHECKSUM("beta_homing_direction")
@@ -102,6 +112,8 @@
 
 #define homing_order_checksum            CHECKSUM("homing_order")
 #define move_to_origin_checksum          CHECKSUM("move_to_origin_after_home")
+#define homing_decelerate_checksum       CHECKSUM("homing_decelerate")
+#define home_xy_together_checksum        CHECKSUM("home_xy_together")
 
 #define STEPPER THEKERNEL->robot->actuators
 #define STEPS_PER_MM(a) (STEPPER[a]->get_steps_per_mm())
@@ -122,6 +134,13 @@ Endstops::Endstops()
 {
     this->status = NOT_HOMING;
     home_offset[0] = home_offset[1] = home_offset[2] = 0.0F;
+    for (int i = 0; i < 6; ++i) {
+        held[i] = 0;
+    }
+    irq_triggered = 0;
+    irq_pins = 0;
+    homing_axes = 0;
+    decelerate_axes = 0;
 }
 
 void Endstops::on_module_loaded()
@@ -132,25 +151,37 @@ void Endstops::on_module_loaded()
         return;
     }
 
-    register_for_event(ON_GCODE_RECEIVED);
-    register_for_event(ON_GET_PUBLIC_DATA);
-    register_for_event(ON_SET_PUBLIC_DATA);
+    register_for_gcodes('G', {28});
+    register_for_gcodes('M', {119, 206, 306, 500, 503, 665, 666, 910});
+    PublicData::register_owner(endstops_checksum, this);
 
-    THEKERNEL->step_ticker->register_acceleration_tick_handler([this](){acceleration_tick(); });
+    // only called while homing
+    this->acceleration_handler_id= THEKERNEL->step_ticker->register_acceleration_tick_handler<Endstops, &Endstops::acceleration_tick>(this, false);
 
     // Settings
     this->on_config_reload(this);
 }
 
+// in the same order as pins[]
+static const uint16_t endstop_pin_checksums[]= {
+    alpha_min_endstop_checksum, beta_min_endstop_checksum, gamma_min_endstop_checksum,
+    alpha_max_endstop_checksum, beta_max_endstop_checksum, gamma_max_endstop_checksum
+};
+
 // Get config
 void Endstops::on_config_reload(void *argument)
 {
-    this->pins[0].from_string( THEKERNEL->config->value(alpha_min_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
-    this->pins[1].from_string( THEKERNEL->config->value(beta_min_endstop_checksum           )->by_default("nc" )->as_string())->as_input();
-    this->pins[2].from_string( THEKERNEL->config->value(gamma_min_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
-    this->pins[3].from_string( THEKERNEL->config->value(alpha_max_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
-    this->pins[4].from_string( THEKERNEL->config->value(beta_max_endstop_checksum           )->by_default("nc" )->as_string())->as_input();
-    this->pins[5].from_string( THEKERNEL->config->value(gamma_max_endstop_checksum          )->by_default("nc" )->as_string())->as_input();
+    for (int i = 0; i < 6; ++i) {
+        this->pins[i].from_string( THEKERNEL->config->value(endstop_pin_checksums[i])->by_default("nc" )->as_string())->as_input();
+    }
+
+    // an axis with a slaved motor and a switch for it is squared, each motor stops on its own switch when homing
+    static const uint16_t slave_endstop_checksums[]= { alpha_slave_endstop_checksum, beta_slave_endstop_checksum, gamma_slave_endstop_checksum };
+    this->squaring_axes= 0;
+    for (int c = X_AXIS; c <= Z_AXIS; ++c) {
+        this->slave_pins[c].from_string( THEKERNEL->config->value(slave_endstop_checksums[c])->by_default("nc" )->as_string())->as_input();
+        if(this->slave_pins[c].connected() && STEPPER[c]->get_has_slave()) this->squaring_axes |= (1 << c);
+    }
 
     // These are the old ones in steps still here for backwards compatibility
     this->fast_rates[0] =  THEKERNEL->config->value(alpha_fast_homing_rate_checksum     )->by_default(4000 )->as_number() / STEPS_PER_MM(0);
@@ -175,6 +206,7 @@ void Endstops::on_config_reload(void *argument)
     this->retract_mm[2] = THEKERNEL->config->value(gamma_homing_retract_mm_checksum   )->by_default(this->retract_mm[2])->as_number();
 
     this->debounce_count  = THEKERNEL->config->value(endstop_debounce_count_checksum    )->by_default(100)->as_number();
+    this->debounce_us     = THEKERNEL->config->value(endstop_debounce_ms_checksum       )->by_default(1)->as_number() * 1000;
 
 
     // get homing direction and convert to boolean where true is home to min, and false is home to max
@@ -223,14 +255,123 @@ void Endstops::on_config_reload(void *argument)
     this->limit_enable[Z_AXIS]= THEKERNEL->config->value(gamma_limit_enable_checksum)->by_default(false)->as_bool();
 
     this->move_to_origin_after_home= THEKERNEL->config->value(move_to_origin_checksum)->by_default(false)->as_bool();
+    this->homing_decelerate= THEKERNEL->config->value(homing_decelerate_checksum)->by_default(false)->as_bool();
+    this->home_xy_together= THEKERNEL->config->value(home_xy_together_checksum)->by_default(false)->as_bool();
 
     if(this->limit_enable[X_AXIS] || this->limit_enable[Y_AXIS] || this->limit_enable[Z_AXIS]){
         register_for_event(ON_IDLE);
     }
+
+    if(THEKERNEL->config->value(endstop_interrupts_checksum)->by_default(false)->as_bool()) {
+        setup_interrupts();
+    }
 }
 
 static const char *endstop_names[]= {"min_x", "min_y", "min_z", "max_x", "max_y", "max_z"};
 
+// Endstops on P0 or P2 get every edge from PinEvents with no debounce, the others are still polled
+// PinEvents runs the GPIO interrupt at the priority of the step timer, so a motor can't be paused in the middle of its tick
+void Endstops::setup_interrupts()
+{
+    for (int i = 0; i < 6; ++i) {
+        if(!this->pins[i].connected() || (this->irq_pins & (1 << i)) != 0) continue;
+        if(!PinEvents::instance()->attach(&this->pins[i], 0, this, &Endstops::on_endstop_edge)) {
+            THEKERNEL->streams->printf("Endstop %s is not on P0 or P2, it will be polled\n", endstop_names[i]);
+            continue;
+        }
+        this->irq_pins |= (1 << i);
+    }
+}
+
+// Called from the GPIO interrupt, pauses the motors the endstop has to stop straight away, the main loop then confirms it was not a glitch
+uint32_t Endstops::on_endstop_edge(uint32_t state)
+{
+    // the edge that means released has nothing to stop
+    if(!state) return 0;
+    uint32_t now= us_ticker_read();
+    for (int n = 0; n < 6; ++n) {
+        uint8_t bit= 1 << n;
+        if((this->irq_pins & bit) == 0 || (this->irq_triggered & bit) != 0 || !this->pins[n].get()) continue;
+
+        int c= n % 3;
+        uint8_t motors= 0;
+        // corexy XY homing always stops dead
+        bool decelerating= this->homing_decelerate && this->status == MOVING_TO_ENDSTOP_FAST && !(this->is_corexy && c != Z_AXIS);
+        if((this->status == MOVING_TO_ENDSTOP_FAST && !decelerating) || this->status == MOVING_TO_ENDSTOP_SLOW) {
+            // only the endstop an axis is homing to, on a corexy both motors move that axis
+            if(((this->homing_axes >> c) & 1) && n == c + (this->home_direction[c] ? 0 : 3))
+                motors= (this->is_corexy && c != Z_AXIS) ? 0x03 : (1 << c);
+
+        }else if(this->status == NOT_HOMING && this->limit_enable[c] && STEPPER[c]->is_moving()) {
+            motors= 0x07; // hitting a limit stops everything
+        }
+        if(motors == 0) continue;
+
+        this->irq_triggered |= bit;
+        this->trigger_time[n]= now;
+        for (int m = X_AXIS; m <= Z_AXIS; ++m) {
+            if(((motors >> m) & 1) && STEPPER[m]->is_moving()) {
+                STEPPER[m]->pause();
+                this->held[n] |= (1 << m);
+            }
+        }
+    }
+    return 0;
+}
+
+// true once endstop n has read triggered long enough, count is the number of reads so far for a polled endstop
+bool Endstops::debounced(int n, unsigned int &count)
+{
+    if((this->irq_pins & (1 << n)) == 0) {
+        if(count < debounce_count) {
+            count++;
+            return false;
+        }
+        return true;
+    }
+
+    __disable_irq();
+    if((this->irq_triggered & (1 << n)) == 0) {
+        // it was triggered before we were looking for the edge, so time it from now
+        this->irq_triggered |= (1 << n);
+        this->trigger_time[n]= us_ticker_read();
+    }
+    __enable_irq();
+    return us_ticker_read() - this->trigger_time[n] >= debounce_us;
+}
+
+// endstop n reads released again, if its edge paused any motors it was a glitch so they carry on
+void Endstops::released(int n)
+{
+    if((this->irq_triggered & (1 << n)) == 0) return;
+    release_held(n);
+    __disable_irq();
+    this->irq_triggered &= ~(1 << n);
+    __enable_irq();
+}
+
+// unpause the motors endstop n paused, once they have been stopped or it turned out to be a glitch
+void Endstops::release_held(int n)
+{
+    __disable_irq();
+    uint8_t motors= this->held[n];
+    this->held[n]= 0;
+    __enable_irq();
+    for (int m = X_AXIS; m <= Z_AXIS; ++m) {
+        if((motors >> m) & 1) STEPPER[m]->unpause();
+    }
+}
+
+// forget the old edges before a homing move, so each endstop can fire again
+void Endstops::rearm()
+{
+    __disable_irq();
+    for (int n = 0; n < 6; ++n) {
+        if(this->held[n] == 0) this->irq_triggered &= ~(1 << n);
+    }
+    __enable_irq();
+}
+
 void Endstops::on_idle(void *argument)
 {
     if(this->status == LIMIT_TRIGGERED) {
@@ -252,6 +393,7 @@ void Endstops::on_idle(void *argument)
         if(++bounce_cnt > 10) { // can use less as it calls on_idle in between
             // clear the state
             this->status= NOT_HOMING;
+            rearm();
         }
         return;
 
@@ -266,17 +408,33 @@ void Endstops::on_idle(void *argument)
             // check min and max endstops
             for (int i : minmax) {
                 int n= c+i;
-                uint8_t debounce= 0;
-                while(this->pins[n].get()) {
-                    if ( ++debounce >= debounce_count ) {
-                        // endstop triggered
-                        THEKERNEL->streams->printf("Limit switch %s was hit - reset or M999 required\n", endstop_names[n]);
-                        this->status= LIMIT_TRIGGERED;
-                        // disables heaters and motors, ignores incoming Gcode and flushes block queue
-                        THEKERNEL->call_event(ON_HALT, nullptr);
-                        return;
+                bool hit= false;
+                if(this->irq_pins & (1 << n)) {
+                    // the edge already paused the motors, it only has to stay triggered for the debounce time
+                    unsigned int unused= 0;
+                    if(!this->pins[n].get()) {
+                        released(n);
+                        continue;
+                    }
+                    hit= debounced(n, unused);
+                }else{
+                    uint8_t debounce= 0;
+                    while(this->pins[n].get()) {
+                        if ( ++debounce >= debounce_count ) {
+                            hit= true;
+                            break;
+                        }
                     }
                 }
+                if(hit) {
+                    // endstop triggered
+                    THEKERNEL->streams->printf("Limit switch %s was hit - reset or M999 required\n", endstop_names[n]);
+                    this->status= LIMIT_TRIGGERED;
+                    // disables heaters and motors, ignores incoming Gcode and flushes block queue
+                    THEKERNEL->call_event(ON_HALT, nullptr);
+                    release_held(n);
+                    return;
+                }
             }
         }
     }
@@ -332,27 +490,74 @@ void Endstops::wait_for_homed(char axes_to_move)
 {
     bool running = true;
     unsigned int debounce[3] = {0, 0, 0};
+    unsigned int slave_debounce[3] = {0, 0, 0};
+    uint8_t primary_stopped = 0, slave_stopped = 0;
+    // cartesian and delta only, this is also used for the Z of a corexy
+    bool decelerate = this->homing_decelerate && this->status == MOVING_TO_ENDSTOP_FAST;
+    rearm();
+    // a squared axis is left to the loop here, an endstop interrupt would stop both its motors
+    this->homing_axes = axes_to_move & ~this->squaring_axes;
+    this->decelerate_axes = 0;
     while (running) {
         running = false;
         THEKERNEL->call_event(ON_IDLE);
         for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
             if ( ( axes_to_move >> c ) & 1 ) {
-                if ( this->pins[c + (this->home_direction[c] ? 0 : 3)].get() ) {
-                    if ( debounce[c] < debounce_count ) {
-                        debounce[c]++;
+                int n = c + (this->home_direction[c] ? 0 : 3);
+                if ( ( this->squaring_axes >> c ) & 1 ) {
+                    // each motor stops dead on its own switch, the move is over once both have
+                    uint8_t was_primary = primary_stopped, was_slave = slave_stopped;
+                    if ( ( ~primary_stopped >> c ) & 1 ) {
+                        if ( !this->pins[n].get() ) {
+                            debounce[c] = 0;
+                            this->released(n);
+                        } else if ( this->debounced(n, debounce[c]) ) {
+                            primary_stopped |= (1<<c);
+                        }
+                    }
+                    if ( ( ~slave_stopped >> c ) & 1 ) {
+                        if ( !this->slave_pins[c].get() ) slave_debounce[c] = 0;
+                        else if ( ++slave_debounce[c] > this->debounce_count ) slave_stopped |= (1<<c);
+                    }
+
+                    bool primary = !((primary_stopped >> c) & 1), slave = !((slave_stopped >> c) & 1);
+                    if ( !primary && !slave ) {
+                        STEPPER[c]->move(0, 0);
+                        axes_to_move &= ~(1<<c);
+                    } else {
+                        if ( primary_stopped != was_primary || slave_stopped != was_slave ) STEPPER[c]->set_step_outputs(primary, slave);
+                        running = true;
+                    }
+
+                } else if ( ( this->decelerate_axes >> c ) & 1 ) {
+                    // tripped, the endstop may be passed again before the acceleration tick stops it
+                    if ( STEPPER[c]->is_moving() ) running = true;
+                    else axes_to_move &= ~(1<<c);
+
+                } else if ( this->pins[n].get() ) {
+                    if ( !this->debounced(n, debounce[c]) ) {
+                        running = true;
+                    } else if ( decelerate && STEPPER[c]->is_moving() ) {
+                        this->trip_step[c] = STEPPER[c]->get_stepped();
+                        this->overshoot[c] = 0;
+                        this->decelerate_axes |= (1<<c);
                         running = true;
                     } else if ( STEPPER[c]->is_moving() ) {
                         STEPPER[c]->move(0, 0);
+                        this->release_held(n);
                         axes_to_move &= ~(1<<c); // no need to check it again
                     }
                 } else {
                     // The endstop was not hit yet
                     running = true;
                     debounce[c] = 0;
+                    this->released(n);
                 }
             }
         }
     }
+    this->homing_axes = 0;
+    this->decelerate_axes = 0;
 }
 
 void Endstops::do_homing_cartesian(char axes_to_move)
@@ -368,16 +573,17 @@ void Endstops::do_homing_cartesian(char axes_to_move)
     }
 
     // Wait for all axes to have homed
+    for ( int c = X_AXIS; c <= Z_AXIS; c++ ) this->overshoot[c] = 0;
     this->wait_for_homed(axes_to_move);
 
-    // Move back a small distance
+    // Move back a small distance, and back past the endstop if it was overrun while decelerating
     this->status = MOVING_BACK;
     bool inverted_dir;
     for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
         if ( ( axes_to_move >> c ) & 1 ) {
             inverted_dir = !this->home_direction[c];
             this->feed_rate[c]= this->slow_rates[c];
-            STEPPER[c]->move(inverted_dir, this->retract_mm[c]*STEPS_PER_MM(c), 0);
+            STEPPER[c]->move(inverted_dir, this->retract_mm[c]*STEPS_PER_MM(c) + this->overshoot[c], 0);
         }
     }
 
@@ -434,24 +640,29 @@ void Endstops::wait_for_homed_corexy(int axis)
 {
     bool running = true;
     unsigned int debounce[3] = {0, 0, 0};
+    int n = axis + (this->home_direction[axis] ? 0 : 3);
+    rearm();
+    this->homing_axes = 1 << axis;
     while (running) {
         running = false;
         THEKERNEL->call_event(ON_IDLE);
-        if ( this->pins[axis + (this->home_direction[axis] ? 0 : 3)].get() ) {
-            if ( debounce[axis] < debounce_count ) {
-                debounce[axis] ++;
+        if ( this->pins[n].get() ) {
+            if ( !this->debounced(n, debounce[axis]) ) {
                 running = true;
             } else {
                 // turn both off if running
                 if (STEPPER[X_AXIS]->is_moving()) STEPPER[X_AXIS]->move(0, 0);
                 if (STEPPER[Y_AXIS]->is_moving()) STEPPER[Y_AXIS]->move(0, 0);
+                this->release_held(n);
             }
         } else {
             // The endstop was not hit yet
             running = true;
             debounce[axis] = 0;
+            this->released(n);
         }
     }
+    this->homing_axes = 0;
 }
 
 void Endstops::corexy_home(int home_axis, bool dirx, bool diry, float fast_rate, float slow_rate, unsigned int retract_steps)
@@ -523,17 +734,23 @@ void Endstops::do_homing_corexy(char axes_to_move)
         STEPPER[motor]->move(dir, 10000000, 0);
         // wait until either X or Y hits the endstop
         bool running= true;
+        rearm();
+        this->homing_axes= 0x03;
         while (running) {
             THEKERNEL->call_event(ON_IDLE);
             for(int m=X_AXIS;m<=Y_AXIS;m++) {
-                if(this->pins[m + (this->home_direction[m] ? 0 : 3)].get()) {
+                int n= m + (this->home_direction[m] ? 0 : 3);
+                if(this->pins[n].get()) {
                     // turn off motor
                     if(STEPPER[motor]->is_moving()) STEPPER[motor]->move(0, 0);
+                    this->release_held(n);
                     running= false;
                     break;
                 }
+                this->released(n);
             }
         }
+        this->homing_axes= 0;
     }
 
     // move individual axis
@@ -562,6 +779,8 @@ void Endstops::home(char axes_to_move)
         STEPPER[c]->set_moved_last_block(false);
     }
 
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, true);
+
     if (is_corexy){
         // corexy/HBot homing
         do_homing_corexy(axes_to_move);
@@ -569,6 +788,8 @@ void Endstops::home(char axes_to_move)
         // cartesian/delta homing
         do_homing_cartesian(axes_to_move);
     }
+
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, false);
 }
 
 // Start homing sequences by response to GCode commands
@@ -577,7 +798,7 @@ void Endstops::on_gcode_received(void *argument)
     Gcode *gcode = static_cast<Gcode *>(argument);
     if ( gcode->has_g) {
         if ( gcode->g == 28 ) {
-            gcode->mark_as_taken();
+            gcode->mark_as_consumed();
             // G28 is received, we have homing to do
 
             // First wait for the queue to be empty
@@ -602,10 +823,16 @@ void Endstops::on_gcode_received(void *argument)
                 // if an order has been specified do it in the specified order
                 // homing order is 0b00ccbbaa where aa is 0,1,2 to specify the first axis, bb is the second and cc is the third
                 // eg 0b00100001 would be Y X Z, 0b00100100 would be X Y Z
+                char homed= 0;
                 for (uint8_t m = homing_order; m != 0; m >>= 2) {
                     int a= (1 << (m & 0x03)); // axis to move
-                    if((a & axes_to_move) != 0)
+                    // X and Y both home where the first of them is in the order
+                    if(this->home_xy_together && (a & 0x03) != 0) a= 0x03;
+                    a &= axes_to_move & ~homed;
+                    if(a != 0) {
                         home(a);
+                        homed |= a;
+                    }
                 }
             }else {
                 // they all home at the same time
@@ -751,9 +978,19 @@ void Endstops::acceleration_tick(void)
         uint32_t current_rate = STEPPER[c]->get_steps_per_second();
         uint32_t target_rate = floorf(this->feed_rate[c]*STEPS_PER_MM(c));
         float acc= (c==Z_AXIS) ? THEKERNEL->planner->get_z_acceleration() : THEKERNEL->planner->get_acceleration();
+        uint32_t rate_change = floorf((acc/THEKERNEL->acceleration_ticks_per_second)*STEPS_PER_MM(c));
+        if( (this->decelerate_axes >> c) & 1 ){
+            // the endstop tripped, slow down to a stop and remember how far past it we went
+            if( current_rate <= rate_change ){
+                this->overshoot[c] = STEPPER[c]->get_stepped() - this->trip_step[c];
+                STEPPER[c]->move(0, 0);
+            }else{
+                STEPPER[c]->set_speed(current_rate - rate_change);
+            }
+            continue;
+        }
         if( current_rate < target_rate ){
-            uint32_t rate_increase = floorf((acc/THEKERNEL->acceleration_ticks_per_second)*STEPS_PER_MM(c));
-            current_rate = min( target_rate, current_rate + rate_increase );
+            current_rate = min( target_rate, current_rate + rate_change );
         }
         if( current_rate > target_rate ){ current_rate = target_rate; }
 
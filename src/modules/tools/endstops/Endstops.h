@@ -35,6 +35,12 @@ class Endstops : public Module{
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
         void on_idle(void *argument);
+        void setup_interrupts();
+        uint32_t on_endstop_edge(uint32_t state);
+        bool debounced(int n, unsigned int &count);
+        void released(int n);
+        void release_held(int n);
+        void rearm();
 
         float homing_position[3];
         float home_offset[3];
@@ -43,17 +49,35 @@ class Endstops : public Module{
         std::bitset<3> limit_enable;
 
         unsigned int  debounce_count;
+        uint32_t debounce_us;
         float  retract_mm[3];
         float  trim_mm[3];
         float  fast_rates[3];
         float  slow_rates[3];
         Pin    pins[6];
+        Pin    slave_pins[3];
+        uint8_t squaring_axes; // a bit for each axis whose slaved motor has its own switch
         volatile float feed_rate[3];
+        int acceleration_handler_id;
+
+        // endstops on P0 or P2 can stop the motors from their edge interrupt, the main loop only confirms it was not a glitch
+        uint32_t trigger_time[6]; // us_ticker_read() at the edge
+        volatile uint8_t held[6]; // motors paused by each endstop's edge until it is confirmed
+        volatile uint8_t irq_triggered; // a bit for each endstop that has seen its edge
+        uint8_t irq_pins; // a bit for each endstop using an interrupt
+        volatile uint8_t homing_axes; // axes whose homing endstop stops them
+
+        // with homing_decelerate the fast move comes to a stop with the acceleration tick instead of stopping dead
+        volatile uint8_t decelerate_axes;
+        volatile uint32_t trip_step[3]; // stepped when the endstop tripped
+        volatile uint32_t overshoot[3]; // steps taken after that, added to the retract
         struct {
             bool is_corexy:1;
             bool is_delta:1;
             bool is_scara:1;
             bool move_to_origin_after_home:1;
+            bool homing_decelerate:1;
+            bool home_xy_together:1;
             uint8_t bounce_cnt:4;
             volatile char status:3;
         };
@@ -19,11 +19,14 @@
 #include "Config.h"
 #include "StepperMotor.h"
 #include "Robot.h"
+#include "Planner.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "Gcode.h"
 #include "libs/StreamOutput.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
+#include "ExtruderPublicAccess.h"
 
 #include <mri.h>
 
@@ -58,6 +61,9 @@
 #define retract_recover_feedrate_checksum    CHECKSUM("retract_recover_feedrate")
 #define retract_zlift_length_checksum        CHECKSUM("retract_zlift_length")
 #define retract_zlift_feedrate_checksum      CHECKSUM("retract_zlift_feedrate")
+#define retract_zlift_max_jerk_checksum      CHECKSUM("retract_zlift_max_jerk")
+#define pressure_advance_checksum            CHECKSUM("pressure_advance")
+#define step_with_axes_checksum              CHECKSUM("step_with_axes")
 
 #define save_state_checksum                  CHECKSUM("save_state")
 #define restore_state_checksum               CHECKSUM("restore_state")
@@ -86,6 +92,9 @@ Extruder::Extruder( uint16_t config_identifier, bool single )
     this->single_config = single;
     this->identifier = config_identifier;
     this->retracted = false;
+    this->follow_once = false;
+    this->zlift_distance = 0.0F;
+    this->synced = false;
     this->volumetric_multiplier = 1.0F;
     this->extruder_multiplier = 1.0F;
     this->stepper_motor= nullptr;
@@ -124,17 +133,18 @@ void Extruder::on_module_loaded()
     // We work on the same Block as Stepper, so we need to know when it gets a new one and drops one
     this->register_for_event(ON_BLOCK_BEGIN);
     this->register_for_event(ON_BLOCK_END);
-    this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_gcodes('G', {0, 1, 10, 11, 90, 91, 92});
+    this->register_for_gcodes('M', {17, 18, 82, 83, 84, 92, 114, 200, 204, 207, 208, 221, 500, 503, 900});
     this->register_for_event(ON_GCODE_EXECUTE);
     this->register_for_event(ON_PLAY);
     this->register_for_event(ON_PAUSE);
     this->register_for_event(ON_HALT);
     this->register_for_event(ON_SPEED_CHANGE);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_owner(extruder_checksum, this);
 
     // Update speed every *acceleration_ticks_per_second*
-    THEKERNEL->step_ticker->register_acceleration_tick_handler([this](){acceleration_tick(); });
+    // only called during SOLO moves
+    this->acceleration_handler_id= THEKERNEL->step_ticker->register_acceleration_tick_handler<Extruder, &Extruder::acceleration_tick>(this, false);
 }
 
 // Get config
@@ -183,6 +193,9 @@ void Extruder::on_config_reload(void *argument)
     this->retract_recover_feedrate = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_recover_feedrate_checksum)->by_default(8)->as_number();
     this->retract_zlift_length     = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_length_checksum)->by_default(0)->as_number();
     this->retract_zlift_feedrate   = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_feedrate_checksum)->by_default(100*60)->as_number(); // mm/min
+    this->retract_zlift_max_jerk   = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_max_jerk_checksum)->by_default(0)->as_number(); // mm/sec
+    this->pressure_advance         = THEKERNEL->config->value(extruder_checksum, this->identifier, pressure_advance_checksum)->by_default(0)->as_number(); // seconds
+    this->step_with_axes           = THEKERNEL->config->value(extruder_checksum, this->identifier, step_with_axes_checksum)->by_default(false)->as_bool();
 
     if(filament_diameter > 0.01) {
         this->volumetric_multiplier = 1.0F / (powf(this->filament_diameter / 2, 2) * PI);
@@ -190,7 +203,7 @@ void Extruder::on_config_reload(void *argument)
 
     // Stepper motor object for the extruder
     this->stepper_motor = new StepperMotor(step_pin, dir_pin, en_pin);
-    this->stepper_motor->attach(this, &Extruder::stepper_motor_finished_move );
+    this->stepper_motor->attach<Extruder, &Extruder::stepper_motor_finished_move>(this);
     if( this->single_config ) {
         this->stepper_motor->set_max_rate(THEKERNEL->config->value(extruder_max_speed_checksum)->by_default(1000)->as_number());
     }else{
@@ -203,6 +216,18 @@ void Extruder::on_get_public_data(void* argument){
 
     if(!pdr->starts_with(extruder_checksum)) return;
 
+    if(pdr->second_element_is(extrusion_rate_checksum)) {
+        bool moving = this->enabled && this->current_block != NULL && this->stepper_motor->is_moving();
+        if(pdr->third_element_is(this->identifier) || (pdr->third_element_is(0) && moving)) {
+            // this must be static as it will be accessed long after we have returned
+            static float rate;
+            rate = moving ? this->stepper_motor->get_steps_per_second() / this->steps_per_millimeter : 0;
+            pdr->set_data_ptr(&rate);
+            pdr->set_taken();
+        }
+        return;
+    }
+
     if(this->enabled) {
         // Note this is allowing both step/mm and filament diameter to be exposed via public data
         pdr->set_data_ptr(&this->steps_per_millimeter);
@@ -267,13 +292,12 @@ void Extruder::on_gcode_received(void *argument)
 
         } else if (gcode->m == 200 && ( (this->enabled && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
             if (gcode->has_letter('D')) {
-                THEKERNEL->conveyor->wait_for_empty_queue(); // only apply after the queue has emptied
                 this->filament_diameter = gcode->get_value('D');
+                float multiplier = 1.0F;
                 if(filament_diameter > 0.01) {
-                    this->volumetric_multiplier = 1.0F / (powf(this->filament_diameter / 2, 2) * PI);
-                }else{
-                    this->volumetric_multiplier = 1.0F;
+                    multiplier = 1.0F / (powf(this->filament_diameter / 2, 2) * PI);
                 }
+                THEKERNEL->conveyor->append_action(&Extruder::set_volumetric_multiplier, this, multiplier);
             }
             gcode->mark_as_taken();
 
@@ -297,6 +321,17 @@ void Extruder::on_gcode_received(void *argument)
             if(gcode->has_letter('F')) retract_recover_feedrate = gcode->get_value('F')/60.0F; // specified in mm/min converted to mm/sec
             gcode->mark_as_taken();
 
+        } else if (gcode->m == 900 && ( (this->enabled && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
+            // M900 - set pressure advance K[seconds], the extra filament pushed while the head accelerates, per mm/s of filament speed
+            float k = this->pressure_advance;
+            if(gcode->has_letter('K')) {
+                k = gcode->get_value('K');
+                THEKERNEL->conveyor->append_action(&Extruder::set_pressure_advance, this, k);
+            }
+            gcode->stream->printf("E pressure advance:%g ", k);
+            gcode->add_nl = true;
+            gcode->mark_as_taken();
+
         } else if (gcode->m == 221 && this->enabled) { // M221 S100 change flow rate by percentage
             if(gcode->has_letter('S')) this->extruder_multiplier= gcode->get_value('S')/100.0F;
             gcode->mark_as_taken();
@@ -308,6 +343,7 @@ void Extruder::on_gcode_received(void *argument)
                 gcode->stream->printf(";E retract length, feedrate, zlift length, feedrate:\nM207 S%1.4f F%1.4f Z%1.4f Q%1.4f\n", this->retract_length, this->retract_feedrate*60.0F, this->retract_zlift_length, this->retract_zlift_feedrate);
                 gcode->stream->printf(";E retract recover length, feedrate:\nM208 S%1.4f F%1.4f\n", this->retract_recover_length, this->retract_recover_feedrate*60.0F);
                 gcode->stream->printf(";E acceleration mm/sec^2:\nM204 E%1.4f\n", this->acceleration);
+                gcode->stream->printf(";E pressure advance seconds:\nM900 K%1.4f\n", this->pressure_advance);
 
             } else {
                 gcode->stream->printf(";E Steps per mm:\nM92 E%1.4f P%d\n", this->steps_per_millimeter, this->identifier);
@@ -315,6 +351,7 @@ void Extruder::on_gcode_received(void *argument)
                 gcode->stream->printf(";E retract length, feedrate:\nM207 S%1.4f F%1.4f Z%1.4f Q%1.4f P%d\n", this->retract_length, this->retract_feedrate*60.0F, this->retract_zlift_length, this->retract_zlift_feedrate, this->identifier);
                 gcode->stream->printf(";E retract recover length, feedrate:\nM208 S%1.4f F%1.4f P%d\n", this->retract_recover_length, this->retract_recover_feedrate*60.0F, this->identifier);
                 gcode->stream->printf(";E acceleration mm/sec^2:\nM204 E%1.4f P%d\n", this->acceleration, this->identifier);
+                gcode->stream->printf(";E pressure advance seconds:\nM900 K%1.4f P%d\n", this->pressure_advance, this->identifier);
             }
             gcode->mark_as_taken();
         } else if( gcode->m == 17 || gcode->m == 18 || gcode->m == 82 || gcode->m == 83 || gcode->m == 84 ) {
@@ -347,36 +384,21 @@ void Extruder::on_gcode_received(void *argument)
             } else
                 return; // ignore duplicates
 
-            // now we do a special hack to add zlift if needed, this should go in Robot but if it did the zlift would be executed before retract which is bad
-            // this way zlift will happen after retract, (or before for unretract) NOTE we call the robot->on_gcode_receive directly to avoid recursion
-            if(retract_zlift_length > 0 && gcode->g == 11 && !this->cancel_zlift_restore) {
-                // reverse zlift happens before unretract
-                // NOTE we do not do this if cancel_zlift_restore is set to true, which happens if there is an absolute Z move inbetween G10 and G11
-                char buf[32];
-                int n= snprintf(buf, sizeof(buf), "G0 Z%1.4f F%1.4f", -retract_zlift_length, retract_zlift_feedrate);
-                string cmd(buf, n);
-                Gcode gc(cmd, &(StreamOutput::NullStream));
-                bool oldmode= THEKERNEL->robot->absolute_mode;
-                THEKERNEL->robot->absolute_mode= false; // needs to be relative mode
-                THEKERNEL->robot->on_gcode_received(&gc); // send to robot directly
-                THEKERNEL->robot->absolute_mode= oldmode; // restore mode
+            // with a zlift the filament moves along with the Z move, in the one planned block, instead of in a solo block
+            // of its own before or after it. NOTE the G11 does not lower Z if cancel_zlift_restore is set, which happens if
+            // there is an absolute Z move inbetween G10 and G11, then the unretract is a solo move
+            if(retract_zlift_length > 0 && (gcode->g == 10 || !this->cancel_zlift_restore)) {
+                bool retract = gcode->g == 10;
+                float distance = retract ? -retract_length : retract_length + retract_recover_length;
+                float lift = retract ? retract_zlift_length : -retract_zlift_length;
+                queue_zlift_move(distance, lift, retract ? retract_feedrate : retract_recover_feedrate);
+                return;
             }
 
             // This is a solo move, we add an empty block to the queue to prevent subsequent gcodes being executed at the same time
             THEKERNEL->conveyor->append_gcode(gcode);
             THEKERNEL->conveyor->queue_head_block();
 
-            if(retract_zlift_length > 0 && gcode->g == 10) {
-                char buf[32];
-                int n= snprintf(buf, sizeof(buf), "G0 Z%1.4f F%1.4f", retract_zlift_length, retract_zlift_feedrate);
-                string cmd(buf, n);
-                Gcode gc(cmd, &(StreamOutput::NullStream));
-                bool oldmode= THEKERNEL->robot->absolute_mode;
-                THEKERNEL->robot->absolute_mode= false; // needs to be relative mode
-                THEKERNEL->robot->on_gcode_received(&gc); // send to robot directly
-                THEKERNEL->robot->absolute_mode= oldmode; // restore mode
-            }
-
         }else if( this->enabled && this->retracted && (gcode->g == 0 || gcode->g == 1) && gcode->has_letter('Z')) {
             // NOTE we cancel the zlift restore for the following G11 as we have moved to an absolute Z which we need to stay at
             this->cancel_zlift_restore= true;
@@ -384,6 +406,34 @@ void Extruder::on_gcode_received(void *argument)
     }
 }
 
+// Queues a Z move of lift with the filament moving distance along with it, at the zlift feedrate or slower if the filament
+// would go faster than feedrate. The entry and exit speeds are limited by retract_zlift_max_jerk, as the filament goes
+// from or to following the moves either side at a different ratio
+void Extruder::queue_zlift_move(float distance, float lift, float feedrate)
+{
+    float rate = retract_zlift_feedrate / 60.0F; // mm/sec
+    if (fabsf(distance) > 0.0F) rate = min(rate, feedrate * fabsf(lift) / fabsf(distance));
+    float edge_speed = fabsf(distance) > 0.0F ? retract_zlift_max_jerk * fabsf(lift) / fabsf(distance) : -1.0F;
+
+    // the held line goes before the action, else the action would start with it
+    THEKERNEL->robot->flush_merged_line();
+    THEKERNEL->conveyor->append_action(&Extruder::follow_zlift, this, distance);
+    THEKERNEL->planner->limit_next_entry_speed(edge_speed);
+    THEKERNEL->robot->append_z_move(lift, rate);
+    THEKERNEL->planner->limit_next_entry_speed(edge_speed);
+}
+
+// runs as the zlift block begins, on_block_begin then follows it for that one block
+void Extruder::follow_zlift(void *extruder, float distance)
+{
+    Extruder *e = static_cast<Extruder *>(extruder);
+    e->mode = FOLLOW;
+    e->zlift_distance = distance;
+    e->follow_once = true;
+    e->target_position += distance;
+    e->en_pin.set(0);
+}
+
 // Compute extrusion speed based on parameters and gcode distance of travel
 void Extruder::on_gcode_execute(void *argument)
 {
@@ -484,6 +534,16 @@ void Extruder::on_gcode_execute(void *argument)
     }
 }
 
+void Extruder::set_volumetric_multiplier(void *extruder, float value)
+{
+    static_cast<Extruder *>(extruder)->volumetric_multiplier = value;
+}
+
+void Extruder::set_pressure_advance(void *extruder, float value)
+{
+    static_cast<Extruder *>(extruder)->pressure_advance = value;
+}
+
 // When a new block begins, either follow the robot, or step by ourselves ( or stay back and do nothing )
 void Extruder::on_block_begin(void *argument)
 {
@@ -511,6 +571,7 @@ void Extruder::on_block_begin(void *argument)
             block->take();
             this->current_block = block;
             this->stepper_motor->move( ( this->travel_distance > 0 ), steps_to_step, rate_increase()); // start at first acceleration step
+            THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, true);
 
         } else {
             this->current_block = NULL;
@@ -518,19 +579,38 @@ void Extruder::on_block_begin(void *argument)
         this->stepper_motor->set_moved_last_block(false);
 
     } else if( this->mode == FOLLOW ) {
+        if (this->follow_once) this->travel_ratio = block->millimeters > 0.0F ? this->zlift_distance / block->millimeters : 0.0F;
+
         // In non-solo mode, we just follow the stepper module
         this->travel_distance = block->millimeters * this->travel_ratio;
 
         this->current_position += this->travel_distance;
 
         int steps_to_step = abs(floorf(this->steps_per_millimeter * this->travel_distance));
+        this->synced = false;
+        this->follow_ratio = (float)steps_to_step / block->steps_event_count;
+        this->advance_rate = 0;
+
+        if( this->pressure_advance > 0 && this->travel_distance > 0 ) {
+            // while the head accelerates the filament is pushed ahead of its share by pressure_advance * filament acceleration,
+            // and given back while it decelerates, so over the block the extra is pressure_advance * the change in filament speed.
+            // It is never more than the block can take back, the extruder can't reverse within a block
+            float head_acceleration = block->rate_delta * THEKERNEL->acceleration_ticks_per_second; // main stepper steps/s^2
+            this->advance_rate = this->pressure_advance * head_acceleration * this->follow_ratio;
+            int advance_steps = lroundf(this->pressure_advance * ((float)block->final_rate - block->initial_rate) * this->follow_ratio);
+            steps_to_step = max(steps_to_step + advance_steps, 0);
+        }
+        this->last_head_rate = -1;
 
         if( steps_to_step != 0 ) {
             block->take();
             this->current_block = block;
 
             this->stepper_motor->move( ( this->travel_distance > 0 ), steps_to_step)->set_moved_last_block(true);
-            on_speed_change(this); // set initial speed
+
+            // Stepper sets our rate along with the axes' from then on, pressure advance needs to set it itself though
+            this->synced = this->step_with_axes && this->advance_rate == 0 && THEKERNEL->stepper->follow(block, this->stepper_motor);
+            if(!this->synced) on_speed_change(this); // set initial speed
         } else {
             this->current_block = NULL;
             this->stepper_motor->set_moved_last_block(false);
@@ -550,6 +630,12 @@ void Extruder::on_block_end(void *argument)
 {
     if(!this->enabled) return;
     this->current_block = NULL;
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, false);
+    if (this->follow_once) {
+        // a block after the zlift that carries no gcode must not follow at the zlift ratio
+        this->follow_once = false;
+        this->mode = OFF;
+    }
 }
 
 uint32_t Extruder::rate_increase() const {
@@ -594,6 +680,9 @@ void Extruder::on_speed_change( void *argument )
         return;
     }
 
+    // Stepper has already set our rate
+    if(this->synced) return;
+
     /*
     * nominal block duration = current block's steps / ( current block's nominal rate )
     * nominal extruder rate = extruder steps / nominal block duration
@@ -603,7 +692,30 @@ void Extruder::on_speed_change( void *argument )
     * or even : ( stepper steps per second ) * ( extruder steps / current block's steps )
     */
 
-    this->stepper_motor->set_speed(THEKERNEL->stepper->get_trapezoid_adjusted_rate() * (float)this->stepper_motor->get_steps_to_move() / (float)this->current_block->steps_event_count);
+    float head_rate = THEKERNEL->stepper->get_trapezoid_adjusted_rate();
+    float rate = head_rate * this->follow_ratio;
+
+    if(this->advance_rate > 0) {
+        // the head is accelerating if its rate went up since last time, or the block has just begun with a ramp up,
+        // once it gets to the nominal rate it cruises even though the rate stops changing on the tick that got it there
+        const Block *block = this->current_block;
+        float advance = 0;
+        if(head_rate < block->nominal_rate) {
+            if(this->last_head_rate < 0) {
+                if(block->accelerate_until > 0) advance = this->advance_rate;
+            } else if(head_rate > this->last_head_rate) {
+                advance = this->advance_rate;
+            } else if(head_rate < this->last_head_rate) {
+                advance = -this->advance_rate;
+            }
+        }
+        this->last_head_rate = head_rate;
+
+        // never stops the extruder, it may get to the end of its steps a little early instead
+        rate = max(rate + advance, rate * 0.1F);
+    }
+
+    this->stepper_motor->set_speed(rate);
 }
 
 // When the stepper has finished it's move
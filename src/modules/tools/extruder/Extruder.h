@@ -40,6 +40,11 @@ class Extruder : public Tool {
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
         uint32_t rate_increase() const;
+        // applied when the next block starts, so the moves already queued keep the old value
+        static void set_volumetric_multiplier(void *extruder, float value);
+        static void set_pressure_advance(void *extruder, float value);
+        void queue_zlift_move(float distance, float lift, float feedrate);
+        static void follow_zlift(void *extruder, float distance);
 
         StepperMotor*  stepper_motor;
         Pin            step_pin;                     // Step pin for the stepper driver
@@ -48,6 +53,7 @@ class Extruder : public Tool {
         float          target_position;              // End point ( in mm ) for the current move
         float          unstepped_distance;           // overflow buffer for requested moves that are less than 1 step
         Block*         current_block;                // Current block we are stepping, same as Stepper's one
+        int            acceleration_handler_id;
 
         // kept together so they can be passed as public data
         struct {
@@ -66,12 +72,20 @@ class Extruder : public Tool {
         float travel_ratio;
         float travel_distance;
 
+        // pressure advance
+        float pressure_advance;        // extra filament in mm per mm/s of filament speed, ie seconds
+        float follow_ratio;            // extruder steps per main stepper step for the current block, without the advance
+        float advance_rate;            // extruder steps/s added while the head accelerates, and taken off while it decelerates
+        float last_head_rate;
+
         // for firmware retract
         float retract_feedrate;
         float retract_recover_feedrate;
         float retract_recover_length;
         float retract_zlift_length;
         float retract_zlift_feedrate;
+        float retract_zlift_max_jerk;  // filament mm/sec change allowed going into and out of a zlift
+        float zlift_distance;          // filament moved during the zlift block
 
         struct {
             char mode:3;        // extruder motion mode,  OFF, SOLO, or FOLLOW
@@ -81,6 +95,9 @@ class Extruder : public Tool {
             bool single_config:1;
             bool retracted:1;
             bool cancel_zlift_restore:1; // hack to stop a G11 zlift restore from overring an absolute Z setting
+            bool step_with_axes:1;  // have Stepper set our rate in FOLLOW mode, with the actuators'
+            bool synced:1;          // Stepper is setting our rate for the current block
+            bool follow_once:1;     // following a zlift block, back to OFF when it ends
         };
 
 
@@ -21,7 +21,6 @@ using namespace std;
 
 #define extruder_module_enable_checksum      CHECKSUM("extruder_module_enable")
 #define extruder_checksum                    CHECKSUM("extruder")
-#define enable_checksum                      CHECKSUM("enable")
 
 void ExtruderMaker::load_tools(){
 
@@ -33,7 +32,7 @@ void ExtruderMaker::load_tools(){
         Extruder* extruder = new Extruder(0, true);
 
         // Add the module to the kernel
-        THEKERNEL->add_module( extruder );
+        THEKERNEL->add_module( extruder, "extruder" );
 
         // no toolmanager required so do not create one
         return;
@@ -48,13 +47,10 @@ void ExtruderMaker::load_tools(){
         return;
     }
 
-    // count number of enabled extruders
-    int cnt= 0;
-    for(auto cs : modules) {
-        if( THEKERNEL->config->value(extruder_checksum, cs, enable_checksum )->as_bool() ){
-            cnt++;
-        }
-    }
+    // the enabled ones
+    vector<uint16_t> enabled;
+    THEKERNEL->config->get_module_list( &enabled, extruder_checksum, true );
+    int cnt= enabled.size();
 
     if(cnt == 0) {
         THEKERNEL->streams->printf("NOTE: No extruders enabled\n");
@@ -65,7 +61,7 @@ void ExtruderMaker::load_tools(){
     if(cnt > 1) {
         // ONLY do this if multitool enabled and more than one tool is defined
         toolmanager= new ToolManager();
-        THEKERNEL->add_module( toolmanager );
+        THEKERNEL->add_module( toolmanager, "tool manager" );
 
     }else{
         // only one extruder so no tool manager required
@@ -73,27 +69,22 @@ void ExtruderMaker::load_tools(){
     }
 
 
-    // For every extruder found, setup the enabled ones
-    for(auto cs : modules){
-        // If module is enabled
-        if( THEKERNEL->config->value(extruder_checksum, cs, enable_checksum )->as_bool() ){
-
-            // Make a new extruder module
-            Extruder* extruder = new Extruder(cs);
+    // setup the enabled ones
+    for(auto cs : enabled){
+        // Make a new extruder module
+        Extruder* extruder = new Extruder(cs);
 
-            // Add the Extruder module to the kernel
-            THEKERNEL->add_module( extruder );
+        // Add the Extruder module to the kernel
+        THEKERNEL->add_module( extruder, "extruder" );
 
-            if(toolmanager != nullptr) {
-                // Add the extruder module to the ToolsManager if it was created
-                toolmanager->add_tool( extruder );
+        if(toolmanager != nullptr) {
+            // Add the extruder module to the ToolsManager if it was created
+            toolmanager->add_tool( extruder );
 
-            }else{
-                // if not managed by toolmanager we need to enable the one extruder
-                extruder->enable();
-            }
+        }else{
+            // if not managed by toolmanager we need to enable the one extruder
+            extruder->enable();
         }
-
     }
 
     THEKERNEL->streams->printf("NOTE: %d extruders enabled out of %d\n", cnt, modules.size());
@@ -0,0 +1,11 @@
+#ifndef __EXTRUDERPUBLICACCESS_H
+#define __EXTRUDERPUBLICACCESS_H
+
+#include "checksumm.h"
+
+// addresses used for public data access
+#define extruder_checksum                 CHECKSUM("extruder")
+// filament mm/s the extruder is moving at right now, third element is the extruder's name or 0 for whichever is moving
+#define extrusion_rate_checksum           CHECKSUM("extrusion_rate")
+
+#endif
@@ -9,6 +9,7 @@
 #include "libs/Kernel.h"
 #include "modules/communication/utils/Gcode.h"
 #include "modules/robot/Stepper.h"
+#include "StepperMotor.h"
 #include "Laser.h"
 #include "libs/nuts_bolts.h"
 #include "Config.h"
@@ -16,16 +17,23 @@
 #include "Block.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
+#include "Conveyor.h"
 
 #include "libs/Pin.h"
 #include "Gcode.h"
 #include "PwmOut.h" // mbed.h lib
 
+#include <string.h>
+
 #define laser_module_enable_checksum        CHECKSUM("laser_module_enable")
 #define laser_module_pin_checksum           CHECKSUM("laser_module_pin")
 #define laser_module_pwm_period_checksum    CHECKSUM("laser_module_pwm_period")
 #define laser_module_max_power_checksum     CHECKSUM("laser_module_max_power")
 #define laser_module_tickle_power_checksum  CHECKSUM("laser_module_tickle_power")
+#define laser_module_minimum_power_checksum CHECKSUM("laser_module_minimum_power")
+#define laser_module_continuous_checksum    CHECKSUM("laser_module_continuous_power")
+
+Laser *Laser::instance= nullptr;
 
 Laser::Laser(){
 }
@@ -45,7 +53,7 @@ void Laser::on_module_loaded() {
 
     if (laser_pin == NULL)
     {
-        THEKERNEL->streams->printf("Error: Laser cannot use P%d.%d (P2.0 - P2.5, P1.18, P1.20, P1.21, P1.23, P1.24, P1.26, P3.25, P2.26 only). Laser module disabled.\n", dummy_pin->port_number, dummy_pin->pin);
+        THEKERNEL->streams->printf("Error: Laser cannot use P%d.%d (P2.0 - P2.5, P1.18, P1.20, P1.21, P1.23, P1.24, P1.26, P3.25, P2.26 only, one per PWM1 channel). Laser module disabled.\n", dummy_pin->port_number, dummy_pin->pin);
         delete dummy_pin;
         delete this;
         return;
@@ -61,8 +69,25 @@ void Laser::on_module_loaded() {
 
     this->laser_max_power =    THEKERNEL->config->value(laser_module_max_power_checksum   )->by_default(0.8f)->as_number() ;
     this->laser_tickle_power = THEKERNEL->config->value(laser_module_tickle_power_checksum)->by_default(0   )->as_number() ;
+    this->laser_min_power    = THEKERNEL->config->value(laser_module_minimum_power_checksum)->by_default(0  )->as_number() ;
+    this->laser_continuous   = THEKERNEL->config->value(laser_module_continuous_checksum)->by_default(false)->as_bool() ;
+    this->laser_on = false;
+    this->laser_tickle = false;
+    this->power_per_rate = 0;
+    this->raster_pending = false;
+    this->raster_move = false;
+    this->raster_block = false;
+    this->raster_fill_count = 0;
+    this->raster_fill = 0;
+    this->raster = this->raster_buffers[1];
+    this->raster_count = 0;
+    this->raster_index = 0;
+    this->raster_steps = 0;
+    this->raster_scale = 0;
+    instance = this;
 
     //register for events
+    this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_GCODE_EXECUTE);
     this->register_for_event(ON_SPEED_CHANGE);
     this->register_for_event(ON_PLAY);
@@ -71,14 +96,41 @@ void Laser::on_module_loaded() {
     this->register_for_event(ON_BLOCK_END);
 }
 
+void Laser::set_power(float power){
+    this->laser_pin->write(this->laser_inverting ? 1 - power : power);
+}
+
 // Turn laser off laser at the end of a move
+// unless another one follows straight on, the next block then sets the power it wants without a gap
 void  Laser::on_block_end(void* argument){
-    this->laser_pin->write(this->laser_inverting ? 1 : 0);
+    this->raster_block = false;
+    if(this->laser_continuous && THEKERNEL->conveyor->has_next_block()) return;
+    this->set_power(0);
 }
 
 // Set laser power at the beginning of a block
 void Laser::on_block_begin(void* argument){
-    this->set_proportional_power();
+    const Block *block = static_cast<const Block *>(argument);
+    // worked out once here so each speed change is just a multiply
+    this->power_per_rate = (block->nominal_rate > 0) ? (this->laser_max_power - this->laser_min_power) / block->nominal_rate : 0;
+
+    if(this->laser_on && this->raster_move && this->raster_count > 0 && block->steps_event_count > 0) {
+        // a raster move, the pixels are clocked by the position of the axis that steps the most so they land in
+        // the same place whatever the speed, Stepper has already started this block so its main stepper is set
+        this->raster_steps = block->steps_event_count;
+        this->raster_index = 0;
+        this->raster_block = true;
+        this->set_raster_power();
+        StepperMotor *main = THEKERNEL->stepper->get_main_stepper();
+        if(main != nullptr && this->raster_count > 1) {
+            main->set_step_mark((this->raster_steps + this->raster_count - 1) / this->raster_count, &Laser::raster_step);
+        }
+    } else if(this->laser_on) {
+        this->set_proportional_power();
+    } else if(this->laser_continuous) {
+        // the power from the last block was left on
+        this->set_power(this->laser_tickle ? this->laser_tickle_power : 0);
+    }
 }
 
 // When the play/pause button is set to pause, or a module calls the ON_PAUSE event
@@ -91,17 +143,65 @@ void Laser::on_play(void* argument){
     this->set_proportional_power();
 }
 
+// M740 is queued with the moves so its pixels go with the G1 that follows it
+void Laser::on_gcode_received(void* argument){
+    Gcode* gcode = static_cast<Gcode*>(argument);
+    if(gcode->has_m && gcode->m == 740) {
+        THEKERNEL->conveyor->append_gcode(gcode);
+    }
+}
+
+// M740 <hex> adds a pixel for each pair of hex digits, in the order they are burnt, several M740 can make up one
+// raster move, hex as GcodeDispatch would split base64 wherever there is a G or M in it
+void Laser::add_raster_pixels(const char *hex){
+    int hi = -1;
+    uint8_t *pixels = this->raster_buffers[this->raster_fill];
+    for(const char *p = hex; *p != '\0' && this->raster_fill_count < RASTER_MAX_PIXELS; p++) {
+        int v;
+        if(*p >= '0' && *p <= '9')      v = *p - '0';
+        else if(*p >= 'A' && *p <= 'F') v = *p - 'A' + 10;
+        else if(*p >= 'a' && *p <= 'f') v = *p - 'a' + 10;
+        else continue; // spaces
+        if(hi < 0) {
+            hi = v;
+        } else {
+            pixels[this->raster_fill_count++] = (hi << 4) | v;
+            hi = -1;
+        }
+    }
+}
+
 // Turn laser on/off depending on received GCodes
 void Laser::on_gcode_execute(void* argument){
     Gcode* gcode = static_cast<Gcode*>(argument);
+    if(gcode->has_m && gcode->m == 740) {
+        // runs with the block before the raster move, so it must leave its laser state alone
+        const char *cmd = gcode->get_command();
+        const char *hex = strstr(cmd, "740");
+        this->add_raster_pixels(hex != nullptr ? hex + 3 : cmd);
+        this->raster_pending = true;
+        return;
+    }
     this->laser_on = false;
+    this->laser_tickle = false;
+    this->raster_move = false;
     if( gcode->has_g){
         int code = gcode->g;
         if( code == 0 ){                    // G0
-            this->laser_pin->write(this->laser_inverting ? 1 - this->laser_tickle_power : this->laser_tickle_power);
+            this->set_power(this->laser_tickle_power);
             this->laser_on =  false;
+            this->laser_tickle = true;
         }else if( code >= 1 && code <= 3 ){ // G1, G2, G3
             this->laser_on =  true;
+            if(this->raster_pending) {
+                // swapped here, the M740 for the next line can be in this same block
+                this->raster_pending = false;
+                this->raster = this->raster_buffers[this->raster_fill];
+                this->raster_count = this->raster_fill_count;
+                this->raster_fill ^= 1;
+                this->raster_fill_count = 0;
+                this->raster_move = true;
+            }
         }
     }
     if ( gcode->has_letter('S' )){
@@ -112,16 +212,44 @@ void Laser::on_gcode_execute(void* argument){
 }
 
 // We follow the stepper module here, so speed must be proportional
+// Stepper sends this for every rate it sets, which is once per segment with step_segments and every
+// acceleration_step_interval steps when that is set, so the power changes exactly when the step rate does
 void Laser::on_speed_change(void* argument){
-    if( this->laser_on ){
+    if(argument == nullptr) {
+        // the queue was flushed and the motors stopped
+        this->set_power(0);
+        return;
+    }
+    if(this->raster_block) {
+        this->set_raster_power();
+    } else if( this->laser_on ){
         this->set_proportional_power();
     }
 }
 
+// pixel power scales with speed like any other cut, so the shades stay even through acceleration
+void Laser::set_raster_power(){
+    float scale = (this->laser_min_power + this->power_per_rate * THEKERNEL->stepper->get_trapezoid_adjusted_rate()) / 255.0F;
+    this->raster_scale = scale;
+    this->set_power(this->raster[this->raster_index] * scale);
+}
+
+// Called from the step interrupt at each pixel boundary of a raster move, returns the step of the next boundary
+uint32_t Laser::raster_step(uint32_t stepped){
+    Laser *l = instance;
+    if(!l->raster_block) return 0;
+    uint32_t i = (uint64_t)stepped * l->raster_count / l->raster_steps;
+    if(i >= l->raster_count) return 0;
+    l->raster_index = i;
+    l->set_power(l->raster[i] * l->raster_scale);
+    if(i + 1 >= l->raster_count) return 0;
+    // first step of the next pixel
+    return ((uint64_t)(i + 1) * l->raster_steps + l->raster_count - 1) / l->raster_count;
+}
+
 void Laser::set_proportional_power(){
     if( this->laser_on && THEKERNEL->stepper->get_current_block() ){
-        // adjust power to maximum power and actual velocity
-        float proportional_power = float(float(this->laser_max_power) * float(THEKERNEL->stepper->get_trapezoid_adjusted_rate()) / float(THEKERNEL->stepper->get_current_block()->nominal_rate));
-        this->laser_pin->write(this->laser_inverting ? 1 - proportional_power : proportional_power);
+        // adjust power to the actual velocity, between the minimum and maximum power
+        this->set_power(this->laser_min_power + this->power_per_rate * THEKERNEL->stepper->get_trapezoid_adjusted_rate());
     }
 }
@@ -10,6 +10,11 @@
 
 #include "libs/Module.h"
 
+#include <stdint.h>
+
+// most pixels one raster move can carry, across all the M740 lines before it
+#define RASTER_MAX_PIXELS 256
+
 namespace mbed {
     class PwmOut;
 }
@@ -23,18 +28,40 @@ class Laser : public Module{
         void on_block_begin(void* argument);
         void on_play(void* argument);
         void on_pause(void* argument);
+        void on_gcode_received(void* argument);
         void on_gcode_execute(void* argument);
         void on_speed_change(void* argument);
 
     private:
         void set_proportional_power();
+        void set_power(float power);
+        void add_raster_pixels(const char *hex);
+        void set_raster_power();
+        static uint32_t raster_step(uint32_t stepped);
+        static Laser *instance;     // for the step interrupt
         mbed::PwmOut *laser_pin;    // PWM output to regulate the laser power
         struct {
             bool laser_on:1;     // Laser status
             bool laser_inverting:1; // stores whether the pwm period should be inverted
+            bool laser_tickle:1;    // the current move is a G0, which keeps the tickle power
+            bool laser_continuous:1; // keep the power from one block to the next
+            bool raster_pending:1;  // M740 has pixels for the next G1
+            bool raster_move:1;     // the block starting is a raster move
+            volatile bool raster_block:1; // the current block is a raster move
         };
+        // pixel power 0-255, spread evenly along the raster move, the next line fills one while the other is burnt
+        uint8_t          raster_buffers[2][RASTER_MAX_PIXELS];
+        uint16_t         raster_fill_count;
+        uint8_t          raster_fill;     // buffer M740 adds to
+        const uint8_t   *raster;          // pixels being burnt
+        uint16_t         raster_count;
+        volatile uint16_t raster_index;   // pixel being burnt
+        uint32_t         raster_steps;    // main stepper steps in the raster move
+        volatile float   raster_scale;    // power for a pixel value of 255 at the current speed
         float            laser_max_power; // maximum allowed laser power to be output on the pwm pin
+        float            laser_min_power; // power at the lowest speed of a cutting move
         float            laser_tickle_power; // value used to tickle the laser on moves
+        float            power_per_rate;  // (max - min) power per step/s of the current block
 };
 
 #endif
@@ -45,7 +45,7 @@ void SCARAcal::on_module_loaded()
     // load settings
     this->on_config_reload(this);
     // register event-handlers
-    register_for_event(ON_GCODE_RECEIVED);
+    register_for_gcodes('M', {114, 360, 361, 364});
 }
 
 void SCARAcal::on_config_reload(void *argument)
@@ -91,6 +91,14 @@ bool SCARAcal::get_trim(float& x, float& y, float& z)
     return false;
 }
 
+// the arm angles of the last queued position, which is where the arm is once the queue has run
+void SCARAcal::get_actuators(float actuators[3])
+{
+    float cartesian[3];
+    THEKERNEL->robot->get_axis_position(cartesian);                                // get actual position from robot
+    THEKERNEL->robot->arm_solution->cartesian_to_actuator( cartesian, actuators ); // translate to get actuator position
+}
+
 void SCARAcal::SCARA_ang_move(float theta, float psi, float z, float feedrate)
 {
     char cmd[64];
@@ -125,11 +133,9 @@ void SCARAcal::on_gcode_received(void *argument)
 
             case 114: {    // Extra stuff for Morgan calibration
                 char buf[32];
-                float cartesian[3],
-                      actuators[3];
+                float actuators[3];
 
-                THEKERNEL->robot->get_axis_position(cartesian);    // get actual position from robot
-                THEKERNEL->robot->arm_solution->cartesian_to_actuator( cartesian, actuators );      // translate to get actuator position
+                this->get_actuators(actuators);
 
                 int n = snprintf(buf, sizeof(buf), "  A: Th:%1.3f Ps:%1.3f",
                                  actuators[0],
@@ -147,14 +153,11 @@ void SCARAcal::on_gcode_received(void *argument)
                 this->get_trim(S_trim[0], S_trim[1], S_trim[2]);	// get current trim to conserve other calbration values
 
                 if(gcode->has_letter('P')) {
-                    // Program the current position as target
-                    float cartesian[3],
-                          actuators[3],
-                          S_delta[2],
-                          S_trim[3];
+                    // Program the current position as target, keeping the Psi trim read above
+                    float actuators[3],
+                          S_delta[2];
 
-                    THEKERNEL->robot->get_axis_position(cartesian);    // get actual position from robot
-                    THEKERNEL->robot->arm_solution->cartesian_to_actuator( cartesian, actuators );      // translate to get actuator position
+                    this->get_actuators(actuators);
 
                     S_delta[0] = actuators[0] - target[0];
 
@@ -171,11 +174,9 @@ void SCARAcal::on_gcode_received(void *argument)
                 float target[2] = {90.0F, 130.0F};
                 if(gcode->has_letter('P')) {
                     // Program the current position as target
-                    float cartesian[3],
-                          actuators[3];
+                    float actuators[3];
 
-                    THEKERNEL->robot->get_axis_position(cartesian);                                // get actual position from robot
-                    THEKERNEL->robot->arm_solution->cartesian_to_actuator( cartesian, actuators ); // translate to get actuator position
+                    this->get_actuators(actuators);
 
                     STEPPER[0]->change_steps_per_mm(actuators[0] / target[0] * STEPPER[0]->get_steps_per_mm()); // Find angle difference
                     STEPPER[1]->change_steps_per_mm(STEPPER[0]->get_steps_per_mm());  // and change steps_per_mm to ensure correct steps per *angle* 
@@ -194,12 +195,10 @@ void SCARAcal::on_gcode_received(void *argument)
 
                 if(gcode->has_letter('P')) {
                     // Program the current position as target
-                    float cartesian[3],
-                          actuators[3],
+                    float actuators[3],
                           S_delta[2];
 
-                    THEKERNEL->robot->get_axis_position(cartesian);                                     // get actual position from robot
-                    THEKERNEL->robot->arm_solution->cartesian_to_actuator( cartesian, actuators );      // translate it to get actual actuator angles
+                    this->get_actuators(actuators);
 
                     S_delta[1] = actuators[1] - target[1];                 // Find difference, and 
                     set_trim(S_trim[0], S_delta[1], 0, gcode->stream);     // set trim to reflect the difference
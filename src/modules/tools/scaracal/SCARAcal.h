@@ -30,6 +30,7 @@ private:
     void home();
     bool set_trim(float x, float y, float z, StreamOutput *stream);
     bool get_trim(float& x, float& y, float& z);
+    void get_actuators(float actuators[3]);
 
     void SCARA_ang_move(float theta, float psi, float z, float feedrate);
 
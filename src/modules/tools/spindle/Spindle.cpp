@@ -16,12 +16,21 @@
 #include "StreamOutputPool.h"
 #include "SlowTicker.h"
 #include "Conveyor.h"
+#include "Block.h"
+#include "Stepper.h"
+#include "StepperMotor.h"
+#include "Pauser.h"
+#include "StreamOutput.h"
 #include "system_LPC17xx.h"
 
 #include "libs/Pin.h"
 #include "InterruptIn.h"
 #include "PwmOut.h"
 #include "port_api.h"
+#include "us_ticker_api.h"
+
+#include <algorithm>
+#include <stdlib.h>
 
 #define spindle_enable_checksum          CHECKSUM("spindle_enable")
 #define spindle_pwm_pin_checksum         CHECKSUM("spindle_pwm_pin")
@@ -32,8 +41,24 @@
 #define spindle_control_P_checksum       CHECKSUM("spindle_control_P")
 #define spindle_control_I_checksum       CHECKSUM("spindle_control_I")
 #define spindle_control_D_checksum       CHECKSUM("spindle_control_D")
+#define spindle_feedback_qei_checksum    CHECKSUM("spindle_feedback_qei")
+#define spindle_feedback_quadrature_checksum CHECKSUM("spindle_feedback_quadrature")
+#define spindle_sync_gain_checksum       CHECKSUM("spindle_sync_gain")
+#define spindle_control_frequency_checksum CHECKSUM("spindle_control_frequency")
+#define spindle_at_speed_tolerance_checksum CHECKSUM("spindle_at_speed_tolerance")
+#define spindle_wait_at_speed_checksum   CHECKSUM("spindle_wait_at_speed")
+#define spindle_at_speed_timeout_checksum CHECKSUM("spindle_at_speed_timeout")
+
+// full PWM in the controller's fixed point
+#define PWM_ONE (1LL << 32)
 
-#define UPDATE_FREQ 1000
+// M959 moves on from a point once the RPM has changed by no more than 1% over this long, or after the timeout
+#define TUNE_SETTLE_US  250000
+#define TUNE_TIMEOUT_US 10000000
+
+// a QEI measurement ends after this many pulses, or this long if there were fewer
+#define QEI_MIN_PULSES 64
+#define QEI_WINDOW_US  100000
 
 Spindle::Spindle()
 {
@@ -44,10 +69,18 @@ void Spindle::on_module_loaded()
     last_time = 0;
     last_edge = 0;
     current_rpm = 0;
-    current_I_value = 0;
-    current_pwm_value = 0;
+    integral = 0;
+    prev_error = 0;
+    current_pwm = 0;
+    written_pwm = 0;
     time_since_update = 0;
     spindle_on = true;
+    at_speed = false;
+    at_speed_count = 0;
+    waiting = false;
+    tune_point = -1;
+    for (int i = 0; i < ff_points; i++)
+        ff_rpm[i] = 0;
     
     if (!THEKERNEL->config->value(spindle_enable_checksum)->by_default(false)->as_bool())
     {
@@ -56,10 +89,18 @@ void Spindle::on_module_loaded()
     }
 
     pulses_per_rev = THEKERNEL->config->value(spindle_pulses_per_rev_checksum)->by_default(1.0f)->as_number();
-    target_rpm = THEKERNEL->config->value(spindle_default_rpm_checksum)->by_default(5000.0f)->as_number();
     control_P_term = THEKERNEL->config->value(spindle_control_P_checksum)->by_default(0.0001f)->as_number();
     control_I_term = THEKERNEL->config->value(spindle_control_I_checksum)->by_default(0.0001f)->as_number();
     control_D_term = THEKERNEL->config->value(spindle_control_D_checksum)->by_default(0.0001f)->as_number();
+    update_freq = confine(THEKERNEL->config->value(spindle_control_frequency_checksum)->by_default(1000)->as_int(), 100, 10000);
+    at_speed_tolerance = THEKERNEL->config->value(spindle_at_speed_tolerance_checksum)->by_default(5.0f)->as_number();
+    at_speed_ticks = update_freq / 20; // 50ms
+    wait_at_speed = THEKERNEL->config->value(spindle_wait_at_speed_checksum)->by_default(false)->as_bool();
+    at_speed_timeout_us = THEKERNEL->config->value(spindle_at_speed_timeout_checksum)->by_default(10.0f)->as_number() * 1000000;
+    sync_gain = THEKERNEL->config->value(spindle_sync_gain_checksum)->by_default(50.0f)->as_number();
+    sync_block = nullptr;
+    update_gains();
+    set_target(THEKERNEL->config->value(spindle_default_rpm_checksum)->by_default(5000.0f)->as_number());
     
     // Get the pin for hardware pwm
     {
@@ -72,7 +113,7 @@ void Spindle::on_module_loaded()
     
     if (spindle_pin == NULL)
     {
-        THEKERNEL->streams->printf("Error: Spindle PWM pin must be P2.0-2.5 or other PWM pin\n");
+        THEKERNEL->streams->printf("Error: Spindle PWM pin must be P2.0-2.5 or other PWM pin, on a PWM1 channel not already used\n");
         delete this;
         return;
     }
@@ -81,7 +122,15 @@ void Spindle::on_module_loaded()
     spindle_pin->period_us(period);
     spindle_pin->write(output_inverted ? 1 : 0);
     
+    // The QEI counts the feedback pulses on P1.23 (and P1.20 for a quadrature encoder) in hardware, so there is no
+    // interrupt per pulse, the timer capture inputs can't be used for this as all four timers are already taken
+    qei_feedback = THEKERNEL->config->value(spindle_feedback_qei_checksum)->by_default(false)->as_bool();
+    if (qei_feedback)
+    {
+        setup_qei(THEKERNEL->config->value(spindle_feedback_quadrature_checksum)->by_default(false)->as_bool());
+    }
     // Get the pin for interrupt
+    else
     {
         Pin *smoothie_pin = new Pin();
         smoothie_pin->from_string(THEKERNEL->config->value(spindle_feedback_pin_checksum)->by_default("nc")->as_string());
@@ -101,11 +150,62 @@ void Spindle::on_module_loaded()
         delete smoothie_pin;
     }
     
-    SysTick_Config(SYSTICK_MAXCOUNT, false);
+    if (!qei_feedback)
+        SysTick_Config(SYSTICK_MAXCOUNT, false);
+
+    // the rpm << 8 is this divided by the cycles between two pulses, or this times the pulses counted divided by the us taken
+    rpm_scale = qei_feedback ? 60000000.0f * 256 / pulses_per_rev : SystemCoreClock * 60.0f * 256 / pulses_per_rev;
     
-    THEKERNEL->slow_ticker->attach(UPDATE_FREQ, this, &Spindle::on_update_speed);
-    register_for_event(ON_GCODE_RECEIVED);
+    THEKERNEL->slow_ticker->attach<Spindle, &Spindle::on_update_speed>(update_freq, this);
+    register_for_gcodes('M', {3, 5, 500, 503, 957, 958, 959});
     register_for_event(ON_GCODE_EXECUTE);
+    register_for_event(ON_BLOCK_BEGIN);
+    register_for_event(ON_BLOCK_END);
+    register_for_event(ON_IDLE);
+    register_for_event(ON_HALT);
+}
+
+// the controller takes the output as a fraction of full PWM with 32 bits after the point for each rpm of error
+void Spindle::update_gains()
+{
+    kp = control_P_term * PWM_ONE;
+    ki = control_I_term * PWM_ONE / update_freq;
+    kd = control_D_term * PWM_ONE * update_freq;
+}
+
+void Spindle::set_target(int32_t rpm)
+{
+    int64_t ff = feed_forward_for(rpm);
+    int32_t band = rpm * at_speed_tolerance / 100;
+    __disable_irq();
+    target_rpm = rpm;
+    feed_forward = ff;
+    at_speed_band = band;
+    at_speed_count = 0;
+    at_speed = false;
+    __enable_irq();
+}
+
+// the PWM that gives rpm, between the two points of the curve it is between, half PWM as before if there is no curve
+int64_t Spindle::feed_forward_for(int32_t rpm) const
+{
+    if (ff_rpm[ff_points - 1] <= 0)
+        return PWM_ONE / 2;
+    if (rpm <= 0)
+        return 0;
+
+    int32_t below = 0;
+    for (int i = 0; i < ff_points; i++)
+    {
+        if (rpm <= ff_rpm[i])
+        {
+            int32_t span = ff_rpm[i] - below;
+            int64_t part = span > 0 ? ((int64_t)(rpm - below) << 32) / span : 0;
+            return (((int64_t)i << 32) + part) / ff_points;
+        }
+        below = ff_rpm[i];
+    }
+    return PWM_ONE;
 }
 
 void Spindle::on_pin_rise()
@@ -116,56 +216,246 @@ void Spindle::on_pin_rise()
     irq_count++;
 }
 
-uint32_t Spindle::on_update_speed(uint32_t dummy)
+void Spindle::setup_qei(bool quadrature)
 {
-    // If we don't get any interrupts for 1 second, set current RPM to 0
-    uint32_t new_irq = irq_count;
-    if (last_irq != new_irq)
-        time_since_update = 0;
+    LPC_SC->PCONP |= (1 << 18);                 // power the QEI
+    LPC_PINCON->PINSEL3 = (LPC_PINCON->PINSEL3 & ~(3 << 14)) | (1 << 14); // P1.23 is MCI1
+    if (quadrature)
+    {
+        LPC_PINCON->PINSEL3 = (LPC_PINCON->PINSEL3 & ~(3 << 8)) | (1 << 8); // P1.20 is MCI0
+        LPC_QEI->QEICONF = (1 << 2);            // count every edge of both phases
+    }
     else
-        time_since_update++;
-    last_irq = new_irq;
-    
-    if (time_since_update > UPDATE_FREQ)
-        last_time = 0;
-    
-    // Calculate current RPM
-    uint32_t t = last_time;
-    if (t == 0)
-        current_rpm = 0;
+    {
+        LPC_QEI->QEICONF = (1 << 1);            // MCI1 is a clock, MCI0 left as the direction
+    }
+    LPC_QEI->QEIMAXPOS = 0xFFFFFFFF;            // let the position wrap, only differences are used
+    LPC_QEI->FILTER = 0;
+    LPC_QEI->QEICON = 1;                        // reset the position
+    window_pos = LPC_QEI->QEIPOS;
+    window_start = us_ticker_read();
+}
+
+// Speed from the pulses the QEI counted, the measurement is long enough to count a good number of them so the
+// one pulse uncertainty of where it starts and ends stays small
+void Spindle::update_qei_rpm()
+{
+    uint32_t pos = LPC_QEI->QEIPOS;
+    uint32_t now = us_ticker_read();
+    int32_t n = pos - window_pos;
+    if (n < 0) n = -n; // the direction input may count down
+    uint32_t dt = now - window_start;
+
+    if (n >= QEI_MIN_PULSES || (n > 0 && dt >= QEI_WINDOW_US))
+        current_rpm = ((uint64_t)n * rpm_scale / dt) >> 8;
+    else if (dt >= 1000000)
+        current_rpm = 0; // no pulses for 1 second
     else
-        current_rpm = SystemCoreClock * 60.0f / (t * pulses_per_rev);
+        return;
+
+    window_pos = pos;
+    window_start = now;
+}
+
+// Feedback pulses counted since start, whichever way the spindle turns
+uint32_t Spindle::pulses_since(uint32_t start) const
+{
+    if (!qei_feedback)
+        return irq_count - start;
+    int32_t n = LPC_QEI->QEIPOS - start;
+    return (n < 0) ? -n : n;
+}
+
+// Stepper has already set up the block, and it is only synchronized if Stepper is moving it
+void Spindle::on_block_begin(void *argument)
+{
+    const Block *block = static_cast<const Block *>(argument);
+    if (block->spindle_pitch <= 0.0F || THEKERNEL->stepper->get_current_block() != block)
+        return;
+
+    sync_start = qei_feedback ? LPC_QEI->QEIPOS : irq_count;
+    sync_steps_per_rev = block->spindle_pitch * block->steps_event_count / block->millimeters;
+    sync_block = block;
+}
+
+void Spindle::on_block_end(void *argument)
+{
+    sync_block = nullptr;
+}
+
+// The rate that keeps the main stepper where the spindle says it should be, the measured speed as the feed forward and
+// the position error to take out any drift
+void Spindle::update_synchronized_rate()
+{
+    if (sync_block == nullptr || THEKERNEL->stepper->get_current_block() != sync_block)
+        return;
+    StepperMotor *main = THEKERNEL->stepper->get_main_stepper();
+    if (main == nullptr)
+        return;
+
+    float target = pulses_since(sync_start) * sync_steps_per_rev / pulses_per_rev;
+    float rate = current_rpm * sync_steps_per_rev / 60.0f + (target - main->get_stepped()) * sync_gain;
+    THEKERNEL->stepper->set_synchronized_rate(rate > 0.0f ? rate : 0.0f);
+}
+
+// The RPM from the feedback and the PWM output, in the main loop as the 64 bit divides and the float PwmOut takes
+// are too slow for the interrupt. The controller uses the last RPM worked out here
+void Spindle::update_rpm_and_pwm()
+{
+    if (qei_feedback)
+    {
+        update_qei_rpm();
+    }
+    else
+    {
+        uint32_t t = last_time;
+        if (t == 0)
+            current_rpm = 0;
+        else
+            current_rpm = (rpm_scale / t) >> 8;
+    }
+
+    uint32_t pwm = current_pwm;
+    if (pwm != written_pwm)
+    {
+        written_pwm = pwm;
+        spindle_pin->write((output_inverted ? 65536 - pwm : pwm) * (1.0f / 65536));
+    }
+}
+
+uint32_t Spindle::on_update_speed(uint32_t dummy)
+{
+    if (!qei_feedback)
+    {
+        // If we don't get any interrupts for 1 second, set current RPM to 0
+        uint32_t new_irq = irq_count;
+        if (last_irq != new_irq)
+            time_since_update = 0;
+        else
+            time_since_update++;
+        last_irq = new_irq;
+
+        if (time_since_update > (int)update_freq)
+            last_time = 0;
+    }
+
+    update_synchronized_rate();
     
-    if (spindle_on)
+    if (tune_point >= 0)
     {
-        float error = target_rpm - current_rpm;
+        // open loop at the point being measured
+        current_pwm = (65536 * (tune_point + 1)) / ff_points;
+    }
+    else if (spindle_on)
+    {
+        int32_t error = target_rpm - current_rpm;
         
-        current_I_value += control_I_term * error * 1.0f / UPDATE_FREQ;
-        current_I_value = confine(current_I_value, -1.0f, 1.0f);
+        integral += ki * error;
+        integral = confine(integral, -PWM_ONE, PWM_ONE);
         
-        float new_pwm = 0.5f;
-        new_pwm += control_P_term * error;
-        new_pwm += current_I_value;
-        new_pwm += control_D_term * UPDATE_FREQ * (error - prev_error);
-        new_pwm = confine(new_pwm, 0.0f, 1.0f);
+        int64_t out = feed_forward + kp * error + integral + kd * (error - prev_error);
+        out = confine(out, (int64_t)0, PWM_ONE);
         prev_error = error;
         
-        current_pwm_value = new_pwm;
+        current_pwm = out >> 16;
+
+        if ((error < 0 ? -error : error) > at_speed_band)
+        {
+            at_speed_count = 0;
+            at_speed = false;
+        }
+        else if (at_speed_count < at_speed_ticks)
+            at_speed_count++;
+        else
+            at_speed = true;
     }
     else
     {
-        current_I_value = 0;
-        current_pwm_value = 0;
+        integral = 0;
+        current_pwm = 0;
+        at_speed = false;
     }
     
-    if (output_inverted)
-        spindle_pin->write(1.0f - current_pwm_value);
-    else
-        spindle_pin->write(current_pwm_value);
-    
     return 0;
 }
 
+// M959 measures the RPM at each eighth of full PWM, for the feed forward
+void Spindle::start_autotune(StreamOutput *stream)
+{
+    THEKERNEL->conveyor->wait_for_empty_queue();
+    tune_stream = stream;
+    tune_last_rpm = -1;
+    tune_start = tune_checked = us_ticker_read();
+    tune_point = 0;
+    stream->printf("Spindle autotune started, the spindle runs up to full speed\n");
+}
+
+void Spindle::autotune_step()
+{
+    uint32_t now = us_ticker_read();
+    if (now - tune_checked < TUNE_SETTLE_US)
+        return;
+    tune_checked = now;
+
+    int32_t rpm = current_rpm;
+    bool settled = tune_last_rpm >= 0 && abs(rpm - tune_last_rpm) <= std::max(rpm / 100, (int32_t)2);
+    bool timed_out = now - tune_start >= TUNE_TIMEOUT_US;
+    tune_last_rpm = rpm;
+    if (!settled && !timed_out)
+        return;
+
+    // the curve has to go up for the feed forward to find a point on it
+    int32_t below = tune_point > 0 ? ff_rpm[tune_point - 1] : 0;
+    ff_rpm[tune_point] = std::max(rpm, below + 1);
+    tune_stream->printf("PWM %3d%%: %ld rpm%s\n", (tune_point + 1) * 100 / ff_points, rpm, timed_out ? " (did not settle)" : "");
+
+    if (++tune_point < ff_points)
+    {
+        tune_last_rpm = -1;
+        tune_start = now;
+        return;
+    }
+
+    tune_point = -1;
+    spindle_on = false;
+    set_target(target_rpm);
+    tune_stream->printf("Spindle autotune done, the spindle is off. M500 saves the curve\n");
+}
+
+void Spindle::on_idle(void *argument)
+{
+    update_rpm_and_pwm();
+
+    if (tune_point >= 0)
+        autotune_step();
+
+    if (waiting && (at_speed || us_ticker_read() - wait_start >= at_speed_timeout_us))
+    {
+        if (!at_speed)
+            THEKERNEL->streams->printf("Spindle not at speed after %lus, carrying on: %ld/%ld rpm\n",
+                                       at_speed_timeout_us / 1000000, (int32_t)current_rpm, target_rpm);
+        waiting = false;
+        THEKERNEL->pauser->release();
+    }
+}
+
+void Spindle::on_halt(void *argument)
+{
+    if (argument != nullptr)
+        return;
+
+    if (tune_point >= 0)
+    {
+        tune_point = -1;
+        spindle_on = false;
+    }
+    if (waiting)
+    {
+        waiting = false;
+        THEKERNEL->pauser->release();
+    }
+}
+
 
 void Spindle::on_gcode_received(void* argument)
 {
@@ -176,9 +466,10 @@ void Spindle::on_gcode_received(void* argument)
         if (gcode->m == 957)
         {
             // M957: report spindle speed
-            THEKERNEL->streams->printf("Current RPM: %5.0f  Target RPM: %5.0f  PWM value: %5.3f\n",
-                                       current_rpm, target_rpm, current_pwm_value);
-            gcode->mark_as_taken();
+            THEKERNEL->streams->printf("Current RPM: %5ld  Target RPM: %5ld  PWM value: %5.3f%s\n",
+                                       (int32_t)current_rpm, target_rpm, current_pwm / 65536.0f,
+                                       spindle_on && at_speed ? "  at speed" : "");
+            gcode->mark_as_consumed();
         }
         else if (gcode->m == 958)
         {
@@ -189,14 +480,53 @@ void Spindle::on_gcode_received(void* argument)
                 control_I_term = gcode->get_value('I');
             if (gcode->has_letter('D'))
                 control_D_term = gcode->get_value('D');
+            update_gains();
             THEKERNEL->streams->printf("P: %0.6f I: %0.6f D: %0.6f\n",
                 control_P_term, control_I_term, control_D_term);
         }
+        else if (gcode->m == 959)
+        {
+            // M959 P<point> R<rpm> sets a point of the feed forward curve, M959 S0 stops an autotune, M959 starts one
+            if (gcode->has_letter('P') && gcode->has_letter('R'))
+            {
+                int n = gcode->get_value('P');
+                if (n >= 1 && n <= ff_points)
+                {
+                    ff_rpm[n - 1] = gcode->get_value('R');
+                    set_target(target_rpm);
+                }
+            }
+            else if (gcode->has_letter('S') && gcode->get_value('S') == 0)
+            {
+                if (tune_point >= 0)
+                {
+                    tune_point = -1;
+                    spindle_on = false;
+                    gcode->stream->printf("Spindle autotune stopped\n");
+                }
+            }
+            else if (tune_point < 0)
+            {
+                start_autotune(gcode->stream);
+            }
+        }
+        else if (gcode->m == 500 || gcode->m == 503)
+        {
+            if (ff_rpm[ff_points - 1] > 0)
+            {
+                gcode->stream->printf(";Spindle feed forward, RPM at each eighth of full PWM:\n");
+                for (int i = 0; i < ff_points; i++)
+                    gcode->stream->printf("M959 P%d R%ld\n", i + 1, ff_rpm[i]);
+            }
+        }
         else if (gcode->m == 3 || gcode->m == 5)
         {
             // M3: Spindle on, M5: Spindle off
             THEKERNEL->conveyor->append_gcode(gcode);
             gcode->mark_as_taken();
+            // the moves after an M3 wait for the spindle to get to speed, in their own block so none of them start first
+            if (gcode->m == 3 && wait_at_speed)
+                THEKERNEL->conveyor->queue_head_block();
         }
     }
 }
@@ -214,7 +544,16 @@ void Spindle::on_gcode_execute(void* argument)
             
             if (gcode->has_letter('S'))
             {
-                target_rpm = gcode->get_value('S');
+                set_target(gcode->get_value('S'));
+            }
+
+            if (wait_at_speed && !waiting)
+            {
+                at_speed = false;
+                at_speed_count = 0;
+                wait_start = us_ticker_read();
+                THEKERNEL->pauser->take();
+                waiting = true;
             }
         }
         else if (gcode->m == 5)
@@ -11,12 +11,18 @@
 #include "libs/Module.h"
 #include <stdint.h>
 
+class Block;
+class StreamOutput;
+
 namespace mbed {
     class PwmOut;
     class InterruptIn;
 }
 
 // This module implements closed loop PID control for spindle RPM.
+// The controller runs in fixed point, the chip has no FPU, in whole rpm and fractions of full PWM with 32 bits after the
+// point. The PWM the measured RPM to PWM curve says gives the target is fed forward, so the PID only has to take out
+// what the curve gets wrong
 class Spindle: public Module {
     public:
         Spindle();
@@ -26,34 +32,87 @@ class Spindle: public Module {
         
     private:
         void on_pin_rise();
+        void setup_qei(bool quadrature);
+        void update_qei_rpm();
+        void update_rpm_and_pwm();
+        uint32_t pulses_since(uint32_t start) const;
+        void on_block_begin(void *argument);
+        void on_block_end(void *argument);
+        void update_synchronized_rate();
         void on_gcode_received(void *argument);
         void on_gcode_execute(void *argument);
+        void on_idle(void *argument);
+        void on_halt(void *argument);
         uint32_t on_update_speed(uint32_t dummy);
+        void update_gains();
+        void set_target(int32_t rpm);
+        int64_t feed_forward_for(int32_t rpm) const;
+        void start_autotune(StreamOutput *stream);
+        void autotune_step();
         
         mbed::PwmOut *spindle_pin; // PWM output for spindle speed control
         mbed::InterruptIn *feedback_pin; // Interrupt pin for measuring speed
         bool output_inverted;
+        bool qei_feedback; // the QEI counts the pulses instead of an interrupt per pulse
         
         // Current values, updated at runtime
         bool spindle_on;
-        float current_rpm;
-        float target_rpm;
-        float current_I_value;
-        float prev_error;
-        float current_pwm_value;
+        volatile int32_t current_rpm;
+        int32_t target_rpm;
+        int64_t integral;           // the I term
+        int32_t prev_error;
+        int64_t feed_forward;       // the PWM for target_rpm from the curve
+        volatile uint32_t current_pwm; // 0 to 65536 for full
+        uint32_t written_pwm;       // what the output was last set to
         int time_since_update;
         uint32_t last_irq;
         
         // Values from config
+        uint32_t update_freq;
         float pulses_per_rev;
+        uint64_t rpm_scale;         // rpm << 8 from one pulse period in cycles, or from the pulses counted in a us
         float control_P_term;
         float control_I_term;
         float control_D_term;
+        int64_t kp, ki, kd;         // the PID terms for the controller, I and D per tick of it
+
+        // the RPM at each eighth of full PWM, measured by M959 and all 0 until it has been
+        static const int ff_points = 8;
+        int32_t ff_rpm[ff_points];
+
+        // at speed once the RPM has stayed within the band around the target for at_speed_ticks, with
+        // spindle_wait_at_speed an M3 holds the moves after it until then
+        int32_t at_speed_band;
+        float at_speed_tolerance;   // percent of the target
+        uint16_t at_speed_count;
+        uint16_t at_speed_ticks;
+        volatile bool at_speed;
+        bool wait_at_speed;
+        bool waiting;
+        uint32_t wait_start;
+        uint32_t at_speed_timeout_us;
+
+        // M959 runs the spindle open loop at each point of the curve in turn, -1 when it is not running
+        int8_t tune_point;
+        int32_t tune_last_rpm;
+        uint32_t tune_start;        // when the point started
+        uint32_t tune_checked;      // when the RPM was last compared
+        StreamOutput *tune_stream;
         
         // These fields are updated by the interrupt
         uint32_t last_edge; // Timestamp of last edge
         volatile uint32_t last_time; // Time delay between last two edges
         volatile uint32_t irq_count;
+
+        // QEI position and time at the start of the current measurement
+        uint32_t window_pos;
+        uint32_t window_start;
+
+        // G33, the main stepper's position is locked to the spindle's from where both were when the block started
+        const Block * volatile sync_block;
+        uint32_t sync_start;        // spindle pulse count at the start of the block
+        float sync_steps_per_rev;   // main stepper steps per spindle revolution
+        float sync_gain;            // steps/s added per step the main stepper is behind
 };
 
 #endif
@@ -11,15 +11,19 @@
 #include <math.h>
 #include "Switch.h"
 #include "libs/Pin.h"
-#include "modules/robot/Conveyor.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "SwitchPublicAccess.h"
 #include "SlowTicker.h"
+#include "PinEvents.h"
 #include "Config.h"
 #include "Gcode.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "libs/StreamOutput.h"
+#include "libs/StreamOutputPool.h"
+#include "SwitchPool.h"
+#include "MachineStatus.h"
 
 #include "MRI_Hooks.h"
 
@@ -34,6 +38,7 @@
 #define    output_pin_checksum          CHECKSUM("output_pin")
 #define    output_type_checksum         CHECKSUM("output_type")
 #define    max_pwm_checksum             CHECKSUM("max_pwm")
+#define    hardware_pwm_checksum        CHECKSUM("hardware_pwm")
 #define    output_on_command_checksum   CHECKSUM("output_on_command")
 #define    output_off_command_checksum  CHECKSUM("output_off_command")
 
@@ -49,11 +54,9 @@ void Switch::on_module_loaded()
 {
     this->switch_changed = false;
 
-    this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GCODE_EXECUTE);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    // our on and off commands are handled by SwitchPool
+    this->register_for_main_loop(MAIN_LOOP_NORMAL, "switch");
+    PublicData::register_owner(switch_checksum, this);
 
     // Settings
     this->on_config_reload(this);
@@ -67,7 +70,13 @@ void Switch::on_config_reload(void *argument)
     this->input_pin_behavior =   THEKERNEL->config->value(switch_checksum, this->name_checksum, input_pin_behavior_checksum )->by_default(momentary_checksum)->as_number();
     std::string input_on_command =    THEKERNEL->config->value(switch_checksum, this->name_checksum, input_on_command_checksum )->by_default("")->as_string();
     std::string input_off_command =   THEKERNEL->config->value(switch_checksum, this->name_checksum, input_off_command_checksum )->by_default("")->as_string();
-    this->output_pin.from_string(THEKERNEL->config->value(switch_checksum, this->name_checksum, output_pin_checksum )->by_default("nc")->as_string())->as_output();
+    std::string output =         THEKERNEL->config->value(switch_checksum, this->name_checksum, output_pin_checksum )->by_default("nc")->as_string();
+    if(ExpanderPin::is_expander(output)) {
+        if(!this->expander_pin.from_string(output)->connected())
+            THEKERNEL->streams->printf("switch output_pin %s is not on the output expander\r\n", output.c_str());
+        output = "nc";
+    }
+    this->output_pin.from_string(output)->as_output();
     this->output_on_command =    THEKERNEL->config->value(switch_checksum, this->name_checksum, output_on_command_checksum )->by_default("")->as_string();
     this->output_off_command =   THEKERNEL->config->value(switch_checksum, this->name_checksum, output_off_command_checksum )->by_default("")->as_string();
     this->switch_state =         THEKERNEL->config->value(switch_checksum, this->name_checksum, startup_state_checksum )->by_default(false)->as_bool();
@@ -76,6 +85,7 @@ void Switch::on_config_reload(void *argument)
     if(type == "pwm") this->output_type= PWM;
     else if(type == "digital") this->output_type= DIGITAL;
     else this->output_type= PWM; // unkown type default to pwm
+    if(this->expander_pin.connected()) this->output_type= DIGITAL; // the expander outputs are only on or off
 
     if(this->output_pin.connected()) {
         if(this->output_type == PWM) {
@@ -87,8 +97,12 @@ void Switch::on_config_reload(void *argument)
                 this->output_pin.set(false);
             }
         } else {
+            this->switch_value = 255; // so public data shows a digital output as full on when it is on
             this->output_pin.set(this->switch_state);
         }
+    } else if(this->expander_pin.connected()) {
+        this->switch_value = 255;
+        this->expander_pin.set(this->switch_state);
     }
 
     set_low_on_debug(output_pin.port_number, output_pin.pin);
@@ -121,68 +135,51 @@ void Switch::on_config_reload(void *argument)
     if(input_pin.connected()) {
         // set to initial state
         this->input_pin_state = this->input_pin.get();
-        // input pin polling
-        THEKERNEL->slow_ticker->attach( 100, this, &Switch::pinpoll_tick);
+        PinEvents::instance()->attach(&this->input_pin, PinEvents::default_debounce_ms, this, &Switch::on_input_change);
     }
 
     if(this->output_type == PWM && this->output_pin.connected()) {
-        // PWM
-        THEKERNEL->slow_ticker->attach(1000, &this->output_pin, &Pwm::on_tick);
+        // PWM, from the PWM1 peripheral if the pin has it
+        bool hardware = THEKERNEL->config->value(switch_checksum, this->name_checksum, hardware_pwm_checksum )->by_default(true)->as_bool() &&
+                        this->output_pin.hardware(1000);
+        if(!hardware)
+            THEKERNEL->slow_ticker->attach<Pwm, &Pwm::on_tick>(1000, &this->output_pin);
     }
 }
 
-bool Switch::match_input_on_gcode(const Gcode *gcode) const
+// Turn pin on
+void Switch::switch_on(const Gcode *gcode, PinBatch& batch)
 {
-    return ((input_on_command_letter == 'M' && gcode->has_m && gcode->m == input_on_command_code) ||
-            (input_on_command_letter == 'G' && gcode->has_g && gcode->g == input_on_command_code));
-}
-
-bool Switch::match_input_off_gcode(const Gcode *gcode) const
-{
-    return ((input_off_command_letter == 'M' && gcode->has_m && gcode->m == input_off_command_code) ||
-            (input_off_command_letter == 'G' && gcode->has_g && gcode->g == input_off_command_code));
-}
-
-void Switch::on_gcode_received(void *argument)
-{
-    Gcode *gcode = static_cast<Gcode *>(argument);
-    // Add the gcode to the queue ourselves if we need it
-    if (match_input_on_gcode(gcode) || match_input_off_gcode(gcode)) {
-        THEKERNEL->conveyor->append_gcode(gcode);
+    int v;
+    if (this->output_type == PWM) {
+        // PWM output pin turn on (or off if S0)
+        if(gcode->has_letter('S')) {
+            v = round(gcode->get_value('S') * output_pin.max_pwm() / 255.0); // scale by max_pwm so input of 255 and max_pwm of 128 would set value to 128
+            this->output_pin.pwm(v);
+            this->switch_state= (v > 0);
+        } else {
+            this->output_pin.pwm(this->switch_value);
+            this->switch_state= (this->switch_value > 0);
+        }
+    } else {
+        // logic pin turn on
+        batch.set(this->output_pin, true);
+        batch.set(this->expander_pin, true);
+        this->switch_state = true;
     }
 }
 
-// Turn pin on and off
-void Switch::on_gcode_execute(void *argument)
+// Turn pin off
+void Switch::switch_off(PinBatch& batch)
 {
-    Gcode *gcode = static_cast<Gcode *>(argument);
-
-    if(match_input_on_gcode(gcode)) {
-        int v;
-        if (this->output_type == PWM) {
-            // PWM output pin turn on (or off if S0)
-            if(gcode->has_letter('S')) {
-                v = round(gcode->get_value('S') * output_pin.max_pwm() / 255.0); // scale by max_pwm so input of 255 and max_pwm of 128 would set value to 128
-                this->output_pin.pwm(v);
-                this->switch_state= (v > 0);
-            } else {
-                this->output_pin.pwm(this->switch_value);
-                this->switch_state= (this->switch_value > 0);
-            }
-        } else {
-            // logic pin turn on
-            this->output_pin.set(true);
-            this->switch_state = true;
-        }
-    } else if(match_input_off_gcode(gcode)) {
-        this->switch_state = false;
-        if (this->output_type == PWM) {
-            // PWM output pin
-            this->output_pin.set(false);
-        } else {
-            // logic pin turn off
-            this->output_pin.set(false);
-        }
+    this->switch_state = false;
+    if (this->output_type == PWM) {
+        // PWM output pin
+        this->output_pin.set(false);
+    } else {
+        // logic pin turn off
+        batch.set(this->output_pin, false);
+        batch.set(this->expander_pin, false);
     }
 }
 
@@ -230,6 +227,8 @@ void Switch::on_set_public_data(void *argument)
 
 void Switch::on_main_loop(void *argument)
 {
+    if(this->name_checksum == fan_checksum) THEKERNEL->status->fan_on = this->switch_state;
+
     if(this->switch_changed) {
         if(this->switch_state) {
             if(!this->output_on_command.empty()) this->send_gcode( this->output_on_command, &(StreamOutput::NullStream) );
@@ -249,18 +248,15 @@ void Switch::on_main_loop(void *argument)
                     this->output_pin.set(false);
             }
         }
+        if(this->expander_pin.connected()) this->expander_pin.set(this->switch_state);
         this->switch_changed = false;
     }
 }
 
-// TODO Make this use InterruptIn
-// Check the state of the button and act accordingly
-uint32_t Switch::pinpoll_tick(uint32_t dummy)
+// Called by PinEvents once the input pin has settled in a new state
+uint32_t Switch::on_input_change(uint32_t state)
 {
-    if(!input_pin.connected()) return 0;
-
-    // If pin changed
-    bool current_state = this->input_pin.get();
+    bool current_state = state != 0;
     if(this->input_pin_state != current_state) {
         this->input_pin_state = current_state;
         // If pin high
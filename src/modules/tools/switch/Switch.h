@@ -10,6 +10,7 @@
 
 #include "Pin.h"
 #include "Pwm.h"
+#include "OutputExpander.h"
 #include <math.h>
 
 #include <string>
@@ -17,6 +18,7 @@ using std::string;
 
 class Gcode;
 class StreamOutput;
+class PinBatch;
 
 class Switch : public Module {
     public:
@@ -25,18 +27,18 @@ class Switch : public Module {
 
         void on_module_loaded();
         void on_config_reload(void* argument);
-        void on_gcode_received(void* argument);
-        void on_gcode_execute(void* argument);
         void on_main_loop(void* argument);
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
-        uint32_t pinpoll_tick(uint32_t dummy);
+        uint32_t on_input_change(uint32_t state);
         enum OUTPUT_TYPE {PWM, DIGITAL};
     private:
+        friend class SwitchPool;
+        // called by SwitchPool when the block with our command starts, digital outputs are written by it with the others
+        void switch_on(const Gcode* gcode, PinBatch& batch);
+        void switch_off(PinBatch& batch);
         void flip();
         void send_gcode(string msg, StreamOutput* stream);
-        bool match_input_on_gcode(const Gcode* gcode) const;
-        bool match_input_off_gcode(const Gcode* gcode) const;
 
         uint16_t  name_checksum;
         Pin       input_pin;
@@ -51,6 +53,7 @@ class Switch : public Module {
         bool      switch_changed;
         OUTPUT_TYPE output_type;
         Pwm       output_pin;
+        ExpanderPin expander_pin; // instead of output_pin for an output_pin of x and a number
         string    output_on_command;
         string    output_off_command;
 };
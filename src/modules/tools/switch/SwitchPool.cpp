@@ -10,31 +10,132 @@
 #include <math.h>
 using namespace std;
 #include <vector>
+#include <algorithm>
+#include <string.h>
 #include "SwitchPool.h"
 #include "Switch.h"
 #include "Config.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
+#include "Gcode.h"
+#include "modules/robot/Conveyor.h"
 
 #define switch_checksum CHECKSUM("switch")
-#define enable_checksum CHECKSUM("enable")
 
-void SwitchPool::load_tools()
+void PinBatch::set(Pin& pin, bool value)
+{
+    if(!pin.connected()) return;
+    int n = pin.port_number;
+    if((used & (1 << n)) == 0) {
+        used |= (1 << n);
+        ports[n] = pin.port;
+        set_bits[n] = 0;
+        clr_bits[n] = 0;
+    }
+    if(pin.inverting ^ value) set_bits[n] |= (1 << pin.pin);
+    else clr_bits[n] |= (1 << pin.pin);
+}
+
+void PinBatch::set(const ExpanderPin& pin, bool value)
+{
+    if(!pin.connected()) return;
+    if(!expander_used) {
+        expander_used = true;
+        memset(expander_set, 0, sizeof(expander_set));
+        memset(expander_clr, 0, sizeof(expander_clr));
+    }
+    uint8_t bit = 1 << (pin.output & 7);
+    int n = pin.output >> 3;
+    if(pin.inverting ^ value) {
+        expander_set[n] |= bit;
+        expander_clr[n] &= ~bit;
+    } else {
+        expander_clr[n] |= bit;
+        expander_set[n] &= ~bit;
+    }
+}
+
+void PinBatch::apply()
+{
+    for (int n = 0; n < 5; ++n) {
+        if((used & (1 << n)) == 0) continue;
+        if(set_bits[n] != 0) ports[n]->FIOSET = set_bits[n];
+        if(clr_bits[n] != 0) ports[n]->FIOCLR = clr_bits[n];
+    }
+    used = 0;
+    if(expander_used) {
+        OutputExpander::instance()->apply(expander_set, expander_clr);
+        expander_used = false;
+    }
+}
+
+bool SwitchPool::load_tools()
 {
     vector<uint16_t> modules;
-    THEKERNEL->config->get_module_list( &modules, switch_checksum );
+    // only the enabled ones
+    THEKERNEL->config->get_module_list( &modules, switch_checksum, true );
 
     for( unsigned int i = 0; i < modules.size(); i++ ) {
-        // If module is enabled
-        if( THEKERNEL->config->value(switch_checksum, modules[i], enable_checksum )->as_bool() == true ) {
-            Switch *controller = new Switch(modules[i]);
-            THEKERNEL->add_module(controller);
-        }
+        Switch *controller = new Switch(modules[i]);
+        THEKERNEL->add_module(controller, "switch");
+
+        // its config is read now, so its commands are known
+        if(controller->input_on_command_letter != 0)
+            routes.push_back({key_of(controller->input_on_command_letter, controller->input_on_command_code), true, controller});
+        if(controller->input_off_command_letter != 0)
+            routes.push_back({key_of(controller->input_off_command_letter, controller->input_off_command_code), false, controller});
     }
 
+    if(routes.empty()) return false;
+
+    // stable so switches sharing a command are switched in the order they were defined
+    stable_sort(routes.begin(), routes.end(), [](const Route& a, const Route& b) { return a.key < b.key; });
+    THEKERNEL->add_module(this, "switch pool");
+    return true;
 }
 
+void SwitchPool::on_module_loaded()
+{
+    for (size_t i = 0; i < routes.size(); ++i) {
+        if(i > 0 && routes[i].key == routes[i - 1].key) continue;
+        char letter = (routes[i].key & 0x8000) ? 'M' : 'G';
+        THEKERNEL->register_for_gcode(this, letter, routes[i].key & 0x7FFF);
+    }
+    // switching outputs doesn't change the moves, so it is done from the main loop rather than holding up the next block
+    register_for_deferred_execute();
+}
 
+uint16_t SwitchPool::key_of(const Gcode *gcode)
+{
+    if(gcode->has_m) return key_of('M', gcode->m);
+    if(gcode->has_g) return key_of('G', gcode->g);
+    return 0xFFFF; // matches nothing
+}
 
+size_t SwitchPool::find(uint16_t key) const
+{
+    auto it = lower_bound(routes.begin(), routes.end(), key, [](const Route& r, uint16_t k) { return r.key < k; });
+    return (it != routes.end() && it->key == key) ? it - routes.begin() : routes.size();
+}
 
+// only the codes we registered get here, queue them once for all the switches they are for
+void SwitchPool::on_gcode_received(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    if(find(key_of(gcode)) < routes.size()) {
+        THEKERNEL->conveyor->append_gcode(gcode);
+    }
+}
 
+// every gcode that was queued comes through here, but it is only a lookup for those that are not ours
+void SwitchPool::on_gcode_execute(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    uint16_t key = key_of(gcode);
+    PinBatch batch;
+    for (size_t i = find(key); i < routes.size() && routes[i].key == key; ++i) {
+        if(routes[i].on) routes[i].sw->switch_on(gcode, batch);
+        else if(i == 0 || routes[i - 1].key != key || routes[i - 1].sw != routes[i].sw) routes[i].sw->switch_off(batch); // on wins if a switch uses one code for both
+    }
+    batch.apply();
+}
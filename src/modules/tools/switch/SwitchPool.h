@@ -8,9 +8,58 @@
 #ifndef SWITCHPOOL_H
 #define SWITCHPOOL_H
 
-class SwitchPool{
+#include "libs/Module.h"
+#include "Pin.h"
+#include "OutputExpander.h"
+
+#include <vector>
+#include <stdint.h>
+
+class Switch;
+class Gcode;
+
+// digital output changes collected while a gcode is handled, then written with one FIOSET and one FIOCLR per port,
+// and those on the output expander in one go so they are all in the same transfer
+class PinBatch {
+    public:
+        PinBatch() : used(0), expander_used(false) {}
+        void set(Pin& pin, bool value);
+        void set(const ExpanderPin& pin, bool value);
+        void apply();
+
+    private:
+        LPC_GPIO_TypeDef *ports[5];
+        uint32_t set_bits[5];
+        uint32_t clr_bits[5];
+        uint8_t used; // a bit for each port with changes
+        uint8_t expander_set[OutputExpander::max_bytes];
+        uint8_t expander_clr[OutputExpander::max_bytes];
+        bool expander_used;
+};
+
+// Creates the switches and handles their gcodes for them, so a gcode only reaches the switches it is for
+class SwitchPool : public Module {
     public:
-        void load_tools();
+        // false if there were no switches, then the pool is not needed
+        bool load_tools();
+
+        void on_module_loaded();
+        void on_gcode_received(void *argument);
+        void on_gcode_execute(void *argument);
+
+    private:
+        struct Route {
+            uint16_t key;
+            bool on;
+            Switch *sw;
+        };
+        static uint16_t key_of(char letter, uint16_t code) { return (letter == 'M' ? 0x8000 : 0) | code; }
+        static uint16_t key_of(const Gcode *gcode);
+        // the first route for the key, or routes.size()
+        size_t find(uint16_t key) const;
+
+        // sorted by key, a gcode can switch several switches
+        std::vector<Route> routes;
 };
 
 #endif // SWITCHPOOL_H
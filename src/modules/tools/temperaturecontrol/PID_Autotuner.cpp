@@ -15,10 +15,6 @@
 
 PID_Autotuner::PID_Autotuner()
 {
-    temp_control = NULL;
-    s = NULL;
-    lastInputs = NULL;
-    peaks = NULL;
     tick = false;
     tickCnt = 0;
 }
@@ -26,31 +22,38 @@ PID_Autotuner::PID_Autotuner()
 void PID_Autotuner::on_module_loaded()
 {
     tick = false;
-    THEKERNEL->slow_ticker->attach(20, this, &PID_Autotuner::on_tick );
+    THEKERNEL->slow_ticker->attach<PID_Autotuner, &PID_Autotuner::on_tick>(20, this);
     register_for_event(ON_IDLE);
-    register_for_event(ON_GCODE_RECEIVED);
+    register_for_event(ON_HALT);
+    register_for_gcodes('M', {303, 304});
 }
 
-void PID_Autotuner::begin(float target, StreamOutput *stream, int ncycles)
+void PID_Autotuner::on_halt(void *arg)
 {
+    if(arg == nullptr) abort(-1);
+}
+
+PID_Autotuner::Session::Session(TemperatureControl *tc, float target, StreamOutput *stream, int ncycles)
+{
+    temp_control = tc;
     noiseBand = 0.5;
     oStep = temp_control->heater_pin.max_pwm(); // use max pwm to cycle temp
     nLookBack = 5 * 20; // 5 seconds of lookback
     lookBackCnt = 0;
     tickCnt = 0;
+    peak1 = peak2 = 0;
 
-    if (lastInputs != NULL) delete[] lastInputs;
     lastInputs = new float[nLookBack + 1];
 
     s = stream;
 
     temp_control->heater_pin.set(0);
     temp_control->target_temperature = 0.0;
+    temp_control->tuning = true;
 
     target_temperature = target;
     requested_cycles = ncycles;
 
-    if (peaks != NULL) delete[] peaks;
     peaks = new float[ncycles];
 
     for (int i = 0; i < ncycles; i++) {
@@ -60,6 +63,8 @@ void PID_Autotuner::begin(float target, StreamOutput *stream, int ncycles)
     peakType = 0;
     peakCount = 0;
     justchanged = false;
+    sum_ticks = on_ticks = 0;
+    temp_sum = 0;
 
     float refVal = temp_control->get_temperature();
     absMax = refVal;
@@ -70,25 +75,33 @@ void PID_Autotuner::begin(float target, StreamOutput *stream, int ncycles)
     s->printf("%s: Starting PID Autotune, %d max cycles, M304 aborts\n", temp_control->designator.c_str(), ncycles);
 }
 
-void PID_Autotuner::abort()
+PID_Autotuner::Session::~Session()
 {
-    if (temp_control == NULL)
-        return;
-
     temp_control->target_temperature = 0;
     temp_control->heater_pin.set(0);
-    temp_control = NULL;
-
-    if (s)
-        s->printf("PID Autotune Aborted\n");
-    s = NULL;
-
-    if (peaks != NULL)
-        delete[] peaks;
-    peaks = NULL;
-    if (lastInputs != NULL)
-        delete[] lastInputs;
-    lastInputs = NULL;
+    temp_control->tuning = false;
+
+    delete[] peaks;
+    delete[] lastInputs;
+}
+
+void PID_Autotuner::Session::abort()
+{
+    s->printf("%s: PID Autotune Aborted\n", temp_control->designator.c_str());
+}
+
+// abort the tune of the heater with this pool index, or all of them if it is -1
+void PID_Autotuner::abort(int pool_index)
+{
+    for (auto i = sessions.begin(); i != sessions.end(); ) {
+        if (pool_index < 0 || (*i)->temp_control->pool_index == pool_index) {
+            (*i)->abort();
+            delete *i;
+            i = sessions.erase(i);
+        } else {
+            ++i;
+        }
+    }
 }
 
 void PID_Autotuner::on_gcode_received(void *argument)
@@ -98,7 +111,7 @@ void PID_Autotuner::on_gcode_received(void *argument)
     if(gcode->has_m) {
         if(gcode->m == 304) {
             gcode->mark_as_taken();
-            abort();
+            abort(gcode->has_letter('E') ? gcode->get_value('E') : -1);
 
         } else if (gcode->m == 303 && gcode->has_letter('E')) {
             gcode->mark_as_taken();
@@ -108,8 +121,9 @@ void PID_Autotuner::on_gcode_received(void *argument)
             void *returned_data;
             bool ok = PublicData::get_value( temperature_control_checksum, pool_index_checksum, pool_index, &returned_data );
 
+            TemperatureControl *temp_control;
             if (ok) {
-                this->temp_control =  *static_cast<TemperatureControl **>(returned_data);
+                temp_control =  *static_cast<TemperatureControl **>(returned_data);
 
             } else {
                 gcode->stream->printf("No temperature control with index %d found\r\n", pool_index);
@@ -125,24 +139,23 @@ void PID_Autotuner::on_gcode_received(void *argument)
             if (gcode->has_letter('C')) {
                 ncycles = gcode->get_value('C');
             }
-            gcode->stream->printf("Start PID tune for index E%d, designator: %s\n", pool_index, this->temp_control->designator.c_str());
-            this->begin(target, gcode->stream, ncycles);
+            // any other heaters being tuned carry on, so a bed and hotends can be tuned together
+            abort(pool_index);
+            gcode->stream->printf("Start PID tune for index E%d, designator: %s\n", pool_index, temp_control->designator.c_str());
+            sessions.push_back(new Session(temp_control, target, gcode->stream, ncycles));
         }
     }
 }
 
 uint32_t PID_Autotuner::on_tick(uint32_t dummy)
 {
-    if (temp_control != NULL)
+    if (!sessions.empty())
         tick = true;
 
     tickCnt += 1000 / 20; // millisecond tick count
     return 0;
 }
 
-/**
- * this autopid is based on https://github.com/br3ttb/Arduino-PID-AutoTune-Library/blob/master/PID_AutoTune_v0/PID_AutoTune_v0.cpp
- */
 void PID_Autotuner::on_idle(void *)
 {
     if (!tick)
@@ -150,12 +163,26 @@ void PID_Autotuner::on_idle(void *)
 
     tick = false;
 
-    if (temp_control == NULL)
-        return;
+    for (auto i = sessions.begin(); i != sessions.end(); ) {
+        if ((*i)->step(tickCnt)) {
+            ++i;
+        } else {
+            delete *i;
+            i = sessions.erase(i);
+        }
+    }
+}
+
+/**
+ * this autopid is based on https://github.com/br3ttb/Arduino-PID-AutoTune-Library/blob/master/PID_AutoTune_v0/PID_AutoTune_v0.cpp
+ */
+bool PID_Autotuner::Session::step(unsigned long tickCnt)
+{
+    this->tickCnt = tickCnt;
 
     if(peakCount >= requested_cycles) {
         finishUp();
-        return;
+        return false;
     }
 
     float refVal = temp_control->get_temperature();
@@ -173,6 +200,13 @@ void PID_Autotuner::on_idle(void *)
         temp_control->heater_pin.pwm(output);
     }
 
+    // once the warm up is over, the mean output and temperature give the steady state gain
+    if (peakCount >= 3) {
+        sum_ticks++;
+        if (output > 0) on_ticks++;
+        temp_sum += refVal;
+    }
+
     bool isMax = true, isMin = true;
 
     // id peaks
@@ -188,7 +222,7 @@ void PID_Autotuner::on_idle(void *)
     if (lookBackCnt < nLookBack) {
         lookBackCnt++; // count number of times we have filled lastInputs
         //we don't want to trust the maxes or mins until the inputs array has been filled
-        return;
+        return true;
     }
 
     if (isMax) {
@@ -220,11 +254,11 @@ void PID_Autotuner::on_idle(void *)
         }
         //we've transitioned. check if we can autotune based on the last peaks
         float avgSeparation = (std::abs(peaks[peakCount - 1] - peaks[peakCount - 2]) + std::abs(peaks[peakCount - 2] - peaks[peakCount - 3])) / 2;
-        s->printf("Cycle %d: max: %g, min: %g, avg separation: %g\n", peakCount, absMax, absMin, avgSeparation);
+        s->printf("%s: Cycle %d: max: %g, min: %g, avg separation: %g\n", temp_control->designator.c_str(), peakCount, absMax, absMin, avgSeparation);
         if (peakCount > 3 && avgSeparation < 0.05 * (absMax - absMin)) {
             DEBUG_PRINTF("Stabilized\n");
             finishUp();
-            return;
+            return false;
         }
     }
 
@@ -234,15 +268,41 @@ void PID_Autotuner::on_idle(void *)
         s->printf("%s: %5.1f/%5.1f @%d %d/%d\n", temp_control->designator.c_str(), temp_control->get_temperature(), target_temperature, output, peakCount, requested_cycles);
         DEBUG_PRINTF("lookBackCnt= %d, peakCount= %d, absmax= %g, absmin= %g, peak1= %lu, peak2= %lu\n", lookBackCnt, peakCount, absMax, absMin, peak1, peak2);
     }
+    return true;
 }
 
+/*
+ * Fit a first order plus dead time model, K e^(-Ls) / (Ts + 1), to the relay cycles.
+ * K comes from the mean temperature above ambient over the mean output, then the relay's describing function
+ * gives the process gain at the oscillation frequency w: K / sqrt(1 + (wT)^2) = pi a / 4d, and the phase there
+ * is -pi = -wL - atan(wT).
+ */
+void PID_Autotuner::Session::fit_model(float Pu)
+{
+    if (sum_ticks == 0 || on_ticks == 0 || Pu <= 0 || absMax <= absMin) return;
+
+    float mean_output = oStep * on_ticks / sum_ticks;
+    float mean_temp = temp_sum / sum_ticks;
+    float K = (mean_temp - temp_control->ff_ambient) / mean_output;    // degrees per pwm
+    float Ku = (4 * (oStep / 2)) / (3.14159F * ((absMax - absMin) / 2));  // pwm per degree at w
+    float w = 2 * 3.14159F / Pu;
+    if (K <= 0 || K * Ku <= 1) {
+        s->printf("%s: no thermal model, the cycles don't fit one\n", temp_control->designator.c_str());
+        return;
+    }
+    float T = sqrtf((K * Ku) * (K * Ku) - 1) / w;
+    float L = (3.14159F - atanf(w * T)) / w;
+
+    temp_control->set_model(K * 255, T, L);
+    s->printf("\tModel: gain %1.1fC at full power, time constant %1.1fs, dead time %1.1fs\n", K * 255, T, L);
+}
 
-void PID_Autotuner::finishUp()
+void PID_Autotuner::Session::finishUp()
 {
     //we can generate tuning parameters!
     float Ku = 4 * (2 * oStep) / ((absMax - absMin) * 3.14159);
     float Pu = (float)(peak1 - peak2) / 1000;
-    s->printf("\tKu: %g, Pu: %g\n", Ku, Pu);
+    s->printf("%s:\tKu: %g, Pu: %g\n", temp_control->designator.c_str(), Ku, Pu);
 
     float kp = 0.6 * Ku;
     float ki = 1.2 * Ku / Pu;
@@ -254,20 +314,7 @@ void PID_Autotuner::finishUp()
     temp_control->setPIDi(ki);
     temp_control->setPIDd(kd);
 
-    s->printf("PID Autotune Complete! The settings above have been loaded into memory, but not written to your config file.\n");
-
-
-    // and clean up
-    temp_control->target_temperature = 0;
-    temp_control->heater_pin.set(0);
-    temp_control = NULL;
-    s = NULL;
-
-    if (peaks != NULL)
-        delete[] peaks;
-    peaks = NULL;
+    fit_model(Pu);
 
-    if (lastInputs != NULL)
-        delete[] lastInputs;
-    lastInputs = NULL;
+    s->printf("PID Autotune Complete! The settings above have been loaded into memory, use M500 to write them to your config override file.\n");
 }
@@ -6,6 +6,7 @@
 #define _PID_AUTOTUNE_H
 
 #include <stdint.h>
+#include <vector>
 
 #include "Module.h"
 
@@ -21,32 +22,54 @@ public:
     uint32_t on_tick(uint32_t);
     void on_idle(void *);
     void on_gcode_received(void *);
+    void on_halt(void *);
 
 private:
-    void begin(float, StreamOutput *, int );
-    void abort();
-    void finishUp();
+    // one relay tune, several can run at the same time on different heaters
+    class Session {
+    public:
+        Session(TemperatureControl *tc, float target, StreamOutput *stream, int ncycles);
+        ~Session();
 
-    TemperatureControl *temp_control;
-    float target_temperature;
-    StreamOutput *s;
+        // false once it is done
+        bool step(unsigned long tickCnt);
+        void abort();
 
-    volatile bool tick;
+        TemperatureControl *temp_control;
+
+    private:
+        void finishUp();
+        void fit_model(float Pu);
+
+        float target_temperature;
+        StreamOutput *s;
+
+        float *peaks;
+        int requested_cycles;
+        float noiseBand;
+        unsigned long peak1, peak2;
+        int nLookBack;
+        int lookBackCnt;
+        int peakType;
+        float *lastInputs;
+        int peakCount;
+        bool justchanged;
+        float absMax, absMin;
+        float oStep;
+        int output;
+        unsigned long tickCnt;
 
-    float *peaks;
-    int requested_cycles;
-    float noiseBand;
-    unsigned long peak1, peak2;
-    int sampleTime;
-    int nLookBack;
-    int lookBackCnt;
-    int peakType;
-    float *lastInputs;
-    int peakCount;
-    bool justchanged;
-    float absMax, absMin;
-    float oStep;
-    int output;
+        // the mean output and temperature over the settled cycles, for the model gain
+        unsigned long sum_ticks;
+        unsigned long on_ticks;
+        float temp_sum;
+    };
+
+    void abort(int pool_index);
+
+    std::vector<Session*> sessions;
+
+    volatile bool tick;
     unsigned long tickCnt;
 };
 
@@ -26,6 +26,9 @@
 #include "Pauser.h"
 #include "ConfigValue.h"
 #include "PID_Autotuner.h"
+#include "SwitchPublicAccess.h"
+#include "ExtruderPublicAccess.h"
+#include "utils.h"
 
 // Temp sensor implementations:
 #include "Thermistor.h"
@@ -40,6 +43,7 @@
 #define readings_per_second_checksum       CHECKSUM("readings_per_second")
 #define max_pwm_checksum                   CHECKSUM("max_pwm")
 #define pwm_frequency_checksum             CHECKSUM("pwm_frequency")
+#define hardware_pwm_checksum              CHECKSUM("hardware_pwm")
 #define bang_bang_checksum                 CHECKSUM("bang_bang")
 #define hysteresis_checksum                CHECKSUM("hysteresis")
 #define heater_pin_checksum                CHECKSUM("heater_pin")
@@ -60,6 +64,13 @@
 #define preset1_checksum                   CHECKSUM("preset1")
 #define preset2_checksum                   CHECKSUM("preset2")
 
+#define ff_hold_checksum                   CHECKSUM("ff_hold")
+#define ff_ambient_checksum                CHECKSUM("ff_ambient")
+#define ff_extrusion_checksum              CHECKSUM("ff_extrusion")
+#define ff_extruder_checksum               CHECKSUM("ff_extruder")
+#define ff_fan_checksum                    CHECKSUM("ff_fan")
+#define ff_fan_switch_checksum             CHECKSUM("ff_fan_switch")
+
 TemperatureControl::TemperatureControl(uint16_t name, int index)
 {
     name_checksum= name;
@@ -68,6 +79,11 @@ TemperatureControl::TemperatureControl(uint16_t name, int index)
     min_temp_violated= false;
     sensor= nullptr;
     readonly= false;
+    tuning= false;
+    model_gain= model_tau= model_dead_time= 0;
+    ff_update= false;
+    ff_extrusion_rate= 0;
+    ff_fan_fraction= 0;
 }
 
 TemperatureControl::~TemperatureControl()
@@ -85,14 +101,14 @@ void TemperatureControl::on_module_loaded()
     this->load_config();
 
     // Register for events
-    this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    // get_m_code is answered for all the controls at once by TemperatureControlPool
+    this->register_for_gcodes('M', {this->set_m_code, this->set_and_wait_m_code, 301, 307, 500, 503});
+    PublicData::register_owner(temperature_control_checksum, this);
 
     if(!this->readonly) {
         this->register_for_event(ON_GCODE_EXECUTE);
         this->register_for_event(ON_SECOND_TICK);
-        this->register_for_event(ON_MAIN_LOOP);
-        this->register_for_event(ON_SET_PUBLIC_DATA);
+        this->register_for_main_loop(MAIN_LOOP_NORMAL, "temperature");
         this->register_for_event(ON_HALT);
     }
 }
@@ -113,6 +129,33 @@ void TemperatureControl::on_main_loop(void *argument)
         THEKERNEL->streams->printf("Error: MINTEMP triggered. Check your temperature sensors!\n");
         this->min_temp_violated = false;
     }
+
+    // public data can't be asked for from the reading tick, so the disturbances are fetched here once for every reading
+    if (this->ff_update) {
+        this->ff_update = false;
+        update_disturbances();
+    }
+}
+
+// the extrusion rate and fan speed the feed forward compensates for
+void TemperatureControl::update_disturbances()
+{
+    void *returned_data;
+
+    if (this->ff_extrusion != 0) {
+        bool ok = PublicData::get_value( extruder_checksum, extrusion_rate_checksum, this->ff_extruder, &returned_data );
+        this->ff_extrusion_rate = ok ? *static_cast<float *>(returned_data) : 0;
+    }
+
+    if (this->ff_fan != 0) {
+        bool ok = PublicData::get_value( switch_checksum, this->ff_fan_switch, 0, &returned_data );
+        if (ok) {
+            struct pad_switch s = *static_cast<struct pad_switch *>(returned_data);
+            this->ff_fan_fraction = s.state ? s.value / 255.0F : 0;
+        } else {
+            this->ff_fan_fraction = 0;
+        }
+    }
 }
 
 // Get configuration from the config file
@@ -169,13 +212,18 @@ void TemperatureControl::load_config()
         this->heater_pin.max_pwm( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, max_pwm_checksum)->by_default(255)->as_number() );
         this->heater_pin.set(0);
         set_low_on_debug(heater_pin.port_number, heater_pin.pin);
-        // activate SD-DAC timer
-        THEKERNEL->slow_ticker->attach( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, pwm_frequency_checksum)->by_default(2000)->as_number(), &heater_pin, &Pwm::on_tick);
+        int pwm_frequency = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, pwm_frequency_checksum)->by_default(2000)->as_number();
+        if(pwm_frequency < 1) pwm_frequency = 1;
+        // use the PWM1 peripheral if the pin has it, otherwise activate SD-DAC timer
+        bool hardware = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, hardware_pwm_checksum)->by_default(true)->as_bool() &&
+                        this->heater_pin.hardware(1000000 / pwm_frequency);
+        if(!hardware)
+            THEKERNEL->slow_ticker->attach<Pwm, &Pwm::on_tick>(pwm_frequency, &heater_pin);
     }
 
 
     // reading tick
-    THEKERNEL->slow_ticker->attach( this->readings_per_second, this, &TemperatureControl::thermistor_read_tick );
+    THEKERNEL->slow_ticker->attach<TemperatureControl, &TemperatureControl::thermistor_read_tick>(this->readings_per_second, this);
     this->PIDdt = 1.0 / this->readings_per_second;
 
     // PID
@@ -186,6 +234,15 @@ void TemperatureControl::load_config()
     if(!this->readonly) {
         // set to the same as max_pwm by default
         this->i_max = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, i_max_checksum   )->by_default(this->heater_pin.max_pwm())->as_number();
+
+        // Feed forward, pwm added to the PID output for what is known to take heat away, all off by default
+        this->ff_hold      = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, ff_hold_checksum     )->by_default(0)->as_number();  // per degree above ambient
+        this->ff_ambient   = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, ff_ambient_checksum  )->by_default(25)->as_number();
+        this->ff_extrusion = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, ff_extrusion_checksum)->by_default(0)->as_number();  // per mm/s of filament
+        this->ff_fan       = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, ff_fan_checksum      )->by_default(0)->as_number();  // with the fan at full
+        std::string s      = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, ff_extruder_checksum )->by_default("")->as_string();
+        this->ff_extruder  = s.empty() ? 0 : get_checksum(s); // 0 is whichever extruder is moving
+        this->ff_fan_switch= get_checksum(THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, ff_fan_switch_checksum)->by_default("fan")->as_string());
     }
 
     this->iTerm = 0.0;
@@ -198,14 +255,6 @@ void TemperatureControl::on_gcode_received(void *argument)
     Gcode *gcode = static_cast<Gcode *>(argument);
     if (gcode->has_m) {
 
-        if( gcode->m == this->get_m_code ) {
-            char buf[32]; // should be big enough for any status
-            int n = snprintf(buf, sizeof(buf), "%s:%3.1f /%3.1f @%d ", this->designator.c_str(), this->get_temperature(), ((target_temperature == UNDEFINED) ? 0.0 : target_temperature), this->o);
-            gcode->txt_after_ok.append(buf, n);
-            gcode->mark_as_taken();
-            return;
-        }
-
         // readonly sensors don't handle the rest
         if(this->readonly) return;
 
@@ -224,8 +273,21 @@ void TemperatureControl::on_gcode_received(void *argument)
             //gcode->stream->printf("%s(S%d): Pf:%g If:%g Df:%g X(I_max):%g Pv:%g Iv:%g Dv:%g O:%d\n", this->designator.c_str(), this->pool_index, this->p_factor, this->i_factor/this->PIDdt, this->d_factor*this->PIDdt, this->i_max, this->p, this->i, this->d, o);
             gcode->stream->printf("%s(S%d): Pf:%g If:%g Df:%g X(I_max):%g O:%d\n", this->designator.c_str(), this->pool_index, this->p_factor, this->i_factor / this->PIDdt, this->d_factor * this->PIDdt, this->i_max, o);
 
+        } else if (gcode->m == 307) {
+            // thermal model, A is the rise above ambient at full power, C the time constant and D the dead time in seconds
+            gcode->mark_as_taken();
+            if (gcode->has_letter('S') && (gcode->get_value('S') == this->pool_index)) {
+                if (gcode->has_letter('A') || gcode->has_letter('C') || gcode->has_letter('D'))
+                    set_model(gcode->has_letter('A') ? gcode->get_value('A') : this->model_gain,
+                              gcode->has_letter('C') ? gcode->get_value('C') : this->model_tau,
+                              gcode->has_letter('D') ? gcode->get_value('D') : this->model_dead_time);
+                gcode->stream->printf("%s(S%d): A:%g C:%g D:%g ff_hold:%g\n", this->designator.c_str(), this->pool_index, this->model_gain, this->model_tau, this->model_dead_time, this->ff_hold);
+            }
+
         } else if (gcode->m == 500 || gcode->m == 503) { // M500 saves some volatile settings to config override file, M503 just prints the settings
             gcode->stream->printf(";PID settings:\nM301 S%d P%1.4f I%1.4f D%1.4f\n", this->pool_index, this->p_factor, this->i_factor / this->PIDdt, this->d_factor * this->PIDdt);
+            if (this->model_gain > 0)
+                gcode->stream->printf(";Thermal model:\nM307 S%d A%1.2f C%1.2f D%1.2f\n", this->pool_index, this->model_gain, this->model_tau, this->model_dead_time);
             gcode->mark_as_taken();
 
         } else if( ( gcode->m == this->set_m_code || gcode->m == this->set_and_wait_m_code ) && gcode->has_letter('S')) {
@@ -314,7 +376,8 @@ void TemperatureControl::on_set_public_data(void *argument)
 
     if(!pdr->starts_with(temperature_control_checksum)) return;
 
-    if(!pdr->second_element_is(this->name_checksum)) return;
+    // a readonly control only reports
+    if(this->readonly || !pdr->second_element_is(this->name_checksum)) return;
 
     // ok this is targeted at us, so set the temp
     float t = *static_cast<float *>(pdr->get_data_ptr());
@@ -335,6 +398,7 @@ void TemperatureControl::set_desired_temperature(float desired_temperature)
         desired_temperature = preset2;
 
     target_temperature = desired_temperature;
+    THEKERNEL->temperature_control_pool->invalidate_status();
     if (desired_temperature == 0.0)
         heater_pin.set((this->o = 0));
 }
@@ -344,9 +408,49 @@ float TemperatureControl::get_temperature()
     return last_reading;
 }
 
+// this control's part of the get_m_code status line
+int TemperatureControl::format_status(char *buf, size_t size)
+{
+    int n = snprintf(buf, size, "%s:%3.1f /%3.1f @%d ", this->designator.c_str(), this->get_temperature(), ((target_temperature == UNDEFINED) ? 0.0 : target_temperature), this->o);
+    return (n < (int)size) ? n : size - 1;
+}
+
+// a first order plus dead time model from PID_Autotuner or M307, its steady state gain becomes the holding feed forward
+void TemperatureControl::set_model(float gain, float tau, float dead_time)
+{
+    this->model_gain = gain;
+    this->model_tau = tau;
+    this->model_dead_time = dead_time;
+    if (gain > 0)
+        this->ff_hold = 255.0F / gain;
+}
+
+void TemperatureControl::add_watch(TemperatureWatch *w)
+{
+    // the reading tick goes through them
+    __disable_irq();
+    watches.push_back(w);
+    __enable_irq();
+}
+
+// a sensor that has failed reads as infinite, which counts as above
+void TemperatureControl::check_watches(float temperature)
+{
+    for(auto w : watches) {
+        if(!w->above && temperature >= w->on) {
+            w->above = true;
+            w->callback.call(1);
+        } else if(w->above && temperature < w->off) {
+            w->above = false;
+            w->callback.call(0);
+        }
+    }
+}
+
 uint32_t TemperatureControl::thermistor_read_tick(uint32_t dummy)
 {
     float temperature = sensor->get_temperature();
+    if(!watches.empty()) check_watches(temperature);
     if(this->readonly) {
         last_reading = temperature;
         return 0;
@@ -359,12 +463,13 @@ uint32_t TemperatureControl::thermistor_read_tick(uint32_t dummy)
             heater_pin.set((this->o = 0));
         } else {
             pid_process(temperature);
+            this->ff_update = true;
             if ( waiting && (temperature >= target_temperature) ) {
                 THEKERNEL->pauser->release();
                 waiting = false;
             }
         }
-    } else {
+    } else if (!this->tuning) {
         heater_pin.set((this->o = 0));
     }
     last_reading = temperature;
@@ -397,18 +502,22 @@ void TemperatureControl::pid_process(float temperature)
         return;
     }
 
+    // feed forward, what the heater should need for the target and the current extrusion and fan, so the PID only has to correct the model
+    float ff = (this->ff_hold * (target_temperature - this->ff_ambient)) + (this->ff_extrusion * this->ff_extrusion_rate) + (this->ff_fan * this->ff_fan_fraction);
+    if (ff < 0.0) ff = 0.0;
+
     // regular PID control
     float error = target_temperature - temperature;
     this->iTerm += (error * this->i_factor);
     if (this->iTerm > this->i_max) this->iTerm = this->i_max;
-    else if (this->iTerm < 0.0) this->iTerm = 0.0;
+    else if (this->iTerm < -ff) this->iTerm = -ff; // with feed forward the integral may need to take some of it back
 
     if(this->lastInput < 0.0) this->lastInput = temperature; // set first time
     float d = (temperature - this->lastInput);
 
     // calculate the PID output
     // TODO does this need to be scaled by max_pwm/256? I think not as p_factor already does that
-    this->o = (this->p_factor * error) + this->iTerm - (this->d_factor * d);
+    this->o = ff + (this->p_factor * error) + this->iTerm - (this->d_factor * d);
 
     if (this->o >= heater_pin.max_pwm())
         this->o = heater_pin.max_pwm();
@@ -12,6 +12,9 @@
 #include "Pwm.h"
 #include "TempSensor.h"
 #include "TemperatureControlPublicAccess.h"
+#include "libs/FPointer.h"
+
+#include <vector>
 
 class TemperatureControl : public Module {
 
@@ -29,15 +32,40 @@ class TemperatureControl : public Module {
         void on_halt(void* argument);
 
         void set_desired_temperature(float desired_temperature);
+        void set_model(float gain, float tau, float dead_time);
 
         float get_temperature();
 
+        // calls back from the reading tick with 1 when the temperature gets to threshold, and with 0 when it is back
+        // below threshold - hysteresis, so a module that only cares about the crossings doesn't have to keep asking
+        template<typename T> void watch_temperature(float threshold, float hysteresis, T *optr, uint32_t ( T::*fptr )( uint32_t ))
+        {
+            TemperatureWatch *w = new TemperatureWatch();
+            w->on = threshold;
+            w->off = threshold - hysteresis;
+            w->above = false;
+            w->callback.attach(optr, fptr);
+            add_watch(w);
+        }
+
         friend class PID_Autotuner;
+        friend class TemperatureControlPool;
 
     private:
         void load_config();
         uint32_t thermistor_read_tick(uint32_t dummy);
         void pid_process(float);
+        void update_disturbances();
+        int format_status(char *buf, size_t size);
+
+        struct TemperatureWatch {
+            float on, off;
+            bool above;
+            FPointer callback;
+        };
+        void add_watch(TemperatureWatch *w);
+        void check_watches(float temperature);
+        std::vector<TemperatureWatch*> watches;
 
         int pool_index;
 
@@ -90,6 +118,24 @@ class TemperatureControl : public Module {
         float i_factor;
         float d_factor;
         float PIDdt;
+
+        // feed forward settings
+        float ff_hold;
+        float ff_ambient;
+        float ff_extrusion;
+        float ff_fan;
+        uint16_t ff_extruder;
+        uint16_t ff_fan_switch;
+        // set in the main loop, used by the reading tick
+        volatile float ff_extrusion_rate;
+        volatile float ff_fan_fraction;
+        volatile bool ff_update;
+
+        // thermal model
+        float model_gain;       // degrees above ambient at full power
+        float model_tau;        // seconds
+        float model_dead_time;  // seconds
+        volatile bool tuning;   // the autotuner is driving the heater
 };
 
 #endif
@@ -10,6 +10,7 @@
 #include <math.h>
 using namespace std;
 #include <vector>
+#include <algorithm>
 #include "TemperatureControlPool.h"
 #include "TemperatureControl.h"
 #include "PID_Autotuner.h"
@@ -17,27 +18,134 @@ using namespace std;
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "TemperatureControlPublicAccess.h"
+#include "Gcode.h"
+#include "MachineStatus.h"
+
+#include "us_ticker_api.h"
 
-#define enable_checksum              CHECKSUM("enable")
 
 void TemperatureControlPool::load_tools()
 {
 
     vector<uint16_t> modules;
-    THEKERNEL->config->get_module_list( &modules, temperature_control_checksum );
+    // only the enabled ones
+    THEKERNEL->config->get_module_list( &modules, temperature_control_checksum, true );
     int cnt = 0;
     for( auto cs : modules ) {
-        // If module is enabled
-        if( THEKERNEL->config->value(temperature_control_checksum, cs, enable_checksum )->as_bool() ) {
-            TemperatureControl *controller = new TemperatureControl(cs, cnt++);
-            controllers.push_back( cs );
-            THEKERNEL->add_module(controller);
+        TemperatureControl *controller = new TemperatureControl(cs, cnt++);
+        controllers.push_back( cs );
+        THEKERNEL->add_module(controller, "temperature control");
+        THEKERNEL->status->add_heater(cs, controller->designator);
+
+        // group the controls by the code they report on, in the order they were defined
+        Report *report = nullptr;
+        for(auto& r : reports) {
+            if(r.m == controller->get_m_code) report = &r;
+        }
+        if(report == nullptr) {
+            reports.push_back({controller->get_m_code, {}, "", 0, false});
+            report = &reports.back();
         }
+        report->controls.push_back(controller);
     }
 
     // no need to create one of these if no heaters defined
     if(cnt > 0) {
         PID_Autotuner *pidtuner = new PID_Autotuner();
-        THEKERNEL->add_module( pidtuner );
+        THEKERNEL->add_module( pidtuner, "pid autotuner" );
+        THEKERNEL->add_module( this, "temperature control pool" );
+    }
+}
+
+TemperatureControl *TemperatureControlPool::get_control(uint16_t name_checksum) const
+{
+    for(auto& r : reports) {
+        for(auto c : r.controls) {
+            if(c->name_checksum == name_checksum) return c;
+        }
+    }
+    return nullptr;
+}
+
+void TemperatureControlPool::on_module_loaded()
+{
+    // a status line can't change faster than the fastest control reads its sensor
+    float rate = 0;
+    for(auto& r : reports) {
+        THEKERNEL->register_for_gcode(this, 'M', r.m);
+        for(auto c : r.controls) {
+            if(c->readings_per_second > rate) rate = c->readings_per_second;
+        }
+    }
+    this->sample_period_us = (rate > 0) ? 1000000 / rate : 0;
+
+    THEKERNEL->register_for_gcode(this, 'M', 155);
+    this->register_for_event(ON_SECOND_TICK);
+}
+
+void TemperatureControlPool::invalidate_status()
+{
+    for(auto& r : reports) r.valid = false;
+}
+
+// Hosts poll this every second or so, often from more than one stream, so the line is only formatted again once there can be a new reading
+void TemperatureControlPool::on_gcode_received(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    if(!gcode->has_m) return;
+
+    if(gcode->m == 155) {
+        // M155 S<seconds> pushes the temperatures to this stream every so often, S0 stops it
+        if(!this->temperature_report.set_interval(gcode->stream, gcode->has_letter('S') ? gcode->get_value('S') : 0))
+            gcode->stream->printf("Error: can't report to this stream\r\n");
+        gcode->mark_as_taken();
+        return;
+    }
+
+    for(auto& r : reports) {
+        if(gcode->m != r.m) continue;
+
+        refresh(r);
+        gcode->txt_after_ok.append(r.line);
+        gcode->mark_as_taken();
+        return;
+    }
+}
+
+void TemperatureControlPool::refresh(Report& r)
+{
+    uint32_t now = us_ticker_read();
+    if(r.valid && now - r.updated_us < this->sample_period_us) return;
+
+    r.line.clear();
+    for(auto c : r.controls) {
+        char buf[32]; // should be big enough for any status
+        int n = c->format_status(buf, sizeof(buf));
+        r.line.append(buf, n);
+    }
+    r.updated_us = now;
+    r.valid = true;
+}
+
+// the same line M105 would give, without the ok
+void TemperatureControlPool::on_second_tick(void *argument)
+{
+    for(auto& r : reports) {
+        for(auto c : r.controls) {
+            MachineStatus::Heater *h = THEKERNEL->status->find_heater(c->name_checksum);
+            if(h == nullptr) continue;
+            h->current_temperature = c->get_temperature();
+            h->target_temperature = std::max(c->target_temperature, 0.0F); // no target is held as a negative
+        }
+    }
+
+    if(!this->temperature_report.due()) return;
+
+    std::string line;
+    for(auto& r : reports) {
+        refresh(r);
+        line.append(r.line);
     }
+    line.append("\r\n");
+    this->temperature_report.send(line.c_str());
 }
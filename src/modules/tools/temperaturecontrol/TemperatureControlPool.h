@@ -8,15 +8,44 @@
 #ifndef TEMPERATURECONTROLPOOL_H
 #define TEMPERATURECONTROLPOOL_H
 
+#include "libs/Module.h"
+#include "libs/AutoReport.h"
+
 #include <vector>
+#include <string>
+
+class TemperatureControl;
 
-class TemperatureControlPool {
+class TemperatureControlPool : public Module {
     public:
         void load_tools();
         const std::vector<uint16_t>& get_controllers() const { return controllers; };
+        TemperatureControl *get_control(uint16_t name_checksum) const;
+
+        void on_module_loaded();
+        void on_gcode_received(void *argument);
+        void on_second_tick(void *argument);
+
+        // the temperatures are only read so often, but a target change should show up straight away
+        void invalidate_status();
 
     private:
+        // one status line for every get_m_code the controls answer, usually just M105
+        struct Report {
+            uint16_t m;
+            std::vector<TemperatureControl*> controls;
+            std::string line;
+            uint32_t updated_us;
+            bool valid;
+        };
+
+        void refresh(Report& r);
+
         std::vector<uint16_t> controllers;
+        std::vector<Report> reports;
+        // streams that asked with M155 for the temperatures every so often
+        AutoReport temperature_report;
+        uint32_t sample_period_us;
 };
 
 
@@ -12,7 +12,6 @@
 #include "checksumm.h"
 #include "Adc.h"
 #include "ConfigValue.h"
-#include "libs/Median.h"
 #include "Thermistor.h"
 
 // a const list of predefined thermistors
@@ -73,6 +72,7 @@ void Thermistor::UpdateConfig(uint16_t module_checksum, uint16_t name_checksum)
     // Thermistor math
     j = (1.0 / beta);
     k = (1.0 / (t0 + 273.15));
+    build_lut();
 
     // Thermistor pin for ADC readings
     this->thermistor_pin.from_string(THEKERNEL->config->value(module_checksum, name_checksum, thermistor_pin_checksum )->required()->as_string());
@@ -84,7 +84,23 @@ float Thermistor::get_temperature()
     return adc_value_to_temperature(new_thermistor_reading());
 }
 
+void Thermistor::build_lut()
+{
+    lut[0] = infinityf();
+    for (int i = 1; i < THERMISTOR_LUT_SIZE; i++)
+        lut[i] = calculate_temperature(i << THERMISTOR_LUT_SHIFT);
+}
+
 float Thermistor::adc_value_to_temperature(int adc_value)
+{
+    int i = adc_value >> THERMISTOR_LUT_SHIFT;
+    if (i == 0 || i >= THERMISTOR_LUT_SIZE - 1)
+        return calculate_temperature(adc_value);
+    float f = (adc_value & ((1 << THERMISTOR_LUT_SHIFT) - 1)) * (1.0F / (1 << THERMISTOR_LUT_SHIFT));
+    return lut[i] + (lut[i + 1] - lut[i]) * f;
+}
+
+float Thermistor::calculate_temperature(int adc_value)
 {
     if ((adc_value == 4095) || (adc_value == 0))
         return infinityf();
@@ -96,15 +112,5 @@ float Thermistor::adc_value_to_temperature(int adc_value)
 
 int Thermistor::new_thermistor_reading()
 {
-    int last_raw = THEKERNEL->adc->read(&thermistor_pin);
-    if (queue.size() >= queue.capacity()) {
-        uint16_t l;
-        queue.pop_front(l);
-    }
-    uint16_t r = last_raw;
-    queue.push_back(r);
-    for (int i=0; i<queue.size(); i++)
-      median_buffer[i] = *queue.get_ref(i);
-    uint16_t m = median_buffer[quick_median(median_buffer, queue.size())];
-    return m;
+    return readings.push(THEKERNEL->adc->read(&thermistor_pin));
 }
@@ -9,10 +9,15 @@
 #define thermistor_h
 
 #include "TempSensor.h"
-#include "RingBuffer.h"
+#include "SlidingMedian.h"
 
 #define QUEUE_LEN 32
 
+// ADC readings are converted by interpolating in a table with an entry every 4096/THERMISTOR_LUT_SIZE counts,
+// 128 keeps the error under 1C up to 300C, the steep ends of the curve are calculated exactly
+#define THERMISTOR_LUT_SIZE 128
+#define THERMISTOR_LUT_SHIFT 5
+
 
 class Thermistor : public TempSensor
 {
@@ -27,6 +32,8 @@ class Thermistor : public TempSensor
     private:
         int new_thermistor_reading();
         float adc_value_to_temperature(int adc_value);
+        float calculate_temperature(int adc_value);
+        void build_lut();
 
         // Thermistor computation settings
         float r0;
@@ -39,8 +46,8 @@ class Thermistor : public TempSensor
 
         Pin  thermistor_pin;
 
-        RingBuffer<uint16_t,QUEUE_LEN> queue;  // Queue of readings
-        uint16_t median_buffer[QUEUE_LEN];
+        SlidingMedian<uint16_t,QUEUE_LEN> readings;  // median of the last readings
+        float lut[THERMISTOR_LUT_SIZE];  // temperature at adc value i << THERMISTOR_LUT_SHIFT, entry 0 is unused
         
 };
 
@@ -16,17 +16,145 @@
 
 #include "MRI_Hooks.h"
 
+#include <vector>
+
 #define chip_select_checksum CHECKSUM("chip_select_pin")
 #define spi_channel_checksum CHECKSUM("spi_channel")
 
+// All the MAX31855s on one SPI channel. The first one's readings start a scan that reads every sensor in turn,
+// each 32 bit frame is clocked out by the SSP while the CPU does something else, and its receive interrupt
+// finishes one sensor and starts the next, so no reading ever waits for the bus.
+class Max31855Bus
+{
+public:
+    static Max31855Bus *get(int channel);
+
+    void add(Max31855 *sensor);
+    void remove(Max31855 *sensor);
+    void start_scan(Max31855 *sensor);
+
+private:
+    Max31855Bus(int channel);
+    void start(unsigned int i);
+    void isr();
+    static void ssp0_isr() { buses[0]->isr(); }
+    static void ssp1_isr() { buses[1]->isr(); }
+
+    static Max31855Bus *buses[2];
+
+    mbed::SPI *spi;
+    LPC_SSP_TypeDef *ssp;
+    std::vector<Max31855*> sensors;
+    volatile int current; // sensor being read, -1 when idle
+};
+
+Max31855Bus *Max31855Bus::buses[2];
+
+Max31855Bus *Max31855Bus::get(int channel)
+{
+    channel = (channel == 0) ? 0 : 1;
+    if(buses[channel] == nullptr) buses[channel] = new Max31855Bus(channel);
+    return buses[channel];
+}
+
+Max31855Bus::Max31855Bus(int channel)
+{
+    IRQn_Type irq;
+    if(channel == 0) {
+        spi = new mbed::SPI(P0_18, P0_17, P0_15);
+        ssp = LPC_SSP0;
+        irq = SSP0_IRQn;
+        NVIC_SetVector(irq, (uint32_t)&ssp0_isr);
+    } else {
+        spi = new mbed::SPI(P0_9, P0_8, P0_7);
+        ssp = LPC_SSP1;
+        irq = SSP1_IRQn;
+        NVIC_SetVector(irq, (uint32_t)&ssp1_isr);
+    }
+
+    // Spi settings: 1MHz (default), 8 bits so a frame of 4 fills the receive FIFO to the half full interrupt, mode 0 (default)
+    spi->format(8);
+    current = -1;
+
+    // same priority as the reading ticks, so a sensor's readings never change while it is being asked for them
+    NVIC_SetPriority(irq, 4);
+    NVIC_EnableIRQ(irq);
+}
+
+void Max31855Bus::add(Max31855 *sensor)
+{
+    __disable_irq();
+    sensors.push_back(sensor);
+    __enable_irq();
+}
+
+void Max31855Bus::remove(Max31855 *sensor)
+{
+    __disable_irq();
+    if(current >= 0) {
+        // abandon the scan, the next one starts from the beginning
+        ssp->IMSC = 0;
+        sensors[current]->spi_cs_pin.set(true);
+        while(ssp->SR & (1 << 4)) ; // BSY
+        while(ssp->SR & (1 << 2)) (void)ssp->DR; // RNE
+        current = -1;
+    }
+    for(auto i = sensors.begin(); i != sensors.end(); ++i) {
+        if(*i == sensor) {
+            sensors.erase(i);
+            break;
+        }
+    }
+    __enable_irq();
+}
+
+// Called from the sensors' reading ticks, only the first sensor on the bus starts the scan
+void Max31855Bus::start_scan(Max31855 *sensor)
+{
+    if(sensors.empty() || sensors.front() != sensor || current >= 0) return;
+    start(0);
+}
+
+void Max31855Bus::start(unsigned int i)
+{
+    current = i;
+    sensors[i]->spi_cs_pin.set(false);
+    wait_us(1); // Must wait for first bit valid
+
+    // writing something is what clocks the frame in
+    for(int n = 0; n < 4; n++) ssp->DR = 0;
+    ssp->IMSC = (1 << 2); // RXIM
+}
+
+void Max31855Bus::isr()
+{
+    if(current < 0) {
+        ssp->IMSC = 0;
+        return;
+    }
+
+    uint32_t frame = 0;
+    for(int n = 0; n < 4; n++) frame = (frame << 8) | (ssp->DR & 0xFF);
+    sensors[current]->spi_cs_pin.set(true);
+    sensors[current]->finish_read(frame);
+
+    if((unsigned int)current + 1 < sensors.size()) {
+        start(current + 1);
+    } else {
+        ssp->IMSC = 0;
+        current = -1;
+    }
+}
+
 Max31855::Max31855() :
-    spi(nullptr)
+    bus(nullptr)
 {
+    errors = 0;
 }
 
 Max31855::~Max31855()
 {
-    delete spi;
+    if(bus != nullptr) bus->remove(this);
 }
 
 // Get configuration from the config file
@@ -37,81 +165,48 @@ void Max31855::UpdateConfig(uint16_t module_checksum, uint16_t name_checksum)
     this->spi_cs_pin.set(true);
     this->spi_cs_pin.as_output();
     
-    // select which SPI channel to use
+    // select which SPI channel to use, the sensors on a channel share it
     int spi_channel = THEKERNEL->config->value(module_checksum, name_checksum, spi_channel_checksum)->by_default(0)->as_number();
-    PinName miso;
-    PinName mosi;
-    PinName sclk;
-    if(spi_channel == 0) {
-        // Channel 0
-        mosi=P0_18; miso=P0_17; sclk=P0_15;
-    } else {
-        // Channel 1
-        mosi=P0_9; miso=P0_8; sclk=P0_7;
-    } 
-
-    delete spi;
-    spi = new mbed::SPI(mosi, miso, sclk);
-
-    // Spi settings: 1MHz (default), 16 bits, mode 0 (default)
-    spi->format(16);
+    if(bus != nullptr) bus->remove(this);
+    bus = Max31855Bus::get(spi_channel);
+    readings.clear();
+    bus->add(this);
 }
 
 float Max31855::get_temperature()
 {
-	// Return an average of the last readings
-    if (readings.size() >= readings.capacity()) {
-        readings.delete_tail();
-    }
-
-	float temp = read_temp();
-
-	// Discard occasional errors...
-	if(!isinf(temp))
-	{
-		readings.push_back(temp);
-	}
+    bus->start_scan(this);
 
+	// Return an average of the last readings
 	if(readings.size()==0) return infinityf();
-
-	float sum = 0;
-    for (int i=0; i<readings.size(); i++)
-        sum += *readings.get_ref(i);
-
-	return sum / readings.size();
+	return readings.mean();
 }
 
-float Max31855::read_temp()
+// Called from the bus interrupt with the whole frame, the temperature is the top 16 bits
+void Max31855::finish_read(uint32_t frame)
 {
-    this->spi_cs_pin.set(false);
-    wait_us(1); // Must wait for first bit valid
-
-    // Read 16 bits (writing something as well is required by the api)
-    uint16_t data = spi->write(0);
-	//  Read next 16 bits (diagnostics)
-//	uint16_t data2 = spi->write(0);
-
-    this->spi_cs_pin.set(true);
-    
-    float temperature;
+    uint16_t data = frame >> 16;
 
     //Process temp
     if (data & 0x0001)
     {
-        // Error flag.
-        temperature = infinityf();
-        // Todo: Interpret data2 for more diagnostics.
+        // Error flag, the low 3 bits of the frame say which: open circuit, short to GND or VCC.
+        // Discard occasional errors, but once a whole ring of readings has failed there is no temperature
+        if (++errors >= 16) {
+            errors = 16;
+            readings.clear();
+        }
+        return;
     }
-    else
-    {
-        data = data >> 2;
-        temperature = (data & 0x1FFF) / 4.f;
 
-        if (data & 0x2000)
-        {
-            data = ~data;
-            temperature = ((data & 0x1FFF) + 1) / -4.f;
-        }
+    errors = 0;
+    data = data >> 2;
+    float temperature = (data & 0x1FFF) / 4.f;
+
+    if (data & 0x2000)
+    {
+        data = ~data;
+        temperature = ((data & 0x1FFF) + 1) / -4.f;
     }
-    return temperature; 
+    readings.push(temperature);
 }
\ No newline at end of file
@@ -12,7 +12,9 @@
 #include <string>
 #include <libs/Pin.h>
 #include <mbed.h>
-#include "RingBuffer.h"
+#include "SampleRing.h"
+
+class Max31855Bus;
 
 class Max31855 : public TempSensor
 {
@@ -23,10 +25,13 @@ public:
     float get_temperature();
 
 private:
-	float read_temp();
+    friend class Max31855Bus;
+    void finish_read(uint32_t frame);
+
     Pin spi_cs_pin;
-    mbed::SPI *spi;
-    RingBuffer<float,16> readings;
+    Max31855Bus *bus;
+    SampleRing<float,16> readings;
+    uint8_t errors;
 };
 
 #endif
@@ -27,6 +27,7 @@ Author: Michael Hackney, mhackney@eclecticangler.com
 #include "PublicData.h"
 #include "StreamOutputPool.h"
 #include "TemperatureControlPool.h"
+#include "TemperatureControl.h"
 
 #define temperatureswitch_checksum                    CHECKSUM("temperatureswitch")
 #define enable_checksum                               CHECKSUM("enable")
@@ -42,6 +43,7 @@ TemperatureSwitch::TemperatureSwitch()
 {
     this->temperatureswitch_state = false;
     this->second_counter = 0;
+    this->controllers_above = 0;
 }
 
 // Load module
@@ -123,6 +125,14 @@ bool TemperatureSwitch::load_config(uint16_t modcs)
     ts->temperatureswitch_heatup_poll = THEKERNEL->config->value(temperatureswitch_checksum, modcs, temperatureswitch_heatup_poll_checksum)->by_default(15)->as_number();
     ts->temperatureswitch_cooldown_poll = THEKERNEL->config->value(temperatureswitch_checksum, modcs, temperatureswitch_cooldown_poll_checksum)->by_default(60)->as_number();
     ts->current_delay = ts->temperatureswitch_heatup_poll;
+    // nothing to wait for the first time
+    ts->second_counter = ts->current_delay;
+
+    // the controllers say when they cross the threshold, rather than being asked every so often
+    for (auto cs : ts->temp_controllers) {
+        TemperatureControl *control = THEKERNEL->temperature_control_pool->get_control(cs);
+        if(control != nullptr) control->watch_temperature(ts->temperatureswitch_threshold_temp, 0, ts, &TemperatureSwitch::on_threshold);
+    }
 
     // Register for events
     ts->register_for_event(ON_SECOND_TICK);
@@ -130,49 +140,27 @@ bool TemperatureSwitch::load_config(uint16_t modcs)
     return true;
 }
 
-// Called once a second but we only need to service on the cooldown and heatup poll intervals
-void TemperatureSwitch::on_second_tick(void *argument)
+// Called from a controller's reading tick when it crosses the threshold, the switch is set from on_second_tick
+uint32_t TemperatureSwitch::on_threshold(uint32_t above)
 {
-    second_counter++;
-    if (second_counter < current_delay) {
-        return;
-    } else {
-        second_counter = 0;
-        float current_temp = this->get_highest_temperature();
-
-        if (current_temp >= this->temperatureswitch_threshold_temp) {
-            // temp >= threshold temp, turn the cooler switch on if it isn't already
-            if (!temperatureswitch_state) {
-                set_switch(true);
-                current_delay = temperatureswitch_cooldown_poll;
-            }
-        } else {
-            // temp < threshold temp, turn the cooler switch off if it isn't already
-            if (temperatureswitch_state) {
-                set_switch(false);
-                current_delay = temperatureswitch_heatup_poll;
-            }
-        }
-    }
+    if (above) controllers_above++;
+    else if (controllers_above > 0) controllers_above--;
+    return 0;
 }
 
-// Get the highest temperature from the set of temperature controllers
-float TemperatureSwitch::get_highest_temperature()
+// Called once a second, the switch changes once the highest temperature has crossed the threshold and it has been
+// on for cooldown_poll or off for heatup_poll seconds
+void TemperatureSwitch::on_second_tick(void *argument)
 {
-    void *returned_temp;
-    float high_temp = 0.0;
+    if (second_counter < current_delay) second_counter++;
 
-    for (auto controller : temp_controllers) {
-        bool temp_ok = PublicData::get_value(temperature_control_checksum, controller, current_temperature_checksum, &returned_temp);
-        if (temp_ok) {
-            struct pad_temperature temp =  *static_cast<struct pad_temperature *>(returned_temp);
-            // check if this controller's temp is the highest and save it if so
-            if (temp.current_temperature > high_temp) {
-                high_temp = temp.current_temperature;
-            }
-        }
-    }
-    return high_temp;
+    bool hot = controllers_above > 0;
+    if (hot == temperatureswitch_state || second_counter < current_delay) return;
+
+    // turn the cooler switch on when the temp >= threshold temp, off when it is back below
+    set_switch(hot);
+    second_counter = 0;
+    current_delay = hot ? temperatureswitch_cooldown_poll : temperatureswitch_heatup_poll;
 }
 
 // Turn the switch on (true) or off (false)
@@ -28,13 +28,11 @@ class TemperatureSwitch : public Module
         TemperatureSwitch();
         void on_module_loaded();
         void on_second_tick(void *argument);
+        uint32_t on_threshold(uint32_t above);
 
     private:
         bool load_config(uint16_t modcs);
 
-        // get the highest temperature from the set of configured temperature controllers
-        float get_highest_temperature();
-
         // turn the switch on or off
         void set_switch(bool cooler_state);
 
@@ -47,20 +45,23 @@ class TemperatureSwitch : public Module
         // temperatureswitch.hotend.switch
         uint16_t temperatureswitch_switch_cs;
 
-        // check temps on heatup every X seconds
+        // seconds the switch stays off before it can come on again
         // this can be set in config: temperatureswitch.hotend.heatup_poll
         uint16_t temperatureswitch_heatup_poll;
 
-        // check temps on cooldown every X seconds
+        // seconds the switch stays on before it can go off again
         // this can be set in config: temperatureswitch.hotend.cooldown_poll
         uint16_t temperatureswitch_cooldown_poll;
 
-        // our internal second counter
+        // seconds since the switch last changed, up to current_delay
         uint16_t second_counter;
 
         // we are delaying for this many seconds
         uint16_t current_delay;
 
+        // controllers at or above the threshold, counted by on_threshold from their reading ticks
+        volatile uint8_t controllers_above;
+
         // is the switch currently on (1) or off (0)?
         bool temperatureswitch_state;
 };
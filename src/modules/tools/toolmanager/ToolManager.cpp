@@ -27,6 +27,7 @@ using namespace std;
 #include "FileStream.h"
 
 #include "modules/robot/RobotPublicAccess.h"
+#include "TemperatureControlPublicAccess.h"
 
 #define return_error_on_unhandled_gcode_checksum    CHECKSUM("return_error_on_unhandled_gcode")
 
@@ -39,8 +40,7 @@ void ToolManager::on_module_loaded(){
     this->on_config_reload(this);
 
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_owner(tool_manager_checksum, this);
 }
 
 void ToolManager::on_config_reload(void *argument){
@@ -105,6 +105,23 @@ void ToolManager::on_set_public_data(void* argument){
 
     if(!pdr->starts_with(tool_manager_checksum)) return;
 
+    if(pdr->second_element_is(preheat_tool_checksum)) {
+        struct tool_preheat *p = static_cast<struct tool_preheat *>(pdr->get_data_ptr());
+        pdr->set_taken();
+        if(p->tool < 0 || p->tool >= (int)this->tools.size() || p->tool == this->active_tool || p->temperature <= 0) return;
+
+        // the heater of a tool has the same name as the tool
+        uint16_t name = this->tools[p->tool]->get_name();
+        void *returned_data;
+        if(!PublicData::get_value( temperature_control_checksum, name, current_temperature_checksum, &returned_data )) return;
+        struct pad_temperature *temp = static_cast<struct pad_temperature *>(returned_data);
+        if(temp->target_temperature >= p->temperature) return;
+
+        float t = p->temperature;
+        PublicData::set_value( temperature_control_checksum, name, &t );
+        return;
+    }
+
     // ok this is targeted at us, so change tools
     //uint16_t tool_name= *static_cast<float*>(pdr->get_data_ptr());
     // TODO: fire a tool change gcode
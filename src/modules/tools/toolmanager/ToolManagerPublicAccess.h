@@ -5,6 +5,13 @@
 #define tool_manager_checksum             CHECKSUM("tool_manager")
 #define current_tool_name_checksum        CHECKSUM("current_tool_name")
 #define is_active_tool_checksum           CHECKSUM("is_active_tool")
+#define preheat_tool_checksum             CHECKSUM("preheat_tool")
+
+// heat a tool that is not the active one ahead of a change to it, never lowers the temperature it is already heating to
+struct tool_preheat {
+    int tool;
+    float temperature;
+};
 
 #endif // __TOOLMANAGERPUBLICACCESS_H
 
@@ -8,6 +8,11 @@
 #include "Touchprobe.h"
 
 #include "BaseSolution.h"
+#include "platform_memory.h"
+#include "StreamOutputPool.h"
+
+#include <math.h>
+#include <algorithm>
 
 #define touchprobe_enable_checksum           CHECKSUM("touchprobe_enable")
 #define touchprobe_log_enable_checksum       CHECKSUM("touchprobe_log_enable")
@@ -22,7 +27,10 @@
 #define touchprobe_log_rotate_mcode_checksum CHECKSUM("touchprobe_log_rotate_mcode")
 #define touchprobe_pin_checksum              CHECKSUM("touchprobe_pin")
 #define touchprobe_debounce_count_checksum   CHECKSUM("touchprobe_debounce_count")
+#define touchprobe_log_buffer_sectors_checksum CHECKSUM("touchprobe_log_buffer_sectors")
+#define touchprobe_log_format_checksum       CHECKSUM("touchprobe_log_format")
 
+#define LOG_SECTOR_SIZE 512
 
 void Touchprobe::on_module_loaded() {
     // if the module is disabled -> do nothing
@@ -33,6 +41,8 @@ void Touchprobe::on_module_loaded() {
         return;
     }
     this->probe_rate = 5;
+    this->log_buffer = NULL;
+    this->logfile = NULL;
     // load settings
     this->on_config_reload(this);
     // register event-handlers
@@ -53,7 +63,17 @@ void Touchprobe::on_config_reload(void* argument){
     if( this->should_log){
         this->filename = THEKERNEL->config->value(touchprobe_logfile_name_checksum)->by_default("/sd/probe_log.csv")->as_string();
         this->mcode = THEKERNEL->config->value(touchprobe_log_rotate_mcode_checksum)->by_default(0)->as_int();
-        this->logfile = NULL;
+        // binary is three floats per point, a row of NANs for the separator
+        this->binary_log = THEKERNEL->config->value(touchprobe_log_format_checksum)->by_default("text")->as_string() == "binary";
+
+        size_t sectors = THEKERNEL->config->value(touchprobe_log_buffer_sectors_checksum)->by_default(4)->as_int();
+        if(sectors < 1) sectors = 1;
+        if(this->log_buffer != NULL) placed_free(this->log_buffer);
+        this->log_size = sectors * LOG_SECTOR_SIZE;
+        this->log_buffer = placed_alloc<char>(this->log_size, PLACE_AHB);
+        this->log_tail = this->log_used = 0;
+        this->overruns = this->reported_overruns = 0;
+        if(this->log_buffer == NULL) this->should_log = false;
     }
 }
 
@@ -91,18 +111,65 @@ void Touchprobe::wait_for_touch(int distance[]){
 }
 
 
-void Touchprobe::flush_log(){
+void Touchprobe::log_point(float x, float y, float z){
+    if( this->binary_log ){
+        float point[3] {x, y, z};
+        log_bytes((const char*)point, sizeof(point));
+    }else{
+        char line[48];
+        int n = snprintf(line, sizeof(line), "%1.3f %1.3f %1.3f\n", x, y, z);
+        log_bytes(line, n);
+    }
+}
+
+// copy into the ring, a point that does not fit is dropped and counted rather than waiting for the card
+bool Touchprobe::log_bytes(const char* data, size_t n){
+    if( n > this->log_size - this->log_used ){
+        this->overruns++;
+        return false;
+    }
+    size_t head = (this->log_tail + this->log_used) % this->log_size;
+    for( size_t i = 0; i < n; i++ ){
+        this->log_buffer[head] = data[i];
+        if( ++head == this->log_size ) head = 0;
+    }
+    this->log_used += n;
+    return true;
+}
+
+// write the whole sectors in the ring, or all of it when the log is rotated
+void Touchprobe::flush_log(bool all){
+    size_t n = all ? this->log_used : this->log_used - this->log_used % LOG_SECTOR_SIZE;
+    if( n == 0 ) return;
+
+    if( this->logfile == NULL ){
+        // NOTE: File creation is buggy, a file may appear but writing to it will fail
+        this->logfile = fopen( filename.c_str(), "a");
+        if( this->logfile == NULL ) return;
+    }
+    // the tail only ever moves by whole sectors until a rotate, so a piece never splits a sector
+    while( n > 0 ){
+        size_t chunk = std::min(n, this->log_size - this->log_tail);
+        fwrite(this->log_buffer + this->log_tail, 1, chunk, this->logfile);
+        this->log_tail = (this->log_tail + chunk) % this->log_size;
+        this->log_used -= chunk;
+        n -= chunk;
+    }
+    if( this->log_used == 0 ) this->log_tail = 0;
+
     //FIXME *sigh* fflush doesn't work as expected, see: http://mbed.org/forum/mbed/topic/3234/ or http://mbed.org/search/?type=&q=fflush
     //fflush(logfile);
-    fclose(logfile);
-    //can't reopen the file here -> crash
-    logfile = NULL;
+    fclose(this->logfile);
+    //can't reopen the file here -> crash, it is opened again on the next flush
+    this->logfile = NULL;
 }
-// Workaround for the close<->reopen crash, which itself is a workaround for wrong (or unimplemented) fflush behaviour
+
 void Touchprobe::on_idle(void* argument){
-    if( this->logfile == NULL) {
-        // NOTE: File creation is buggy, a file may appear but writing to it will fail
-        this->logfile = fopen( filename.c_str(), "a");
+    if( !this->should_log ) return;
+    flush_log(false);
+    if( this->overruns != this->reported_overruns ){
+        THEKERNEL->streams->printf("touchprobe: log buffer overrun, %u points dropped\r\n", this->overruns - this->reported_overruns);
+        this->reported_overruns = this->overruns;
     }
 }
 
@@ -159,8 +226,7 @@ void Touchprobe::on_gcode_received(void* argument)
 
             if( this->should_log ){
                 robot->get_axis_position(pos);
-                fprintf(logfile,"%1.3f %1.3f %1.3f\n", robot->from_millimeters(pos[0]), robot->from_millimeters(pos[1]), robot->from_millimeters(pos[2]) );
-                flush_log();
+                log_point(robot->from_millimeters(pos[0]), robot->from_millimeters(pos[1]), robot->from_millimeters(pos[2]));
             }
         }
     }else if(gcode->has_m) {
@@ -168,9 +234,12 @@ void Touchprobe::on_gcode_received(void* argument)
         // for now this only writes a separator
         // TODO do a actual log rotation
         if( this->mcode != 0 && this->should_log && gcode->m == this->mcode){
-            string name;
-            fputs("--\n",logfile);
-            flush_log();
+            if( this->binary_log ){
+                log_point(NAN, NAN, NAN);
+            }else{
+                log_bytes("--\n", 3);
+            }
+            flush_log(true);
         }
     }
 }
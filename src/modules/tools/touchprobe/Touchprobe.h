@@ -13,10 +13,20 @@
 class Touchprobe: public Module {
     private:
         void wait_for_touch(int distance[]);
-        void flush_log();
+        void log_point(float x, float y, float z);
+        bool log_bytes(const char* data, size_t n);
+        void flush_log(bool all);
 
         FILE*          logfile;
         string         filename;
+        // points wait here until on_idle writes them out a sector at a time
+        char*          log_buffer;
+        size_t         log_size;
+        size_t         log_tail;
+        size_t         log_used;
+        unsigned int   overruns;
+        unsigned int   reported_overruns;
+        bool           binary_log;
         StepperMotor*  steppers[3];
         Pin            pin;
         unsigned int   debounce_count;
@@ -15,6 +15,7 @@
 
 #include <tuple>
 #include <algorithm>
+#include <math.h>
 
 #define radius_checksum       CHECKSUM("radius")
 // deprecated
@@ -40,6 +41,16 @@ bool DeltaCalibrationStrategy::handleGcode(Gcode *gcode)
             // first wait for an empty queue i.e. no moves left
             THEKERNEL->conveyor->wait_for_empty_queue();
 
+            if(gcode->has_letter('S')) {
+                // probe once and solve trims and radius (and arm length with A) together
+                if(!calibrate_least_squares(gcode)) {
+                    gcode->stream->printf("Calibration failed to complete\n");
+                    return true;
+                }
+                gcode->stream->printf("Calibration complete, save settings with M500\n");
+                return true;
+            }
+
             if(!gcode->has_letter('R')) {
                 if(!calibrate_delta_endstops(gcode)) {
                     gcode->stream->printf("Calibration failed to complete, probe not triggered\n");
@@ -286,6 +297,198 @@ bool DeltaCalibrationStrategy::calibrate_delta_radius(Gcode *gcode)
     return true;
 }
 
+// solves m x = b for the first n rows, b becomes x, false if m is singular
+static bool solve_linear(float m[5][5], float b[5], int n)
+{
+    for (int c = 0; c < n; ++c) {
+        // pivot on the largest value left in the column
+        int p = c;
+        for (int r = c + 1; r < n; ++r) {
+            if(fabsf(m[r][c]) > fabsf(m[p][c])) p = r;
+        }
+        if(fabsf(m[p][c]) < 1e-6F) return false;
+        if(p != c) {
+            for (int k = 0; k < n; ++k) std::swap(m[p][k], m[c][k]);
+            std::swap(b[p], b[c]);
+        }
+        for (int r = c + 1; r < n; ++r) {
+            float f = m[r][c] / m[c][c];
+            for (int k = c; k < n; ++k) m[r][k] -= f * m[c][k];
+            b[r] -= f * b[c];
+        }
+    }
+    for (int c = n - 1; c >= 0; --c) {
+        for (int k = c + 1; k < n; ++k) b[c] -= m[c][k] * b[k];
+        b[c] /= m[c][c];
+    }
+    return true;
+}
+
+// the heights the arm solution gives for the probed actuator positions, with the trims changed by params[0..2]
+// and the delta radius and arm length set to params[3] and params[4]
+void DeltaCalibrationStrategy::model_heights(const float params[5], const float actuators[][3], int n, float heights[])
+{
+    BaseSolution::arm_options_t options;
+    options['R'] = params[3];
+    options['L'] = params[4];
+    THEKERNEL->robot->arm_solution->set_optional(options);
+
+    for (int i = 0; i < n; ++i) {
+        // the carriage stays where it triggered, so more trim means it is counted from further down
+        float a[3] {actuators[i][0] - params[0], actuators[i][1] - params[1], actuators[i][2] - params[2]};
+        float c[3];
+        THEKERNEL->robot->arm_solution->actuator_to_cartesian(a, c);
+        heights[i] = c[2];
+    }
+}
+
+/*
+    probe the center and two rings of points once, then solve the trims, delta radius and optionally arm length
+    that put them all at the same height, with a few Gauss-Newton steps on the arm solution instead of probing
+    again after each adjustment
+*/
+
+bool DeltaCalibrationStrategy::calibrate_least_squares(Gcode *gcode)
+{
+    float target = 0.03F;
+    if(gcode->has_letter('I')) target = gcode->get_value('I'); // override default target
+    if(gcode->has_letter('J')) this->probe_radius = gcode->get_value('J'); // override default probe radius
+    int n_ring = 6; // points on each ring
+    if(gcode->has_letter('P')) n_ring = std::min(std::max((int)gcode->get_value('P'), 3), 12);
+    bool solve_arm = gcode->has_letter('A');
+    int n_params = solve_arm ? 5 : 4;
+
+    BaseSolution::arm_options_t options;
+    if(!THEKERNEL->robot->arm_solution->get_optional(options) || options['R'] == 0.0F) {
+        gcode->stream->printf("This appears to not be a delta arm solution\n");
+        return false;
+    }
+    float radius = options['R'], arm_length = options['L'];
+
+    float trimx, trimy, trimz;
+    if(!get_trim(trimx, trimy, trimz)) {
+        gcode->stream->printf("Could not get current trim, are endstops enabled?\n");
+        return false;
+    }
+
+    gcode->stream->printf("Calibrating delta by least squares: %d points, target %fmm, radius %fmm\n", 2 * n_ring + 1, target, this->probe_radius);
+
+    // find bed, run at fast rate, then move to a point just above it
+    zprobe->home();
+    int s;
+    if(!zprobe->run_probe(s, true)) return false;
+    float bedht = zprobe->zsteps_to_mm(s) - zprobe->getProbeHeight();
+    gcode->stream->printf("Bed ht is %f mm\n", bedht);
+
+    zprobe->home();
+    zprobe->coordinated_move(NAN, NAN, -bedht, zprobe->getFastFeedrate(), true);
+    float pos[3];
+    THEKERNEL->robot->get_axis_position(pos);
+
+    // the center, then the outer ring starting at the X tower, then the inner ring between the outer points
+    float actuators[25][3];
+    int n = 0;
+    for (int i = 0; i <= 2 * n_ring; ++i) {
+        float x = 0.0F, y = 0.0F;
+        if(i > 0) {
+            bool outer = i <= n_ring;
+            float r = outer ? this->probe_radius : this->probe_radius / 2;
+            float a = (210.0F + 360.0F * (outer ? i - 1 : i - n_ring - 0.5F) / n_ring) * (float)M_PI / 180.0F;
+            x = r * cosf(a);
+            y = r * sinf(a);
+        }
+
+        if(!zprobe->doProbeAt(s, x, y)) return false;
+        float cartesian[3] {x, y, pos[2] - zprobe->zsteps_to_mm(s)};
+        gcode->stream->printf("P%d X:%1.3f Y:%1.3f Z:%1.4f C:%d\n", i, x, y, cartesian[2], s);
+        THEKERNEL->robot->arm_solution->cartesian_to_actuator(cartesian, actuators[n++]);
+
+        // flush the output
+        THEKERNEL->call_event(ON_IDLE);
+    }
+    // nothing may be moving while the arm solution is changed
+    THEKERNEL->conveyor->wait_for_empty_queue();
+
+    float params[5] {0.0F, 0.0F, 0.0F, radius, arm_length};
+    float heights[25], jacobian[5][25];
+    model_heights(params, actuators, n, heights);
+
+    // keep the average height where it is, the trims would otherwise be free to move the whole bed
+    float level = 0.0F;
+    for (int i = 0; i < n; ++i) level += heights[i];
+    level /= n;
+    auto mm = std::minmax_element(heights, heights + n);
+    float before = *mm.second - *mm.first;
+
+    bool solved = true;
+    for (int iteration = 0; iteration < 5 && solved; ++iteration) {
+        // differentiate numerically, the arm solution is the model so any delta solution works
+        const float h = 0.1F;
+        for (int j = 0; j < n_params; ++j) {
+            float p[5];
+            std::copy(params, params + 5, p);
+            p[j] += h;
+            model_heights(p, actuators, n, jacobian[j]);
+        }
+        model_heights(params, actuators, n, heights);
+        for (int j = 0; j < n_params; ++j) {
+            for (int i = 0; i < n; ++i) jacobian[j][i] = (jacobian[j][i] - heights[i]) / h;
+        }
+
+        // normal equations
+        float m[5][5], b[5];
+        for (int j = 0; j < n_params; ++j) {
+            b[j] = 0.0F;
+            for (int i = 0; i < n; ++i) b[j] += jacobian[j][i] * (level - heights[i]);
+            for (int k = 0; k < n_params; ++k) {
+                m[j][k] = 0.0F;
+                for (int i = 0; i < n; ++i) m[j][k] += jacobian[j][i] * jacobian[k][i];
+            }
+        }
+
+        solved = solve_linear(m, b, n_params);
+        if(!solved) break;
+
+        float largest = 0.0F;
+        for (int j = 0; j < n_params; ++j) {
+            params[j] += b[j];
+            largest = std::max(largest, fabsf(b[j]));
+        }
+        if(largest < 0.001F) break;
+    }
+
+    if(!solved) {
+        options.clear();
+        options['R'] = radius;
+        options['L'] = arm_length;
+        THEKERNEL->robot->arm_solution->set_optional(options);
+        gcode->stream->printf("Could not solve, try more points or leave out A\n");
+        return false;
+    }
+
+    model_heights(params, actuators, n, heights);
+    mm = std::minmax_element(heights, heights + n);
+    float after = *mm.second - *mm.first;
+    gcode->stream->printf("Deviation was %1.4f, expected to be %1.4f\n", before, after);
+    gcode->stream->printf("Setting delta radius to: %1.4f\n", params[3]);
+    if(solve_arm) gcode->stream->printf("Setting arm length to: %1.4f\n", params[4]);
+
+    // set trims to worst case so we always have a negative trim
+    trimx += params[0];
+    trimy += params[1];
+    trimz += params[2];
+    float most = std::max({trimx, trimy, trimz});
+    if(!set_trim(trimx - most, trimy - most, trimz - most, gcode->stream)) return false;
+
+    if(after > target) {
+        gcode->stream->printf("WARNING: deviation is not expected to be within required parameters, the bed may not be flat\n");
+    }
+
+    // home so the position is counted with the new geometry
+    zprobe->home();
+    return true;
+}
+
 bool DeltaCalibrationStrategy::set_trim(float x, float y, float z, StreamOutput *stream)
 {
     float t[3] {x, y, z};
@@ -20,6 +20,8 @@ private:
     bool get_trim(float& x, float& y, float& z);
     bool calibrate_delta_endstops(Gcode *gcode);
     bool calibrate_delta_radius(Gcode *gcode);
+    bool calibrate_least_squares(Gcode *gcode);
+    void model_heights(const float params[5], const float actuators[][3], int n, float heights[]);
 
     float probe_radius;
 };
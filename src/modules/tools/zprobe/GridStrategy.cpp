@@ -0,0 +1,442 @@
+/*
+    Summary
+    -------
+    Probes a grid of points over the bed and stores the height of each one relative to the first.
+    As the head moves in X and Y, Z is adjusted by interpolating between the four grid points around it,
+    so a warped bed is followed as well as a tilted one.
+
+    Configuration
+    -------------
+    The strategy must be enabled in the config as well as zprobe.
+
+    leveling-strategy.grid-leveling.enable         true
+
+    The grid covers the bed from 0,0 to x_size,y_size and has x_points by y_points probe points
+
+    leveling-strategy.grid-leveling.x_size         200     # size of the bed in X, default 200mm
+    leveling-strategy.grid-leveling.y_size         200     # size of the bed in Y, default 200mm
+    leveling-strategy.grid-leveling.x_points       5       # probe points in X, 2 to 20, default 5
+    leveling-strategy.grid-leveling.y_points       5       # probe points in Y, 2 to 20, default 5
+
+    probe offsets from the nozzle or tool head can be defined with
+
+    leveling-strategy.grid-leveling.probe_offsets  0,0,0   # probe offsets x,y,z
+
+    they may also be set with M565 X0 Y0 Z0
+
+    To force homing in X and Y before G32 does the probe the following can be set in config, this is the default
+
+    leveling-strategy.grid-leveling.home_first     true    # disable by setting to false
+
+    To save most of the Z travel the probe can sweep the grid, lifting only a little between points, it must be more than
+    the bed rises from one point to the next
+
+    leveling-strategy.grid-leveling.sweep_clearance  1     # lift between points in mm, default is 0 to go back to probe_height
+
+    The heights go in the AHB banks if there is room, this can be set to heap, ahb0, ahb1 or ahb
+
+    leveling-strategy.grid-leveling.memory         ahb
+
+    The grid can be saved to a file on the sd card, and with save_grid M500 saves it and loads it again at boot
+
+    leveling-strategy.grid-leveling.grid_file      /sd/grid    # default is /sd/grid
+    leveling-strategy.grid-leveling.save_grid      false       # set to true to save the grid with M500
+    leveling-strategy.grid-leveling.tolerance      0.05        # how far G32 C may find the bed off the grid, default is 0.05mm
+
+    Usage
+    -----
+    G32 probes the grid and turns on the compensation, this will remain in effect until reset or M561
+    G32 C probes three corners of the grid already loaded, and only probes the whole grid again if one is out of tolerance
+    G31 reports the status and prints the grid
+
+    M374 saves the grid to the grid file
+    M375 loads the grid from the grid file and turns on the compensation
+    M561 clears the grid and the bed leveling is disabled until G32 is run again
+    M565 defines the probe offsets from the nozzle or tool head
+
+    M500 saves the probe offsets, and the grid if save_grid is set
+    M503 displays the current settings
+*/
+
+#include "GridStrategy.h"
+#include "Kernel.h"
+#include "Config.h"
+#include "Robot.h"
+#include "StreamOutputPool.h"
+#include "Gcode.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "Conveyor.h"
+#include "ZProbe.h"
+#include "nuts_bolts.h"
+#include "platform_memory.h"
+
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#define x_size_checksum              CHECKSUM("x_size")
+#define y_size_checksum              CHECKSUM("y_size")
+#define x_points_checksum            CHECKSUM("x_points")
+#define y_points_checksum            CHECKSUM("y_points")
+#define probe_offsets_checksum       CHECKSUM("probe_offsets")
+#define home_checksum                CHECKSUM("home_first")
+#define memory_checksum              CHECKSUM("memory")
+#define grid_file_checksum           CHECKSUM("grid_file")
+#define save_grid_checksum           CHECKSUM("save_grid")
+#define tolerance_checksum           CHECKSUM("tolerance")
+#define sweep_clearance_checksum     CHECKSUM("sweep_clearance")
+
+#define MAX_GRID_POINTS 20
+
+// the grid file is this followed by the heights, a row of x_points at a time
+#define GRID_FILE_VERSION 1
+struct GridFileHeader {
+    char magic[3]; // "GRD"
+    uint8_t version;
+    uint8_t x_points;
+    uint8_t y_points;
+    uint16_t reserved;
+    float x_size;
+    float y_size;
+};
+
+GridStrategy::GridStrategy(ZProbe *zprobe) : LevelingStrategy(zprobe)
+{
+    grid = nullptr;
+    valid = false;
+}
+
+GridStrategy::~GridStrategy()
+{
+    placed_free(grid);
+}
+
+bool GridStrategy::handleConfig()
+{
+    this->x_size= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, x_size_checksum)->by_default(200.0F)->as_number();
+    this->y_size= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, y_size_checksum)->by_default(200.0F)->as_number();
+    int xp= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, x_points_checksum)->by_default(5)->as_int();
+    int yp= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, y_points_checksum)->by_default(5)->as_int();
+    this->x_points= confine(xp, 2, MAX_GRID_POINTS);
+    this->y_points= confine(yp, 2, MAX_GRID_POINTS);
+    this->x_scale= (x_points - 1) / x_size;
+    this->y_scale= (y_points - 1) / y_size;
+
+    // Probe offsets xxx,yyy,zzz
+    std::string po = THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, probe_offsets_checksum)->by_default("0,0,0")->as_string();
+    this->probe_offsets= parseXYZ(po.c_str());
+
+    this->home= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, home_checksum)->by_default(true)->as_bool();
+    this->grid_file= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, grid_file_checksum)->by_default("/sd/grid")->as_string();
+    this->save= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, save_grid_checksum)->by_default(false)->as_bool();
+    this->tolerance= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, tolerance_checksum)->by_default(0.05F)->as_number();
+    this->sweep_clearance= THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, sweep_clearance_checksum)->by_default(0.0F)->as_number();
+
+    // a 20x20 grid is 1.6K, it is only read when a segment is planned so it does not need to be in the main bank
+    MemoryPlacement where= placement_from_string(THEKERNEL->config->value(leveling_strategy_checksum, grid_leveling_strategy_checksum, memory_checksum)->by_default("ahb")->as_string().c_str(), PLACE_AHB);
+    placed_free(this->grid);
+    this->grid= placed_alloc<float>(x_points * y_points, where);
+    this->valid= false;
+    return true;
+}
+
+bool GridStrategy::handleGcode(Gcode *gcode)
+{
+    if(gcode->has_g) {
+        // G code processing
+        if( gcode->g == 31 ) { // report status
+            if(!this->valid) {
+                 gcode->stream->printf("Bed leveling grid is not set\n");
+            }else{
+                 printGrid(gcode->stream);
+            }
+            gcode->stream->printf("Probe is %s\n", zprobe->getProbeStatus() ? "Triggered" : "Not triggered");
+            return true;
+
+        } else if( gcode->g == 32 ) { // grid probe
+            // first wait for an empty queue i.e. no moves left
+            THEKERNEL->conveyor->wait_for_empty_queue();
+            if(gcode->has_letter('C') && this->valid) {
+                if(spotCheck(gcode->stream)) {
+                    gcode->stream->printf("Bed grid checked and still within tolerance\n");
+                    setAdjustFunction(true);
+                    return true;
+                }
+                gcode->stream->printf("Bed grid check out of tolerance, probing the whole grid\n");
+            }
+            if(!doProbing(gcode->stream)) {
+                gcode->stream->printf("Probe failed to complete, probe not triggered or other error\n");
+            } else {
+                gcode->stream->printf("Probe completed, bed grid defined\n");
+            }
+            return true;
+        }
+
+    } else if(gcode->has_m) {
+        if(gcode->m == 374) { // M374: save the grid
+            if(!this->valid) {
+                gcode->stream->printf("No grid to save\n");
+            } else if(saveGrid(gcode->stream)) {
+                gcode->stream->printf("Grid saved to %s\n", this->grid_file.c_str());
+            }
+            return true;
+
+        } else if(gcode->m == 375) { // M375: load the grid and turn on the compensation
+            if(loadGrid(gcode->stream)) {
+                setAdjustFunction(true);
+                gcode->stream->printf("Grid loaded from %s\n", this->grid_file.c_str());
+            }
+            return true;
+
+        } else if(gcode->m == 561) { // M561: Set Identity Transform
+            this->valid= false;
+            setAdjustFunction(false);
+            return true;
+
+        } else if(gcode->m == 565) { // M565: Set Z probe offsets
+            float x= 0, y= 0, z= 0;
+            if(gcode->has_letter('X')) x = gcode->get_value('X');
+            if(gcode->has_letter('Y')) y = gcode->get_value('Y');
+            if(gcode->has_letter('Z')) z = gcode->get_value('Z');
+            probe_offsets = std::make_tuple(x, y, z);
+            return true;
+
+        } else if(gcode->m == 500 || gcode->m == 503) { // M500 save, M503 display
+            float x, y, z;
+            gcode->stream->printf(";Probe offsets:\n");
+            std::tie(x, y, z) = probe_offsets;
+            gcode->stream->printf("M565 X%1.5f Y%1.5f Z%1.5f\n", x, y, z);
+
+            // the grid is too big for the config-override, so it goes in its own file and is loaded from there at boot
+            if(this->save && this->valid) {
+                if(gcode->m == 500) {
+                    if(saveGrid(gcode->stream)) gcode->stream->printf(";Saved bed grid:\nM375\n");
+                }else{
+                    gcode->stream->printf(";The bed grid will be saved on M500\n");
+                }
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void GridStrategy::homeXY()
+{
+    Gcode gc("G28 X0 Y0", &(StreamOutput::NullStream));
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gc);
+}
+
+bool GridStrategy::doProbing(StreamOutput *stream)
+{
+    if(this->grid == nullptr) {
+        stream->printf("No memory for the grid\n");
+        return false;
+    }
+
+    // no compensation while probing, and none left if it fails
+    this->valid= false;
+    setAdjustFunction(false);
+
+    if(!findBed()) return false;
+    float xo= std::get<X_AXIS>(this->probe_offsets);
+    float yo= std::get<Y_AXIS>(this->probe_offsets);
+
+    // back and forth along the rows so each move is to the next point
+    float dx= x_size / (x_points - 1);
+    float dy= y_size / (y_points - 1);
+    for (int j = 0; j < y_points; ++j) {
+        for (int n = 0; n < x_points; ++n) {
+            int i= (j & 1) ? x_points - 1 - n : n;
+            float h;
+            if(this->sweep_clearance > 0) {
+                // Z was set where the first point triggered
+                h = zprobe->sweepProbeAt(i * dx - xo, j * dy - yo, this->sweep_clearance) - std::get<Z_AXIS>(this->probe_offsets);
+                if(isnan(h)) {
+                    stream->printf("Probe failed at point %d,%d, not triggered or sweep_clearance is too small\n", i, j);
+                    return false;
+                }
+            } else {
+                float z = zprobe->probeDistance(i * dx - xo, j * dy - yo);
+                if(isnan(z)) return false; // probe failed
+                h = zprobe->getProbeHeight() - z; // relative to the first point, lower is negative z
+            }
+            grid[j * x_points + i]= h;
+        }
+    }
+    if(this->sweep_clearance > 0) {
+        zprobe->coordinated_move(NAN, NAN, zprobe->getProbeHeight(), zprobe->getFastFeedrate());
+    }
+
+    this->valid= true;
+    printGrid(stream);
+    setAdjustFunction(true);
+    return true;
+}
+
+// home if set to, then find the bed at the first point, which becomes Z == 0 like the three point strategy
+bool GridStrategy::findBed()
+{
+    // optionally home XY axis first, but allow for manual homing
+    if(this->home)
+        homeXY();
+
+    zprobe->coordinated_move(-std::get<X_AXIS>(this->probe_offsets), -std::get<Y_AXIS>(this->probe_offsets), NAN, zprobe->getFastFeedrate());
+    int s;
+    if(!zprobe->run_probe(s)) return false;
+    THEKERNEL->robot->reset_axis_position(std::get<Z_AXIS>(this->probe_offsets), Z_AXIS);
+
+    // move up to specified probe start position
+    zprobe->coordinated_move(NAN, NAN, zprobe->getProbeHeight(), zprobe->getSlowFeedrate());
+    return true;
+}
+
+// probe the other three corners, true if they are all where the grid has them
+bool GridStrategy::spotCheck(StreamOutput *stream)
+{
+    // the moves must not be compensated while probing, the caller turns it back on
+    setAdjustFunction(false);
+    if(!findBed()) return false;
+
+    float xo= std::get<X_AXIS>(this->probe_offsets);
+    float yo= std::get<Y_AXIS>(this->probe_offsets);
+    const int corners[3][2]= {{x_points - 1, 0}, {x_points - 1, y_points - 1}, {0, y_points - 1}};
+    for (auto& c : corners) {
+        int i= c[0], j= c[1];
+        float z = zprobe->probeDistance(i * x_size / (x_points - 1) - xo, j * y_size / (y_points - 1) - yo);
+        if(isnan(z)) return false;
+        z= zprobe->getProbeHeight() - z;
+        float g= grid[j * x_points + i];
+        stream->printf("Check %d,%d: %1.4f grid %1.4f\n", i, j, z, g);
+        if(fabsf(z - g) > this->tolerance) return false;
+    }
+    return true;
+}
+
+bool GridStrategy::saveGrid(StreamOutput *stream)
+{
+    FILE *fp= fopen(this->grid_file.c_str(), "w");
+    if(fp == NULL) {
+        stream->printf("Could not open %s to save the grid\n", this->grid_file.c_str());
+        return false;
+    }
+    GridFileHeader h;
+    memcpy(h.magic, "GRD", 3);
+    h.version= GRID_FILE_VERSION;
+    h.x_points= x_points;
+    h.y_points= y_points;
+    h.reserved= 0;
+    h.x_size= x_size;
+    h.y_size= y_size;
+    size_t n= x_points * y_points;
+    bool ok= fwrite(&h, sizeof(h), 1, fp) == 1 && fwrite(grid, sizeof(float), n, fp) == n;
+    fclose(fp);
+    if(!ok) stream->printf("Could not write the grid to %s\n", this->grid_file.c_str());
+    return ok;
+}
+
+// only a grid probed with the same layout as the config is loaded
+bool GridStrategy::loadGrid(StreamOutput *stream)
+{
+    if(this->grid == nullptr) {
+        stream->printf("No memory for the grid\n");
+        return false;
+    }
+    FILE *fp= fopen(this->grid_file.c_str(), "r");
+    if(fp == NULL) {
+        stream->printf("Could not open %s to load the grid\n", this->grid_file.c_str());
+        return false;
+    }
+    GridFileHeader h;
+    size_t n= x_points * y_points;
+    bool ok= fread(&h, sizeof(h), 1, fp) == 1;
+    if(ok && (memcmp(h.magic, "GRD", 3) != 0 || h.version != GRID_FILE_VERSION || h.x_points != x_points || h.y_points != y_points || h.x_size != x_size || h.y_size != y_size)) {
+        stream->printf("The grid in %s does not match the config\n", this->grid_file.c_str());
+        fclose(fp);
+        return false;
+    }
+    // the header is good, a short file after this leaves no grid
+    this->valid= false;
+    setAdjustFunction(false);
+    ok= ok && fread(grid, sizeof(float), n, fp) == n;
+    fclose(fp);
+    if(!ok) {
+        stream->printf("Could not read the grid from %s\n", this->grid_file.c_str());
+        return false;
+    }
+    this->valid= true;
+    return true;
+}
+
+void GridStrategy::printGrid(StreamOutput *stream)
+{
+    // last row first so it reads like the bed seen from above, Y away from you
+    for (int j = y_points - 1; j >= 0; --j) {
+        for (int i = 0; i < x_points; ++i) {
+            stream->printf("%8.4f ", grid[j * x_points + i]);
+        }
+        stream->printf("\n");
+    }
+}
+
+void GridStrategy::setAdjustFunction(bool on)
+{
+    if(on) {
+        // set the compensation in robot
+        THEKERNEL->robot->set_compensation(this);
+    }else{
+        // clear it
+        THEKERNEL->robot->set_compensation(nullptr);
+    }
+}
+
+void GridStrategy::compensate(float target[3])
+{
+    target[2] += getZOffset(target[0], target[1]);
+}
+
+// a plain loop, so the lookup is inlined rather than a virtual call for each point
+void GridStrategy::compensate_batch(float targets[], size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        float *t = &targets[i * 3];
+        t[2] += getZOffset(t[0], t[1]);
+    }
+}
+
+// bilinear interpolation between the four grid points around x, y, outside the grid the edge is carried on flat
+float GridStrategy::getZOffset(float x, float y)
+{
+    if(!this->valid) return NAN;
+
+    float fx= confine(x * x_scale, 0.0F, x_points - 1.0F);
+    float fy= confine(y * y_scale, 0.0F, y_points - 1.0F);
+    int ix= std::min((int)fx, x_points - 2);
+    int iy= std::min((int)fy, y_points - 2);
+    float tx= fx - ix;
+    float ty= fy - iy;
+
+    const float *p= &grid[iy * x_points + ix];
+    float z0= p[0] + (p[1] - p[0]) * tx;
+    float z1= p[x_points] + (p[x_points + 1] - p[x_points]) * tx;
+    return z0 + (z1 - z0) * ty;
+}
+
+// parse a "X,Y,Z" string return x,y,z tuple
+std::tuple<float, float, float> GridStrategy::parseXYZ(const char *str)
+{
+    float x = 0, y = 0, z= 0;
+    char *p;
+    x = strtof(str, &p);
+    if(p + 1 < str + strlen(str)) {
+        y = strtof(p + 1, &p);
+        if(p + 1 < str + strlen(str)) {
+            z = strtof(p + 1, nullptr);
+        }
+    }
+    return std::make_tuple(x, y, z);
+}
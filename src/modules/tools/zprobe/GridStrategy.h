@@ -0,0 +1,55 @@
+#ifndef _GRIDSTRATEGY
+#define _GRIDSTRATEGY
+
+#include "LevelingStrategy.h"
+#include "CompensationStrategy.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <string>
+#include <tuple>
+
+#define grid_leveling_strategy_checksum CHECKSUM("grid-leveling")
+
+class StreamOutput;
+
+class GridStrategy : public LevelingStrategy, public CompensationStrategy
+{
+public:
+    GridStrategy(ZProbe *zprobe);
+    ~GridStrategy();
+    bool handleGcode(Gcode* gcode);
+    bool handleConfig();
+    float getZOffset(float x, float y);
+    void compensate(float target[3]);
+    void compensate_batch(float targets[], size_t n);
+
+private:
+    void homeXY();
+    bool findBed();
+    bool doProbing(StreamOutput *stream);
+    bool spotCheck(StreamOutput *stream);
+    bool saveGrid(StreamOutput *stream);
+    bool loadGrid(StreamOutput *stream);
+    void printGrid(StreamOutput *stream);
+    std::tuple<float, float, float> parseXYZ(const char *str);
+    void setAdjustFunction(bool);
+
+    std::tuple<float, float, float> probe_offsets;
+    float x_size, y_size;
+    // grid points per mm, so a lookup needs no divide
+    float x_scale, y_scale;
+    uint8_t x_points, y_points;
+    // heights relative to the first point, x_points in a row, y_points rows, NAN until G32
+    float *grid;
+    std::string grid_file;
+    float tolerance; // how far a spot check may be off the grid before it is probed again
+    float sweep_clearance; // lift between points when sweeping, 0 to go back to the probe height each time
+    struct {
+        bool home:1;
+        bool valid:1;
+        bool save:1;
+    };
+};
+
+#endif
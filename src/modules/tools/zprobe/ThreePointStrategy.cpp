@@ -153,7 +153,7 @@ bool ThreePointStrategy::handleGcode(Gcode *gcode)
             delete this->plane;
             if(gcode->get_num_args() == 0) {
                 this->plane= nullptr;
-                // delete the compensationTransform in robot
+                // delete the compensation in robot
                 setAdjustFunction(false);
             }else{
                 // smoothie specific way to restire a saved plane
@@ -297,7 +297,7 @@ bool ThreePointStrategy::doProbing(StreamOutput *stream)
     if((mm.second - mm.first) <= this->tolerance) {
         this->plane= nullptr; // plane is flat no need to do anything
         stream->printf("DEBUG: flat plane\n");
-        // clear the compensationTransform in robot
+        // clear the compensation in robot
         setAdjustFunction(false);
 
     }else{
@@ -312,14 +312,29 @@ bool ThreePointStrategy::doProbing(StreamOutput *stream)
 void ThreePointStrategy::setAdjustFunction(bool on)
 {
     if(on) {
-        // set the compensationTransform in robot
-        THEKERNEL->robot->compensationTransform= [this](float target[3]) { target[2] += this->plane->getz(target[0], target[1]); };
+        // set the compensation in robot
+        THEKERNEL->robot->set_compensation(this);
     }else{
         // clear it
-        THEKERNEL->robot->compensationTransform= nullptr;
+        THEKERNEL->robot->set_compensation(nullptr);
     }
 }
 
+void ThreePointStrategy::compensate(float target[3])
+{
+    target[2] += this->plane->getz(target[0], target[1]);
+}
+
+// z on the plane is linear in x and y, so get the coefficients once instead of dividing by the normal for every point
+bool ThreePointStrategy::get_affine(float m[3][4])
+{
+    float c = this->plane->getz(0, 0);
+    m[2][0] = this->plane->getz(1, 0) - c;
+    m[2][1] = this->plane->getz(0, 1) - c;
+    m[2][3] = c;
+    return true;
+}
+
 // find the Z offset for the point on the plane at x, y
 float ThreePointStrategy::getZOffset(float x, float y)
 {
@@ -2,6 +2,7 @@
 #define _THREEPOINTSTRATEGY
 
 #include "LevelingStrategy.h"
+#include "CompensationStrategy.h"
 
 #include <string.h>
 #include <tuple>
@@ -11,7 +12,7 @@
 class StreamOutput;
 class Plane3D;
 
-class ThreePointStrategy : public LevelingStrategy
+class ThreePointStrategy : public LevelingStrategy, public CompensationStrategy
 {
 public:
     ThreePointStrategy(ZProbe *zprobe);
@@ -19,6 +20,8 @@ public:
     bool handleGcode(Gcode* gcode);
     bool handleConfig();
     float getZOffset(float x, float y);
+    void compensate(float target[3]);
+    bool get_affine(float m[3][4]);
 
 private:
     void homeXY();
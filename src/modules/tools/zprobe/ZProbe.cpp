@@ -26,14 +26,18 @@
 #include "PublicData.h"
 #include "LevelingStrategy.h"
 #include "StepTicker.h"
+#include "InterruptIn.h"
+#include "port_api.h"
 
 // strategies we know about
 #include "DeltaCalibrationStrategy.h"
 #include "ThreePointStrategy.h"
+#include "GridStrategy.h"
 
 #define enable_checksum          CHECKSUM("enable")
 #define probe_pin_checksum       CHECKSUM("probe_pin")
 #define debounce_count_checksum  CHECKSUM("debounce_count")
+#define use_interrupt_checksum   CHECKSUM("use_interrupt")
 #define slow_feedrate_checksum   CHECKSUM("slow_feedrate")
 #define fast_feedrate_checksum   CHECKSUM("fast_feedrate")
 #define probe_height_checksum    CHECKSUM("probe_height")
@@ -61,13 +65,19 @@ void ZProbe::on_module_loaded()
         return;
     }
     this->running = false;
+    this->probing = false;
+    this->triggered = false;
+    this->irq = nullptr;
 
     // load settings
     this->on_config_reload(this);
     // register event-handlers
-    register_for_event(ON_GCODE_RECEIVED);
+    register_for_gcodes('G', {29, 30, 31, 32});
+    // the strategies can handle any M code
+    register_for_event(ON_GCODE_RECEIVED, GCODE_FILTER_M);
 
-    THEKERNEL->step_ticker->register_acceleration_tick_handler([this](){acceleration_tick(); });
+    // only called while probing
+    this->acceleration_handler_id= THEKERNEL->step_ticker->register_acceleration_tick_handler<ZProbe, &ZProbe::acceleration_tick>(this, false);
 }
 
 void ZProbe::on_config_reload(void *argument)
@@ -75,6 +85,20 @@ void ZProbe::on_config_reload(void *argument)
     this->pin.from_string( THEKERNEL->config->value(zprobe_checksum, probe_pin_checksum)->by_default("nc" )->as_string())->as_input();
     this->debounce_count = THEKERNEL->config->value(zprobe_checksum, debounce_count_checksum)->by_default(0  )->as_number();
 
+    if(this->irq == nullptr && this->pin.connected() && THEKERNEL->config->value(zprobe_checksum, use_interrupt_checksum)->by_default(false)->as_bool()) {
+        if(this->pin.port_number == 0 || this->pin.port_number == 2) {
+            this->irq = new mbed::InterruptIn(port_pin((PortName)this->pin.port_number, this->pin.pin));
+            if(this->pin.inverting) this->irq->fall(this, &ZProbe::on_probe_edge);
+            else this->irq->rise(this, &ZProbe::on_probe_edge);
+            // InterruptIn makes it a plain input, put the pull up or down from the config back
+            this->pin.from_string( THEKERNEL->config->value(zprobe_checksum, probe_pin_checksum)->by_default("nc" )->as_string())->as_input();
+            // same priority as the step timer, so the positions are never latched in the middle of a step
+            NVIC_SetPriority(EINT3_IRQn, 2);
+        } else {
+            THEKERNEL->streams->printf("ZProbe pin is not on P0 or P2, it will be polled\n");
+        }
+    }
+
     // get strategies to load
     vector<uint16_t> modules;
     THEKERNEL->config->get_module_list( &modules, leveling_strategy_checksum);
@@ -94,11 +118,13 @@ void ZProbe::on_config_reload(void *argument)
                     found= true;
                     break;
 
+                case grid_leveling_strategy_checksum:
+                    // NOTE this strategy is mutually exclusive with the other leveling strategies
+                    this->strategies.push_back(new GridStrategy(this));
+                    found= true;
+                    break;
+
                 // add other strategies here
-                //case zheight_map_strategy:
-                //     this->strategies.push_back(new ZHeightMapStrategy(this));
-                //     found= true;
-                //     break;
             }
             if(found) this->strategies.back()->handleConfig();
         }
@@ -122,8 +148,46 @@ void ZProbe::on_config_reload(void *argument)
     this->max_z         = THEKERNEL->config->value(gamma_max_checksum)->by_default(500)->as_number(); // maximum zprobe distance
 }
 
+// Called from the GPIO interrupt, latches where each actuator was, the acceleration tick then slows them to a stop
+void ZProbe::on_probe_edge()
+{
+    if(!this->probing || this->triggered) return;
+    for ( int c = X_AXIS; c <= Z_AXIS; c++ ) {
+        this->trigger_steps[c] = this->stop_steps[c] = STEPPER[c]->get_stepped();
+    }
+    this->triggered = true;
+}
+
+// the interrupt version of wait_for_probe(), the probe is left where it triggered
+bool ZProbe::wait_for_probe_edge(int& steps)
+{
+    while(true) {
+        THEKERNEL->call_event(ON_IDLE);
+        bool moving = STEPPER[Z_AXIS]->is_moving() || (is_delta && (STEPPER[X_AXIS]->is_moving() || STEPPER[Y_AXIS]->is_moving()));
+        if(!moving) break;
+    }
+    this->probing = false;
+    if(!this->triggered) return false;
+
+    // still triggered once it has stopped, or it was a glitch
+    bool hit = this->pin.get();
+    this->triggered = false;
+    steps = this->trigger_steps[Z_AXIS];
+
+    // go back up the distance it took to stop, the steps were only counted to the trigger
+    for ( int c = (is_delta ? X_AXIS : Z_AXIS); c <= Z_AXIS; c++ ) {
+        STEPPER[c]->move(false, this->stop_steps[c] - this->trigger_steps[c], 0);
+    }
+    while(STEPPER[Z_AXIS]->is_moving() || (is_delta && (STEPPER[X_AXIS]->is_moving() || STEPPER[Y_AXIS]->is_moving())) ) {
+        THEKERNEL->call_event(ON_IDLE);
+    }
+    return hit;
+}
+
 bool ZProbe::wait_for_probe(int& steps)
 {
+    if(this->irq != nullptr) return wait_for_probe_edge(steps);
+
     unsigned int debounce = 0;
     while(true) {
         THEKERNEL->call_event(ON_IDLE);
@@ -182,10 +246,15 @@ bool ZProbe::run_probe(int& steps, bool fast)
     }
 
     // start acceration processing
+    this->triggered = false;
+    this->probing = true;
     this->running = true;
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, true);
 
     bool r = wait_for_probe(steps);
+    this->probing = false;
     this->running = false;
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, false);
     return r;
 }
 
@@ -205,12 +274,14 @@ bool ZProbe::return_probe(int steps)
     }
 
     this->running = true;
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, true);
     while(STEPPER[Z_AXIS]->is_moving() || (is_delta && (STEPPER[X_AXIS]->is_moving() || STEPPER[Y_AXIS]->is_moving())) ) {
         // wait for it to complete
         THEKERNEL->call_event(ON_IDLE);
     }
 
     this->running = false;
+    THEKERNEL->step_ticker->enable_acceleration_tick_handler(this->acceleration_handler_id, false);
 
     return true;
 }
@@ -236,6 +307,25 @@ float ZProbe::probeDistance(float x, float y)
     return zsteps_to_mm(s);
 }
 
+// probe at x,y from the height the probe is at, then only lift clearance before the next point instead of going back up
+// returns the Z where it triggered, or NAN if it failed or the bed came up to the probe
+float ZProbe::sweepProbeAt(float x, float y, float clearance)
+{
+    coordinated_move(x, y, NAN, getFastFeedrate());
+    if(this->pin.get()) return NAN;
+
+    int s;
+    if(!run_probe(s)) return NAN;
+
+    // the probe moved the actuators directly, so the robot has to be told where they are now
+    THEKERNEL->robot->reset_position_from_current_actuator_position();
+    float pos[3];
+    THEKERNEL->robot->get_axis_position(pos);
+
+    coordinated_move(NAN, NAN, clearance, getFastFeedrate(), true);
+    return pos[Z_AXIS];
+}
+
 void ZProbe::on_gcode_received(void *argument)
 {
     Gcode *gcode = static_cast<Gcode *>(argument);
@@ -323,9 +413,19 @@ void ZProbe::accelerate(int c)
 
     // Z may have a different acceleration to X and Y
     float acc= (c==Z_AXIS) ? THEKERNEL->planner->get_z_acceleration() : THEKERNEL->planner->get_acceleration();
+    uint32_t rate_change = floorf((acc / THEKERNEL->acceleration_ticks_per_second) * STEPS_PER_MM(c));
+    if( this->triggered ) {
+        // slow down rather than stopping dead, so no steps are lost even when probing fast
+        if( current_rate <= rate_change ) {
+            this->stop_steps[c] = STEPPER[c]->get_stepped();
+            STEPPER[c]->move(0, 0);
+        } else {
+            STEPPER[c]->set_speed(current_rate - rate_change);
+        }
+        return;
+    }
     if( current_rate < target_rate ) {
-        uint32_t rate_increase = floorf((acc / THEKERNEL->acceleration_ticks_per_second) * STEPS_PER_MM(c));
-        current_rate = min( target_rate, current_rate + rate_increase );
+        current_rate = min( target_rate, current_rate + rate_change );
     }
     if( current_rate > target_rate ) {
         current_rate = target_rate;
@@ -19,6 +19,9 @@
 
 class StepperMotor;
 class Gcode;
+namespace mbed {
+    class InterruptIn;
+}
 class StreamOutput;
 class LevelingStrategy;
 
@@ -36,6 +39,7 @@ public:
     bool return_probe(int steps);
     bool doProbeAt(int &steps, float x, float y);
     float probeDistance(float x, float y);
+    float sweepProbeAt(float x, float y, float clearance);
 
     void coordinated_move(float x, float y, float z, float feedrate, bool relative=false);
     void home();
@@ -48,17 +52,27 @@ public:
 
 private:
     void accelerate(int c);
+    void on_probe_edge();
+    bool wait_for_probe_edge(int& steps);
 
     volatile float current_feedrate;
     float slow_feedrate;
     float fast_feedrate;
     float probe_height;
     float max_z;
+    int acceleration_handler_id;
     volatile struct {
         volatile bool running:1;
         bool is_delta:1;
+        volatile bool probing:1;
     };
 
+    // with a probe on P0 or P2 the edge interrupt latches the actuator positions, then the move slows to a stop
+    mbed::InterruptIn *irq;
+    volatile bool triggered;
+    volatile uint32_t trigger_steps[3];
+    volatile uint32_t stop_steps[3];
+
     Pin pin;
     uint8_t debounce_count;
     std::vector<LevelingStrategy*> strategies;
@@ -36,7 +36,7 @@ void PlayLed::on_module_loaded()
 
     on_config_reload(this);
     this->register_for_event(ON_HALT);
-    THEKERNEL->slow_ticker->attach(12, this, &PlayLed::led_tick);
+    THEKERNEL->slow_ticker->attach<PlayLed, &PlayLed::led_tick>(12, this);
 }
 
 void PlayLed::on_config_reload(void *argument)
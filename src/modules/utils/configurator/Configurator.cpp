@@ -19,12 +19,25 @@
 #include "FileConfigSource.h"
 #include "ConfigValue.h"
 #include "ConfigCache.h"
+#include "OutputJob.h"
 
 #define CONF_NONE       0
 #define CONF_ROM        1
 #define CONF_SD         2
 #define CONF_EEPROM     3
 
+// config-load dump, a value a piece
+class ConfigDumpJob : public OutputJob {
+    public:
+        ConfigDumpJob(ConfigCache *cache) : cache(cache), pos(0) {}
+        ~ConfigDumpJob() { delete cache; }
+        bool write_next(StreamOutput *stream) { return cache->dump(stream, pos); }
+
+    private:
+        ConfigCache *cache;
+        size_t pos;
+};
+
 void Configurator::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
@@ -94,24 +107,36 @@ void Configurator::config_get_command( string parameters, StreamOutput *stream )
     }
 }
 
-// Write the specified setting to the specified ConfigSource
+// Write the specified settings to the specified ConfigSource, several setting value pairs go in one pass through the file
 void Configurator::config_set_command( string parameters, StreamOutput *stream )
 {
     string source = shift_parameter(parameters);
-    string setting = shift_parameter(parameters);
-    string value = shift_parameter(parameters);
-    if(source.empty() || setting.empty() || value.empty()) {
-        stream->printf( "Usage: config-set source setting value # where source is sd, setting is the key and value is the new value\r\n" );
+    vector<pair<string, string> > settings;
+    while(!parameters.empty()) {
+        string setting = shift_parameter(parameters);
+        string value = shift_parameter(parameters);
+        if(value.empty()) {
+            settings.clear();
+            break;
+        }
+        settings.push_back(make_pair(setting, value));
+    }
+    if(source.empty() || settings.empty()) {
+        stream->printf( "Usage: config-set source setting value [setting value ...] # where source is sd, setting is the key and value is the new value\r\n" );
         return;
     }
 
     uint16_t source_checksum = get_checksum(source);
     for(unsigned int i = 0; i < THEKERNEL->config->config_sources.size(); i++) {
         if( THEKERNEL->config->config_sources[i]->is_named(source_checksum) ) {
-            if(THEKERNEL->config->config_sources[i]->write(setting, value)) {
-                stream->printf( "%s: %s has been set to %s\r\n", source.c_str(), setting.c_str(), value.c_str() );
-            } else {
-                stream->printf( "%s: %s not enough space to overwrite existing key/value\r\n", source.c_str(), setting.c_str() );
+            vector<bool> written;
+            THEKERNEL->config->config_sources[i]->write(settings, written);
+            for (size_t j = 0; j < settings.size(); j++) {
+                if(written[j]) {
+                    stream->printf( "%s: %s has been set to %s\r\n", source.c_str(), settings[j].first.c_str(), settings[j].second.c_str() );
+                } else {
+                    stream->printf( "%s: %s not enough space to overwrite existing key/value\r\n", source.c_str(), settings[j].first.c_str() );
+                }
             }
             return;
         }
@@ -145,9 +170,11 @@ void Configurator::config_load_command( string parameters, StreamOutput *stream
         stream->printf( "config cache unloaded\r\n" );
 
     } else if(source == "dump") {
+        // the job has the cache to itself and deletes it when it is done
         THEKERNEL->config->config_cache_load();
-        THEKERNEL->config->config_cache->dump(stream);
-        THEKERNEL->config->config_cache_clear();
+        ConfigCache *cache = THEKERNEL->config->config_cache;
+        THEKERNEL->config->config_cache = NULL;
+        OutputJob::start(new ConfigDumpJob(cache), stream);
 
     } else if(source == "checksum") {
         string key = shift_parameter(parameters);
@@ -1,3 +1,6 @@
+// ahead of the headers that bring in sLPC17xx.h, which has no __get_PRIMASK for gcc
+#include "LPC17xx.h"
+
 #include "CurrentControl.h"
 #include "libs/Kernel.h"
 #include "libs/nuts_bolts.h"
@@ -9,6 +12,8 @@
 #include "Config.h"
 #include "checksumm.h"
 #include "DigipotBase.h"
+#include "Block.h"
+#include "Conveyor.h"
 
 // add new digipot chips here
 #include "mcp4451.h"
@@ -29,6 +34,9 @@ using namespace std;
 #define digipotchip_checksum                    CHECKSUM("digipotchip")
 #define digipot_max_current                     CHECKSUM("digipot_max_current")
 #define digipot_factor                          CHECKSUM("digipot_factor")
+#define currentcontrol_cruise_factor_checksum   CHECKSUM("currentcontrol_cruise_factor")
+#define currentcontrol_accel_factor_checksum    CHECKSUM("currentcontrol_accel_factor")
+#define currentcontrol_idle_factor_checksum     CHECKSUM("currentcontrol_idle_factor")
 
 #define mcp4451_checksum                        CHECKSUM("mcp4451")
 #define ad5206_checksum                         CHECKSUM("ad5206")
@@ -36,6 +44,8 @@ using namespace std;
 CurrentControl::CurrentControl()
 {
     digipot = NULL;
+    level = applied_level = LEVEL_CRUISE;
+    reapply = false;
 }
 
 void CurrentControl::on_module_loaded()
@@ -63,17 +73,70 @@ void CurrentControl::on_module_loaded()
     digipot->set_factor( THEKERNEL->config->value(digipot_factor )->by_default(113.33f)->as_number());
 
     // Get configuration
-    this->digipot->set_current(0, THEKERNEL->config->value(alpha_current_checksum  )->by_default(0.8f)->as_number());
-    this->digipot->set_current(1, THEKERNEL->config->value(beta_current_checksum   )->by_default(0.8f)->as_number());
-    this->digipot->set_current(2, THEKERNEL->config->value(gamma_current_checksum  )->by_default(0.8f)->as_number());
-    this->digipot->set_current(3, THEKERNEL->config->value(delta_current_checksum  )->by_default(0.8f)->as_number());
-    this->digipot->set_current(4, THEKERNEL->config->value(epsilon_current_checksum)->by_default(-1)->as_number());
-    this->digipot->set_current(5, THEKERNEL->config->value(zeta_current_checksum   )->by_default(-1)->as_number());
-    this->digipot->set_current(6, THEKERNEL->config->value(eta_current_checksum    )->by_default(-1)->as_number());
-    this->digipot->set_current(7, THEKERNEL->config->value(theta_current_checksum  )->by_default(-1)->as_number());
+    this->currents[0] = THEKERNEL->config->value(alpha_current_checksum  )->by_default(0.8f)->as_number();
+    this->currents[1] = THEKERNEL->config->value(beta_current_checksum   )->by_default(0.8f)->as_number();
+    this->currents[2] = THEKERNEL->config->value(gamma_current_checksum  )->by_default(0.8f)->as_number();
+    this->currents[3] = THEKERNEL->config->value(delta_current_checksum  )->by_default(0.8f)->as_number();
+    this->currents[4] = THEKERNEL->config->value(epsilon_current_checksum)->by_default(-1)->as_number();
+    this->currents[5] = THEKERNEL->config->value(zeta_current_checksum   )->by_default(-1)->as_number();
+    this->currents[6] = THEKERNEL->config->value(eta_current_checksum    )->by_default(-1)->as_number();
+    this->currents[7] = THEKERNEL->config->value(theta_current_checksum  )->by_default(-1)->as_number();
+
+    // the actuators can run cooler while cruising or stopped, and harder while the speed is changing
+    this->factors[LEVEL_CRUISE] = THEKERNEL->config->value(currentcontrol_cruise_factor_checksum)->by_default(1.0f)->as_number();
+    this->factors[LEVEL_ACCEL]  = THEKERNEL->config->value(currentcontrol_accel_factor_checksum )->by_default(1.0f)->as_number();
+    this->factors[LEVEL_IDLE]   = THEKERNEL->config->value(currentcontrol_idle_factor_checksum  )->by_default(1.0f)->as_number();
+
+    // stopped until the first block
+    this->level = LEVEL_IDLE;
+    apply();
+
+    this->register_for_gcodes('M', {907, 500, 503});
+    if(factors[LEVEL_CRUISE] != 1.0f || factors[LEVEL_ACCEL] != 1.0f || factors[LEVEL_IDLE] != 1.0f) {
+        this->register_for_event(ON_BLOCK_BEGIN);
+        this->register_for_event(ON_BLOCK_END);
+        this->register_for_event(ON_IDLE);
+    }
+}
 
+// Sets every channel for the current level, called from the block interrupts as well as the main loop, so with them
+// off, and as they were again after, the caller may already have them off. A digipot that queues its writes returns
+// at once, one that is still busy is given them again once it is done
+void CurrentControl::apply()
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint8_t l = this->level;
+    for (int i = 0; i < 8; i++) {
+        float c = this->currents[i];
+        if(i < 3 && c > 0) c *= this->factors[l];
+        this->digipot->set_current(i, c);
+    }
+    this->applied_level = l;
+    this->reapply = this->digipot->is_busy();
+    __set_PRIMASK(primask);
+}
 
-    this->register_for_event(ON_GCODE_RECEIVED);
+// a block that has a ramp in it gets the acceleration current for all of it, one that only cruises the cruise current
+void CurrentControl::on_block_begin(void *argument)
+{
+    Block *block = static_cast<Block *>(argument);
+    uint8_t l = (block->accelerate_until > 0 || block->decelerate_after < block->steps_event_count) ? LEVEL_ACCEL : LEVEL_CRUISE;
+    this->level = l;
+    if(l != this->applied_level && !this->digipot->is_busy()) apply();
+}
+
+void CurrentControl::on_block_end(void *argument)
+{
+    if(THEKERNEL->conveyor->has_next_block()) return;
+    this->level = LEVEL_IDLE;
+    if(!this->digipot->is_busy()) apply();
+}
+
+// anything the block interrupts could not send because the digipot was busy goes once it is free
+void CurrentControl::on_idle(void *argument)
+{
+    if((this->level != this->applied_level || this->reapply) && !this->digipot->is_busy()) apply();
 }
 
 
@@ -85,15 +148,15 @@ void CurrentControl::on_gcode_received(void *argument)
         if (gcode->m == 907) {
             for (int i = 0; i < 8; i++) {
                 if (gcode->has_letter(alpha[i])) {
-                    float c = gcode->get_value(alpha[i]);
-                    this->digipot->set_current(i, c);
+                    this->currents[i] = gcode->get_value(alpha[i]);
                 }
             }
+            apply();
 
         } else if(gcode->m == 500 || gcode->m == 503) {
             gcode->stream->printf(";Motor currents:\nM907 ");
             for (int i = 0; i < 8; i++) {
-                float c = this->digipot->get_current(i);
+                float c = this->digipot->get_current(i) < 0 ? -1 : this->currents[i];
                 if(c >= 0)
                     gcode->stream->printf("%c%1.5f ", alpha[i], c);
             }
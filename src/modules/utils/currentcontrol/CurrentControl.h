@@ -12,9 +12,21 @@ class CurrentControl : public Module {
 
         void on_module_loaded();
         void on_gcode_received(void *);
+        void on_block_begin(void *);
+        void on_block_end(void *);
+        void on_idle(void *);
 
     private:
+        enum LEVEL { LEVEL_CRUISE, LEVEL_ACCEL, LEVEL_IDLE };
+        void apply();
+
         DigipotBase* digipot;
+        // what the config or M907 set, the actuator channels get these times the factor for the level
+        float currents[8];
+        float factors[3];
+        volatile uint8_t level;
+        uint8_t applied_level;
+        volatile bool reapply;
 
 };
 
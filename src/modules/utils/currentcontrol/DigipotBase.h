@@ -8,6 +8,8 @@ class DigipotBase {
 
         virtual void set_current( int channel, float current )= 0;
         virtual float get_current(int channel)= 0;
+        // true while a current that was set is still being sent to the chip
+        virtual bool is_busy() { return false; }
         void set_max_current(float c) { max_current= c; }
         void set_factor(float f) { factor= f; }
 
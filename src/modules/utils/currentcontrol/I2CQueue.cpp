@@ -0,0 +1,94 @@
+#include "I2CQueue.h"
+
+#include "libs/LPC17xx/sLPC17xx.h"
+
+#include <string.h>
+
+// I2CONSET and I2CONCLR bits
+#define I2C_STA 0x20
+#define I2C_STO 0x10
+#define I2C_SI  0x08
+
+static I2CQueue *i2c1_queue = nullptr;
+
+I2CQueue::I2CQueue()
+{
+    head = tail = sent = 0;
+    busy = false;
+    errors = 0;
+    i2c1_queue = this;
+    // below everything that might queue a transfer
+    NVIC_SetPriority(I2C1_IRQn, 5);
+    NVIC_EnableIRQ(I2C1_IRQn);
+}
+
+bool I2CQueue::write(uint8_t address, const uint8_t *data, uint8_t len)
+{
+    if(len > max_data) return false;
+
+    __disable_irq();
+    uint8_t h = head;
+    uint8_t n = (h + 1) % size;
+    if(n == tail) {
+        __enable_irq();
+        return false;
+    }
+    queue[h].address = address & ~1;
+    queue[h].len = len;
+    memcpy(queue[h].data, data, len);
+    head = n;
+    if(!busy) {
+        busy = true;
+        sent = 0;
+        LPC_I2C1->I2CONSET = I2C_STA;
+    }
+    __enable_irq();
+    return true;
+}
+
+// the transfer at tail is done, a stop goes out and then the start of the next one if there is one
+void I2CQueue::next()
+{
+    tail = (tail + 1) % size;
+    sent = 0;
+    if(tail == head) {
+        busy = false;
+        LPC_I2C1->I2CONSET = I2C_STO;
+    } else {
+        LPC_I2C1->I2CONSET = I2C_STO | I2C_STA;
+    }
+}
+
+void I2CQueue::on_interrupt()
+{
+    Transfer &t = queue[tail];
+    switch(LPC_I2C1->I2STAT) {
+        case 0x08: // start, or repeated start, sent
+        case 0x10:
+            LPC_I2C1->I2DAT = t.address;
+            LPC_I2C1->I2CONCLR = I2C_STA;
+            break;
+
+        case 0x18: // address or data acked
+        case 0x28:
+            if(sent < t.len) LPC_I2C1->I2DAT = t.data[sent++];
+            else next();
+            break;
+
+        case 0x38: // lost the bus to another master, try again when it is free
+            LPC_I2C1->I2CONSET = I2C_STA;
+            break;
+
+        default: // not acked, or a bus error
+            errors++;
+            next();
+            break;
+    }
+    LPC_I2C1->I2CONCLR = I2C_SI;
+}
+
+extern "C" void I2C1_IRQHandler(void)
+{
+    if(i2c1_queue != nullptr) i2c1_queue->on_interrupt();
+    else LPC_I2C1->I2CONCLR = I2C_SI;
+}
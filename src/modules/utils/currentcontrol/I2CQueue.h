@@ -0,0 +1,40 @@
+#ifndef I2CQUEUE_H
+#define I2CQUEUE_H
+
+#include <stdint.h>
+
+/*
+ * Writes to devices on I2C1 from its interrupt, so nothing has to wait for a transfer at the slow speeds the digipots
+ * run at. Transfers are queued and go out one after another, one a device does not ack is given up and counted.
+ * The bus has to have been set up first, an mbed::I2C on the pins with the frequency set does that.
+ */
+class I2CQueue {
+    public:
+        I2CQueue();
+
+        // address is the 8 bit form, as in mbed::I2C. false if there is no room for it
+        bool write(uint8_t address, const uint8_t *data, uint8_t len);
+        bool is_idle() const { return !busy; }
+        uint32_t get_errors() const { return errors; }
+
+        void on_interrupt();
+
+        static const int max_data = 3;
+        static const int size = 16;
+
+    private:
+        struct Transfer {
+            uint8_t address;
+            uint8_t len;
+            uint8_t data[max_data];
+        };
+        void next();
+
+        Transfer queue[size];
+        volatile uint8_t head, tail;
+        volatile uint8_t sent;      // bytes of the transfer at tail that have gone
+        volatile bool busy;
+        volatile uint32_t errors;
+};
+
+#endif
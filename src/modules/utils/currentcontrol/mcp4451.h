@@ -5,6 +5,7 @@
 #include "I2C.h" // mbed.h lib
 #include "libs/utils.h"
 #include "DigipotBase.h"
+#include "I2CQueue.h"
 #include <string>
 #include <math.h>
 
@@ -14,7 +15,13 @@ class MCP4451 : public DigipotBase {
             // I2C com
             this->i2c = new mbed::I2C(p9, p10);
             this->i2c->frequency(20000);
-            for (int i = 0; i < 8; i++) currents[i] = -1;
+            // the writes go out from the I2C interrupt, at this speed one takes a couple of ms
+            this->queue = new I2CQueue();
+            for (int i = 0; i < 8; i++) {
+                currents[i] = -1;
+                wipers[i] = -1;
+            }
+            setup_done[0] = setup_done[1] = false;
         }
 
         ~MCP4451(){
@@ -29,19 +36,24 @@ class MCP4451 : public DigipotBase {
             }
             current = min( (float) max( current, 0.0f ), this->max_current );
             currents[channel] = current;
-            char addr = 0x58;
-            while(channel > 3){
-                addr += 0x02;
-                channel -= 4;
-            }
 
-            // Initial setup
-            this->i2c_send( addr, 0x40, 0xff );
-            this->i2c_send( addr, 0xA0, 0xff );
+            // nothing to send if the wiper stays where it is
+            int wiper = this->current_to_wiper(current);
+            if(wiper == wipers[channel]) return;
+            wipers[channel] = wiper;
+
+            int chip = channel / 4;
+            char addr = 0x58 + chip * 0x02;
+            channel %= 4;
 
-            // Set actual wiper value
+            // Initial setup, once for each chip
+            if(!setup_done[chip]) {
+                setup_done[chip] = this->i2c_send( addr, 0x40, 0xff ) && this->i2c_send( addr, 0xA0, 0xff );
+            }
+
+            // Set actual wiper value, if the queue is full it is sent the next time this is called
             char addresses[4] = { 0x00, 0x10, 0x60, 0x70 };
-            this->i2c_send( addr, addresses[channel], this->current_to_wiper(current) );
+            if(!this->i2c_send( addr, addresses[channel], wiper )) wipers[channel] = -1;
         }
 
         float get_current(int channel)
@@ -49,14 +61,14 @@ class MCP4451 : public DigipotBase {
             return currents[channel];
         }
 
+        bool is_busy() { return !queue->is_idle(); }
+
     private:
 
-        void i2c_send( char first, char second, char third ){
-            this->i2c->start();
-            this->i2c->write(first);
-            this->i2c->write(second);
-            this->i2c->write(third);
-            this->i2c->stop();
+        // this can be called from an interrupt the I2C one can't preempt, so it never waits for room
+        bool i2c_send( char first, char second, char third ){
+            uint8_t data[2] = { (uint8_t)second, (uint8_t)third };
+            return this->queue->write(first, data, 2);
         }
 
         char current_to_wiper( float current ){
@@ -64,7 +76,10 @@ class MCP4451 : public DigipotBase {
         }
 
         mbed::I2C* i2c;
+        I2CQueue* queue;
         float currents[8];
+        int16_t wipers[8];          // what was last sent, -1 for nothing yet
+        bool setup_done[2];
 };
 
 
@@ -3,14 +3,11 @@
 #include "libs/Kernel.h"
 #include "libs/utils.h"
 #include "libs/Pin.h"
-#include "libs/Hook.h"
 
 Button::Button()
 {
     this->counter = 0;
     this->value = false;
-    this->up_hook = NULL;
-    this->down_hook = NULL;
     this->button_pin = NULL;
     this->repeat = false;
     this->first_timer = 0;
@@ -50,15 +47,15 @@ void Button::check_signal(int val)
 
     if ( start_value != this->value ) {
         if ( this->value ) {
-            if ( this->up_hook != NULL ) {
-                this->up_hook->call();
+            if ( this->up_hook ) {
+                this->up_hook(0);
                 this->first_timer = 0;
                 this->second_timer = 0;
                 this->repeat = false;
             }
         } else {
-            if ( this->down_hook != NULL ) {
-                this->down_hook->call();
+            if ( this->down_hook ) {
+                this->down_hook(0);
             }
         }
     }
@@ -68,7 +65,7 @@ void Button::check_signal(int val)
             if(this->repeat) {
                 this->second_timer++;
                 if(this->second_timer == 10) {
-                    this->up_hook->call();
+                    this->up_hook(0);
                     this->second_timer = 0;
                 }
             } else {
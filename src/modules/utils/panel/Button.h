@@ -1,7 +1,8 @@
 #ifndef BUTTON_H
 #define BUTTON_H
 
-#include "libs/Hook.h"
+#include "libs/Callback.h"
+#include <stdint.h>
 
 class Pin;
 
@@ -18,23 +19,21 @@ public:
     bool get();
 
 
-    template<typename T> Button *up_attach( T *optr, uint32_t ( T::*fptr )( uint32_t ) )
+    template<typename T, uint32_t ( T::*fptr )( uint32_t )> Button *up_attach( T *optr )
     {
-        this->up_hook = new Hook();
-        this->up_hook->attach(optr, fptr);
+        this->up_hook = Callback<uint32_t(uint32_t)>::bind<T, fptr>(optr);
         return this;
     }
 
-    template<typename T> Button *down_attach( T *optr, uint32_t ( T::*fptr )( uint32_t ) )
+    template<typename T, uint32_t ( T::*fptr )( uint32_t )> Button *down_attach( T *optr )
     {
-        this->down_hook = new Hook();
-        this->down_hook->attach(optr, fptr);
+        this->down_hook = Callback<uint32_t(uint32_t)>::bind<T, fptr>(optr);
         return this;
     }
 
 private:
-    Hook *up_hook;
-    Hook *down_hook;
+    Callback<uint32_t(uint32_t)> up_hook;
+    Callback<uint32_t(uint32_t)> down_hook;
     bool value;
     char counter;
     Pin *button_pin;
@@ -19,6 +19,8 @@
 #include "screens/CustomScreen.h"
 #include "screens/MainMenuScreen.h"
 #include "SlowTicker.h"
+#include "PinEvents.h"
+#include "Conveyor.h"
 #include "Gcode.h"
 #include "Pauser.h"
 #include "TemperatureControlPublicAccess.h"
@@ -78,6 +80,7 @@ Panel::Panel()
     this->do_buttons = false;
     this->do_encoder = false;
     this->idle_time = 0;
+    this->refresh_waits = 0;
     this->start_up = true;
     this->current_screen = NULL;
     this->sd= nullptr;
@@ -161,11 +164,11 @@ void Panel::on_module_loaded()
     default_bed_temperature    = THEKERNEL->config->value( panel_checksum, bed_temp_checksum    )->by_default(60.0f  )->as_number();
 
 
-    this->up_button.up_attach(    this, &Panel::on_up );
-    this->down_button.up_attach(  this, &Panel::on_down );
-    this->click_button.up_attach( this, &Panel::on_select );
-    this->back_button.up_attach(  this, &Panel::on_back );
-    this->pause_button.up_attach( this, &Panel::on_pause );
+    this->up_button.up_attach<Panel, &Panel::on_up>(this);
+    this->down_button.up_attach<Panel, &Panel::on_down>(this);
+    this->click_button.up_attach<Panel, &Panel::on_select>(this);
+    this->back_button.up_attach<Panel, &Panel::on_back>(this);
+    this->pause_button.up_attach<Panel, &Panel::on_pause>(this);
 
 
     //setting longpress_delay
@@ -177,23 +180,29 @@ void Panel::on_module_loaded()
 //    this->pause_button.set_longpress_delay(longpress_delay);
 
 
-    THEKERNEL->slow_ticker->attach( 50,  this, &Panel::button_tick );
+    THEKERNEL->slow_ticker->attach<Panel, &Panel::button_tick>(50, this);
     if(lcd->encoderReturnsDelta()) {
         // panel handles encoder pins and returns a delta
-        THEKERNEL->slow_ticker->attach( 10, this, &Panel::encoder_tick );
+        THEKERNEL->slow_ticker->attach<Panel, &Panel::encoder_tick>(10, this);
     }else{
-        // read encoder pins
-        THEKERNEL->slow_ticker->attach( 1000, this, &Panel::encoder_check );
+        // read encoder pins on each of their edges if they can interrupt, otherwise often enough not to miss one
+        Pin *a = lcd->encoderPin(0), *b = lcd->encoderPin(1);
+        if(a != nullptr && b != nullptr && PinEvents::can_interrupt(a) && PinEvents::can_interrupt(b)) {
+            PinEvents::instance()->attach(a, 0, this, &Panel::encoder_check);
+            PinEvents::instance()->attach(b, 0, this, &Panel::encoder_check);
+        }else{
+            THEKERNEL->slow_ticker->attach<Panel, &Panel::encoder_check>(1000, this);
+        }
     }
 
     // Register for events
     this->register_for_event(ON_IDLE);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_main_loop(MAIN_LOOP_HOUSEKEEPING, "panel");
+    this->register_for_gcodes('M', {117});
     this->register_for_event(ON_HALT);
 
     // Refresh timer
-    THEKERNEL->slow_ticker->attach( 20, this, &Panel::refresh_tick );
+    THEKERNEL->slow_ticker->attach<Panel, &Panel::refresh_tick>(20, this);
 }
 
 // Enter a screen, we only care about it now
@@ -218,6 +227,7 @@ void Panel::reset_counter()
 // called 20 times a second
 uint32_t Panel::refresh_tick(uint32_t dummy)
 {
+    if (this->refresh_flag && this->refresh_waits < 255) this->refresh_waits++;
     this->refresh_flag = true;
     this->idle_time++;
     return 0;
@@ -382,9 +392,12 @@ void Panel::on_idle(void *argument)
         this->control_value_update();
     }
 
-    // If we must refresh
+    // If we must refresh, unless the queue is running low and the time is better spent filling it, a refresh takes
+    // several ms on the slower lcds
+    if ( this->refresh_flag && this->refresh_waits < 20 && THEKERNEL->conveyor->is_running_low() ) return;
     if ( this->refresh_flag ) {
         this->refresh_flag = false;
+        this->refresh_waits = 0;
         if (this->current_screen != NULL) {
             this->current_screen->on_refresh();
             this->lcd->on_refresh();
@@ -136,6 +136,8 @@ class Panel : public Module {
         uint16_t menu_current_line;
         char playing_file[20];
         uint8_t extsd_spi_channel;
+        // refresh ticks a refresh has been held back for, it is done anyway after a second
+        volatile uint8_t refresh_waits;
 
         volatile struct {
             bool start_up:1;
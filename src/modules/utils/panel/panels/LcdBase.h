@@ -20,6 +20,7 @@
 #define LED_HOT       4
 
 class Panel;
+class Pin;
 
 class LcdBase {
     public:
@@ -54,6 +55,7 @@ class LcdBase {
         virtual void buzz(long,uint16_t){};
         virtual bool hasGraphics() { return false; }
         virtual bool encoderReturnsDelta() { return false; } // set to true if the panel handles encoder clicks and returns a delta
+        virtual Pin *encoderPin(int n) { return nullptr; } // the A (0) and B (1) pins readEncoderDelta reads, if it reads pins
         virtual uint8_t getContrast() { return 0; }
         virtual void setContrast(uint8_t c) { }
 
@@ -23,6 +23,7 @@ class ReprapDiscountGLCD : public LcdBase {
 
         uint8_t readButtons();
         int readEncoderDelta();
+        Pin *encoderPin(int n) { return n == 0 ? &encoder_a_pin : &encoder_b_pin; }
         void write(const char* line, int len);
         void home();
         void clear();
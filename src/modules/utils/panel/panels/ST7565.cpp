@@ -148,6 +148,8 @@ ST7565::ST7565(uint8_t variant)
     if(framebuffer == NULL) {
         THEKERNEL->streams->printf("Not enough memory available for frame buffer");
     }
+    shown = (uint8_t *)AHB0.alloc(FB_SIZE);
+    full_refresh = true;
 
 }
 
@@ -155,6 +157,7 @@ ST7565::~ST7565()
 {
     delete this->spi;
     AHB0.dealloc(framebuffer);
+    if(shown != NULL) AHB0.dealloc(shown);
 }
 
 //send commands to lcd
@@ -247,6 +250,7 @@ void ST7565::init()
     if(this->rst.connected()) rst.set(1);
     send_commands(init_seq, sizeof(init_seq));
     clear();
+    full_refresh = true;
 }
 
 void ST7565::setContrast(uint8_t c)
@@ -312,7 +316,26 @@ void ST7565::on_refresh(bool now)
     refresh_counts++;
     // 10Hz refresh rate
     if(now || refresh_counts % 2 == 0 ) {
-        send_pic(framebuffer);
+        if(shown == NULL || full_refresh) {
+            send_pic(framebuffer);
+            if(shown != NULL) memcpy(shown, framebuffer, FB_SIZE);
+            full_refresh = false;
+            return;
+        }
+
+        // send each page from its first to its last changed column, most refreshes only change a few digits
+        for (int i = 0; i < LCDPAGES; i++) {
+            const unsigned char *f = framebuffer + i * LCDWIDTH;
+            unsigned char *s = shown + i * LCDWIDTH;
+            int first = 0, last = LCDWIDTH - 1;
+            while(first < LCDWIDTH && f[first] == s[first]) first++;
+            if(first == LCDWIDTH) continue;
+            while(f[last] == s[last]) last--;
+
+            set_xy(first, i);
+            send_data(f + first, last - first + 1);
+            memcpy(s + first, f + first, last - first + 1);
+        }
     }
 }
 
@@ -28,6 +28,7 @@ public:
 	//encoder which dosent exist :/
 	uint8_t readButtons();
 	int readEncoderDelta();
+	Pin *encoderPin(int n) { return n == 0 ? &encoder_a_pin : &encoder_b_pin; }
 	int getEncoderResolution() { return is_viki2 ? 4 : 2; }
 	uint16_t get_screen_lines() { return 8; }
 	bool hasGraphics() { return true; }
@@ -58,6 +59,8 @@ private:
 
     //buffer
 	unsigned char *framebuffer;
+	// what the panel is showing, so a refresh only sends the columns that changed, NULL to always send it all
+	unsigned char *shown;
 	mbed::SPI* spi;
 	Pin cs;
 	Pin rst;
@@ -81,6 +84,7 @@ private:
         bool is_mini_viki2:1;
         bool use_pause:1;
         bool use_back:1;
+        bool full_refresh:1;
     };
 };
 
@@ -166,13 +166,16 @@ RrdGlcd::RrdGlcd(int spi_channel, Pin cs) {
     if(fb == NULL) {
         THEKERNEL->streams->printf("Not enough memory available for frame buffer");
     }
+    shown= (uint8_t *)AHB0.alloc(FB_SIZE);
     inited= false;
     dirty= false;
+    full_refresh= true;
 }
 
 RrdGlcd::~RrdGlcd() {
     delete this->spi;
     AHB0.dealloc(fb);
+    if(shown != NULL) AHB0.dealloc(shown);
 }
 
 void RrdGlcd::setFrequency(int freq) {
@@ -201,6 +204,7 @@ void RrdGlcd::initDisplay() {
     ST7920_WRITE_BYTE(0x0C); //display on, cursor+blink off
     ST7920_NCS();
     inited= true;
+    full_refresh= true;
 }
 
 void RrdGlcd::clearScreen() {
@@ -317,8 +321,39 @@ void RrdGlcd::fillGDRAM(const uint8_t *bitmap) {
     }
 }
 
+// send each line from its first to its last changed 16 bit word, each byte costs two on the serial protocol
+void RrdGlcd::fillChanged() {
+    ST7920_CS();
+    for (int y = 0; y < HEIGHT; y++) {
+        const uint8_t *f= &fb[y*16];
+        uint8_t *s= &shown[y*16];
+        int first= 0, last= 15;
+        while(first < 16 && f[first] == s[first]) first++;
+        if(first == 16) continue;
+        while(f[last] == s[last]) last--;
+        first &= ~1;
+        last |= 1;
+
+        // the bottom half of the screen is addressed as the right half of the top one
+        ST7920_SET_CMD();
+        ST7920_WRITE_BYTE(0x80 | (y % PAGE_HEIGHT));
+        ST7920_WRITE_BYTE(0x80 | (y / PAGE_HEIGHT) * 0x08 | first / 2);
+        ST7920_SET_DAT();
+        const uint8_t *p= f + first;
+        ST7920_WRITE_BYTES(p, last - first + 1);
+        memcpy(s + first, f + first, last - first + 1);
+    }
+    ST7920_NCS();
+}
+
 void RrdGlcd::refresh() {
     if(!inited || !dirty) return;
-    fillGDRAM(this->fb);
+    if(shown == NULL || full_refresh) {
+        fillGDRAM(this->fb);
+        if(shown != NULL) memcpy(shown, this->fb, FB_SIZE);
+        full_refresh= false;
+    } else {
+        fillChanged();
+    }
     dirty= false;
 }
@@ -57,9 +57,14 @@ private:
     void renderChar(uint8_t *fb, char c, int ox, int oy);
     void displayChar(int row, int column,char inpChr);
 
+    void fillChanged();
+
     uint8_t *fb;
+    // what the display is showing, so a refresh only sends the words that changed, NULL to always send it all
+    uint8_t *shown;
     bool inited;
     bool dirty;
+    bool full_refresh;
 };
 #endif
 
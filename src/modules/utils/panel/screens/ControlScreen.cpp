@@ -138,9 +138,14 @@ void ControlScreen::get_current_pos(float *cp)
 
 void ControlScreen::set_current_pos(char axis, float p)
 {
-    // change pos by issuing a G0 Xnnn
-    char buf[32];
-    int n = snprintf(buf, sizeof(buf), "G0 %c%f F%d", axis, p, (int)round(THEPANEL->get_jogging_speed(axis)));
+    // jog on to pos with M414 from where the moves already queued end, so turning the knob keeps it moving rather
+    // than stopping at the end of each move
+    float cp[3];
+    get_current_pos(cp);
+    float d = p - cp[axis - 'X'];
+    if (fabsf(d) < 0.0001F) return;
+    char buf[48];
+    int n = snprintf(buf, sizeof(buf), "M414 %c%d D%f F%d", axis, d > 0 ? 1 : -1, fabsf(d), (int)round(THEPANEL->get_jogging_speed(axis)));
     string g(buf, n);
     send_gcode(g);
 }
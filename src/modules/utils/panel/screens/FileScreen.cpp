@@ -17,13 +17,24 @@
 #include "libs/SerialMessage.h"
 #include "StreamOutput.h"
 #include "DirHandle.h"
+#include "platform_memory.h"
 #include "mri.h"
 
+#include <algorithm>
+#include <string.h>
+#include <strings.h>
+
 using std::string;
 
+#define ENTRY_IS_DIR 0x8000
+#define ENTRY_OFFSET 0x7FFF
+
 FileScreen::FileScreen()
 {
     this->start_play = false;
+    this->names = NULL;
+    this->entries = NULL;
+    this->entry_count = 0;
 }
 
 // When entering this screen
@@ -39,6 +50,7 @@ void FileScreen::on_exit()
 {
     // reset to root directory, I think this is less confusing
     THEKERNEL->current_path= "/";
+    this->free_folder();
 }
 
 // For every ( potential ) refresh of the screen
@@ -59,7 +71,7 @@ void FileScreen::enter_folder(const char *folder)
     THEKERNEL->current_path= folder;
 
     // We need the number of lines to setup the menu
-    uint16_t number_of_files_in_folder = this->count_folder_content();
+    uint16_t number_of_files_in_folder = this->read_folder();
 
     // Setup menu
     THEPANEL->setup_menu(number_of_files_in_folder + 1); // same number of files as menu items
@@ -126,42 +138,74 @@ bool FileScreen::filter_file(const char *f)
 // Find the "line"th file in the current folder
 string FileScreen::file_at(uint16_t line, bool& isdir)
 {
-    DIR *d;
-    struct dirent *p;
-    uint16_t count = 0;
-    d = opendir(THEKERNEL->current_path.c_str());
-    if (d != NULL) {
-        while ((p = readdir(d)) != NULL) {
-            // only filter files that have a .g in them and directories
-            if((p->d_isdir || filter_file(p->d_name)) && count++ == line ) {
-                isdir= p->d_isdir;
-                string fn= p->d_name;
-                closedir(d);
-                return fn;
-            }
-        }
+    if(line >= this->entry_count) {
+        isdir= false;
+        return "";
     }
-
-    if (d != NULL) closedir(d);
-    isdir= false;
-    return "";
+    isdir= (this->entries[line] & ENTRY_IS_DIR) != 0;
+    return this->names + (this->entries[line] & ENTRY_OFFSET);
 }
 
-// Count how many files there are in the current folder that have a .g in them
-uint16_t FileScreen::count_folder_content()
+// Read the folders and the files that have a .g in them from the current folder, so the menu lines don't have to
+// scan the folder again each. One pass sizes the listing and the second fills it, returns how many there are
+uint16_t FileScreen::read_folder()
 {
+    this->free_folder();
+
     DIR *d;
     struct dirent *p;
-    uint16_t count = 0;
+    size_t count = 0, size = 0;
+    d = opendir(THEKERNEL->current_path.c_str());
+    if (d == NULL) return 0;
+    while ((p = readdir(d)) != NULL) {
+        if(!(p->d_isdir || filter_file(p->d_name))) continue;
+        size_t n = strlen(p->d_name) + 1;
+        if(size + n > ENTRY_OFFSET || count == 0xFFFF) break; // only as much as the offsets can hold
+        size += n;
+        count++;
+    }
+    closedir(d);
+    if(count == 0) return 0;
+
+    this->names = placed_alloc<char>(size, PLACE_AHB);
+    this->entries = placed_alloc<uint16_t>(count, PLACE_AHB);
+    if(this->names == NULL || this->entries == NULL) {
+        this->free_folder();
+        return 0;
+    }
+
+    // the folder may have changed in between, so keep to what was sized
+    size_t used = 0, n_entries = 0;
     d = opendir(THEKERNEL->current_path.c_str());
     if (d != NULL) {
-        while ((p = readdir(d)) != NULL) {
-            if(p->d_isdir || filter_file(p->d_name)) count++;
+        while (n_entries < count && (p = readdir(d)) != NULL) {
+            if(!(p->d_isdir || filter_file(p->d_name))) continue;
+            size_t n = strlen(p->d_name) + 1;
+            if(used + n > size) break;
+            memcpy(this->names + used, p->d_name, n);
+            this->entries[n_entries++] = used | (p->d_isdir ? ENTRY_IS_DIR : 0);
+            used += n;
         }
         closedir(d);
-        return count;
     }
-    return 0;
+    this->entry_count = n_entries;
+
+    const char *names = this->names;
+    std::sort(this->entries, this->entries + n_entries, [names](uint16_t a, uint16_t b) {
+        if((a & ENTRY_IS_DIR) != (b & ENTRY_IS_DIR)) return (a & ENTRY_IS_DIR) != 0;
+        return strcasecmp(names + (a & ENTRY_OFFSET), names + (b & ENTRY_OFFSET)) < 0;
+    });
+
+    return this->entry_count;
+}
+
+void FileScreen::free_folder()
+{
+    if(this->names != NULL) placed_free(this->names);
+    if(this->entries != NULL) placed_free(this->entries);
+    this->names = NULL;
+    this->entries = NULL;
+    this->entry_count = 0;
 }
 
 void FileScreen::on_main_loop()
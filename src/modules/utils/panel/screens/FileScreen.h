@@ -24,12 +24,17 @@ class FileScreen : public PanelScreen {
 
     private:
         void enter_folder(const char *folder);
-        uint16_t count_folder_content();
+        uint16_t read_folder();
+        void free_folder();
         std::string file_at(uint16_t line, bool& isdir);
         bool filter_file(const char *f);
         void play(const char *path);
 
         std::string play_path;
+        // the folder is read once on entry, sorted with folders first, names are NUL separated in names
+        char *names;
+        uint16_t *entries; // offset of each name, the top bit is set for a folder
+        uint16_t entry_count;
         bool start_play;
 };
 
@@ -13,16 +13,12 @@
 #include "WatchScreen.h"
 #include "libs/nuts_bolts.h"
 #include "libs/utils.h"
-#include "modules/tools/temperaturecontrol/TemperatureControlPublicAccess.h"
-#include "modules/robot/RobotPublicAccess.h"
 #include "modules/robot/Conveyor.h"
-#include "modules/utils/player/PlayerPublicAccess.h"
-#include "NetworkPublicAccess.h"
-#include "PublicData.h"
-#include "SwitchPublicAccess.h"
+#include "MachineStatus.h"
 #include "checksumm.h"
 #include "Pauser.h"
 #include "TemperatureControlPool.h"
+#include "LoopMonitor.h"
 
 
 #include <math.h>
@@ -128,12 +124,11 @@ void WatchScreen::on_refresh()
         uint8_t heon=0, hemsk= 0x01; // bit set for which hotend is on bit0: hotend1, bit1: hotend2 etc
         for(auto m : THEKERNEL->temperature_control_pool->get_controllers()) {
             // query each heater
-            void *p= getTemperatures(m);
-            struct pad_temperature *temp= static_cast<struct pad_temperature *>(p);
+            const MachineStatus::Heater *temp= THEKERNEL->status->find_heater(m);
             if(temp != nullptr) {
                 if(temp->current_temperature > 50) is_hot= true; // anything is hot
-                if(temp->designator.front() == 'B' && temp->target_temperature > 0) bed_on= true;   // bed on/off
-                if(temp->designator.front() == 'T') { // a hotend by convention
+                if(temp->designator[0] == 'B' && temp->target_temperature > 0) bed_on= true;   // bed on/off
+                if(temp->designator[0] == 'T') { // a hotend by convention
                     if(temp->target_temperature > 0){
                         hotend_on= true;// hotend on/off (anyone)
                         heon |= hemsk;
@@ -177,74 +172,39 @@ void WatchScreen::on_main_loop()
     PanelScreen::on_main_loop(); // in case any queued commands left
 }
 
-void *WatchScreen::getTemperatures(uint16_t heater_cs)
-{
-    void *returned_data;
-    bool ok = PublicData::get_value( temperature_control_checksum, heater_cs, current_temperature_checksum, &returned_data );
-
-    if (ok) {
-        return returned_data;
-    }
-
-    return nullptr;
-}
-
-// fetch the data we are displaying
+// fetch the data we are displaying, all of it is kept up to date in the kernel's status by the modules it comes from
 void WatchScreen::get_current_status()
 {
-    void *returned_data;
-    bool ok;
-
-    // get fan status
-    ok = PublicData::get_value( switch_checksum, fan_checksum, 0, &returned_data );
-    if (ok) {
-        struct pad_switch s = *static_cast<struct pad_switch *>(returned_data);
-        this->fan_state = s.state;
-    } else {
-        // fan probably disabled
-        this->fan_state = false;
-    }
+    // false if there is no fan switch
+    this->fan_state = THEKERNEL->status->fan_on;
 }
 
-// fetch the data we are displaying
 float WatchScreen::get_current_speed()
 {
-    void *returned_data;
-
-    bool ok = PublicData::get_value( robot_checksum, speed_override_percent_checksum, &returned_data );
-    if (ok) {
-        float cs = *static_cast<float *>(returned_data);
-        return cs;
-    }
-    return 0.0;
+    return THEKERNEL->status->speed_override;
 }
 
 void WatchScreen::get_current_pos(float *cp)
 {
-    void *returned_data;
-
-    bool ok = PublicData::get_value( robot_checksum, current_position_checksum, &returned_data );
-    if (ok) {
-        float *p = static_cast<float *>(returned_data);
-        cp[0] = p[0];
-        cp[1] = p[1];
-        cp[2] = p[2];
-    }
+    const float *p = THEKERNEL->status->position;
+    cp[0] = p[0];
+    cp[1] = p[1];
+    cp[2] = p[2];
 }
 
 void WatchScreen::get_sd_play_info()
 {
-    void *returned_data;
-    bool ok = PublicData::get_value( player_checksum, get_progress_checksum, &returned_data );
-    if (ok) {
-        struct pad_progress p =  *static_cast<struct pad_progress *>(returned_data);
-        this->elapsed_time = p.elapsed_secs;
-        this->sd_pcnt_played = p.percent_complete;
-        THEPANEL->set_playing_file(p.filename);
+    const MachineStatus *status = THEKERNEL->status;
+    if (status->playing_file != nullptr) {
+        this->elapsed_time = status->elapsed_secs;
+        this->sd_pcnt_played = status->percent_complete;
+        this->remaining_time = status->remaining_secs;
+        THEPANEL->set_playing_file(*status->playing_file);
 
     } else {
         this->elapsed_time = 0;
         this->sd_pcnt_played = 0;
+        this->remaining_time = 0;
     }
 }
 
@@ -269,12 +229,12 @@ void WatchScreen::display_menu_line(uint16_t line)
                 for (size_t i = 0; i < 2; ++i) {
                     size_t o= i+(n*2);
                     if(o>tm.size()-1) break;
-                    struct pad_temperature *temp= static_cast<struct pad_temperature *>(getTemperatures(tm[o]));
+                    const MachineStatus::Heater *temp= THEKERNEL->status->find_heater(tm[o]);
                     if(temp == nullptr) continue;
                     int t= std::min(999, (int)roundf(temp->current_temperature));
                     int tt= roundf(temp->target_temperature);
                     THEPANEL->lcd->setCursor(off, 0); // col, row
-                    off += THEPANEL->lcd->printf("%s:%03d/%03d ", temp->designator.substr(0, 2).c_str(), t, tt);
+                    off += THEPANEL->lcd->printf("%.2s:%03d/%03d ", temp->designator, t, tt);
                 }
 
             }else{
@@ -283,7 +243,13 @@ void WatchScreen::display_menu_line(uint16_t line)
             break;
         }
         case 1: THEPANEL->lcd->printf("X%4d Y%4d Z%7.2f", (int)round(this->pos[0]), (int)round(this->pos[1]), this->pos[2]); break;
-        case 2: THEPANEL->lcd->printf("%3d%% %2lu:%02lu %3u%% sd", this->current_speed, this->elapsed_time / 60, this->elapsed_time % 60, this->sd_pcnt_played); break;
+        case 2:
+            // every other 5 seconds show the time left instead of the time taken, once there is an estimate
+            if(this->remaining_time > 0 && (update_counts / 100) % 2 == 1)
+                THEPANEL->lcd->printf("%3d%% %2lu:%02lu %3u%% left", this->current_speed, this->remaining_time / 60, this->remaining_time % 60, this->sd_pcnt_played);
+            else
+                THEPANEL->lcd->printf("%3d%% %2lu:%02lu %3u%% sd", this->current_speed, this->elapsed_time / 60, this->elapsed_time % 60, this->sd_pcnt_played);
+            break;
         case 3: THEPANEL->lcd->printf("%19s", this->get_status()); break;
     }
 }
@@ -302,6 +268,14 @@ const char *WatchScreen::get_status()
     if (THEPANEL->is_suspended())
         return "Suspended";
 
+    // every other 5 seconds show how busy the cpu is
+    if ((update_counts / 100) % 2 == 1) {
+        const LoopMonitor *lm = THEKERNEL->loop_monitor;
+        if (lm->get_isr_load() >= 0) snprintf(cpustr, sizeof(cpustr), "CPU %d%% isr %d%%", lm->get_cpu_load(), lm->get_isr_load());
+        else snprintf(cpustr, sizeof(cpustr), "CPU %d%%", lm->get_cpu_load());
+        return cpustr;
+    }
+
     if (THEPANEL->is_playing())
         return THEPANEL->get_playing_file();
 
@@ -323,11 +297,8 @@ void WatchScreen::set_speed()
 
 const char *WatchScreen::get_network()
 {
-    void *returned_data;
-
-    bool ok = PublicData::get_value( network_checksum, get_ip_checksum, &returned_data );
-    if (ok) {
-        uint8_t *ipaddr = (uint8_t *)returned_data;
+    const uint8_t *ipaddr = THEKERNEL->status->ip;
+    if (ipaddr != nullptr) {
         char buf[20];
         int n = snprintf(buf, sizeof(buf), "IP %d.%d.%d.%d", ipaddr[0], ipaddr[1], ipaddr[2], ipaddr[3]);
         buf[n] = 0;
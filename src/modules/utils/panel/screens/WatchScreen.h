@@ -30,14 +30,15 @@ private:
     void get_sd_play_info();
     const char *get_status();
     const char *get_network();
-    void *getTemperatures(uint16_t heater_cs);
 
     uint32_t update_counts;
     int current_speed;
     float pos[3];
     unsigned long elapsed_time;
     unsigned int sd_pcnt_played;
+    unsigned long remaining_time;
     char *ipstr;
+    char cpustr[20];
 
     struct {
         bool speed_changed:1;
@@ -3,7 +3,7 @@
 #include "libs/nuts_bolts.h"
 #include "libs/utils.h"
 #include "Config.h"
-#include "SlowTicker.h"
+#include "PinEvents.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "Pauser.h"
@@ -20,7 +20,6 @@ using namespace std;
 
 PauseButton::PauseButton()
 {
-    this->button_state = true;
     this->killed = false;
     this->do_kill= false;
 }
@@ -43,9 +42,15 @@ void PauseButton::on_module_loaded()
 
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
 
-    if( (this->pause_enable && this->pause_button.connected()) || (this->kill_enable && this->kill_button.connected()) ) {
-        THEKERNEL->slow_ticker->attach( 10, this, &PauseButton::button_tick );
+    if(this->pause_enable && this->pause_button.connected()) {
+        PinEvents::instance()->attach(&this->pause_button, PinEvents::default_debounce_ms, this, &PauseButton::on_pause_change);
+    }
+
+    if(this->kill_enable && this->kill_button.connected()) {
+        PinEvents::instance()->attach(&this->kill_button, PinEvents::default_debounce_ms, this, &PauseButton::on_kill_change);
         this->register_for_event(ON_IDLE);
+        // held down as we boot
+        if(!this->kill_button.get()) on_kill_change(0);
     }
 }
 
@@ -58,28 +63,24 @@ void PauseButton::on_idle(void *argument)
     }
 }
 
-//TODO: Make this use InterruptIn
-//Check the state of the button and act accordingly based on current pause state
+// Called by PinEvents when a button has settled in a new state, act on it based on the current pause state
 // Note this is ISR so don't do anything nasty in here
-uint32_t PauseButton::button_tick(uint32_t dummy)
+uint32_t PauseButton::on_pause_change(uint32_t state)
 {
-    // If pause button changed
-    if(this->pause_enable && this->pause_button.connected()) {
-        bool newstate = this->pause_button.get();
-        if(this->button_state != newstate) {
-            this->button_state = newstate;
-            // If button pressed
-            if( this->button_state ) {
-                if( THEKERNEL->pauser->paused() ) {
-                    THEKERNEL->pauser->release();
-                } else {
-                    THEKERNEL->pauser->take();
-                }
-            }
+    // If button pressed
+    if( state ) {
+        if( THEKERNEL->pauser->paused() ) {
+            THEKERNEL->pauser->release();
+        } else {
+            THEKERNEL->pauser->take();
         }
     }
+    return 0;
+}
 
-    if(!this->killed && this->kill_enable && this->kill_button.connected() && !this->kill_button.get()) {
+uint32_t PauseButton::on_kill_change(uint32_t state)
+{
+    if(!this->killed && !state) {
         this->killed = true;
         // we can't call this in ISR, and we need to block on_main_loop so do it in on_idle
         // THEKERNEL->call_event(ON_HALT);
@@ -96,6 +97,8 @@ void PauseButton::on_console_line_received( void *argument )
 
     if(this->killed && new_message.message == "M999") {
         this->killed= false;
+        // still held down, it kills again
+        if(this->kill_enable && this->kill_button.connected() && !this->kill_button.get()) on_kill_change(0);
         return;
     }
 
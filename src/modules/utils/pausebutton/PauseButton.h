@@ -10,7 +10,8 @@ class PauseButton : public Module {
         void on_module_loaded();
         void on_console_line_received( void *argument );
         void on_idle(void *argument);
-        uint32_t button_tick(uint32_t dummy);
+        uint32_t on_pause_change(uint32_t state);
+        uint32_t on_kill_change(uint32_t state);
 
     private:
         Pin pause_button;
@@ -18,7 +19,6 @@ class PauseButton : public Module {
         struct {
             bool pause_enable:1;
             bool kill_enable:1;
-            bool button_state:1;
             bool killed:1;
             volatile bool do_kill:1;
         };
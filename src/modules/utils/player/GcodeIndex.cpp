@@ -0,0 +1,164 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GcodeIndex.h"
+
+#include "LineReader.h"
+#include "libs/Kernel.h"
+#include "libs/StreamOutput.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+/*
+ * The index file is text, a header then one entry per line
+ *
+ *   size <file size> every <lines>
+ *   <L or N> <layer or line> <line> <offset> <z> <e> <flags>
+ *
+ * flags is 1 for relative E and 2 for relative moves. The layers are counted from 1 in the order they are found.
+ */
+
+// the extruder follows G90/G91 as well as M82/M83, as Extruder does
+void GcodeIndex::State::feed(const char *l, int len)
+{
+    line++;
+    offset += len;
+
+    while(*l == ' ' || *l == '\t') l++;
+    if(*l == 'M') {
+        int m = atoi(l + 1);
+        if(m == 82) relative_e = false;
+        else if(m == 83) relative_e = true;
+        return;
+    }
+    if(*l != 'G') return;
+
+    char *end;
+    long g = strtol(l + 1, &end, 10);
+    if(g == 90 || g == 91) {
+        relative = relative_e = (g == 91);
+        return;
+    }
+    if(g != 0 && g != 1 && g != 2 && g != 3 && g != 92) return;
+
+    for(const char *c = end; *c != '\0' && *c != ';' && *c != '('; c++) {
+        if(*c != 'E' && *c != 'Z') continue;
+        float v = strtof(c + 1, &end);
+        if(end == c + 1) continue;
+        if(*c == 'E') e = (relative_e && g != 92) ? e + v : v;
+        else z = (relative && g != 92) ? z + v : v;
+        c = end - 1;
+    }
+}
+
+bool GcodeIndex::is_layer_comment(const char *line)
+{
+    while(*line == ' ' || *line == '\t') line++;
+    if(*line++ != ';') return false;
+    while(*line == ' ') line++;
+    if(strncasecmp(line, "layer", 5) != 0) return false;
+    line += 5;
+    if(*line == ':') return isdigit(line[1]);
+    if(*line == ' ') return isdigit(line[1]);
+    return strncasecmp(line, "_change", 7) == 0;
+}
+
+bool GcodeIndex::build(const std::string& fn, unsigned long file_size, LineReader& reader, unsigned long every, StreamOutput *stream)
+{
+    FILE *fd = fopen(fn.c_str(), "r");
+    if(fd == NULL) return false;
+    FILE *out = fopen((fn + ".idx").c_str(), "w");
+    if(out == NULL) {
+        fclose(fd);
+        return false;
+    }
+
+    setvbuf(fd, NULL, _IONBF, 0);
+    reader.start(fd);
+    fprintf(out, "size %lu every %lu\n", file_size, every);
+
+    stream->printf("Indexing %s\r\n", fn.c_str());
+    State s;
+    unsigned long layers = 0;
+    char *l;
+    int len;
+    bool too_long;
+    while((l = reader.next_line(len, too_long)) != NULL) {
+        int flags = (s.relative_e ? 1 : 0) | (s.relative ? 2 : 0);
+        if(every > 0 && s.line % every == 0)
+            fprintf(out, "N %lu %lu %lu %1.3f %1.5f %d\n", s.line + 1, s.line + 1, s.offset, s.z, s.e, flags);
+        if(!too_long && is_layer_comment(l))
+            fprintf(out, "L %lu %lu %lu %1.3f %1.5f %d\n", ++layers, s.line + 1, s.offset, s.z, s.e, flags);
+
+        if(too_long) {
+            s.line++;
+            s.offset += len;
+        } else {
+            s.feed(l, len);
+        }
+
+        // a big file takes a while, keep the rest of the machine going
+        if((s.line & 0xFF) == 0) THEKERNEL->call_event(ON_IDLE);
+    }
+    fclose(fd);
+    bool ok = fclose(out) == 0;
+    stream->printf("Indexed %lu lines, %lu layers\r\n", s.line, layers);
+    return ok;
+}
+
+// kind is L for a layer, N for a line or O for an offset, which looks through the N entries
+bool GcodeIndex::find(const std::string& fn, unsigned long file_size, char kind, unsigned long key, State& s)
+{
+    FILE *fd = fopen((fn + ".idx").c_str(), "r");
+    if(fd == NULL) return false;
+
+    unsigned long size, every;
+    bool found = false;
+    if(fscanf(fd, "size %lu every %lu", &size, &every) == 2 && size == file_size) {
+        char k;
+        unsigned long n, line, offset;
+        float z, e;
+        int flags;
+        while(fscanf(fd, " %c %lu %lu %lu %f %f %d", &k, &n, &line, &offset, &z, &e, &flags) == 7) {
+            if(k != (kind == 'O' ? 'N' : kind)) continue;
+            if(kind == 'L' ? n != key : (kind == 'O' ? offset : n) > key) {
+                if(kind == 'L') continue;
+                break;
+            }
+            // State::line is the lines before this one
+            s.line = line - 1;
+            s.offset = offset;
+            s.z = z;
+            s.e = e;
+            s.relative_e = (flags & 1) != 0;
+            s.relative = (flags & 2) != 0;
+            found = true;
+            if(kind == 'L') break;
+        }
+    }
+    fclose(fd);
+    return found;
+}
+
+bool GcodeIndex::find_line(const std::string& fn, unsigned long file_size, unsigned long line, State& s)
+{
+    return find(fn, file_size, 'N', line, s);
+}
+
+bool GcodeIndex::find_offset(const std::string& fn, unsigned long file_size, unsigned long offset, State& s)
+{
+    return find(fn, file_size, 'O', offset, s);
+}
+
+bool GcodeIndex::find_layer(const std::string& fn, unsigned long file_size, unsigned long layer, State& s)
+{
+    return find(fn, file_size, 'L', layer, s);
+}
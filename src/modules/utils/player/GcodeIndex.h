@@ -0,0 +1,55 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GCODEINDEX_H
+#define GCODEINDEX_H
+
+#include <string>
+
+class LineReader;
+class StreamOutput;
+
+/*
+ * The byte offsets of the layer changes and of every Nth line of a gcode file, kept next to it as <file>.idx so
+ * playing can start part way into the file with one fseek.
+ *
+ * Layers are found from the comments slicers put at each layer change, ;LAYER:n, ;LAYER_CHANGE or ; layer n.
+ * Each entry also has the extruder state at that point, so the E axis can be set up before playing from it.
+ */
+class GcodeIndex {
+    public:
+        // what the file has set up by the start of a line
+        struct State {
+            State() : line(0), offset(0), z(0.0F), e(0.0F), relative_e(false), relative(false) {}
+            // the lines are what they are in the file, comments and all
+            void feed(const char *line, int len);
+
+            unsigned long line;         // counted from 1, as an editor shows them
+            unsigned long offset;
+            float z;
+            float e;                    // where the extruder is, when relative_e is false
+            bool relative_e;
+            bool relative;
+        };
+
+        // scans the whole file through reader, which is left at its end, and writes the index
+        static bool build(const std::string& fn, unsigned long file_size, LineReader& reader, unsigned long every, StreamOutput *stream);
+
+        // the last entry at or before line, or the start of layer, false if there isn't one or the index is for another file size
+        static bool find_line(const std::string& fn, unsigned long file_size, unsigned long line, State& s);
+        static bool find_layer(const std::string& fn, unsigned long file_size, unsigned long layer, State& s);
+        // the last entry at or before the byte offset
+        static bool find_offset(const std::string& fn, unsigned long file_size, unsigned long offset, State& s);
+
+        // true if this comment line starts a layer
+        static bool is_layer_comment(const char *line);
+
+    private:
+        static bool find(const std::string& fn, unsigned long file_size, char kind, unsigned long key, State& s);
+};
+
+#endif
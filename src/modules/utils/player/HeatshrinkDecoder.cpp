@@ -0,0 +1,104 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "HeatshrinkDecoder.h"
+
+#include "platform_memory.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+HeatshrinkDecoder::HeatshrinkDecoder(uint8_t window_bits, uint8_t lookahead_bits)
+{
+    this->window_bits = window_bits;
+    this->lookahead_bits = lookahead_bits;
+    window = nullptr;
+    in = nullptr;
+    fd = nullptr;
+    file_read = 0;
+    in_len = in_pos = 0;
+}
+
+bool HeatshrinkDecoder::start(FILE *fd)
+{
+    if(window == nullptr) {
+        // kept once allocated, like the line reader's buffer
+        size_t n = (1 << window_bits) + in_size;
+        window = (char *)AHB1.alloc(n);
+        if(window == nullptr) window = (char *)AHB0.alloc(n);
+        if(window == nullptr) window = (char *)malloc(n);
+        if(window == nullptr) return false;
+        in = (uint8_t *)window + (1 << window_bits);
+    }
+
+    // the encoder starts with a window of zeros too
+    memset(window, 0, 1 << window_bits);
+    this->fd = fd;
+    file_read = 0;
+    in_len = in_pos = 0;
+    bits = 0;
+    bit_count = 0;
+    head = 0;
+    copy_offset = copy_left = 0;
+    return true;
+}
+
+// -1 if the file ends first, which is where the padding of the last byte is dropped
+int HeatshrinkDecoder::get_bits(int count)
+{
+    while(bit_count < count) {
+        if(in_pos == in_len) {
+            in_len = fread(in, 1, in_size, fd);
+            in_pos = 0;
+            if(in_len <= 0) {
+                in_len = 0;
+                return -1;
+            }
+            file_read += in_len;
+        }
+        bits = (bits << 8) | in[in_pos++];
+        bit_count += 8;
+    }
+    bit_count -= count;
+    return (bits >> bit_count) & ((1 << count) - 1);
+}
+
+int HeatshrinkDecoder::read(char *out, int n)
+{
+    if(fd == nullptr || window == nullptr) return 0;
+
+    const uint16_t mask = (1 << window_bits) - 1;
+    int got = 0;
+    while(got < n) {
+        char c;
+        if(copy_left > 0) {
+            c = window[(head - copy_offset) & mask];
+            copy_left--;
+
+        } else {
+            int tag = get_bits(1);
+            if(tag < 0) break;
+            if(tag == 1) {
+                int v = get_bits(8);
+                if(v < 0) break;
+                c = v;
+
+            } else {
+                int index = get_bits(window_bits);
+                if(index < 0) break;
+                int count = get_bits(lookahead_bits);
+                if(count < 0) break;
+                copy_offset = index + 1;
+                copy_left = count + 1;
+                continue;
+            }
+        }
+        window[head++ & mask] = c;
+        out[got++] = c;
+    }
+    return got;
+}
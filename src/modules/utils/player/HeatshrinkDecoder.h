@@ -0,0 +1,50 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HEATSHRINKDECODER_H
+#define HEATSHRINKDECODER_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * Decompresses a file written by the heatshrink encoder (heatshrink -e -w <window> -l <lookahead>) as it is read.
+ *
+ * The stream is bits, most significant first, with no header: a 1 is followed by a literal byte, a 0 by an offset
+ * back into the last 2^window bytes output (window bits, less one) and a length (lookahead bits, less one) to copy
+ * from there. Both sizes have to match what the file was compressed with, the encoder's defaults are 11 and 4.
+ */
+class HeatshrinkDecoder {
+    public:
+        HeatshrinkDecoder(uint8_t window_bits, uint8_t lookahead_bits);
+
+        // false if there is no memory for the window
+        bool start(FILE *fd);
+        // up to n decompressed bytes, fewer only at the end of the file
+        int read(char *out, int n);
+        // bytes of the file read so far, less what is buffered
+        unsigned long consumed() const { return file_read - (in_len - in_pos); }
+
+    private:
+        static const int in_size = 1024;
+
+        int get_bits(int count);
+
+        char *window;
+        uint8_t *in;
+        FILE *fd;
+        unsigned long file_read;
+        uint32_t bits;              // the ones not used yet are the low bit_count
+        uint16_t head;              // where the next byte out goes in the window
+        uint16_t copy_offset;       // how far back the copy being output is from
+        uint16_t copy_left;         // bytes of it still to output
+        int16_t in_len, in_pos;
+        uint8_t bit_count;
+        uint8_t window_bits, lookahead_bits;
+};
+
+#endif
@@ -0,0 +1,100 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Journal.h"
+
+#include "platform_memory.h"
+
+#include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#define JOURNAL_MAGIC 0x4A524E4C
+
+static_assert(sizeof(Journal::Record) <= Journal::sector, "a journal record must fit in a sector");
+
+// each sector is a record followed by zeros, built in AHB SRAM rather than on the stack
+static uint8_t *sector_buffer()
+{
+    static uint8_t *buf = nullptr;
+    if(buf == nullptr) buf = (uint8_t *)AHB0.alloc(Journal::sector);
+    if(buf == nullptr) buf = (uint8_t *)malloc(Journal::sector);
+    return buf;
+}
+
+uint32_t Journal::checksum(const Record& r)
+{
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(&r);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < offsetof(Record, check); i++) sum = (sum << 1 | sum >> 31) ^ p[i];
+    return sum;
+}
+
+bool Journal::open(const char *fn)
+{
+    close();
+    Record r;
+    seq = read(fn, r) ? r.seq + 1 : 0;
+
+    fd = fopen(fn, "r+");
+    if(fd == nullptr) {
+        // both sectors are there from the start, so writing a checkpoint never grows the file
+        fd = fopen(fn, "w+");
+        if(fd == nullptr) return false;
+        memset(sector_buffer(), 0, sector);
+        if(fwrite(sector_buffer(), sector, 1, fd) != 1 || fwrite(sector_buffer(), sector, 1, fd) != 1) {
+            close();
+            return false;
+        }
+    }
+    setvbuf(fd, NULL, _IONBF, 0);
+    return true;
+}
+
+void Journal::close()
+{
+    if(fd != nullptr) {
+        fclose(fd);
+        fd = nullptr;
+    }
+}
+
+bool Journal::write(Record& r)
+{
+    if(fd == nullptr) return false;
+    r.magic = JOURNAL_MAGIC;
+    r.seq = seq++;
+    r.check = checksum(r);
+
+    uint8_t *buf = sector_buffer();
+    memset(buf, 0, sector);
+    memcpy(buf, &r, sizeof(r));
+    if(fseek(fd, (r.seq & 1) * sector, SEEK_SET) != 0) return false;
+    if(fwrite(buf, sector, 1, fd) != 1) return false;
+    return fflush(fd) == 0;
+}
+
+bool Journal::read(const char *fn, Record& r)
+{
+    FILE *f = fopen(fn, "r");
+    if(f == nullptr) return false;
+
+    bool found = false;
+    Record slot;
+    for (int i = 0; i < 2; i++) {
+        if(fread(sector_buffer(), sector, 1, f) != 1) break;
+        memcpy(&slot, sector_buffer(), sizeof(slot));
+        if(slot.magic != JOURNAL_MAGIC || slot.check != checksum(slot)) continue;
+        if(!found || slot.seq > r.seq) {
+            r = slot;
+            found = true;
+        }
+    }
+    fclose(f);
+    if(found) r.filename[sizeof(r.filename) - 1] = '\0';
+    return found;
+}
@@ -0,0 +1,62 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * Checkpoints of a file being played, for carrying on after a power loss.
+ *
+ * The journal file is two sectors, written in turn so a write cut off half way still leaves the one before it.
+ * Each checkpoint is one sector written in place, so the card only rewrites that sector and the directory entry.
+ */
+class Journal {
+    public:
+        static const int max_heaters = 4;
+        static const unsigned int sector = 512;
+
+        struct Record {
+            uint32_t magic;
+            uint32_t seq;
+            uint32_t file_size;
+            uint32_t offset;            // the line the last finished block came from
+            float position[3];
+            uint8_t fan_on;
+            uint8_t heater_count;
+            uint8_t finished;           // the file played to the end or was aborted, nothing to recover
+            uint8_t unused;
+            struct {
+                uint16_t id;
+                float target;
+            } heaters[max_heaters];
+            char filename[128];
+            uint32_t check;
+        };
+
+        Journal() : fd(nullptr), seq(0) {}
+        ~Journal() { close(); }
+
+        // makes the file if need be, false if it can't be written
+        bool open(const char *fn);
+        void close();
+        bool is_open() const { return fd != nullptr; }
+        bool write(Record& r);
+
+        // the newest whole record in the journal
+        static bool read(const char *fn, Record& r);
+
+    private:
+        static uint32_t checksum(const Record& r);
+
+        FILE *fd;
+        uint32_t seq;
+};
+
+#endif
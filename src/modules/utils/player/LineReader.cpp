@@ -0,0 +1,123 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LineReader.h"
+#include "HeatshrinkDecoder.h"
+
+#include "platform_memory.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+LineReader::LineReader()
+{
+    buffer = nullptr;
+    fd = nullptr;
+    decoder = nullptr;
+    pos = nullptr;
+    half_len[0] = half_len[1] = -1;
+    cur = 0;
+    eof = true;
+    discarding = false;
+}
+
+void LineReader::start(FILE *fd, HeatshrinkDecoder *decoder)
+{
+    if(buffer == nullptr) {
+        // kept once allocated, the extra byte terminates a last line that ends right at the end of half 1
+        size_t n = carry_size + 2 * half_size + 1;
+        buffer = (char *)AHB1.alloc(n);
+        if(buffer == nullptr) buffer = (char *)AHB0.alloc(n);
+        if(buffer == nullptr) buffer = (char *)malloc(n); // still works, just without the DMA
+    }
+
+    this->fd = fd;
+    this->decoder = decoder;
+    half_len[0] = half_len[1] = -1;
+    cur = 0;
+    pos = half_start(0);
+    // without a file there is nothing to read
+    eof = fd == nullptr;
+    discarding = false;
+}
+
+void LineReader::fill(int h)
+{
+    int n = decoder != nullptr ? decoder->read(half_start(h), half_size) : fread(half_start(h), 1, half_size, fd);
+    if(n < half_size) eof = true;
+    half_len[h] = n;
+}
+
+void LineReader::fill_ahead()
+{
+    if(!eof && half_len[cur ^ 1] < 0) fill(cur ^ 1);
+}
+
+char *LineReader::next_line(int &len, bool &too_long)
+{
+    if(fd == nullptr || buffer == nullptr) return nullptr;
+    if(half_len[cur] < 0) fill(cur);
+
+    too_long = false;
+    while(true) {
+        char *end = half_start(cur) + half_len[cur];
+        char *line = pos;
+        char *nl = (char *)memchr(pos, '\n', end - pos);
+
+        if(nl == nullptr) {
+            int other = cur ^ 1;
+            bool last = half_len[cur] < half_size;
+            if(!last) {
+                // fill_ahead() didn't get to it, so it has to be read now
+                if(half_len[other] < 0) fill(other);
+                last = (half_len[other] == 0);
+            }
+
+            if(last) {
+                // the file ended without a newline
+                pos = end;
+                if(line == end) return nullptr;
+                nl = end;
+
+            } else if(other == 1) {
+                // half 1 follows on from half 0, half 0 can be refilled once this line has been used
+                half_len[cur] = -1;
+                cur = other;
+                continue;
+
+            } else {
+                int partial = end - pos;
+                if(discarding || partial > carry_size) {
+                    discarding = true;
+                    pos = half_start(0);
+                } else {
+                    memmove(half_start(0) - partial, pos, partial);
+                    pos = half_start(0) - partial;
+                }
+                half_len[cur] = -1;
+                cur = other;
+                continue;
+            }
+
+        } else {
+            pos = nl + 1;
+        }
+
+        len = pos - line;
+        if(discarding) {
+            // this was the tail of a line dropped at the carry
+            discarding = false;
+            too_long = true;
+            return line;
+        }
+
+        *nl = '\0';
+        if(nl > line && nl[-1] == '\r') *--nl = '\0';
+        too_long = (nl - line) > max_line;
+        return line;
+    }
+}
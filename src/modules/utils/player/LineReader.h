@@ -0,0 +1,62 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LINEREADER_H
+#define LINEREADER_H
+
+#include <stdio.h>
+
+class HeatshrinkDecoder;
+
+/*
+ * Reads a file through a double buffer in AHB SRAM and splits the lines out of it in place.
+ *
+ *   [ carry | half 0 | half 1 ]
+ *
+ * Each half is filled with one fread of whole sectors, which FatFs passes to the SD card as a single multiple
+ * block read done by DMA. Lines are handed out of one half while the other is refilled by fill_ahead(), which
+ * the player calls right after the planner has taken a line, so the card is read while the queue is full rather
+ * than when the next line is needed. A line running off the end of half 1 is moved into the carry area so it
+ * continues straight into half 0.
+ *
+ * A compressed file is read through a decoder, which fills the halves with what it decompresses.
+ */
+class LineReader {
+    public:
+        LineReader();
+
+        // decoder, if given, has been started on fd
+        void start(FILE *fd, HeatshrinkDecoder *decoder = nullptr);
+        // the next line, nul terminated without its line ending, nullptr at the end of the file
+        // len is what it took up in the file, too_long is set for lines longer than max_line, which should be dropped
+        char *next_line(int &len, bool &too_long);
+        void fill_ahead();
+        // the rest of the file has been read, only what is in the buffer is left
+        bool at_end() const { return eof; }
+
+        static const int max_line = 128;
+
+    private:
+        static const int half_size = 1024;
+        static const int carry_size = 132;
+
+        char *half_start(int h) const { return buffer + carry_size + h * half_size; }
+        void fill(int h);
+
+        char *buffer;
+        FILE *fd;
+        HeatshrinkDecoder *decoder;
+        char *pos;                // next char to hand out
+        int half_len[2];          // bytes read into each half, -1 while it is waiting to be filled
+        int cur;                  // the half pos is in, or the carry in front of half 0
+        struct {
+            bool eof:1;           // the halves hold the rest of the file
+            bool discarding:1;    // dropping the rest of a line too long to carry
+        };
+};
+
+#endif
@@ -0,0 +1,116 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MacroCache.h"
+
+#include "SDFAT.h"
+
+#include <stdio.h>
+#include <string.h>
+
+extern SDFAT mounter;
+
+void MacroCache::configure(unsigned int kb, unsigned int max, MemoryPlacement where)
+{
+    if(arena != nullptr) placed_free(arena);
+    arena = nullptr;
+    arena_size = 0;
+    clear();
+    if(kb == 0) return;
+
+    arena = static_cast<char *>(placed_alloc(kb * 1024, where));
+    if(arena == nullptr) return;
+    arena_size = kb * 1024;
+    max_file = (max == 0 || max > arena_size) ? arena_size : max;
+}
+
+void MacroCache::clear()
+{
+    for (int i = 0; i < count; i++) table[i].fn.clear();
+    count = 0;
+    used = 0;
+}
+
+const char *MacroCache::find(const std::string& fn, uint16_t& n)
+{
+    if(arena == nullptr || fn.compare(0, 4, "/sd/") != 0) return nullptr;
+
+    uint32_t size, mtime;
+    if(mounter.stat(fn.c_str() + 4, &size, &mtime) != 0 || size > max_file) return nullptr;
+
+    Entry *e = nullptr;
+    for (int i = 0; i < count; i++) {
+        if(table[i].fn == fn) {
+            e = &table[i];
+            break;
+        }
+    }
+
+    if(e != nullptr && e->size == size && e->mtime == mtime) {
+        n = e->lines;
+        return arena + e->offset;
+    }
+
+    // the file has changed, or is new; the space an old copy took is only got back when the arena is emptied
+    if(e == nullptr || used + size + 1 > arena_size) {
+        if(count == max_entries || used + size + 1 > arena_size) {
+            if(busy > 0) return nullptr;
+            clear();
+        }
+        e = &table[count++];
+        e->fn = fn;
+    }
+    e->size = size;
+    e->mtime = mtime;
+
+    const char *p = load(*e);
+    if(p == nullptr) {
+        // leave it for the next time, when the card may read
+        *e = table[--count];
+        table[count].fn.clear();
+        return nullptr;
+    }
+    n = e->lines;
+    return p;
+}
+
+// reads the file to the end of the arena and packs its lines there
+const char *MacroCache::load(Entry& e)
+{
+    FILE *fd = fopen(e.fn.c_str(), "r");
+    if(fd == nullptr) return nullptr;
+    char *start = arena + used;
+    size_t got = fread(start, 1, e.size, fd);
+    fclose(fd);
+    if(got != e.size) return nullptr;
+
+    // copied down over itself, the packed lines never get ahead of what is still to be read
+    char *out = start;
+    const char *in = start, *end = start + got;
+    uint16_t lines = 0;
+    while(in < end) {
+        const char *eol = static_cast<const char *>(memchr(in, '\n', end - in));
+        if(eol == nullptr) eol = end;
+        const char *l = in;
+        in = eol + 1;
+
+        while(l < eol && (*l == ' ' || *l == '\t')) l++;
+        const char *le = eol;
+        while(le > l && (le[-1] == '\r' || le[-1] == ' ' || le[-1] == '\t')) le--;
+        if(le == l || *l == ';' || *l == '(') continue;
+
+        memmove(out, l, le - l);
+        out += le - l;
+        *out++ = '\0';
+        lines++;
+    }
+
+    e.offset = start - arena;
+    e.lines = lines;
+    used += (out - start);
+    return start;
+}
@@ -0,0 +1,63 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MACROCACHE_H
+#define MACROCACHE_H
+
+#include <stdint.h>
+#include <string>
+
+#include "platform_memory.h"
+
+/*
+ * Small gcode files kept in RAM once read, for the tool change, purge and probe macros a job plays over and over.
+ *
+ * The files are split into lines when loaded, blank lines and comments dropped, so playing one is a walk along the
+ * arena. Each time a file is asked for the card is only asked for its size and date, and it is read again if either
+ * has changed. The arena is filled from the start and emptied when a file no longer fits.
+ */
+class MacroCache {
+    public:
+        static const int max_entries = 16;
+
+        MacroCache() : arena(nullptr), arena_size(0), used(0), max_file(0), count(0), busy(0) {}
+
+        // kb of zero turns it off
+        void configure(unsigned int kb, unsigned int max_file, MemoryPlacement where);
+        bool enabled() const { return arena != nullptr; }
+
+        // the lines of the file, each followed by a NUL, nullptr if it can't be cached; n is the number of lines
+        const char *find(const std::string& fn, uint16_t& n);
+        // what is cached may not move while a macro is being played from it, nested ones included
+        void hold() { busy++; }
+        void release() { busy--; }
+        void clear();
+
+        unsigned int entries() const { return count; }
+        unsigned int bytes_used() const { return used; }
+        unsigned int bytes() const { return arena_size; }
+
+    private:
+        struct Entry {
+            std::string fn;
+            uint32_t size;
+            uint32_t mtime;
+            uint32_t offset;
+            uint16_t lines;
+        };
+        const char *load(Entry& e);
+
+        Entry table[max_entries];
+        char *arena;
+        uint32_t arena_size;
+        uint32_t used;
+        uint32_t max_file;
+        uint8_t count;
+        uint8_t busy;
+};
+
+#endif
@@ -6,6 +6,8 @@
 */
 
 #include "Player.h"
+#include "HeatshrinkDecoder.h"
+#include "modules/communication/utils/BinaryGcode.h"
 
 #include "libs/Kernel.h"
 #include "Robot.h"
@@ -29,9 +31,13 @@
 #include "PlayerPublicAccess.h"
 #include "TemperatureControlPublicAccess.h"
 #include "TemperatureControlPool.h"
+#include "ToolManagerPublicAccess.h"
+#include "MachineStatus.h"
+#include "SwitchPublicAccess.h"
 
 #include <cstddef>
 #include <cmath>
+#include <ctype.h>
 #include <algorithm>
 
 #include "mbed.h"
@@ -43,6 +49,21 @@
 #define extruder_checksum               CHECKSUM("extruder")
 #define save_state_checksum             CHECKSUM("save_state")
 #define restore_state_checksum          CHECKSUM("restore_state")
+#define lookahead_lines_checksum        CHECKSUM("player_lookahead_lines")
+#define tool_preheat_seconds_checksum   CHECKSUM("tool_preheat_seconds")
+#define index_lines_checksum            CHECKSUM("player_index_lines")
+#define journal_seconds_checksum        CHECKSUM("journal_seconds")
+#define journal_file_checksum           CHECKSUM("journal_file")
+#define recover_gcode_checksum          CHECKSUM("recover_gcode")
+#define fast_seek_kb_checksum           CHECKSUM("player_fast_seek_kb")
+#define fast_seek_fragments_checksum    CHECKSUM("player_fast_seek_fragments")
+#define macro_cache_kb_checksum         CHECKSUM("macro_cache_kb")
+#define macro_cache_max_file_checksum   CHECKSUM("macro_cache_max_file")
+#define macro_cache_memory_checksum     CHECKSUM("macro_cache_memory")
+#define heatshrink_window_checksum      CHECKSUM("player_heatshrink_window")
+#define heatshrink_lookahead_checksum   CHECKSUM("player_heatshrink_lookahead")
+#define queue_file_checksum             CHECKSUM("player_queue_file")
+#define between_jobs_gcode_checksum     CHECKSUM("player_between_jobs_gcode")
 
 extern SDFAT mounter;
 
@@ -56,40 +77,414 @@ Player::Player()
     this->halted= false;
     this->suspended= false;
     this->suspend_loops= 0;
+    this->quick_resume= false;
+    this->refilling= false;
+    this->cache= nullptr;
+    this->cache_size= 0;
+    this->cache_head= 0;
+    this->cache_count= 0;
+    this->scout_file= nullptr;
+    this->scout= nullptr;
+    this->start_offset= 0;
+    this->index_every= 1000;
+    this->journal_seconds= 0;
+    this->journal_secs= 0;
+    this->checkpoint_due= false;
+    this->eta_size= 0;
+    this->eta_start= 0.0F;
+    this->decoder= nullptr;
+    this->compressed= false;
+    this->binary= false;
+    this->next_file= nullptr;
+    this->next_size= 0;
+    this->next_cached= 0;
+    this->preloaded= false;
+    this->jobs_running= false;
+    this->between_due= false;
+    this->job_playing= false;
 }
 
 void Player::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
-    this->register_for_event(ON_MAIN_LOOP);
+    this->register_for_main_loop(MAIN_LOOP_FEED, "player");
     this->register_for_event(ON_SECOND_TICK);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
-    this->register_for_event(ON_GCODE_RECEIVED);
+    PublicData::register_owner(player_checksum, this);
+    this->register_for_gcodes('M', {21, 23, 24, 25, 26, 27, 32, 98});
     this->register_for_event(ON_HALT);
+    this->register_for_event(ON_IDLE);
 
     this->on_boot_gcode = THEKERNEL->config->value(on_boot_gcode_checksum)->by_default("/sd/on_boot.gcode")->as_string();
     this->on_boot_gcode_enable = THEKERNEL->config->value(on_boot_gcode_enable_checksum)->by_default(true)->as_bool();
 
     this->after_suspend_gcode = THEKERNEL->config->value(after_suspend_gcode_checksum)->by_default("")->as_string();
     this->before_resume_gcode = THEKERNEL->config->value(before_resume_gcode_checksum)->by_default("")->as_string();
-    std::replace( this->after_suspend_gcode.begin(), this->after_suspend_gcode.end(), '_', ' '); // replace _ with space
-    std::replace( this->before_resume_gcode.begin(), this->before_resume_gcode.end(), '_', ' '); // replace _ with space
+    // either may name a macro file instead, which keeps its underscores
+    if(this->after_suspend_gcode[0] != '/') std::replace( this->after_suspend_gcode.begin(), this->after_suspend_gcode.end(), '_', ' '); // replace _ with space
+    if(this->before_resume_gcode[0] != '/') std::replace( this->before_resume_gcode.begin(), this->before_resume_gcode.end(), '_', ' '); // replace _ with space
+
+    int n = THEKERNEL->config->value(lookahead_lines_checksum)->by_default(8)->as_number();
+    if(n > 255) n = 255;
+    if(n > 0) {
+        this->cache = new CachedLine[n];
+        this->cache_size = n;
+    }
+
+    this->tool_preheat_seconds = THEKERNEL->config->value(tool_preheat_seconds_checksum)->by_default(0)->as_number();
+    if(this->tool_preheat_seconds > 0) this->scout = new LineReader();
+
+    this->index_every = THEKERNEL->config->value(index_lines_checksum)->by_default(1000)->as_number();
+
+    this->journal_seconds = THEKERNEL->config->value(journal_seconds_checksum)->by_default(0)->as_number();
+    this->journal_file = THEKERNEL->config->value(journal_file_checksum)->by_default("/sd/journal.bin")->as_string();
+    this->recover_gcode = THEKERNEL->config->value(recover_gcode_checksum)->by_default("")->as_string();
+    std::replace( this->recover_gcode.begin(), this->recover_gcode.end(), '_', ' ');
+
+    // big files seek straight to the cluster they need rather than following the FAT chain from the start
+    int kb = THEKERNEL->config->value(fast_seek_kb_checksum)->by_default(1024)->as_int();
+    int fragments = THEKERNEL->config->value(fast_seek_fragments_checksum)->by_default(32)->as_int();
+    mbed::FATFileSystem::set_fast_seek(kb > 0 ? kb * 1024 : 0, fragments * 2 + 2);
+
+    int macro_kb = THEKERNEL->config->value(macro_cache_kb_checksum)->by_default(0)->as_int();
+    int macro_max = THEKERNEL->config->value(macro_cache_max_file_checksum)->by_default(4096)->as_int();
+    string where = THEKERNEL->config->value(macro_cache_memory_checksum)->by_default("ahb0")->as_string();
+    macros.configure(macro_kb > 0 ? macro_kb : 0, macro_max > 0 ? macro_max : 0, placement_from_string(where.c_str(), PLACE_AHB0));
+
+    // what .hs files were compressed with, heatshrink -e -w 11 -l 4 by default
+    int w = THEKERNEL->config->value(heatshrink_window_checksum)->by_default(11)->as_int();
+    int l = THEKERNEL->config->value(heatshrink_lookahead_checksum)->by_default(4)->as_int();
+    this->heatshrink_window = std::max(4, std::min(15, w));
+    this->heatshrink_lookahead = std::max(3, std::min((int)this->heatshrink_window - 1, l));
+
+    this->jobs_file = THEKERNEL->config->value(queue_file_checksum)->by_default("/sd/queue.txt")->as_string();
+    this->between_jobs_gcode = THEKERNEL->config->value(between_jobs_gcode_checksum)->by_default("")->as_string();
+    load_jobs();
 }
 
 void Player::on_halt(void *arg)
 {
     halted= (arg == nullptr);
+    if(halted) jobs_running= false;
 }
 
 void Player::on_second_tick(void *)
 {
-    if(this->playing_file) this->elapsed_secs++;
+    if(this->playing_file) {
+        this->elapsed_secs++;
+        if(this->journal_seconds > 0 && ++this->journal_secs >= this->journal_seconds) this->checkpoint_due = true;
+    }
+
+    // the same as the progress public data, which only answers while playing
+    MachineStatus *status = THEKERNEL->status;
+    if(file_size > 0 && playing_file) {
+        status->playing_file = &this->filename;
+        status->elapsed_secs = this->elapsed_secs;
+        status->percent_complete = (uint64_t)file_position() * 100 / this->file_size;
+        status->remaining_secs = estimate_remaining();
+    } else {
+        status->remaining_secs = 0;
+        status->playing_file = nullptr;
+        status->elapsed_secs = 0;
+        status->percent_complete = 0;
+    }
 }
 
 // extract any options found on line, terminates args at the space before the first option (-v)
 // eg this is a file.gcode -v
 //    will return -v and set args to this is a file.gcode
+// the file is read in large blocks through the line reader, so it goes straight to the file system without a stdio buffer
+// a .hs file is decompressed as it is read and a .gbin one is records rather than lines, so either can only be
+// played from the start
+FILE *Player::open_file(const string& fn)
+{
+    FILE *fd = NULL;
+    bool was_preloaded = false;
+    if(next_file != NULL && fn == next_filename) {
+        fd = next_file;
+        next_file = NULL;
+        was_preloaded = preloaded;
+        preloaded = false;
+    } else {
+        fd = fopen(fn.c_str(), "r");
+        if(fd != NULL) setvbuf(fd, NULL, _IONBF, 0);
+    }
+    drop_prefetch();
+
+    // the size is taken before a reader starts, the seek back to the start would lose the .gbin header it has read
+    if(was_preloaded) {
+        // the reader has gone on from the start already, prefetch_job took the size
+        file_size = next_size;
+    } else if(fd != NULL) {
+        file_size = 0;
+        if(fseek(fd, 0, SEEK_END) == 0) file_size = ftell(fd);
+        if(fseek(fd, 0, SEEK_SET) != 0) {
+            fclose(fd);
+            fd = NULL;
+        }
+    }
+
+    compressed = is_compressed(fn);
+    binary = is_binary(fn);
+    if(fd != NULL && !was_preloaded) {
+        if(binary) {
+            if(!records.start(fd)) {
+                fclose(fd);
+                fd = NULL;
+            }
+        } else if(compressed) {
+            if(decoder == nullptr) decoder = new HeatshrinkDecoder(heatshrink_window, heatshrink_lookahead);
+            if(!decoder->start(fd)) {
+                fclose(fd);
+                fd = NULL;
+            }
+        }
+        if(fd != NULL && !binary) reader.start(fd, compressed ? decoder : nullptr);
+    }
+    if(fd == NULL) compressed = binary = false;
+
+    if(was_preloaded) {
+        // what is left of the last file is dropped, the lines after it are the first of this one
+        cache_head = (cache_head + cache_count - next_cached) % cache_size;
+        cache_count = next_cached;
+    } else {
+        cache_head = cache_count = 0;
+    }
+    next_cached = 0;
+    cache_hits = cache_misses = 0;
+    refills = refill_total_us = refill_max_us = 0;
+    // the queue drains are reported at the end of the file
+    THEKERNEL->conveyor->reset_stall_stats();
+
+    eta_marks.clear();
+    start_offset = 0;
+    if(fd != NULL) load_eta_index(fn);
+
+    close_scout();
+    if(fd != NULL && this->scout != nullptr && !compressed && !binary) {
+        this->scout_file = fopen(fn.c_str(), "r");
+        if(this->scout_file != NULL) {
+            setvbuf(this->scout_file, NULL, _IONBF, 0);
+            this->scout->start(this->scout_file);
+        }
+        this->scout_cnt = 0;
+        this->scout_tool = -1;
+        this->pending_tool = -1;
+    }
+    return fd;
+}
+
+void Player::load_eta_index(const string& fn)
+{
+    eta_index.clear();
+    eta_size = 0;
+    FILE *fd = fopen((fn + ".eta").c_str(), "r");
+    if(fd == NULL) return;
+
+    float t;
+    if(fscanf(fd, "%lu", &eta_size) == 1) {
+        while(eta_index.size() <= 100 && fscanf(fd, "%f", &t) == 1) eta_index.push_back(t);
+    }
+    fclose(fd);
+    if(eta_index.size() != 101) {
+        eta_index.clear();
+        eta_size = 0;
+    }
+}
+
+// only once the whole file has been played
+void Player::save_eta_index()
+{
+    if(file_size == 0 || eta_marks.empty() || start_offset > 0) return;
+    float total = THEKERNEL->conveyor->get_executed_seconds() + THEKERNEL->conveyor->get_queued_seconds() - eta_start;
+    while(eta_marks.size() <= 100) eta_marks.push_back(total);
+
+    FILE *fd = fopen((this->filename + ".eta").c_str(), "w");
+    if(fd == NULL) return;
+    fprintf(fd, "%lu\n", file_size);
+    for(float t : eta_marks) fprintf(fd, "%1.1f\n", t);
+    fclose(fd);
+}
+
+// called after each line is played, records the planned time when the file passes the next percent
+void Player::mark_eta()
+{
+    if(file_size == 0 || eta_marks.size() > 100 || start_offset > 0) return;
+    if((uint64_t)file_position() * 100 < (uint64_t)eta_marks.size() * file_size) return;
+    eta_marks.push_back(THEKERNEL->conveyor->get_executed_seconds() + THEKERNEL->conveyor->get_queued_seconds() - eta_start);
+}
+
+// seconds of motion left, 0 if there is nothing to go on yet
+// from the saved index if the file has been played before, else the planned time so far per byte played
+unsigned long Player::estimate_remaining()
+{
+    unsigned long pos = file_position();
+    if(file_size == 0 || pos <= start_offset) return 0;
+    float queued = THEKERNEL->conveyor->get_queued_seconds();
+
+    if(eta_size == file_size && !eta_index.empty()) {
+        float f = (float)pos * 100 / file_size;
+        unsigned int i = std::min(99U, (unsigned int)f);
+        float at = eta_index[i] + (eta_index[i + 1] - eta_index[i]) * (f - i);
+        return std::max(0.0F, eta_index[100] - at + queued);
+    }
+
+    if(this->elapsed_secs <= 10 || eta_marks.empty()) return 0;
+    float planned = THEKERNEL->conveyor->get_executed_seconds() + queued - eta_start;
+    return queued + planned * (file_size - pos) / (pos - start_offset);
+}
+
+bool Player::is_compressed(const string& fn)
+{
+    return fn.size() > 3 && fn.compare(fn.size() - 3, 3, ".hs") == 0;
+}
+
+bool Player::is_binary(const string& fn)
+{
+    return fn.size() > 5 && fn.compare(fn.size() - 5, 5, ".gbin") == 0;
+}
+
+// how far into the file playing has got, for a compressed one that is how much of it the decoder has read
+unsigned long Player::file_position() const
+{
+    return compressed ? decoder->consumed() : played_cnt;
+}
+
+void Player::close_scout()
+{
+    if(this->scout_file != NULL) {
+        fclose(this->scout_file);
+        this->scout_file = NULL;
+    }
+}
+
+// comment only and blank lines never need to go through the dispatcher, nor the comments after a G or M code
+static bool strip_line(char *line)
+{
+    char first = line[0];
+    if(first == ';' || first == '(') return false;
+    if(first == 'G' || first == 'M' || first == 'T') {
+        char *c = strpbrk(line, ";(");
+        if(c != NULL) *c = '\0';
+    }
+
+    char *e = line + strlen(line);
+    while(e > line && (e[-1] == ' ' || e[-1] == '\t')) *--e = '\0';
+    return line[0] != '\0';
+}
+
+// the next line from the file worth sending, false at the end of it
+bool Player::read_line(char *&line, int &len)
+{
+    int n = 0;
+    bool too_long;
+    while((line = reader.next_line(len, too_long)) != NULL) {
+        n += len;
+        if(too_long) {
+            this->current_stream->printf("Warning: Discarded long line\n");
+            continue;
+        }
+        if(line[0] == ';' && this->journal_seconds > 0 && GcodeIndex::is_layer_comment(line)) this->checkpoint_due = true;
+        if(strip_line(line)) {
+            len = n;
+            return true;
+        }
+    }
+    return false;
+}
+
+// the main loop is stuck waiting for room in the queue, so read the coming lines while we wait
+void Player::on_idle(void *argument)
+{
+    if(checkpoint_due && playing_file && !refilling) checkpoint(false);
+    if(jobs_running && playing_file && !refilling && !binary && next_filename.empty() && !next_job_file().empty() && reader.at_end()) prefetch_job();
+    if(!playing_file || refilling || binary || !THEKERNEL->conveyor->is_queue_full()) return;
+
+    refilling = true;
+    if(cache_count < cache_size) {
+        uint32_t t = us_ticker_read();
+        char *line;
+        int len;
+        while(cache_count < cache_size) {
+            if(!read_line(line, len)) {
+                // this file has all been read, the next job's lines can follow it into the cache
+                if(preloaded || !preload_job()) break;
+                continue;
+            }
+            CachedLine &c = cache[(cache_head + cache_count) % cache_size];
+            strcpy(c.text, line);
+            c.len = len;
+            cache_count++;
+            if(preloaded) next_cached++;
+        }
+        reader.fill_ahead();
+
+        uint32_t dt = us_ticker_read() - t;
+        refills++;
+        refill_total_us += dt;
+        if(dt > refill_max_us) refill_max_us = dt;
+    }
+    if(scout_file != NULL) scout_ahead();
+    refilling = false;
+}
+
+// the value after the first word with that letter in a line, before any comment, NULL if there is none
+static const char *find_word(const char *line, char letter)
+{
+    for (const char *c = line; *c != '\0' && *c != ';' && *c != '('; ++c) {
+        if(*c == letter && (isdigit(c[1]) || c[1] == '-' || c[1] == '.')) return c + 1;
+    }
+    return NULL;
+}
+
+// Read on as far as the file is expected to get in tool_preheat_seconds, from how fast it has gone so far, and when a
+// tool change turns up ask the ToolManager to heat that tool to the temperature the file sets straight after it.
+// Only a few lines at a time, so the planner is never kept waiting for long
+void Player::scout_ahead()
+{
+    if(this->elapsed_secs < 10) return; // too soon to tell how fast the file goes
+    unsigned long ahead = this->tool_preheat_seconds * this->played_cnt / this->elapsed_secs;
+
+    for (int n = 0; n < 16 && this->scout_cnt < this->played_cnt + ahead; ++n) {
+        int len;
+        bool too_long;
+        char *line = scout->next_line(len, too_long);
+        if(line == NULL) {
+            close_scout();
+            return;
+        }
+        this->scout_cnt += len;
+        if(too_long) continue;
+
+        // a T word anywhere in a line is a tool change to the ToolManager, M6 T1 and N10 T1 as well as T1
+        while(isspace(*line)) line++;
+        if(line[0] == 'N' && isdigit(line[1])) {
+            while(isdigit(*++line));
+            while(isspace(*line)) line++;
+        }
+        bool sets_temperature = (strncmp(line, "M104", 4) == 0 || strncmp(line, "M109", 4) == 0) && !isdigit(line[4]);
+        const char *w = find_word(line, 'T');
+        if(w != NULL && isdigit(*w)) {
+            int t = strtol(w, NULL, 10);
+            if(t != this->scout_tool) {
+                this->scout_tool = t;
+                this->pending_tool = t;
+                this->pending_lines = 8;
+            }
+        } else if(this->pending_tool >= 0 && !sets_temperature && --this->pending_lines == 0) {
+            this->pending_tool = -1; // no temperature for it, leave it to the file
+        }
+
+        // the temperature can be on the same line as the change, M104 T1 S210
+        const char *s;
+        if(this->pending_tool >= 0 && sets_temperature && (s = find_word(line, 'S')) != NULL) {
+            struct tool_preheat p = { this->pending_tool, strtof(s, NULL) };
+            PublicData::set_value( tool_manager_checksum, preheat_tool_checksum, &p );
+            this->pending_tool = -1;
+        }
+    }
+    scout->fill_ahead();
+}
+
 string Player::extract_options(string& args)
 {
     string opts;
@@ -121,21 +516,13 @@ void Player::on_gcode_received(void *argument)
                 this->playing_file = false;
                 fclose(this->current_file_handler);
             }
-            this->current_file_handler = fopen( this->filename.c_str(), "r");
+            this->current_file_handler = open_file(this->filename);
 
             if(this->current_file_handler == NULL) {
                 gcode->stream->printf("file.open failed: %s\r\n", this->filename.c_str());
                 return;
 
             } else {
-                // get size of file
-                int result = fseek(this->current_file_handler, 0, SEEK_END);
-                if (0 != result) {
-                    this->file_size = 0;
-                } else {
-                    this->file_size = ftell(this->current_file_handler);
-                    fseek(this->current_file_handler, 0, SEEK_SET);
-                }
                 gcode->stream->printf("File opened:%s Size:%ld\r\n", this->filename.c_str(), this->file_size);
                 gcode->stream->printf("File selected\r\n");
             }
@@ -162,20 +549,18 @@ void Player::on_gcode_received(void *argument)
             gcode->mark_as_taken();
             if(this->current_file_handler != NULL) {
                 string currentfn = this->filename.c_str();
-                unsigned long old_size = this->file_size;
 
                 // abort the print
                 abort_command("", gcode->stream);
 
                 if(!currentfn.empty()) {
                     // reload the last file opened
-                    this->current_file_handler = fopen(currentfn.c_str() , "r");
+                    this->current_file_handler = open_file(currentfn);
 
                     if(this->current_file_handler == NULL) {
                         gcode->stream->printf("file.open failed: %s\r\n", currentfn.c_str());
                     } else {
                         this->filename = currentfn;
-                        this->file_size = old_size;
                         this->current_stream = &(StreamOutput::NullStream);
                     }
                 }
@@ -188,6 +573,13 @@ void Player::on_gcode_received(void *argument)
             gcode->mark_as_taken();
             progress_command("-b", gcode->stream);
 
+        } else if (gcode->m == 98) { // play a macro file, in line with the gcodes around it
+            gcode->mark_as_taken();
+            string fn = "/sd/" + args;
+            if(!play_macro(fn, gcode->stream)) {
+                gcode->stream->printf("file.open failed: %s\r\n", fn.c_str());
+            }
+
         } else if (gcode->m == 32) { // select file and start print
             gcode->mark_as_taken();
             // Get filename
@@ -199,7 +591,7 @@ void Player::on_gcode_received(void *argument)
                 fclose(this->current_file_handler);
             }
 
-            this->current_file_handler = fopen( this->filename.c_str(), "r");
+            this->current_file_handler = open_file(this->filename);
             if(this->current_file_handler == NULL) {
                 gcode->stream->printf("file.open failed: %s\r\n", this->filename.c_str());
             } else {
@@ -237,6 +629,16 @@ void Player::on_console_line_received( void *argument )
         this->suspend_command( possible_command, new_message.stream );
     }else if (cmd == "resume") {
         this->resume_command( possible_command, new_message.stream );
+    }else if (cmd == "index") {
+        this->index_command( possible_command, new_message.stream );
+    }else if (cmd == "preflight"){
+        this->preflight_command( possible_command, new_message.stream );
+    }else if (cmd == "recover") {
+        this->recover_command( possible_command, new_message.stream );
+    }else if (cmd == "macro") {
+        this->macro_command( possible_command, new_message.stream );
+    }else if (cmd == "queue") {
+        this->queue_command( possible_command, new_message.stream );
     }
 }
 
@@ -257,7 +659,7 @@ void Player::play_command( string parameters, StreamOutput *stream )
         fclose(this->current_file_handler);
     }
 
-    this->current_file_handler = fopen( this->filename.c_str(), "r");
+    this->current_file_handler = open_file(this->filename);
     if(this->current_file_handler == NULL) {
         stream->printf("File not found: %s\r\n", this->filename.c_str());
         return;
@@ -275,18 +677,488 @@ void Player::play_command( string parameters, StreamOutput *stream )
         this->current_stream = THEKERNEL->streams;
     }
 
-    // get size of file
-    int result = fseek(this->current_file_handler, 0, SEEK_END);
-    if (0 != result) {
+    // open_file got the size
+    if (file_size == 0) {
         stream->printf("WARNING - Could not get file size\r\n");
-        file_size = 0;
     } else {
-        file_size = ftell(this->current_file_handler);
-        fseek(this->current_file_handler, 0, SEEK_SET);
         stream->printf("  File size %ld\r\n", file_size);
     }
     this->played_cnt = 0;
     this->elapsed_secs = 0;
+
+    // -l <line> or -L <layer> starts part way into the file
+    size_t o = options.find("-l");
+    unsigned long start_line = o == string::npos ? 0 : strtoul(options.c_str() + o + 2, nullptr, 10);
+    o = options.find("-L");
+    unsigned long start_layer = o == string::npos ? 0 : strtoul(options.c_str() + o + 2, nullptr, 10);
+    if(start_line > 1 || start_layer > 0) {
+        GcodeIndex::State s;
+        if(start_part_way(start_line, start_layer, 0, s, stream)) {
+            restore_modes(s);
+        } else {
+            this->playing_file = false;
+            fclose(this->current_file_handler);
+            this->current_file_handler = NULL;
+            this->current_stream = NULL;
+            close_scout();
+        }
+    }
+}
+
+static bool find_start(const string& fn, unsigned long file_size, unsigned long line, unsigned long layer, unsigned long offset, GcodeIndex::State& s)
+{
+    if(layer > 0) return GcodeIndex::find_layer(fn, file_size, layer, s);
+    if(line > 0) return GcodeIndex::find_line(fn, file_size, line, s);
+    return GcodeIndex::find_offset(fn, file_size, offset, s);
+}
+
+// puts the file at the line, the start of the layer or the line at the byte offset, building the index first if
+// there is none for this file, s is what the file has set up by then
+bool Player::start_part_way(unsigned long line, unsigned long layer, unsigned long offset, GcodeIndex::State& s, StreamOutput *stream)
+{
+    if(compressed || binary) {
+        stream->printf("A compressed or binary file can only be played from the start\r\n");
+        return false;
+    }
+    bool found = find_start(this->filename, file_size, line, layer, offset, s);
+    if(!found) {
+        if(!GcodeIndex::build(this->filename, file_size, reader, index_every, stream)) {
+            stream->printf("Could not index %s\r\n", this->filename.c_str());
+            return false;
+        }
+        found = find_start(this->filename, file_size, line, layer, offset, s);
+        if(!found) {
+            if(layer > 0) stream->printf("There is no layer %lu in the file\r\n", layer);
+            else stream->printf("There is no line %lu in the file\r\n", line);
+            return false;
+        }
+    }
+
+    seek_to(s.offset);
+    // from the indexed line on to the one asked for
+    char *l;
+    int len;
+    bool too_long;
+    while(layer == 0 && (line > 0 ? s.line + 1 < line : s.offset < offset) && (l = reader.next_line(len, too_long)) != NULL) {
+        if(too_long) {
+            s.line++;
+            s.offset += len;
+        } else {
+            s.feed(l, len);
+        }
+    }
+    played_cnt = start_offset = s.offset;
+    if(this->scout_file != NULL) {
+        fseek(this->scout_file, s.offset, SEEK_SET);
+        this->scout->start(this->scout_file);
+        this->scout_cnt = s.offset;
+    }
+
+    stream->printf("Starting at line %lu, Z %1.3f\r\n", s.line + 1, s.z);
+    return true;
+}
+
+// the lines from here on are read from offset
+void Player::seek_to(unsigned long offset)
+{
+    fseek(this->current_file_handler, offset, SEEK_SET);
+    reader.start(this->current_file_handler);
+    cache_head = cache_count = 0;
+    played_cnt = start_offset = offset;
+}
+
+// the modes and extruder position the file had set up by then, as the lines before it are not played
+void Player::restore_modes(const GcodeIndex::State& s)
+{
+    char buf[32];
+    struct SerialMessage message;
+    message.stream = &(StreamOutput::NullStream);
+
+    message.message = s.relative ? "G91" : "G90";
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    message.message = s.relative_e ? "M83" : "M82";
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    if(!s.relative_e) {
+        snprintf(buf, sizeof(buf), "G92 E%1.5f", s.e);
+        message.message = buf;
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    }
+}
+
+// index <file>, builds the index play -l and -L use, which they would build themselves the first time
+// macro <file> plays it now, macro -c empties the cache and macro on its own shows what is in it
+void Player::macro_command( string parameters, StreamOutput *stream )
+{
+    string options = extract_options(parameters);
+    if(options.find_first_of("Cc") != string::npos) {
+        macros.clear();
+        stream->printf("macro cache cleared\r\n");
+        return;
+    }
+    if(parameters.empty()) {
+        if(!macros.enabled()) stream->printf("macro cache is off\r\n");
+        else stream->printf("macro cache: %u files, %u of %u bytes\r\n", macros.entries(), macros.bytes_used(), macros.bytes());
+        return;
+    }
+
+    string fn = absolute_from_relative(parameters);
+    if(!play_macro(fn, stream)) {
+        stream->printf("File not found: %s\r\n", fn.c_str());
+    }
+}
+
+// plays every line of the file before returning, waiting for room in the queue as each one goes in
+bool Player::play_macro(const string& fn, StreamOutput *stream)
+{
+    struct SerialMessage message;
+    message.stream = &(StreamOutput::NullStream);
+
+    uint16_t n;
+    const char *l = macros.find(fn, n);
+    if(l != nullptr) {
+        macros.hold();
+        for (; n > 0 && !halted; n--) {
+            message.message = l;
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+            l += strlen(l) + 1;
+        }
+        macros.release();
+        return true;
+    }
+
+    // too big for the cache, or it is off
+    FILE *fd = fopen(fn.c_str(), "r");
+    if(fd == NULL) return false;
+    char buf[LineReader::max_line + 1];
+    while(!halted && fgets(buf, sizeof(buf), fd) != NULL) {
+        size_t len = strlen(buf);
+        while(len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) buf[--len] = '\0';
+        if(len == 0) continue;
+        message.message = buf;
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    }
+    fclose(fd);
+    return true;
+}
+
+// queue [list], queue add file [count], queue remove n, queue clear, queue start, queue stop
+void Player::queue_command( string parameters, StreamOutput *stream )
+{
+    string cmd = shift_parameter(parameters);
+    if(cmd == "add") {
+        // a count after the file name plays it that many times
+        size_t sp = parameters.find_last_of(' ');
+        unsigned long count = 1;
+        if(sp != string::npos && isdigit(parameters[sp + 1])) {
+            count = strtoul(parameters.c_str() + sp + 1, nullptr, 10);
+            parameters = parameters.substr(0, sp);
+        }
+        string fn = absolute_from_relative(parameters);
+        FILE *fd = fopen(fn.c_str(), "r");
+        if(fd == NULL) {
+            stream->printf("File not found: %s\r\n", fn.c_str());
+            return;
+        }
+        fclose(fd);
+        if(count < 1) count = 1;
+        if(count > 65535) count = 65535;
+        jobs.push_back({fn, (uint16_t)count});
+        save_jobs();
+        stream->printf("queued %s x%lu, %u jobs\r\n", fn.c_str(), count, (unsigned)jobs.size());
+
+    } else if(cmd == "remove") {
+        unsigned long n = strtoul(parameters.c_str(), nullptr, 10);
+        if(n < 1 || n > jobs.size()) {
+            stream->printf("no job %lu\r\n", n);
+            return;
+        }
+        jobs.erase(jobs.begin() + (n - 1));
+        // the job playing, if it was taken off, is not counted when it ends
+        if(n == 1) job_playing = false;
+        if(n <= 2) drop_prefetch();
+        save_jobs();
+
+    } else if(cmd == "clear") {
+        jobs.clear();
+        job_playing = false;
+        drop_prefetch();
+        save_jobs();
+
+    } else if(cmd == "start") {
+        jobs_running = true;
+        stream->printf("queue started\r\n");
+
+    } else if(cmd == "stop") {
+        // the job playing carries on, the next one is not started
+        jobs_running = false;
+        stream->printf("queue stopped\r\n");
+
+    } else {
+        stream->printf("queue is %s, %u jobs\r\n", jobs_running ? "running" : "stopped", (unsigned)jobs.size());
+        for (size_t i = 0; i < jobs.size(); i++)
+            stream->printf("%u: %s x%u\r\n", (unsigned)(i + 1), jobs[i].fn.c_str(), jobs[i].count);
+    }
+}
+
+// the queue file has a line for each job, the times still to play it and the file name
+void Player::load_jobs()
+{
+    jobs.clear();
+    FILE *fd = fopen(jobs_file.c_str(), "r");
+    if(fd == NULL) return;
+    char buf[LineReader::max_line + 8];
+    while(fgets(buf, sizeof(buf), fd) != NULL) {
+        char *fn;
+        unsigned long count = strtoul(buf, &fn, 10);
+        while(*fn == ' ') fn++;
+        size_t len = strlen(fn);
+        while(len > 0 && (fn[len - 1] == '\n' || fn[len - 1] == '\r')) fn[--len] = '\0';
+        if(count > 0 && len > 0) jobs.push_back({fn, (uint16_t)count});
+    }
+    fclose(fd);
+}
+
+void Player::save_jobs()
+{
+    if(jobs.empty()) {
+        remove(jobs_file.c_str());
+        return;
+    }
+    FILE *fd = fopen(jobs_file.c_str(), "w");
+    if(fd == NULL) {
+        THEKERNEL->streams->printf("Could not write the job queue %s\r\n", jobs_file.c_str());
+        return;
+    }
+    for(auto& j : jobs) fprintf(fd, "%u %s\n", j.count, j.fn.c_str());
+    fclose(fd);
+}
+
+// plays the first job on the queue, after the between jobs gcode if one has just finished. It stays on the queue
+// until it has played to its end, so one that is aborted or cut off by a reset is played again
+void Player::start_next_job()
+{
+    string fn = jobs.front().fn;
+
+    if(between_due && !between_jobs_gcode.empty()) run_gcode(between_jobs_gcode);
+    between_due = false;
+    if(halted || !jobs_running) return;
+
+    play_command(fn, THEKERNEL->streams);
+    if(!playing_file) {
+        jobs_running = false;
+        THEKERNEL->streams->printf("queue stopped\r\n");
+        return;
+    }
+    this->reply_stream = THEKERNEL->streams;
+    job_playing = true;
+}
+
+// the job playing has played to its end, one fewer time to play it
+void Player::finish_job()
+{
+    job_playing = false;
+    if(jobs.empty()) return;
+    if(--jobs.front().count == 0) jobs.erase(jobs.begin());
+    save_jobs();
+}
+
+// the file the queue plays after the job playing now, empty if there is none
+string Player::next_job_file() const
+{
+    if(jobs.empty()) return "";
+    if(!job_playing || jobs.front().count > 1) return jobs.front().fn;
+    return jobs.size() > 1 ? jobs[1].fn : "";
+}
+
+// the file playing has been read to its end, so open the next one now rather than in the gap between them
+void Player::prefetch_job()
+{
+    next_filename = next_job_file();
+    next_file = fopen(next_filename.c_str(), "r");
+    if(next_file == NULL) return;
+    setvbuf(next_file, NULL, _IONBF, 0);
+    // the seek walks the cluster chain, which open_file would otherwise do as the job starts
+    next_size = 0;
+    if(fseek(next_file, 0, SEEK_END) == 0) next_size = ftell(next_file);
+    fseek(next_file, 0, SEEK_SET);
+}
+
+// the lines of the file playing have all been read, so the reader goes on to the prefetched one and its first lines
+// are cached behind them. Only for a plain text file, a compressed or binary one is started by open_file
+bool Player::preload_job()
+{
+    if(next_file == NULL || is_compressed(next_filename) || is_binary(next_filename)) return false;
+    reader.start(next_file);
+    preloaded = true;
+    next_cached = 0;
+    return true;
+}
+
+void Player::drop_prefetch()
+{
+    if(preloaded) {
+        // the reader has gone on to the next file, what is left of the one playing is all in the cache
+        cache_count -= next_cached;
+        next_cached = 0;
+        reader.start(NULL);
+        preloaded = false;
+    }
+    if(next_file != NULL) fclose(next_file);
+    next_file = NULL;
+    next_filename.clear();
+}
+
+// the suspend and resume gcode, a line of gcode or a macro file
+void Player::run_gcode(const string& gcode)
+{
+    if(gcode[0] == '/') {
+        play_macro(gcode, &(StreamOutput::NullStream));
+        return;
+    }
+    struct SerialMessage message;
+    message.message = gcode;
+    message.stream = &(StreamOutput::NullStream);
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+}
+
+void Player::index_command( string parameters, StreamOutput *stream )
+{
+    if(this->playing_file || this->suspended) {
+        stream->printf("Currently printing, abort print first\r\n");
+        return;
+    }
+
+    string fn = absolute_from_relative(parameters);
+    if(is_compressed(fn) || is_binary(fn)) {
+        stream->printf("A compressed or binary file can not be indexed\r\n");
+        return;
+    }
+    FILE *fd = fopen(fn.c_str(), "r");
+    if(fd == NULL) {
+        stream->printf("File not found: %s\r\n", fn.c_str());
+        return;
+    }
+    fseek(fd, 0, SEEK_END);
+    unsigned long size = ftell(fd);
+    fclose(fd);
+
+    if(!GcodeIndex::build(fn, size, reader, index_every, stream))
+        stream->printf("Could not index %s\r\n", fn.c_str());
+}
+
+// the gcodes a preflight plans, the rest would heat, switch, home or wait for something and are left out
+static bool preflight_plans(const Gcode& gcode)
+{
+    if(!gcode.has_g) return false;
+    switch(gcode.g) {
+        case 0: case 1: case 2: case 3: case 5:
+        case 17: case 18: case 19: case 20: case 21:
+        case 61: case 64: case 90: case 91: case 92:
+            return true;
+    }
+    return false;
+}
+
+// Plans the whole file as fast as it can be read, with the conveyor in dry run so nothing is stepped, and only the
+// moves and their modes given to the robot so no heater, fan or other module sees it. The planned time at every
+// percent goes to <file>.eta for the progress estimate the first time it is played, followed by the report as comments
+void Player::preflight_command( string parameters, StreamOutput *stream )
+{
+    if(this->playing_file || this->suspended || !THEKERNEL->conveyor->is_queue_empty()) {
+        stream->printf("Currently printing, abort print first\r\n");
+        return;
+    }
+
+    string fn = absolute_from_relative(parameters);
+    if(is_compressed(fn) || is_binary(fn)) {
+        stream->printf("A compressed or binary file can not be preflighted\r\n");
+        return;
+    }
+    FILE *fd = fopen(fn.c_str(), "r");
+    if(fd == NULL) {
+        stream->printf("File not found: %s\r\n", fn.c_str());
+        return;
+    }
+    fseek(fd, 0, SEEK_END);
+    unsigned long size = ftell(fd);
+    fseek(fd, 0, SEEK_SET);
+    setvbuf(fd, NULL, _IONBF, 0);
+    reader.start(fd);
+
+    stream->printf("Preflight %s\r\n", fn.c_str());
+    Robot *robot = THEKERNEL->robot;
+    Conveyor *conveyor = THEKERNEL->conveyor;
+    robot->begin_dry_run();
+    conveyor->set_dry_run(true);
+    float start_seconds = conveyor->get_executed_seconds();
+    uint32_t start_us = us_ticker_read();
+
+    std::vector<float> marks;
+    marks.push_back(0.0F);
+    float lo[3], hi[3], pos[3];
+    robot->get_axis_position(lo);
+    memcpy(hi, lo, sizeof(hi));
+    float dwell = 0.0F;
+    unsigned long offset = 0, lines = 0;
+    char *l;
+    int len;
+    bool too_long;
+    while((l = reader.next_line(len, too_long)) != NULL && !conveyor->is_halted()) {
+        if(!too_long) {
+            Gcode gcode(l, &(StreamOutput::NullStream));
+            if(gcode.has_g && gcode.g == 4) {
+                dwell += gcode.has_letter('P') ? gcode.get_value('P') / 1000.0F : gcode.get_value('S');
+            } else if(preflight_plans(gcode)) {
+                conveyor->set_source_tag(offset);
+                robot->on_gcode_received(&gcode);
+                robot->get_axis_position(pos);
+                for (int i = 0; i < 3; i++) {
+                    lo[i] = std::min(lo[i], pos[i]);
+                    hi[i] = std::max(hi[i], pos[i]);
+                }
+            }
+        }
+        offset += len;
+        if((uint64_t)offset * 100 >= (uint64_t)marks.size() * size && marks.size() <= 100)
+            marks.push_back(conveyor->get_executed_seconds() + conveyor->get_queued_seconds() - start_seconds);
+
+        // a big file takes a while, keep the rest of the machine going
+        if((++lines & 0xFF) == 0) THEKERNEL->call_event(ON_IDLE);
+    }
+    fclose(fd);
+    conveyor->wait_for_empty_queue();
+    Conveyor::DryRunStats s = conveyor->get_dry_run_stats();
+    conveyor->set_dry_run(false);
+    robot->end_dry_run();
+    conveyor->set_source_tag(0);
+    if(conveyor->is_halted()) {
+        stream->printf("Preflight stopped by a halt\r\n");
+        return;
+    }
+
+    float total = conveyor->get_executed_seconds() - start_seconds;
+    while(marks.size() <= 100) marks.push_back(total);
+    uint32_t us = us_ticker_read() - start_us;
+
+    char report[4][100];
+    snprintf(report[0], sizeof(report[0]), "%lu lines, %u blocks planned in %1.1fs", lines, s.blocks, us / 1e6F);
+    snprintf(report[1], sizeof(report[1]), "motion %1.1fs, dwell %1.1fs", total, dwell);
+    snprintf(report[2], sizeof(report[2]), "X %1.3f to %1.3f, Y %1.3f to %1.3f, Z %1.3f to %1.3f", lo[0], hi[0], lo[1], hi[1], lo[2], hi[2]);
+    snprintf(report[3], sizeof(report[3]), "%u blocks in %u places shorter than they take to plan", s.starved, s.sections);
+
+    FILE *out = fopen((fn + ".eta").c_str(), "w");
+    if(out != NULL) {
+        fprintf(out, "%lu\n", size);
+        for(float t : marks) fprintf(out, "%1.1f\n", t);
+        for(auto& r : report) fprintf(out, "; %s\n", r);
+        for(unsigned int i = 0; i < s.sections && i < sizeof(s.section_tags) / sizeof(s.section_tags[0]); i++)
+            fprintf(out, "; starved at offset %lu\n", (unsigned long)s.section_tags[i]);
+        if(fclose(out) != 0) stream->printf("Could not write %s.eta\r\n", fn.c_str());
+    }
+
+    for(auto& r : report) stream->printf("%s\r\n", r);
+    for(unsigned int i = 0; i < s.sections && i < sizeof(s.section_tags) / sizeof(s.section_tags[0]); i++)
+        stream->printf("  starved at offset %lu\r\n", (unsigned long)s.section_tags[i]);
 }
 
 void Player::progress_command( string parameters, StreamOutput *stream )
@@ -298,9 +1170,9 @@ void Player::progress_command( string parameters, StreamOutput *stream )
 
     if(!playing_file && current_file_handler != NULL) {
         if(sdprinting)
-            stream->printf("SD printing byte %lu/%lu\r\n", played_cnt, file_size);
+            stream->printf("SD printing byte %lu/%lu\r\n", file_position(), file_size);
         else
-            stream->printf("SD print is paused at %lu/%lu\r\n", played_cnt, file_size);
+            stream->printf("SD print is paused at %lu/%lu\r\n", file_position(), file_size);
         return;
 
     } else if(!playing_file) {
@@ -309,14 +1181,9 @@ void Player::progress_command( string parameters, StreamOutput *stream )
     }
 
     if(file_size > 0) {
-        unsigned long est = 0;
-        if(this->elapsed_secs > 10) {
-            unsigned long bytespersec = played_cnt / this->elapsed_secs;
-            if(bytespersec > 0)
-                est = (file_size - played_cnt) / bytespersec;
-        }
+        unsigned long est = estimate_remaining();
 
-        unsigned int pcnt = (file_size - (file_size - played_cnt)) * 100 / file_size;
+        unsigned int pcnt = (uint64_t)file_position() * 100 / file_size;
         // If -b or -B is passed, report in the format used by Marlin and the others.
         if (!sdprinting) {
             stream->printf("%u %% complete, elapsed time: %lu s", pcnt, this->elapsed_secs);
@@ -324,8 +1191,13 @@ void Player::progress_command( string parameters, StreamOutput *stream )
                 stream->printf(", est time: %lu s",  est);
             }
             stream->printf("\r\n");
+            if(cache_size > 0 && cache_hits + cache_misses > 0) {
+                stream->printf("Read ahead: %u lines, %lu%% ready when needed, refill avg %lu us max %lu us\r\n",
+                    cache_size, cache_hits * 100 / (cache_hits + cache_misses),
+                    refills > 0 ? refill_total_us / refills : 0, refill_max_us);
+            }
         } else {
-            stream->printf("SD printing byte %lu/%lu\r\n", played_cnt, file_size);
+            stream->printf("SD printing byte %lu/%lu\r\n", file_position(), file_size);
         }
 
     } else {
@@ -341,12 +1213,17 @@ void Player::abort_command( string parameters, StreamOutput *stream )
     }
     suspended= false;
     playing_file = false;
+    // stopped by hand, so the next job is left for a queue start, and the job is still to play
+    jobs_running = false;
+    job_playing = false;
+    checkpoint(true);
     played_cnt = 0;
     file_size = 0;
     this->filename = "";
     this->current_stream = NULL;
     fclose(current_file_handler);
     current_file_handler = NULL;
+    close_scout();
     if(parameters.empty()) {
         // clear out the block queue
         // I think this is a HACK... wait for queue !full as flushing a full queue doesn't work well
@@ -365,6 +1242,75 @@ void Player::abort_command( string parameters, StreamOutput *stream )
     stream->printf("Aborted playing or paused file\r\n");
 }
 
+// before a line or record is played
+void Player::start_playing()
+{
+    if(checkpoint_due) checkpoint(false);
+    THEKERNEL->conveyor->set_source_tag(played_cnt);
+    if(eta_marks.empty()) {
+        eta_start = THEKERNEL->conveyor->get_executed_seconds() + THEKERNEL->conveyor->get_queued_seconds();
+        eta_marks.push_back(0.0F);
+    }
+}
+
+// false at the end of the file
+bool Player::play_line()
+{
+    char *line;
+    int len;
+    bool found;
+    if(cache_count > next_cached) {
+        line = cache[cache_head].text;
+        len = cache[cache_head].len;
+        found = true;
+        cache_hits++;
+    } else if(preloaded) {
+        // the rest of the cache and the reader are the next job's
+        found = false;
+    } else {
+        found = read_line(line, len);
+        if(found && cache_size > 0) cache_misses++;
+    }
+    if(!found) return false;
+
+    this->current_stream->printf("%s\n", line);
+    struct SerialMessage message;
+    message.message = line;
+    message.stream = this->current_stream;
+
+    // the slot is free once copied, on_idle will refill it while we wait below
+    if(cache_count > 0) {
+        cache_head = (cache_head + 1) % cache_size;
+        cache_count--;
+    }
+
+    start_playing();
+    // waits for the queue to have enough room
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    played_cnt += len;
+    mark_eta();
+
+    // the queue has just taken a line so it is as full as it gets, the best time to read the card
+    reader.fill_ahead();
+    return true;
+}
+
+// the moves are already tokenized so they skip the parser and go straight to the modules that take G0 and G1,
+// false at the end of the file or its end record
+bool Player::play_record()
+{
+    int len;
+    const uint8_t *record = records.next(len);
+    if(record == nullptr) return false;
+
+    start_playing();
+    // waits for the queue to have enough room
+    bool more = BinaryGcode::run_record(record, this->current_stream);
+    played_cnt += len;
+    mark_eta();
+    return more;
+}
+
 void Player::on_main_loop(void *argument)
 {
     if(suspended && suspend_loops > 0) {
@@ -384,42 +1330,22 @@ void Player::on_main_loop(void *argument)
         }
     }
 
+    if(!this->playing_file && !this->suspended && this->jobs_running && !halted && !this->jobs.empty()) {
+        start_next_job();
+        return;
+    }
+
     if( this->playing_file ) {
         if(halted) {
             abort_command("1", &(StreamOutput::NullStream));
             return;
         }
 
-        char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
-        bool discard = false;
-
-        while(fgets(buf, sizeof(buf), this->current_file_handler) != NULL) {
-            int len = strlen(buf);
-            if(len == 0) continue; // empty line? should not be possible
-            if(buf[len - 1] == '\n' || feof(this->current_file_handler)) {
-                if(discard) { // we are discarding a long line
-                    discard = false;
-                    continue;
-                }
-                if(len == 1) continue; // empty line
-
-                this->current_stream->printf("%s", buf);
-                struct SerialMessage message;
-                message.message = buf;
-                message.stream = this->current_stream;
-
-                // waits for the queue to have enough room
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
-                played_cnt += len;
-                return; // we feed one line per main loop
-
-            } else {
-                // discard long line
-                this->current_stream->printf("Warning: Discarded long line\n");
-                discard = true;
-            }
-        }
+        // we feed one line per main loop
+        if(binary ? play_record() : play_line()) return;
 
+        save_eta_index();
+        checkpoint(true);
         this->playing_file = false;
         this->filename = "";
         played_cnt = 0;
@@ -427,12 +1353,17 @@ void Player::on_main_loop(void *argument)
         fclose(this->current_file_handler);
         current_file_handler = NULL;
         this->current_stream = NULL;
+        close_scout();
 
         if(this->reply_stream != NULL) {
             // if we were printing from an M command from pronterface we need to send this back
             this->reply_stream->printf("Done printing file\r\n");
+            if(THEKERNEL->conveyor->has_drains()) THEKERNEL->conveyor->print_drains(this->reply_stream);
+            if(THEKERNEL->conveyor->has_underruns()) THEKERNEL->conveyor->print_underruns(this->reply_stream);
             this->reply_stream = NULL;
         }
+        if(this->job_playing) finish_job();
+        if(this->jobs_running) this->between_due = true;
     }
 }
 
@@ -452,7 +1383,7 @@ void Player::on_get_public_data(void *argument)
         static struct pad_progress p;
         if(file_size > 0 && playing_file) {
             p.elapsed_secs = this->elapsed_secs;
-            p.percent_complete = (this->file_size - (this->file_size - this->played_cnt)) * 100 / this->file_size;
+            p.percent_complete = (uint64_t)file_position() * 100 / this->file_size;
             p.filename = this->filename;
             pdr->set_data_ptr(&p);
             pdr->set_taken();
@@ -492,9 +1423,15 @@ void Player::suspend_command(string parameters, StreamOutput *stream )
         return;
     }
 
+    if(this->playing_file && !compressed && !binary && extract_options(parameters).find_first_of("Qq") != string::npos) {
+        quick_suspend(stream);
+        return;
+    }
+
     stream->printf("ok Suspending print, waiting for queue to empty...\n");
 
     suspended= true;
+    this->quick_resume= false;
     if( this->playing_file ) {
         // pause an sd print
         this->playing_file = false;
@@ -510,6 +1447,34 @@ void Player::suspend_command(string parameters, StreamOutput *stream )
     suspend_stream= stream;
 }
 
+// suspend -q, the moves queued past the first line the machine can stop at the end of are dropped, and the file is
+// put back to that line, so it stops about as soon as a feed hold would rather than when the queue runs out
+void Player::quick_suspend(StreamOutput *stream)
+{
+    stream->printf("ok Suspending print at the next line it can stop at...\n");
+
+    suspended= true;
+    this->playing_file = false;
+    this->was_playing_file= true;
+
+    uint32_t tag;
+    unsigned long offset = played_cnt;
+    if(THEKERNEL->robot->drop_merged_line(tag)) offset = tag;
+    if(THEKERNEL->conveyor->truncate_queue(tag)) offset = tag;
+    if(offset < start_offset || offset > played_cnt) offset = played_cnt;
+
+    THEKERNEL->conveyor->wait_for_empty_queue();
+    // what has been dropped never got to the motors, the position is where they stopped
+    THEKERNEL->robot->reset_position_from_current_actuator_position();
+
+    // the lines after it have set the modes the file is in again, so they are put back to how they were there on resume
+    this->quick_resume = start_part_way(0, 0, offset, quick_state, stream);
+    if(!this->quick_resume) stream->printf("Could not go back to the line at %lu, it will carry on from %lu\n", offset, played_cnt);
+
+    suspend_stream= stream;
+    suspend_part2();
+}
+
 // this completes the suspend
 void Player::suspend_part2()
 {
@@ -551,31 +1516,128 @@ void Player::suspend_part2()
 
     // execute optional gcode if defined
     if(!after_suspend_gcode.empty()) {
-        struct SerialMessage message;
-        message.message = after_suspend_gcode;
-        message.stream = &(StreamOutput::NullStream);
-        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+        run_gcode(after_suspend_gcode);
     }
 
     suspend_stream->printf("Print Suspended, enter resume to continue printing\n");
 }
 
+// one sector write to the journal, finished marks the file as done with so there is nothing to recover
+void Player::checkpoint(bool finished)
+{
+    checkpoint_due = false;
+    journal_secs = 0;
+    // the offsets are into what is decompressed, which can't be seeked to
+    if(journal_seconds == 0 || file_size == 0 || compressed || binary) return;
+    if(!journal.is_open()) {
+        if(finished) return;
+        if(!journal.open(journal_file.c_str())) {
+            THEKERNEL->streams->printf("Could not open the journal %s, no checkpoints will be saved\r\n", journal_file.c_str());
+            journal_seconds = 0;
+            return;
+        }
+    }
+
+    Journal::Record r;
+    memset(&r, 0, sizeof(r));
+    r.file_size = file_size;
+    // the line the last finished move came from, playing it again is safer than skipping what is left of it
+    uint32_t tag = THEKERNEL->conveyor->get_executed_tag();
+    r.offset = (tag < start_offset || tag > played_cnt) ? start_offset : tag;
+    const MachineStatus *status = THEKERNEL->status;
+    for (int i = 0; i < 3; i++) r.position[i] = status->position[i];
+    r.fan_on = status->fan_on;
+    for (uint8_t i = 0; i < status->heater_count && r.heater_count < Journal::max_heaters; i++) {
+        if(status->heaters[i].target_temperature <= 0) continue;
+        r.heaters[r.heater_count].id = status->heaters[i].id;
+        r.heaters[r.heater_count].target = status->heaters[i].target_temperature;
+        r.heater_count++;
+    }
+    r.finished = finished;
+    strncpy(r.filename, this->filename.c_str(), sizeof(r.filename) - 1);
+    journal.write(r);
+    if(finished) journal.close();
+}
+
 /**
-resume the suspended print
-1. restore the temperatures and wait for them to get up to temp
-2. optionally run before_resume gcode if specified
-3. restore the position it was at and E and any other saved state
-4. resume sd print or send resume upstream
+recover a file that was being played when the power went, from the journal
+1. heat up to the temperatures it had and set the fan
+2. run recover_gcode, which should home X and Y, Z can't be homed with a print on the bed and is taken to be where it was
+3. carry on from the line the last finished move came from, with the modes and extruder position the file had there
 */
-void Player::resume_command(string parameters, StreamOutput *stream )
+void Player::recover_command( string parameters, StreamOutput *stream )
 {
-    if(!suspended) {
-        stream->printf("Not suspended\n");
+    if(this->playing_file || this->suspended) {
+        stream->printf("Currently printing, abort print first\r\n");
         return;
     }
 
-    stream->printf("ok resuming print...\n");
+    Journal::Record r;
+    if(journal_file.empty() || !Journal::read(journal_file.c_str(), r) || r.finished) {
+        stream->printf("Nothing to recover\r\n");
+        return;
+    }
+    if(parameters.find("-y") == string::npos) {
+        stream->printf("%s was stopped at byte %lu of %lu, Z %1.3f, enter recover -y to carry on printing it\r\n",
+                       r.filename, (unsigned long)r.offset, (unsigned long)r.file_size, r.position[2]);
+        return;
+    }
 
+    if(this->current_file_handler != NULL) fclose(this->current_file_handler);
+    this->filename = r.filename;
+    this->current_file_handler = open_file(this->filename);
+    if(this->current_file_handler == NULL) {
+        stream->printf("File not found: %s\r\n", this->filename.c_str());
+        return;
+    }
+    if(this->file_size != r.file_size) {
+        stream->printf("%s has changed since it was stopped\r\n", this->filename.c_str());
+        fclose(this->current_file_handler);
+        this->current_file_handler = NULL;
+        this->file_size = 0;
+        return;
+    }
+
+    GcodeIndex::State s;
+    if(!start_part_way(0, 0, r.offset, s, stream)) {
+        fclose(this->current_file_handler);
+        this->current_file_handler = NULL;
+        this->file_size = 0;
+        return;
+    }
+
+    this->saved_temperatures.clear();
+    for (uint8_t i = 0; i < r.heater_count && i < Journal::max_heaters; i++) this->saved_temperatures[r.heaters[i].id] = r.heaters[i].target;
+    heat_and_wait(stream);
+    this->saved_temperatures.clear();
+
+    if(r.fan_on) {
+        bool on = true;
+        PublicData::set_value(switch_checksum, fan_checksum, state_checksum, &on);
+    }
+
+    struct SerialMessage message;
+    message.stream = &(StreamOutput::NullStream);
+    if(!recover_gcode.empty()) {
+        message.message = recover_gcode;
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    }
+    char buf[32];
+    snprintf(buf, sizeof(buf), "G92 Z%1.3f", s.z);
+    message.message = buf;
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    restore_modes(s);
+
+    stream->printf("Recovering %s\r\n", this->filename.c_str());
+    this->current_stream = &(StreamOutput::NullStream);
+    this->reply_stream = THEKERNEL->streams;
+    this->elapsed_secs = 0;
+    this->playing_file = true;
+}
+
+// set the heaters in saved_temperatures back to their targets and wait for them to get there
+void Player::heat_and_wait(StreamOutput *stream)
+{
     // set heaters to saved temps
     for(auto& h : this->saved_temperatures) {
         float t= h.second;
@@ -610,14 +1672,30 @@ void Player::resume_command(string parameters, StreamOutput *stream )
                 THEKERNEL->call_event(ON_IDLE, this);
         }
     }
+}
+
+/**
+resume the suspended print
+1. restore the temperatures and wait for them to get up to temp
+2. optionally run before_resume gcode if specified
+3. restore the position it was at and E and any other saved state
+4. resume sd print or send resume upstream
+*/
+void Player::resume_command(string parameters, StreamOutput *stream )
+{
+    if(!suspended) {
+        stream->printf("Not suspended\n");
+        return;
+    }
+
+    stream->printf("ok resuming print...\n");
+
+    heat_and_wait(stream);
 
     // execute optional gcode if defined
     if(!before_resume_gcode.empty()) {
         stream->printf("Executing before resume gcode...\n");
-        struct SerialMessage message;
-        message.message = before_resume_gcode;
-        message.stream = &(StreamOutput::NullStream);
-        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+        run_gcode(before_resume_gcode);
     }
 
     // Restore position
@@ -634,6 +1712,10 @@ void Player::resume_command(string parameters, StreamOutput *stream )
 
     // restore extruder state
     PublicData::set_value( extruder_checksum, restore_state_checksum, nullptr );
+    if(this->quick_resume) {
+        restore_modes(quick_state);
+        this->quick_resume = false;
+    }
 
     stream->printf("Resuming print\n");
 
@@ -10,6 +10,11 @@
 #define PLAYER_H
 
 #include "Module.h"
+#include "LineReader.h"
+#include "GcodeIndex.h"
+#include "Journal.h"
+#include "MacroCache.h"
+#include "RecordReader.h"
 
 #include <stdio.h>
 #include <string>
@@ -18,6 +23,7 @@
 using std::string;
 
 class StreamOutput;
+class HeatshrinkDecoder;
 
 class Player : public Module {
     public:
@@ -31,6 +37,7 @@ class Player : public Module {
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
         void on_gcode_received(void *argument);
+        void on_idle(void* argument);
 
     private:
         void play_command( string parameters, StreamOutput* stream );
@@ -38,8 +45,43 @@ class Player : public Module {
         void abort_command( string parameters, StreamOutput* stream );
         void suspend_command( string parameters, StreamOutput* stream );
         void resume_command( string parameters, StreamOutput* stream );
+        void index_command( string parameters, StreamOutput* stream );
+        void preflight_command( string parameters, StreamOutput* stream );
+        void recover_command( string parameters, StreamOutput* stream );
+        void macro_command( string parameters, StreamOutput* stream );
+        void queue_command( string parameters, StreamOutput* stream );
+        void load_jobs();
+        void save_jobs();
+        void start_next_job();
+        void finish_job();
+        string next_job_file() const;
+        void prefetch_job();
+        bool preload_job();
+        void drop_prefetch();
+        bool play_macro(const string& fn, StreamOutput* stream);
+        void run_gcode(const string& gcode);
         string extract_options(string& args);
+        FILE *open_file(const string& fn);
+        bool read_line(char *&line, int &len);
+        void close_scout();
+        void scout_ahead();
+        void quick_suspend(StreamOutput *stream);
         void suspend_part2();
+        void heat_and_wait(StreamOutput *stream);
+        void checkpoint(bool finished);
+        bool start_part_way(unsigned long line, unsigned long layer, unsigned long offset, GcodeIndex::State& s, StreamOutput *stream);
+        void seek_to(unsigned long offset);
+        void restore_modes(const GcodeIndex::State& s);
+        void load_eta_index(const string& fn);
+        void save_eta_index();
+        void mark_eta();
+        unsigned long estimate_remaining();
+        static bool is_compressed(const string& fn);
+        static bool is_binary(const string& fn);
+        void start_playing();
+        bool play_line();
+        bool play_record();
+        unsigned long file_position() const;
 
         string filename;
         string after_suspend_gcode;
@@ -50,11 +92,72 @@ class Player : public Module {
         StreamOutput* suspend_stream;
 
         FILE* current_file_handler;
+        LineReader reader;
+        HeatshrinkDecoder *decoder;     // for .hs files, made the first time one is played
+        uint8_t heatshrink_window, heatshrink_lookahead;
+        RecordReader records;           // for .gbin files, instead of reader
+
+        // lines read ahead of the planner, topped up in on_idle while the conveyor is full so the next
+        // one is ready as soon as there is room
+        struct CachedLine {
+            char text[LineReader::max_line + 1];
+            uint32_t len;                   // what the line and any skipped before it took up in the file
+        };
+        CachedLine *cache;
+        uint8_t cache_size;
+        uint8_t cache_head;
+        uint8_t cache_count;
+        uint32_t cache_hits, cache_misses;
+        uint32_t refills, refill_total_us, refill_max_us;
+
+        // a second reader going through the file ahead of the player, looking for tool changes to preheat for
+        FILE* scout_file;
+        LineReader *scout;
+        unsigned long scout_cnt;        // how far into the file it has got
+        float tool_preheat_seconds;
+        int scout_tool;                 // the tool the file has changed to by scout_cnt
+        int pending_tool;               // a tool change the scout found, waiting for the temperature set after it
+        uint8_t pending_lines;
         unsigned long file_size, played_cnt;
+        unsigned long start_offset;     // where in the file playing started
+        unsigned long index_every;      // lines between the entries of a GcodeIndex
+
+        // planned motion seconds at every percent of the file, recorded as it plays and saved next to it as
+        // <file>.eta so the next time it is played the estimate comes from the whole file
+        std::vector<float> eta_marks;
+        std::vector<float> eta_index;   // what was saved, for a file of eta_size bytes
+        unsigned long eta_size;
+        float eta_start;                // planned motion seconds when the first line was played
+
+        // where a file being played has got to, written every journal_seconds and at each layer change
+        Journal journal;
+        string journal_file;
+        string recover_gcode;
+        unsigned int journal_seconds;   // 0 for no journal
+        unsigned int journal_secs;      // since the last checkpoint
         unsigned long elapsed_secs;
         float saved_position[3];
         float saved_feed_rate;
         std::map<uint16_t, float> saved_temperatures;
+        GcodeIndex::State quick_state;  // what the file had set up by the line a quick suspend went back to
+
+        // small files played whole with the macro command or M98, kept in RAM between plays
+        MacroCache macros;
+
+        // files to play one after the other, kept in jobs_file so the queue outlives a reset
+        struct Job {
+            string fn;
+            uint16_t count;             // times still to play it
+        };
+        std::vector<Job> jobs;
+        string jobs_file;
+        string between_jobs_gcode;      // a line of gcode or a macro file, played before each job after the first
+        // the next job opened once the one playing has been read to its end, so it starts without a directory search,
+        // and its first next_cached lines read into the cache behind the last lines of the one playing
+        FILE* next_file;
+        string next_filename;
+        unsigned long next_size;
+        uint8_t next_cached;
         struct {
             bool on_boot_gcode_enable:1;
             bool booted:1;
@@ -65,6 +168,15 @@ class Player : public Module {
             bool saved_absolute_mode:1;
             bool was_playing_file:1;
             uint8_t suspend_loops:4;
+            bool refilling:1;
+            bool checkpoint_due:1;
+            bool compressed:1;
+            bool binary:1;
+            bool quick_resume:1;
+            bool jobs_running:1;        // start the next job when nothing is playing
+            bool between_due:1;         // a job from the queue has finished since the last between_jobs_gcode
+            bool job_playing:1;         // the file playing is the first job on the queue
+            bool preloaded:1;           // the reader has gone on to next_file
         };
 };
 
@@ -0,0 +1,68 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RecordReader.h"
+
+#include "modules/communication/utils/BinaryGcode.h"
+#include "platform_memory.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+RecordReader::RecordReader()
+{
+    buffer = nullptr;
+    fd = nullptr;
+    pos = filled = 0;
+    eof = true;
+}
+
+bool RecordReader::start(FILE *fd)
+{
+    if(buffer == nullptr) {
+        // kept once allocated, like the line reader's
+        buffer = (uint8_t *)AHB1.alloc(buffer_size);
+        if(buffer == nullptr) buffer = (uint8_t *)AHB0.alloc(buffer_size);
+        if(buffer == nullptr) buffer = (uint8_t *)malloc(buffer_size);
+        if(buffer == nullptr) return false;
+    }
+
+    this->fd = fd;
+    pos = filled = 0;
+    eof = false;
+
+    char magic[sizeof(BinaryGcode::job_magic)];
+    if(fread(magic, 1, sizeof(magic), fd) != sizeof(magic) || memcmp(magic, BinaryGcode::job_magic, sizeof(magic)) != 0) {
+        this->fd = nullptr;
+        eof = true;
+        return false;
+    }
+    return true;
+}
+
+const uint8_t *RecordReader::next(int &len)
+{
+    if(fd == nullptr) return nullptr;
+
+    int n = BinaryGcode::record_length(buffer + pos, buffer + filled);
+    if(n == 0 && !eof) {
+        // the buffer is always bigger than a record, so moving what is left down makes room for the rest of it
+        memmove(buffer, buffer + pos, filled - pos);
+        filled -= pos;
+        pos = 0;
+        int r = fread(buffer + filled, 1, buffer_size - filled, fd);
+        if(r < buffer_size - filled) eof = true;
+        filled += r;
+        n = BinaryGcode::record_length(buffer + pos, buffer + filled);
+    }
+    if(n == 0) return nullptr;
+
+    const uint8_t *record = buffer + pos;
+    pos += n;
+    len = n;
+    return record;
+}
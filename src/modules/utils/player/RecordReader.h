@@ -0,0 +1,37 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RECORDREADER_H
+#define RECORDREADER_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * Reads the records of a binary job file (see BinaryGcode.h) out of a buffer in AHB SRAM, which is topped up with
+ * one fread of what the records handed out have made room for whenever the next one isn't all there.
+ */
+class RecordReader {
+    public:
+        RecordReader();
+
+        // false if fd doesn't start with the job file header
+        bool start(FILE *fd);
+        // the next whole record, nullptr at the end of the file or at one that is cut short or unknown
+        const uint8_t *next(int &len);
+
+    private:
+        static const int buffer_size = 2048;
+
+        uint8_t *buffer;
+        FILE *fd;
+        int pos;                // the next record
+        int filled;             // bytes in the buffer
+        bool eof;
+};
+
+#endif
@@ -12,23 +12,39 @@
 #include "libs/utils.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
+#include "StreamOutputPool.h"
 #include "modules/robot/Conveyor.h"
+#include "modules/robot/Planner.h"
+#include "modules/communication/SerialConsole.h"
+#include "modules/communication/GcodeDispatch.h"
 #include "DirHandle.h"
 #include "mri.h"
 #include "version.h"
 #include "PublicDataRequest.h"
-#include "FileStream.h"
+#include "SectorWriter.h"
 #include "checksumm.h"
 #include "PublicData.h"
 #include "Gcode.h"
+#include "IsrProfiler.h"
+#include "EventTrace.h"
+#include "Benchmark.h"
 //#include "StepTicker.h"
 
 #include "modules/tools/temperaturecontrol/TemperatureControlPublicAccess.h"
 #include "modules/robot/RobotPublicAccess.h"
 #include "NetworkPublicAccess.h"
 #include "platform_memory.h"
+#include "SlabPool.h"
+#include "SlowTicker.h"
 #include "SwitchPublicAccess.h"
 #include "SDFAT.h"
+#include "SDCard.h"
+#include "AppendFileStream.h"
+#include "BufferedFileStream.h"
+#include "OutputJob.h"
+#include "LoopMonitor.h"
+#include "md5.h"
+#include "us_ticker_api.h"
 
 #include "system_LPC17xx.h"
 #include "LPC17xx.h"
@@ -39,10 +55,13 @@ extern unsigned int g_maximumHeapAddress;
 #include <mri.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
 
 extern "C" uint32_t  __end__;
 extern "C" uint32_t  __malloc_free_list;
 extern "C" uint32_t  _sbrk(int size);
+extern unsigned int __StackTop;
 
 // command lookup table
 const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
@@ -67,15 +86,42 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"load",     SimpleShell::load_command},
     {"save",     SimpleShell::save_command},
     {"remount",  SimpleShell::remount_command},
+    {"prof",     SimpleShell::prof_command},
+    {"boottime", SimpleShell::boottime_command},
+    {"looptime", SimpleShell::looptime_command},
+    {"cpu",      SimpleShell::cpu_command},
+    {"rxspace",  SimpleShell::rxspace_command},
+    {"sdbench",  SimpleShell::sdbench_command},
+    {"md5sum",   SimpleShell::md5sum_command},
+    {"fwdiff",   SimpleShell::fwdiff_command},
+    {"trace",    SimpleShell::trace_command},
+    {"bench",    SimpleShell::bench_command},
+    {"log",      SimpleShell::log_command},
 
     // unknown command
     {NULL, NULL}
 };
 
 int SimpleShell::reset_delay_secs = 0;
+int SimpleShell::mem_log_secs = 0;
+int SimpleShell::mem_log_countdown = 0;
+AppendFileStream *SimpleShell::log_stream = nullptr;
+
+// free heap chunks are counted by size in these buckets, the last one is everything bigger
+static const uint32_t free_chunk_buckets[] = {64, 256, 1024, 4096};
+#define FREE_CHUNK_BUCKETS (sizeof(free_chunk_buckets) / sizeof(free_chunk_buckets[0]) + 1)
+
+struct heap_stats {
+    uint32_t used;
+    uint32_t free;
+    uint32_t largest;
+    uint32_t chunks[FREE_CHUNK_BUCKETS];
+};
+
+static void mem_log(StreamOutput *stream);
 
 // Adam Greens heap walk from http://mbed.org/forum/mbed/topic/2701/?page=4#comment-22556
-static uint32_t heapWalk(StreamOutput *stream, bool verbose)
+static uint32_t heapWalk(StreamOutput *stream, bool verbose, heap_stats &st)
 {
     uint32_t chunkNumber = 1;
     // The __end__ linker symbol points to the beginning of the heap.
@@ -87,8 +133,9 @@ static uint32_t heapWalk(StreamOutput *stream, bool verbose)
     // accumulate totals
     uint32_t freeSize = 0;
     uint32_t usedSize = 0;
+    memset(&st, 0, sizeof(st));
 
-    stream->printf("Used Heap Size: %lu\n", heapEnd - chunkCurr);
+    if (stream != NULL) stream->printf("Used Heap Size: %lu\n", heapEnd - chunkCurr);
 
     // Walk through the chunks until we hit the end of the heap.
     while (chunkCurr < heapEnd) {
@@ -116,29 +163,63 @@ static uint32_t heapWalk(StreamOutput *stream, bool verbose)
         // newlib-nano over allocates by 8 bytes, 4 bytes for the 32-bit chunk size and another 4 bytes to allow for 8
         // byte-alignment of the returned pointer.
         chunkSize -= 8;
-        if (verbose)
+        if (verbose && stream != NULL)
             stream->printf("  Chunk: %lu  Address: 0x%08lX  Size: %lu  %s\n", chunkNumber, chunkCurr, chunkSize, isChunkFree ? "CHUNK FREE" : "");
 
-        if (isChunkFree) freeSize += chunkSize;
-        else usedSize += chunkSize;
+        if (isChunkFree) {
+            freeSize += chunkSize;
+            if (chunkSize > st.largest) st.largest = chunkSize;
+            size_t b = 0;
+            while (b < FREE_CHUNK_BUCKETS - 1 && chunkSize >= free_chunk_buckets[b]) b++;
+            st.chunks[b]++;
+        } else {
+            usedSize += chunkSize;
+        }
 
         chunkCurr = chunkNext;
         chunkNumber++;
     }
-    stream->printf("Allocated: %lu, Free: %lu\r\n", usedSize, freeSize);
+    if (stream != NULL) stream->printf("Allocated: %lu, Free: %lu\r\n", usedSize, freeSize);
+    st.used = usedSize;
+    st.free = freeSize;
     return freeSize;
 }
 
+// the RAM between the heap limit and the stack was filled with 0xdeadbeef at boot, the deepest the stack has been is
+// where that stops. Returns the bytes of stack used at worst, and the size of the stack
+static uint32_t stack_high_water(uint32_t &size)
+{
+    size = 0;
+    if (g_maximumHeapAddress == 0) return 0; // no stack limit was set, so nowhere to start looking
+
+    // skip the MPU guard region just above the heap limit, touching it faults
+    uint32_t *p = (uint32_t *)(g_maximumHeapAddress + 32);
+    uint32_t *top = (uint32_t *)&__StackTop;
+    size = (uint32_t)top - (uint32_t)p;
+    while (p < top && *p == 0xdeadbeef) p++;
+    return (uint32_t)top - (uint32_t)p;
+}
+
 
 void SimpleShell::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
-    this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_gcodes('M', {20, 30, 501, 504});
+#ifdef BENCHMARK
+    this->register_for_gcodes('M', {415});
+#endif
     this->register_for_event(ON_SECOND_TICK);
+    this->register_for_main_loop(MAIN_LOOP_HOUSEKEEPING, "output jobs");
 
     reset_delay_secs = 0;
 }
 
+// what ls and cat have still to write goes out as the streams take it
+void SimpleShell::on_main_loop(void *)
+{
+    OutputJob::run_pending();
+}
+
 void SimpleShell::on_second_tick(void *)
 {
     // we are timing out for the reset
@@ -147,6 +228,14 @@ void SimpleShell::on_second_tick(void *)
             system_reset(false);
         }
     }
+
+    // the log goes to the consoles rather than the stream that asked, which may have gone by then
+    if (mem_log_secs > 0 && --mem_log_countdown <= 0) {
+        mem_log_countdown = mem_log_secs;
+        mem_log(THEKERNEL->streams);
+    }
+
+    AppendFileStream::flush_stale();
 }
 
 void SimpleShell::on_gcode_received(void *argument)
@@ -157,8 +246,13 @@ void SimpleShell::on_gcode_received(void *argument)
     if (gcode->has_m) {
         if (gcode->m == 20) { // list sd card
             gcode->mark_as_taken();
+            // the list has to be all there before the ok
             gcode->stream->printf("Begin file list\r\n");
-            ls_command("/sd", gcode->stream);
+            OutputJob *job = ls_job("/sd", gcode->stream);
+            if(job != nullptr) {
+                while(job->write_next(gcode->stream)) ;
+                delete job;
+            }
             gcode->stream->printf("End file list\r\n");
 
         } else if (gcode->m == 30) { // remove file
@@ -180,6 +274,15 @@ void SimpleShell::on_gcode_received(void *argument)
             } else {
                 save_command("/sd/config-override." + args, gcode->stream);
             }
+
+#ifdef BENCHMARK
+        } else if(gcode->m == 415) { // M415 S<moves> times planning each set of synthetic moves, with nothing stepped
+            gcode->mark_as_taken();
+            THEKERNEL->conveyor->wait_for_empty_queue();
+            if(!THEKERNEL->conveyor->is_halted()) {
+                Benchmark::planner(gcode->has_letter('S') ? gcode->get_value('S') : 500, gcode->stream);
+            }
+#endif
         }
     }
 }
@@ -210,13 +313,55 @@ void SimpleShell::on_console_line_received( void *argument )
     //new_message.stream->printf("Received %s\r\n", possible_command.c_str());
     string cmd = shift_parameter(possible_command);
 
+    // command >> file appends what the command prints to the file instead
+    size_t redirect = possible_command.find(">>");
+    if(redirect != string::npos) {
+        string fn = possible_command.substr(redirect + 2);
+        possible_command.erase(redirect);
+        AppendFileStream out(absolute_from_relative(shift_parameter(fn)).c_str(), true);
+        parse_command(cmd.c_str(), possible_command, &out);
+        if(!out.flush() || out.get_dropped() > 0) new_message.stream->printf("error writing to %s\r\n", out.get_filename());
+        return;
+    }
+
     // find command and execute it
     parse_command(cmd.c_str(), possible_command, new_message.stream);
 }
 
+// a directory entry a piece
+class LsJob : public OutputJob {
+    public:
+        LsJob(DIR *d, bool sizes) : d(d), sizes(sizes) {}
+        ~LsJob() { closedir(d); }
+        bool write_next(StreamOutput *stream)
+        {
+            struct dirent *p = readdir(d);
+            if(p == NULL) return false;
+            string name = lc(string(p->d_name));
+            if(p->d_isdir) {
+                stream->printf("%s/\r\n", name.c_str());
+            } else if(sizes) {
+                stream->printf("%s %d\r\n", name.c_str(), p->d_fsize);
+            } else {
+                stream->printf("%s\r\n", name.c_str());
+            }
+            return true;
+        }
+
+    private:
+        DIR *d;
+        bool sizes;
+};
+
 // Act upon an ls command
 // Convert the first parameter into an absolute path, then list the files in that path
 void SimpleShell::ls_command( string parameters, StreamOutput *stream )
+{
+    OutputJob *job = ls_job(parameters, stream);
+    if(job != nullptr) OutputJob::start(job, stream);
+}
+
+OutputJob *SimpleShell::ls_job( string parameters, StreamOutput *stream )
 {
     string path, opts;
     while(!parameters.empty()) {
@@ -235,23 +380,12 @@ void SimpleShell::ls_command( string parameters, StreamOutput *stream )
 
     path = absolute_from_relative(path);
 
-    DIR *d;
-    struct dirent *p;
-    d = opendir(path.c_str());
-    if (d != NULL) {
-        while ((p = readdir(d)) != NULL) {
-            stream->printf("%s", lc(string(p->d_name)).c_str());
-            if(p->d_isdir) {
-                stream->printf("/");
-            } else if(opts.find("-s", 0, 2) != string::npos) {
-                stream->printf(" %d", p->d_fsize);
-            }
-            stream->printf("\r\n");
-        }
-        closedir(d);
-    } else {
+    DIR *d = opendir(path.c_str());
+    if (d == NULL) {
         stream->printf("Could not open directory %s\r\n", path.c_str());
+        return nullptr;
     }
+    return new LsJob(d, opts.find("-s", 0, 2) != string::npos);
 }
 
 extern SDFAT mounter;
@@ -262,6 +396,224 @@ void SimpleShell::remount_command( string parameters, StreamOutput *stream )
     stream->printf("remounted\r\n");
 }
 
+// copy everything sent to the consoles to a file, in sectors so logging a whole print costs little
+void SimpleShell::log_command( string parameters, StreamOutput *stream )
+{
+    string arg = shift_parameter(parameters);
+    if(arg.empty()) {
+        if(log_stream == nullptr) stream->printf("not logging\r\n");
+        else stream->printf("logging to %s, %lu bytes dropped\r\n", log_stream->get_filename(), log_stream->get_dropped());
+        return;
+    }
+
+    if(log_stream != nullptr) {
+        THEKERNEL->streams->remove_stream(log_stream);
+        delete log_stream;
+        log_stream = nullptr;
+    }
+    if(arg == "off") {
+        stream->printf("log off\r\n");
+        return;
+    }
+
+    log_stream = new AppendFileStream(absolute_from_relative(arg).c_str(), true, 5000);
+    THEKERNEL->streams->append_stream(log_stream);
+    stream->printf("logging to %s\r\n", log_stream->get_filename());
+}
+
+extern SDCard sd;
+
+// time writing a file to the card and reading it back, in the chunks a big upload or play would use
+void SimpleShell::sdbench_command( string parameters, StreamOutput *stream )
+{
+    if(!THEKERNEL->conveyor->is_queue_empty()) {
+        stream->printf("sdbench not allowed while printing or busy\r\n");
+        return;
+    }
+
+    string size = shift_parameter(parameters);
+    uint32_t kb = size.empty() ? 1024 : strtoul(size.c_str(), NULL, 10);
+    if(kb == 0) kb = 1024;
+
+    // in AHB SRAM the reads go straight to the buffer by DMA, as they would for the player
+    const uint32_t chunk = 4096;
+    char *buf = (char *)AHB0.alloc(chunk);
+    bool ahb = (buf != NULL);
+    if(!ahb) buf = (char *)malloc(chunk);
+    if(buf == NULL) {
+        stream->printf("not enough memory for sdbench\r\n");
+        return;
+    }
+    for (uint32_t i = 0; i < chunk; i++) buf[i] = i;
+
+    const char *fn = "/sd/sdbench.tmp";
+    const uint32_t chunks = (kb * 1024 + chunk - 1) / chunk;
+    uint32_t n = 0, write_us = 0, read_us = 0;
+    bool ok = false;
+
+    FILE *fd = fopen(fn, "w");
+    if(fd != NULL) {
+        setvbuf(fd, NULL, _IONBF, 0);
+        uint32_t start = us_ticker_read();
+        for (n = 0; n < chunks && fwrite(buf, chunk, 1, fd) == 1; n++) THEKERNEL->call_event(ON_IDLE);
+        ok = (fclose(fd) == 0 && n == chunks);
+        write_us = us_ticker_read() - start;
+    }
+
+    if(ok && (fd = fopen(fn, "r")) != NULL) {
+        setvbuf(fd, NULL, _IONBF, 0);
+        uint32_t start = us_ticker_read();
+        for (n = 0; n < chunks && fread(buf, chunk, 1, fd) == 1; n++) THEKERNEL->call_event(ON_IDLE);
+        read_us = us_ticker_read() - start;
+        fclose(fd);
+        ok = (n == chunks);
+    } else {
+        ok = false;
+    }
+    remove(fn);
+
+    if(ahb) AHB0.dealloc(buf);
+    else free(buf);
+
+    if(!ok) {
+        stream->printf("sdbench failed after %lu of %lu KB\r\n", n * chunk / 1024, chunks * chunk / 1024);
+        return;
+    }
+
+    float bytes = chunks * chunk;
+    stream->printf("SD clock %1.2f MHz, %lu KB in %lu byte chunks\r\n", sd.frequency() / 1e6F, chunks * chunk / 1024, chunk);
+    stream->printf("write %1.1f KB/s, read %1.1f KB/s\r\n", bytes / 1024 / (write_us / 1e6F), bytes / 1024 / (read_us / 1e6F));
+}
+
+// md5sum file [bytes], the md5 of the file or of its first bytes, and how many bytes that was
+void SimpleShell::md5sum_command( string parameters, StreamOutput *stream )
+{
+    string filename = absolute_from_relative(shift_parameter(parameters));
+    string limit = shift_parameter(parameters);
+    uint32_t left = limit.empty() ? ~0UL : strtoul(limit.c_str(), NULL, 10);
+
+    FILE *fd = fopen(filename.c_str(), "r");
+    if(fd == NULL) {
+        stream->printf("File not found: %s\r\n", filename.c_str());
+        return;
+    }
+
+    // whole sectors into AHB SRAM, so the card reads go straight to the buffer as for sdbench
+    const uint32_t chunk = 4096;
+    char *buf = (char *)AHB0.alloc(chunk);
+    bool ahb = (buf != NULL);
+    if(!ahb) buf = (char *)malloc(chunk);
+    if(buf == NULL) {
+        fclose(fd);
+        stream->printf("not enough memory for md5sum\r\n");
+        return;
+    }
+    setvbuf(fd, NULL, _IONBF, 0);
+
+    MD5 md5;
+    uint32_t total = 0;
+    size_t n;
+    while(left > 0 && (n = fread(buf, 1, left < chunk ? left : chunk, fd)) > 0) {
+        md5.update(buf, n);
+        total += n;
+        left -= n;
+        THEKERNEL->call_event(ON_IDLE);
+    }
+    fclose(fd);
+    if(ahb) AHB0.dealloc(buf);
+    else free(buf);
+
+    stream->printf("%s %lu %s\r\n", md5.finalize().hexdigest().c_str(), total, filename.c_str());
+}
+
+// the firmware starts after the 16K bootloader, the flash sectors are 4K up to 64K and 32K after that
+#define FIRMWARE_START 0x4000
+#define FIRMWARE_END   0x80000
+static uint32_t flash_sector_end(uint32_t addr)
+{
+    return addr < 0x10000 ? (addr | 0xFFF) + 1 : (addr | 0x7FFF) + 1;
+}
+
+// fwdiff [-r] [file], which flash sectors the bootloader would rewrite to flash /sd/firmware.bin, or file,
+// -r renames it to firmware.cur when it is what is running already, so the next reset does not flash it again
+void SimpleShell::fwdiff_command( string parameters, StreamOutput *stream )
+{
+    bool do_rename = false;
+    string filename = "/sd/firmware.bin";
+    while(!parameters.empty()) {
+        string p = shift_parameter(parameters);
+        if(p == "-r") do_rename = true;
+        else filename = absolute_from_relative(p);
+    }
+
+    FILE *fd = fopen(filename.c_str(), "r");
+    if(fd == NULL) {
+        stream->printf("File not found: %s\r\n", filename.c_str());
+        return;
+    }
+
+    // as for md5sum, 4K at a time is read from the card in one multi block read
+    const uint32_t chunk = 4096;
+    char *buf = (char *)AHB0.alloc(chunk);
+    bool ahb = (buf != NULL);
+    if(!ahb) buf = (char *)malloc(chunk);
+    if(buf == NULL) {
+        fclose(fd);
+        stream->printf("not enough memory for fwdiff\r\n");
+        return;
+    }
+    setvbuf(fd, NULL, _IONBF, 0);
+
+    MD5 md5;
+    uint32_t addr = FIRMWARE_START, sector_start = addr;
+    int sectors = 0, changed = 0;
+    bool sector_changed = false;
+    size_t n;
+    while((n = fread(buf, 1, chunk, fd)) > 0) {
+        md5.update(buf, n);
+        if(addr + n > FIRMWARE_END) {
+            addr += n;
+            break;
+        }
+        if(memcmp(buf, (const void *)addr, n) != 0) sector_changed = true;
+        addr += n;
+        // a chunk never crosses a sector, they are all a multiple of 4K
+        if(addr == flash_sector_end(sector_start)) {
+            sectors++;
+            if(sector_changed) changed++;
+            sector_changed = false;
+            sector_start = addr;
+        }
+        THEKERNEL->call_event(ON_IDLE);
+    }
+    // the last sector the file ends part way into
+    if(addr > sector_start && addr <= FIRMWARE_END) {
+        sectors++;
+        if(sector_changed) changed++;
+    }
+    fclose(fd);
+    if(ahb) AHB0.dealloc(buf);
+    else free(buf);
+
+    uint32_t size = addr - FIRMWARE_START;
+    if(addr > FIRMWARE_END) {
+        stream->printf("%s is %lu bytes, too big for the %lu bytes of flash\r\n", filename.c_str(), size, (uint32_t)(FIRMWARE_END - FIRMWARE_START));
+        return;
+    }
+    stream->printf("%s %lu %s\r\n", md5.finalize().hexdigest().c_str(), size, filename.c_str());
+    if(changed > 0) {
+        stream->printf("%d of %d flash sectors differ\r\n", changed, sectors);
+        return;
+    }
+    stream->printf("the same as the running firmware\r\n");
+    if(do_rename) {
+        string cur = filename.substr(0, filename.find_last_of('/') + 1) + "firmware.cur";
+        remove(cur.c_str());
+        if(rename(filename.c_str(), cur.c_str()) != 0) stream->printf("Could not rename %s to %s\r\n", filename.c_str(), cur.c_str());
+        else stream->printf("renamed to %s\r\n", cur.c_str());
+    }
+}
+
 // Delete a file
 void SimpleShell::rm_command( string parameters, StreamOutput *stream )
 {
@@ -301,6 +653,30 @@ void SimpleShell::pwd_command( string parameters, StreamOutput *stream )
     stream->printf("%s\r\n", THEKERNEL->current_path.c_str());
 }
 
+// a line of the file a piece, a long one in pieces of 80
+class CatJob : public OutputJob {
+    public:
+        CatJob(FILE *lp, int limit) : lp(lp), limit(limit), newlines(0) {}
+        ~CatJob() { fclose(lp); }
+        bool write_next(StreamOutput *stream)
+        {
+            char buf[82];
+            int n = 0, c = 0;
+            while (n < 81 && (c = fgetc(lp)) != EOF) {
+                buf[n++] = c;
+                if (c == '\n') break;
+            }
+            buf[n] = '\0';
+            if (n > 0) stream->puts(buf);
+            return c != EOF && ++newlines != limit;
+        }
+
+    private:
+        FILE *lp;
+        int limit;
+        int newlines;
+};
+
 // Output the contents of a file, first parameter is the filename, second is the limit ( in number of lines to output )
 void SimpleShell::cat_command( string parameters, StreamOutput *stream )
 {
@@ -321,24 +697,7 @@ void SimpleShell::cat_command( string parameters, StreamOutput *stream )
         stream->printf("File not found: %s\r\n", filename.c_str());
         return;
     }
-    string buffer;
-    int c;
-    int newlines = 0;
-    int linecnt = 0;
-    // Print each line of the file
-    while ((c = fgetc (lp)) != EOF) {
-        buffer.append((char *)&c, 1);
-        if ( char(c) == '\n' || ++linecnt > 80) {
-            newlines++;
-            stream->puts(buffer.c_str());
-            buffer.clear();
-            if(linecnt > 80) linecnt = 0;
-        }
-        if ( newlines == limit ) {
-            break;
-        }
-    };
-    fclose(lp);
+    OutputJob::start(new CatJob(lp, limit), stream);
 }
 
 void SimpleShell::upload_command( string parameters, StreamOutput *stream )
@@ -352,15 +711,14 @@ void SimpleShell::upload_command( string parameters, StreamOutput *stream )
 
     // open file to upload to
     string upload_filename = absolute_from_relative( parameters );
-    FILE *fd = fopen(upload_filename.c_str(), "w");
-    if(fd != NULL) {
+    SectorWriter file;
+    if(file.open(upload_filename.c_str())) {
         stream->printf("uploading to file: %s, send control-D or control-Z to finish\r\n", upload_filename.c_str());
     } else {
         stream->printf("failed to open file: %s.\r\n", upload_filename.c_str());
         return;
     }
 
-    int cnt = 0;
     bool uploading = true;
     while(uploading) {
         if(!stream->ready()) {
@@ -372,27 +730,22 @@ void SimpleShell::upload_command( string parameters, StreamOutput *stream )
         char c = stream->_getc();
         if( c == 4 || c == 26) { // ctrl-D or ctrl-Z
             uploading = false;
-            // close file
-            fclose(fd);
-            stream->printf("uploaded %d bytes\n", cnt);
+            // close file, which writes what is left in the buffer
+            if(file.close()) {
+                stream->printf("uploaded ");
+                file.print_stats(stream);
+            } else {
+                stream->printf("error writing to file.\r\n");
+            }
             return;
 
         } else {
-            // write character to file
-            cnt++;
-            if(fputc(c, fd) != c) {
+            // write character to file, it goes to the card a chunk at a time
+            if(!file.write(&c, 1)) {
                 // error writing to file
                 stream->printf("error writing to file. ignoring all characters until EOF\r\n");
-                fclose(fd);
-                fd = NULL;
+                file.close();
                 uploading= false;
-
-            } else {
-                if ((cnt%400) == 0) {
-                    // HACK ALERT to get around fwrite corruption close and re open for append
-                    fclose(fd);
-                    fd = fopen(upload_filename.c_str(), "a");
-                }
             }
         }
     }
@@ -444,38 +797,80 @@ void SimpleShell::save_command( string parameters, StreamOutput *stream )
         filename = THEKERNEL->config_override_filename();
     }
 
-    // replace stream with one that writes to config-override file
-    FileStream *gs = new FileStream(filename.c_str());
-    if(!gs->is_open()) {
-        stream->printf("Unable to open File %s for write\n", filename.c_str());
-        return;
-    }
+    // replace stream with one that collects the settings and writes the file with them in one go
+    BufferedFileStream *gs = new BufferedFileStream(filename.c_str());
 
     // issue a M500 which will store values in the file stream
     Gcode *gcode = new Gcode("M500", gs);
     THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
+    bool ok = gs->close();
     delete gs;
     delete gcode;
+    if(!ok) {
+        stream->printf("Unable to write File %s\n", filename.c_str());
+        return;
+    }
 
     stream->printf("Settings Stored to %s\r\n", filename.c_str());
 }
 
+// one line of the memory figures that matter for sizing buffers, for mem -s
+static void mem_log(StreamOutput *stream)
+{
+    heap_stats st;
+    unsigned long m = g_maximumHeapAddress - (unsigned long)_sbrk(0);
+    heapWalk(NULL, false, st);
+    uint32_t stack_size;
+    uint32_t stack = stack_high_water(stack_size);
+    stream->printf("mem: free %lu largest %lu, stack peak %lu/%lu, AHB0 free %lu peak %lu, AHB1 free %lu peak %lu\r\n",
+                   m + st.free, std::max((uint32_t)m, st.largest), stack, stack_size, AHB0.free(), AHB0.get_peak(), AHB1.free(), AHB1.get_peak());
+}
+
 // show free memory
+// mem [-v] [-s seconds] -v lists every chunk, -s logs a summary to the consoles every so many seconds, -s 0 stops it
 void SimpleShell::mem_command( string parameters, StreamOutput *stream)
 {
-    bool verbose = shift_parameter( parameters ).find_first_of("Vv") != string::npos ;
+    bool verbose = false;
+    while (!parameters.empty()) {
+        string p = shift_parameter( parameters );
+        if (p == "-s") {
+            mem_log_secs = mem_log_countdown = atoi(shift_parameter( parameters ).c_str());
+            stream->printf("mem log %s\r\n", mem_log_secs > 0 ? "on" : "off");
+            return;
+        }
+        if (p.find_first_of("Vv") != string::npos) verbose = true;
+    }
+
     unsigned long heap = (unsigned long)_sbrk(0);
     unsigned long m = g_maximumHeapAddress - heap;
     stream->printf("Unused Heap: %lu bytes\r\n", m);
 
-    uint32_t f = heapWalk(stream, verbose);
+    heap_stats st;
+    uint32_t f = heapWalk(stream, verbose, st);
     stream->printf("Total Free RAM: %lu bytes\r\n", m + f);
 
+    // the unused heap above the last chunk is one free block too
+    uint32_t largest = std::max((uint32_t)m, st.largest);
+    stream->printf("Largest free block: %lu bytes, fragmentation %lu%%\r\n", largest, m + f > 0 ? 100 - (largest * 100) / (m + f) : 0);
+    stream->printf("Free chunks: <%lu:%lu", free_chunk_buckets[0], st.chunks[0]);
+    for (size_t i = 1; i < FREE_CHUNK_BUCKETS - 1; i++)
+        stream->printf(" <%lu:%lu", free_chunk_buckets[i], st.chunks[i]);
+    stream->printf(" >=%lu:%lu\r\n", free_chunk_buckets[FREE_CHUNK_BUCKETS - 2], st.chunks[FREE_CHUNK_BUCKETS - 1]);
+
+    uint32_t stack_size;
+    uint32_t stack = stack_high_water(stack_size);
+    if (stack_size > 0)
+        stream->printf("Stack peak: %lu of %lu bytes\r\n", stack, stack_size);
+
     stream->printf("Free AHB0: %lu, AHB1: %lu\r\n", AHB0.free(), AHB1.free());
+    stream->printf("Peak used AHB0: %lu, AHB1: %lu\r\n", AHB0.get_peak(), AHB1.get_peak());
+    if (mounter.cache_sectors() > 0)
+        stream->printf("SD sector cache: %d sectors, %lu hits, %lu misses\r\n", mounter.cache_sectors(), mounter.cache_hits(), mounter.cache_misses());
     if (verbose) {
         AHB0.debug(stream);
         AHB1.debug(stream);
     }
+    SlabPool::debug_all(stream, verbose);
 }
 
 static uint32_t getDeviceType()
@@ -520,6 +915,103 @@ void SimpleShell::version_command( string parameters, StreamOutput *stream)
     stream->printf("Build version: %s, Build date: %s, MCU: %s, System Clock: %ldMHz\r\n", vers.get_build(), vers.get_build_date(), mcu, SystemCoreClock / 1000000);
 }
 
+// print out the slow ticker hooks, the interrupt handler and kernel event timings, -r resets them afterwards
+void SimpleShell::prof_command( string parameters, StreamOutput *stream)
+{
+    bool reset = shift_parameter(parameters) == "-r";
+    THEKERNEL->slow_ticker->dump(stream, reset);
+#ifdef ISR_PROFILE
+    IsrProfiler::dump(stream);
+    THEKERNEL->dump_event_stats(stream);
+    if(reset) {
+        IsrProfiler::reset();
+        THEKERNEL->reset_event_stats();
+        stream->printf("reset\r\n");
+    }
+#else
+    stream->printf("ISR profiling is not enabled in this build\r\n");
+    if(reset) stream->printf("reset\r\n");
+#endif
+}
+
+// how long each module and each step of starting up took
+void SimpleShell::boottime_command( string parameters, StreamOutput *stream)
+{
+    THEKERNEL->dump_boot_times(stream);
+}
+
+// how long the main loop passes take and the slowest handler, -r resets them afterwards
+void SimpleShell::looptime_command( string parameters, StreamOutput *stream)
+{
+    THEKERNEL->loop_monitor->dump(stream);
+    if(shift_parameter(parameters) == "-r") {
+        THEKERNEL->loop_monitor->reset();
+        stream->printf("reset\r\n");
+    }
+}
+
+// how busy the cpu was over the last second
+void SimpleShell::cpu_command( string parameters, StreamOutput *stream)
+{
+    LoopMonitor *lm= THEKERNEL->loop_monitor;
+    stream->printf("CPU load: %d%%", lm->get_cpu_load());
+    if(lm->get_isr_load() >= 0) {
+        int isr= lm->get_isr_load();
+        stream->printf(", interrupts %d%%, main loop %d%%", isr, std::max(0, lm->get_cpu_load() - isr));
+    }
+    stream->printf(", %lu main loop passes a second, an empty pass takes %luus\r\n", lm->get_passes_per_second(), lm->get_idle_pass_us());
+}
+
+// trace dumps the event trace, trace -c clears it and trace mask <hex> picks the events recorded
+void SimpleShell::trace_command( string parameters, StreamOutput *stream)
+{
+#ifdef EVENT_TRACE
+    string arg = shift_parameter(parameters);
+    if(arg == "-c") {
+        EventTrace::clear();
+        stream->printf("trace cleared\r\n");
+    } else if(arg == "mask") {
+        string m = shift_parameter(parameters);
+        if(!m.empty()) EventTrace::set_mask(strtoul(m.c_str(), NULL, 16));
+        stream->printf("trace mask %lx\r\n", EventTrace::get_mask());
+    } else {
+        EventTrace::dump(stream);
+    }
+#else
+    stream->printf("event tracing is not enabled in this build\r\n");
+#endif
+}
+
+// bench [gcode file] [config file] times the parser, config lookups, pools, rings, median and arm solution
+void SimpleShell::bench_command( string parameters, StreamOutput *stream)
+{
+#ifdef BENCHMARK
+    string gcode = shift_parameter(parameters);
+    string config = shift_parameter(parameters);
+    if(!gcode.empty()) gcode = absolute_from_relative(gcode);
+    config = config.empty() ? "/sd/config" : absolute_from_relative(config);
+    Benchmark::run(gcode.empty() ? nullptr : gcode.c_str(), config.c_str(), stream);
+#else
+    stream->printf("benchmarks are not enabled in this build\r\n");
+#endif
+}
+
+// turn on or off the receive space report after each ok for the stream it is sent on, replies with the buffer size
+void SimpleShell::rxspace_command( string parameters, StreamOutput *stream)
+{
+    string arg = shift_parameter(parameters);
+    if(arg == "on") stream->report_rx_space = true;
+    else if(arg == "off") stream->report_rx_space = false;
+
+    stream->printf("rxspace %s", stream->report_rx_space ? "on" : "off");
+    int bytes = stream->rx_capacity(false);
+    int lines = stream->rx_capacity(true);
+    if(bytes >= 0) stream->printf(" size RX:%d", bytes);
+    if(lines >= 0) stream->printf(" size RXL:%d", lines);
+    stream->printf("\r\n");
+    GcodeDispatch::send_ok(stream);
+}
+
 // Reset the system
 void SimpleShell::reset_command( string parameters, StreamOutput *stream)
 {
@@ -568,6 +1060,20 @@ void SimpleShell::get_command( string parameters, StreamOutput *stream)
         } else {
             stream->printf("get pos command failed\r\n");
         }
+
+    } else if (what == "serial") {
+        THEKERNEL->serial->print_stats(stream);
+
+    } else if (what == "planner") {
+        stream->printf("Blocks recalculated last: %u, max: %u\r\n", THEKERNEL->planner->get_last_recalculate_count(), THEKERNEL->planner->get_max_recalculate_count());
+        stream->printf("Queue full stalls: %u, idle calls while stalled: %u\r\n", THEKERNEL->conveyor->get_full_stalls(), THEKERNEL->conveyor->get_full_stall_idles());
+        THEKERNEL->conveyor->print_drains(stream);
+        THEKERNEL->conveyor->print_underruns(stream);
+        THEKERNEL->planner->reset_recalculate_stats();
+        THEKERNEL->conveyor->reset_stall_stats();
+
+    } else if (what == "routes") {
+        THEKERNEL->gcode_dispatch->dump_routes(stream);
     }
 }
 
@@ -610,26 +1116,46 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
 {
     stream->printf("Commands:\r\n");
     stream->printf("version\r\n");
-    stream->printf("mem [-v]\r\n");
+    stream->printf("mem [-v] [-s seconds] - -s logs a summary every so many seconds, 0 stops it\r\n");
     stream->printf("ls [-s] [folder]\r\n");
     stream->printf("cd folder\r\n");
     stream->printf("pwd\r\n");
     stream->printf("cat file [limit]\r\n");
+    stream->printf("md5sum file [bytes] - md5 of the file, or of its first bytes\r\n");
+    stream->printf("fwdiff [-r] [file] - flash sectors firmware.bin differs in, -r renames it to firmware.cur if none\r\n");
+    stream->printf("trace [-c] [mask hex] - dump the event trace for smoothie-trace.py, -c clears it\r\n");
+    stream->printf("bench [gcode file] [config file] - time the hot library code per op\r\n");
     stream->printf("rm file\r\n");
     stream->printf("mv file newfile\r\n");
     stream->printf("remount\r\n");
-    stream->printf("play file [-v]\r\n");
+    stream->printf("play file [-v] [-l line] [-L layer]\r\n");
+    stream->printf("index file - index the lines and layers of a file for play -l and -L\r\n");
+    stream->printf("preflight file - plan a file without moving for its time and bounds, saved for the progress estimate\r\n");
+    stream->printf("recover [-y] - carry on playing the file the journal says was stopped by a power loss\r\n");
+    stream->printf("macro [file] [-c] - play a small file from the RAM cache, -c empties it\r\n");
+    stream->printf("queue [add file [count]|remove n|clear|start|stop] - jobs played one after the other\r\n");
     stream->printf("progress - shows progress of current play\r\n");
     stream->printf("abort - abort currently playing file\r\n");
     stream->printf("reset - reset smoothie\r\n");
     stream->printf("dfu - enter dfu boot loader\r\n");
     stream->printf("break - break into debugger\r\n");
     stream->printf("config-get [<configuration_source>] <configuration_setting>\r\n");
-    stream->printf("config-set [<configuration_source>] <configuration_setting> <value>\r\n");
+    stream->printf("config-set [<configuration_source>] <configuration_setting> <value> [<setting> <value> ...]\r\n");
     stream->printf("get temp [bed|hotend]\r\n");
     stream->printf("set_temp bed|hotend 185\r\n");
     stream->printf("get pos\r\n");
+    stream->printf("get serial - shows uart receive buffer use and error counts\r\n");
+    stream->printf("get planner - shows blocks touched by planner recalculation and queue full stalls\r\n");
+    stream->printf("get routes - shows which modules each G and M code is sent to\r\n");
     stream->printf("net\r\n");
+    stream->printf("prof [-r] - shows slow ticker hook overruns, interrupt handler and event cycle counts, -r resets them\r\n");
+    stream->printf("boottime - shows how long each module and each step of starting up took\r\n");
+    stream->printf("looptime [-r] - shows how long main loop passes take and the slowest handlers, -r resets them\r\n");
+    stream->printf("cpu - shows how busy the cpu was over the last second\r\n");
+    stream->printf("rxspace [on|off] - report the receive space left on this port after every ok\r\n");
+    stream->printf("log [file|off] - copy all console output to the end of a file\r\n");
+    stream->printf("command >> file - append what a command prints to a file\r\n");
+    stream->printf("sdbench [KB] - time writing and reading back a file on the sd card, 1024KB by default\r\n");
     stream->printf("load [file] - loads a configuration override file from soecified name or config-override\r\n");
     stream->printf("save [file] - saves a configuration override file as specified filename or as config-override\r\n");
 }
@@ -16,6 +16,8 @@
 using std::string;
 
 class StreamOutput;
+class AppendFileStream;
+class OutputJob;
 
 class SimpleShell : public Module
 {
@@ -26,9 +28,11 @@ public:
     void on_console_line_received( void *argument );
     void on_gcode_received(void *argument);
     void on_second_tick(void *);
+    void on_main_loop(void *);
 
 private:
     static void ls_command(string parameters, StreamOutput *stream );
+    static OutputJob *ls_job(string parameters, StreamOutput *stream );
     static void cd_command(string parameters, StreamOutput *stream );
     static void delete_file_command(string parameters, StreamOutput *stream );
     static void pwd_command(string parameters, StreamOutput *stream );
@@ -52,6 +56,17 @@ private:
     static void save_command( string parameters, StreamOutput *stream);
 
     static void remount_command( string parameters, StreamOutput *stream);
+    static void prof_command( string parameters, StreamOutput *stream);
+    static void boottime_command( string parameters, StreamOutput *stream);
+    static void looptime_command( string parameters, StreamOutput *stream);
+    static void cpu_command( string parameters, StreamOutput *stream);
+    static void rxspace_command( string parameters, StreamOutput *stream);
+    static void sdbench_command( string parameters, StreamOutput *stream);
+    static void md5sum_command( string parameters, StreamOutput *stream);
+    static void fwdiff_command( string parameters, StreamOutput *stream);
+    static void trace_command( string parameters, StreamOutput *stream);
+    static void bench_command( string parameters, StreamOutput *stream);
+    static void log_command( string parameters, StreamOutput *stream);
 
     bool parse_command(const char *cmd, string args, StreamOutput *stream);
 
@@ -63,6 +78,9 @@ private:
 
     static const ptentry_t commands_table[];
     static int reset_delay_secs;
+    static int mem_log_secs;
+    static int mem_log_countdown;
+    static AppendFileStream *log_stream;
 };
 
 